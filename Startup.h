@@ -0,0 +1,29 @@
+/**
+ * @file    Startup.h
+ * @brief   **Startup and Vector Table**
+ *
+ * Runtime access to the exception handlers. With STARTUP_RAM_VECTORS set to STD_ON the reset
+ * handler copies the vector table to SRAM and points VTOR to it, the core then fetches the vectors
+ * from zero wait state SRAM and Startup_SetHandler replaces a handler without rebuilding, the way a
+ * test swaps an ISR or a bootloader hands the interrupts over to the application. Vector numbers
+ * are exception numbers, the device interrupt n is the vector STARTUP_IRQ( n ).
+ */
+#ifndef STARTUP_H
+#define STARTUP_H
+
+#include "Std_Types.h"
+
+/* clang-format off */
+#define STARTUP_VECTORS         48u                         /*!< entries of the vector table */
+#define STARTUP_IRQ( Irq )      ( (uint8)( ( Irq ) + 16u ) ) /*!< vector of the device interrupt Irq */
+/* clang-format on */
+
+/**
+ * @brief   Exception handler
+ */
+typedef void ( *Startup_HandlerType )( void );
+
+Std_ReturnType Startup_SetHandler( uint8 Vector, Startup_HandlerType Handler );
+Startup_HandlerType Startup_GetHandler( uint8 Vector );
+
+#endif /* STARTUP_H */
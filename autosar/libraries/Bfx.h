@@ -20,5 +20,6 @@
 #include "Bfx_16bits.h"
 #include "Bfx_32bits.h"
 #include "Bfx_64bits.h"
+#include "Bfx_Atomic.h"
 
 #endif /* BFX_H */
@@ -17,6 +17,13 @@
 
 #include "Std_Types.h"
 
+#if defined( __BMI2__ )
+#include <immintrin.h>
+#endif
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
 /**
  * @brief **16 bits Set Bit**
  *
@@ -264,7 +271,7 @@ static inline boolean Bfx_TstBitLnMask_u16u16_u8( uint16 Data, uint16 Mask )
 static inline boolean Bfx_TstParityEven_u16_u8( uint16 Data )
 {
     uint8 Count = 0u;
-    uint8 Temp  = Data;
+    uint16 Temp = Data;
 
     while( Temp != 0u )
     {
@@ -390,7 +397,7 @@ static inline void Bfx_ShiftBitLt_u16u8( uint16 *Data, uint8 ShiftCnt )
  */
 static inline void Bfx_RotBitRt_u16u8( uint16 *Data, uint8 ShiftCnt )
 {
-    *Data = ( *Data << ( 16u - ShiftCnt ) ) | ( *Data >> ShiftCnt );
+    *Data = ( *Data << ( ( 16u - ShiftCnt ) & 15u ) ) | ( *Data >> ShiftCnt );
 }
 
 /**
@@ -417,7 +424,7 @@ static inline void Bfx_RotBitRt_u16u8( uint16 *Data, uint8 ShiftCnt )
  */
 static inline void Bfx_RotBitLt_u16u8( uint16 *Data, uint8 ShiftCnt )
 {
-    *Data = ( *Data >> ( 16u - ShiftCnt ) ) | ( *Data << ShiftCnt );
+    *Data = ( *Data >> ( ( 16u - ShiftCnt ) & 15u ) ) | ( *Data << ShiftCnt );
 }
 
 /**
@@ -568,9 +575,9 @@ static inline sint16 Bfx_ShiftBitSat_s16s8_s16( sint16 Data, sint8 ShiftCnt )
 
     if( ShiftCnt >= 0 )
     {
-        result = Data << ShiftCnt; /*Shift left*/
+        result = (sint16)( (uint16)Data << ShiftCnt ); /*Shift left*/
         /*Check for saturation */
-        if( ( ( Data < 0 ) && ( result > Data ) ) || ( ( Data >= 0 ) && ( result < Data ) ) )
+        if( ( Data > ( INT16_MAX >> ShiftCnt ) ) || ( Data < ( INT16_MIN >> ShiftCnt ) ) )
         {
             if( Data < 0 )
             {
@@ -630,7 +637,7 @@ static inline uint16 Bfx_ShiftBitSat_u16s8_u16( uint16 Data, sint8 ShiftCnt )
     {
         result = Data << ShiftCnt; /*Shift left */
         /*Check for saturation */
-        if( result < Data )
+        if( Data > ( UINT16_MAX >> ShiftCnt ) )
         {
             result = UINT16_MAX; /*Saturate result */
         }
@@ -729,12 +736,12 @@ static inline uint8 Bfx_CountLeadingSigns_s16( sint16 Data )
  *
  * @reqs    SWS_Bfx_91005, SWS_Bfx_00141
  */
-static inline uint8 Bfx_CountLeadingZeros_u16( uint8 Data )
+static inline uint8 Bfx_CountLeadingZeros_u16( uint16 Data )
 {
     uint8 Count       = 0u;
     uint16 BitChecker = 0x8000u;
 
-    while( ( Data & BitChecker ) == 0u )
+    while( ( BitChecker != 0u ) && ( ( Data & BitChecker ) == 0u ) )
     {
         Count++;
         BitChecker >>= 1u;
@@ -743,4 +750,286 @@ static inline uint8 Bfx_CountLeadingZeros_u16( uint8 Data )
     return Count;
 }
 
+/**
+ * @brief  **16 bit Deposit bits**
+ *
+ * Scatters the low order bits of Data into the bit positions marked with 1 in Mask, starting from
+ * the least significant bit of the mask. Bits of the result not covered by the mask are set to 0
+ * (equivalent to the x86 PDEP instruction).
+ *
+ * The BMI2 instruction is used when available on the host, otherwise the loop only iterates over
+ * the bits set in Mask. When Mask is a compile time constant with a single group of ones the
+ * routine is reduced to a shift and an and operation.
+ *
+ * **Example:**
+ *      @code
+ *      Res = Bfx_DepositBits_u16u16_u16(00000101b, 01011010b)
+ *      Res will equal to 00010010b.
+ *      @endcode
+ *
+ * @param[in] Data Compact bits to deposit
+ * @param[in] Mask Bit positions where the bits will be placed
+ *
+ * @retval Deposited bits
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint16 Bfx_DepositBits_u16u16_u16( uint16 Data, uint16 Mask )
+{
+    uint16 Result = 0u;
+
+#if defined( __GNUC__ )
+    /*single group of ones known at compile time, just move the bits in place*/
+    if( __builtin_constant_p( Mask ) && ( Mask != 0u ) && ( ( ( Mask + ( Mask & ( ~Mask + 1u ) ) ) & Mask ) == 0u ) )
+    {
+        return (uint16)( ( Data << __builtin_ctz( Mask ) ) & Mask );
+    }
+#endif
+#if defined( __BMI2__ )
+    Result = (uint16)_pdep_u32( Data, Mask );
+#else
+    for( uint16 Bit = 1u; Mask != 0u; Bit <<= 1u )
+    {
+        if( ( Data & Bit ) != 0u )
+        {
+            Result |= Mask & ( ~Mask + 1u ); /*lowest bit set in the mask*/
+        }
+        Mask &= Mask - 1u;
+    }
+#endif
+
+    return Result;
+}
+
+/**
+ * @brief  **16 bit Extract bits**
+ *
+ * Gathers the bits of Data at the positions marked with 1 in Mask and packs them into the low order
+ * bits of the result, the rest of the bits are set to 0 (equivalent to the x86 PEXT instruction).
+ *
+ * The BMI2 instruction is used when available on the host, otherwise the loop only iterates over
+ * the bits set in Mask. When Mask is a compile time constant with a single group of ones the
+ * routine is reduced to an and and a shift operation.
+ *
+ * **Example:**
+ *      @code
+ *      Res = Bfx_ExtractBits_u16u16_u16(11000110b, 01011010b)
+ *      Res will equal to 00001001b.
+ *      @endcode
+ *
+ * @param[in] Data Input data
+ * @param[in] Mask Bit positions to extract
+ *
+ * @retval Extracted bits
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint16 Bfx_ExtractBits_u16u16_u16( uint16 Data, uint16 Mask )
+{
+    uint16 Result = 0u;
+
+#if defined( __GNUC__ )
+    /*single group of ones known at compile time, just move the bits in place*/
+    if( __builtin_constant_p( Mask ) && ( Mask != 0u ) && ( ( ( Mask + ( Mask & ( ~Mask + 1u ) ) ) & Mask ) == 0u ) )
+    {
+        return (uint16)( ( Data & Mask ) >> __builtin_ctz( Mask ) );
+    }
+#endif
+#if defined( __BMI2__ )
+    Result = (uint16)_pext_u32( Data, Mask );
+#else
+    for( uint16 Bit = 1u; Mask != 0u; Bit <<= 1u )
+    {
+        if( ( Data & Mask & ( ~Mask + 1u ) ) != 0u )
+        {
+            Result |= Bit;
+        }
+        Mask &= Mask - 1u;
+    }
+#endif
+
+    return Result;
+}
+
+/**
+ * @brief  **16 bit Block Count Leading Signs**
+ *
+ * Count the minimum number of redundant sign bits over all the values of an array, the common
+ * headroom of the block. Each value is xored with its own sign so its redundant sign bits become
+ * leading zeros, the results are ored together and the leading signs are counted once at the end,
+ * the per value cost is a shift, a xor and an or. Four values are processed per loop iteration and
+ * 8 per iteration with SSE2 on the host.
+ *
+ * **Example:**
+ *      @code
+ *      Data = { 0x0040, -0x0200, 0x0012, 0x0000 }
+ *      Res = Bfx_CountLeadingSignsBlock_s16(Data, 4)
+ *      Res is equal to 6
+ *      @endcode
+ *
+ * @param[in] Data Pointer to the values
+ * @param[in] Length Number of values
+ *
+ * @retval Minimum number of leading sign bits minus one, 15 when all values are 0 or -1
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint8 Bfx_CountLeadingSignsBlock_s16( const sint16 *Data, uint32 Length )
+{
+    uint32 Signs = 0u;
+    uint32 i     = 0u;
+
+#if defined( __SSE2__ )
+    __m128i Vector = _mm_setzero_si128();
+    __m128i Value;
+
+    for( ; ( i + 8u ) <= Length; i += 8u )
+    {
+        Value  = _mm_loadu_si128( (const __m128i *)&Data[ i ] );
+        Vector = _mm_or_si128( Vector, _mm_xor_si128( Value, _mm_srai_epi16( Value, 15 ) ) );
+    }
+    /*or the lanes together*/
+    Vector = _mm_or_si128( Vector, _mm_srli_si128( Vector, 8 ) );
+    Vector = _mm_or_si128( Vector, _mm_srli_si128( Vector, 4 ) );
+    Vector = _mm_or_si128( Vector, _mm_srli_si128( Vector, 2 ) );
+    Signs  = (uint32)_mm_cvtsi128_si32( Vector ) & 0xFFFFu;
+#endif
+    for( ; ( i + 4u ) <= Length; i += 4u )
+    {
+        Signs |= (uint16)( Data[ i ] ^ ( Data[ i ] >> 15 ) );
+        Signs |= (uint16)( Data[ i + 1u ] ^ ( Data[ i + 1u ] >> 15 ) );
+        Signs |= (uint16)( Data[ i + 2u ] ^ ( Data[ i + 2u ] >> 15 ) );
+        Signs |= (uint16)( Data[ i + 3u ] ^ ( Data[ i + 3u ] >> 15 ) );
+    }
+    for( ; i < Length; i++ )
+    {
+        Signs |= (uint16)( Data[ i ] ^ ( Data[ i ] >> 15 ) );
+    }
+
+    return Bfx_CountLeadingSigns_s16( (sint16)Signs );
+}
+
+/**
+ * @brief  **16 bit Block Arithmetic shift with saturation**
+ *
+ * Shifts all the values of an array with the same rules as Bfx_ShiftBitSat_s16s8_s16, left shifts
+ * saturate the values that do not fit and right shifts fill the vacated bits with the sign bit.
+ * The values over INT16_MAX >> ShiftCnt or below its complement are the ones that saturate, so the
+ * check is two compares per value. Four values are processed per loop iteration and 8 per
+ * iteration with SSE2 on the host.
+ *
+ * **Example:**
+ *      @code
+ *      Data = { 0x1000, -0x2000, 0x0100 }
+ *      Bfx_ShiftBlockSat_s16s8(Data, 3, 3)
+ *      Data will equal to { 0x7FFF, -0x8000, 0x0800 }.
+ *      @endcode
+ *
+ * @param[in,out] Data Pointer to the values to shift
+ * @param[in] Length Number of values
+ * @param[in] ShiftCnt Shift count (-16 ... -1: right, 1 ... 15: left)
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline void Bfx_ShiftBlockSat_s16s8( sint16 *Data, uint32 Length, sint8 ShiftCnt )
+{
+    uint8 Shift = ( ShiftCnt < 0 ) ? (uint8)-ShiftCnt : (uint8)ShiftCnt;
+    sint16 Limit;
+    uint32 i    = 0u;
+
+    /*a right shift by the word width gives the same sign fill as 15 bits*/
+    if( Shift > 15u )
+    {
+        Shift = 15u;
+    }
+    Limit = INT16_MAX >> Shift;
+
+#if defined( __SSE2__ )
+    __m128i Count = _mm_cvtsi32_si128( Shift );
+    __m128i Upper = _mm_set1_epi16( Limit );
+    __m128i Lower = _mm_set1_epi16( ~Limit );
+    __m128i Value;
+    __m128i Over;
+    __m128i Under;
+    __m128i Result;
+
+    for( ; ( i + 8u ) <= Length; i += 8u )
+    {
+        Value = _mm_loadu_si128( (const __m128i *)&Data[ i ] );
+        if( ShiftCnt < 0 )
+        {
+            Result = _mm_sra_epi16( Value, Count );
+        }
+        else
+        {
+            /*blend the shifted values with the limits where they overflow*/
+            Over   = _mm_cmpgt_epi16( Value, Upper );
+            Under  = _mm_cmplt_epi16( Value, Lower );
+            Result = _mm_andnot_si128( _mm_or_si128( Over, Under ), _mm_sll_epi16( Value, Count ) );
+            Result = _mm_or_si128( Result, _mm_and_si128( Over, _mm_set1_epi16( INT16_MAX ) ) );
+            Result = _mm_or_si128( Result, _mm_and_si128( Under, _mm_set1_epi16( INT16_MIN ) ) );
+        }
+        _mm_storeu_si128( (__m128i *)&Data[ i ], Result );
+    }
+#endif
+    if( ShiftCnt < 0 )
+    {
+        for( ; ( i + 4u ) <= Length; i += 4u )
+        {
+            Data[ i ]      = (sint16)( Data[ i ] >> Shift );
+            Data[ i + 1u ] = (sint16)( Data[ i + 1u ] >> Shift );
+            Data[ i + 2u ] = (sint16)( Data[ i + 2u ] >> Shift );
+            Data[ i + 3u ] = (sint16)( Data[ i + 3u ] >> Shift );
+        }
+        for( ; i < Length; i++ )
+        {
+            Data[ i ] = (sint16)( Data[ i ] >> Shift );
+        }
+    }
+    else
+    {
+        for( ; ( i + 4u ) <= Length; i += 4u )
+        {
+            Data[ i ]      = ( Data[ i ] > Limit ) ? INT16_MAX : ( ( Data[ i ] < ~Limit ) ? INT16_MIN : (sint16)( (uint16)Data[ i ] << Shift ) );
+            Data[ i + 1u ] = ( Data[ i + 1u ] > Limit ) ? INT16_MAX : ( ( Data[ i + 1u ] < ~Limit ) ? INT16_MIN : (sint16)( (uint16)Data[ i + 1u ] << Shift ) );
+            Data[ i + 2u ] = ( Data[ i + 2u ] > Limit ) ? INT16_MAX : ( ( Data[ i + 2u ] < ~Limit ) ? INT16_MIN : (sint16)( (uint16)Data[ i + 2u ] << Shift ) );
+            Data[ i + 3u ] = ( Data[ i + 3u ] > Limit ) ? INT16_MAX : ( ( Data[ i + 3u ] < ~Limit ) ? INT16_MIN : (sint16)( (uint16)Data[ i + 3u ] << Shift ) );
+        }
+        for( ; i < Length; i++ )
+        {
+            Data[ i ] = ( Data[ i ] > Limit ) ? INT16_MAX : ( ( Data[ i ] < ~Limit ) ? INT16_MIN : (sint16)( (uint16)Data[ i ] << Shift ) );
+        }
+    }
+}
+
+/**
+ * @brief  **16 bit Block Normalisation**
+ *
+ * Shifts all the values of an array to the left by their common headroom, the block exponent, so
+ * the largest magnitude uses the full 16 bits without any value saturating. The array is read once
+ * to find the headroom and read and written once to shift it.
+ *
+ * **Example:**
+ *      @code
+ *      Data = { 0x0040, -0x0200, 0x0012, 0x0000 }
+ *      Res = Bfx_NormalizeBlock_s16(Data, 4)
+ *      Res is equal to 6 and Data will equal to { 0x1000, -0x8000, 0x0480, 0x0000 }.
+ *      @endcode
+ *
+ * @param[in,out] Data Pointer to the values to normalise
+ * @param[in] Length Number of values
+ *
+ * @retval Number of bits the block was shifted to the left
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint8 Bfx_NormalizeBlock_s16( sint16 *Data, uint32 Length )
+{
+    uint8 Exponent = Bfx_CountLeadingSignsBlock_s16( Data, Length );
+
+    Bfx_ShiftBlockSat_s16s8( Data, Length, (sint8)Exponent );
+
+    return Exponent;
+}
+
 #endif /* BFX_16BITS_H */
@@ -17,6 +17,13 @@
 
 #include "Std_Types.h"
 
+#if defined( __BMI2__ )
+#include <immintrin.h>
+#endif
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
 /**
  * @brief **32 bits Set Bit**
  *
@@ -34,7 +41,7 @@
  *
  * @reqs    SWS_Bfx_00001, SWS_Bfx_00002, SWS_Bfx_00008
  */
-void Bfx_SetBit_u32u8( uint32 *Data, uint8 BitPn )
+static inline void Bfx_SetBit_u32u8( uint32 *Data, uint8 BitPn )
 {
     *Data |= ( 1u << BitPn );
 }
@@ -56,7 +63,7 @@ void Bfx_SetBit_u32u8( uint32 *Data, uint8 BitPn )
  *
  * @reqs    SWS_Bfx_00010, SWS_Bfx_00011, SWS_Bfx_00015
  */
-void Bfx_ClrBit_u32u8( uint32 *Data, uint8 BitPn )
+static inline void Bfx_ClrBit_u32u8( uint32 *Data, uint8 BitPn )
 {
     *Data &= ~( 1u << BitPn );
 }
@@ -79,7 +86,7 @@ void Bfx_ClrBit_u32u8( uint32 *Data, uint8 BitPn )
  *
  * @reqs    SWS_Bfx_00016, SWS_Bfx_00017, SWS_Bfx_00020
  */
-boolean Bfx_GetBit_u32u8_u8( uint32 Data, uint8 BitPn )
+static inline boolean Bfx_GetBit_u32u8_u8( uint32 Data, uint8 BitPn )
 {
     return ( ( Data & ( 1u << BitPn ) ) != 0u );
 }
@@ -103,12 +110,12 @@ boolean Bfx_GetBit_u32u8_u8( uint32 Data, uint8 BitPn )
  *
  * @reqs    SWS_Bfx_00021, SWS_Bfx_00022, SWS_Bfx_00025
  */
-void Bfx_SetBits_u32u8u8u8( uint32 *Data, uint8 BitStartPn, uint8 BitLn, uint8 Status )
+static inline void Bfx_SetBits_u32u8u8u8( uint32 *Data, uint8 BitStartPn, uint8 BitLn, uint8 Status )
 {
     uint32 Mask;
 
-    Mask = 0xFFFFFFFFu << BitStartPn;
-    Mask &= ~( 0xFFFFFFFFu << ( BitStartPn + BitLn ) );
+    Mask = ( BitLn < 32u ) ? ( ( 1u << BitLn ) - 1u ) : 0xFFFFFFFFu;
+    Mask <<= BitStartPn;
 
     if( Status == TRUE )
     {
@@ -139,12 +146,15 @@ void Bfx_SetBits_u32u8u8u8( uint32 *Data, uint8 BitStartPn, uint8 BitLn, uint8 S
  *
  * @reqs    SWS_Bfx_00028, SWS_Bfx_00029, SWS_Bfx_00034
  */
-uint32 Bfx_GetBits_u32u8u8_u32( uint32 Data, uint8 BitStartPn, uint8 BitLn )
+static inline uint32 Bfx_GetBits_u32u8u8_u32( uint32 Data, uint8 BitStartPn, uint8 BitLn )
 {
     uint32 Bits;
 
     Bits = Data >> BitStartPn;
-    Bits &= ~( 0xFFFFFFFFu << ( BitLn ) );
+    if( BitLn < 32u )
+    {
+        Bits &= ~( 0xFFFFFFFFu << BitLn );
+    }
 
     return Bits;
 }
@@ -167,7 +177,7 @@ uint32 Bfx_GetBits_u32u8u8_u32( uint32 Data, uint8 BitStartPn, uint8 BitLn )
  *
  * @reqs    SWS_Bfx_00035, SWS_Bfx_00036, SWS_Bfx_00038
  */
-void Bfx_SetBitMask_u32u32( uint32 *Data, uint32 Mask )
+static inline void Bfx_SetBitMask_u32u32( uint32 *Data, uint32 Mask )
 {
     *Data |= Mask;
 }
@@ -190,7 +200,7 @@ void Bfx_SetBitMask_u32u32( uint32 *Data, uint32 Mask )
  *
  * @reqs    SWS_Bfx_00039, SWS_Bfx_00040, SWS_Bfx_00045
  */
-void Bfx_ClrBitMask_u32u32( uint32 *Data, uint32 Mask )
+static inline void Bfx_ClrBitMask_u32u32( uint32 *Data, uint32 Mask )
 {
     *Data &= ~Mask;
 }
@@ -214,7 +224,7 @@ void Bfx_ClrBitMask_u32u32( uint32 *Data, uint32 Mask )
  *
  * @reqs    SWS_Bfx_00046, SWS_Bfx_00047, SWS_Bfx_00050
  */
-boolean Bfx_TstBitMask_u32u32_u8( uint32 Data, uint32 Mask )
+static inline boolean Bfx_TstBitMask_u32u32_u8( uint32 Data, uint32 Mask )
 {
     return ( ( Data & Mask ) == Mask );
 }
@@ -238,7 +248,7 @@ boolean Bfx_TstBitMask_u32u32_u8( uint32 Data, uint32 Mask )
  *
  * @reqs    SWS_Bfx_00051, SWS_Bfx_00055
  */
-boolean Bfx_TstBitLnMask_u32u32_u8( uint32 Data, uint32 Mask )
+static inline boolean Bfx_TstBitLnMask_u32u32_u8( uint32 Data, uint32 Mask )
 {
     return ( ( Data & Mask ) != 0u );
 }
@@ -261,7 +271,7 @@ boolean Bfx_TstBitLnMask_u32u32_u8( uint32 Data, uint32 Mask )
  *
  * @reqs    SWS_Bfx_00056, SWS_Bfx_00060
  */
-boolean Bfx_TstParityEven_u32_u8( uint32 Data )
+static inline boolean Bfx_TstParityEven_u32_u8( uint32 Data )
 {
     uint8 Count = 0u;
     uint32 Temp = Data;
@@ -291,7 +301,7 @@ boolean Bfx_TstParityEven_u32_u8( uint32 Data )
  *
  * @reqs    SWS_Bfx_00061, SWS_Bfx_00065
  */
-void Bfx_ToggleBits_u32( uint32 *Data )
+static inline void Bfx_ToggleBits_u32( uint32 *Data )
 {
     *Data ^= 0xFFFFFFFFu;
 }
@@ -313,7 +323,7 @@ void Bfx_ToggleBits_u32( uint32 *Data )
  *
  * @reqs    SWS_Bfx_00066, SWS_Bfx_00069
  */
-void Bfx_ToggleBitMask_u32u32( uint32 *Data, uint32 Mask )
+static inline void Bfx_ToggleBitMask_u32u32( uint32 *Data, uint32 Mask )
 {
     *Data ^= Mask;
 }
@@ -337,7 +347,7 @@ void Bfx_ToggleBitMask_u32u32( uint32 *Data, uint32 Mask )
  *
  * @reqs    SWS_Bfx_00070, SWS_Bfx_00075
  */
-void Bfx_ShiftBitRt_u32u8( uint32 *Data, uint8 ShiftCnt )
+static inline void Bfx_ShiftBitRt_u32u8( uint32 *Data, uint8 ShiftCnt )
 {
     *Data >>= ShiftCnt;
 }
@@ -361,7 +371,7 @@ void Bfx_ShiftBitRt_u32u8( uint32 *Data, uint8 ShiftCnt )
  *
  * @reqs    SWS_Bfx_00076, SWS_Bfx_00080
  */
-void Bfx_ShiftBitLt_u32u8( uint32 *Data, uint8 ShiftCnt )
+static inline void Bfx_ShiftBitLt_u32u8( uint32 *Data, uint8 ShiftCnt )
 {
     *Data <<= ShiftCnt;
 }
@@ -388,9 +398,9 @@ void Bfx_ShiftBitLt_u32u8( uint32 *Data, uint8 ShiftCnt )
  *
  * @reqs    SWS_Bfx_00086, SWS_Bfx_00090
  */
-void Bfx_RotBitRt_u32u8( uint32 *Data, uint8 ShiftCnt )
+static inline void Bfx_RotBitRt_u32u8( uint32 *Data, uint8 ShiftCnt )
 {
-    *Data = ( *Data << ( 32u - ShiftCnt ) ) | ( *Data >> ShiftCnt );
+    *Data = ( *Data << ( ( 32u - ShiftCnt ) & 31u ) ) | ( *Data >> ShiftCnt );
 }
 
 /**
@@ -415,9 +425,9 @@ void Bfx_RotBitRt_u32u8( uint32 *Data, uint8 ShiftCnt )
  *
  * @reqs    SWS_Bfx_00095, SWS_Bfx_00098
  */
-void Bfx_RotBitLt_u32u8( uint32 *Data, uint8 ShiftCnt )
+static inline void Bfx_RotBitLt_u32u8( uint32 *Data, uint8 ShiftCnt )
 {
-    *Data = ( *Data >> ( 32u - ShiftCnt ) ) | ( *Data << ShiftCnt );
+    *Data = ( *Data >> ( ( 32u - ShiftCnt ) & 31u ) ) | ( *Data << ShiftCnt );
 }
 
 /**
@@ -440,7 +450,7 @@ void Bfx_RotBitLt_u32u8( uint32 *Data, uint8 ShiftCnt )
  *
  * @reqs    SWS_Bfx_00101, SWS_Bfx_00108
  */
-void Bfx_CopyBit_u32u8u32u8( uint32 *DestinationData, uint8 DestinationPosition, uint32 SourceData, uint8 SourcePosition )
+static inline void Bfx_CopyBit_u32u8u32u8( uint32 *DestinationData, uint8 DestinationPosition, uint32 SourceData, uint8 SourcePosition )
 {
     if( ( SourceData & ( 1u << SourcePosition ) ) == 0u )
     {
@@ -472,9 +482,9 @@ void Bfx_CopyBit_u32u8u32u8( uint32 *DestinationData, uint8 DestinationPosition,
  *
  * @reqs    SWS_Bfx_00110, SWS_Bfx_00112
  */
-void Bfx_PutBits_u32u8u8u32( uint32 *Data, uint8 BitStartPn, uint8 BitLn, uint32 Pattern )
+static inline void Bfx_PutBits_u32u8u8u32( uint32 *Data, uint8 BitStartPn, uint8 BitLn, uint32 Pattern )
 {
-    uint32 Mask = ( 1u << BitLn ) - 1u;
+    uint32 Mask = ( BitLn < 32u ) ? ( ( 1u << BitLn ) - 1u ) : 0xFFFFFFFFu;
 
     *Data &= ~( Mask << BitStartPn );
     *Data |= ( Pattern & Mask ) << BitStartPn;
@@ -499,7 +509,7 @@ void Bfx_PutBits_u32u8u8u32( uint32 *Data, uint8 BitStartPn, uint8 BitLn, uint32
  *
  * @reqs    SWS_Bfx_00120, SWS_Bfx_00124
  */
-void Bfx_PutBitsMask_u32u32u32( uint32 *Data, uint32 Pattern, uint32 Mask )
+static inline void Bfx_PutBitsMask_u32u32u32( uint32 *Data, uint32 Pattern, uint32 Mask )
 {
     *Data = ( ( Pattern & Mask ) | ( *Data & ~Mask ) );
 }
@@ -523,7 +533,7 @@ void Bfx_PutBitsMask_u32u32u32( uint32 *Data, uint32 Pattern, uint32 Mask )
  *
  * @reqs    SWS_Bfx_00130, SWS_Bfx_00132
  */
-void Bfx_PutBit_u32u8u8( uint32 *Data, uint8 BitPn, boolean Status )
+static inline void Bfx_PutBit_u32u8u8( uint32 *Data, uint8 BitPn, boolean Status )
 {
     if( Status == TRUE )
     {
@@ -568,9 +578,9 @@ static inline sint32 Bfx_ShiftBitSat_s32s8_s32( sint32 Data, sint8 ShiftCnt )
 
     if( ShiftCnt >= 0 )
     {
-        result = Data << ShiftCnt; /*Shift left*/
+        result = (sint32)( (uint32)Data << ShiftCnt ); /*Shift left*/
         /*Check for saturation */
-        if( ( ( Data < 0 ) && ( result > Data ) ) || ( ( Data >= 0 ) && ( result < Data ) ) )
+        if( ( Data > ( INT32_MAX >> ShiftCnt ) ) || ( Data < ( INT32_MIN >> ShiftCnt ) ) )
         {
             if( Data < 0 )
             {
@@ -630,7 +640,7 @@ static inline uint32 Bfx_ShiftBitSat_u32s8_u32( uint32 Data, sint8 ShiftCnt )
     {
         result = Data << ShiftCnt; /*Shift left */
         /*Check for saturation */
-        if( result < Data )
+        if( Data > ( UINT32_MAX >> ShiftCnt ) )
         {
             result = UINT32_MAX; /*Saturate result */
         }
@@ -662,7 +672,7 @@ static inline uint32 Bfx_ShiftBitSat_u32s8_u32( uint32 Data, sint8 ShiftCnt )
  *
  * @reqs    SWS_Bfx_91003, SWS_Bfx_00137
  */
-uint8 Bfx_CountLeadingOnes_u32( uint32 Data )
+static inline uint8 Bfx_CountLeadingOnes_u32( uint32 Data )
 {
     uint8 Count       = 0u;
     uint32 BitChecker = 0x80000000u;
@@ -695,7 +705,7 @@ uint8 Bfx_CountLeadingOnes_u32( uint32 Data )
  *
  * @reqs    SWS_Bfx_91004, SWS_Bfx_00139
  */
-uint8 Bfx_CountLeadingSigns_s32( sint32 Data )
+static inline uint8 Bfx_CountLeadingSigns_s32( sint32 Data )
 {
     uint8 Count = 0u;
 
@@ -712,35 +722,406 @@ uint8 Bfx_CountLeadingSigns_s32( sint32 Data )
 }
 
 /**
- * @brief  **8 bit Count Leading Zeros**
+ * @brief  **32 bit Count Leading Zeros**
  *
  * Count the number of consecutive zeros in Data starting with the most significant bit and return
- * the result
+ * the result. The bits below the most significant one are set and the result is mapped to the
+ * count with a de Bruijn multiplication and a 32 entries table, so the execution time is constant
+ * even on cores without a count leading zeros instruction like the Cortex-M0+.
  *
  * **Example:**
  *      @code
  *      Res = Bfx_CountLeadingZeros_u32(00100110b);
- *      Res is equal to 2
+ *      Res is equal to 26
  *      @endcode
  *
  * @param[in] Data Input data
  *
- * @retval Bit position
+ * @retval Bit position, 32 if Data is 0
  *
  * @reqs    SWS_Bfx_91005, SWS_Bfx_00141
  */
-uint8 Bfx_CountLeadingZeros_u32( uint32 Data )
+static inline uint8 Bfx_CountLeadingZeros_u32( uint32 Data )
 {
-    uint8 Count       = 0u;
-    uint32 BitChecker = 0x80000000u;
+    static const uint8 DeBruijnCount[ 32 ] = {
+        31u, 22u, 30u, 21u, 18u, 10u, 29u, 2u, 20u, 17u, 15u, 13u, 9u, 6u, 28u, 1u,
+        23u, 19u, 11u, 3u, 16u, 14u, 7u, 24u, 12u, 4u, 8u, 25u, 5u, 26u, 27u, 0u };
+    uint8 Count = 32u;
 
-    while( ( Data & BitChecker ) == 0u )
+    if( Data != 0u )
     {
-        Count++;
-        BitChecker >>= 1u;
+        /*set all the bits below the most significant one*/
+        Data |= Data >> 1u;
+        Data |= Data >> 2u;
+        Data |= Data >> 4u;
+        Data |= Data >> 8u;
+        Data |= Data >> 16u;
+        Count = DeBruijnCount[ ( Data * 0x07C4ACDDu ) >> 27u ];
     }
 
     return Count;
 }
 
+/**
+ * @brief  **32 bit Deposit bits**
+ *
+ * Scatters the low order bits of Data into the bit positions marked with 1 in Mask, starting from
+ * the least significant bit of the mask. Bits of the result not covered by the mask are set to 0
+ * (equivalent to the x86 PDEP instruction).
+ *
+ * The BMI2 instruction is used when available on the host, otherwise the loop only iterates over
+ * the bits set in Mask. When Mask is a compile time constant with a single group of ones the
+ * routine is reduced to a shift and an and operation.
+ *
+ * **Example:**
+ *      @code
+ *      Res = Bfx_DepositBits_u32u32_u32(00000101b, 01011010b)
+ *      Res will equal to 00010010b.
+ *      @endcode
+ *
+ * @param[in] Data Compact bits to deposit
+ * @param[in] Mask Bit positions where the bits will be placed
+ *
+ * @retval Deposited bits
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint32 Bfx_DepositBits_u32u32_u32( uint32 Data, uint32 Mask )
+{
+    uint32 Result = 0u;
+
+#if defined( __GNUC__ )
+    /*single group of ones known at compile time, just move the bits in place*/
+    if( __builtin_constant_p( Mask ) && ( Mask != 0u ) && ( ( ( Mask + ( Mask & ( ~Mask + 1u ) ) ) & Mask ) == 0u ) )
+    {
+        return ( ( Data << __builtin_ctz( Mask ) ) & Mask );
+    }
+#endif
+#if defined( __BMI2__ )
+    Result = _pdep_u32( Data, Mask );
+#else
+    for( uint32 Bit = 1u; Mask != 0u; Bit <<= 1u )
+    {
+        if( ( Data & Bit ) != 0u )
+        {
+            Result |= Mask & ( ~Mask + 1u ); /*lowest bit set in the mask*/
+        }
+        Mask &= Mask - 1u;
+    }
+#endif
+
+    return Result;
+}
+
+/**
+ * @brief  **32 bit Extract bits**
+ *
+ * Gathers the bits of Data at the positions marked with 1 in Mask and packs them into the low order
+ * bits of the result, the rest of the bits are set to 0 (equivalent to the x86 PEXT instruction).
+ *
+ * The BMI2 instruction is used when available on the host, otherwise the loop only iterates over
+ * the bits set in Mask. When Mask is a compile time constant with a single group of ones the
+ * routine is reduced to an and and a shift operation.
+ *
+ * **Example:**
+ *      @code
+ *      Res = Bfx_ExtractBits_u32u32_u32(11000110b, 01011010b)
+ *      Res will equal to 00001001b.
+ *      @endcode
+ *
+ * @param[in] Data Input data
+ * @param[in] Mask Bit positions to extract
+ *
+ * @retval Extracted bits
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint32 Bfx_ExtractBits_u32u32_u32( uint32 Data, uint32 Mask )
+{
+    uint32 Result = 0u;
+
+#if defined( __GNUC__ )
+    /*single group of ones known at compile time, just move the bits in place*/
+    if( __builtin_constant_p( Mask ) && ( Mask != 0u ) && ( ( ( Mask + ( Mask & ( ~Mask + 1u ) ) ) & Mask ) == 0u ) )
+    {
+        return ( ( Data & Mask ) >> __builtin_ctz( Mask ) );
+    }
+#endif
+#if defined( __BMI2__ )
+    Result = _pext_u32( Data, Mask );
+#else
+    for( uint32 Bit = 1u; Mask != 0u; Bit <<= 1u )
+    {
+        if( ( Data & Mask & ( ~Mask + 1u ) ) != 0u )
+        {
+            Result |= Bit;
+        }
+        Mask &= Mask - 1u;
+    }
+#endif
+
+    return Result;
+}
+
+/**
+ * @brief  **32x32 bit matrix transpose**
+ *
+ * Transposes a matrix of 32 rows by 32 bits, bit j of row i in Source is placed at bit i of row j
+ * in Destination. The transpose is done in place over Destination swapping blocks of 16, 8, 4, 2
+ * and 1 bits (five stages of 16 swaps each), there is no per bit loop. Source and Destination can
+ * point to the same buffer.
+ *
+ * **Example:**
+ *      @code
+ *      Source = { 0x80000006, 0x00000002, 0, ... 0 }
+ *      Bfx_Transpose32x32_u32(Source, Destination)
+ *      Destination will equal to { 0, 0x00000003, 0x00000001, 0, ... 0, 0x00000001 }.
+ *      @endcode
+ *
+ * @param[in] Source Pointer to the 32 rows to transpose
+ * @param[out] Destination Pointer to the 32 transposed rows
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline void Bfx_Transpose32x32_u32( const uint32 *Source, uint32 *Destination )
+{
+    uint32 Mask = 0x0000FFFFu;
+    uint32 Temp;
+
+    if( Source != Destination )
+    {
+        for( uint8 i = 0u; i < 32u; i++ )
+        {
+            Destination[ i ] = Source[ i ];
+        }
+    }
+
+    /*swap the upper right and lower left blocks of size Block*/
+    for( uint8 Block = 16u; Block != 0u; Block >>= 1u )
+    {
+        for( uint8 Row = 0u; Row < 32u; Row = ( Row + Block + 1u ) & ~Block )
+        {
+            Temp = ( ( Destination[ Row ] >> Block ) ^ Destination[ Row + Block ] ) & Mask;
+            Destination[ Row ] ^= Temp << Block;
+            Destination[ Row + Block ] ^= Temp;
+        }
+        Mask ^= Mask << ( Block >> 1u );
+    }
+}
+
+/**
+ * @brief  **32 bit Count Trailing Zeros**
+ *
+ * Count the number of consecutive zeros in Data starting with the least significant bit, which is
+ * the position of the first bit set (find first set). The lowest bit set is isolated and mapped to
+ * its position with a de Bruijn multiplication and a 32 entries table, so the execution time is
+ * constant even on cores without a count zeros instruction like the Cortex-M0+.
+ *
+ * **Example:**
+ *      @code
+ *      Res = Bfx_CountTrailingZeros_u32(01101000b);
+ *      Res is equal to 3
+ *      @endcode
+ *
+ * @param[in] Data Input data
+ *
+ * @retval Bit position of the first bit set, 32 if Data is 0
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint8 Bfx_CountTrailingZeros_u32( uint32 Data )
+{
+    static const uint8 DeBruijnPosition[ 32 ] = {
+        0u, 1u, 28u, 2u, 29u, 14u, 24u, 3u, 30u, 22u, 20u, 15u, 25u, 17u, 4u, 8u,
+        31u, 27u, 13u, 23u, 21u, 19u, 16u, 7u, 26u, 12u, 18u, 6u, 11u, 5u, 10u, 9u };
+    uint8 Count = 32u;
+
+    if( Data != 0u )
+    {
+        Count = DeBruijnPosition[ ( ( Data & ( ~Data + 1u ) ) * 0x077CB531u ) >> 27u ];
+    }
+
+    return Count;
+}
+
+/**
+ * @brief  **32 bit Block Count Leading Signs**
+ *
+ * Count the minimum number of redundant sign bits over all the values of an array, the common
+ * headroom of the block. Each value is xored with its own sign so its redundant sign bits become
+ * leading zeros, the results are ored together and the leading signs are counted once at the end,
+ * the per value cost is a shift, a xor and an or. Four values are processed per loop iteration and
+ * 4 per iteration with SSE2 on the host.
+ *
+ * **Example:**
+ *      @code
+ *      Data = { 0x00004000, -0x00020000, 0x00000120, 0x00000000 }
+ *      Res = Bfx_CountLeadingSignsBlock_s32(Data, 4)
+ *      Res is equal to 14
+ *      @endcode
+ *
+ * @param[in] Data Pointer to the values
+ * @param[in] Length Number of values
+ *
+ * @retval Minimum number of leading sign bits minus one, 31 when all values are 0 or -1
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint8 Bfx_CountLeadingSignsBlock_s32( const sint32 *Data, uint32 Length )
+{
+    uint32 Signs = 0u;
+    uint32 i     = 0u;
+
+#if defined( __SSE2__ )
+    __m128i Vector = _mm_setzero_si128();
+    __m128i Value;
+
+    for( ; ( i + 4u ) <= Length; i += 4u )
+    {
+        Value  = _mm_loadu_si128( (const __m128i *)&Data[ i ] );
+        Vector = _mm_or_si128( Vector, _mm_xor_si128( Value, _mm_srai_epi32( Value, 31 ) ) );
+    }
+    /*or the lanes together*/
+    Vector = _mm_or_si128( Vector, _mm_srli_si128( Vector, 8 ) );
+    Vector = _mm_or_si128( Vector, _mm_srli_si128( Vector, 4 ) );
+    Signs  = (uint32)_mm_cvtsi128_si32( Vector );
+#endif
+    for( ; ( i + 4u ) <= Length; i += 4u )
+    {
+        Signs |= (uint32)( Data[ i ] ^ ( Data[ i ] >> 31 ) );
+        Signs |= (uint32)( Data[ i + 1u ] ^ ( Data[ i + 1u ] >> 31 ) );
+        Signs |= (uint32)( Data[ i + 2u ] ^ ( Data[ i + 2u ] >> 31 ) );
+        Signs |= (uint32)( Data[ i + 3u ] ^ ( Data[ i + 3u ] >> 31 ) );
+    }
+    for( ; i < Length; i++ )
+    {
+        Signs |= (uint32)( Data[ i ] ^ ( Data[ i ] >> 31 ) );
+    }
+
+    return Bfx_CountLeadingSigns_s32( (sint32)Signs );
+}
+
+/**
+ * @brief  **32 bit Block Arithmetic shift with saturation**
+ *
+ * Shifts all the values of an array with the same rules as Bfx_ShiftBitSat_s32s8_s32, left shifts
+ * saturate the values that do not fit and right shifts fill the vacated bits with the sign bit.
+ * The values over INT32_MAX >> ShiftCnt or below its complement are the ones that saturate, so the
+ * check is two compares per value. Four values are processed per loop iteration and 4 per
+ * iteration with SSE2 on the host.
+ *
+ * **Example:**
+ *      @code
+ *      Data = { 0x10000000, -0x20000000, 0x00010000 }
+ *      Bfx_ShiftBlockSat_s32s8(Data, 3, 3)
+ *      Data will equal to { 0x7FFFFFFF, -0x80000000, 0x00080000 }.
+ *      @endcode
+ *
+ * @param[in,out] Data Pointer to the values to shift
+ * @param[in] Length Number of values
+ * @param[in] ShiftCnt Shift count (-32 ... -1: right, 1 ... 31: left)
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline void Bfx_ShiftBlockSat_s32s8( sint32 *Data, uint32 Length, sint8 ShiftCnt )
+{
+    uint8 Shift = ( ShiftCnt < 0 ) ? (uint8)-ShiftCnt : (uint8)ShiftCnt;
+    sint32 Limit;
+    uint32 i    = 0u;
+
+    /*a right shift by the word width gives the same sign fill as 31 bits*/
+    if( Shift > 31u )
+    {
+        Shift = 31u;
+    }
+    Limit = INT32_MAX >> Shift;
+
+#if defined( __SSE2__ )
+    __m128i Count = _mm_cvtsi32_si128( Shift );
+    __m128i Upper = _mm_set1_epi32( Limit );
+    __m128i Lower = _mm_set1_epi32( ~Limit );
+    __m128i Value;
+    __m128i Over;
+    __m128i Under;
+    __m128i Result;
+
+    for( ; ( i + 4u ) <= Length; i += 4u )
+    {
+        Value = _mm_loadu_si128( (const __m128i *)&Data[ i ] );
+        if( ShiftCnt < 0 )
+        {
+            Result = _mm_sra_epi32( Value, Count );
+        }
+        else
+        {
+            /*blend the shifted values with the limits where they overflow*/
+            Over   = _mm_cmpgt_epi32( Value, Upper );
+            Under  = _mm_cmplt_epi32( Value, Lower );
+            Result = _mm_andnot_si128( _mm_or_si128( Over, Under ), _mm_sll_epi32( Value, Count ) );
+            Result = _mm_or_si128( Result, _mm_and_si128( Over, _mm_set1_epi32( INT32_MAX ) ) );
+            Result = _mm_or_si128( Result, _mm_and_si128( Under, _mm_set1_epi32( INT32_MIN ) ) );
+        }
+        _mm_storeu_si128( (__m128i *)&Data[ i ], Result );
+    }
+#endif
+    if( ShiftCnt < 0 )
+    {
+        for( ; ( i + 4u ) <= Length; i += 4u )
+        {
+            Data[ i ]      = (sint32)( Data[ i ] >> Shift );
+            Data[ i + 1u ] = (sint32)( Data[ i + 1u ] >> Shift );
+            Data[ i + 2u ] = (sint32)( Data[ i + 2u ] >> Shift );
+            Data[ i + 3u ] = (sint32)( Data[ i + 3u ] >> Shift );
+        }
+        for( ; i < Length; i++ )
+        {
+            Data[ i ] = (sint32)( Data[ i ] >> Shift );
+        }
+    }
+    else
+    {
+        for( ; ( i + 4u ) <= Length; i += 4u )
+        {
+            Data[ i ]      = ( Data[ i ] > Limit ) ? INT32_MAX : ( ( Data[ i ] < ~Limit ) ? INT32_MIN : (sint32)( (uint32)Data[ i ] << Shift ) );
+            Data[ i + 1u ] = ( Data[ i + 1u ] > Limit ) ? INT32_MAX : ( ( Data[ i + 1u ] < ~Limit ) ? INT32_MIN : (sint32)( (uint32)Data[ i + 1u ] << Shift ) );
+            Data[ i + 2u ] = ( Data[ i + 2u ] > Limit ) ? INT32_MAX : ( ( Data[ i + 2u ] < ~Limit ) ? INT32_MIN : (sint32)( (uint32)Data[ i + 2u ] << Shift ) );
+            Data[ i + 3u ] = ( Data[ i + 3u ] > Limit ) ? INT32_MAX : ( ( Data[ i + 3u ] < ~Limit ) ? INT32_MIN : (sint32)( (uint32)Data[ i + 3u ] << Shift ) );
+        }
+        for( ; i < Length; i++ )
+        {
+            Data[ i ] = ( Data[ i ] > Limit ) ? INT32_MAX : ( ( Data[ i ] < ~Limit ) ? INT32_MIN : (sint32)( (uint32)Data[ i ] << Shift ) );
+        }
+    }
+}
+
+/**
+ * @brief  **32 bit Block Normalisation**
+ *
+ * Shifts all the values of an array to the left by their common headroom, the block exponent, so
+ * the largest magnitude uses the full 32 bits without any value saturating. The array is read once
+ * to find the headroom and read and written once to shift it.
+ *
+ * **Example:**
+ *      @code
+ *      Data = { 0x00004000, -0x00020000, 0x00000120, 0x00000000 }
+ *      Res = Bfx_NormalizeBlock_s32(Data, 4)
+ *      Res is equal to 14 and Data will equal to { 0x10000000, -0x80000000, 0x00480000, 0x00000000 }.
+ *      @endcode
+ *
+ * @param[in,out] Data Pointer to the values to normalise
+ * @param[in] Length Number of values
+ *
+ * @retval Number of bits the block was shifted to the left
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint8 Bfx_NormalizeBlock_s32( sint32 *Data, uint32 Length )
+{
+    uint8 Exponent = Bfx_CountLeadingSignsBlock_s32( Data, Length );
+
+    Bfx_ShiftBlockSat_s32s8( Data, Length, (sint8)Exponent );
+
+    return Exponent;
+}
+
 #endif /* BFX_32BITS_H */
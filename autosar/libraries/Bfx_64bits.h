@@ -17,6 +17,10 @@
 
 #include "Std_Types.h"
 
+#if defined( __BMI2__ ) && defined( __x86_64__ )
+#include <immintrin.h>
+#endif
+
 /**
  * @brief **64 bits Set Bit**
  *
@@ -34,9 +38,9 @@
  *
  * @reqs    SWS_Bfx_00001, SWS_Bfx_00002, SWS_Bfx_00008
  */
-void Bfx_SetBit_u64u8( uint64 *Data, uint8 BitPn )
+static inline void Bfx_SetBit_u64u8( uint64 *Data, uint8 BitPn )
 {
-    *Data |= ( 1u << BitPn );
+    *Data |= ( (uint64)1u << BitPn );
 }
 
 /**
@@ -56,9 +60,9 @@ void Bfx_SetBit_u64u8( uint64 *Data, uint8 BitPn )
  *
  * @reqs    SWS_Bfx_00010, SWS_Bfx_00011, SWS_Bfx_00015
  */
-void Bfx_ClrBit_u64u8( uint64 *Data, uint8 BitPn )
+static inline void Bfx_ClrBit_u64u8( uint64 *Data, uint8 BitPn )
 {
-    *Data &= ~( 1u << BitPn );
+    *Data &= ~( (uint64)1u << BitPn );
 }
 
 /**
@@ -79,9 +83,9 @@ void Bfx_ClrBit_u64u8( uint64 *Data, uint8 BitPn )
  *
  * @reqs    SWS_Bfx_00016, SWS_Bfx_00017, SWS_Bfx_00020
  */
-boolean Bfx_GetBit_u64u8_u8( uint64 Data, uint8 BitPn )
+static inline boolean Bfx_GetBit_u64u8_u8( uint64 Data, uint8 BitPn )
 {
-    return ( ( Data & ( 1u << BitPn ) ) != 0u );
+    return ( ( Data & ( (uint64)1u << BitPn ) ) != 0u );
 }
 
 /**
@@ -103,12 +107,12 @@ boolean Bfx_GetBit_u64u8_u8( uint64 Data, uint8 BitPn )
  *
  * @reqs    SWS_Bfx_00021, SWS_Bfx_00022, SWS_Bfx_00025
  */
-void Bfx_SetBits_u64u8u8u8( uint64 *Data, uint8 BitStartPn, uint8 BitLn, uint8 Status )
+static inline void Bfx_SetBits_u64u8u8u8( uint64 *Data, uint8 BitStartPn, uint8 BitLn, uint8 Status )
 {
     uint64 Mask;
 
-    Mask = 0xFFFFFFFFu << BitStartPn;
-    Mask &= ~( 0xFFFFFFFFu << ( BitStartPn + BitLn ) );
+    Mask = ( BitLn < 64u ) ? ( ( (uint64)1u << BitLn ) - 1u ) : 0xFFFFFFFFFFFFFFFFu;
+    Mask <<= BitStartPn;
 
     if( Status == TRUE )
     {
@@ -139,12 +143,15 @@ void Bfx_SetBits_u64u8u8u8( uint64 *Data, uint8 BitStartPn, uint8 BitLn, uint8 S
  *
  * @reqs    SWS_Bfx_00028, SWS_Bfx_00029, SWS_Bfx_00034
  */
-uint64 Bfx_GetBits_u64u8u8_u64( uint64 Data, uint8 BitStartPn, uint8 BitLn )
+static inline uint64 Bfx_GetBits_u64u8u8_u64( uint64 Data, uint8 BitStartPn, uint8 BitLn )
 {
     uint64 Bits;
 
     Bits = Data >> BitStartPn;
-    Bits &= ~( 0xFFFFFFFFFFFFFFFFu << ( BitLn ) );
+    if( BitLn < 64u )
+    {
+        Bits &= ~( 0xFFFFFFFFFFFFFFFFu << BitLn );
+    }
 
     return Bits;
 }
@@ -167,7 +174,7 @@ uint64 Bfx_GetBits_u64u8u8_u64( uint64 Data, uint8 BitStartPn, uint8 BitLn )
  *
  * @reqs    SWS_Bfx_00035, SWS_Bfx_00036, SWS_Bfx_00038
  */
-void Bfx_SetBitMask_u64u64( uint64 *Data, uint64 Mask )
+static inline void Bfx_SetBitMask_u64u64( uint64 *Data, uint64 Mask )
 {
     *Data |= Mask;
 }
@@ -190,7 +197,7 @@ void Bfx_SetBitMask_u64u64( uint64 *Data, uint64 Mask )
  *
  * @reqs    SWS_Bfx_00039, SWS_Bfx_00040, SWS_Bfx_00045
  */
-void Bfx_ClrBitMask_u64u64( uint64 *Data, uint64 Mask )
+static inline void Bfx_ClrBitMask_u64u64( uint64 *Data, uint64 Mask )
 {
     *Data &= ~Mask;
 }
@@ -214,7 +221,7 @@ void Bfx_ClrBitMask_u64u64( uint64 *Data, uint64 Mask )
  *
  * @reqs    SWS_Bfx_00046, SWS_Bfx_00047, SWS_Bfx_00050
  */
-boolean Bfx_TstBitMask_u64u64_u8( uint64 Data, uint64 Mask )
+static inline boolean Bfx_TstBitMask_u64u64_u8( uint64 Data, uint64 Mask )
 {
     return ( ( Data & Mask ) == Mask );
 }
@@ -238,7 +245,7 @@ boolean Bfx_TstBitMask_u64u64_u8( uint64 Data, uint64 Mask )
  *
  * @reqs    SWS_Bfx_00051, SWS_Bfx_00055
  */
-boolean Bfx_TstBitLnMask_u64u64_u8( uint64 Data, uint64 Mask )
+static inline boolean Bfx_TstBitLnMask_u64u64_u8( uint64 Data, uint64 Mask )
 {
     return ( ( Data & Mask ) != 0u );
 }
@@ -261,7 +268,7 @@ boolean Bfx_TstBitLnMask_u64u64_u8( uint64 Data, uint64 Mask )
  *
  * @reqs    SWS_Bfx_00056, SWS_Bfx_00060
  */
-boolean Bfx_TstParityEven_u64_u8( uint64 Data )
+static inline boolean Bfx_TstParityEven_u64_u8( uint64 Data )
 {
     uint8 Count = 0u;
     uint64 Temp = Data;
@@ -291,7 +298,7 @@ boolean Bfx_TstParityEven_u64_u8( uint64 Data )
  *
  * @reqs    SWS_Bfx_00061, SWS_Bfx_00065
  */
-void Bfx_ToggleBits_u64( uint64 *Data )
+static inline void Bfx_ToggleBits_u64( uint64 *Data )
 {
     *Data ^= 0xFFFFFFFFFFFFFFFFu;
 }
@@ -313,7 +320,7 @@ void Bfx_ToggleBits_u64( uint64 *Data )
  *
  * @reqs    SWS_Bfx_00066, SWS_Bfx_00069
  */
-void Bfx_ToggleBitMask_u64u64( uint64 *Data, uint64 Mask )
+static inline void Bfx_ToggleBitMask_u64u64( uint64 *Data, uint64 Mask )
 {
     *Data ^= Mask;
 }
@@ -337,7 +344,7 @@ void Bfx_ToggleBitMask_u64u64( uint64 *Data, uint64 Mask )
  *
  * @reqs    SWS_Bfx_00070, SWS_Bfx_00075
  */
-void Bfx_ShiftBitRt_u64u8( uint64 *Data, uint8 ShiftCnt )
+static inline void Bfx_ShiftBitRt_u64u8( uint64 *Data, uint8 ShiftCnt )
 {
     *Data >>= ShiftCnt;
 }
@@ -361,7 +368,7 @@ void Bfx_ShiftBitRt_u64u8( uint64 *Data, uint8 ShiftCnt )
  *
  * @reqs    SWS_Bfx_00076, SWS_Bfx_00080
  */
-void Bfx_ShiftBitLt_u64u8( uint64 *Data, uint8 ShiftCnt )
+static inline void Bfx_ShiftBitLt_u64u8( uint64 *Data, uint8 ShiftCnt )
 {
     *Data <<= ShiftCnt;
 }
@@ -388,9 +395,9 @@ void Bfx_ShiftBitLt_u64u8( uint64 *Data, uint8 ShiftCnt )
  *
  * @reqs    SWS_Bfx_00086, SWS_Bfx_00090
  */
-void Bfx_RotBitRt_u64u8( uint64 *Data, uint8 ShiftCnt )
+static inline void Bfx_RotBitRt_u64u8( uint64 *Data, uint8 ShiftCnt )
 {
-    *Data = ( *Data << ( 64u - ShiftCnt ) ) | ( *Data >> ShiftCnt );
+    *Data = ( *Data << ( ( 64u - ShiftCnt ) & 63u ) ) | ( *Data >> ShiftCnt );
 }
 
 /**
@@ -415,9 +422,9 @@ void Bfx_RotBitRt_u64u8( uint64 *Data, uint8 ShiftCnt )
  *
  * @reqs    SWS_Bfx_00095, SWS_Bfx_00098
  */
-void Bfx_RotBitLt_u64u8( uint64 *Data, uint8 ShiftCnt )
+static inline void Bfx_RotBitLt_u64u8( uint64 *Data, uint8 ShiftCnt )
 {
-    *Data = ( *Data >> ( 64u - ShiftCnt ) ) | ( *Data << ShiftCnt );
+    *Data = ( *Data >> ( ( 64u - ShiftCnt ) & 63u ) ) | ( *Data << ShiftCnt );
 }
 
 /**
@@ -440,15 +447,15 @@ void Bfx_RotBitLt_u64u8( uint64 *Data, uint8 ShiftCnt )
  *
  * @reqs    SWS_Bfx_00101, SWS_Bfx_00108
  */
-void Bfx_CopyBit_u64u8u64u8( uint64 *DestinationData, uint8 DestinationPosition, uint64 SourceData, uint8 SourcePosition )
+static inline void Bfx_CopyBit_u64u8u64u8( uint64 *DestinationData, uint8 DestinationPosition, uint64 SourceData, uint8 SourcePosition )
 {
-    if( ( SourceData & ( 1u << SourcePosition ) ) == 0u )
+    if( ( SourceData & ( (uint64)1u << SourcePosition ) ) == 0u )
     {
-        *DestinationData &= ~( 1u << DestinationPosition );
+        *DestinationData &= ~( (uint64)1u << DestinationPosition );
     }
     else
     {
-        *DestinationData |= ( 1u << DestinationPosition );
+        *DestinationData |= ( (uint64)1u << DestinationPosition );
     }
 }
 
@@ -472,9 +479,9 @@ void Bfx_CopyBit_u64u8u64u8( uint64 *DestinationData, uint8 DestinationPosition,
  *
  * @reqs    SWS_Bfx_00110, SWS_Bfx_00112
  */
-void Bfx_PutBits_u64u8u8u64( uint64 *Data, uint8 BitStartPn, uint8 BitLn, uint64 Pattern )
+static inline void Bfx_PutBits_u64u8u8u64( uint64 *Data, uint8 BitStartPn, uint8 BitLn, uint64 Pattern )
 {
-    uint64 Mask = ( 1u << BitLn ) - 1u;
+    uint64 Mask = ( BitLn < 64u ) ? ( ( (uint64)1u << BitLn ) - 1u ) : 0xFFFFFFFFFFFFFFFFu;
 
     *Data &= ~( Mask << BitStartPn );
     *Data |= ( Pattern & Mask ) << BitStartPn;
@@ -499,7 +506,7 @@ void Bfx_PutBits_u64u8u8u64( uint64 *Data, uint8 BitStartPn, uint8 BitLn, uint64
  *
  * @reqs    SWS_Bfx_00120, SWS_Bfx_00124
  */
-void Bfx_PutBitsMask_u64u64u64( uint64 *Data, uint64 Pattern, uint64 Mask )
+static inline void Bfx_PutBitsMask_u64u64u64( uint64 *Data, uint64 Pattern, uint64 Mask )
 {
     *Data = ( ( Pattern & Mask ) | ( *Data & ~Mask ) );
 }
@@ -523,15 +530,15 @@ void Bfx_PutBitsMask_u64u64u64( uint64 *Data, uint64 Pattern, uint64 Mask )
  *
  * @reqs    SWS_Bfx_00130, SWS_Bfx_00132
  */
-void Bfx_PutBit_u64u8u8( uint64 *Data, uint8 BitPn, boolean Status )
+static inline void Bfx_PutBit_u64u8u8( uint64 *Data, uint8 BitPn, boolean Status )
 {
     if( Status == TRUE )
     {
-        *Data |= ( 1u << BitPn );
+        *Data |= ( (uint64)1u << BitPn );
     }
     else
     {
-        *Data &= ~( 1u << BitPn );
+        *Data &= ~( (uint64)1u << BitPn );
     }
 }
 
@@ -568,9 +575,9 @@ static inline sint64 Bfx_ShiftBitSat_s64s8_s64( sint64 Data, sint8 ShiftCnt )
 
     if( ShiftCnt >= 0 )
     {
-        result = Data << ShiftCnt; /*Shift left*/
+        result = (sint64)( (uint64)Data << ShiftCnt ); /*Shift left*/
         /*Check for saturation */
-        if( ( ( Data < 0 ) && ( result > Data ) ) || ( ( Data >= 0 ) && ( result < Data ) ) )
+        if( ( Data > ( INT64_MAX >> ShiftCnt ) ) || ( Data < ( INT64_MIN >> ShiftCnt ) ) )
         {
             if( Data < 0 )
             {
@@ -630,7 +637,7 @@ static inline uint64 Bfx_ShiftBitSat_u64s8_u64( uint64 Data, sint8 ShiftCnt )
     {
         result = Data << ShiftCnt; /*Shift left */
         /*Check for saturation */
-        if( result < Data )
+        if( Data > ( UINT64_MAX >> ShiftCnt ) )
         {
             result = UINT64_MAX; /*Saturate result */
         }
@@ -662,7 +669,7 @@ static inline uint64 Bfx_ShiftBitSat_u64s8_u64( uint64 Data, sint8 ShiftCnt )
  *
  * @reqs    SWS_Bfx_91003, SWS_Bfx_00137
  */
-uint8 Bfx_CountLeadingOnes_u64( uint64 Data )
+static inline uint8 Bfx_CountLeadingOnes_u64( uint64 Data )
 {
     uint8 Count       = 0u;
     uint64 BitChecker = 0x8000000000000000u;
@@ -695,7 +702,7 @@ uint8 Bfx_CountLeadingOnes_u64( uint64 Data )
  *
  * @reqs    SWS_Bfx_91004, SWS_Bfx_00139
  */
-uint8 Bfx_CountLeadingSigns_s64( sint64 Data )
+static inline uint8 Bfx_CountLeadingSigns_s64( sint64 Data )
 {
     uint8 Count = 0u;
 
@@ -729,12 +736,12 @@ uint8 Bfx_CountLeadingSigns_s64( sint64 Data )
  *
  * @reqs    SWS_Bfx_91005, SWS_Bfx_00141
  */
-uint8 Bfx_CountLeadingZeros_u64( uint64 Data )
+static inline uint8 Bfx_CountLeadingZeros_u64( uint64 Data )
 {
     uint8 Count       = 0u;
     uint64 BitChecker = 0x8000000000000000u;
 
-    while( ( Data & BitChecker ) == 0u )
+    while( ( BitChecker != 0u ) && ( ( Data & BitChecker ) == 0u ) )
     {
         Count++;
         BitChecker >>= 1u;
@@ -743,4 +750,105 @@ uint8 Bfx_CountLeadingZeros_u64( uint64 Data )
     return Count;
 }
 
+/**
+ * @brief  **64 bit Deposit bits**
+ *
+ * Scatters the low order bits of Data into the bit positions marked with 1 in Mask, starting from
+ * the least significant bit of the mask. Bits of the result not covered by the mask are set to 0
+ * (equivalent to the x86 PDEP instruction).
+ *
+ * The BMI2 instruction is used when available on the host, otherwise the loop only iterates over
+ * the bits set in Mask. When Mask is a compile time constant with a single group of ones the
+ * routine is reduced to a shift and an and operation.
+ *
+ * **Example:**
+ *      @code
+ *      Res = Bfx_DepositBits_u64u64_u64(00000101b, 01011010b)
+ *      Res will equal to 00010010b.
+ *      @endcode
+ *
+ * @param[in] Data Compact bits to deposit
+ * @param[in] Mask Bit positions where the bits will be placed
+ *
+ * @retval Deposited bits
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint64 Bfx_DepositBits_u64u64_u64( uint64 Data, uint64 Mask )
+{
+    uint64 Result = 0u;
+
+#if defined( __GNUC__ )
+    /*single group of ones known at compile time, just move the bits in place*/
+    if( __builtin_constant_p( Mask ) && ( Mask != 0u ) && ( ( ( Mask + ( Mask & ( ~Mask + 1u ) ) ) & Mask ) == 0u ) )
+    {
+        return ( ( Data << __builtin_ctzll( Mask ) ) & Mask );
+    }
+#endif
+#if defined( __BMI2__ ) && defined( __x86_64__ )
+    Result = _pdep_u64( Data, Mask );
+#else
+    for( uint64 Bit = 1u; Mask != 0u; Bit <<= 1u )
+    {
+        if( ( Data & Bit ) != 0u )
+        {
+            Result |= Mask & ( ~Mask + 1u ); /*lowest bit set in the mask*/
+        }
+        Mask &= Mask - 1u;
+    }
+#endif
+
+    return Result;
+}
+
+/**
+ * @brief  **64 bit Extract bits**
+ *
+ * Gathers the bits of Data at the positions marked with 1 in Mask and packs them into the low order
+ * bits of the result, the rest of the bits are set to 0 (equivalent to the x86 PEXT instruction).
+ *
+ * The BMI2 instruction is used when available on the host, otherwise the loop only iterates over
+ * the bits set in Mask. When Mask is a compile time constant with a single group of ones the
+ * routine is reduced to an and and a shift operation.
+ *
+ * **Example:**
+ *      @code
+ *      Res = Bfx_ExtractBits_u64u64_u64(11000110b, 01011010b)
+ *      Res will equal to 00001001b.
+ *      @endcode
+ *
+ * @param[in] Data Input data
+ * @param[in] Mask Bit positions to extract
+ *
+ * @retval Extracted bits
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint64 Bfx_ExtractBits_u64u64_u64( uint64 Data, uint64 Mask )
+{
+    uint64 Result = 0u;
+
+#if defined( __GNUC__ )
+    /*single group of ones known at compile time, just move the bits in place*/
+    if( __builtin_constant_p( Mask ) && ( Mask != 0u ) && ( ( ( Mask + ( Mask & ( ~Mask + 1u ) ) ) & Mask ) == 0u ) )
+    {
+        return ( ( Data & Mask ) >> __builtin_ctzll( Mask ) );
+    }
+#endif
+#if defined( __BMI2__ ) && defined( __x86_64__ )
+    Result = _pext_u64( Data, Mask );
+#else
+    for( uint64 Bit = 1u; Mask != 0u; Bit <<= 1u )
+    {
+        if( ( Data & Mask & ( ~Mask + 1u ) ) != 0u )
+        {
+            Result |= Bit;
+        }
+        Mask &= Mask - 1u;
+    }
+#endif
+
+    return Result;
+}
+
 #endif /* BFX_64BITS_H */
@@ -17,6 +17,10 @@
 
 #include "Std_Types.h"
 
+#if defined( __BMI2__ )
+#include <immintrin.h>
+#endif
+
 /**
  * @brief **8 bits Set Bit**
  *
@@ -390,7 +394,7 @@ static inline void Bfx_ShiftBitLt_u8u8( uint8 *Data, uint8 ShiftCnt )
  */
 static inline void Bfx_RotBitRt_u8u8( uint8 *Data, uint8 ShiftCnt )
 {
-    *Data = ( *Data << ( 8u - ShiftCnt ) ) | ( *Data >> ShiftCnt );
+    *Data = ( *Data << ( ( 8u - ShiftCnt ) & 7u ) ) | ( *Data >> ShiftCnt );
 }
 
 /**
@@ -417,7 +421,7 @@ static inline void Bfx_RotBitRt_u8u8( uint8 *Data, uint8 ShiftCnt )
  */
 static inline void Bfx_RotBitLt_u8u8( uint8 *Data, uint8 ShiftCnt )
 {
-    *Data = ( *Data >> ( 8u - ShiftCnt ) ) | ( *Data << ShiftCnt );
+    *Data = ( *Data >> ( ( 8u - ShiftCnt ) & 7u ) ) | ( *Data << ShiftCnt );
 }
 
 /**
@@ -568,9 +572,9 @@ static inline sint8 Bfx_ShiftBitSat_s8s8_s8( sint8 Data, sint8 ShiftCnt )
 
     if( ShiftCnt >= 0 )
     {
-        result = Data << ShiftCnt; /*Shift left*/
+        result = (sint8)( (uint8)Data << ShiftCnt ); /*Shift left*/
         /*Check for saturation */
-        if( ( ( Data < 0 ) && ( result > Data ) ) || ( ( Data >= 0 ) && ( result < Data ) ) )
+        if( ( Data > ( INT8_MAX >> ShiftCnt ) ) || ( Data < ( INT8_MIN >> ShiftCnt ) ) )
         {
             if( Data < 0 )
             {
@@ -630,7 +634,7 @@ static inline uint8 Bfx_ShiftBitSat_u8s8_u8( uint8 Data, sint8 ShiftCnt )
     {
         result = Data << ShiftCnt; /*Shift left */
         /*Check for saturation */
-        if( result < Data )
+        if( Data > ( UINT8_MAX >> ShiftCnt ) )
         {
             result = UINT8_MAX; /*Saturate result */
         }
@@ -734,7 +738,7 @@ static inline uint8 Bfx_CountLeadingZeros_u8( uint8 Data )
     uint8 Count      = 0u;
     uint8 BitChecker = 0x80u;
 
-    while( ( Data & BitChecker ) == 0u )
+    while( ( BitChecker != 0u ) && ( ( Data & BitChecker ) == 0u ) )
     {
         Count++;
         BitChecker >>= 1u;
@@ -743,4 +747,159 @@ static inline uint8 Bfx_CountLeadingZeros_u8( uint8 Data )
     return Count;
 }
 
+/**
+ * @brief  **8 bit Deposit bits**
+ *
+ * Scatters the low order bits of Data into the bit positions marked with 1 in Mask, starting from
+ * the least significant bit of the mask. Bits of the result not covered by the mask are set to 0
+ * (equivalent to the x86 PDEP instruction).
+ *
+ * The BMI2 instruction is used when available on the host, otherwise the loop only iterates over
+ * the bits set in Mask. When Mask is a compile time constant with a single group of ones the
+ * routine is reduced to a shift and an and operation.
+ *
+ * **Example:**
+ *      @code
+ *      Res = Bfx_DepositBits_u8u8_u8(00000101b, 01011010b)
+ *      Res will equal to 00010010b.
+ *      @endcode
+ *
+ * @param[in] Data Compact bits to deposit
+ * @param[in] Mask Bit positions where the bits will be placed
+ *
+ * @retval Deposited bits
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint8 Bfx_DepositBits_u8u8_u8( uint8 Data, uint8 Mask )
+{
+    uint8 Result = 0u;
+
+#if defined( __GNUC__ )
+    /*single group of ones known at compile time, just move the bits in place*/
+    if( __builtin_constant_p( Mask ) && ( Mask != 0u ) && ( ( ( Mask + ( Mask & ( ~Mask + 1u ) ) ) & Mask ) == 0u ) )
+    {
+        return (uint8)( ( Data << __builtin_ctz( Mask ) ) & Mask );
+    }
+#endif
+#if defined( __BMI2__ )
+    Result = (uint8)_pdep_u32( Data, Mask );
+#else
+    for( uint8 Bit = 1u; Mask != 0u; Bit <<= 1u )
+    {
+        if( ( Data & Bit ) != 0u )
+        {
+            Result |= Mask & ( ~Mask + 1u ); /*lowest bit set in the mask*/
+        }
+        Mask &= Mask - 1u;
+    }
+#endif
+
+    return Result;
+}
+
+/**
+ * @brief  **8 bit Extract bits**
+ *
+ * Gathers the bits of Data at the positions marked with 1 in Mask and packs them into the low order
+ * bits of the result, the rest of the bits are set to 0 (equivalent to the x86 PEXT instruction).
+ *
+ * The BMI2 instruction is used when available on the host, otherwise the loop only iterates over
+ * the bits set in Mask. When Mask is a compile time constant with a single group of ones the
+ * routine is reduced to an and and a shift operation.
+ *
+ * **Example:**
+ *      @code
+ *      Res = Bfx_ExtractBits_u8u8_u8(11000110b, 01011010b)
+ *      Res will equal to 00001001b.
+ *      @endcode
+ *
+ * @param[in] Data Input data
+ * @param[in] Mask Bit positions to extract
+ *
+ * @retval Extracted bits
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline uint8 Bfx_ExtractBits_u8u8_u8( uint8 Data, uint8 Mask )
+{
+    uint8 Result = 0u;
+
+#if defined( __GNUC__ )
+    /*single group of ones known at compile time, just move the bits in place*/
+    if( __builtin_constant_p( Mask ) && ( Mask != 0u ) && ( ( ( Mask + ( Mask & ( ~Mask + 1u ) ) ) & Mask ) == 0u ) )
+    {
+        return (uint8)( ( Data & Mask ) >> __builtin_ctz( Mask ) );
+    }
+#endif
+#if defined( __BMI2__ )
+    Result = (uint8)_pext_u32( Data, Mask );
+#else
+    for( uint8 Bit = 1u; Mask != 0u; Bit <<= 1u )
+    {
+        if( ( Data & Mask & ( ~Mask + 1u ) ) != 0u )
+        {
+            Result |= Bit;
+        }
+        Mask &= Mask - 1u;
+    }
+#endif
+
+    return Result;
+}
+
+/**
+ * @brief  **8x8 bit matrix transpose**
+ *
+ * Transposes a matrix of 8 rows by 8 bits, bit j of row i in Source is placed at bit i of row j in
+ * Destination. Typical use is to convert 8 port samples taken over time into per pin timelines.
+ * The matrix is packed in two 32 bit words and transposed with three swap stages, there is no per
+ * bit loop. Source and Destination can point to the same buffer.
+ *
+ * **Example:**
+ *      @code
+ *      Source = { 00000110b, 00000010b, 0, 0, 0, 0, 0, 0 }
+ *      Bfx_Transpose8x8_u8(Source, Destination)
+ *      Destination will equal to { 0, 00000011b, 00000001b, 0, 0, 0, 0, 0 }.
+ *      @endcode
+ *
+ * @param[in] Source Pointer to the 8 rows to transpose
+ * @param[out] Destination Pointer to the 8 transposed rows
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+static inline void Bfx_Transpose8x8_u8( const uint8 *Source, uint8 *Destination )
+{
+    uint32 Low;
+    uint32 High;
+    uint32 Temp;
+
+    /*pack the rows 0 to 3 and 4 to 7, row i goes in byte i*/
+    Low  = (uint32)Source[ 0 ] | ( (uint32)Source[ 1 ] << 8u ) | ( (uint32)Source[ 2 ] << 16u ) | ( (uint32)Source[ 3 ] << 24u );
+    High = (uint32)Source[ 4 ] | ( (uint32)Source[ 5 ] << 8u ) | ( (uint32)Source[ 6 ] << 16u ) | ( (uint32)Source[ 7 ] << 24u );
+
+    /*swap the 1x1 blocks*/
+    Temp = ( Low ^ ( Low >> 7u ) ) & 0x00AA00AAu;
+    Low  = Low ^ Temp ^ ( Temp << 7u );
+    Temp = ( High ^ ( High >> 7u ) ) & 0x00AA00AAu;
+    High = High ^ Temp ^ ( Temp << 7u );
+
+    /*swap the 2x2 blocks*/
+    Temp = ( Low ^ ( Low >> 14u ) ) & 0x0000CCCCu;
+    Low  = Low ^ Temp ^ ( Temp << 14u );
+    Temp = ( High ^ ( High >> 14u ) ) & 0x0000CCCCu;
+    High = High ^ Temp ^ ( Temp << 14u );
+
+    /*swap the 4x4 blocks between both words*/
+    Temp = ( Low & 0x0F0F0F0Fu ) | ( ( High << 4u ) & 0xF0F0F0F0u );
+    High = ( ( Low >> 4u ) & 0x0F0F0F0Fu ) | ( High & 0xF0F0F0F0u );
+    Low  = Temp;
+
+    for( uint8 i = 0u; i < 4u; i++ )
+    {
+        Destination[ i ]      = (uint8)( Low >> ( i << 3u ) );
+        Destination[ i + 4u ] = (uint8)( High >> ( i << 3u ) );
+    }
+}
+
 #endif /* BFX_8BITS_H */
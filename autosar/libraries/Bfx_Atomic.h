@@ -0,0 +1,297 @@
+/**
+ * @file    Bfx_Atomic.h
+ * @brief   **Interrupt Safe 32 Bit Handling Routines**
+ *
+ * Read modify write variants of the 32 bit routines for words shared between tasks and interrupts,
+ * flag words set by an ISR and taken by a task for instance. The plain routines load, modify and
+ * store the word, an interrupt between the load and the store loses its update.
+ *
+ * The Cortex-M0+ has no exclusive load and store instructions, so each routine masks the interrupts
+ * with PRIMASK only around the load, the operation and the store, the masks and patterns are
+ * computed outside. The previous PRIMASK is restored, so the routines can be called with the
+ * interrupts already masked. On the host the compiler atomic builtins, the C11 memory model
+ * operations, are used on the same volatile words.
+ *
+ * Built with -mcpu=cortex-m0plus at -O1 and up, the masked window is ldr, the operation, str and
+ * msr: 8 cycles for the or, and and exclusive or routines and 9 for the and or one (ldr 2, ands 1,
+ * orrs 1, str 2, msr 3), with the word in zero wait state SRAM. That is the longest an interrupt
+ * arriving right after the cpsid waits. At -O0 the locals go through the stack and the window is
+ * longer, tools/primask_window.py reports the windows of the firmware as built.
+ */
+#ifndef BFX_ATOMIC_H
+#define BFX_ATOMIC_H
+
+#include "Std_Types.h"
+
+#if defined( __ARM_ARCH_6M__ )
+/**
+ * @brief   **Enter a critical section**
+ *
+ * Masks the interrupts with PRIMASK, the drivers and services use it for their own critical
+ * sections too. On the host there are no interrupts and it does nothing.
+ *
+ * @retval PRIMASK before the call, to give to Bfx_AtomicExit
+ */
+static inline uint32 Bfx_AtomicEnter( void )
+{
+    uint32 Primask;
+
+    __asm volatile( "mrs %0, primask\n\tcpsid i" : "=r"( Primask ) : : "memory" );
+    return Primask;
+}
+
+/**
+ * @brief   **Leave a critical section**
+ *
+ * Restores PRIMASK, the interrupts stay masked when they were at Bfx_AtomicEnter.
+ *
+ * @param[in] Primask Value returned by Bfx_AtomicEnter
+ */
+static inline void Bfx_AtomicExit( uint32 Primask )
+{
+    __asm volatile( "msr primask, %0" : : "r"( Primask ) : "memory" );
+}
+
+/**
+ * @brief   **Atomic and or**
+ *
+ * @param[in,out] Data Word to modify
+ * @param[in] Keep Bits kept from the word
+ * @param[in] Set Bits set after the and
+ *
+ * @retval Value of the word before the operation
+ */
+static inline uint32 Bfx_AtomicAndOr_u32u32u32_u32( volatile uint32 *Data, uint32 Keep, uint32 Set )
+{
+    uint32 Primask = Bfx_AtomicEnter();
+    uint32 Value   = *Data;
+
+    *Data = ( Value & Keep ) | Set;
+    Bfx_AtomicExit( Primask );
+
+    return Value;
+}
+
+/**
+ * @brief   **Atomic or**
+ *
+ * @param[in,out] Data Word to modify
+ * @param[in] Mask Bits to set
+ *
+ * @retval Value of the word before the operation
+ */
+static inline uint32 Bfx_AtomicOr_u32u32_u32( volatile uint32 *Data, uint32 Mask )
+{
+    uint32 Primask = Bfx_AtomicEnter();
+    uint32 Value   = *Data;
+
+    *Data = Value | Mask;
+    Bfx_AtomicExit( Primask );
+
+    return Value;
+}
+
+/**
+ * @brief   **Atomic and**
+ *
+ * @param[in,out] Data Word to modify
+ * @param[in] Mask Bits to keep
+ *
+ * @retval Value of the word before the operation
+ */
+static inline uint32 Bfx_AtomicAnd_u32u32_u32( volatile uint32 *Data, uint32 Mask )
+{
+    uint32 Primask = Bfx_AtomicEnter();
+    uint32 Value   = *Data;
+
+    *Data = Value & Mask;
+    Bfx_AtomicExit( Primask );
+
+    return Value;
+}
+
+/**
+ * @brief   **Atomic exclusive or**
+ *
+ * @param[in,out] Data Word to modify
+ * @param[in] Mask Bits to toggle
+ *
+ * @retval Value of the word before the operation
+ */
+static inline uint32 Bfx_AtomicXor_u32u32_u32( volatile uint32 *Data, uint32 Mask )
+{
+    uint32 Primask = Bfx_AtomicEnter();
+    uint32 Value   = *Data;
+
+    *Data = Value ^ Mask;
+    Bfx_AtomicExit( Primask );
+
+    return Value;
+}
+#else
+static inline uint32 Bfx_AtomicEnter( void )
+{
+    return 0u;
+}
+
+static inline void Bfx_AtomicExit( uint32 Primask )
+{
+    (void)Primask;
+}
+
+static inline uint32 Bfx_AtomicAndOr_u32u32u32_u32( volatile uint32 *Data, uint32 Keep, uint32 Set )
+{
+    uint32 Value = __atomic_load_n( Data, __ATOMIC_RELAXED );
+
+    while( __atomic_compare_exchange_n( Data, &Value, ( Value & Keep ) | Set, 1, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED ) == 0 )
+    {
+    }
+
+    return Value;
+}
+
+static inline uint32 Bfx_AtomicOr_u32u32_u32( volatile uint32 *Data, uint32 Mask )
+{
+    return __atomic_fetch_or( Data, Mask, __ATOMIC_SEQ_CST );
+}
+
+static inline uint32 Bfx_AtomicAnd_u32u32_u32( volatile uint32 *Data, uint32 Mask )
+{
+    return __atomic_fetch_and( Data, Mask, __ATOMIC_SEQ_CST );
+}
+
+static inline uint32 Bfx_AtomicXor_u32u32_u32( volatile uint32 *Data, uint32 Mask )
+{
+    return __atomic_fetch_xor( Data, Mask, __ATOMIC_SEQ_CST );
+}
+#endif
+
+/**
+ * @brief **32 bits Atomic Set Bit**
+ *
+ * Interrupt safe Bfx_SetBit_u32u8, sets the bit at the requested position to 1.
+ *
+ * @param[inout]  Data Pointer to the shared word
+ * @param[in]  BitPn Bit position
+ */
+static inline void Bfx_AtomicSetBit_u32u8( volatile uint32 *Data, uint8 BitPn )
+{
+    (void)Bfx_AtomicOr_u32u32_u32( Data, 1u << BitPn );
+}
+
+/**
+ * @brief **32 bits Atomic Clear Bit**
+ *
+ * Interrupt safe Bfx_ClrBit_u32u8, clears the bit at the requested position to 0.
+ *
+ * @param[inout]  Data Pointer to the shared word
+ * @param[in]  BitPn Bit position
+ */
+static inline void Bfx_AtomicClrBit_u32u8( volatile uint32 *Data, uint8 BitPn )
+{
+    (void)Bfx_AtomicAnd_u32u32_u32( Data, ~( 1u << BitPn ) );
+}
+
+/**
+ * @brief **32 bits Atomic Test and Set Bit**
+ *
+ * Sets the bit at the requested position to 1 and returns its status before, so only one of the
+ * contexts racing to set it sees FALSE.
+ *
+ * **Example:**
+ *      @code
+ *      Data = 10001010b
+ *      Bit = Bfx_AtomicTstSetBit_u32u8_u8(&Data, 1);
+ *      Bit will be equal to TRUE and Data stays 10001010b
+ *      @endcode
+ *
+ * @param[inout]  Data Pointer to the shared word
+ * @param[in]  BitPn Bit position
+ *
+ * @retval Boolean Bit status before the operation
+ */
+static inline boolean Bfx_AtomicTstSetBit_u32u8_u8( volatile uint32 *Data, uint8 BitPn )
+{
+    uint32 Bit = 1u << BitPn;
+
+    return ( ( Bfx_AtomicOr_u32u32_u32( Data, Bit ) & Bit ) != 0u );
+}
+
+/**
+ * @brief **32 bits Atomic Set Multiple Bits**
+ *
+ * Interrupt safe Bfx_SetBitMask_u32u32, sets to 1 the bits set in the mask.
+ *
+ * @param[inout] Data Pointer to the shared word
+ * @param[in] Mask Mask used to set bits
+ */
+static inline void Bfx_AtomicSetBitMask_u32u32( volatile uint32 *Data, uint32 Mask )
+{
+    (void)Bfx_AtomicOr_u32u32_u32( Data, Mask );
+}
+
+/**
+ * @brief **32 bits Atomic Clear Multiple Bits**
+ *
+ * Interrupt safe Bfx_ClrBitMask_u32u32, clears to 0 the bits set in the mask.
+ *
+ * @param[inout] Data Pointer to the shared word
+ * @param[in] Mask Mask value
+ */
+static inline void Bfx_AtomicClrBitMask_u32u32( volatile uint32 *Data, uint32 Mask )
+{
+    (void)Bfx_AtomicAnd_u32u32_u32( Data, ~Mask );
+}
+
+/**
+ * @brief **32 bits Atomic Take Multiple Bits**
+ *
+ * Clears the bits set in the mask and returns which of them were set, the way a task takes the
+ * event flags posted by interrupts without losing the ones posted meanwhile.
+ *
+ * **Example:**
+ *      @code
+ *      Data = 01100111b
+ *      Flags = Bfx_AtomicTakeBitMask_u32u32_u32(&Data, 11110000b)
+ *      Flags will be equal to 01100000b and Data to 00000111b
+ *      @endcode
+ *
+ * @param[inout] Data Pointer to the shared word
+ * @param[in] Mask Bits to take
+ *
+ * @retval Bits of the mask set before the operation
+ */
+static inline uint32 Bfx_AtomicTakeBitMask_u32u32_u32( volatile uint32 *Data, uint32 Mask )
+{
+    return Bfx_AtomicAnd_u32u32_u32( Data, ~Mask ) & Mask;
+}
+
+/**
+ * @brief **32 bits Atomic Toggle Multiple Bits**
+ *
+ * Interrupt safe Bfx_ToggleBitMask_u32u32, toggles the bits set in the mask.
+ *
+ * @param[inout] Data Pointer to the shared word
+ * @param[in] Mask Mask
+ */
+static inline void Bfx_AtomicToggleBitMask_u32u32( volatile uint32 *Data, uint32 Mask )
+{
+    (void)Bfx_AtomicXor_u32u32_u32( Data, Mask );
+}
+
+/**
+ * @brief **32 bits Atomic Put Bits Mask**
+ *
+ * Interrupt safe Bfx_PutBitsMask_u32u32u32, replaces the bits set in the mask with the bits of the
+ * pattern.
+ *
+ * @param[inout] Data Pointer to the shared word
+ * @param[in] Pattern Pattern to be set
+ * @param[in] Mask Mask value
+ */
+static inline void Bfx_AtomicPutBitsMask_u32u32u32( volatile uint32 *Data, uint32 Pattern, uint32 Mask )
+{
+    (void)Bfx_AtomicAndOr_u32u32u32_u32( Data, ~Mask, Pattern & Mask );
+}
+
+#endif /* BFX_ATOMIC_H */
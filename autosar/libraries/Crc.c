@@ -0,0 +1,646 @@
+/**
+ * @file    Crc.c
+ * @brief   **CRC Routines**
+ *
+ * Implementation of the CRC8 SAE J1850, CRC16 CCITT and CRC32 IEEE 802.3 routines. Only the
+ * implementation selected for each CRC in Crc_Cfg.h is compiled, so the tables of the options not
+ * in use do not take flash.
+ *
+ * The slicing by 4 options use four tables, table k holds the CRC of a byte followed by k zero
+ * bytes, which allows to process four bytes per iteration with four independent lookups.
+ */
+#include "Crc.h"
+#include "Reg.h"
+#include "Reg_Map.h"
+#include "Bfx.h"
+
+/* clang-format off */
+#define CRC_8_POLYNOMIAL        0x1Du           /*!< SAE J1850 polynomial */
+#define CRC_8_INITIAL_VALUE     0xFFu           /*!< SAE J1850 initial value */
+#define CRC_8_XOR_VALUE         0xFFu           /*!< SAE J1850 final xor value */
+#define CRC_16_POLYNOMIAL       0x1021u         /*!< CCITT polynomial */
+#define CRC_16_INITIAL_VALUE    0xFFFFu         /*!< CCITT initial value */
+#define CRC_32_POLYNOMIAL       0x04C11DB7u     /*!< IEEE 802.3 polynomial */
+#define CRC_32_REFLECTED        0xEDB88320u     /*!< IEEE 802.3 polynomial reflected */
+#define CRC_32_INITIAL_VALUE    0xFFFFFFFFu     /*!< IEEE 802.3 initial value */
+#define CRC_32_XOR_VALUE        0xFFFFFFFFu     /*!< IEEE 802.3 final xor value */
+
+#define CRC_HW_CR_POLYSIZE_32   0x00000000u     /*!< 32 bit polynomial */
+#define CRC_HW_CR_POLYSIZE_16   0x00000008u     /*!< 16 bit polynomial */
+#define CRC_HW_CR_POLYSIZE_8    0x00000010u     /*!< 8 bit polynomial */
+#define CRC_HW_CR_REV_IN_BYTE   0x00000020u     /*!< input bits reversed by byte */
+/* clang-format on */
+
+#if ( CRC_8_MODE == CRC_8_TABLE )
+static const uint8 Crc_Table8[ 256 ] = {
+    0x00u, 0x1Du, 0x3Au, 0x27u, 0x74u, 0x69u, 0x4Eu, 0x53u, 0xE8u, 0xF5u, 0xD2u, 0xCFu, 0x9Cu, 0x81u, 0xA6u, 0xBBu,
+    0xCDu, 0xD0u, 0xF7u, 0xEAu, 0xB9u, 0xA4u, 0x83u, 0x9Eu, 0x25u, 0x38u, 0x1Fu, 0x02u, 0x51u, 0x4Cu, 0x6Bu, 0x76u,
+    0x87u, 0x9Au, 0xBDu, 0xA0u, 0xF3u, 0xEEu, 0xC9u, 0xD4u, 0x6Fu, 0x72u, 0x55u, 0x48u, 0x1Bu, 0x06u, 0x21u, 0x3Cu,
+    0x4Au, 0x57u, 0x70u, 0x6Du, 0x3Eu, 0x23u, 0x04u, 0x19u, 0xA2u, 0xBFu, 0x98u, 0x85u, 0xD6u, 0xCBu, 0xECu, 0xF1u,
+    0x13u, 0x0Eu, 0x29u, 0x34u, 0x67u, 0x7Au, 0x5Du, 0x40u, 0xFBu, 0xE6u, 0xC1u, 0xDCu, 0x8Fu, 0x92u, 0xB5u, 0xA8u,
+    0xDEu, 0xC3u, 0xE4u, 0xF9u, 0xAAu, 0xB7u, 0x90u, 0x8Du, 0x36u, 0x2Bu, 0x0Cu, 0x11u, 0x42u, 0x5Fu, 0x78u, 0x65u,
+    0x94u, 0x89u, 0xAEu, 0xB3u, 0xE0u, 0xFDu, 0xDAu, 0xC7u, 0x7Cu, 0x61u, 0x46u, 0x5Bu, 0x08u, 0x15u, 0x32u, 0x2Fu,
+    0x59u, 0x44u, 0x63u, 0x7Eu, 0x2Du, 0x30u, 0x17u, 0x0Au, 0xB1u, 0xACu, 0x8Bu, 0x96u, 0xC5u, 0xD8u, 0xFFu, 0xE2u,
+    0x26u, 0x3Bu, 0x1Cu, 0x01u, 0x52u, 0x4Fu, 0x68u, 0x75u, 0xCEu, 0xD3u, 0xF4u, 0xE9u, 0xBAu, 0xA7u, 0x80u, 0x9Du,
+    0xEBu, 0xF6u, 0xD1u, 0xCCu, 0x9Fu, 0x82u, 0xA5u, 0xB8u, 0x03u, 0x1Eu, 0x39u, 0x24u, 0x77u, 0x6Au, 0x4Du, 0x50u,
+    0xA1u, 0xBCu, 0x9Bu, 0x86u, 0xD5u, 0xC8u, 0xEFu, 0xF2u, 0x49u, 0x54u, 0x73u, 0x6Eu, 0x3Du, 0x20u, 0x07u, 0x1Au,
+    0x6Cu, 0x71u, 0x56u, 0x4Bu, 0x18u, 0x05u, 0x22u, 0x3Fu, 0x84u, 0x99u, 0xBEu, 0xA3u, 0xF0u, 0xEDu, 0xCAu, 0xD7u,
+    0x35u, 0x28u, 0x0Fu, 0x12u, 0x41u, 0x5Cu, 0x7Bu, 0x66u, 0xDDu, 0xC0u, 0xE7u, 0xFAu, 0xA9u, 0xB4u, 0x93u, 0x8Eu,
+    0xF8u, 0xE5u, 0xC2u, 0xDFu, 0x8Cu, 0x91u, 0xB6u, 0xABu, 0x10u, 0x0Du, 0x2Au, 0x37u, 0x64u, 0x79u, 0x5Eu, 0x43u,
+    0xB2u, 0xAFu, 0x88u, 0x95u, 0xC6u, 0xDBu, 0xFCu, 0xE1u, 0x5Au, 0x47u, 0x60u, 0x7Du, 0x2Eu, 0x33u, 0x14u, 0x09u,
+    0x7Fu, 0x62u, 0x45u, 0x58u, 0x0Bu, 0x16u, 0x31u, 0x2Cu, 0x97u, 0x8Au, 0xADu, 0xB0u, 0xE3u, 0xFEu, 0xD9u, 0xC4u };
+#elif ( CRC_8_MODE == CRC_8_SLICE4 )
+static const uint8 Crc_Slice8[ 4 ][ 256 ] = {
+    {
+        0x00u, 0x1Du, 0x3Au, 0x27u, 0x74u, 0x69u, 0x4Eu, 0x53u, 0xE8u, 0xF5u, 0xD2u, 0xCFu, 0x9Cu, 0x81u, 0xA6u, 0xBBu,
+        0xCDu, 0xD0u, 0xF7u, 0xEAu, 0xB9u, 0xA4u, 0x83u, 0x9Eu, 0x25u, 0x38u, 0x1Fu, 0x02u, 0x51u, 0x4Cu, 0x6Bu, 0x76u,
+        0x87u, 0x9Au, 0xBDu, 0xA0u, 0xF3u, 0xEEu, 0xC9u, 0xD4u, 0x6Fu, 0x72u, 0x55u, 0x48u, 0x1Bu, 0x06u, 0x21u, 0x3Cu,
+        0x4Au, 0x57u, 0x70u, 0x6Du, 0x3Eu, 0x23u, 0x04u, 0x19u, 0xA2u, 0xBFu, 0x98u, 0x85u, 0xD6u, 0xCBu, 0xECu, 0xF1u,
+        0x13u, 0x0Eu, 0x29u, 0x34u, 0x67u, 0x7Au, 0x5Du, 0x40u, 0xFBu, 0xE6u, 0xC1u, 0xDCu, 0x8Fu, 0x92u, 0xB5u, 0xA8u,
+        0xDEu, 0xC3u, 0xE4u, 0xF9u, 0xAAu, 0xB7u, 0x90u, 0x8Du, 0x36u, 0x2Bu, 0x0Cu, 0x11u, 0x42u, 0x5Fu, 0x78u, 0x65u,
+        0x94u, 0x89u, 0xAEu, 0xB3u, 0xE0u, 0xFDu, 0xDAu, 0xC7u, 0x7Cu, 0x61u, 0x46u, 0x5Bu, 0x08u, 0x15u, 0x32u, 0x2Fu,
+        0x59u, 0x44u, 0x63u, 0x7Eu, 0x2Du, 0x30u, 0x17u, 0x0Au, 0xB1u, 0xACu, 0x8Bu, 0x96u, 0xC5u, 0xD8u, 0xFFu, 0xE2u,
+        0x26u, 0x3Bu, 0x1Cu, 0x01u, 0x52u, 0x4Fu, 0x68u, 0x75u, 0xCEu, 0xD3u, 0xF4u, 0xE9u, 0xBAu, 0xA7u, 0x80u, 0x9Du,
+        0xEBu, 0xF6u, 0xD1u, 0xCCu, 0x9Fu, 0x82u, 0xA5u, 0xB8u, 0x03u, 0x1Eu, 0x39u, 0x24u, 0x77u, 0x6Au, 0x4Du, 0x50u,
+        0xA1u, 0xBCu, 0x9Bu, 0x86u, 0xD5u, 0xC8u, 0xEFu, 0xF2u, 0x49u, 0x54u, 0x73u, 0x6Eu, 0x3Du, 0x20u, 0x07u, 0x1Au,
+        0x6Cu, 0x71u, 0x56u, 0x4Bu, 0x18u, 0x05u, 0x22u, 0x3Fu, 0x84u, 0x99u, 0xBEu, 0xA3u, 0xF0u, 0xEDu, 0xCAu, 0xD7u,
+        0x35u, 0x28u, 0x0Fu, 0x12u, 0x41u, 0x5Cu, 0x7Bu, 0x66u, 0xDDu, 0xC0u, 0xE7u, 0xFAu, 0xA9u, 0xB4u, 0x93u, 0x8Eu,
+        0xF8u, 0xE5u, 0xC2u, 0xDFu, 0x8Cu, 0x91u, 0xB6u, 0xABu, 0x10u, 0x0Du, 0x2Au, 0x37u, 0x64u, 0x79u, 0x5Eu, 0x43u,
+        0xB2u, 0xAFu, 0x88u, 0x95u, 0xC6u, 0xDBu, 0xFCu, 0xE1u, 0x5Au, 0x47u, 0x60u, 0x7Du, 0x2Eu, 0x33u, 0x14u, 0x09u,
+        0x7Fu, 0x62u, 0x45u, 0x58u, 0x0Bu, 0x16u, 0x31u, 0x2Cu, 0x97u, 0x8Au, 0xADu, 0xB0u, 0xE3u, 0xFEu, 0xD9u, 0xC4u },
+    {
+        0x00u, 0x4Cu, 0x98u, 0xD4u, 0x2Du, 0x61u, 0xB5u, 0xF9u, 0x5Au, 0x16u, 0xC2u, 0x8Eu, 0x77u, 0x3Bu, 0xEFu, 0xA3u,
+        0xB4u, 0xF8u, 0x2Cu, 0x60u, 0x99u, 0xD5u, 0x01u, 0x4Du, 0xEEu, 0xA2u, 0x76u, 0x3Au, 0xC3u, 0x8Fu, 0x5Bu, 0x17u,
+        0x75u, 0x39u, 0xEDu, 0xA1u, 0x58u, 0x14u, 0xC0u, 0x8Cu, 0x2Fu, 0x63u, 0xB7u, 0xFBu, 0x02u, 0x4Eu, 0x9Au, 0xD6u,
+        0xC1u, 0x8Du, 0x59u, 0x15u, 0xECu, 0xA0u, 0x74u, 0x38u, 0x9Bu, 0xD7u, 0x03u, 0x4Fu, 0xB6u, 0xFAu, 0x2Eu, 0x62u,
+        0xEAu, 0xA6u, 0x72u, 0x3Eu, 0xC7u, 0x8Bu, 0x5Fu, 0x13u, 0xB0u, 0xFCu, 0x28u, 0x64u, 0x9Du, 0xD1u, 0x05u, 0x49u,
+        0x5Eu, 0x12u, 0xC6u, 0x8Au, 0x73u, 0x3Fu, 0xEBu, 0xA7u, 0x04u, 0x48u, 0x9Cu, 0xD0u, 0x29u, 0x65u, 0xB1u, 0xFDu,
+        0x9Fu, 0xD3u, 0x07u, 0x4Bu, 0xB2u, 0xFEu, 0x2Au, 0x66u, 0xC5u, 0x89u, 0x5Du, 0x11u, 0xE8u, 0xA4u, 0x70u, 0x3Cu,
+        0x2Bu, 0x67u, 0xB3u, 0xFFu, 0x06u, 0x4Au, 0x9Eu, 0xD2u, 0x71u, 0x3Du, 0xE9u, 0xA5u, 0x5Cu, 0x10u, 0xC4u, 0x88u,
+        0xC9u, 0x85u, 0x51u, 0x1Du, 0xE4u, 0xA8u, 0x7Cu, 0x30u, 0x93u, 0xDFu, 0x0Bu, 0x47u, 0xBEu, 0xF2u, 0x26u, 0x6Au,
+        0x7Du, 0x31u, 0xE5u, 0xA9u, 0x50u, 0x1Cu, 0xC8u, 0x84u, 0x27u, 0x6Bu, 0xBFu, 0xF3u, 0x0Au, 0x46u, 0x92u, 0xDEu,
+        0xBCu, 0xF0u, 0x24u, 0x68u, 0x91u, 0xDDu, 0x09u, 0x45u, 0xE6u, 0xAAu, 0x7Eu, 0x32u, 0xCBu, 0x87u, 0x53u, 0x1Fu,
+        0x08u, 0x44u, 0x90u, 0xDCu, 0x25u, 0x69u, 0xBDu, 0xF1u, 0x52u, 0x1Eu, 0xCAu, 0x86u, 0x7Fu, 0x33u, 0xE7u, 0xABu,
+        0x23u, 0x6Fu, 0xBBu, 0xF7u, 0x0Eu, 0x42u, 0x96u, 0xDAu, 0x79u, 0x35u, 0xE1u, 0xADu, 0x54u, 0x18u, 0xCCu, 0x80u,
+        0x97u, 0xDBu, 0x0Fu, 0x43u, 0xBAu, 0xF6u, 0x22u, 0x6Eu, 0xCDu, 0x81u, 0x55u, 0x19u, 0xE0u, 0xACu, 0x78u, 0x34u,
+        0x56u, 0x1Au, 0xCEu, 0x82u, 0x7Bu, 0x37u, 0xE3u, 0xAFu, 0x0Cu, 0x40u, 0x94u, 0xD8u, 0x21u, 0x6Du, 0xB9u, 0xF5u,
+        0xE2u, 0xAEu, 0x7Au, 0x36u, 0xCFu, 0x83u, 0x57u, 0x1Bu, 0xB8u, 0xF4u, 0x20u, 0x6Cu, 0x95u, 0xD9u, 0x0Du, 0x41u },
+    {
+        0x00u, 0x8Fu, 0x03u, 0x8Cu, 0x06u, 0x89u, 0x05u, 0x8Au, 0x0Cu, 0x83u, 0x0Fu, 0x80u, 0x0Au, 0x85u, 0x09u, 0x86u,
+        0x18u, 0x97u, 0x1Bu, 0x94u, 0x1Eu, 0x91u, 0x1Du, 0x92u, 0x14u, 0x9Bu, 0x17u, 0x98u, 0x12u, 0x9Du, 0x11u, 0x9Eu,
+        0x30u, 0xBFu, 0x33u, 0xBCu, 0x36u, 0xB9u, 0x35u, 0xBAu, 0x3Cu, 0xB3u, 0x3Fu, 0xB0u, 0x3Au, 0xB5u, 0x39u, 0xB6u,
+        0x28u, 0xA7u, 0x2Bu, 0xA4u, 0x2Eu, 0xA1u, 0x2Du, 0xA2u, 0x24u, 0xABu, 0x27u, 0xA8u, 0x22u, 0xADu, 0x21u, 0xAEu,
+        0x60u, 0xEFu, 0x63u, 0xECu, 0x66u, 0xE9u, 0x65u, 0xEAu, 0x6Cu, 0xE3u, 0x6Fu, 0xE0u, 0x6Au, 0xE5u, 0x69u, 0xE6u,
+        0x78u, 0xF7u, 0x7Bu, 0xF4u, 0x7Eu, 0xF1u, 0x7Du, 0xF2u, 0x74u, 0xFBu, 0x77u, 0xF8u, 0x72u, 0xFDu, 0x71u, 0xFEu,
+        0x50u, 0xDFu, 0x53u, 0xDCu, 0x56u, 0xD9u, 0x55u, 0xDAu, 0x5Cu, 0xD3u, 0x5Fu, 0xD0u, 0x5Au, 0xD5u, 0x59u, 0xD6u,
+        0x48u, 0xC7u, 0x4Bu, 0xC4u, 0x4Eu, 0xC1u, 0x4Du, 0xC2u, 0x44u, 0xCBu, 0x47u, 0xC8u, 0x42u, 0xCDu, 0x41u, 0xCEu,
+        0xC0u, 0x4Fu, 0xC3u, 0x4Cu, 0xC6u, 0x49u, 0xC5u, 0x4Au, 0xCCu, 0x43u, 0xCFu, 0x40u, 0xCAu, 0x45u, 0xC9u, 0x46u,
+        0xD8u, 0x57u, 0xDBu, 0x54u, 0xDEu, 0x51u, 0xDDu, 0x52u, 0xD4u, 0x5Bu, 0xD7u, 0x58u, 0xD2u, 0x5Du, 0xD1u, 0x5Eu,
+        0xF0u, 0x7Fu, 0xF3u, 0x7Cu, 0xF6u, 0x79u, 0xF5u, 0x7Au, 0xFCu, 0x73u, 0xFFu, 0x70u, 0xFAu, 0x75u, 0xF9u, 0x76u,
+        0xE8u, 0x67u, 0xEBu, 0x64u, 0xEEu, 0x61u, 0xEDu, 0x62u, 0xE4u, 0x6Bu, 0xE7u, 0x68u, 0xE2u, 0x6Du, 0xE1u, 0x6Eu,
+        0xA0u, 0x2Fu, 0xA3u, 0x2Cu, 0xA6u, 0x29u, 0xA5u, 0x2Au, 0xACu, 0x23u, 0xAFu, 0x20u, 0xAAu, 0x25u, 0xA9u, 0x26u,
+        0xB8u, 0x37u, 0xBBu, 0x34u, 0xBEu, 0x31u, 0xBDu, 0x32u, 0xB4u, 0x3Bu, 0xB7u, 0x38u, 0xB2u, 0x3Du, 0xB1u, 0x3Eu,
+        0x90u, 0x1Fu, 0x93u, 0x1Cu, 0x96u, 0x19u, 0x95u, 0x1Au, 0x9Cu, 0x13u, 0x9Fu, 0x10u, 0x9Au, 0x15u, 0x99u, 0x16u,
+        0x88u, 0x07u, 0x8Bu, 0x04u, 0x8Eu, 0x01u, 0x8Du, 0x02u, 0x84u, 0x0Bu, 0x87u, 0x08u, 0x82u, 0x0Du, 0x81u, 0x0Eu },
+    {
+        0x00u, 0x9Du, 0x27u, 0xBAu, 0x4Eu, 0xD3u, 0x69u, 0xF4u, 0x9Cu, 0x01u, 0xBBu, 0x26u, 0xD2u, 0x4Fu, 0xF5u, 0x68u,
+        0x25u, 0xB8u, 0x02u, 0x9Fu, 0x6Bu, 0xF6u, 0x4Cu, 0xD1u, 0xB9u, 0x24u, 0x9Eu, 0x03u, 0xF7u, 0x6Au, 0xD0u, 0x4Du,
+        0x4Au, 0xD7u, 0x6Du, 0xF0u, 0x04u, 0x99u, 0x23u, 0xBEu, 0xD6u, 0x4Bu, 0xF1u, 0x6Cu, 0x98u, 0x05u, 0xBFu, 0x22u,
+        0x6Fu, 0xF2u, 0x48u, 0xD5u, 0x21u, 0xBCu, 0x06u, 0x9Bu, 0xF3u, 0x6Eu, 0xD4u, 0x49u, 0xBDu, 0x20u, 0x9Au, 0x07u,
+        0x94u, 0x09u, 0xB3u, 0x2Eu, 0xDAu, 0x47u, 0xFDu, 0x60u, 0x08u, 0x95u, 0x2Fu, 0xB2u, 0x46u, 0xDBu, 0x61u, 0xFCu,
+        0xB1u, 0x2Cu, 0x96u, 0x0Bu, 0xFFu, 0x62u, 0xD8u, 0x45u, 0x2Du, 0xB0u, 0x0Au, 0x97u, 0x63u, 0xFEu, 0x44u, 0xD9u,
+        0xDEu, 0x43u, 0xF9u, 0x64u, 0x90u, 0x0Du, 0xB7u, 0x2Au, 0x42u, 0xDFu, 0x65u, 0xF8u, 0x0Cu, 0x91u, 0x2Bu, 0xB6u,
+        0xFBu, 0x66u, 0xDCu, 0x41u, 0xB5u, 0x28u, 0x92u, 0x0Fu, 0x67u, 0xFAu, 0x40u, 0xDDu, 0x29u, 0xB4u, 0x0Eu, 0x93u,
+        0x35u, 0xA8u, 0x12u, 0x8Fu, 0x7Bu, 0xE6u, 0x5Cu, 0xC1u, 0xA9u, 0x34u, 0x8Eu, 0x13u, 0xE7u, 0x7Au, 0xC0u, 0x5Du,
+        0x10u, 0x8Du, 0x37u, 0xAAu, 0x5Eu, 0xC3u, 0x79u, 0xE4u, 0x8Cu, 0x11u, 0xABu, 0x36u, 0xC2u, 0x5Fu, 0xE5u, 0x78u,
+        0x7Fu, 0xE2u, 0x58u, 0xC5u, 0x31u, 0xACu, 0x16u, 0x8Bu, 0xE3u, 0x7Eu, 0xC4u, 0x59u, 0xADu, 0x30u, 0x8Au, 0x17u,
+        0x5Au, 0xC7u, 0x7Du, 0xE0u, 0x14u, 0x89u, 0x33u, 0xAEu, 0xC6u, 0x5Bu, 0xE1u, 0x7Cu, 0x88u, 0x15u, 0xAFu, 0x32u,
+        0xA1u, 0x3Cu, 0x86u, 0x1Bu, 0xEFu, 0x72u, 0xC8u, 0x55u, 0x3Du, 0xA0u, 0x1Au, 0x87u, 0x73u, 0xEEu, 0x54u, 0xC9u,
+        0x84u, 0x19u, 0xA3u, 0x3Eu, 0xCAu, 0x57u, 0xEDu, 0x70u, 0x18u, 0x85u, 0x3Fu, 0xA2u, 0x56u, 0xCBu, 0x71u, 0xECu,
+        0xEBu, 0x76u, 0xCCu, 0x51u, 0xA5u, 0x38u, 0x82u, 0x1Fu, 0x77u, 0xEAu, 0x50u, 0xCDu, 0x39u, 0xA4u, 0x1Eu, 0x83u,
+        0xCEu, 0x53u, 0xE9u, 0x74u, 0x80u, 0x1Du, 0xA7u, 0x3Au, 0x52u, 0xCFu, 0x75u, 0xE8u, 0x1Cu, 0x81u, 0x3Bu, 0xA6u } };
+#endif
+
+#if ( CRC_16_MODE == CRC_16_TABLE )
+static const uint16 Crc_Table16[ 256 ] = {
+    0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u, 0x8108u, 0x9129u, 0xA14Au, 0xB16Bu,
+    0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu, 0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+    0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu, 0x2462u, 0x3443u, 0x0420u, 0x1401u,
+    0x64E6u, 0x74C7u, 0x44A4u, 0x5485u, 0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+    0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u, 0xB75Bu, 0xA77Au, 0x9719u, 0x8738u,
+    0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu, 0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+    0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu, 0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u,
+    0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u, 0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+    0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u, 0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu,
+    0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u, 0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+    0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u, 0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu,
+    0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu, 0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+    0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu, 0x02B1u, 0x1290u, 0x22F3u, 0x32D2u,
+    0x4235u, 0x5214u, 0x6277u, 0x7256u, 0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+    0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u, 0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u,
+    0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu, 0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+    0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu, 0x5844u, 0x4865u, 0x7806u, 0x6827u,
+    0x18C0u, 0x08E1u, 0x3882u, 0x28A3u, 0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+    0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u, 0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du,
+    0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u, 0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+    0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u, 0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u,
+    0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u };
+#elif ( CRC_16_MODE == CRC_16_SLICE4 )
+static const uint16 Crc_Slice16[ 4 ][ 256 ] = {
+    {
+        0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u, 0x8108u, 0x9129u, 0xA14Au, 0xB16Bu,
+        0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu, 0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+        0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu, 0x2462u, 0x3443u, 0x0420u, 0x1401u,
+        0x64E6u, 0x74C7u, 0x44A4u, 0x5485u, 0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+        0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u, 0xB75Bu, 0xA77Au, 0x9719u, 0x8738u,
+        0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu, 0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+        0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu, 0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u,
+        0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u, 0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+        0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u, 0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu,
+        0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u, 0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+        0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u, 0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu,
+        0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu, 0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+        0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu, 0x02B1u, 0x1290u, 0x22F3u, 0x32D2u,
+        0x4235u, 0x5214u, 0x6277u, 0x7256u, 0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+        0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u, 0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u,
+        0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu, 0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+        0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu, 0x5844u, 0x4865u, 0x7806u, 0x6827u,
+        0x18C0u, 0x08E1u, 0x3882u, 0x28A3u, 0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+        0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u, 0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du,
+        0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u, 0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+        0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u, 0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u,
+        0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u },
+    {
+        0x0000u, 0x3331u, 0x6662u, 0x5553u, 0xCCC4u, 0xFFF5u, 0xAAA6u, 0x9997u, 0x89A9u, 0xBA98u, 0xEFCBu, 0xDCFAu,
+        0x456Du, 0x765Cu, 0x230Fu, 0x103Eu, 0x0373u, 0x3042u, 0x6511u, 0x5620u, 0xCFB7u, 0xFC86u, 0xA9D5u, 0x9AE4u,
+        0x8ADAu, 0xB9EBu, 0xECB8u, 0xDF89u, 0x461Eu, 0x752Fu, 0x207Cu, 0x134Du, 0x06E6u, 0x35D7u, 0x6084u, 0x53B5u,
+        0xCA22u, 0xF913u, 0xAC40u, 0x9F71u, 0x8F4Fu, 0xBC7Eu, 0xE92Du, 0xDA1Cu, 0x438Bu, 0x70BAu, 0x25E9u, 0x16D8u,
+        0x0595u, 0x36A4u, 0x63F7u, 0x50C6u, 0xC951u, 0xFA60u, 0xAF33u, 0x9C02u, 0x8C3Cu, 0xBF0Du, 0xEA5Eu, 0xD96Fu,
+        0x40F8u, 0x73C9u, 0x269Au, 0x15ABu, 0x0DCCu, 0x3EFDu, 0x6BAEu, 0x589Fu, 0xC108u, 0xF239u, 0xA76Au, 0x945Bu,
+        0x8465u, 0xB754u, 0xE207u, 0xD136u, 0x48A1u, 0x7B90u, 0x2EC3u, 0x1DF2u, 0x0EBFu, 0x3D8Eu, 0x68DDu, 0x5BECu,
+        0xC27Bu, 0xF14Au, 0xA419u, 0x9728u, 0x8716u, 0xB427u, 0xE174u, 0xD245u, 0x4BD2u, 0x78E3u, 0x2DB0u, 0x1E81u,
+        0x0B2Au, 0x381Bu, 0x6D48u, 0x5E79u, 0xC7EEu, 0xF4DFu, 0xA18Cu, 0x92BDu, 0x8283u, 0xB1B2u, 0xE4E1u, 0xD7D0u,
+        0x4E47u, 0x7D76u, 0x2825u, 0x1B14u, 0x0859u, 0x3B68u, 0x6E3Bu, 0x5D0Au, 0xC49Du, 0xF7ACu, 0xA2FFu, 0x91CEu,
+        0x81F0u, 0xB2C1u, 0xE792u, 0xD4A3u, 0x4D34u, 0x7E05u, 0x2B56u, 0x1867u, 0x1B98u, 0x28A9u, 0x7DFAu, 0x4ECBu,
+        0xD75Cu, 0xE46Du, 0xB13Eu, 0x820Fu, 0x9231u, 0xA100u, 0xF453u, 0xC762u, 0x5EF5u, 0x6DC4u, 0x3897u, 0x0BA6u,
+        0x18EBu, 0x2BDAu, 0x7E89u, 0x4DB8u, 0xD42Fu, 0xE71Eu, 0xB24Du, 0x817Cu, 0x9142u, 0xA273u, 0xF720u, 0xC411u,
+        0x5D86u, 0x6EB7u, 0x3BE4u, 0x08D5u, 0x1D7Eu, 0x2E4Fu, 0x7B1Cu, 0x482Du, 0xD1BAu, 0xE28Bu, 0xB7D8u, 0x84E9u,
+        0x94D7u, 0xA7E6u, 0xF2B5u, 0xC184u, 0x5813u, 0x6B22u, 0x3E71u, 0x0D40u, 0x1E0Du, 0x2D3Cu, 0x786Fu, 0x4B5Eu,
+        0xD2C9u, 0xE1F8u, 0xB4ABu, 0x879Au, 0x97A4u, 0xA495u, 0xF1C6u, 0xC2F7u, 0x5B60u, 0x6851u, 0x3D02u, 0x0E33u,
+        0x1654u, 0x2565u, 0x7036u, 0x4307u, 0xDA90u, 0xE9A1u, 0xBCF2u, 0x8FC3u, 0x9FFDu, 0xACCCu, 0xF99Fu, 0xCAAEu,
+        0x5339u, 0x6008u, 0x355Bu, 0x066Au, 0x1527u, 0x2616u, 0x7345u, 0x4074u, 0xD9E3u, 0xEAD2u, 0xBF81u, 0x8CB0u,
+        0x9C8Eu, 0xAFBFu, 0xFAECu, 0xC9DDu, 0x504Au, 0x637Bu, 0x3628u, 0x0519u, 0x10B2u, 0x2383u, 0x76D0u, 0x45E1u,
+        0xDC76u, 0xEF47u, 0xBA14u, 0x8925u, 0x991Bu, 0xAA2Au, 0xFF79u, 0xCC48u, 0x55DFu, 0x66EEu, 0x33BDu, 0x008Cu,
+        0x13C1u, 0x20F0u, 0x75A3u, 0x4692u, 0xDF05u, 0xEC34u, 0xB967u, 0x8A56u, 0x9A68u, 0xA959u, 0xFC0Au, 0xCF3Bu,
+        0x56ACu, 0x659Du, 0x30CEu, 0x03FFu },
+    {
+        0x0000u, 0x3730u, 0x6E60u, 0x5950u, 0xDCC0u, 0xEBF0u, 0xB2A0u, 0x8590u, 0xA9A1u, 0x9E91u, 0xC7C1u, 0xF0F1u,
+        0x7561u, 0x4251u, 0x1B01u, 0x2C31u, 0x4363u, 0x7453u, 0x2D03u, 0x1A33u, 0x9FA3u, 0xA893u, 0xF1C3u, 0xC6F3u,
+        0xEAC2u, 0xDDF2u, 0x84A2u, 0xB392u, 0x3602u, 0x0132u, 0x5862u, 0x6F52u, 0x86C6u, 0xB1F6u, 0xE8A6u, 0xDF96u,
+        0x5A06u, 0x6D36u, 0x3466u, 0x0356u, 0x2F67u, 0x1857u, 0x4107u, 0x7637u, 0xF3A7u, 0xC497u, 0x9DC7u, 0xAAF7u,
+        0xC5A5u, 0xF295u, 0xABC5u, 0x9CF5u, 0x1965u, 0x2E55u, 0x7705u, 0x4035u, 0x6C04u, 0x5B34u, 0x0264u, 0x3554u,
+        0xB0C4u, 0x87F4u, 0xDEA4u, 0xE994u, 0x1DADu, 0x2A9Du, 0x73CDu, 0x44FDu, 0xC16Du, 0xF65Du, 0xAF0Du, 0x983Du,
+        0xB40Cu, 0x833Cu, 0xDA6Cu, 0xED5Cu, 0x68CCu, 0x5FFCu, 0x06ACu, 0x319Cu, 0x5ECEu, 0x69FEu, 0x30AEu, 0x079Eu,
+        0x820Eu, 0xB53Eu, 0xEC6Eu, 0xDB5Eu, 0xF76Fu, 0xC05Fu, 0x990Fu, 0xAE3Fu, 0x2BAFu, 0x1C9Fu, 0x45CFu, 0x72FFu,
+        0x9B6Bu, 0xAC5Bu, 0xF50Bu, 0xC23Bu, 0x47ABu, 0x709Bu, 0x29CBu, 0x1EFBu, 0x32CAu, 0x05FAu, 0x5CAAu, 0x6B9Au,
+        0xEE0Au, 0xD93Au, 0x806Au, 0xB75Au, 0xD808u, 0xEF38u, 0xB668u, 0x8158u, 0x04C8u, 0x33F8u, 0x6AA8u, 0x5D98u,
+        0x71A9u, 0x4699u, 0x1FC9u, 0x28F9u, 0xAD69u, 0x9A59u, 0xC309u, 0xF439u, 0x3B5Au, 0x0C6Au, 0x553Au, 0x620Au,
+        0xE79Au, 0xD0AAu, 0x89FAu, 0xBECAu, 0x92FBu, 0xA5CBu, 0xFC9Bu, 0xCBABu, 0x4E3Bu, 0x790Bu, 0x205Bu, 0x176Bu,
+        0x7839u, 0x4F09u, 0x1659u, 0x2169u, 0xA4F9u, 0x93C9u, 0xCA99u, 0xFDA9u, 0xD198u, 0xE6A8u, 0xBFF8u, 0x88C8u,
+        0x0D58u, 0x3A68u, 0x6338u, 0x5408u, 0xBD9Cu, 0x8AACu, 0xD3FCu, 0xE4CCu, 0x615Cu, 0x566Cu, 0x0F3Cu, 0x380Cu,
+        0x143Du, 0x230Du, 0x7A5Du, 0x4D6Du, 0xC8FDu, 0xFFCDu, 0xA69Du, 0x91ADu, 0xFEFFu, 0xC9CFu, 0x909Fu, 0xA7AFu,
+        0x223Fu, 0x150Fu, 0x4C5Fu, 0x7B6Fu, 0x575Eu, 0x606Eu, 0x393Eu, 0x0E0Eu, 0x8B9Eu, 0xBCAEu, 0xE5FEu, 0xD2CEu,
+        0x26F7u, 0x11C7u, 0x4897u, 0x7FA7u, 0xFA37u, 0xCD07u, 0x9457u, 0xA367u, 0x8F56u, 0xB866u, 0xE136u, 0xD606u,
+        0x5396u, 0x64A6u, 0x3DF6u, 0x0AC6u, 0x6594u, 0x52A4u, 0x0BF4u, 0x3CC4u, 0xB954u, 0x8E64u, 0xD734u, 0xE004u,
+        0xCC35u, 0xFB05u, 0xA255u, 0x9565u, 0x10F5u, 0x27C5u, 0x7E95u, 0x49A5u, 0xA031u, 0x9701u, 0xCE51u, 0xF961u,
+        0x7CF1u, 0x4BC1u, 0x1291u, 0x25A1u, 0x0990u, 0x3EA0u, 0x67F0u, 0x50C0u, 0xD550u, 0xE260u, 0xBB30u, 0x8C00u,
+        0xE352u, 0xD462u, 0x8D32u, 0xBA02u, 0x3F92u, 0x08A2u, 0x51F2u, 0x66C2u, 0x4AF3u, 0x7DC3u, 0x2493u, 0x13A3u,
+        0x9633u, 0xA103u, 0xF853u, 0xCF63u },
+    {
+        0x0000u, 0x76B4u, 0xED68u, 0x9BDCu, 0xCAF1u, 0xBC45u, 0x2799u, 0x512Du, 0x85C3u, 0xF377u, 0x68ABu, 0x1E1Fu,
+        0x4F32u, 0x3986u, 0xA25Au, 0xD4EEu, 0x1BA7u, 0x6D13u, 0xF6CFu, 0x807Bu, 0xD156u, 0xA7E2u, 0x3C3Eu, 0x4A8Au,
+        0x9E64u, 0xE8D0u, 0x730Cu, 0x05B8u, 0x5495u, 0x2221u, 0xB9FDu, 0xCF49u, 0x374Eu, 0x41FAu, 0xDA26u, 0xAC92u,
+        0xFDBFu, 0x8B0Bu, 0x10D7u, 0x6663u, 0xB28Du, 0xC439u, 0x5FE5u, 0x2951u, 0x787Cu, 0x0EC8u, 0x9514u, 0xE3A0u,
+        0x2CE9u, 0x5A5Du, 0xC181u, 0xB735u, 0xE618u, 0x90ACu, 0x0B70u, 0x7DC4u, 0xA92Au, 0xDF9Eu, 0x4442u, 0x32F6u,
+        0x63DBu, 0x156Fu, 0x8EB3u, 0xF807u, 0x6E9Cu, 0x1828u, 0x83F4u, 0xF540u, 0xA46Du, 0xD2D9u, 0x4905u, 0x3FB1u,
+        0xEB5Fu, 0x9DEBu, 0x0637u, 0x7083u, 0x21AEu, 0x571Au, 0xCCC6u, 0xBA72u, 0x753Bu, 0x038Fu, 0x9853u, 0xEEE7u,
+        0xBFCAu, 0xC97Eu, 0x52A2u, 0x2416u, 0xF0F8u, 0x864Cu, 0x1D90u, 0x6B24u, 0x3A09u, 0x4CBDu, 0xD761u, 0xA1D5u,
+        0x59D2u, 0x2F66u, 0xB4BAu, 0xC20Eu, 0x9323u, 0xE597u, 0x7E4Bu, 0x08FFu, 0xDC11u, 0xAAA5u, 0x3179u, 0x47CDu,
+        0x16E0u, 0x6054u, 0xFB88u, 0x8D3Cu, 0x4275u, 0x34C1u, 0xAF1Du, 0xD9A9u, 0x8884u, 0xFE30u, 0x65ECu, 0x1358u,
+        0xC7B6u, 0xB102u, 0x2ADEu, 0x5C6Au, 0x0D47u, 0x7BF3u, 0xE02Fu, 0x969Bu, 0xDD38u, 0xAB8Cu, 0x3050u, 0x46E4u,
+        0x17C9u, 0x617Du, 0xFAA1u, 0x8C15u, 0x58FBu, 0x2E4Fu, 0xB593u, 0xC327u, 0x920Au, 0xE4BEu, 0x7F62u, 0x09D6u,
+        0xC69Fu, 0xB02Bu, 0x2BF7u, 0x5D43u, 0x0C6Eu, 0x7ADAu, 0xE106u, 0x97B2u, 0x435Cu, 0x35E8u, 0xAE34u, 0xD880u,
+        0x89ADu, 0xFF19u, 0x64C5u, 0x1271u, 0xEA76u, 0x9CC2u, 0x071Eu, 0x71AAu, 0x2087u, 0x5633u, 0xCDEFu, 0xBB5Bu,
+        0x6FB5u, 0x1901u, 0x82DDu, 0xF469u, 0xA544u, 0xD3F0u, 0x482Cu, 0x3E98u, 0xF1D1u, 0x8765u, 0x1CB9u, 0x6A0Du,
+        0x3B20u, 0x4D94u, 0xD648u, 0xA0FCu, 0x7412u, 0x02A6u, 0x997Au, 0xEFCEu, 0xBEE3u, 0xC857u, 0x538Bu, 0x253Fu,
+        0xB3A4u, 0xC510u, 0x5ECCu, 0x2878u, 0x7955u, 0x0FE1u, 0x943Du, 0xE289u, 0x3667u, 0x40D3u, 0xDB0Fu, 0xADBBu,
+        0xFC96u, 0x8A22u, 0x11FEu, 0x674Au, 0xA803u, 0xDEB7u, 0x456Bu, 0x33DFu, 0x62F2u, 0x1446u, 0x8F9Au, 0xF92Eu,
+        0x2DC0u, 0x5B74u, 0xC0A8u, 0xB61Cu, 0xE731u, 0x9185u, 0x0A59u, 0x7CEDu, 0x84EAu, 0xF25Eu, 0x6982u, 0x1F36u,
+        0x4E1Bu, 0x38AFu, 0xA373u, 0xD5C7u, 0x0129u, 0x779Du, 0xEC41u, 0x9AF5u, 0xCBD8u, 0xBD6Cu, 0x26B0u, 0x5004u,
+        0x9F4Du, 0xE9F9u, 0x7225u, 0x0491u, 0x55BCu, 0x2308u, 0xB8D4u, 0xCE60u, 0x1A8Eu, 0x6C3Au, 0xF7E6u, 0x8152u,
+        0xD07Fu, 0xA6CBu, 0x3D17u, 0x4BA3u } };
+#endif
+
+#if ( CRC_32_MODE == CRC_32_TABLE )
+static const uint32 Crc_Table32[ 256 ] = {
+    0x00000000u, 0x77073096u, 0xEE0E612Cu, 0x990951BAu, 0x076DC419u, 0x706AF48Fu, 0xE963A535u, 0x9E6495A3u,
+    0x0EDB8832u, 0x79DCB8A4u, 0xE0D5E91Eu, 0x97D2D988u, 0x09B64C2Bu, 0x7EB17CBDu, 0xE7B82D07u, 0x90BF1D91u,
+    0x1DB71064u, 0x6AB020F2u, 0xF3B97148u, 0x84BE41DEu, 0x1ADAD47Du, 0x6DDDE4EBu, 0xF4D4B551u, 0x83D385C7u,
+    0x136C9856u, 0x646BA8C0u, 0xFD62F97Au, 0x8A65C9ECu, 0x14015C4Fu, 0x63066CD9u, 0xFA0F3D63u, 0x8D080DF5u,
+    0x3B6E20C8u, 0x4C69105Eu, 0xD56041E4u, 0xA2677172u, 0x3C03E4D1u, 0x4B04D447u, 0xD20D85FDu, 0xA50AB56Bu,
+    0x35B5A8FAu, 0x42B2986Cu, 0xDBBBC9D6u, 0xACBCF940u, 0x32D86CE3u, 0x45DF5C75u, 0xDCD60DCFu, 0xABD13D59u,
+    0x26D930ACu, 0x51DE003Au, 0xC8D75180u, 0xBFD06116u, 0x21B4F4B5u, 0x56B3C423u, 0xCFBA9599u, 0xB8BDA50Fu,
+    0x2802B89Eu, 0x5F058808u, 0xC60CD9B2u, 0xB10BE924u, 0x2F6F7C87u, 0x58684C11u, 0xC1611DABu, 0xB6662D3Du,
+    0x76DC4190u, 0x01DB7106u, 0x98D220BCu, 0xEFD5102Au, 0x71B18589u, 0x06B6B51Fu, 0x9FBFE4A5u, 0xE8B8D433u,
+    0x7807C9A2u, 0x0F00F934u, 0x9609A88Eu, 0xE10E9818u, 0x7F6A0DBBu, 0x086D3D2Du, 0x91646C97u, 0xE6635C01u,
+    0x6B6B51F4u, 0x1C6C6162u, 0x856530D8u, 0xF262004Eu, 0x6C0695EDu, 0x1B01A57Bu, 0x8208F4C1u, 0xF50FC457u,
+    0x65B0D9C6u, 0x12B7E950u, 0x8BBEB8EAu, 0xFCB9887Cu, 0x62DD1DDFu, 0x15DA2D49u, 0x8CD37CF3u, 0xFBD44C65u,
+    0x4DB26158u, 0x3AB551CEu, 0xA3BC0074u, 0xD4BB30E2u, 0x4ADFA541u, 0x3DD895D7u, 0xA4D1C46Du, 0xD3D6F4FBu,
+    0x4369E96Au, 0x346ED9FCu, 0xAD678846u, 0xDA60B8D0u, 0x44042D73u, 0x33031DE5u, 0xAA0A4C5Fu, 0xDD0D7CC9u,
+    0x5005713Cu, 0x270241AAu, 0xBE0B1010u, 0xC90C2086u, 0x5768B525u, 0x206F85B3u, 0xB966D409u, 0xCE61E49Fu,
+    0x5EDEF90Eu, 0x29D9C998u, 0xB0D09822u, 0xC7D7A8B4u, 0x59B33D17u, 0x2EB40D81u, 0xB7BD5C3Bu, 0xC0BA6CADu,
+    0xEDB88320u, 0x9ABFB3B6u, 0x03B6E20Cu, 0x74B1D29Au, 0xEAD54739u, 0x9DD277AFu, 0x04DB2615u, 0x73DC1683u,
+    0xE3630B12u, 0x94643B84u, 0x0D6D6A3Eu, 0x7A6A5AA8u, 0xE40ECF0Bu, 0x9309FF9Du, 0x0A00AE27u, 0x7D079EB1u,
+    0xF00F9344u, 0x8708A3D2u, 0x1E01F268u, 0x6906C2FEu, 0xF762575Du, 0x806567CBu, 0x196C3671u, 0x6E6B06E7u,
+    0xFED41B76u, 0x89D32BE0u, 0x10DA7A5Au, 0x67DD4ACCu, 0xF9B9DF6Fu, 0x8EBEEFF9u, 0x17B7BE43u, 0x60B08ED5u,
+    0xD6D6A3E8u, 0xA1D1937Eu, 0x38D8C2C4u, 0x4FDFF252u, 0xD1BB67F1u, 0xA6BC5767u, 0x3FB506DDu, 0x48B2364Bu,
+    0xD80D2BDAu, 0xAF0A1B4Cu, 0x36034AF6u, 0x41047A60u, 0xDF60EFC3u, 0xA867DF55u, 0x316E8EEFu, 0x4669BE79u,
+    0xCB61B38Cu, 0xBC66831Au, 0x256FD2A0u, 0x5268E236u, 0xCC0C7795u, 0xBB0B4703u, 0x220216B9u, 0x5505262Fu,
+    0xC5BA3BBEu, 0xB2BD0B28u, 0x2BB45A92u, 0x5CB36A04u, 0xC2D7FFA7u, 0xB5D0CF31u, 0x2CD99E8Bu, 0x5BDEAE1Du,
+    0x9B64C2B0u, 0xEC63F226u, 0x756AA39Cu, 0x026D930Au, 0x9C0906A9u, 0xEB0E363Fu, 0x72076785u, 0x05005713u,
+    0x95BF4A82u, 0xE2B87A14u, 0x7BB12BAEu, 0x0CB61B38u, 0x92D28E9Bu, 0xE5D5BE0Du, 0x7CDCEFB7u, 0x0BDBDF21u,
+    0x86D3D2D4u, 0xF1D4E242u, 0x68DDB3F8u, 0x1FDA836Eu, 0x81BE16CDu, 0xF6B9265Bu, 0x6FB077E1u, 0x18B74777u,
+    0x88085AE6u, 0xFF0F6A70u, 0x66063BCAu, 0x11010B5Cu, 0x8F659EFFu, 0xF862AE69u, 0x616BFFD3u, 0x166CCF45u,
+    0xA00AE278u, 0xD70DD2EEu, 0x4E048354u, 0x3903B3C2u, 0xA7672661u, 0xD06016F7u, 0x4969474Du, 0x3E6E77DBu,
+    0xAED16A4Au, 0xD9D65ADCu, 0x40DF0B66u, 0x37D83BF0u, 0xA9BCAE53u, 0xDEBB9EC5u, 0x47B2CF7Fu, 0x30B5FFE9u,
+    0xBDBDF21Cu, 0xCABAC28Au, 0x53B39330u, 0x24B4A3A6u, 0xBAD03605u, 0xCDD70693u, 0x54DE5729u, 0x23D967BFu,
+    0xB3667A2Eu, 0xC4614AB8u, 0x5D681B02u, 0x2A6F2B94u, 0xB40BBE37u, 0xC30C8EA1u, 0x5A05DF1Bu, 0x2D02EF8Du };
+#elif ( CRC_32_MODE == CRC_32_SLICE4 )
+static const uint32 Crc_Slice32[ 4 ][ 256 ] = {
+    {
+        0x00000000u, 0x77073096u, 0xEE0E612Cu, 0x990951BAu, 0x076DC419u, 0x706AF48Fu, 0xE963A535u, 0x9E6495A3u,
+        0x0EDB8832u, 0x79DCB8A4u, 0xE0D5E91Eu, 0x97D2D988u, 0x09B64C2Bu, 0x7EB17CBDu, 0xE7B82D07u, 0x90BF1D91u,
+        0x1DB71064u, 0x6AB020F2u, 0xF3B97148u, 0x84BE41DEu, 0x1ADAD47Du, 0x6DDDE4EBu, 0xF4D4B551u, 0x83D385C7u,
+        0x136C9856u, 0x646BA8C0u, 0xFD62F97Au, 0x8A65C9ECu, 0x14015C4Fu, 0x63066CD9u, 0xFA0F3D63u, 0x8D080DF5u,
+        0x3B6E20C8u, 0x4C69105Eu, 0xD56041E4u, 0xA2677172u, 0x3C03E4D1u, 0x4B04D447u, 0xD20D85FDu, 0xA50AB56Bu,
+        0x35B5A8FAu, 0x42B2986Cu, 0xDBBBC9D6u, 0xACBCF940u, 0x32D86CE3u, 0x45DF5C75u, 0xDCD60DCFu, 0xABD13D59u,
+        0x26D930ACu, 0x51DE003Au, 0xC8D75180u, 0xBFD06116u, 0x21B4F4B5u, 0x56B3C423u, 0xCFBA9599u, 0xB8BDA50Fu,
+        0x2802B89Eu, 0x5F058808u, 0xC60CD9B2u, 0xB10BE924u, 0x2F6F7C87u, 0x58684C11u, 0xC1611DABu, 0xB6662D3Du,
+        0x76DC4190u, 0x01DB7106u, 0x98D220BCu, 0xEFD5102Au, 0x71B18589u, 0x06B6B51Fu, 0x9FBFE4A5u, 0xE8B8D433u,
+        0x7807C9A2u, 0x0F00F934u, 0x9609A88Eu, 0xE10E9818u, 0x7F6A0DBBu, 0x086D3D2Du, 0x91646C97u, 0xE6635C01u,
+        0x6B6B51F4u, 0x1C6C6162u, 0x856530D8u, 0xF262004Eu, 0x6C0695EDu, 0x1B01A57Bu, 0x8208F4C1u, 0xF50FC457u,
+        0x65B0D9C6u, 0x12B7E950u, 0x8BBEB8EAu, 0xFCB9887Cu, 0x62DD1DDFu, 0x15DA2D49u, 0x8CD37CF3u, 0xFBD44C65u,
+        0x4DB26158u, 0x3AB551CEu, 0xA3BC0074u, 0xD4BB30E2u, 0x4ADFA541u, 0x3DD895D7u, 0xA4D1C46Du, 0xD3D6F4FBu,
+        0x4369E96Au, 0x346ED9FCu, 0xAD678846u, 0xDA60B8D0u, 0x44042D73u, 0x33031DE5u, 0xAA0A4C5Fu, 0xDD0D7CC9u,
+        0x5005713Cu, 0x270241AAu, 0xBE0B1010u, 0xC90C2086u, 0x5768B525u, 0x206F85B3u, 0xB966D409u, 0xCE61E49Fu,
+        0x5EDEF90Eu, 0x29D9C998u, 0xB0D09822u, 0xC7D7A8B4u, 0x59B33D17u, 0x2EB40D81u, 0xB7BD5C3Bu, 0xC0BA6CADu,
+        0xEDB88320u, 0x9ABFB3B6u, 0x03B6E20Cu, 0x74B1D29Au, 0xEAD54739u, 0x9DD277AFu, 0x04DB2615u, 0x73DC1683u,
+        0xE3630B12u, 0x94643B84u, 0x0D6D6A3Eu, 0x7A6A5AA8u, 0xE40ECF0Bu, 0x9309FF9Du, 0x0A00AE27u, 0x7D079EB1u,
+        0xF00F9344u, 0x8708A3D2u, 0x1E01F268u, 0x6906C2FEu, 0xF762575Du, 0x806567CBu, 0x196C3671u, 0x6E6B06E7u,
+        0xFED41B76u, 0x89D32BE0u, 0x10DA7A5Au, 0x67DD4ACCu, 0xF9B9DF6Fu, 0x8EBEEFF9u, 0x17B7BE43u, 0x60B08ED5u,
+        0xD6D6A3E8u, 0xA1D1937Eu, 0x38D8C2C4u, 0x4FDFF252u, 0xD1BB67F1u, 0xA6BC5767u, 0x3FB506DDu, 0x48B2364Bu,
+        0xD80D2BDAu, 0xAF0A1B4Cu, 0x36034AF6u, 0x41047A60u, 0xDF60EFC3u, 0xA867DF55u, 0x316E8EEFu, 0x4669BE79u,
+        0xCB61B38Cu, 0xBC66831Au, 0x256FD2A0u, 0x5268E236u, 0xCC0C7795u, 0xBB0B4703u, 0x220216B9u, 0x5505262Fu,
+        0xC5BA3BBEu, 0xB2BD0B28u, 0x2BB45A92u, 0x5CB36A04u, 0xC2D7FFA7u, 0xB5D0CF31u, 0x2CD99E8Bu, 0x5BDEAE1Du,
+        0x9B64C2B0u, 0xEC63F226u, 0x756AA39Cu, 0x026D930Au, 0x9C0906A9u, 0xEB0E363Fu, 0x72076785u, 0x05005713u,
+        0x95BF4A82u, 0xE2B87A14u, 0x7BB12BAEu, 0x0CB61B38u, 0x92D28E9Bu, 0xE5D5BE0Du, 0x7CDCEFB7u, 0x0BDBDF21u,
+        0x86D3D2D4u, 0xF1D4E242u, 0x68DDB3F8u, 0x1FDA836Eu, 0x81BE16CDu, 0xF6B9265Bu, 0x6FB077E1u, 0x18B74777u,
+        0x88085AE6u, 0xFF0F6A70u, 0x66063BCAu, 0x11010B5Cu, 0x8F659EFFu, 0xF862AE69u, 0x616BFFD3u, 0x166CCF45u,
+        0xA00AE278u, 0xD70DD2EEu, 0x4E048354u, 0x3903B3C2u, 0xA7672661u, 0xD06016F7u, 0x4969474Du, 0x3E6E77DBu,
+        0xAED16A4Au, 0xD9D65ADCu, 0x40DF0B66u, 0x37D83BF0u, 0xA9BCAE53u, 0xDEBB9EC5u, 0x47B2CF7Fu, 0x30B5FFE9u,
+        0xBDBDF21Cu, 0xCABAC28Au, 0x53B39330u, 0x24B4A3A6u, 0xBAD03605u, 0xCDD70693u, 0x54DE5729u, 0x23D967BFu,
+        0xB3667A2Eu, 0xC4614AB8u, 0x5D681B02u, 0x2A6F2B94u, 0xB40BBE37u, 0xC30C8EA1u, 0x5A05DF1Bu, 0x2D02EF8Du },
+    {
+        0x00000000u, 0x191B3141u, 0x32366282u, 0x2B2D53C3u, 0x646CC504u, 0x7D77F445u, 0x565AA786u, 0x4F4196C7u,
+        0xC8D98A08u, 0xD1C2BB49u, 0xFAEFE88Au, 0xE3F4D9CBu, 0xACB54F0Cu, 0xB5AE7E4Du, 0x9E832D8Eu, 0x87981CCFu,
+        0x4AC21251u, 0x53D92310u, 0x78F470D3u, 0x61EF4192u, 0x2EAED755u, 0x37B5E614u, 0x1C98B5D7u, 0x05838496u,
+        0x821B9859u, 0x9B00A918u, 0xB02DFADBu, 0xA936CB9Au, 0xE6775D5Du, 0xFF6C6C1Cu, 0xD4413FDFu, 0xCD5A0E9Eu,
+        0x958424A2u, 0x8C9F15E3u, 0xA7B24620u, 0xBEA97761u, 0xF1E8E1A6u, 0xE8F3D0E7u, 0xC3DE8324u, 0xDAC5B265u,
+        0x5D5DAEAAu, 0x44469FEBu, 0x6F6BCC28u, 0x7670FD69u, 0x39316BAEu, 0x202A5AEFu, 0x0B07092Cu, 0x121C386Du,
+        0xDF4636F3u, 0xC65D07B2u, 0xED705471u, 0xF46B6530u, 0xBB2AF3F7u, 0xA231C2B6u, 0x891C9175u, 0x9007A034u,
+        0x179FBCFBu, 0x0E848DBAu, 0x25A9DE79u, 0x3CB2EF38u, 0x73F379FFu, 0x6AE848BEu, 0x41C51B7Du, 0x58DE2A3Cu,
+        0xF0794F05u, 0xE9627E44u, 0xC24F2D87u, 0xDB541CC6u, 0x94158A01u, 0x8D0EBB40u, 0xA623E883u, 0xBF38D9C2u,
+        0x38A0C50Du, 0x21BBF44Cu, 0x0A96A78Fu, 0x138D96CEu, 0x5CCC0009u, 0x45D73148u, 0x6EFA628Bu, 0x77E153CAu,
+        0xBABB5D54u, 0xA3A06C15u, 0x888D3FD6u, 0x91960E97u, 0xDED79850u, 0xC7CCA911u, 0xECE1FAD2u, 0xF5FACB93u,
+        0x7262D75Cu, 0x6B79E61Du, 0x4054B5DEu, 0x594F849Fu, 0x160E1258u, 0x0F152319u, 0x243870DAu, 0x3D23419Bu,
+        0x65FD6BA7u, 0x7CE65AE6u, 0x57CB0925u, 0x4ED03864u, 0x0191AEA3u, 0x188A9FE2u, 0x33A7CC21u, 0x2ABCFD60u,
+        0xAD24E1AFu, 0xB43FD0EEu, 0x9F12832Du, 0x8609B26Cu, 0xC94824ABu, 0xD05315EAu, 0xFB7E4629u, 0xE2657768u,
+        0x2F3F79F6u, 0x362448B7u, 0x1D091B74u, 0x04122A35u, 0x4B53BCF2u, 0x52488DB3u, 0x7965DE70u, 0x607EEF31u,
+        0xE7E6F3FEu, 0xFEFDC2BFu, 0xD5D0917Cu, 0xCCCBA03Du, 0x838A36FAu, 0x9A9107BBu, 0xB1BC5478u, 0xA8A76539u,
+        0x3B83984Bu, 0x2298A90Au, 0x09B5FAC9u, 0x10AECB88u, 0x5FEF5D4Fu, 0x46F46C0Eu, 0x6DD93FCDu, 0x74C20E8Cu,
+        0xF35A1243u, 0xEA412302u, 0xC16C70C1u, 0xD8774180u, 0x9736D747u, 0x8E2DE606u, 0xA500B5C5u, 0xBC1B8484u,
+        0x71418A1Au, 0x685ABB5Bu, 0x4377E898u, 0x5A6CD9D9u, 0x152D4F1Eu, 0x0C367E5Fu, 0x271B2D9Cu, 0x3E001CDDu,
+        0xB9980012u, 0xA0833153u, 0x8BAE6290u, 0x92B553D1u, 0xDDF4C516u, 0xC4EFF457u, 0xEFC2A794u, 0xF6D996D5u,
+        0xAE07BCE9u, 0xB71C8DA8u, 0x9C31DE6Bu, 0x852AEF2Au, 0xCA6B79EDu, 0xD37048ACu, 0xF85D1B6Fu, 0xE1462A2Eu,
+        0x66DE36E1u, 0x7FC507A0u, 0x54E85463u, 0x4DF36522u, 0x02B2F3E5u, 0x1BA9C2A4u, 0x30849167u, 0x299FA026u,
+        0xE4C5AEB8u, 0xFDDE9FF9u, 0xD6F3CC3Au, 0xCFE8FD7Bu, 0x80A96BBCu, 0x99B25AFDu, 0xB29F093Eu, 0xAB84387Fu,
+        0x2C1C24B0u, 0x350715F1u, 0x1E2A4632u, 0x07317773u, 0x4870E1B4u, 0x516BD0F5u, 0x7A468336u, 0x635DB277u,
+        0xCBFAD74Eu, 0xD2E1E60Fu, 0xF9CCB5CCu, 0xE0D7848Du, 0xAF96124Au, 0xB68D230Bu, 0x9DA070C8u, 0x84BB4189u,
+        0x03235D46u, 0x1A386C07u, 0x31153FC4u, 0x280E0E85u, 0x674F9842u, 0x7E54A903u, 0x5579FAC0u, 0x4C62CB81u,
+        0x8138C51Fu, 0x9823F45Eu, 0xB30EA79Du, 0xAA1596DCu, 0xE554001Bu, 0xFC4F315Au, 0xD7626299u, 0xCE7953D8u,
+        0x49E14F17u, 0x50FA7E56u, 0x7BD72D95u, 0x62CC1CD4u, 0x2D8D8A13u, 0x3496BB52u, 0x1FBBE891u, 0x06A0D9D0u,
+        0x5E7EF3ECu, 0x4765C2ADu, 0x6C48916Eu, 0x7553A02Fu, 0x3A1236E8u, 0x230907A9u, 0x0824546Au, 0x113F652Bu,
+        0x96A779E4u, 0x8FBC48A5u, 0xA4911B66u, 0xBD8A2A27u, 0xF2CBBCE0u, 0xEBD08DA1u, 0xC0FDDE62u, 0xD9E6EF23u,
+        0x14BCE1BDu, 0x0DA7D0FCu, 0x268A833Fu, 0x3F91B27Eu, 0x70D024B9u, 0x69CB15F8u, 0x42E6463Bu, 0x5BFD777Au,
+        0xDC656BB5u, 0xC57E5AF4u, 0xEE530937u, 0xF7483876u, 0xB809AEB1u, 0xA1129FF0u, 0x8A3FCC33u, 0x9324FD72u },
+    {
+        0x00000000u, 0x01C26A37u, 0x0384D46Eu, 0x0246BE59u, 0x0709A8DCu, 0x06CBC2EBu, 0x048D7CB2u, 0x054F1685u,
+        0x0E1351B8u, 0x0FD13B8Fu, 0x0D9785D6u, 0x0C55EFE1u, 0x091AF964u, 0x08D89353u, 0x0A9E2D0Au, 0x0B5C473Du,
+        0x1C26A370u, 0x1DE4C947u, 0x1FA2771Eu, 0x1E601D29u, 0x1B2F0BACu, 0x1AED619Bu, 0x18ABDFC2u, 0x1969B5F5u,
+        0x1235F2C8u, 0x13F798FFu, 0x11B126A6u, 0x10734C91u, 0x153C5A14u, 0x14FE3023u, 0x16B88E7Au, 0x177AE44Du,
+        0x384D46E0u, 0x398F2CD7u, 0x3BC9928Eu, 0x3A0BF8B9u, 0x3F44EE3Cu, 0x3E86840Bu, 0x3CC03A52u, 0x3D025065u,
+        0x365E1758u, 0x379C7D6Fu, 0x35DAC336u, 0x3418A901u, 0x3157BF84u, 0x3095D5B3u, 0x32D36BEAu, 0x331101DDu,
+        0x246BE590u, 0x25A98FA7u, 0x27EF31FEu, 0x262D5BC9u, 0x23624D4Cu, 0x22A0277Bu, 0x20E69922u, 0x2124F315u,
+        0x2A78B428u, 0x2BBADE1Fu, 0x29FC6046u, 0x283E0A71u, 0x2D711CF4u, 0x2CB376C3u, 0x2EF5C89Au, 0x2F37A2ADu,
+        0x709A8DC0u, 0x7158E7F7u, 0x731E59AEu, 0x72DC3399u, 0x7793251Cu, 0x76514F2Bu, 0x7417F172u, 0x75D59B45u,
+        0x7E89DC78u, 0x7F4BB64Fu, 0x7D0D0816u, 0x7CCF6221u, 0x798074A4u, 0x78421E93u, 0x7A04A0CAu, 0x7BC6CAFDu,
+        0x6CBC2EB0u, 0x6D7E4487u, 0x6F38FADEu, 0x6EFA90E9u, 0x6BB5866Cu, 0x6A77EC5Bu, 0x68315202u, 0x69F33835u,
+        0x62AF7F08u, 0x636D153Fu, 0x612BAB66u, 0x60E9C151u, 0x65A6D7D4u, 0x6464BDE3u, 0x662203BAu, 0x67E0698Du,
+        0x48D7CB20u, 0x4915A117u, 0x4B531F4Eu, 0x4A917579u, 0x4FDE63FCu, 0x4E1C09CBu, 0x4C5AB792u, 0x4D98DDA5u,
+        0x46C49A98u, 0x4706F0AFu, 0x45404EF6u, 0x448224C1u, 0x41CD3244u, 0x400F5873u, 0x4249E62Au, 0x438B8C1Du,
+        0x54F16850u, 0x55330267u, 0x5775BC3Eu, 0x56B7D609u, 0x53F8C08Cu, 0x523AAABBu, 0x507C14E2u, 0x51BE7ED5u,
+        0x5AE239E8u, 0x5B2053DFu, 0x5966ED86u, 0x58A487B1u, 0x5DEB9134u, 0x5C29FB03u, 0x5E6F455Au, 0x5FAD2F6Du,
+        0xE1351B80u, 0xE0F771B7u, 0xE2B1CFEEu, 0xE373A5D9u, 0xE63CB35Cu, 0xE7FED96Bu, 0xE5B86732u, 0xE47A0D05u,
+        0xEF264A38u, 0xEEE4200Fu, 0xECA29E56u, 0xED60F461u, 0xE82FE2E4u, 0xE9ED88D3u, 0xEBAB368Au, 0xEA695CBDu,
+        0xFD13B8F0u, 0xFCD1D2C7u, 0xFE976C9Eu, 0xFF5506A9u, 0xFA1A102Cu, 0xFBD87A1Bu, 0xF99EC442u, 0xF85CAE75u,
+        0xF300E948u, 0xF2C2837Fu, 0xF0843D26u, 0xF1465711u, 0xF4094194u, 0xF5CB2BA3u, 0xF78D95FAu, 0xF64FFFCDu,
+        0xD9785D60u, 0xD8BA3757u, 0xDAFC890Eu, 0xDB3EE339u, 0xDE71F5BCu, 0xDFB39F8Bu, 0xDDF521D2u, 0xDC374BE5u,
+        0xD76B0CD8u, 0xD6A966EFu, 0xD4EFD8B6u, 0xD52DB281u, 0xD062A404u, 0xD1A0CE33u, 0xD3E6706Au, 0xD2241A5Du,
+        0xC55EFE10u, 0xC49C9427u, 0xC6DA2A7Eu, 0xC7184049u, 0xC25756CCu, 0xC3953CFBu, 0xC1D382A2u, 0xC011E895u,
+        0xCB4DAFA8u, 0xCA8FC59Fu, 0xC8C97BC6u, 0xC90B11F1u, 0xCC440774u, 0xCD866D43u, 0xCFC0D31Au, 0xCE02B92Du,
+        0x91AF9640u, 0x906DFC77u, 0x922B422Eu, 0x93E92819u, 0x96A63E9Cu, 0x976454ABu, 0x9522EAF2u, 0x94E080C5u,
+        0x9FBCC7F8u, 0x9E7EADCFu, 0x9C381396u, 0x9DFA79A1u, 0x98B56F24u, 0x99770513u, 0x9B31BB4Au, 0x9AF3D17Du,
+        0x8D893530u, 0x8C4B5F07u, 0x8E0DE15Eu, 0x8FCF8B69u, 0x8A809DECu, 0x8B42F7DBu, 0x89044982u, 0x88C623B5u,
+        0x839A6488u, 0x82580EBFu, 0x801EB0E6u, 0x81DCDAD1u, 0x8493CC54u, 0x8551A663u, 0x8717183Au, 0x86D5720Du,
+        0xA9E2D0A0u, 0xA820BA97u, 0xAA6604CEu, 0xABA46EF9u, 0xAEEB787Cu, 0xAF29124Bu, 0xAD6FAC12u, 0xACADC625u,
+        0xA7F18118u, 0xA633EB2Fu, 0xA4755576u, 0xA5B73F41u, 0xA0F829C4u, 0xA13A43F3u, 0xA37CFDAAu, 0xA2BE979Du,
+        0xB5C473D0u, 0xB40619E7u, 0xB640A7BEu, 0xB782CD89u, 0xB2CDDB0Cu, 0xB30FB13Bu, 0xB1490F62u, 0xB08B6555u,
+        0xBBD72268u, 0xBA15485Fu, 0xB853F606u, 0xB9919C31u, 0xBCDE8AB4u, 0xBD1CE083u, 0xBF5A5EDAu, 0xBE9834EDu },
+    {
+        0x00000000u, 0xB8BC6765u, 0xAA09C88Bu, 0x12B5AFEEu, 0x8F629757u, 0x37DEF032u, 0x256B5FDCu, 0x9DD738B9u,
+        0xC5B428EFu, 0x7D084F8Au, 0x6FBDE064u, 0xD7018701u, 0x4AD6BFB8u, 0xF26AD8DDu, 0xE0DF7733u, 0x58631056u,
+        0x5019579Fu, 0xE8A530FAu, 0xFA109F14u, 0x42ACF871u, 0xDF7BC0C8u, 0x67C7A7ADu, 0x75720843u, 0xCDCE6F26u,
+        0x95AD7F70u, 0x2D111815u, 0x3FA4B7FBu, 0x8718D09Eu, 0x1ACFE827u, 0xA2738F42u, 0xB0C620ACu, 0x087A47C9u,
+        0xA032AF3Eu, 0x188EC85Bu, 0x0A3B67B5u, 0xB28700D0u, 0x2F503869u, 0x97EC5F0Cu, 0x8559F0E2u, 0x3DE59787u,
+        0x658687D1u, 0xDD3AE0B4u, 0xCF8F4F5Au, 0x7733283Fu, 0xEAE41086u, 0x525877E3u, 0x40EDD80Du, 0xF851BF68u,
+        0xF02BF8A1u, 0x48979FC4u, 0x5A22302Au, 0xE29E574Fu, 0x7F496FF6u, 0xC7F50893u, 0xD540A77Du, 0x6DFCC018u,
+        0x359FD04Eu, 0x8D23B72Bu, 0x9F9618C5u, 0x272A7FA0u, 0xBAFD4719u, 0x0241207Cu, 0x10F48F92u, 0xA848E8F7u,
+        0x9B14583Du, 0x23A83F58u, 0x311D90B6u, 0x89A1F7D3u, 0x1476CF6Au, 0xACCAA80Fu, 0xBE7F07E1u, 0x06C36084u,
+        0x5EA070D2u, 0xE61C17B7u, 0xF4A9B859u, 0x4C15DF3Cu, 0xD1C2E785u, 0x697E80E0u, 0x7BCB2F0Eu, 0xC377486Bu,
+        0xCB0D0FA2u, 0x73B168C7u, 0x6104C729u, 0xD9B8A04Cu, 0x446F98F5u, 0xFCD3FF90u, 0xEE66507Eu, 0x56DA371Bu,
+        0x0EB9274Du, 0xB6054028u, 0xA4B0EFC6u, 0x1C0C88A3u, 0x81DBB01Au, 0x3967D77Fu, 0x2BD27891u, 0x936E1FF4u,
+        0x3B26F703u, 0x839A9066u, 0x912F3F88u, 0x299358EDu, 0xB4446054u, 0x0CF80731u, 0x1E4DA8DFu, 0xA6F1CFBAu,
+        0xFE92DFECu, 0x462EB889u, 0x549B1767u, 0xEC277002u, 0x71F048BBu, 0xC94C2FDEu, 0xDBF98030u, 0x6345E755u,
+        0x6B3FA09Cu, 0xD383C7F9u, 0xC1366817u, 0x798A0F72u, 0xE45D37CBu, 0x5CE150AEu, 0x4E54FF40u, 0xF6E89825u,
+        0xAE8B8873u, 0x1637EF16u, 0x048240F8u, 0xBC3E279Du, 0x21E91F24u, 0x99557841u, 0x8BE0D7AFu, 0x335CB0CAu,
+        0xED59B63Bu, 0x55E5D15Eu, 0x47507EB0u, 0xFFEC19D5u, 0x623B216Cu, 0xDA874609u, 0xC832E9E7u, 0x708E8E82u,
+        0x28ED9ED4u, 0x9051F9B1u, 0x82E4565Fu, 0x3A58313Au, 0xA78F0983u, 0x1F336EE6u, 0x0D86C108u, 0xB53AA66Du,
+        0xBD40E1A4u, 0x05FC86C1u, 0x1749292Fu, 0xAFF54E4Au, 0x322276F3u, 0x8A9E1196u, 0x982BBE78u, 0x2097D91Du,
+        0x78F4C94Bu, 0xC048AE2Eu, 0xD2FD01C0u, 0x6A4166A5u, 0xF7965E1Cu, 0x4F2A3979u, 0x5D9F9697u, 0xE523F1F2u,
+        0x4D6B1905u, 0xF5D77E60u, 0xE762D18Eu, 0x5FDEB6EBu, 0xC2098E52u, 0x7AB5E937u, 0x680046D9u, 0xD0BC21BCu,
+        0x88DF31EAu, 0x3063568Fu, 0x22D6F961u, 0x9A6A9E04u, 0x07BDA6BDu, 0xBF01C1D8u, 0xADB46E36u, 0x15080953u,
+        0x1D724E9Au, 0xA5CE29FFu, 0xB77B8611u, 0x0FC7E174u, 0x9210D9CDu, 0x2AACBEA8u, 0x38191146u, 0x80A57623u,
+        0xD8C66675u, 0x607A0110u, 0x72CFAEFEu, 0xCA73C99Bu, 0x57A4F122u, 0xEF189647u, 0xFDAD39A9u, 0x45115ECCu,
+        0x764DEE06u, 0xCEF18963u, 0xDC44268Du, 0x64F841E8u, 0xF92F7951u, 0x41931E34u, 0x5326B1DAu, 0xEB9AD6BFu,
+        0xB3F9C6E9u, 0x0B45A18Cu, 0x19F00E62u, 0xA14C6907u, 0x3C9B51BEu, 0x842736DBu, 0x96929935u, 0x2E2EFE50u,
+        0x2654B999u, 0x9EE8DEFCu, 0x8C5D7112u, 0x34E11677u, 0xA9362ECEu, 0x118A49ABu, 0x033FE645u, 0xBB838120u,
+        0xE3E09176u, 0x5B5CF613u, 0x49E959FDu, 0xF1553E98u, 0x6C820621u, 0xD43E6144u, 0xC68BCEAAu, 0x7E37A9CFu,
+        0xD67F4138u, 0x6EC3265Du, 0x7C7689B3u, 0xC4CAEED6u, 0x591DD66Fu, 0xE1A1B10Au, 0xF3141EE4u, 0x4BA87981u,
+        0x13CB69D7u, 0xAB770EB2u, 0xB9C2A15Cu, 0x017EC639u, 0x9CA9FE80u, 0x241599E5u, 0x36A0360Bu, 0x8E1C516Eu,
+        0x866616A7u, 0x3EDA71C2u, 0x2C6FDE2Cu, 0x94D3B949u, 0x090481F0u, 0xB1B8E695u, 0xA30D497Bu, 0x1BB12E1Eu,
+        0x43D23E48u, 0xFB6E592Du, 0xE9DBF6C3u, 0x516791A6u, 0xCCB0A91Fu, 0x740CCE7Au, 0x66B96194u, 0xDE0506F1u } };
+#endif
+
+#if ( CRC_8_MODE == CRC_8_HARDWARE ) || ( CRC_16_MODE == CRC_16_HARDWARE ) || ( CRC_32_MODE == CRC_32_HARDWARE )
+/**
+ * @brief   **CRC hardware unit calculation**
+ *
+ * Enables the CRC clock if needed, loads the polynomial and the initial value and feeds the data
+ * one byte at the time, the unit processes each byte in a single AHB cycle.
+ *
+ * @param[in] Control Polynomial size and bit reversal options for the control register
+ * @param[in] Polynomial Generator polynomial
+ * @param[in] Initial Initial value of the CRC register
+ * @param[in] Data Pointer to the data
+ * @param[in] Length Number of bytes
+ *
+ * @retval Content of the CRC register
+ */
+static uint32 Crc_HwCalculate( uint32 Control, uint32 Polynomial, uint32 Initial, const uint8 *Data, uint32 Length )
+{
+    /*the clock register is shared with the other AHB drivers, masked so no interrupt can write it
+    between the read and the write*/
+    uint32 Primask = Bfx_AtomicEnter();
+    uint32 Clocks  = REG_READ( &REG_RCC->AHBENR );
+
+    if( ( Clocks & REG_RCC_AHBENR_CRCEN ) == 0u )
+    {
+        REG_WRITE( &REG_RCC->AHBENR, Clocks | REG_RCC_AHBENR_CRCEN );
+    }
+    Bfx_AtomicExit( Primask );
+
+    REG_WRITE( &REG_CRC->POL, Polynomial );
+    REG_WRITE( &REG_CRC->INIT, Initial );
+    REG_WRITE( &REG_CRC->CR, Control | REG_CRC_CR_RESET );
+
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        REG_WRITE_BYTE( &REG_CRC->DR, Data[ i ] );
+    }
+
+    return REG_READ( &REG_CRC->DR );
+}
+#endif
+
+#if ( CRC_32_MODE == CRC_32_HARDWARE )
+/**
+ * @brief   **Reverse the bits of a word**
+ *
+ * @param[in] Data Word to reverse
+ *
+ * @retval Word with bit 0 swapped with bit 31, bit 1 with bit 30 and so on
+ */
+static uint32 Crc_Reflect32( uint32 Data )
+{
+    Data = ( ( Data >> 1u ) & 0x55555555u ) | ( ( Data & 0x55555555u ) << 1u );
+    Data = ( ( Data >> 2u ) & 0x33333333u ) | ( ( Data & 0x33333333u ) << 2u );
+    Data = ( ( Data >> 4u ) & 0x0F0F0F0Fu ) | ( ( Data & 0x0F0F0F0Fu ) << 4u );
+    Data = ( ( Data >> 8u ) & 0x00FF00FFu ) | ( ( Data & 0x00FF00FFu ) << 8u );
+
+    return ( Data >> 16u ) | ( Data << 16u );
+}
+#endif
+
+/**
+ * @brief   **8 bit SAE J1850 CRC Calculation**
+ *
+ * This service makes a CRC8 calculation on Crc_Length data bytes, with SAE J1850 parameters.
+ * Polynomial 0x1D, initial value 0xFF and final xor value 0xFF.
+ *
+ * **Example:**
+ *      @code
+ *      Crc = Crc_CalculateCRC8("123456789", 9, 0, TRUE);
+ *      Crc is equal to 0x4B
+ *      @endcode
+ *
+ * @param[in] Crc_DataPtr Pointer to start address of data block to be calculated
+ * @param[in] Crc_Length Length of data block to be calculated in bytes
+ * @param[in] Crc_StartValue8 Start value when the algorithm starts, the result of the previous call
+ * @param[in] Crc_IsFirstCall TRUE: first call in a sequence or individual CRC calculation, start
+ *            from the initial value and ignore Crc_StartValue8. FALSE: subsequent call in a sequence
+ *
+ * @retval 8 bit result of CRC calculation
+ */
+uint8 Crc_CalculateCRC8( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 Crc_StartValue8, boolean Crc_IsFirstCall )
+{
+    uint8 Crc = ( Crc_IsFirstCall == TRUE ) ? CRC_8_INITIAL_VALUE : ( Crc_StartValue8 ^ CRC_8_XOR_VALUE );
+    const uint8 *Data = Crc_DataPtr;
+    uint32 Length     = Crc_Length;
+
+#if ( CRC_8_MODE == CRC_8_HARDWARE )
+    Crc = (uint8)Crc_HwCalculate( CRC_HW_CR_POLYSIZE_8, CRC_8_POLYNOMIAL, Crc, Data, Length );
+#elif ( CRC_8_MODE == CRC_8_RUNTIME )
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        Crc ^= Data[ i ];
+        for( uint8 Bit = 0u; Bit < 8u; Bit++ )
+        {
+            Crc = ( ( Crc & 0x80u ) != 0u ) ? (uint8)( ( Crc << 1u ) ^ CRC_8_POLYNOMIAL ) : (uint8)( Crc << 1u );
+        }
+    }
+#elif ( CRC_8_MODE == CRC_8_TABLE )
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        Crc = Crc_Table8[ Crc ^ Data[ i ] ];
+    }
+#elif ( CRC_8_MODE == CRC_8_SLICE4 )
+    for( ; Length >= 4u; Length -= 4u )
+    {
+        Crc = Crc_Slice8[ 3 ][ Crc ^ Data[ 0 ] ] ^ Crc_Slice8[ 2 ][ Data[ 1 ] ] ^ Crc_Slice8[ 1 ][ Data[ 2 ] ] ^ Crc_Slice8[ 0 ][ Data[ 3 ] ];
+        Data += 4u;
+    }
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        Crc = Crc_Slice8[ 0 ][ Crc ^ Data[ i ] ];
+    }
+#endif
+
+    return Crc ^ CRC_8_XOR_VALUE;
+}
+
+/**
+ * @brief   **16 bit CCITT CRC Calculation**
+ *
+ * This service makes a CRC16 calculation on Crc_Length data bytes, with CCITT-FALSE parameters.
+ * Polynomial 0x1021, initial value 0xFFFF and no final xor value.
+ *
+ * **Example:**
+ *      @code
+ *      Crc = Crc_CalculateCRC16("123456789", 9, 0, TRUE);
+ *      Crc is equal to 0x29B1
+ *      @endcode
+ *
+ * @param[in] Crc_DataPtr Pointer to start address of data block to be calculated
+ * @param[in] Crc_Length Length of data block to be calculated in bytes
+ * @param[in] Crc_StartValue16 Start value when the algorithm starts, the result of the previous call
+ * @param[in] Crc_IsFirstCall TRUE: first call in a sequence or individual CRC calculation, start
+ *            from the initial value and ignore Crc_StartValue16. FALSE: subsequent call in a sequence
+ *
+ * @retval 16 bit result of CRC calculation
+ */
+uint16 Crc_CalculateCRC16( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint16 Crc_StartValue16, boolean Crc_IsFirstCall )
+{
+    uint16 Crc        = ( Crc_IsFirstCall == TRUE ) ? CRC_16_INITIAL_VALUE : Crc_StartValue16;
+    const uint8 *Data = Crc_DataPtr;
+    uint32 Length     = Crc_Length;
+
+#if ( CRC_16_MODE == CRC_16_HARDWARE )
+    Crc = (uint16)Crc_HwCalculate( CRC_HW_CR_POLYSIZE_16, CRC_16_POLYNOMIAL, Crc, Data, Length );
+#elif ( CRC_16_MODE == CRC_16_RUNTIME )
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        Crc ^= (uint16)( Data[ i ] << 8u );
+        for( uint8 Bit = 0u; Bit < 8u; Bit++ )
+        {
+            Crc = ( ( Crc & 0x8000u ) != 0u ) ? (uint16)( ( Crc << 1u ) ^ CRC_16_POLYNOMIAL ) : (uint16)( Crc << 1u );
+        }
+    }
+#elif ( CRC_16_MODE == CRC_16_TABLE )
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        Crc = (uint16)( Crc << 8u ) ^ Crc_Table16[ ( Crc >> 8u ) ^ Data[ i ] ];
+    }
+#elif ( CRC_16_MODE == CRC_16_SLICE4 )
+    for( ; Length >= 4u; Length -= 4u )
+    {
+        Crc = Crc_Slice16[ 3 ][ ( Crc >> 8u ) ^ Data[ 0 ] ] ^ Crc_Slice16[ 2 ][ ( Crc & 0xFFu ) ^ Data[ 1 ] ] ^ Crc_Slice16[ 1 ][ Data[ 2 ] ] ^ Crc_Slice16[ 0 ][ Data[ 3 ] ];
+        Data += 4u;
+    }
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        Crc = (uint16)( Crc << 8u ) ^ Crc_Slice16[ 0 ][ ( Crc >> 8u ) ^ Data[ i ] ];
+    }
+#endif
+
+    return Crc;
+}
+
+/**
+ * @brief   **32 bit IEEE 802.3 CRC Calculation**
+ *
+ * This service makes a CRC32 calculation on Crc_Length data bytes, with IEEE 802.3 parameters.
+ * Polynomial 0x04C11DB7 (processed reflected), initial value 0xFFFFFFFF and final xor value
+ * 0xFFFFFFFF.
+ *
+ * **Example:**
+ *      @code
+ *      Crc = Crc_CalculateCRC32("123456789", 9, 0, TRUE);
+ *      Crc is equal to 0xCBF43926
+ *      @endcode
+ *
+ * @param[in] Crc_DataPtr Pointer to start address of data block to be calculated
+ * @param[in] Crc_Length Length of data block to be calculated in bytes
+ * @param[in] Crc_StartValue32 Start value when the algorithm starts, the result of the previous call
+ * @param[in] Crc_IsFirstCall TRUE: first call in a sequence or individual CRC calculation, start
+ *            from the initial value and ignore Crc_StartValue32. FALSE: subsequent call in a sequence
+ *
+ * @retval 32 bit result of CRC calculation
+ */
+uint32 Crc_CalculateCRC32( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_StartValue32, boolean Crc_IsFirstCall )
+{
+    uint32 Crc        = ( Crc_IsFirstCall == TRUE ) ? CRC_32_INITIAL_VALUE : ( Crc_StartValue32 ^ CRC_32_XOR_VALUE );
+    const uint8 *Data = Crc_DataPtr;
+    uint32 Length     = Crc_Length;
+
+#if ( CRC_32_MODE == CRC_32_HARDWARE )
+    /*the unit works with the polynomial not reflected, reflect the input and output instead*/
+    Crc = Crc_HwCalculate( CRC_HW_CR_POLYSIZE_32 | CRC_HW_CR_REV_IN_BYTE | REG_CRC_CR_REV_OUT, CRC_32_POLYNOMIAL, Crc_Reflect32( Crc ), Data, Length );
+#elif ( CRC_32_MODE == CRC_32_RUNTIME )
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        Crc ^= Data[ i ];
+        for( uint8 Bit = 0u; Bit < 8u; Bit++ )
+        {
+            Crc = ( ( Crc & 1u ) != 0u ) ? ( ( Crc >> 1u ) ^ CRC_32_REFLECTED ) : ( Crc >> 1u );
+        }
+    }
+#elif ( CRC_32_MODE == CRC_32_TABLE )
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        Crc = ( Crc >> 8u ) ^ Crc_Table32[ ( Crc ^ Data[ i ] ) & 0xFFu ];
+    }
+#elif ( CRC_32_MODE == CRC_32_SLICE4 )
+    for( ; Length >= 4u; Length -= 4u )
+    {
+        Crc ^= (uint32)Data[ 0 ] | ( (uint32)Data[ 1 ] << 8u ) | ( (uint32)Data[ 2 ] << 16u ) | ( (uint32)Data[ 3 ] << 24u );
+        Crc = Crc_Slice32[ 3 ][ Crc & 0xFFu ] ^ Crc_Slice32[ 2 ][ ( Crc >> 8u ) & 0xFFu ] ^ Crc_Slice32[ 1 ][ ( Crc >> 16u ) & 0xFFu ] ^ Crc_Slice32[ 0 ][ Crc >> 24u ];
+        Data += 4u;
+    }
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        Crc = ( Crc >> 8u ) ^ Crc_Slice32[ 0 ][ ( Crc ^ Data[ i ] ) & 0xFFu ];
+    }
+#endif
+
+    return Crc ^ CRC_32_XOR_VALUE;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file    Crc.h
+ * @brief   **Specification of CRC Routines**
+ *
+ * The CRC library contains the functions for CRC calculation used to check the integrity of the
+ * data exchanged by the application, like the E2E protection of messages. Each CRC can be computed
+ * at runtime, with a lookup table, with slicing by 4 tables or with the CRC hardware unit of the
+ * stm32g0xx, the option is selected per polynomial in Crc_Cfg.h.
+ *
+ * The hardware option uses a single peripheral and it is not re-entrant, the software options are.
+ */
+#ifndef CRC_H
+#define CRC_H
+
+#include "Std_Types.h"
+
+/**
+ * @name    crc_modes
+ * Implementation options for each CRC, the SLICE4 options are an extension to the AUTOSAR
+ * specification
+ */
+/**@{*/
+#define CRC_8_HARDWARE  0u /*!< CRC8 calculated by the CRC hardware unit */
+#define CRC_8_RUNTIME   1u /*!< CRC8 calculated bit by bit */
+#define CRC_8_TABLE     2u /*!< CRC8 calculated with a 256 bytes table */
+#define CRC_8_SLICE4    3u /*!< CRC8 calculated with four 256 bytes tables */
+#define CRC_16_HARDWARE 0u /*!< CRC16 calculated by the CRC hardware unit */
+#define CRC_16_RUNTIME  1u /*!< CRC16 calculated bit by bit */
+#define CRC_16_TABLE    2u /*!< CRC16 calculated with a 512 bytes table */
+#define CRC_16_SLICE4   3u /*!< CRC16 calculated with four 512 bytes tables */
+#define CRC_32_HARDWARE 0u /*!< CRC32 calculated by the CRC hardware unit */
+#define CRC_32_RUNTIME  1u /*!< CRC32 calculated bit by bit */
+#define CRC_32_TABLE    2u /*!< CRC32 calculated with a 1 Kbyte table */
+#define CRC_32_SLICE4   3u /*!< CRC32 calculated with four 1 Kbyte tables */
+/**@}*/
+
+#include "Crc_Cfg.h"
+
+uint8 Crc_CalculateCRC8( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 Crc_StartValue8, boolean Crc_IsFirstCall );
+uint16 Crc_CalculateCRC16( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint16 Crc_StartValue16, boolean Crc_IsFirstCall );
+uint32 Crc_CalculateCRC32( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_StartValue32, boolean Crc_IsFirstCall );
+
+#endif /* CRC_H */
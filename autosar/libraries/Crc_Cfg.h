@@ -0,0 +1,33 @@
+/**
+ * @file    Crc_Cfg.h
+ * @brief   **Crc Library Configuration**
+ *
+ * Selects the implementation used for each CRC, runtime (bitwise, no tables), table (256 entries),
+ * slicing by 4 (four 256 entries tables, four bytes per iteration) or the CRC hardware unit. Each
+ * option trades flash for throughput, the values can be overridden from the compiler command line.
+ */
+#ifndef CRC_CFG_H
+#define CRC_CFG_H
+
+/**
+ * @brief   Implementation of the 8 bit SAE J1850 CRC
+ */
+#ifndef CRC_8_MODE
+#define CRC_8_MODE  CRC_8_TABLE
+#endif
+
+/**
+ * @brief   Implementation of the 16 bit CCITT CRC
+ */
+#ifndef CRC_16_MODE
+#define CRC_16_MODE CRC_16_TABLE
+#endif
+
+/**
+ * @brief   Implementation of the 32 bit IEEE 802.3 CRC
+ */
+#ifndef CRC_32_MODE
+#define CRC_32_MODE CRC_32_TABLE
+#endif
+
+#endif /* CRC_CFG_H */
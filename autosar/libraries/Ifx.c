@@ -0,0 +1,433 @@
+/**
+ * @file    Ifx.c
+ * @brief   **Interpolation Routines**
+ *
+ * Implementation of the distributed point searches and the curve and map interpolations. The axis
+ * points shall be strictly increasing. The segment ratio needs a division and the weighting a 32x16
+ * bit product with a result over 32 bits, both are done with the Mfx routines since the Cortex-M0+
+ * has no hardware divider and no long multiply.
+ */
+#include "Ifx.h"
+#include "Mfx.h"
+
+/**
+ * @brief   **Limit the input to the axis ends**
+ *
+ * @param[out] dpResult Search result, the index is written only when the input is out of the axis
+ * @param[in] Xin Input value
+ * @param[in] N Number of axis points
+ * @param[in] X_array Axis points
+ *
+ * @retval TRUE when the input is at or out of the axis ends and the search is done
+ */
+static boolean Ifx_Limit( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N, const sint16 *X_array )
+{
+    boolean Done = TRUE;
+
+    dpResult->Ratio = 0u;
+
+    if( Xin <= X_array[ 0 ] )
+    {
+        dpResult->Index = 0u;
+    }
+    else if( Xin >= X_array[ N - 1u ] )
+    {
+        dpResult->Index = N - 1u;
+    }
+    else
+    {
+        Done = FALSE;
+    }
+
+    return Done;
+}
+
+/**
+ * @brief   **Ratio of the input inside a segment**
+ *
+ * @param[out] dpResult Search result to complete
+ * @param[in] Xin Input value, inside the segment
+ * @param[in] Index Index of the axis point at the beginning of the segment
+ * @param[in] X_array Axis points
+ */
+static void Ifx_Ratio( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 Index, const sint16 *X_array )
+{
+    uint32 Offset = (uint32)( (sint32)Xin - (sint32)X_array[ Index ] );
+    uint32 Width  = (uint32)( (sint32)X_array[ Index + 1u ] - (sint32)X_array[ Index ] );
+
+    dpResult->Index = Index;
+    dpResult->Ratio = (uint16)Mfx_Div_u32u32_u32( Offset << 16u, Width );
+}
+
+/**
+ * @brief   **Weight two values by a ratio**
+ *
+ * @param[in] Start Value at the beginning of the segment
+ * @param[in] End Value at the end of the segment
+ * @param[in] Ratio Position inside the segment scaled by 2^16
+ *
+ * @retval Value interpolated between Start and End rounded to the nearest
+ */
+static sint32 Ifx_Weight( sint32 Start, sint32 End, uint16 Ratio )
+{
+    return Start + Mfx_RMulShRight_s32s32u8_s32( End - Start, (sint32)Ratio, 16u );
+}
+
+/**
+ * @brief   **Interpolate along a curve**
+ *
+ * @param[in] dpResult Search result over the curve axis
+ * @param[in] Val_array Curve values
+ *
+ * @retval Interpolated value, the next value is not read when the ratio is zero
+ */
+static sint32 Ifx_Curve( const Ifx_DPResultU16Type *dpResult, const sint16 *Val_array )
+{
+    sint32 Result = Val_array[ dpResult->Index ];
+
+    if( dpResult->Ratio != 0u )
+    {
+        Result = Ifx_Weight( Result, Val_array[ dpResult->Index + 1u ], dpResult->Ratio );
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **Distributed point search**
+ *
+ * Finds the axis segment holding the input by bisection, with log2(N) comparisons regardless of
+ * the input. Inputs out of the axis give the index of the closest end and a ratio of zero
+ *
+ * **Example:**
+ *      @code
+ *      X_array = { 0, 10, 20, 40 }
+ *      Ifx_DPSearch_s16(&dpResult, 25, 4, X_array);
+ *      dpResult.Index is equal to 2 and dpResult.Ratio is equal to 0x4000
+ *      @endcode
+ *
+ * @param[out] dpResult Index and ratio of the input
+ * @param[in] Xin Input value
+ * @param[in] N Number of axis points, at least 2
+ * @param[in] X_array Axis points, strictly increasing
+ */
+void Ifx_DPSearch_s16( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N, const sint16 *X_array )
+{
+    uint32 Low  = 0u;
+    uint32 High = N - 1u;
+    uint32 Middle;
+
+    if( Ifx_Limit( dpResult, Xin, N, X_array ) == FALSE )
+    {
+        /*X_array[ Low ] <= Xin < X_array[ High ] holds on every step*/
+        while( ( High - Low ) > 1u )
+        {
+            Middle = ( Low + High ) >> 1u;
+            if( X_array[ Middle ] <= Xin )
+            {
+                Low = Middle;
+            }
+            else
+            {
+                High = Middle;
+            }
+        }
+
+        Ifx_Ratio( dpResult, Xin, (uint16)Low, X_array );
+    }
+}
+
+/**
+ * @brief   **Distributed point linear search**
+ *
+ * Finds the axis segment holding the input walking the axis from the first point, cheaper than the
+ * bisection for short axes. Inputs out of the axis give the index of the closest end and a ratio
+ * of zero
+ *
+ * **Example:**
+ *      @code
+ *      X_array = { 0, 10, 20, 40 }
+ *      Ifx_DPSearchLinear_s16(&dpResult, 25, 4, X_array);
+ *      dpResult.Index is equal to 2 and dpResult.Ratio is equal to 0x4000
+ *      @endcode
+ *
+ * @param[out] dpResult Index and ratio of the input
+ * @param[in] Xin Input value
+ * @param[in] N Number of axis points, at least 2
+ * @param[in] X_array Axis points, strictly increasing
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+void Ifx_DPSearchLinear_s16( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N, const sint16 *X_array )
+{
+    uint16 Index = 0u;
+
+    if( Ifx_Limit( dpResult, Xin, N, X_array ) == FALSE )
+    {
+        while( X_array[ Index + 1u ] <= Xin )
+        {
+            Index++;
+        }
+
+        Ifx_Ratio( dpResult, Xin, Index, X_array );
+    }
+}
+
+/**
+ * @brief   **Distributed point cached search**
+ *
+ * Finds the axis segment holding the input walking the axis from the segment found in the previous
+ * call, taken from dpResult. When the input changes slowly between calls the segment is the same
+ * or a neighbour and the search takes one or two comparisons. Inputs out of the axis give the
+ * index of the closest end and a ratio of zero
+ *
+ * **Example:**
+ *      @code
+ *      X_array = { 0, 10, 20, 40 }
+ *      dpResult.Index is equal to 1 from the previous call
+ *      Ifx_DPSearchCached_s16(&dpResult, 25, 4, X_array);
+ *      dpResult.Index is equal to 2 and dpResult.Ratio is equal to 0x4000
+ *      @endcode
+ *
+ * @param[in,out] dpResult Previous index as input, index and ratio of the input as output. Shall
+ *                be zero initialised before the first call
+ * @param[in] Xin Input value
+ * @param[in] N Number of axis points, at least 2
+ * @param[in] X_array Axis points, strictly increasing
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+void Ifx_DPSearchCached_s16( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N, const sint16 *X_array )
+{
+    uint16 Index = ( dpResult->Index < ( N - 1u ) ) ? dpResult->Index : ( N - 2u );
+
+    if( Ifx_Limit( dpResult, Xin, N, X_array ) == FALSE )
+    {
+        while( Xin < X_array[ Index ] )
+        {
+            Index--;
+        }
+        while( X_array[ Index + 1u ] <= Xin )
+        {
+            Index++;
+        }
+
+        Ifx_Ratio( dpResult, Xin, Index, X_array );
+    }
+}
+
+/**
+ * @brief   **Distributed point search over a fixed power of two interval axis**
+ *
+ * The axis points are Offset + i * 2^Shift, the segment and ratio are calculated directly from
+ * the input with a shift and a mask, no axis table is needed. Inputs out of the axis give the
+ * index of the closest end and a ratio of zero
+ *
+ * **Example:**
+ *      @code
+ *      Ifx_DPSearchFix_s16(&dpResult, 100, 8, 50, 4);
+ *      dpResult.Index is equal to 3 and dpResult.Ratio is equal to 0x2000
+ *      @endcode
+ *
+ * @param[out] dpResult Index and ratio of the input
+ * @param[in] Xin Input value
+ * @param[in] N Number of axis points, at least 2
+ * @param[in] Offset First axis point
+ * @param[in] Shift Interval between axis points as a power of two, from 0 to 15
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+void Ifx_DPSearchFix_s16( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N, sint16 Offset, uint8 Shift )
+{
+    sint32 Delta = (sint32)Xin - (sint32)Offset;
+    uint32 Index;
+
+    dpResult->Index = 0u;
+    dpResult->Ratio = 0u;
+
+    if( Delta > 0 )
+    {
+        Index = (uint32)Delta >> Shift;
+        if( Index >= ( N - 1u ) )
+        {
+            dpResult->Index = N - 1u;
+        }
+        else
+        {
+            dpResult->Index = (uint16)Index;
+            dpResult->Ratio = (uint16)( ( (uint32)Delta & ( ( 1u << Shift ) - 1u ) ) << ( 16u - Shift ) );
+        }
+    }
+}
+
+/**
+ * @brief   **Distributed point search over a fixed interval axis**
+ *
+ * The axis points are Offset + i * Interval, the segment and ratio are calculated directly from
+ * the input with two divisions, no axis table is needed. Inputs out of the axis give the index of
+ * the closest end and a ratio of zero
+ *
+ * **Example:**
+ *      @code
+ *      Ifx_DPSearchFixI_s16(&dpResult, 250, 8, 0, 100);
+ *      dpResult.Index is equal to 2 and dpResult.Ratio is equal to 0x8000
+ *      @endcode
+ *
+ * @param[out] dpResult Index and ratio of the input
+ * @param[in] Xin Input value
+ * @param[in] N Number of axis points, at least 2
+ * @param[in] Offset First axis point
+ * @param[in] Interval Distance between axis points, different than zero
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+void Ifx_DPSearchFixI_s16( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N, sint16 Offset, uint16 Interval )
+{
+    sint32 Delta = (sint32)Xin - (sint32)Offset;
+    uint32 Index;
+    uint32 Remainder;
+
+    dpResult->Index = 0u;
+    dpResult->Ratio = 0u;
+
+    if( Delta > 0 )
+    {
+        Index = Mfx_Div_u32u32_u32( (uint32)Delta, Interval );
+        if( Index >= ( N - 1u ) )
+        {
+            dpResult->Index = N - 1u;
+        }
+        else
+        {
+            Remainder       = (uint32)Delta - ( Index * Interval );
+            dpResult->Index = (uint16)Index;
+            dpResult->Ratio = (uint16)Mfx_Div_u32u32_u32( Remainder << 16u, Interval );
+        }
+    }
+}
+
+/**
+ * @brief   **Curve interpolation**
+ *
+ * Interpolates the curve values at the segment and ratio given by a distributed point search, the
+ * result is rounded to the nearest
+ *
+ * **Example:**
+ *      @code
+ *      Val_array = { 100, 200, 400, 0 }
+ *      dpResult.Index is equal to 2 and dpResult.Ratio is equal to 0x4000
+ *      Res = Ifx_IpoCur_s16(&dpResult, Val_array);
+ *      Res is equal to 300
+ *      @endcode
+ *
+ * @param[in] dpResult Index and ratio of the input
+ * @param[in] Val_array Curve values, one per axis point
+ *
+ * @retval Interpolated value
+ */
+sint16 Ifx_IpoCur_s16( const Ifx_DPResultU16Type *dpResult, const sint16 *Val_array )
+{
+    return (sint16)Ifx_Curve( dpResult, Val_array );
+}
+
+/**
+ * @brief   **Map interpolation**
+ *
+ * Interpolates the map values at the segments and ratios given by a distributed point search on
+ * each axis, first along the Y axis on the two rows around the input and then between the rows.
+ * The values are stored row by row, one row per X axis point
+ *
+ * **Example:**
+ *      @code
+ *      Val_array = { 0, 100,
+ *                    200, 300 }
+ *      dpResultX.Index is equal to 0 and dpResultX.Ratio is equal to 0x8000
+ *      dpResultY.Index is equal to 0 and dpResultY.Ratio is equal to 0x8000
+ *      Res = Ifx_IpoMap_s16(&dpResultX, &dpResultY, 2, Val_array);
+ *      Res is equal to 150
+ *      @endcode
+ *
+ * @param[in] dpResultX Index and ratio of the input over the X axis
+ * @param[in] dpResultY Index and ratio of the input over the Y axis
+ * @param[in] num_value Number of Y axis points, the length of a row
+ * @param[in] Val_array Map values
+ *
+ * @retval Interpolated value
+ */
+sint16 Ifx_IpoMap_s16( const Ifx_DPResultU16Type *dpResultX, const Ifx_DPResultU16Type *dpResultY, uint16 num_value, const sint16 *Val_array )
+{
+    const sint16 *Row = &Val_array[ (uint32)dpResultX->Index * num_value ];
+    sint32 Result     = Ifx_Curve( dpResultY, Row );
+
+    if( dpResultX->Ratio != 0u )
+    {
+        Result = Ifx_Weight( Result, Ifx_Curve( dpResultY, &Row[ num_value ] ), dpResultX->Ratio );
+    }
+
+    return (sint16)Result;
+}
+
+/**
+ * @brief   **Integrated curve interpolation**
+ *
+ * Searches the input in the curve axis by bisection and interpolates the curve values
+ *
+ * **Example:**
+ *      @code
+ *      X_array = { 0, 10, 20, 40 }
+ *      Val_array = { 100, 200, 400, 0 }
+ *      Res = Ifx_IntIpoCur_s16_s16(25, 4, X_array, Val_array);
+ *      Res is equal to 300
+ *      @endcode
+ *
+ * @param[in] Xin Input value
+ * @param[in] N Number of axis points, at least 2
+ * @param[in] X_array Axis points, strictly increasing
+ * @param[in] Val_array Curve values, one per axis point
+ *
+ * @retval Interpolated value
+ */
+sint16 Ifx_IntIpoCur_s16_s16( sint16 Xin, uint16 N, const sint16 *X_array, const sint16 *Val_array )
+{
+    Ifx_DPResultU16Type dpResult;
+
+    Ifx_DPSearch_s16( &dpResult, Xin, N, X_array );
+
+    return (sint16)Ifx_Curve( &dpResult, Val_array );
+}
+
+/**
+ * @brief   **Integrated map interpolation**
+ *
+ * Searches the inputs in the map axes by bisection and interpolates the map values
+ *
+ * **Example:**
+ *      @code
+ *      X_array = { 0, 10 }
+ *      Y_array = { 0, 100 }
+ *      Val_array = { 0, 100,
+ *                    200, 300 }
+ *      Res = Ifx_IntIpoMap_s16s16_s16(5, 50, 2, 2, X_array, Y_array, Val_array);
+ *      Res is equal to 150
+ *      @endcode
+ *
+ * @param[in] Xin X axis input value
+ * @param[in] Yin Y axis input value
+ * @param[in] Nx Number of X axis points, at least 2
+ * @param[in] Ny Number of Y axis points, at least 2
+ * @param[in] X_array X axis points, strictly increasing
+ * @param[in] Y_array Y axis points, strictly increasing
+ * @param[in] Val_array Map values, Nx rows of Ny values
+ *
+ * @retval Interpolated value
+ */
+sint16 Ifx_IntIpoMap_s16s16_s16( sint16 Xin, sint16 Yin, uint16 Nx, uint16 Ny, const sint16 *X_array, const sint16 *Y_array, const sint16 *Val_array )
+{
+    Ifx_DPResultU16Type dpResultX;
+    Ifx_DPResultU16Type dpResultY;
+
+    Ifx_DPSearch_s16( &dpResultX, Xin, Nx, X_array );
+    Ifx_DPSearch_s16( &dpResultY, Yin, Ny, Y_array );
+
+    return Ifx_IpoMap_s16( &dpResultX, &dpResultY, Ny, Val_array );
+}
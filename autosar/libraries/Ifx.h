@@ -0,0 +1,43 @@
+/**
+ * @file    Ifx.h
+ * @brief   **Specification of Interpolation Routines**
+ *
+ * The Ifx library contains the routines to look up calibration curves and maps. A lookup is split
+ * in two steps, the distributed point search finds the axis segment that holds the input and the
+ * ratio of the input inside it, and the interpolation weights the segment values with that ratio.
+ * The search is available in four flavours so each axis can use the fastest one:
+ *
+ * - Binary search, for large axes and inputs that jump around
+ * - Linear search, for short axes where the loop is cheaper than the bisection
+ * - Cached search, starting from the segment found in the previous call, for inputs that change
+ *   slowly between control cycles
+ * - Direct indexing, for equidistant axes described by an offset and an interval
+ *
+ * Inputs below the first axis point or above the last one are limited to the axis ends. All the
+ * routines are re-entrant.
+ */
+#ifndef IFX_H
+#define IFX_H
+
+#include "Std_Types.h"
+
+/**
+ * @brief   Distributed point search result
+ */
+typedef struct Ifx_DPResultU16Type_Tag
+{
+    uint16 Index; /*!< index of the axis point at the beginning of the segment */
+    uint16 Ratio; /*!< position of the input inside the segment scaled by 2^16 */
+} Ifx_DPResultU16Type;
+
+void Ifx_DPSearch_s16( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N, const sint16 *X_array );
+void Ifx_DPSearchLinear_s16( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N, const sint16 *X_array );
+void Ifx_DPSearchCached_s16( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N, const sint16 *X_array );
+void Ifx_DPSearchFix_s16( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N, sint16 Offset, uint8 Shift );
+void Ifx_DPSearchFixI_s16( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N, sint16 Offset, uint16 Interval );
+sint16 Ifx_IpoCur_s16( const Ifx_DPResultU16Type *dpResult, const sint16 *Val_array );
+sint16 Ifx_IpoMap_s16( const Ifx_DPResultU16Type *dpResultX, const Ifx_DPResultU16Type *dpResultY, uint16 num_value, const sint16 *Val_array );
+sint16 Ifx_IntIpoCur_s16_s16( sint16 Xin, uint16 N, const sint16 *X_array, const sint16 *Val_array );
+sint16 Ifx_IntIpoMap_s16s16_s16( sint16 Xin, sint16 Yin, uint16 Nx, uint16 Ny, const sint16 *X_array, const sint16 *Y_array, const sint16 *Val_array );
+
+#endif /* IFX_H */
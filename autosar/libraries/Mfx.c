@@ -0,0 +1,836 @@
+/**
+ * @file    Mfx.c
+ * @brief   **Fixed Point Math Routines**
+ *
+ * Implementation of the fixed point routines. The 32 bit multiplications are split in four 16x16
+ * bit products to get the full 64 bit result with the MULS instruction, and the divisions are done
+ * by shift and subtract skipping the leading zeros of the dividend, so neither the libgcc helpers
+ * nor a hardware divider are needed.
+ */
+#include "Mfx.h"
+#include "Bfx.h"
+
+/**
+ * @brief   **Unsigned 32x32 bit multiplication with 64 bit result**
+ *
+ * @param[in] x_value First factor
+ * @param[in] y_value Second factor
+ * @param[out] High Upper 32 bits of the product
+ * @param[out] Low Lower 32 bits of the product
+ */
+static void Mfx_MulWide( uint32 x_value, uint32 y_value, uint32 *High, uint32 *Low )
+{
+    uint32 LowLow   = ( x_value & 0xFFFFu ) * ( y_value & 0xFFFFu );
+    uint32 HighLow  = ( x_value >> 16u ) * ( y_value & 0xFFFFu );
+    uint32 LowHigh  = ( x_value & 0xFFFFu ) * ( y_value >> 16u );
+    uint32 HighHigh = ( x_value >> 16u ) * ( y_value >> 16u );
+    uint32 Cross    = ( LowLow >> 16u ) + ( HighLow & 0xFFFFu ) + ( LowHigh & 0xFFFFu );
+
+    *Low  = ( Cross << 16u ) | ( LowLow & 0xFFFFu );
+    *High = HighHigh + ( HighLow >> 16u ) + ( LowHigh >> 16u ) + ( Cross >> 16u );
+}
+
+/**
+ * @brief   **Signed 32x32 bit multiplication with 64 bit result**
+ *
+ * @param[in] x_value First factor
+ * @param[in] y_value Second factor
+ * @param[out] High Upper 32 bits of the product in two's complement
+ * @param[out] Low Lower 32 bits of the product
+ */
+static void Mfx_MulWideSigned( sint32 x_value, sint32 y_value, uint32 *High, uint32 *Low )
+{
+    uint32 x_abs = ( x_value < 0 ) ? ( 0u - (uint32)x_value ) : (uint32)x_value;
+    uint32 y_abs = ( y_value < 0 ) ? ( 0u - (uint32)y_value ) : (uint32)y_value;
+
+    Mfx_MulWide( x_abs, y_abs, High, Low );
+
+    if( ( x_value ^ y_value ) < 0 )
+    {
+        /*negate the 64 bit product, the carry of the lower word only happens when it is zero*/
+        *Low  = 0u - *Low;
+        *High = ( *Low == 0u ) ? ( 0u - *High ) : ~*High;
+    }
+}
+
+/**
+ * @brief   **Unsigned 64/32 bit division**
+ *
+ * The dividend upper word must be lower than the divisor, so the quotient fits in 32 bits. When the
+ * upper word is zero only the quotient bits below the difference of leading zeros between dividend
+ * and divisor are calculated, the ones above are zero for sure.
+ *
+ * @param[in] High Upper 32 bits of the dividend
+ * @param[in] Low Lower 32 bits of the dividend
+ * @param[in] Divisor Divisor, different than zero
+ * @param[out] Remainder Remainder of the division
+ *
+ * @retval Quotient of the division
+ */
+static uint32 Mfx_DivWide( uint32 High, uint32 Low, uint32 Divisor, uint32 *Remainder )
+{
+    uint32 Quotient = 0u;
+    uint32 Carry;
+    uint8 Bits      = 32u;
+
+    if( High == 0u )
+    {
+        if( Low < Divisor )
+        {
+            /*the dividend is the remainder, no quotient bit to calculate*/
+            High = Low;
+            Bits = 0u;
+        }
+        else
+        {
+            Bits = ( Bfx_CountLeadingZeros_u32( Divisor ) - Bfx_CountLeadingZeros_u32( Low ) ) + 1u;
+            if( Bits < 32u )
+            {
+                High = Low >> Bits;
+                Low <<= ( 32u - Bits );
+            }
+        }
+    }
+
+    for( ; Bits > 0u; Bits-- )
+    {
+        Carry = High >> 31u;
+        High  = ( High << 1u ) | ( Low >> 31u );
+        Low <<= 1u;
+        Quotient <<= 1u;
+
+        if( ( Carry != 0u ) || ( High >= Divisor ) )
+        {
+            High -= Divisor;
+            Quotient |= 1u;
+        }
+    }
+
+    *Remainder = High;
+    return Quotient;
+}
+
+/**
+ * @brief   **Saturate a 64 bit value to 32 bits**
+ *
+ * @param[in] High Upper 32 bits of the value in two's complement
+ * @param[in] Low Lower 32 bits of the value
+ *
+ * @retval Value limited to INT32_MIN and INT32_MAX
+ */
+static sint32 Mfx_SatWide( uint32 High, uint32 Low )
+{
+    sint32 Result = (sint32)Low;
+
+    if( High != (uint32)( Result >> 31 ) )
+    {
+        Result = ( (sint32)High < 0 ) ? INT32_MIN : INT32_MAX;
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **Apply a sign to a magnitude with saturation**
+ *
+ * @param[in] Magnitude Absolute value of the result
+ * @param[in] Negative TRUE if the result is negative
+ *
+ * @retval Signed value limited to INT32_MIN and INT32_MAX
+ */
+static sint32 Mfx_SatSign( uint32 Magnitude, boolean Negative )
+{
+    sint32 Result;
+
+    if( Negative == TRUE )
+    {
+        Result = ( Magnitude >= 0x80000000u ) ? INT32_MIN : -(sint32)Magnitude;
+    }
+    else
+    {
+        Result = ( Magnitude > (uint32)INT32_MAX ) ? INT32_MAX : (sint32)Magnitude;
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **64 bit arithmetic shift to the right**
+ *
+ * @param[in,out] High Upper 32 bits of the value
+ * @param[in,out] Low Lower 32 bits of the value
+ * @param[in] shift Number of bits to shift, from 0 to 63
+ */
+static void Mfx_ShiftWide( uint32 *High, uint32 *Low, uint8 shift )
+{
+    if( shift >= 32u )
+    {
+        *Low  = (uint32)( (sint32)*High >> ( shift - 32u ) );
+        *High = (uint32)( (sint32)*High >> 31u );
+    }
+    else if( shift > 0u )
+    {
+        *Low  = ( *Low >> shift ) | ( *High << ( 32u - shift ) );
+        *High = (uint32)( (sint32)*High >> shift );
+    }
+}
+
+/**
+ * @brief   **64 bit product shifted to the right with saturation**
+ *
+ * The rounding shifts one bit less, adds one and shifts the last bit out, so the one is added to
+ * the last bit shifted out instead of the top of the product, where 2^62 plus half of 2^63 would
+ * overflow the signed 64 bit value.
+ *
+ * @param[in] x_value First factor
+ * @param[in] y_value Second factor
+ * @param[in] shift Number of bits to shift the product, from 0 to 63
+ * @param[in] Round TRUE to round the result to the nearest, FALSE to truncate toward minus infinity
+ *
+ * @retval Shifted product limited to INT32_MIN and INT32_MAX
+ */
+static sint32 Mfx_MulShift( sint32 x_value, sint32 y_value, uint8 shift, boolean Round )
+{
+    uint32 High;
+    uint32 Low;
+
+    Mfx_MulWideSigned( x_value, y_value, &High, &Low );
+    shift &= 63u;
+
+    if( ( Round == TRUE ) && ( shift > 0u ) )
+    {
+        Mfx_ShiftWide( &High, &Low, shift - 1u );
+        Low += 1u;
+        High += ( Low == 0u ) ? 1u : 0u;
+        Mfx_ShiftWide( &High, &Low, 1u );
+    }
+    else
+    {
+        Mfx_ShiftWide( &High, &Low, shift );
+    }
+
+    return Mfx_SatWide( High, Low );
+}
+
+/**
+ * @brief   **16 bit Saturated Addition**
+ *
+ * Adds the two values and limits the result to the range of the 16 bit signed type
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Add_s16s16_s16(30000, 10000);
+ *      Res is equal to 32767
+ *      @endcode
+ *
+ * @param[in] x_value First summand
+ * @param[in] y_value Second summand
+ *
+ * @retval Saturated sum
+ */
+sint16 Mfx_Add_s16s16_s16( sint16 x_value, sint16 y_value )
+{
+    sint32 Result = (sint32)x_value + (sint32)y_value;
+
+    if( Result > INT16_MAX )
+    {
+        Result = INT16_MAX;
+    }
+    else if( Result < INT16_MIN )
+    {
+        Result = INT16_MIN;
+    }
+
+    return (sint16)Result;
+}
+
+/**
+ * @brief   **32 bit Saturated Addition**
+ *
+ * Adds the two values and limits the result to the range of the 32 bit signed type, the addition
+ * overflows only when both values have the same sign and the result has the opposite one
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Add_s32s32_s32(-2000000000, -2000000000);
+ *      Res is equal to -2147483648
+ *      @endcode
+ *
+ * @param[in] x_value First summand
+ * @param[in] y_value Second summand
+ *
+ * @retval Saturated sum
+ */
+sint32 Mfx_Add_s32s32_s32( sint32 x_value, sint32 y_value )
+{
+    sint32 Result = (sint32)( (uint32)x_value + (uint32)y_value );
+
+    if( ( ( x_value ^ Result ) & ( y_value ^ Result ) ) < 0 )
+    {
+        Result = ( x_value < 0 ) ? INT32_MIN : INT32_MAX;
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **32 bit Unsigned Saturated Addition**
+ *
+ * Adds the two values and limits the result to the range of the 32 bit unsigned type
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Add_u32u32_u32(0xF0000000, 0x20000000);
+ *      Res is equal to 0xFFFFFFFF
+ *      @endcode
+ *
+ * @param[in] x_value First summand
+ * @param[in] y_value Second summand
+ *
+ * @retval Saturated sum
+ */
+uint32 Mfx_Add_u32u32_u32( uint32 x_value, uint32 y_value )
+{
+    uint32 Result = x_value + y_value;
+
+    return ( Result < x_value ) ? UINT32_MAX : Result;
+}
+
+/**
+ * @brief   **16 bit Saturated Subtraction**
+ *
+ * Subtracts the second value from the first and limits the result to the range of the 16 bit
+ * signed type
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Sub_s16s16_s16(-30000, 10000);
+ *      Res is equal to -32768
+ *      @endcode
+ *
+ * @param[in] x_value Minuend
+ * @param[in] y_value Subtrahend
+ *
+ * @retval Saturated difference
+ */
+sint16 Mfx_Sub_s16s16_s16( sint16 x_value, sint16 y_value )
+{
+    sint32 Result = (sint32)x_value - (sint32)y_value;
+
+    if( Result > INT16_MAX )
+    {
+        Result = INT16_MAX;
+    }
+    else if( Result < INT16_MIN )
+    {
+        Result = INT16_MIN;
+    }
+
+    return (sint16)Result;
+}
+
+/**
+ * @brief   **32 bit Saturated Subtraction**
+ *
+ * Subtracts the second value from the first and limits the result to the range of the 32 bit
+ * signed type, the subtraction overflows only when the values have different sign and the result
+ * sign is not the one of the minuend
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Sub_s32s32_s32(2000000000, -2000000000);
+ *      Res is equal to 2147483647
+ *      @endcode
+ *
+ * @param[in] x_value Minuend
+ * @param[in] y_value Subtrahend
+ *
+ * @retval Saturated difference
+ */
+sint32 Mfx_Sub_s32s32_s32( sint32 x_value, sint32 y_value )
+{
+    sint32 Result = (sint32)( (uint32)x_value - (uint32)y_value );
+
+    if( ( ( x_value ^ y_value ) & ( x_value ^ Result ) ) < 0 )
+    {
+        Result = ( x_value < 0 ) ? INT32_MIN : INT32_MAX;
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **32 bit Unsigned Saturated Subtraction**
+ *
+ * Subtracts the second value from the first and limits the result to zero
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Sub_u32u32_u32(10, 20);
+ *      Res is equal to 0
+ *      @endcode
+ *
+ * @param[in] x_value Minuend
+ * @param[in] y_value Subtrahend
+ *
+ * @retval Saturated difference
+ */
+uint32 Mfx_Sub_u32u32_u32( uint32 x_value, uint32 y_value )
+{
+    return ( x_value < y_value ) ? 0u : ( x_value - y_value );
+}
+
+/**
+ * @brief   **16 bit Saturated Multiplication**
+ *
+ * Multiplies the two values and limits the result to the range of the 16 bit signed type
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Mul_s16s16_s16(-300, 200);
+ *      Res is equal to -32768
+ *      @endcode
+ *
+ * @param[in] x_value First factor
+ * @param[in] y_value Second factor
+ *
+ * @retval Saturated product
+ */
+sint16 Mfx_Mul_s16s16_s16( sint16 x_value, sint16 y_value )
+{
+    sint32 Result = (sint32)x_value * (sint32)y_value;
+
+    if( Result > INT16_MAX )
+    {
+        Result = INT16_MAX;
+    }
+    else if( Result < INT16_MIN )
+    {
+        Result = INT16_MIN;
+    }
+
+    return (sint16)Result;
+}
+
+/**
+ * @brief   **32 bit Saturated Multiplication**
+ *
+ * Multiplies the two values and limits the result to the range of the 32 bit signed type, the
+ * full 64 bit product is calculated with 16x16 bit partial products
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Mul_s32s32_s32(100000, -100000);
+ *      Res is equal to -2147483648
+ *      @endcode
+ *
+ * @param[in] x_value First factor
+ * @param[in] y_value Second factor
+ *
+ * @retval Saturated product
+ */
+sint32 Mfx_Mul_s32s32_s32( sint32 x_value, sint32 y_value )
+{
+    uint32 High;
+    uint32 Low;
+
+    Mfx_MulWideSigned( x_value, y_value, &High, &Low );
+
+    return Mfx_SatWide( High, Low );
+}
+
+/**
+ * @brief   **32 bit Unsigned Saturated Multiplication**
+ *
+ * Multiplies the two values and limits the result to the range of the 32 bit unsigned type
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Mul_u32u32_u32(0x10000, 0x10000);
+ *      Res is equal to 0xFFFFFFFF
+ *      @endcode
+ *
+ * @param[in] x_value First factor
+ * @param[in] y_value Second factor
+ *
+ * @retval Saturated product
+ */
+uint32 Mfx_Mul_u32u32_u32( uint32 x_value, uint32 y_value )
+{
+    uint32 High;
+    uint32 Low;
+
+    Mfx_MulWide( x_value, y_value, &High, &Low );
+
+    return ( High != 0u ) ? UINT32_MAX : Low;
+}
+
+/**
+ * @brief   **32 bit Saturated Division**
+ *
+ * Divides the first value by the second, the result is rounded toward zero. A division by zero
+ * returns INT32_MAX when the dividend is positive or zero and INT32_MIN when it is negative
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Div_s32s32_s32(-7, 2);
+ *      Res is equal to -3
+ *      @endcode
+ *
+ * @param[in] x_value Dividend
+ * @param[in] y_value Divisor
+ *
+ * @retval Saturated quotient
+ */
+sint32 Mfx_Div_s32s32_s32( sint32 x_value, sint32 y_value )
+{
+    uint32 x_abs = ( x_value < 0 ) ? ( 0u - (uint32)x_value ) : (uint32)x_value;
+    uint32 y_abs = ( y_value < 0 ) ? ( 0u - (uint32)y_value ) : (uint32)y_value;
+    uint32 Remainder;
+    uint32 Quotient;
+    sint32 Result;
+
+    if( y_value == 0 )
+    {
+        Result = ( x_value < 0 ) ? INT32_MIN : INT32_MAX;
+    }
+    else
+    {
+        Quotient = Mfx_DivWide( 0u, x_abs, y_abs, &Remainder );
+        Result   = Mfx_SatSign( Quotient, ( ( x_value ^ y_value ) < 0 ) ? TRUE : FALSE );
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **32 bit Unsigned Saturated Division**
+ *
+ * Divides the first value by the second, the result is rounded toward zero. A division by zero
+ * returns UINT32_MAX
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Div_u32u32_u32(100, 7);
+ *      Res is equal to 14
+ *      @endcode
+ *
+ * @param[in] x_value Dividend
+ * @param[in] y_value Divisor
+ *
+ * @retval Saturated quotient
+ */
+uint32 Mfx_Div_u32u32_u32( uint32 x_value, uint32 y_value )
+{
+    uint32 Remainder;
+    uint32 Result;
+
+    if( y_value == 0u )
+    {
+        Result = UINT32_MAX;
+    }
+    else
+    {
+        Result = Mfx_DivWide( 0u, x_value, y_value, &Remainder );
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **32 bit Saturated Rounded Division**
+ *
+ * Divides the first value by the second, the result is rounded to the nearest and halves are
+ * rounded away from zero. A division by zero returns INT32_MAX when the dividend is positive or
+ * zero and INT32_MIN when it is negative
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_RDiv_s32s32_s32(-7, 2);
+ *      Res is equal to -4
+ *      @endcode
+ *
+ * @param[in] x_value Dividend
+ * @param[in] y_value Divisor
+ *
+ * @retval Saturated quotient
+ */
+sint32 Mfx_RDiv_s32s32_s32( sint32 x_value, sint32 y_value )
+{
+    uint32 x_abs = ( x_value < 0 ) ? ( 0u - (uint32)x_value ) : (uint32)x_value;
+    uint32 y_abs = ( y_value < 0 ) ? ( 0u - (uint32)y_value ) : (uint32)y_value;
+    uint32 Remainder;
+    uint32 Quotient;
+    sint32 Result;
+
+    if( y_value == 0 )
+    {
+        Result = ( x_value < 0 ) ? INT32_MIN : INT32_MAX;
+    }
+    else
+    {
+        Quotient = Mfx_DivWide( 0u, x_abs, y_abs, &Remainder );
+        /*the remainder is at least half of the divisor*/
+        if( Remainder >= ( y_abs - Remainder ) )
+        {
+            Quotient++;
+        }
+        Result = Mfx_SatSign( Quotient, ( ( x_value ^ y_value ) < 0 ) ? TRUE : FALSE );
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **32 bit Saturated Shift Left**
+ *
+ * Shifts the value to the left and limits the result to the range of the 32 bit signed type, the
+ * shift overflows when it is larger than the number of redundant sign bits of the value
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_ShLeft_s32u8_s32(0x20000000, 3);
+ *      Res is equal to 0x7FFFFFFF
+ *      @endcode
+ *
+ * @param[in] x_value Value to shift
+ * @param[in] shift Number of bits to shift
+ *
+ * @retval Saturated shifted value
+ */
+sint32 Mfx_ShLeft_s32u8_s32( sint32 x_value, uint8 shift )
+{
+    sint32 Result = 0;
+
+    if( x_value != 0 )
+    {
+        if( shift > Bfx_CountLeadingSigns_s32( x_value ) )
+        {
+            Result = ( x_value < 0 ) ? INT32_MIN : INT32_MAX;
+        }
+        else
+        {
+            Result = (sint32)( (uint32)x_value << shift );
+        }
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **32 bit Shift Right**
+ *
+ * Shifts the value to the right keeping the sign, the result is rounded toward minus infinity
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_ShRight_s32u8_s32(-5, 1);
+ *      Res is equal to -3
+ *      @endcode
+ *
+ * @param[in] x_value Value to shift
+ * @param[in] shift Number of bits to shift, values above 31 are limited to 31
+ *
+ * @retval Shifted value
+ */
+sint32 Mfx_ShRight_s32u8_s32( sint32 x_value, uint8 shift )
+{
+    return x_value >> ( ( shift > 31u ) ? 31u : shift );
+}
+
+/**
+ * @brief   **32 bit Rounded Shift Right**
+ *
+ * Shifts the value to the right keeping the sign, the result is rounded to the nearest and halves
+ * are rounded toward plus infinity. The last bit shifted out is added to the truncated result
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_RShRight_s32u8_s32(-5, 1);
+ *      Res is equal to -2
+ *      @endcode
+ *
+ * @param[in] x_value Value to shift
+ * @param[in] shift Number of bits to shift
+ *
+ * @retval Shifted value
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+sint32 Mfx_RShRight_s32u8_s32( sint32 x_value, uint8 shift )
+{
+    sint32 Result = 0;
+
+    if( shift == 0u )
+    {
+        Result = x_value;
+    }
+    else if( shift < 32u )
+    {
+        Result = ( x_value >> shift ) + ( ( x_value >> ( shift - 1u ) ) & 1 );
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **32 bit Multiplication and Shift Right**
+ *
+ * Multiplies the two values and shifts the 64 bit product to the right, the result is rounded
+ * toward minus infinity and limited to the range of the 32 bit signed type. Multiplies two values
+ * in Q format, the shift is the number of fractional bits to remove from the product
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_MulShRight_s32s32u8_s32(0x00018000, 0x00028000, 16);
+ *      Res is equal to 0x0003C000, 1.5 * 2.5 = 3.75 in Q16
+ *      @endcode
+ *
+ * @param[in] x_value First factor
+ * @param[in] y_value Second factor
+ * @param[in] shift Number of bits to shift the product, from 0 to 63
+ *
+ * @retval Saturated shifted product
+ */
+sint32 Mfx_MulShRight_s32s32u8_s32( sint32 x_value, sint32 y_value, uint8 shift )
+{
+    return Mfx_MulShift( x_value, y_value, shift, FALSE );
+}
+
+/**
+ * @brief   **32 bit Multiplication and Rounded Shift Right**
+ *
+ * Multiplies the two values and shifts the 64 bit product to the right, the result is rounded to
+ * the nearest with halves rounded toward plus infinity and limited to the range of the 32 bit
+ * signed type
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_RMulShRight_s32s32u8_s32(3, 3, 2);
+ *      Res is equal to 2
+ *      @endcode
+ *
+ * @param[in] x_value First factor
+ * @param[in] y_value Second factor
+ * @param[in] shift Number of bits to shift the product, from 0 to 63
+ *
+ * @retval Saturated shifted product
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+sint32 Mfx_RMulShRight_s32s32u8_s32( sint32 x_value, sint32 y_value, uint8 shift )
+{
+    return Mfx_MulShift( x_value, y_value, shift, TRUE );
+}
+
+/**
+ * @brief   **32 bit Shift Left and Division**
+ *
+ * Shifts the first value to the left as a 64 bit value and divides it by the second, the result is
+ * rounded toward zero and limited to the range of the 32 bit signed type. Divides two values in Q
+ * format, the shift is the number of fractional bits of the quotient. A division by zero returns
+ * INT32_MAX when the dividend is positive or zero and INT32_MIN when it is negative
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_DivShLeft_s32s32u8_s32(0x0003C000, 0x00028000, 16);
+ *      Res is equal to 0x00018000, 3.75 / 2.5 = 1.5 in Q16
+ *      @endcode
+ *
+ * @param[in] x_value Dividend
+ * @param[in] y_value Divisor
+ * @param[in] shift Number of bits to shift the dividend, from 0 to 31
+ *
+ * @retval Saturated quotient
+ */
+sint32 Mfx_DivShLeft_s32s32u8_s32( sint32 x_value, sint32 y_value, uint8 shift )
+{
+    uint32 x_abs = ( x_value < 0 ) ? ( 0u - (uint32)x_value ) : (uint32)x_value;
+    uint32 y_abs = ( y_value < 0 ) ? ( 0u - (uint32)y_value ) : (uint32)y_value;
+    uint32 High  = 0u;
+    uint32 Low;
+    uint32 Remainder;
+    uint32 Quotient;
+    sint32 Result;
+
+    if( y_value == 0 )
+    {
+        Result = ( x_value < 0 ) ? INT32_MIN : INT32_MAX;
+    }
+    else
+    {
+        shift &= 31u;
+        Low = x_abs << shift;
+        if( shift > 0u )
+        {
+            High = x_abs >> ( 32u - shift );
+        }
+
+        /*the quotient does not fit in 32 bits*/
+        if( High >= y_abs )
+        {
+            Quotient = UINT32_MAX;
+        }
+        else
+        {
+            Quotient = Mfx_DivWide( High, Low, y_abs, &Remainder );
+        }
+        Result = Mfx_SatSign( Quotient, ( ( x_value ^ y_value ) < 0 ) ? TRUE : FALSE );
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **16 bit Normalisation**
+ *
+ * Shifts the value to the left until the bit below the sign bit is different than the sign, the
+ * number of bits shifted is the number of redundant sign bits given by Bfx_CountLeadingSigns_s16.
+ * A zero value is returned as zero with a shift of 15
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Norm_s16(0x0300, &Shift);
+ *      Res is equal to 0x6000 and Shift is equal to 5
+ *      @endcode
+ *
+ * @param[in] x_value Value to normalise
+ * @param[out] shift Number of bits the value was shifted
+ *
+ * @retval Normalised value
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+sint16 Mfx_Norm_s16( sint16 x_value, uint8 *shift )
+{
+    *shift = Bfx_CountLeadingSigns_s16( x_value );
+
+    return (sint16)(uint16)( (uint32)(uint16)x_value << *shift );
+}
+
+/**
+ * @brief   **32 bit Normalisation**
+ *
+ * Shifts the value to the left until the bit below the sign bit is different than the sign, the
+ * number of bits shifted is the number of redundant sign bits given by Bfx_CountLeadingSigns_s32.
+ * A zero value is returned as zero with a shift of 31
+ *
+ * **Example:**
+ *      @code
+ *      Res = Mfx_Norm_s32(0xFFFF0000, &Shift);
+ *      Res is equal to 0x80000000 and Shift is equal to 15
+ *      @endcode
+ *
+ * @param[in] x_value Value to normalise
+ * @param[out] shift Number of bits the value was shifted
+ *
+ * @retval Normalised value
+ *
+ * @note   This routine is an extension and it is not part of the AUTOSAR specification
+ */
+sint32 Mfx_Norm_s32( sint32 x_value, uint8 *shift )
+{
+    *shift = Bfx_CountLeadingSigns_s32( x_value );
+
+    return (sint32)( (uint32)x_value << *shift );
+}
@@ -0,0 +1,40 @@
+/**
+ * @file    Mfx.h
+ * @brief   **Specification of Fixed Point Math Routines**
+ *
+ * The Mfx library contains the fixed point arithmetic routines used by the application, additions,
+ * subtractions, multiplications and divisions saturate to the limits of the result type instead of
+ * wrapping around, shifts are available truncated or rounded to the nearest, and Q-format values
+ * are multiplied and divided through the MulShRight and DivShLeft routines.
+ *
+ * The Cortex-M0+ has no hardware divide and only a 32x32 bit multiply with a 32 bit result, the
+ * firmware is linked without libgcc, so the 64 bit products and the divisions are built with 32 bit
+ * operations only. All routines are re-entrant.
+ */
+#ifndef MFX_H
+#define MFX_H
+
+#include "Std_Types.h"
+
+sint16 Mfx_Add_s16s16_s16( sint16 x_value, sint16 y_value );
+sint32 Mfx_Add_s32s32_s32( sint32 x_value, sint32 y_value );
+uint32 Mfx_Add_u32u32_u32( uint32 x_value, uint32 y_value );
+sint16 Mfx_Sub_s16s16_s16( sint16 x_value, sint16 y_value );
+sint32 Mfx_Sub_s32s32_s32( sint32 x_value, sint32 y_value );
+uint32 Mfx_Sub_u32u32_u32( uint32 x_value, uint32 y_value );
+sint16 Mfx_Mul_s16s16_s16( sint16 x_value, sint16 y_value );
+sint32 Mfx_Mul_s32s32_s32( sint32 x_value, sint32 y_value );
+uint32 Mfx_Mul_u32u32_u32( uint32 x_value, uint32 y_value );
+sint32 Mfx_Div_s32s32_s32( sint32 x_value, sint32 y_value );
+uint32 Mfx_Div_u32u32_u32( uint32 x_value, uint32 y_value );
+sint32 Mfx_RDiv_s32s32_s32( sint32 x_value, sint32 y_value );
+sint32 Mfx_ShLeft_s32u8_s32( sint32 x_value, uint8 shift );
+sint32 Mfx_ShRight_s32u8_s32( sint32 x_value, uint8 shift );
+sint32 Mfx_RShRight_s32u8_s32( sint32 x_value, uint8 shift );
+sint32 Mfx_MulShRight_s32s32u8_s32( sint32 x_value, sint32 y_value, uint8 shift );
+sint32 Mfx_RMulShRight_s32s32u8_s32( sint32 x_value, sint32 y_value, uint8 shift );
+sint32 Mfx_DivShLeft_s32s32u8_s32( sint32 x_value, sint32 y_value, uint8 shift );
+sint16 Mfx_Norm_s16( sint16 x_value, uint8 *shift );
+sint32 Mfx_Norm_s32( sint32 x_value, uint8 *shift );
+
+#endif /* MFX_H */
@@ -0,0 +1,55 @@
+/**
+ * @file    Dio.c
+ * @brief   **Dio Driver**
+ *
+ * Reads the GPIO input data registers, the ports are placed every 0x400 bytes starting at the
+ * GPIOA base address.
+ */
+#include "Dio.h"
+#include "Reg_Map.h"
+
+/**
+ * @brief   **Read channel**
+ *
+ * Returns the value of the specified DIO channel.
+ *
+ * @param[in] ChannelId ID of DIO channel, built with DIO_CHANNEL
+ *
+ * @retval STD_HIGH or STD_LOW
+ */
+Dio_LevelType Dio_ReadChannel( Dio_ChannelType ChannelId )
+{
+    uint32 Level = REG_READ( &REG_GPIO( ChannelId >> 4u )->IDR );
+
+    return Bfx_GetBit_u16u8_u8( (Dio_PortLevelType)Level, ChannelId & 0x0Fu ) ? STD_HIGH : STD_LOW;
+}
+
+/**
+ * @brief   **Read port**
+ *
+ * Returns the level of all channels of that port.
+ *
+ * @param[in] PortId ID of DIO Port
+ *
+ * @retval Level of all channels of that port
+ */
+Dio_PortLevelType Dio_ReadPort( Dio_PortType PortId )
+{
+    return (Dio_PortLevelType)REG_READ( &REG_GPIO( PortId )->IDR );
+}
+
+/**
+ * @brief   **Read port snapshot**
+ *
+ * Captures the input data register of every configured port in one pass, each register is read
+ * exactly once so the snapshot is the only hardware access needed per control cycle.
+ *
+ * @param[out] Snapshot Pointer to store the captured ports
+ */
+void Dio_ReadPortSnapshot( Dio_PortSnapshotType *Snapshot )
+{
+    for( Dio_PortType Port = 0u; Port < DIO_NUMBER_OF_PORTS; Port++ )
+    {
+        Snapshot->Port[ Port ] = (Dio_PortLevelType)REG_READ( &REG_GPIO( Port )->IDR );
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ * @file    Dio.h
+ * @brief   **Specification of Dio Driver**
+ *
+ * The Dio driver provides services for reading and writing to/from digital input/output channels
+ * and ports. Besides the single channel and port reads, the input data registers of all the
+ * configured ports can be captured in one pass into a snapshot, the control loop then reads the
+ * hardware once per cycle and works from RAM with the snapshot accessors.
+ */
+#ifndef DIO_H
+#define DIO_H
+
+#include "Std_Types.h"
+#include "Bfx.h"
+#include "Dio_Cfg.h"
+
+/**
+ * @brief   Numeric ID of a DIO channel, the port in the upper nibble and the pin in the lower one
+ */
+typedef uint8 Dio_ChannelType;
+
+/**
+ * @brief   Numeric ID of a DIO port
+ */
+typedef uint8 Dio_PortType;
+
+/**
+ * @brief   Possible levels of a DIO channel, STD_HIGH or STD_LOW
+ */
+typedef uint8 Dio_LevelType;
+
+/**
+ * @brief   Value of a DIO port, bit n corresponds to pin n
+ */
+typedef uint16 Dio_PortLevelType;
+
+/**
+ * @brief   Input levels of all the configured ports captured at once
+ */
+typedef struct Dio_PortSnapshotType_Tag
+{
+    Dio_PortLevelType Port[ DIO_NUMBER_OF_PORTS ]; /*!< input levels indexed by port ID */
+} Dio_PortSnapshotType;
+
+/**
+ * @name    port_ids
+ * GPIO ports available on the stm32g0xx
+ */
+/**@{*/
+#define DIO_PORT_A 0u /*!< GPIOA */
+#define DIO_PORT_B 1u /*!< GPIOB */
+#define DIO_PORT_C 2u /*!< GPIOC */
+#define DIO_PORT_D 3u /*!< GPIOD */
+#define DIO_PORT_E 4u /*!< GPIOE */
+#define DIO_PORT_F 5u /*!< GPIOF */
+/**@}*/
+
+/**
+ * @brief   Build a channel ID from its port and pin
+ */
+#define DIO_CHANNEL( Port, Pin ) ( (Dio_ChannelType)( ( (Port) << 4u ) | (Pin) ) )
+
+Dio_LevelType Dio_ReadChannel( Dio_ChannelType ChannelId );
+Dio_PortLevelType Dio_ReadPort( Dio_PortType PortId );
+void Dio_ReadPortSnapshot( Dio_PortSnapshotType *Snapshot );
+
+/**
+ * @brief   **Read a channel from a snapshot**
+ *
+ * Returns the level of a channel as it was captured by Dio_ReadPortSnapshot, no register is read.
+ *
+ * @param[in] Snapshot Pointer to the captured ports
+ * @param[in] ChannelId Channel to read, built with DIO_CHANNEL
+ *
+ * @retval STD_HIGH or STD_LOW
+ */
+static inline Dio_LevelType Dio_SnapshotReadChannel( const Dio_PortSnapshotType *Snapshot, Dio_ChannelType ChannelId )
+{
+    return Bfx_GetBit_u16u8_u8( Snapshot->Port[ ChannelId >> 4u ], ChannelId & 0x0Fu ) ? STD_HIGH : STD_LOW;
+}
+
+/**
+ * @brief   **Read a port from a snapshot**
+ *
+ * Returns the level of all the pins of a port as they were captured by Dio_ReadPortSnapshot, no
+ * register is read.
+ *
+ * @param[in] Snapshot Pointer to the captured ports
+ * @param[in] PortId Port to read
+ *
+ * @retval Level of the port pins
+ */
+static inline Dio_PortLevelType Dio_SnapshotReadPort( const Dio_PortSnapshotType *Snapshot, Dio_PortType PortId )
+{
+    return Snapshot->Port[ PortId ];
+}
+
+#endif /* DIO_H */
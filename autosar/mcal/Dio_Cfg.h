@@ -0,0 +1,16 @@
+/**
+ * @file    Dio_Cfg.h
+ * @brief   **Dio Driver Configuration**
+ *
+ * Ports handled by the driver, the ports are consecutive starting with port A and all of them are
+ * captured on every snapshot.
+ */
+#ifndef DIO_CFG_H
+#define DIO_CFG_H
+
+/**
+ * @brief   Number of GPIO ports configured, starting with port A
+ */
+#define DIO_NUMBER_OF_PORTS 4u
+
+#endif /* DIO_CFG_H */
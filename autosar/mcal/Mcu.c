@@ -0,0 +1,129 @@
+/**
+ * @file    Mcu.c
+ * @brief   **Mcu Driver**
+ *
+ * The flash needs more wait states the faster the AHB clock runs, so the latency is raised before
+ * the clock switch and lowered after it, and it is read back until the flash interface applies it.
+ * The instruction cache is reset while disabled and then enabled together with the prefetch
+ * buffer. The PLL is configured while stopped and the system clock only switches to it once locked.
+ */
+#include "Mcu.h"
+#include "Reg_Map.h"
+
+/* clang-format off */
+#define MCU_CR_PLLON            0x01000000u     /*!< PLL enable */
+#define MCU_CR_PLLRDY           0x02000000u     /*!< PLL locked */
+#define MCU_CFGR_SW             0x00000007u     /*!< system clock switch */
+#define MCU_CFGR_SW_PLL         0x00000002u     /*!< system clock from PLLRCLK */
+#define MCU_CFGR_SWS            0x00000038u     /*!< system clock switch status */
+#define MCU_CFGR_SWS_PLL        0x00000010u     /*!< system clock running from PLLRCLK */
+#define MCU_CFGR_HPRE           0x00000F00u     /*!< AHB prescaler */
+#define MCU_CFGR_PPRE           0x00007000u     /*!< APB prescaler */
+#define MCU_PLLCFGR_HSI16       0x00000002u     /*!< PLL input from HSI16 */
+#define MCU_PLLCFGR_PLLREN      0x10000000u     /*!< PLLRCLK output enable */
+#define MCU_ACR_LATENCY         0x00000007u     /*!< flash wait states */
+#define MCU_ACR_PRFTEN          0x00000100u     /*!< prefetch buffer enable */
+#define MCU_ACR_ICEN            0x00000200u     /*!< instruction cache enable */
+#define MCU_ACR_ICRST           0x00000800u     /*!< instruction cache reset */
+
+#define MCU_PLLCFGR             ( MCU_PLLCFGR_HSI16 | ( ( MCU_PLL_M - 1u ) << 4u ) | ( MCU_PLL_N << 8u ) | MCU_PLLCFGR_PLLREN | ( ( MCU_PLL_R - 1u ) << 29u ) )
+#define MCU_ACR_CACHE           ( ( ( MCU_FLASH_PREFETCH == STD_ON ) ? MCU_ACR_PRFTEN : 0u ) | ( ( MCU_FLASH_ICACHE == STD_ON ) ? MCU_ACR_ICEN : 0u ) )
+/* clang-format on */
+
+/**
+ * @brief   **Wait for a register field**
+ *
+ * Polls the register until the bits in Mask read as Value, up to MCU_READY_TIMEOUT times.
+ *
+ * @param[in] Register Register to poll
+ * @param[in] Mask Bits to check
+ * @param[in] Value Expected value of the bits
+ *
+ * @retval  E_OK: the bits took the value
+ *          E_NOT_OK: timeout
+ */
+static Std_ReturnType Mcu_WaitFor( const volatile uint32 *Register, uint32 Mask, uint32 Value )
+{
+    Std_ReturnType Status = E_NOT_OK;
+
+    for( uint32 Retry = 0u; ( Retry < MCU_READY_TIMEOUT ) && ( Status == E_NOT_OK ); Retry++ )
+    {
+        Status = ( ( REG_READ( Register ) & Mask ) == Value ) ? E_OK : E_NOT_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Set the flash wait states**
+ *
+ * @param[in] Latency Wait states
+ *
+ * @retval  E_OK: the flash interface applied the latency
+ *          E_NOT_OK: timeout
+ */
+static Std_ReturnType Mcu_SetLatency( uint32 Latency )
+{
+    REG_WRITE( &REG_FLASH->ACR, ( REG_READ( &REG_FLASH->ACR ) & ~MCU_ACR_LATENCY ) | Latency );
+    return Mcu_WaitFor( &REG_FLASH->ACR, MCU_ACR_LATENCY, Latency );
+}
+
+/**
+ * @brief   **Initialise the clock tree**
+ *
+ * Sets the system clock, the AHB and APB prescalers and the flash access as configured in
+ * Mcu_Cfg.h. Shall be called once at startup running from the HSI16 reset clock, before the
+ * peripherals that depend on the clock frequency are initialised. On a PLL lock timeout the core
+ * keeps running from HSI16 with the flash latency already raised, which is safe for any clock.
+ *
+ * @retval  E_OK: clock tree initialised
+ *          E_NOT_OK: the PLL did not lock or the clock did not switch in time
+ */
+Std_ReturnType Mcu_InitClock( void )
+{
+    Std_ReturnType Status;
+    uint32 Latency = REG_READ( &REG_FLASH->ACR ) & MCU_ACR_LATENCY;
+
+    /*raise the wait states before the clock goes faster*/
+    Status = ( MCU_FLASH_LATENCY > Latency ) ? Mcu_SetLatency( MCU_FLASH_LATENCY ) : E_OK;
+
+    /*the cache can only be reset while disabled*/
+    REG_WRITE( &REG_FLASH->ACR, REG_READ( &REG_FLASH->ACR ) & ~( MCU_ACR_ICEN | MCU_ACR_PRFTEN ) );
+    REG_WRITE( &REG_FLASH->ACR, REG_READ( &REG_FLASH->ACR ) | MCU_ACR_ICRST );
+    REG_WRITE( &REG_FLASH->ACR, REG_READ( &REG_FLASH->ACR ) & ~MCU_ACR_ICRST );
+    REG_WRITE( &REG_FLASH->ACR, REG_READ( &REG_FLASH->ACR ) | MCU_ACR_CACHE );
+
+#if ( MCU_PLL == STD_ON )
+    if( Status == E_OK )
+    {
+        REG_WRITE( &REG_RCC->CR, REG_READ( &REG_RCC->CR ) & ~MCU_CR_PLLON );
+        Status = Mcu_WaitFor( &REG_RCC->CR, MCU_CR_PLLRDY, 0u );
+    }
+    if( Status == E_OK )
+    {
+        REG_WRITE( &REG_RCC->PLLCFGR, MCU_PLLCFGR );
+        REG_WRITE( &REG_RCC->CR, REG_READ( &REG_RCC->CR ) | MCU_CR_PLLON );
+        Status = Mcu_WaitFor( &REG_RCC->CR, MCU_CR_PLLRDY, MCU_CR_PLLRDY );
+    }
+    if( Status == E_OK )
+    {
+        REG_WRITE( &REG_RCC->CFGR, ( REG_READ( &REG_RCC->CFGR ) & ~( MCU_CFGR_SW | MCU_CFGR_HPRE | MCU_CFGR_PPRE ) ) |
+                                     ( MCU_AHB_HPRE << 8u ) | ( MCU_APB_PPRE << 12u ) | MCU_CFGR_SW_PLL );
+        Status = Mcu_WaitFor( &REG_RCC->CFGR, MCU_CFGR_SWS, MCU_CFGR_SWS_PLL );
+    }
+#else
+    if( Status == E_OK )
+    {
+        REG_WRITE( &REG_RCC->CFGR, ( REG_READ( &REG_RCC->CFGR ) & ~( MCU_CFGR_HPRE | MCU_CFGR_PPRE ) ) |
+                                     ( MCU_AHB_HPRE << 8u ) | ( MCU_APB_PPRE << 12u ) );
+    }
+#endif
+
+    /*lower the wait states once the clock is slower*/
+    if( ( Status == E_OK ) && ( MCU_FLASH_LATENCY < Latency ) )
+    {
+        Status = Mcu_SetLatency( MCU_FLASH_LATENCY );
+    }
+
+    return Status;
+}
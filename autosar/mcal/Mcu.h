@@ -0,0 +1,17 @@
+/**
+ * @file    Mcu.h
+ * @brief   **Specification of Mcu Driver**
+ *
+ * The Mcu driver sets up the microcontroller clock tree. Mcu_InitClock takes the core from the
+ * HSI16 reset clock to the system clock described in Mcu_Cfg.h, generated from cfg/Mcu.yaml, and
+ * sets the flash wait states, prefetch buffer and instruction cache to match it.
+ */
+#ifndef MCU_H
+#define MCU_H
+
+#include "Std_Types.h"
+#include "Mcu_Cfg.h"
+
+Std_ReturnType Mcu_InitClock( void );
+
+#endif /* MCU_H */
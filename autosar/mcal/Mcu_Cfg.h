@@ -0,0 +1,27 @@
+/**
+ * @file    Mcu_Cfg.h
+ * @brief   **Mcu Driver Configuration**
+ *
+ * Generated by tools/mcu_cfg.py from cfg/Mcu.yaml, do not edit, change the YAML file and run
+ * meson compile -C build mcu_cfg instead.
+ *
+ * System clock 64000000 Hz, AHB clock 64000000 Hz, APB clock 64000000 Hz.
+ */
+#ifndef MCU_CFG_H
+#define MCU_CFG_H
+
+/* clang-format off */
+#define MCU_PLL             STD_ON      /*!< system clock from the PLL, STD_ON or STD_OFF */
+#define MCU_PLL_M           1u          /*!< PLL input divider */
+#define MCU_PLL_N           8u          /*!< PLL VCO multiplier */
+#define MCU_PLL_R           2u          /*!< PLL system clock divider */
+#define MCU_AHB_HPRE        0u          /*!< RCC_CFGR HPRE field, AHB divider 1 */
+#define MCU_APB_PPRE        0u          /*!< RCC_CFGR PPRE field, APB divider 1 */
+#define MCU_FLASH_LATENCY   2u          /*!< flash wait states */
+#define MCU_FLASH_PREFETCH  STD_ON      /*!< flash prefetch buffer, STD_ON or STD_OFF */
+#define MCU_FLASH_ICACHE    STD_ON      /*!< flash instruction cache, STD_ON or STD_OFF */
+#define MCU_READY_TIMEOUT   10000u      /*!< polling iterations for the PLL lock and clock switch */
+#define MCU_CORE_CLOCK      64000000u   /*!< core and SysTick clock in Hz */
+/* clang-format on */
+
+#endif /* MCU_CFG_H */
@@ -0,0 +1,49 @@
+/**
+ * @file    Reg.h
+ * @brief   **Register Access**
+ *
+ * Macros used by the drivers to read and write the microcontroller registers. On the target they
+ * are plain volatile accesses to the register address, on host unit tests (UTEST) the accesses are
+ * routed to functions implemented by the test, so the registers can be modelled in RAM.
+ *
+ * REG_READ and REG_WRITE take the register as a pointer into the Reg_Map.h overlays, so the compiler
+ * addresses it as an offset from the peripheral base. On host the base pointers REG_BASE builds are
+ * only handles holding the register address, never dereferenced, the accesses go to the same host
+ * functions as the address based macros. REG_WRITE_BYTE stores a single byte at the register
+ * address, for the data registers that take their input one byte at a time.
+ */
+#ifndef REG_H
+#define REG_H
+
+#include "Std_Types.h"
+#if defined( UTEST )
+#include <stdint.h>
+#endif
+
+/* clang-format off */
+#if defined( UTEST )
+uint32 Reg_HostRead32( uint32 Address );
+void Reg_HostWrite32( uint32 Address, uint32 Value );
+void Reg_HostWrite8( uint32 Address, uint8 Value );
+
+#define REG_READ32( Address )           Reg_HostRead32( Address )
+#define REG_WRITE32( Address, Value )   Reg_HostWrite32( ( Address ), ( Value ) )
+#define REG_WRITE8( Address, Value )    Reg_HostWrite8( ( Address ), ( Value ) )
+
+#define REG_BASE( Type, Address )       ( (Type *)(uintptr_t)( Address ) )
+#define REG_READ( Register )            Reg_HostRead32( (uint32)(uintptr_t)( Register ) )
+#define REG_WRITE( Register, Value )    Reg_HostWrite32( (uint32)(uintptr_t)( Register ), ( Value ) )
+#define REG_WRITE_BYTE( Register, Value ) Reg_HostWrite8( (uint32)(uintptr_t)( Register ), ( Value ) )
+#else
+#define REG_READ32( Address )           ( *(volatile uint32 *)( Address ) )
+#define REG_WRITE32( Address, Value )   ( *(volatile uint32 *)( Address ) = ( Value ) )
+#define REG_WRITE8( Address, Value )    ( *(volatile uint8 *)( Address ) = ( Value ) )
+
+#define REG_BASE( Type, Address )       ( (Type *)( Address ) )
+#define REG_READ( Register )            ( *( Register ) )
+#define REG_WRITE( Register, Value )    ( *( Register ) = ( Value ) )
+#define REG_WRITE_BYTE( Register, Value ) ( *(volatile uint8 *)( Register ) = ( Value ) )
+#endif
+/* clang-format on */
+
+#endif /* REG_H */
@@ -0,0 +1,217 @@
+/**
+ * @file    Reg_Map.h
+ * @brief   **Register Map**
+ *
+ * Generated by tools/reg_map.py from cfg/Reg.yaml, do not edit, change the YAML file and run
+ * meson compile -C build reg_map instead.
+ *
+ * Registers are accessed through the Reg.h macros with their address in the overlay, for instance
+ * REG_WRITE( &REG_GPIOA->BSRR, Pins ). On the target the base pointers are constants, on host
+ * unit tests (UTEST) they are handles the Reg.h host functions resolve, so the simulator or the
+ * test models the registers.
+ */
+#ifndef REG_MAP_H
+#define REG_MAP_H
+
+#include "Std_Types.h"
+#include "Reg.h"
+
+/**
+ * @brief   DMA channel registers
+ */
+typedef struct Reg_DmaChannelType_Tag
+{
+    volatile uint32 CCR;            /*!< 0x000 channel configuration */
+    volatile uint32 CNDTR;          /*!< 0x004 number of data to transfer */
+    volatile uint32 CPAR;           /*!< 0x008 peripheral address */
+    volatile uint32 CMAR;           /*!< 0x00C memory address */
+    uint32 Reserved0[ 1u ];         /*!< 0x010 reserved */
+} Reg_DmaChannelType;
+_Static_assert( sizeof( Reg_DmaChannelType ) == 0x14u, "Reg_DmaChannelType layout" );
+
+/**
+ * @brief   Reset and clock control
+ */
+typedef struct Reg_RccType_Tag
+{
+    volatile uint32 CR;             /*!< 0x000 clock control */
+    volatile uint32 ICSCR;          /*!< 0x004 internal clock sources calibration */
+    volatile uint32 CFGR;           /*!< 0x008 clock configuration */
+    volatile uint32 PLLCFGR;        /*!< 0x00C PLL configuration */
+    uint32 Reserved0[ 2u ];         /*!< 0x010 reserved */
+    volatile uint32 CIER;           /*!< 0x018 clock interrupt enable */
+    volatile uint32 CIFR;           /*!< 0x01C clock interrupt flag */
+    volatile uint32 CICR;           /*!< 0x020 clock interrupt clear */
+    volatile uint32 IOPRSTR;        /*!< 0x024 I/O port reset */
+    volatile uint32 AHBRSTR;        /*!< 0x028 AHB peripheral reset */
+    volatile uint32 APBRSTR1;       /*!< 0x02C APB peripheral reset 1 */
+    volatile uint32 APBRSTR2;       /*!< 0x030 APB peripheral reset 2 */
+    volatile uint32 IOPENR;         /*!< 0x034 I/O port clock enable */
+    volatile uint32 AHBENR;         /*!< 0x038 AHB peripheral clock enable */
+    volatile uint32 APBENR1;        /*!< 0x03C APB peripheral clock enable 1 */
+    volatile uint32 APBENR2;        /*!< 0x040 APB peripheral clock enable 2 */
+    volatile uint32 IOPSMENR;       /*!< 0x044 I/O port clock enable in sleep mode */
+    volatile uint32 AHBSMENR;       /*!< 0x048 AHB peripheral clock enable in sleep mode */
+    volatile uint32 APBSMENR1;      /*!< 0x04C APB peripheral clock enable in sleep mode 1 */
+    volatile uint32 APBSMENR2;      /*!< 0x050 APB peripheral clock enable in sleep mode 2 */
+    volatile uint32 CCIPR;          /*!< 0x054 peripherals independent clock configuration */
+    uint32 Reserved1[ 1u ];         /*!< 0x058 reserved */
+    volatile uint32 BDCR;           /*!< 0x05C RTC domain control */
+    volatile uint32 CSR;            /*!< 0x060 control and status */
+} Reg_RccType;
+_Static_assert( sizeof( Reg_RccType ) == 0x64u, "Reg_RccType layout" );
+
+/**
+ * @brief   Flash interface
+ */
+typedef struct Reg_FlashType_Tag
+{
+    volatile uint32 ACR;            /*!< 0x000 access control */
+    uint32 Reserved0[ 1u ];         /*!< 0x004 reserved */
+    volatile uint32 KEYR;           /*!< 0x008 key */
+    volatile uint32 OPTKEYR;        /*!< 0x00C option key */
+    volatile uint32 SR;             /*!< 0x010 status */
+    volatile uint32 CR;             /*!< 0x014 control */
+    volatile uint32 ECCR;           /*!< 0x018 ECC */
+    uint32 Reserved1[ 1u ];         /*!< 0x01C reserved */
+    volatile uint32 OPTR;           /*!< 0x020 option */
+    uint32 Reserved2[ 2u ];         /*!< 0x024 reserved */
+    volatile uint32 WRP1AR;         /*!< 0x02C WRP area A address */
+    volatile uint32 WRP1BR;         /*!< 0x030 WRP area B address */
+    uint32 Reserved3[ 19u ];        /*!< 0x034 reserved */
+    volatile uint32 SECR;           /*!< 0x080 security */
+} Reg_FlashType;
+_Static_assert( sizeof( Reg_FlashType ) == 0x84u, "Reg_FlashType layout" );
+
+/**
+ * @brief   CRC calculation unit
+ */
+typedef struct Reg_CrcType_Tag
+{
+    volatile uint32 DR;             /*!< 0x000 data */
+    volatile uint32 IDR;            /*!< 0x004 independent data */
+    volatile uint32 CR;             /*!< 0x008 control */
+    uint32 Reserved0[ 1u ];         /*!< 0x00C reserved */
+    volatile uint32 INIT;           /*!< 0x010 initial value */
+    volatile uint32 POL;            /*!< 0x014 polynomial */
+} Reg_CrcType;
+_Static_assert( sizeof( Reg_CrcType ) == 0x18u, "Reg_CrcType layout" );
+
+/**
+ * @brief   General purpose I/O port
+ */
+typedef struct Reg_GpioType_Tag
+{
+    volatile uint32 MODER;          /*!< 0x000 port mode */
+    volatile uint32 OTYPER;         /*!< 0x004 port output type */
+    volatile uint32 OSPEEDR;        /*!< 0x008 port output speed */
+    volatile uint32 PUPDR;          /*!< 0x00C port pull-up/pull-down */
+    volatile uint32 IDR;            /*!< 0x010 port input data */
+    volatile uint32 ODR;            /*!< 0x014 port output data */
+    volatile uint32 BSRR;           /*!< 0x018 port bit set/reset */
+    volatile uint32 LCKR;           /*!< 0x01C port configuration lock */
+    volatile uint32 AFR[ 2u ];      /*!< 0x020 alternate function low and high */
+    volatile uint32 BRR;            /*!< 0x028 port bit reset */
+} Reg_GpioType;
+_Static_assert( sizeof( Reg_GpioType ) == 0x2Cu, "Reg_GpioType layout" );
+
+/**
+ * @brief   DMA controller
+ */
+typedef struct Reg_DmaType_Tag
+{
+    volatile uint32 ISR;            /*!< 0x000 interrupt status */
+    volatile uint32 IFCR;           /*!< 0x004 interrupt flag clear */
+    Reg_DmaChannelType CH[ 7u ];    /*!< 0x008 channels 1 to 7 at index 0 to 6 */
+} Reg_DmaType;
+_Static_assert( sizeof( Reg_DmaType ) == 0x94u, "Reg_DmaType layout" );
+
+/**
+ * @brief   SysTick timer
+ */
+typedef struct Reg_SysTickType_Tag
+{
+    volatile uint32 CSR;            /*!< 0x000 control and status */
+    volatile uint32 RVR;            /*!< 0x004 reload value */
+    volatile uint32 CVR;            /*!< 0x008 current value */
+    volatile uint32 CALIB;          /*!< 0x00C calibration value */
+} Reg_SysTickType;
+_Static_assert( sizeof( Reg_SysTickType ) == 0x10u, "Reg_SysTickType layout" );
+
+/**
+ * @brief   System control block
+ */
+typedef struct Reg_ScbType_Tag
+{
+    volatile uint32 CPUID;          /*!< 0x000 CPUID base */
+    volatile uint32 ICSR;           /*!< 0x004 interrupt control and state */
+    volatile uint32 VTOR;           /*!< 0x008 vector table offset */
+    volatile uint32 AIRCR;          /*!< 0x00C application interrupt and reset control */
+    volatile uint32 SCR;            /*!< 0x010 system control */
+    volatile uint32 CCR;            /*!< 0x014 configuration and control */
+    uint32 Reserved0[ 1u ];         /*!< 0x018 reserved */
+    volatile uint32 SHPR[ 2u ];     /*!< 0x01C system handler priority 2 and 3 */
+    volatile uint32 SHCSR;          /*!< 0x024 system handler control and state */
+} Reg_ScbType;
+_Static_assert( sizeof( Reg_ScbType ) == 0x28u, "Reg_ScbType layout" );
+
+/**
+ * @brief   Nested vectored interrupt controller
+ */
+typedef struct Reg_NvicType_Tag
+{
+    volatile uint32 ISER;           /*!< 0x000 interrupt set-enable */
+    uint32 Reserved0[ 31u ];        /*!< 0x004 reserved */
+    volatile uint32 ICER;           /*!< 0x080 interrupt clear-enable */
+    uint32 Reserved1[ 31u ];        /*!< 0x084 reserved */
+    volatile uint32 ISPR;           /*!< 0x100 interrupt set-pending */
+    uint32 Reserved2[ 31u ];        /*!< 0x104 reserved */
+    volatile uint32 ICPR;           /*!< 0x180 interrupt clear-pending */
+    uint32 Reserved3[ 95u ];        /*!< 0x184 reserved */
+    volatile uint32 IPR[ 8u ];      /*!< 0x300 interrupt priority */
+} Reg_NvicType;
+_Static_assert( sizeof( Reg_NvicType ) == 0x320u, "Reg_NvicType layout" );
+
+/* clang-format off */
+#define REG_RCC_BASE            0x40021000u                                                                 /*!< reset and clock control */
+#define REG_RCC                 REG_BASE( Reg_RccType, REG_RCC_BASE )                                       /*!< RCC registers */
+#define REG_RCC_AHBENR_CRCEN    0x00001000u                                                                 /*!< CRC clock enable */
+
+#define REG_FLASH_BASE          0x40022000u                                                                 /*!< flash interface */
+#define REG_FLASH               REG_BASE( Reg_FlashType, REG_FLASH_BASE )                                   /*!< FLASH registers */
+
+#define REG_CRC_BASE            0x40023000u                                                                 /*!< CRC calculation unit */
+#define REG_CRC                 REG_BASE( Reg_CrcType, REG_CRC_BASE )                                       /*!< CRC registers */
+#define REG_CRC_CR_RESET        0x00000001u                                                                 /*!< load the initial value */
+#define REG_CRC_CR_POLYSIZE     0x00000018u                                                                 /*!< polynomial size */
+#define REG_CRC_CR_REV_IN       0x00000060u                                                                 /*!< input bits reversal */
+#define REG_CRC_CR_REV_OUT      0x00000080u                                                                 /*!< output bits reversed */
+
+#define REG_GPIOA_BASE          0x50000000u                                                                 /*!< general purpose I/O port */
+#define REG_GPIOA               REG_BASE( Reg_GpioType, REG_GPIOA_BASE )                                    /*!< GPIOA registers */
+#define REG_GPIOB_BASE          0x50000400u                                                                 /*!< general purpose I/O port */
+#define REG_GPIOB               REG_BASE( Reg_GpioType, REG_GPIOB_BASE )                                    /*!< GPIOB registers */
+#define REG_GPIOC_BASE          0x50000800u                                                                 /*!< general purpose I/O port */
+#define REG_GPIOC               REG_BASE( Reg_GpioType, REG_GPIOC_BASE )                                    /*!< GPIOC registers */
+#define REG_GPIOD_BASE          0x50000C00u                                                                 /*!< general purpose I/O port */
+#define REG_GPIOD               REG_BASE( Reg_GpioType, REG_GPIOD_BASE )                                    /*!< GPIOD registers */
+#define REG_GPIOE_BASE          0x50001000u                                                                 /*!< general purpose I/O port */
+#define REG_GPIOE               REG_BASE( Reg_GpioType, REG_GPIOE_BASE )                                    /*!< GPIOE registers */
+#define REG_GPIOF_BASE          0x50001400u                                                                 /*!< general purpose I/O port */
+#define REG_GPIOF               REG_BASE( Reg_GpioType, REG_GPIOF_BASE )                                    /*!< GPIOF registers */
+#define REG_GPIO( Index )       REG_BASE( Reg_GpioType, REG_GPIOA_BASE + ( (uint32)( Index ) * 0x400u ) )   /*!< instance at Index, 0 is GPIOA */
+
+#define REG_DMA1_BASE           0x40020000u                                                                 /*!< DMA controller */
+#define REG_DMA1                REG_BASE( Reg_DmaType, REG_DMA1_BASE )                                      /*!< DMA1 registers */
+
+#define REG_SYSTICK_BASE        0xE000E010u                                                                 /*!< SysTick timer */
+#define REG_SYSTICK             REG_BASE( Reg_SysTickType, REG_SYSTICK_BASE )                               /*!< SYSTICK registers */
+
+#define REG_SCB_BASE            0xE000ED00u                                                                 /*!< system control block */
+#define REG_SCB                 REG_BASE( Reg_ScbType, REG_SCB_BASE )                                       /*!< SCB registers */
+
+#define REG_NVIC_BASE           0xE000E100u                                                                 /*!< nested vectored interrupt controller */
+#define REG_NVIC                REG_BASE( Reg_NvicType, REG_NVIC_BASE )                                     /*!< NVIC registers */
+/* clang-format on */
+
+#endif /* REG_MAP_H */
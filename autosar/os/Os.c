@@ -0,0 +1,165 @@
+/**
+ * @file    Os.c
+ * @brief   **Priority Bitmap Task Scheduler**
+ *
+ * Bit n of the ready bitmap is the task with priority n. The dispatcher masks out the priorities
+ * at or below the running task and picks the most significant bit left with
+ * Bfx_CountLeadingZeros_u32, a de Bruijn lookup that takes the same time for any bitmap.
+ *
+ * The read modify writes of the bitmap use the Bfx atomic routines, on the Cortex-M0+ they mask the
+ * interrupts with PRIMASK for the three instructions each one takes. The idle check masks them with
+ * Bfx_AtomicEnter too.
+ */
+#include "Os.h"
+#include "Bfx.h"
+#include "Trace.h"
+#if ( OS_DISPATCH_LATENCY == STD_ON )
+#include "Reg_Map.h"
+#endif
+
+/* clang-format off */
+#define OS_SYST_MASK    0x00FFFFFFu     /*!< SysTick counter width */
+/* clang-format on */
+
+static const Os_ConfigType *Os_Config; /*!< task table */
+static volatile uint32 Os_Ready;       /*!< ready tasks, bit n is the task with priority n */
+static uint32 Os_Masked;               /*!< priorities at or below the running task */
+
+#if ( OS_DISPATCH_LATENCY == STD_ON )
+static uint32 Os_Stamp[ OS_MAX_TASKS ]; /*!< SysTick value at the activation of each task */
+static uint32 Os_LatencyMax;            /*!< longest activation to dispatch time in SysTick counts */
+#endif
+
+/**
+ * @brief   **Initialise the scheduler**
+ *
+ * Sets the task table and clears all the activations, shall be called before any other service
+ * and before the interrupts that activate tasks are enabled.
+ *
+ * @param[in] Config Task table and idle hook
+ */
+void Os_Init( const Os_ConfigType *Config )
+{
+    Os_Config = Config;
+    Os_Ready  = 0u;
+    Os_Masked = 0u;
+#if ( OS_DISPATCH_LATENCY == STD_ON )
+    Os_LatencyMax = 0u;
+#endif
+}
+
+/**
+ * @brief   **Start the scheduler**
+ *
+ * Dispatches the ready tasks from the highest to the lowest priority and calls the idle hook every
+ * time there is nothing left to run. The ready bitmap is checked again with the interrupts masked
+ * right before the idle hook, so a task activated by an interrupt after Schedule returned is not
+ * left waiting while the hook sleeps. This function never returns.
+ */
+void StartOS( void )
+{
+    uint32 Primask;
+
+    for( ;; )
+    {
+        (void)Schedule();
+
+        Primask = Bfx_AtomicEnter();
+        if( ( Os_Ready == 0u ) && ( Os_Config->IdleHook != NULL_PTR ) )
+        {
+            Os_Config->IdleHook();
+        }
+        Bfx_AtomicExit( Primask );
+    }
+}
+
+/**
+ * @brief   **Activate a task**
+ *
+ * Marks the task as ready, it starts at the next scheduling point once there is no higher priority
+ * task ready. The task bit is set with a single atomic or, so the service can be called from tasks
+ * and from interrupts. A task can be pending only once, activating it again before it is dispatched
+ * is an error, activating it while it is running queues one more run.
+ *
+ * @param[in] TaskID Task to activate
+ *
+ * @retval  E_OK: task activated
+ *          E_OS_ID: TaskID is not a valid task
+ *          E_OS_LIMIT: task already pending
+ */
+StatusType ActivateTask( TaskType TaskID )
+{
+    StatusType Status = E_OS_ID;
+
+    if( TaskID < Os_Config->NumberOfTasks )
+    {
+        Status = ( Bfx_AtomicTstSetBit_u32u8_u8( &Os_Ready, TaskID ) == TRUE ) ? E_OS_LIMIT : E_OK;
+#if ( OS_DISPATCH_LATENCY == STD_ON )
+        if( Status == E_OK )
+        {
+            Os_Stamp[ TaskID ] = REG_READ( &REG_SYSTICK->CVR );
+        }
+#endif
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Reschedule**
+ *
+ * Runs the ready tasks with a priority higher than the calling task, from the highest to the
+ * lowest, and returns when none is left. Called from StartOS at idle level it runs all the ready
+ * tasks. Each pick masks the bitmap and counts its leading zeros, the time does not depend on the
+ * number of tasks ready.
+ *
+ * @retval  E_OK: always
+ */
+StatusType Schedule( void )
+{
+    uint32 Previous = Os_Masked;
+    uint32 Ready;
+    TaskType Task;
+#if ( OS_DISPATCH_LATENCY == STD_ON )
+    uint32 Latency;
+#endif
+
+    for( Ready = Os_Ready & ~Previous; Ready != 0u; Ready = Os_Ready & ~Previous )
+    {
+        Task = 31u - Bfx_CountLeadingZeros_u32( Ready );
+        Bfx_AtomicClrBit_u32u8( &Os_Ready, Task );
+#if ( OS_DISPATCH_LATENCY == STD_ON )
+        /*SysTick counts down*/
+        Latency = ( Os_Stamp[ Task ] - REG_READ( &REG_SYSTICK->CVR ) ) & OS_SYST_MASK;
+        if( Latency > Os_LatencyMax )
+        {
+            Os_LatencyMax = Latency;
+        }
+#endif
+
+        /*mask every priority up to the task, 2 << 31 wraps around to mask them all*/
+        Os_Masked = ( 2u << Task ) - 1u;
+        TRACE( TRACE_CONTEXT_TASK, TRACE_EVENT_TASK_START, Task );
+        Os_Config->Tasks[ Task ]();
+        TRACE( TRACE_CONTEXT_TASK, TRACE_EVENT_TASK_END, Task );
+        Os_Masked = Previous;
+    }
+
+    return E_OK;
+}
+
+#if ( OS_DISPATCH_LATENCY == STD_ON )
+/**
+ * @brief   **Longest dispatch latency**
+ *
+ * Time from the activation of a task to the start of its execution, the longest since Os_Init.
+ * Measured with the SysTick counter, so it is in processor cycles when SysTick runs from the core
+ * clock and it is only valid for latencies shorter than the SysTick period.
+ *
+ * @retval Latency in SysTick counts
+ */
+uint32 Os_GetDispatchLatency( void )
+{
+    return Os_LatencyMax;
+}
+#endif
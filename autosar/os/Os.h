@@ -0,0 +1,63 @@
+/**
+ * @file    Os.h
+ * @brief   **Priority Bitmap Task Scheduler**
+ *
+ * Small OSEK style scheduler with static priorities and basic tasks that run to completion on a
+ * single stack. Each task has its own priority, the position in the task table given to Os_Init,
+ * the higher the index the higher the priority, up to 32 tasks.
+ *
+ * The ready tasks are kept as bits in a single word, ActivateTask sets the task bit with one atomic
+ * or, so it can be called from tasks and interrupts alike, and the dispatcher picks the highest
+ * priority with a constant time count of leading zeros, no matter how many tasks are ready.
+ * Scheduling is non preemptive, a task activated by an interrupt or by another task starts when
+ * the running one terminates or calls Schedule.
+ */
+#ifndef OS_H
+#define OS_H
+
+#include "Std_Types.h"
+#include "Os_Cfg.h"
+
+/**
+ * @name    os_errors
+ * OSEK error codes returned by the services
+ */
+/**@{*/
+#define E_OS_ID    3u /*!< invalid task identifier */
+#define E_OS_LIMIT 4u /*!< task already activated and not dispatched yet */
+/**@}*/
+
+/**
+ * @brief   Maximum number of tasks, one per bit of the ready bitmap
+ */
+#define OS_MAX_TASKS 32u
+
+/**
+ * @brief   Task identifier, also the task priority
+ */
+typedef uint8 TaskType;
+
+/**
+ * @brief   Task body, the task terminates when the function returns
+ */
+typedef void ( *Os_TaskEntryType )( void );
+
+/**
+ * @brief   Scheduler configuration
+ */
+typedef struct Os_ConfigType_Tag
+{
+    const Os_TaskEntryType *Tasks; /*!< task bodies sorted from the lowest to the highest priority */
+    uint8 NumberOfTasks;           /*!< number of tasks in the table, up to OS_MAX_TASKS */
+    void ( *IdleHook )( void );    /*!< called by StartOS with the interrupts masked when no task is ready, can be NULL_PTR */
+} Os_ConfigType;
+
+void Os_Init( const Os_ConfigType *Config );
+void StartOS( void );
+StatusType ActivateTask( TaskType TaskID );
+StatusType Schedule( void );
+#if ( OS_DISPATCH_LATENCY == STD_ON )
+uint32 Os_GetDispatchLatency( void );
+#endif
+
+#endif /* OS_H */
@@ -0,0 +1,19 @@
+/**
+ * @file    Os_Cfg.h
+ * @brief   **Os Configuration**
+ *
+ * Compile time configuration of the priority bitmap scheduler. The task table itself is given at
+ * runtime to Os_Init, this file only holds the options that change the generated code.
+ */
+#ifndef OS_CFG_H
+#define OS_CFG_H
+
+/**
+ * @brief   Measure the time between a task activation and its dispatch with the SysTick counter,
+ *          STD_ON or STD_OFF
+ */
+#ifndef OS_DISPATCH_LATENCY
+#define OS_DISPATCH_LATENCY STD_OFF
+#endif
+
+#endif /* OS_CFG_H */
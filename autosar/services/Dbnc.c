@@ -0,0 +1,103 @@
+/**
+ * @file    Dbnc.c
+ * @brief   **Bit Parallel Input Debouncing**
+ *
+ * Each input owns a counter whose bits are spread over the DBNC_COUNTER_BITS planes (vertical
+ * counter). The counters of the inputs that differ from their debounced state are incremented with a
+ * ripple carry over the planes, the rest are cleared, and the inputs whose counter matches the depth
+ * are toggled using the Bfx mask routines.
+ */
+#include "Dbnc.h"
+#include "Bfx.h"
+
+/* clang-format off */
+#if DBNC_LANE_BITS == 64u
+#define DBNC_ALL_LANES          0xFFFFFFFFFFFFFFFFu
+#define Dbnc_ToggleBitMask      Bfx_ToggleBitMask_u64u64
+#define Dbnc_ClrBitMask         Bfx_ClrBitMask_u64u64
+#else
+#define DBNC_ALL_LANES          0xFFFFFFFFu
+#define Dbnc_ToggleBitMask      Bfx_ToggleBitMask_u32u32
+#define Dbnc_ClrBitMask         Bfx_ClrBitMask_u32u32
+#endif
+/* clang-format on */
+
+/**
+ * @brief   **Debouncing engine initialization**
+ *
+ * Sets the debounced state of all the inputs to Initial, clears the counters and spreads the
+ * debounce depth over all the lanes so it can be compared in parallel.
+ *
+ * @param[out] State Pointer to the engine state
+ * @param[in] Initial Initial debounced state of the inputs
+ * @param[in] Depth Number of consecutive samples required to accept a new state (1 to 2^n - 1)
+ *
+ * @retval E_OK if the depth can be represented with the configured counter bits, otherwise E_NOT_OK
+ */
+Std_ReturnType Dbnc_Init( Dbnc_StateType *State, Dbnc_LaneType Initial, uint8 Depth )
+{
+    Std_ReturnType Status = E_NOT_OK;
+
+    if( ( Depth > 0u ) && ( Depth < ( 1u << DBNC_COUNTER_BITS ) ) )
+    {
+        for( uint8 Plane = 0u; Plane < DBNC_COUNTER_BITS; Plane++ )
+        {
+            State->Counter[ Plane ]   = 0u;
+            State->DepthMask[ Plane ] = ( ( ( Depth >> Plane ) & 1u ) != 0u ) ? DBNC_ALL_LANES : 0u;
+        }
+        State->Stable = Initial;
+        Status        = E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Debounce a new sample**
+ *
+ * Feeds a new snapshot of the inputs, the counters of the inputs that differ from their debounced
+ * state are incremented and the rest are cleared, the inputs that reach the debounce depth change
+ * their debounced state.
+ *
+ * @param[inout] State Pointer to the engine state
+ * @param[in] Sample Raw state of the inputs
+ *
+ * @retval Inputs that changed their debounced state on this call
+ */
+Dbnc_LaneType Dbnc_Update( Dbnc_StateType *State, Dbnc_LaneType Sample )
+{
+    Dbnc_LaneType Changed = Sample ^ State->Stable;
+    Dbnc_LaneType Carry   = Changed;
+    Dbnc_LaneType Reached = Changed;
+    Dbnc_LaneType Temp;
+
+    for( uint8 Plane = 0u; Plane < DBNC_COUNTER_BITS; Plane++ )
+    {
+        /*ripple carry increment for the changed inputs, clear the rest*/
+        Temp                    = State->Counter[ Plane ] & Carry;
+        State->Counter[ Plane ] = ( State->Counter[ Plane ] ^ Carry ) & Changed;
+        Carry                   = Temp;
+        /*keep the inputs whose counter bit matches the depth bit*/
+        Reached &= ~( State->Counter[ Plane ] ^ State->DepthMask[ Plane ] );
+    }
+
+    Dbnc_ToggleBitMask( &State->Stable, Reached );
+    for( uint8 Plane = 0u; Plane < DBNC_COUNTER_BITS; Plane++ )
+    {
+        Dbnc_ClrBitMask( &State->Counter[ Plane ], Reached );
+    }
+
+    return Reached;
+}
+
+/**
+ * @brief   **Get the debounced state**
+ *
+ * @param[in] State Pointer to the engine state
+ *
+ * @retval Debounced state of the inputs
+ */
+Dbnc_LaneType Dbnc_GetStable( const Dbnc_StateType *State )
+{
+    return State->Stable;
+}
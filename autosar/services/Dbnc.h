@@ -0,0 +1,40 @@
+/**
+ * @file    Dbnc.h
+ * @brief   **Bit Parallel Input Debouncing**
+ *
+ * Debounces up to 32 (or 64) digital inputs at once using vertical counters, each lane of a port
+ * snapshot owns one bit on every counter plane, so a counter is incremented for all the inputs
+ * with a handful of bitwise operations. An input changes its debounced state only after it has
+ * been sampled with the same new value for Depth consecutive ticks. The cost per tick depends on
+ * the counter width and not on the number of inputs.
+ */
+#ifndef DBNC_H
+#define DBNC_H
+
+#include "Std_Types.h"
+#include "Dbnc_Cfg.h"
+
+/**
+ * @brief   Data type holding one bit per debounced input
+ */
+#if DBNC_LANE_BITS == 64u
+typedef uint64 Dbnc_LaneType;
+#else
+typedef uint32 Dbnc_LaneType;
+#endif
+
+/**
+ * @brief   Debouncing engine state, one instance per group of inputs
+ */
+typedef struct Dbnc_StateType_Tag
+{
+    Dbnc_LaneType Counter[ DBNC_COUNTER_BITS ];   /*!< vertical counter planes, bit n belongs to input n */
+    Dbnc_LaneType DepthMask[ DBNC_COUNTER_BITS ]; /*!< debounce depth spread over all the lanes */
+    Dbnc_LaneType Stable;                         /*!< debounced state of the inputs */
+} Dbnc_StateType;
+
+Std_ReturnType Dbnc_Init( Dbnc_StateType *State, Dbnc_LaneType Initial, uint8 Depth );
+Dbnc_LaneType Dbnc_Update( Dbnc_StateType *State, Dbnc_LaneType Sample );
+Dbnc_LaneType Dbnc_GetStable( const Dbnc_StateType *State );
+
+#endif /* DBNC_H */
@@ -0,0 +1,22 @@
+/**
+ * @file    Dbnc_Cfg.h
+ * @brief   **Input Debouncing Configuration**
+ *
+ * Compile time configuration of the bit parallel debouncing engine, the number of inputs debounced
+ * on each call (lane width) and the number of bits of each vertical counter which limits the
+ * maximum debounce depth.
+ */
+#ifndef DBNC_CFG_H
+#define DBNC_CFG_H
+
+/**
+ * @brief   Number of inputs debounced at once, 32 or 64 lanes
+ */
+#define DBNC_LANE_BITS    32u
+
+/**
+ * @brief   Number of bits of each vertical counter, the maximum debounce depth is 2^n - 1 samples
+ */
+#define DBNC_COUNTER_BITS 3u
+
+#endif /* DBNC_CFG_H */
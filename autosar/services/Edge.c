@@ -0,0 +1,55 @@
+/**
+ * @file    Edge.c
+ * @brief   **Bit Parallel Edge Detection**
+ *
+ * Edges are computed for all the pins at once from the previous and current snapshots, the pins to
+ * notify are then visited with the Bfx find first set kernel clearing one bit per iteration.
+ */
+#include "Edge.h"
+#include "Bfx.h"
+
+/**
+ * @brief   **Detect edges**
+ *
+ * Computes the rising, falling and changed masks between two port snapshots.
+ *
+ * @param[in] Previous Snapshot taken on the previous cycle
+ * @param[in] Current Snapshot taken on the current cycle
+ * @param[out] Events Pointer to the edges found
+ */
+void Edge_Detect( uint32 Previous, uint32 Current, Edge_EventsType *Events )
+{
+    Events->Changed = Previous ^ Current;
+    Events->Rising  = Events->Changed & Current;
+    Events->Falling = Events->Changed & Previous;
+}
+
+/**
+ * @brief   **Notify edges**
+ *
+ * Calls the configured callback of each monitored pin with an edge between both snapshots, pins
+ * are notified from the lowest to the highest. When there are no edges the function returns right
+ * after the mask computation.
+ *
+ * @param[in] Config Pointer to the pins to monitor and their callbacks
+ * @param[in] Previous Snapshot taken on the previous cycle
+ * @param[in] Current Snapshot taken on the current cycle
+ *
+ * @retval Pins that were notified
+ */
+uint32 Edge_Notify( const Edge_ConfigType *Config, uint32 Previous, uint32 Current )
+{
+    uint32 Changed  = Previous ^ Current;
+    uint32 Pending  = ( Changed & Current & Config->RisingMask ) | ( Changed & Previous & Config->FallingMask );
+    uint32 Notified = Pending;
+    uint8 Pin;
+
+    while( Pending != 0u )
+    {
+        Pin = Bfx_CountTrailingZeros_u32( Pending );
+        Config->Callback[ Pin ]( Pin, Bfx_GetBit_u32u8_u8( Current, Pin ) ? STD_HIGH : STD_LOW );
+        Pending &= Pending - 1u; /*clear the pin just notified*/
+    }
+
+    return Notified;
+}
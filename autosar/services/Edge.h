@@ -0,0 +1,42 @@
+/**
+ * @file    Edge.h
+ * @brief   **Bit Parallel Edge Detection**
+ *
+ * Detects rising and falling edges over all the pins of two consecutive port snapshots with a few
+ * bitwise operations, and notifies the edges of the monitored pins iterating only over the bits
+ * set, so a cycle without edges costs the same regardless of the number of monitored pins.
+ */
+#ifndef EDGE_H
+#define EDGE_H
+
+#include "Std_Types.h"
+
+/**
+ * @brief   Edge notification, receives the pin number and its new level STD_HIGH or STD_LOW
+ */
+typedef void ( *Edge_CallbackType )( uint8 Pin, uint8 Level );
+
+/**
+ * @brief   Edges found between two snapshots, bit n belongs to pin n
+ */
+typedef struct Edge_EventsType_Tag
+{
+    uint32 Rising;  /*!< pins that went from low to high */
+    uint32 Falling; /*!< pins that went from high to low */
+    uint32 Changed; /*!< pins with any edge */
+} Edge_EventsType;
+
+/**
+ * @brief   Edge notification configuration
+ */
+typedef struct Edge_ConfigType_Tag
+{
+    uint32 RisingMask;                 /*!< pins notified on rising edges */
+    uint32 FallingMask;                /*!< pins notified on falling edges */
+    const Edge_CallbackType *Callback; /*!< table with one callback per pin, 32 entries */
+} Edge_ConfigType;
+
+void Edge_Detect( uint32 Previous, uint32 Current, Edge_EventsType *Events );
+uint32 Edge_Notify( const Edge_ConfigType *Config, uint32 Previous, uint32 Current );
+
+#endif /* EDGE_H */
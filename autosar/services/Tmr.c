@@ -0,0 +1,390 @@
+/**
+ * @file    Tmr.c
+ * @brief   **Software Timers**
+ *
+ * Level n of the wheel holds the timers expiring within 32^(n+1) ticks, in the slot given by bits
+ * 5n to 5n+4 of their expiry tick. Every time the low 5n bits of the tick count wrap to zero the
+ * current slot of level n is cascaded, its timers are linked again at the level that fits the time
+ * left, and the current slot of level 0 holds exactly the timers expiring on the tick.
+ *
+ * The wheel is modified from the tick interrupt and from the tasks, Tmr_Start and Tmr_Stop mask
+ * the interrupts with Bfx_AtomicEnter while they link and unlink the timer.
+ *
+ * Tmr_Idle stretches the SysTick period over the ticks without work and sleeps with WFI. The ticks
+ * slept are added to the tick count on wake up, they are known to have nothing to expire or
+ * cascade, only the last one goes through the SysTick interrupt and Tmr_Tick.
+ */
+#include "Tmr.h"
+#include "Bfx.h"
+#include "Trace.h"
+#if ( TMR_SYSTICK == STD_ON )
+#include "Mfx.h"
+#include "Reg_Map.h"
+#endif
+
+#if ( TMR_LEVELS < 1u ) || ( TMR_LEVELS > 6u )
+#error "TMR_LEVELS shall be between 1 and 6"
+#endif
+
+/* clang-format off */
+#define TMR_SLOTS           32u             /*!< slots per level */
+#define TMR_SLOT_MASK       0x1Fu           /*!< slot index bits */
+#define TMR_SYST_ENABLE     0x00000007u     /*!< core clock, tick interrupt and counter enabled */
+#define TMR_SYST_STOPPED    0x00000006u     /*!< core clock and tick interrupt, counter stopped */
+#define TMR_SYST_COUNTFLAG  0x00010000u     /*!< counter reached zero since the last read */
+#define TMR_TICK_CYCLES     ( TMR_SYSTICK_RELOAD + 1u )         /*!< core clock cycles per tick */
+#define TMR_IDLE_MAX_TICKS  ( 0x00FFFFFFu / TMR_TICK_CYCLES )   /*!< ticks that fit the 24 bit counter */
+/* clang-format on */
+
+#if ( TMR_SYSTICK == STD_ON )
+#if defined( UTEST )
+void Tmr_HostWaitForInterrupt( void );
+#define TMR_WFI()           Tmr_HostWaitForInterrupt()
+#else
+#define TMR_WFI()           __asm volatile( "wfi" : : : "memory" )
+#endif
+#endif
+
+static Tmr_TimerType *Tmr_Wheel[ TMR_LEVELS ][ TMR_SLOTS ]; /*!< first timer of each slot */
+static uint32 Tmr_Bitmap[ TMR_LEVELS ];                     /*!< non empty slots, bit n is slot n */
+static volatile uint32 Tmr_Now;                             /*!< ticks since Tmr_Init */
+
+/**
+ * @brief   **Link a timer**
+ *
+ * Links the timer at the head of the slot of its expiry tick, at the lowest level whose range holds
+ * the ticks left. A timer expiring on the current tick is linked in the current slot of level 0.
+ *
+ * @param[in,out] Timer Timer to link, with Expiry already set
+ */
+static void Tmr_Link( Tmr_TimerType *Timer )
+{
+    uint32 Delta = Timer->Expiry - Tmr_Now;
+    uint8 Level  = 0u;
+    uint8 Slot;
+
+    while( ( Level < ( TMR_LEVELS - 1u ) ) && ( Delta >= ( 1u << ( ( Level + 1u ) * TMR_SLOT_BITS ) ) ) )
+    {
+        Level++;
+    }
+
+    Slot         = (uint8)( ( Timer->Expiry >> ( Level * TMR_SLOT_BITS ) ) & TMR_SLOT_MASK );
+    Timer->Level = Level + 1u;
+    Timer->Slot  = Slot;
+    Timer->Prev  = NULL_PTR;
+    Timer->Next  = Tmr_Wheel[ Level ][ Slot ];
+    if( Timer->Next != NULL_PTR )
+    {
+        Timer->Next->Prev = Timer;
+    }
+    Tmr_Wheel[ Level ][ Slot ] = Timer;
+    Bfx_SetBit_u32u8( &Tmr_Bitmap[ Level ], Slot );
+}
+
+/**
+ * @brief   **Unlink a timer**
+ *
+ * Removes the timer from its slot and clears the slot bit when it was the last one.
+ *
+ * @param[in,out] Timer Running timer to unlink
+ */
+static void Tmr_Unlink( Tmr_TimerType *Timer )
+{
+    uint8 Level = Timer->Level - 1u;
+
+    if( Timer->Prev != NULL_PTR )
+    {
+        Timer->Prev->Next = Timer->Next;
+    }
+    else
+    {
+        Tmr_Wheel[ Level ][ Timer->Slot ] = Timer->Next;
+        if( Timer->Next == NULL_PTR )
+        {
+            Bfx_ClrBit_u32u8( &Tmr_Bitmap[ Level ], Timer->Slot );
+        }
+    }
+    if( Timer->Next != NULL_PTR )
+    {
+        Timer->Next->Prev = Timer->Prev;
+    }
+    Timer->Level = 0u;
+}
+
+/**
+ * @brief   **Initialise the timer service**
+ *
+ * Empties the wheel and restarts the tick count, when TMR_SYSTICK is STD_ON also programs SysTick
+ * to interrupt every TMR_SYSTICK_RELOAD + 1 core clock cycles. Shall be called before any other
+ * service with all the timers stopped.
+ */
+void Tmr_Init( void )
+{
+    for( uint8 Level = 0u; Level < TMR_LEVELS; Level++ )
+    {
+        for( uint8 Slot = 0u; Slot < TMR_SLOTS; Slot++ )
+        {
+            Tmr_Wheel[ Level ][ Slot ] = NULL_PTR;
+        }
+        Tmr_Bitmap[ Level ] = 0u;
+    }
+    Tmr_Now = 0u;
+
+#if ( TMR_SYSTICK == STD_ON )
+    REG_WRITE( &REG_SYSTICK->CSR, 0u );
+    REG_WRITE( &REG_SYSTICK->RVR, TMR_SYSTICK_RELOAD );
+    REG_WRITE( &REG_SYSTICK->CVR, 0u );
+    REG_WRITE( &REG_SYSTICK->CSR, TMR_SYST_ENABLE );
+#endif
+}
+
+/**
+ * @brief   **Start a timer**
+ *
+ * Starts the timer to expire Timeout ticks from now and then every Period ticks, a running timer is
+ * restarted. The callback is called from the tick interrupt and can start and stop any timer.
+ *
+ * @param[in,out] Timer Timer to start
+ * @param[in] Timeout Ticks to the first expiry, 1 to TMR_MAX_TIMEOUT
+ * @param[in] Period Ticks between the next expiries, 0 for a one shot timer, up to TMR_MAX_TIMEOUT
+ * @param[in] Callback Expiry notification
+ *
+ * @retval  E_OK: timer started
+ *          E_NOT_OK: invalid timeout, period or callback, the timer is left untouched
+ */
+Std_ReturnType Tmr_Start( Tmr_TimerType *Timer, uint32 Timeout, uint32 Period, Tmr_CallbackType Callback )
+{
+    Std_ReturnType Status = E_NOT_OK;
+    uint32 Primask;
+
+    if( ( Timeout > 0u ) && ( Timeout <= TMR_MAX_TIMEOUT ) && ( Period <= TMR_MAX_TIMEOUT ) && ( Callback != NULL_PTR ) )
+    {
+        Primask = Bfx_AtomicEnter();
+        if( Timer->Level != 0u )
+        {
+            Tmr_Unlink( Timer );
+        }
+        Timer->Callback = Callback;
+        Timer->Period   = Period;
+        Timer->Expiry   = Tmr_Now + Timeout;
+        Tmr_Link( Timer );
+        Bfx_AtomicExit( Primask );
+        Status = E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Stop a timer**
+ *
+ * Stops the timer so it does not expire, nothing is done when the timer is not running.
+ *
+ * @param[in,out] Timer Timer to stop
+ */
+void Tmr_Stop( Tmr_TimerType *Timer )
+{
+    uint32 Primask = Bfx_AtomicEnter();
+
+    if( Timer->Level != 0u )
+    {
+        Tmr_Unlink( Timer );
+    }
+    Bfx_AtomicExit( Primask );
+}
+
+/**
+ * @brief   **Timer state**
+ *
+ * @param[in] Timer Timer to check
+ *
+ * @retval  TRUE: the timer is running
+ *          FALSE: the timer is stopped or it was a one shot timer that already expired
+ */
+boolean Tmr_IsRunning( const Tmr_TimerType *Timer )
+{
+    return ( Timer->Level != 0u ) ? TRUE : FALSE;
+}
+
+/**
+ * @brief   **Advance the wheel one tick**
+ *
+ * Cascades the upper levels whose range wrapped around and calls the callbacks of the timers
+ * expiring on the new tick, periodic timers are linked again before their callback is called. The
+ * timers are taken one at a time from the slot, so a callback can stop any other timer. Shall be
+ * called from the tick interrupt only.
+ */
+void Tmr_Tick( void )
+{
+    uint32 Now = Tmr_Now + 1u;
+    Tmr_TimerType *Timer;
+    uint8 Slot;
+
+    Tmr_Now = Now;
+
+    for( uint8 Level = 1u; ( Level < TMR_LEVELS ) && ( ( Now & ( ( 1u << ( Level * TMR_SLOT_BITS ) ) - 1u ) ) == 0u ); Level++ )
+    {
+        Slot = (uint8)( ( Now >> ( Level * TMR_SLOT_BITS ) ) & TMR_SLOT_MASK );
+        while( Tmr_Wheel[ Level ][ Slot ] != NULL_PTR )
+        {
+            Timer = Tmr_Wheel[ Level ][ Slot ];
+            Tmr_Unlink( Timer );
+            Tmr_Link( Timer );
+        }
+    }
+
+    Slot = (uint8)( Now & TMR_SLOT_MASK );
+    if( Bfx_GetBit_u32u8_u8( Tmr_Bitmap[ 0 ], Slot ) == TRUE )
+    {
+        while( Tmr_Wheel[ 0 ][ Slot ] != NULL_PTR )
+        {
+            Timer = Tmr_Wheel[ 0 ][ Slot ];
+            Tmr_Unlink( Timer );
+            if( Timer->Period != 0u )
+            {
+                Timer->Expiry = Now + Timer->Period;
+                Tmr_Link( Timer );
+            }
+            TRACE( TRACE_CONTEXT_ISR, TRACE_EVENT_TIMER, (uintptr_t)Timer->Callback );
+            Timer->Callback();
+        }
+    }
+}
+
+/**
+ * @brief   **Tick count**
+ *
+ * @retval Ticks since Tmr_Init, wraps around after 2^32 ticks
+ */
+uint32 Tmr_GetTicks( void )
+{
+    return Tmr_Now;
+}
+
+/**
+ * @brief   **Ticks without work**
+ *
+ * Number of ticks until the next one that expires or cascades a timer, the ticks before it only
+ * increment the tick count. For each level the slot bitmap is rotated so the slot after the current
+ * one lands on bit 0 and the next non empty slot is found with a count of trailing zeros, the time
+ * does not depend on the number of timers running. Shall be called with the tick interrupt masked.
+ *
+ * @retval Ticks to the next tick with work, from 1, TMR_NO_EXPIRY when no timer is running
+ */
+uint32 Tmr_GetIdleTicks( void )
+{
+    uint32 Now   = Tmr_Now;
+    uint32 Ticks = TMR_NO_EXPIRY;
+    uint32 Shift;
+    uint32 Next;
+    uint32 Bitmap;
+
+    for( uint8 Level = 0u; Level < TMR_LEVELS; Level++ )
+    {
+        if( Tmr_Bitmap[ Level ] != 0u )
+        {
+            Shift  = Level * TMR_SLOT_BITS;
+            Next   = ( ( Now >> Shift ) + 1u ) & TMR_SLOT_MASK;
+            Bitmap = ( Tmr_Bitmap[ Level ] >> Next ) | ( Tmr_Bitmap[ Level ] << ( ( TMR_SLOTS - Next ) & TMR_SLOT_MASK ) );
+            /*slots to the next non empty one, minus the ticks already elapsed in the current slot*/
+            Next = ( ( Bfx_CountTrailingZeros_u32( Bitmap ) + 1u ) << Shift ) - ( Now & ( ( 1u << Shift ) - 1u ) );
+            if( Next < Ticks )
+            {
+                Ticks = Next;
+            }
+        }
+    }
+
+    return Ticks;
+}
+
+#if ( TMR_SYSTICK == STD_ON )
+/**
+ * @brief   **Tickless idle**
+ *
+ * Sleeps with WFI until the next tick with work or any other interrupt, whatever comes first. When
+ * the next tick with work is at least two ticks away SysTick is reloaded to interrupt right on it,
+ * up to TMR_IDLE_MAX_TICKS ahead, otherwise the regular tick interrupt wakes the core.
+ *
+ * On an early wake up the tick boundaries already passed are added to the tick count and SysTick is
+ * reloaded to interrupt on the next one, so the tick count stays aligned with the boundaries it
+ * would have had without sleeping. The cycles SysTick is stopped while being reprogrammed are lost.
+ *
+ * Shall be called with the interrupts masked with PRIMASK, for instance from the Os idle hook, WFI
+ * still wakes the core on a pending interrupt and it is served once the caller unmasks them.
+ */
+void Tmr_Idle( void )
+{
+    uint32 Ticks = Tmr_GetIdleTicks();
+    uint32 Counts;
+    uint32 Whole;
+    uint32 Status;
+
+    if( Ticks > TMR_IDLE_MAX_TICKS )
+    {
+        Ticks = TMR_IDLE_MAX_TICKS;
+    }
+
+    if( Ticks < 2u )
+    {
+        TMR_WFI();
+    }
+    else
+    {
+        /*first interrupt at the end of the current tick plus Ticks - 1 whole ticks, then reload
+        the regular tick, the counter takes one cycle to load the value written to RVR*/
+        REG_WRITE( &REG_SYSTICK->CSR, TMR_SYST_STOPPED );
+        Counts = REG_READ( &REG_SYSTICK->CVR );
+        if( Counts == 0u )
+        {
+            /*the boundary was reached and its interrupt is pending, it ticks the current tick, a
+            whole tick is left to the next boundary*/
+            Counts = TMR_TICK_CYCLES;
+        }
+        REG_WRITE( &REG_SYSTICK->RVR, ( Counts + ( ( Ticks - 1u ) * TMR_TICK_CYCLES ) ) - 1u );
+        REG_WRITE( &REG_SYSTICK->CVR, 0u );
+        REG_WRITE( &REG_SYSTICK->CSR, TMR_SYST_ENABLE );
+        REG_WRITE( &REG_SYSTICK->RVR, TMR_SYSTICK_RELOAD );
+
+        TMR_WFI();
+
+        /*COUNTFLAG clears on read, take it before stopping the counter*/
+        Status = REG_READ( &REG_SYSTICK->CSR );
+        REG_WRITE( &REG_SYSTICK->CSR, TMR_SYST_STOPPED );
+        Counts = REG_READ( &REG_SYSTICK->CVR );
+        if( ( ( Status & TMR_SYST_COUNTFLAG ) != 0u ) || ( Counts == 0u ) )
+        {
+            /*slept all the way, the pending SysTick interrupt ticks the last one*/
+            Tmr_Now += Ticks - 1u;
+            REG_WRITE( &REG_SYSTICK->CSR, TMR_SYST_ENABLE );
+        }
+        else
+        {
+            /*Counts cycles left to the last boundary, one boundary every whole tick before it*/
+            Whole  = Mfx_Div_u32u32_u32( Counts, TMR_TICK_CYCLES );
+            Counts = Counts - ( Whole * TMR_TICK_CYCLES );
+            if( Counts == 0u )
+            {
+                Whole--;
+                Counts = TMR_TICK_CYCLES;
+            }
+            Tmr_Now += ( Ticks - 1u ) - Whole;
+            /*a reload of 0 stops SysTick, interrupt one cycle late instead*/
+            REG_WRITE( &REG_SYSTICK->RVR, ( Counts > 1u ) ? ( Counts - 1u ) : 1u );
+            REG_WRITE( &REG_SYSTICK->CVR, 0u );
+            REG_WRITE( &REG_SYSTICK->CSR, TMR_SYST_ENABLE );
+            REG_WRITE( &REG_SYSTICK->RVR, TMR_SYSTICK_RELOAD );
+        }
+    }
+}
+
+/**
+ * @brief   **SysTick interrupt**
+ *
+ * Overrides the weak handler in startup.c to advance the wheel every tick.
+ */
+void SysTick_Handler( void )
+{
+    Tmr_Tick();
+}
+#endif
@@ -0,0 +1,61 @@
+/**
+ * @file    Tmr.h
+ * @brief   **Software Timers**
+ *
+ * One shot and periodic software timers driven by a periodic tick, the SysTick interrupt on the
+ * target. The running timers are kept in a hierarchical timer wheel, TMR_LEVELS levels of 32 slots
+ * where each level covers 32 times the range of the one below. A timer is linked in the slot of its
+ * expiry tick at the lowest level that can hold it and moves one level down every time the level
+ * below wraps around, so starting, stopping and expiring a timer are constant time operations no
+ * matter how many timers are running.
+ *
+ * Each level keeps a bitmap of its non empty slots, a tick with nothing to expire costs a single
+ * bit test, and Tmr_GetIdleTicks finds the next tick with any work to do without walking the slots.
+ * Tmr_Idle uses it to sleep over the ticks without work with a single SysTick interrupt.
+ *
+ * The timer objects are owned by the caller and shall not be modified while running. A timer in a
+ * zero initialised object is stopped.
+ */
+#ifndef TMR_H
+#define TMR_H
+
+#include "Std_Types.h"
+#include "Tmr_Cfg.h"
+
+/* clang-format off */
+#define TMR_SLOT_BITS       5u                                                  /*!< 32 slots per level */
+#define TMR_MAX_TIMEOUT     ( ( 1u << ( TMR_SLOT_BITS * TMR_LEVELS ) ) - 1u )   /*!< longest timeout in ticks */
+#define TMR_NO_EXPIRY       0xFFFFFFFFu                                         /*!< no timer running */
+/* clang-format on */
+
+/**
+ * @brief   Expiry notification, called from the tick interrupt
+ */
+typedef void ( *Tmr_CallbackType )( void );
+
+/**
+ * @brief   Software timer
+ */
+typedef struct Tmr_TimerType_Tag
+{
+    struct Tmr_TimerType_Tag *Next; /*!< next timer in the same slot */
+    struct Tmr_TimerType_Tag *Prev; /*!< previous timer in the same slot, NULL_PTR for the first one */
+    Tmr_CallbackType Callback;      /*!< expiry notification */
+    uint32 Expiry;                  /*!< tick count the timer expires at */
+    uint32 Period;                  /*!< reload in ticks for periodic timers, 0 for one shot */
+    uint8 Level;                    /*!< wheel level plus one, 0 when the timer is stopped */
+    uint8 Slot;                     /*!< slot of the level the timer is linked in */
+} Tmr_TimerType;
+
+void Tmr_Init( void );
+Std_ReturnType Tmr_Start( Tmr_TimerType *Timer, uint32 Timeout, uint32 Period, Tmr_CallbackType Callback );
+void Tmr_Stop( Tmr_TimerType *Timer );
+boolean Tmr_IsRunning( const Tmr_TimerType *Timer );
+void Tmr_Tick( void );
+uint32 Tmr_GetTicks( void );
+uint32 Tmr_GetIdleTicks( void );
+#if ( TMR_SYSTICK == STD_ON )
+void Tmr_Idle( void );
+#endif
+
+#endif /* TMR_H */
@@ -0,0 +1,34 @@
+/**
+ * @file    Tmr_Cfg.h
+ * @brief   **Software Timer Configuration**
+ *
+ * Compile time configuration of the timer wheel, the number of wheel levels which sets the longest
+ * timeout, and the SysTick setup used to drive the wheel.
+ */
+#ifndef TMR_CFG_H
+#define TMR_CFG_H
+
+#include "Mcu_Cfg.h"
+
+/**
+ * @brief   Number of wheel levels with 32 slots each, the longest timeout is 2^(5 * n) - 1 ticks
+ */
+#ifndef TMR_LEVELS
+#define TMR_LEVELS 4u
+#endif
+
+/**
+ * @brief   Program SysTick on Tmr_Init and tick the wheel from SysTick_Handler, STD_ON or STD_OFF
+ */
+#ifndef TMR_SYSTICK
+#define TMR_SYSTICK STD_ON
+#endif
+
+/**
+ * @brief   SysTick reload value, core clock cycles per tick minus one, 1ms ticks
+ */
+#ifndef TMR_SYSTICK_RELOAD
+#define TMR_SYSTICK_RELOAD ( ( MCU_CORE_CLOCK / 1000u ) - 1u )
+#endif
+
+#endif /* TMR_CFG_H */
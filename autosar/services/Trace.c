@@ -0,0 +1,68 @@
+/**
+ * @file    Trace.c
+ * @brief   **Binary Trace Buffer**
+ *
+ * The Cortex-M0+ has no cycle counter, the default timestamp counts the cycles from the Tmr tick
+ * count and the SysTick counter, the cycles of the ticks elapsed plus the cycles elapsed in the
+ * current one. The tick count is read again after the counter, a tick interrupt between both reads
+ * makes the timestamp start over. While Tmr_Idle stretches the SysTick period the counter is above
+ * the reload value and the cycles of the current tick are taken as zero. A timestamp taken with the
+ * SysTick interrupt pending, from an interrupt preempting or masking it, is one tick early.
+ */
+#include "Trace.h"
+#if ( TRACE_ENABLE == STD_ON )
+#include "Mcu_Cfg.h"
+#include "Tmr.h"
+#include "Reg_Map.h"
+#endif
+
+#if ( TRACE_ENABLE == STD_ON )
+Trace_BufferType Trace_Buffer; /*!< rings of all the contexts, found by its magic word in a dump */
+#endif
+
+/**
+ * @brief   **Initialise the trace buffer**
+ *
+ * Empties all the rings and writes the buffer header, shall be called before any TRACE. Does
+ * nothing when TRACE_ENABLE is off.
+ */
+void Trace_Init( void )
+{
+#if ( TRACE_ENABLE == STD_ON )
+    for( uint8 Context = 0u; Context < TRACE_CONTEXTS; Context++ )
+    {
+        Trace_Buffer.Ring[ Context ].Head = 0u;
+    }
+    Trace_Buffer.Contexts = TRACE_CONTEXTS;
+    Trace_Buffer.Records  = TRACE_RECORDS;
+    Trace_Buffer.Clock    = MCU_CORE_CLOCK;
+    Trace_Buffer.Magic    = TRACE_MAGIC;
+#endif
+}
+
+#if ( TRACE_ENABLE == STD_ON )
+/**
+ * @brief   **Core clock cycles**
+ *
+ * Default TRACE_TIMESTAMP, cycles since Tmr_Init from the tick count and the SysTick counter, see
+ * Trace.c for its accuracy. Wraps around after 2^32 cycles, 67 seconds at 64MHz.
+ *
+ * @retval Core clock cycles since Tmr_Init
+ */
+uint32 Trace_GetCycles( void )
+{
+    uint32 Ticks;
+    uint32 Counter;
+
+    do
+    {
+        Ticks   = Tmr_GetTicks();
+        Counter = REG_READ( &REG_SYSTICK->CVR );
+    } while( Ticks != Tmr_GetTicks() );
+
+    /*SysTick counts down from the reload value*/
+    Counter = ( Counter <= TMR_SYSTICK_RELOAD ) ? ( TMR_SYSTICK_RELOAD - Counter ) : 0u;
+
+    return ( Ticks * ( TMR_SYSTICK_RELOAD + 1u ) ) + Counter;
+}
+#endif
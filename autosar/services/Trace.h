@@ -0,0 +1,110 @@
+/**
+ * @file    Trace.h
+ * @brief   **Binary Trace Buffer**
+ *
+ * Flight recorder of compact binary records, an 8 bit event id, a 24 bit argument and a 32 bit
+ * timestamp in core clock cycles, written by the TRACE macro from tasks and interrupts. Each writer
+ * context has its own ring and is the only one writing it, code at the same preemption level, the
+ * tasks or the interrupts of one priority, shares a context and never preempts another writer of
+ * it. A record is stored at the ring head and only then the head is advanced, so no lock nor
+ * interrupt masking is needed, a TRACE costs the timestamp plus a handful of loads and stores.
+ *
+ * The rings keep the last TRACE_RECORDS records of each context, older ones are overwritten. The
+ * buffer starts with a magic word and its geometry, tools/trace_decode.py finds it in a dump of the
+ * SRAM or in the file a host program writes, and merges the rings into a single timeline.
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "Std_Types.h"
+#include "Trace_Cfg.h"
+#if ( TRACE_ENABLE == STD_ON )
+#include <stdint.h>
+#endif
+
+/* clang-format off */
+#define TRACE_MAGIC         0x45435254u     /*!< "TRCE", marks the buffer in a memory dump */
+#define TRACE_ARG_MASK      0x00FFFFFFu     /*!< argument bits kept in a record */
+#define TRACE_EVENT_SHIFT   24u             /*!< event id position in the record word */
+/* clang-format on */
+
+#if ( TRACE_ENABLE == STD_ON )
+#if ( TRACE_RECORDS & ( TRACE_RECORDS - 1u ) ) != 0u
+#error "TRACE_RECORDS shall be a power of two"
+#endif
+
+/**
+ * @brief   Trace record
+ */
+typedef struct Trace_RecordType_Tag
+{
+    uint32 Stamp; /*!< core clock cycles */
+    uint32 Word;  /*!< event id in bits 31 to 24, argument in bits 23 to 0 */
+} Trace_RecordType;
+
+/**
+ * @brief   Records of one writer context
+ */
+typedef struct Trace_RingType_Tag
+{
+    volatile uint32 Head;                      /*!< records written, the next one goes to Head % TRACE_RECORDS */
+    Trace_RecordType Records[ TRACE_RECORDS ]; /*!< last records written */
+} Trace_RingType;
+
+/**
+ * @brief   Trace buffer, the layout tools/trace_decode.py reads
+ */
+typedef struct Trace_BufferType_Tag
+{
+    uint32 Magic;                          /*!< TRACE_MAGIC once initialised */
+    uint16 Contexts;                       /*!< number of rings */
+    uint16 Records;                        /*!< records per ring */
+    uint32 Clock;                          /*!< timestamp frequency in Hz */
+    Trace_RingType Ring[ TRACE_CONTEXTS ]; /*!< one ring per writer context */
+} Trace_BufferType;
+
+extern Trace_BufferType Trace_Buffer;
+
+uint32 Trace_GetCycles( void );
+
+/**
+ * @brief   **Record a trace event**
+ *
+ * Stores the record at the head of the context ring and then publishes it advancing the head. The
+ * caller shall be the only writer of the context at its preemption level, see Trace.h. On the host
+ * the head is stored with release order, so another thread reading the head sees the record.
+ *
+ * @param[in] Context Writer context, TRACE_CONTEXT_TASK, TRACE_CONTEXT_ISR or an application one
+ * @param[in] Event Event id
+ * @param[in] Arg Event argument, only the low 24 bits are kept
+ */
+static inline void Trace_Write( uint8 Context, uint8 Event, uint32 Arg )
+{
+    Trace_RingType *Ring     = &Trace_Buffer.Ring[ Context ];
+    uint32 Head              = Ring->Head;
+    Trace_RecordType *Record = &Ring->Records[ Head & ( TRACE_RECORDS - 1u ) ];
+
+    Record->Stamp = TRACE_TIMESTAMP();
+    Record->Word  = ( (uint32)Event << TRACE_EVENT_SHIFT ) | ( Arg & TRACE_ARG_MASK );
+#if defined( __ARM_ARCH_6M__ )
+    /*the M0+ does not reorder its stores, only the compiler has to keep them in order*/
+    __asm volatile( "" : : : "memory" );
+    Ring->Head = Head + 1u;
+#else
+    __atomic_store_n( &Ring->Head, Head + 1u, __ATOMIC_RELEASE );
+#endif
+}
+
+#endif
+
+/* clang-format off */
+#if ( TRACE_ENABLE == STD_ON )
+#define TRACE( Context, Event, Arg )    Trace_Write( ( Context ), ( Event ), (uint32)( Arg ) )
+#else
+#define TRACE( Context, Event, Arg )    ( (void)0 )
+#endif
+/* clang-format on */
+
+void Trace_Init( void );
+
+#endif /* TRACE_H */
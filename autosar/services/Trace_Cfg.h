@@ -0,0 +1,51 @@
+/**
+ * @file    Trace_Cfg.h
+ * @brief   **Trace Buffer Configuration**
+ *
+ * Compile time configuration of the binary trace buffer, the number of writer contexts, the records
+ * kept per context, the timestamp source and the event ids the drivers and services record. The
+ * event ids from TRACE_EVENT_USER up are free for the application, tools/trace_decode.py names the
+ * events after every define ending in TRACE_EVENT_<name> it finds in this file and in main.c.
+ */
+#ifndef TRACE_CFG_H
+#define TRACE_CFG_H
+
+/**
+ * @brief   Record the trace points, STD_ON or STD_OFF, when off TRACE expands to nothing
+ */
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE STD_OFF
+#endif
+
+/**
+ * @brief   Number of writer contexts, each one with its own ring
+ */
+#ifndef TRACE_CONTEXTS
+#define TRACE_CONTEXTS 2u
+#endif
+
+/**
+ * @brief   Records kept per context, a power of two, the oldest records are overwritten
+ */
+#ifndef TRACE_RECORDS
+#define TRACE_RECORDS 64u
+#endif
+
+/**
+ * @brief   Timestamp of the records in core clock cycles, wrapping around after 2^32 cycles
+ */
+#ifndef TRACE_TIMESTAMP
+#define TRACE_TIMESTAMP() Trace_GetCycles()
+#endif
+
+/* clang-format off */
+#define TRACE_CONTEXT_TASK      0u      /*!< tasks and the code they call */
+#define TRACE_CONTEXT_ISR       1u      /*!< interrupts, all at the same priority */
+
+#define TRACE_EVENT_TASK_START  0x01u   /*!< task dispatched, arg is the task id */
+#define TRACE_EVENT_TASK_END    0x02u   /*!< task returned, arg is the task id */
+#define TRACE_EVENT_TIMER       0x03u   /*!< software timer expired, arg is its callback address */
+#define TRACE_EVENT_USER        0x80u   /*!< first event id free for the application */
+/* clang-format on */
+
+#endif /* TRACE_CFG_H */
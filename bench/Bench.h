@@ -0,0 +1,42 @@
+/**
+ * @file    Bench.h
+ * @brief   **Host Benchmark Helpers**
+ *
+ * Clock and result sink shared by the host benchmarks. clock_gettime is POSIX, the benchmarks define
+ * _POSIX_C_SOURCE before their first system header.
+ */
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <time.h>
+#include "Std_Types.h"
+
+static volatile uint64 Bench_Sink; /*!< last result consumed, never read */
+
+/**
+ * @brief   **Monotonic time**
+ *
+ * @retval  Nanoseconds of the monotonic clock
+ */
+static inline uint64 Bench_Now( void )
+{
+    struct timespec Time;
+
+    (void)clock_gettime( CLOCK_MONOTONIC, &Time );
+    return ( (uint64)Time.tv_sec * 1000000000u ) + (uint64)Time.tv_nsec;
+}
+
+/**
+ * @brief   **Consume a result**
+ *
+ * Stores the value in a volatile, so the compiler cannot drop the loop that computed it without the
+ * result changing the exit status of the benchmark.
+ *
+ * @param[in] Value Result accumulated by the measured loop
+ */
+static inline void Bench_Consume( uint64 Value )
+{
+    Bench_Sink = Value;
+}
+
+#endif /* BENCH_H */
@@ -0,0 +1,88 @@
+/**
+ * @file    Bench_Bfx_Atomic.c
+ * @brief   **Host Stress Test for the Interrupt Safe 32 Bit Handling Routines**
+ *
+ * Runs a poster thread setting flags against a taker thread clearing them, the way an ISR and a
+ * task share a flag word, on the host atomic builtins. The benchmark fails when a flag is lost or
+ * taken twice. The host builtins never mask interrupts, their time says nothing of the Cortex-M0+
+ * routines, the interrupt lock time of those is given in Bfx_Atomic.h and tools/primask_window.py
+ * reports it from the firmware disassembly.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include "Std_Types.h"
+#include "Bfx.h"
+
+#define BENCH_POSTS 200000u
+
+static volatile uint32 Shared;
+static volatile uint32 Done;
+static uint32 Posted[ 32 ];
+static uint32 Taken[ 32 ];
+
+/*posts a flag again only once the taker took it, so every post shall be taken exactly once*/
+static void *Bench_Poster( void *Argument )
+{
+    (void)Argument;
+
+    for( uint32 Post = 0u; Post < BENCH_POSTS; Post++ )
+    {
+        uint8 Bit = (uint8)( Post & 31u );
+
+        while( Bfx_AtomicTstSetBit_u32u8_u8( &Shared, Bit ) == TRUE )
+        {
+            (void)sched_yield();
+        }
+        Posted[ Bit ]++;
+    }
+    Done = 1u;
+
+    return NULL;
+}
+
+static void *Bench_Taker( void *Argument )
+{
+    uint32 Flags;
+
+    (void)Argument;
+
+    do
+    {
+        Flags = Bfx_AtomicTakeBitMask_u32u32_u32( &Shared, 0xFFFFFFFFu );
+        if( Flags == 0u )
+        {
+            (void)sched_yield();
+        }
+        for( uint8 Bit = 0u; Flags != 0u; Bit++, Flags >>= 1u )
+        {
+            Taken[ Bit ] += Flags & 1u;
+        }
+    } while( ( Done == 0u ) || ( Shared != 0u ) );
+
+    return NULL;
+}
+
+int main( void )
+{
+    uint32 Posts = 0u;
+    uint32 Lost  = 0u;
+    pthread_t Poster;
+    pthread_t Taker;
+
+    Shared = 0u;
+    (void)pthread_create( &Taker, NULL, Bench_Taker, NULL );
+    (void)pthread_create( &Poster, NULL, Bench_Poster, NULL );
+    (void)pthread_join( Poster, NULL );
+    (void)pthread_join( Taker, NULL );
+
+    for( uint32 Bit = 0u; Bit < 32u; Bit++ )
+    {
+        Lost += ( Posted[ Bit ] != Taken[ Bit ] ) ? 1u : 0u;
+        Posts += Posted[ Bit ];
+    }
+    printf( "%u flags posted by one thread and taken by another, %u bits with lost flags\n", Posts, Lost );
+
+    return ( Lost != 0u ) ? 1 : 0;
+}
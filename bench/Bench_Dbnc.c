@@ -0,0 +1,48 @@
+/**
+ * @file    Bench_Dbnc.c
+ * @brief   **Host Benchmark for the Bit Parallel Input Debouncing**
+ *
+ * Measures the time spent per debounce tick while the number of bouncing inputs grows from 0 to
+ * all the lanes, the cost should stay the same regardless of the number of inputs.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "Std_Types.h"
+#include "Bench.h"
+#include "Dbnc.h"
+
+#define BENCH_TICKS 10000000u
+
+int main( void )
+{
+    static const uint8 Pins[] = { 0u, 1u, 8u, 16u, DBNC_LANE_BITS };
+    Dbnc_StateType State;
+    Dbnc_LaneType Active;
+    Dbnc_LaneType Noise = 0x12345678u;
+    Dbnc_LaneType Sink  = 0u;
+    uint64 Start;
+    uint64 Elapsed;
+
+    printf( "pins  ns/tick\n" );
+    for( uint8 i = 0u; i < ( sizeof( Pins ) / sizeof( Pins[ 0 ] ) ); i++ )
+    {
+        Active = ( Pins[ i ] == DBNC_LANE_BITS ) ? ~(Dbnc_LaneType)0u : ( ( (Dbnc_LaneType)1u << Pins[ i ] ) - 1u );
+        (void)Dbnc_Init( &State, 0u, ( 1u << DBNC_COUNTER_BITS ) - 1u );
+
+        Start = Bench_Now();
+        for( uint32 Tick = 0u; Tick < BENCH_TICKS; Tick++ )
+        {
+            /*xorshift noise so the active inputs bounce on every tick*/
+            Noise ^= Noise << 13u;
+            Noise ^= Noise >> 7u;
+            Noise ^= Noise << 17u;
+            Sink ^= Dbnc_Update( &State, Noise & Active );
+        }
+        Elapsed = Bench_Now() - Start;
+
+        printf( "%4u  %7.2f\n", Pins[ i ], (double)Elapsed / BENCH_TICKS );
+    }
+
+    Bench_Consume( Sink );
+    return 0;
+}
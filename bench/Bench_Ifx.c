@@ -0,0 +1,125 @@
+/**
+ * @file    Bench_Ifx.c
+ * @brief   **Host Benchmark for the Interpolation Routines**
+ *
+ * Measures the curve lookups per second with each search flavour across axis sizes, once with a
+ * slow ramp input that moves less than a segment per lookup, like a sensor sampled every control
+ * cycle, and once with random inputs. All the flavours look up the same equidistant axis so their
+ * results are compared, the benchmark fails when they disagree.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "Std_Types.h"
+#include "Bench.h"
+#include "Ifx.h"
+
+#define BENCH_LOOKUPS   2000000u
+#define BENCH_MAX_SIZE  1024u
+#define BENCH_SHIFT     6u
+
+typedef void ( *Bench_SearchType )( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N );
+
+static sint16 Axis[ BENCH_MAX_SIZE ];
+static sint16 Values[ BENCH_MAX_SIZE ];
+static sint16 Ramp[ BENCH_LOOKUPS ];
+static sint16 Random[ BENCH_LOOKUPS ];
+
+static void Bench_Linear( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N )
+{
+    Ifx_DPSearchLinear_s16( dpResult, Xin, N, Axis );
+}
+
+static void Bench_Binary( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N )
+{
+    Ifx_DPSearch_s16( dpResult, Xin, N, Axis );
+}
+
+static void Bench_Cached( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N )
+{
+    Ifx_DPSearchCached_s16( dpResult, Xin, N, Axis );
+}
+
+static void Bench_Fix( Ifx_DPResultU16Type *dpResult, sint16 Xin, uint16 N )
+{
+    Ifx_DPSearchFix_s16( dpResult, Xin, N, Axis[ 0 ], BENCH_SHIFT );
+}
+
+static double Bench_Run( Bench_SearchType Search, uint16 N, const sint16 *Inputs, sint32 *Sink )
+{
+    Ifx_DPResultU16Type dpResult = { 0u, 0u };
+    uint64 Start                 = Bench_Now();
+
+    for( uint32 i = 0u; i < BENCH_LOOKUPS; i++ )
+    {
+        Search( &dpResult, Inputs[ i ], N );
+        *Sink += Ifx_IpoCur_s16( &dpResult, Values );
+    }
+
+    return (double)BENCH_LOOKUPS * 1000.0 / (double)( Bench_Now() - Start );
+}
+
+int main( void )
+{
+    static const uint16 Sizes[] = { 8u, 32u, 128u, 512u, BENCH_MAX_SIZE };
+    static const struct
+    {
+        const char *Name;
+        Bench_SearchType Search;
+    } Modes[] = {
+        { "linear", Bench_Linear },
+        { "binary", Bench_Binary },
+        { "cached", Bench_Cached },
+        { "fix", Bench_Fix },
+    };
+    uint32 Seed  = 0x12345678u;
+    sint32 Sink  = 0;
+    int Mismatch = 0;
+    sint32 Span;
+    sint32 Expected;
+    sint32 Result;
+
+    for( uint32 i = 0u; i < BENCH_MAX_SIZE; i++ )
+    {
+        Axis[ i ]   = (sint16)( -32768 + (sint32)( i << BENCH_SHIFT ) );
+        Values[ i ] = (sint16)( ( i * 7919u ) & 0x7FFFu );
+    }
+
+    printf( "size  mode     ramp Mlookup/s  random Mlookup/s\n" );
+    for( uint32 s = 0u; s < ( sizeof( Sizes ) / sizeof( Sizes[ 0 ] ) ); s++ )
+    {
+        Span = (sint32)( Sizes[ s ] - 1u ) << BENCH_SHIFT;
+        for( uint32 i = 0u; i < BENCH_LOOKUPS; i++ )
+        {
+            /*the ramp goes up and down the whole axis in steps of a quarter of a segment*/
+            Ramp[ i ] = (sint16)( -32768 + (sint32)( ( i * 16u ) % ( 2u * (uint32)Span ) ) );
+            if( Ramp[ i ] > ( -32768 + Span ) )
+            {
+                Ramp[ i ] = (sint16)( ( 2 * ( -32768 + Span ) ) - Ramp[ i ] );
+            }
+            Seed ^= Seed << 13u;
+            Seed ^= Seed >> 17u;
+            Seed ^= Seed << 5u;
+            Random[ i ] = (sint16)( -32768 + (sint32)( Seed % (uint32)Span ) );
+        }
+
+        for( uint32 m = 0u; m < ( sizeof( Modes ) / sizeof( Modes[ 0 ] ) ); m++ )
+        {
+            Expected = 0;
+            Result   = 0;
+            (void)Bench_Run( Modes[ 1 ].Search, Sizes[ s ], Random, &Expected );
+            (void)Bench_Run( Modes[ m ].Search, Sizes[ s ], Random, &Result );
+            if( Result != Expected )
+            {
+                printf( "%s mismatch for size %u\n", Modes[ m ].Name, Sizes[ s ] );
+                Mismatch = 1;
+            }
+
+            printf( "%4u  %-7s  %14.2f  %16.2f\n", Sizes[ s ], Modes[ m ].Name,
+                    Bench_Run( Modes[ m ].Search, Sizes[ s ], Ramp, &Sink ),
+                    Bench_Run( Modes[ m ].Search, Sizes[ s ], Random, &Sink ) );
+        }
+    }
+
+    Bench_Consume( (uint32)Sink );
+    return Mismatch;
+}
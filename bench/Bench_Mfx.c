@@ -0,0 +1,133 @@
+/**
+ * @file    Bench_Mfx.c
+ * @brief   **Host Benchmark for the Fixed Point Math Routines**
+ *
+ * Compares the Mfx routines, built with 32 bit operations only as they run on the Cortex-M0+,
+ * against a reference using the native 64 bit types and the division operator. Both sides process
+ * the same pseudo random operands and their results are compared, so the benchmark also fails when
+ * a routine and its reference disagree.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "Std_Types.h"
+#include "Bench.h"
+#include "Bfx.h"
+#include "Mfx.h"
+
+#define BENCH_OPERANDS 4096u
+#define BENCH_ROUNDS   2000u
+
+typedef sint32 ( *Bench_RoutineType )( sint32 x_value, sint32 y_value );
+
+static sint32 X[ BENCH_OPERANDS ];
+static sint32 Y[ BENCH_OPERANDS ];
+
+static sint32 Ref_Saturate( sint64 Value )
+{
+    return ( Value > INT32_MAX ) ? INT32_MAX : ( ( Value < INT32_MIN ) ? INT32_MIN : (sint32)Value );
+}
+
+static sint32 Ref_Add( sint32 x_value, sint32 y_value )
+{
+    return Ref_Saturate( (sint64)x_value + y_value );
+}
+
+static sint32 Ref_Mul( sint32 x_value, sint32 y_value )
+{
+    return Ref_Saturate( (sint64)x_value * y_value );
+}
+
+static sint32 Ref_Div( sint32 x_value, sint32 y_value )
+{
+    return ( y_value == 0 ) ? ( ( x_value < 0 ) ? INT32_MIN : INT32_MAX ) : Ref_Saturate( (sint64)x_value / y_value );
+}
+
+static sint32 Ref_MulQ16( sint32 x_value, sint32 y_value )
+{
+    return Ref_Saturate( ( (sint64)x_value * y_value ) >> 16 );
+}
+
+static sint32 Ref_DivQ16( sint32 x_value, sint32 y_value )
+{
+    return ( y_value == 0 ) ? ( ( x_value < 0 ) ? INT32_MIN : INT32_MAX ) : Ref_Saturate( (sint64)x_value * 65536 / y_value );
+}
+
+static sint32 Mfx_MulQ16( sint32 x_value, sint32 y_value )
+{
+    return Mfx_MulShRight_s32s32u8_s32( x_value, y_value, 16u );
+}
+
+static sint32 Mfx_DivQ16( sint32 x_value, sint32 y_value )
+{
+    return Mfx_DivShLeft_s32s32u8_s32( x_value, y_value, 16u );
+}
+
+static double Bench_Run( Bench_RoutineType Routine, sint32 *Sink )
+{
+    uint64 Start = Bench_Now();
+
+    for( uint32 Round = 0u; Round < BENCH_ROUNDS; Round++ )
+    {
+        for( uint32 i = 0u; i < BENCH_OPERANDS; i++ )
+        {
+            *Sink ^= Routine( X[ i ], Y[ i ] );
+        }
+    }
+
+    return (double)( Bench_Now() - Start ) / ( (double)BENCH_ROUNDS * BENCH_OPERANDS );
+}
+
+int main( void )
+{
+    static const struct
+    {
+        const char *Name;
+        Bench_RoutineType Mfx;
+        Bench_RoutineType Ref;
+    } Routines[] = {
+        { "add", Mfx_Add_s32s32_s32, Ref_Add },
+        { "mul", Mfx_Mul_s32s32_s32, Ref_Mul },
+        { "div", Mfx_Div_s32s32_s32, Ref_Div },
+        { "mulq16", Mfx_MulQ16, Ref_MulQ16 },
+        { "divq16", Mfx_DivQ16, Ref_DivQ16 },
+    };
+    uint32 Seed  = 0x12345678u;
+    sint32 Sink  = 0;
+    int Mismatch = 0;
+    double Mfx;
+    double Ref;
+
+    for( uint32 i = 0u; i < BENCH_OPERANDS; i++ )
+    {
+        /*xorshift operands with random magnitudes so the saturation and the short divisions show up*/
+        Seed ^= Seed << 13u;
+        Seed ^= Seed >> 17u;
+        Seed ^= Seed << 5u;
+        X[ i ] = (sint32)Seed >> ( Seed & 15u );
+        Seed ^= Seed << 13u;
+        Seed ^= Seed >> 17u;
+        Seed ^= Seed << 5u;
+        Y[ i ] = (sint32)Seed >> ( ( Seed >> 8u ) & 31u );
+    }
+
+    printf( "routine  mfx ns/op  ref ns/op\n" );
+    for( uint32 r = 0u; r < ( sizeof( Routines ) / sizeof( Routines[ 0 ] ) ); r++ )
+    {
+        for( uint32 i = 0u; i < BENCH_OPERANDS; i++ )
+        {
+            if( Routines[ r ].Mfx( X[ i ], Y[ i ] ) != Routines[ r ].Ref( X[ i ], Y[ i ] ) )
+            {
+                printf( "%s mismatch for %d, %d\n", Routines[ r ].Name, X[ i ], Y[ i ] );
+                Mismatch = 1;
+                break;
+            }
+        }
+
+        Mfx = Bench_Run( Routines[ r ].Mfx, &Sink );
+        Ref = Bench_Run( Routines[ r ].Ref, &Sink );
+        printf( "%-7s  %9.2f  %9.2f\n", Routines[ r ].Name, Mfx, Ref );
+    }
+
+    Bench_Consume( (uint32)Sink );
+    return Mismatch;
+}
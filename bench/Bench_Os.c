@@ -0,0 +1,105 @@
+/**
+ * @file    Bench_Os.c
+ * @brief   **Host Benchmark for the Priority Bitmap Task Scheduler**
+ *
+ * Measures the time from ActivateTask to the entry of the task, and the cost of dispatching a
+ * batch of 1, 8 and 32 ready tasks. The time per dispatch should stay the same for any number of
+ * ready tasks, since each pick is a single count of leading zeros over the ready bitmap. The
+ * benchmark fails when the tasks do not run in priority order.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "Std_Types.h"
+#include "Bench.h"
+#include "Os.h"
+
+#define BENCH_ROUNDS 200000u
+
+static uint64 Entry;
+static uint32 Last;
+static uint32 Order;
+
+/*every task checks it runs after a higher priority one, Last is reset to 32 before each batch*/
+#define BENCH_TASK( n )                   \
+    static void Bench_Task_##n( void )    \
+    {                                     \
+        Entry = Bench_Now();              \
+        Order |= ( Last <= n ) ? 1u : 0u; \
+        Last = n;                         \
+    }
+
+/* clang-format off */
+BENCH_TASK( 0 )  BENCH_TASK( 1 )  BENCH_TASK( 2 )  BENCH_TASK( 3 )  BENCH_TASK( 4 )  BENCH_TASK( 5 )
+BENCH_TASK( 6 )  BENCH_TASK( 7 )  BENCH_TASK( 8 )  BENCH_TASK( 9 )  BENCH_TASK( 10 ) BENCH_TASK( 11 )
+BENCH_TASK( 12 ) BENCH_TASK( 13 ) BENCH_TASK( 14 ) BENCH_TASK( 15 ) BENCH_TASK( 16 ) BENCH_TASK( 17 )
+BENCH_TASK( 18 ) BENCH_TASK( 19 ) BENCH_TASK( 20 ) BENCH_TASK( 21 ) BENCH_TASK( 22 ) BENCH_TASK( 23 )
+BENCH_TASK( 24 ) BENCH_TASK( 25 ) BENCH_TASK( 26 ) BENCH_TASK( 27 ) BENCH_TASK( 28 ) BENCH_TASK( 29 )
+BENCH_TASK( 30 ) BENCH_TASK( 31 )
+
+static const Os_TaskEntryType Tasks[ OS_MAX_TASKS ] = {
+    Bench_Task_0,  Bench_Task_1,  Bench_Task_2,  Bench_Task_3,  Bench_Task_4,  Bench_Task_5,
+    Bench_Task_6,  Bench_Task_7,  Bench_Task_8,  Bench_Task_9,  Bench_Task_10, Bench_Task_11,
+    Bench_Task_12, Bench_Task_13, Bench_Task_14, Bench_Task_15, Bench_Task_16, Bench_Task_17,
+    Bench_Task_18, Bench_Task_19, Bench_Task_20, Bench_Task_21, Bench_Task_22, Bench_Task_23,
+    Bench_Task_24, Bench_Task_25, Bench_Task_26, Bench_Task_27, Bench_Task_28, Bench_Task_29,
+    Bench_Task_30, Bench_Task_31 };
+/* clang-format on */
+
+static const Os_ConfigType Config = { Tasks, OS_MAX_TASKS, NULL_PTR };
+
+static double Bench_Latency( TaskType Task )
+{
+    uint64 Total = 0u;
+    uint64 Start;
+
+    for( uint32 Round = 0u; Round < BENCH_ROUNDS; Round++ )
+    {
+        Last  = 32u;
+        Start = Bench_Now();
+        (void)ActivateTask( Task );
+        (void)Schedule();
+        Total += Entry - Start;
+    }
+
+    return (double)Total / BENCH_ROUNDS;
+}
+
+static double Bench_Dispatch( uint32 Count )
+{
+    /*spread the ready tasks over the whole bitmap*/
+    uint32 Stride = OS_MAX_TASKS / Count;
+    uint64 Start  = Bench_Now();
+
+    for( uint32 Round = 0u; Round < BENCH_ROUNDS; Round++ )
+    {
+        Last = 32u;
+        for( uint32 Task = 0u; Task < OS_MAX_TASKS; Task += Stride )
+        {
+            (void)ActivateTask( (TaskType)Task );
+        }
+        (void)Schedule();
+    }
+
+    return (double)( Bench_Now() - Start ) / ( (double)BENCH_ROUNDS * Count );
+}
+
+int main( void )
+{
+    static const uint32 Counts[] = { 1u, 8u, 32u };
+
+    Os_Init( &Config );
+
+    printf( "activate to entry ns: priority 0 %.2f, priority 31 %.2f\n", Bench_Latency( 0u ), Bench_Latency( 31u ) );
+    printf( "ready  ns/dispatch\n" );
+    for( uint32 i = 0u; i < ( sizeof( Counts ) / sizeof( Counts[ 0 ] ) ); i++ )
+    {
+        printf( "%5u  %11.2f\n", Counts[ i ], Bench_Dispatch( Counts[ i ] ) );
+    }
+
+    if( Order != 0u )
+    {
+        printf( "tasks did not run in priority order\n" );
+    }
+
+    return ( Order != 0u ) ? 1 : 0;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file    Bench_Regs.c
+ * @brief   **Register Accesses per Driver Call on the Peripheral Simulator**
+ *
+ * Runs the Mcu, Dio and Tmr drivers unchanged on the host peripheral simulator and reports the
+ * register reads and writes each API call costs, the figure that dominates their time on the M0+
+ * where every peripheral access goes over the bus. The benchmark fails when a call does not leave
+ * the simulated hardware in the expected state.
+ */
+#include <stdio.h>
+#include "Std_Types.h"
+#include "Reg_Map.h"
+#include "Sim.h"
+#include "Mcu.h"
+#include "Dio.h"
+#include "Tmr.h"
+
+/*the Tmr tick handler, the simulator takes the SysTick exceptions*/
+void SysTick_Handler( void );
+
+static uint32 Failures;
+static uint32 Expiries;
+
+void Tmr_HostWaitForInterrupt( void )
+{
+    Sim_WaitForInterrupt();
+}
+
+static void Bench_Expired( void )
+{
+    Expiries++;
+}
+
+static void Bench_Report( const char *Api, boolean Passed )
+{
+    uint32 Reads = 0u;
+
+    for( uint32 Peripheral = 0u; Peripheral < (uint32)SIM_PERIPHERALS; Peripheral++ )
+    {
+        Reads += Sim_GetCounters( (Sim_PeripheralType)Peripheral )->Reads;
+    }
+    printf( "%-22s %6u %7u %8u  %s\n", Api, Reads, Sim_GetWrites(), Sim_GetCounters( SIM_OTHER )->Reads + Sim_GetCounters( SIM_OTHER )->Writes,
+            ( Passed == TRUE ) ? "ok" : "FAILED" );
+    Failures += ( Passed == TRUE ) ? 0u : 1u;
+    Sim_ResetCounters();
+}
+
+int main( void )
+{
+    static Tmr_TimerType Timer;
+    Dio_PortSnapshotType Snapshot;
+    Std_ReturnType Status;
+    uint32 Ticks;
+    uint32 Idles = 0u;
+
+    Sim_Init();
+    Sim_SetSysTickHandler( SysTick_Handler );
+
+    printf( "api                     reads  writes  unknown\n" );
+    Status = Mcu_InitClock();
+    Bench_Report( "Mcu_InitClock", ( Status == E_OK ) ? TRUE : FALSE );
+
+    /*clock the ports and leave A and C as inputs, the job of a port driver*/
+    REG_WRITE( &REG_RCC->IOPENR, 0x0Fu );
+    REG_WRITE( &REG_GPIOA->MODER, 0u );
+    REG_WRITE( &REG_GPIOC->MODER, 0u );
+    Sim_SetInput( DIO_PORT_A, 0x0020u );
+    Sim_SetInput( DIO_PORT_C, 0xA5A5u );
+    Sim_ResetCounters();
+
+    Bench_Report( "Dio_ReadChannel", ( Dio_ReadChannel( DIO_CHANNEL( DIO_PORT_A, 5u ) ) == STD_HIGH ) ? TRUE : FALSE );
+    Bench_Report( "Dio_ReadPort", ( Dio_ReadPort( DIO_PORT_C ) == 0xA5A5u ) ? TRUE : FALSE );
+    Dio_ReadPortSnapshot( &Snapshot );
+    Bench_Report( "Dio_ReadPortSnapshot", ( Snapshot.Port[ DIO_PORT_C ] == 0xA5A5u ) ? TRUE : FALSE );
+
+    Tmr_Init();
+    Bench_Report( "Tmr_Init", ( ( Sim_Peek32( REG_SYSTICK_BASE ) & 0x7u ) == 0x7u ) ? TRUE : FALSE );
+
+    Sim_Advance( 64000u * 3u );
+    Ticks = Tmr_GetTicks();
+    Bench_Report( "SysTick 3ms", ( Ticks == 3u ) ? TRUE : FALSE );
+
+    /*the idle sleeps until the next wheel event, a cascade or the expiry, the OS calls it with the
+    interrupts masked and the tick runs once unmasked*/
+    (void)Tmr_Start( &Timer, 100u, 0u, Bench_Expired );
+    Sim_ResetCounters();
+    while( ( Expiries == 0u ) && ( Idles < 100u ) )
+    {
+        Sim_SetInterruptMask( TRUE );
+        Tmr_Idle();
+        Sim_SetInterruptMask( FALSE );
+        Idles++;
+    }
+    printf( "%u idle calls, %u SysTick exceptions\n", Idles, Sim_GetSysTickExceptions() );
+    Bench_Report( "Tmr_Idle 100 ticks", ( Tmr_GetTicks() == ( Ticks + 100u ) ) ? TRUE : FALSE );
+
+    return ( Failures != 0u ) ? 1 : 0;
+}
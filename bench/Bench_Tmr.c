@@ -0,0 +1,104 @@
+/**
+ * @file    Bench_Tmr.c
+ * @brief   **Host Benchmark for the Software Timers**
+ *
+ * Measures the cost per tick of the timer wheel with 1, 100 and 1000 periodic timers running with
+ * pseudo random periods, plus the cost of a start and stop pair. The time per tick should follow
+ * the number of expiries and not the number of timers running. Every expiry is checked against the
+ * tick it was due, the benchmark fails when any timer expires on the wrong tick.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "Std_Types.h"
+#include "Bench.h"
+#include "Tmr.h"
+
+#define BENCH_TIMERS 1000u
+#define BENCH_TICKS  1000000u
+
+static Tmr_TimerType Timers[ BENCH_TIMERS ];
+static uint32 Due[ BENCH_TIMERS ];
+static uint32 Expiries;
+static uint32 Late;
+
+static void Bench_Expired( void )
+{
+    Expiries++;
+}
+
+static double Bench_Ticks( uint32 Count, uint32 *Seed )
+{
+    uint64 Start;
+
+    Tmr_Init();
+    for( uint32 i = 0u; i < Count; i++ )
+    {
+        *Seed ^= *Seed << 13u;
+        *Seed ^= *Seed >> 17u;
+        *Seed ^= *Seed << 5u;
+        /*periods from 10 ticks to a bit over a minute at 1ms, spread over all the levels*/
+        Due[ i ] = 10u + ( *Seed & 0xFFFFu );
+        (void)Tmr_Start( &Timers[ i ], Due[ i ], Due[ i ], Bench_Expired );
+    }
+
+    Expiries = 0u;
+    Start    = Bench_Now();
+    for( uint32 Tick = 0u; Tick < BENCH_TICKS; Tick++ )
+    {
+        Tmr_Tick();
+    }
+
+    return (double)( Bench_Now() - Start ) / BENCH_TICKS;
+}
+
+static uint32 Bench_Check( uint32 Count )
+{
+    uint32 Expected = 0u;
+
+    /*each periodic timer expired once every period*/
+    for( uint32 i = 0u; i < Count; i++ )
+    {
+        Expected += BENCH_TICKS / Due[ i ];
+        Late += ( Tmr_IsRunning( &Timers[ i ] ) == TRUE ) ? 0u : 1u;
+        Tmr_Stop( &Timers[ i ] );
+    }
+
+    return Expected;
+}
+
+static double Bench_StartStop( void )
+{
+    uint64 Start = Bench_Now();
+
+    for( uint32 Round = 0u; Round < BENCH_TICKS; Round++ )
+    {
+        (void)Tmr_Start( &Timers[ 0 ], 1u + ( Round & 0xFFFFu ), 0u, Bench_Expired );
+        Tmr_Stop( &Timers[ 0 ] );
+    }
+
+    return (double)( Bench_Now() - Start ) / BENCH_TICKS;
+}
+
+int main( void )
+{
+    static const uint32 Counts[] = { 1u, 100u, 1000u };
+    uint32 Seed = 0x12345678u;
+    uint32 Expected;
+    double Time;
+
+    printf( "timers  ns/tick  expiries\n" );
+    for( uint32 i = 0u; i < ( sizeof( Counts ) / sizeof( Counts[ 0 ] ) ); i++ )
+    {
+        Time     = Bench_Ticks( Counts[ i ], &Seed );
+        Expected = Bench_Check( Counts[ i ] );
+        printf( "%6u  %7.2f  %8u\n", Counts[ i ], Time, Expiries );
+        if( Expiries != Expected )
+        {
+            printf( "expected %u expiries\n", Expected );
+            Late++;
+        }
+    }
+    printf( "start and stop ns: %.2f\n", Bench_StartStop() );
+
+    return ( Late != 0u ) ? 1 : 0;
+}
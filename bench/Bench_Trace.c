@@ -0,0 +1,152 @@
+/**
+ * @file    Bench_Trace.c
+ * @brief   **Trace of the Scheduler and Timers on the Peripheral Simulator**
+ *
+ * Measures the host time per TRACE with the timestamp read from the simulated SysTick, then runs
+ * the Os and Tmr services with their trace points on over the host peripheral simulator the way
+ * main.c runs them on the target, two periodic timers activate two tasks from the SysTick interrupt
+ * and the core sleeps in Tmr_Idle in between. The trace buffer is written to the file given as
+ * argument, meson decodes it with tools/trace_decode.py. The benchmark fails when a ring does not
+ * hold the records of the run or its timestamps go backwards.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "Std_Types.h"
+#include "Bench.h"
+#include "Sim.h"
+#include "Os.h"
+#include "Tmr.h"
+#include "Trace.h"
+
+/* clang-format off */
+#define BENCH_ROUNDS            1000000u
+#define BENCH_EXCEPTION_ENTRY   15u                         /*!< M0+ interrupt latency in cycles */
+#define BENCH_TICKS             40u                         /*!< ticks of the traced run */
+#define BENCH_TRACE_EVENT_WORK  ( TRACE_EVENT_USER + 1u )   /*!< task body, arg is the tick count */
+/* clang-format on */
+
+/*the Tmr tick handler, the simulator takes the SysTick exceptions*/
+void SysTick_Handler( void );
+
+static void Bench_SysTick( void );
+static void Bench_Fast( void );
+static void Bench_Slow( void );
+static void Bench_FastTimer( void );
+static void Bench_SlowTimer( void );
+
+static const Os_TaskEntryType Tasks[] = { Bench_Slow, Bench_Fast };
+static const Os_ConfigType Config     = { Tasks, 2u, NULL_PTR };
+static uint32 Activations;
+static uint32 Expiries;
+
+void Tmr_HostWaitForInterrupt( void )
+{
+    Sim_WaitForInterrupt();
+}
+
+/*the simulator takes the exception with the counter at zero, the core spends the exception entry
+before the handler and the counter has reloaded by then, the timestamps count on it*/
+static void Bench_SysTick( void )
+{
+    Sim_Advance( BENCH_EXCEPTION_ENTRY );
+    SysTick_Handler();
+}
+
+static void Bench_Fast( void )
+{
+    TRACE( TRACE_CONTEXT_TASK, BENCH_TRACE_EVENT_WORK, Tmr_GetTicks() );
+}
+
+static void Bench_Slow( void )
+{
+    TRACE( TRACE_CONTEXT_TASK, BENCH_TRACE_EVENT_WORK, Tmr_GetTicks() );
+    /*long enough to be preempted by the next tick*/
+    Sim_Advance( 80000u );
+}
+
+static void Bench_FastTimer( void )
+{
+    Expiries++;
+    Activations += ( ActivateTask( 1u ) == E_OK ) ? 1u : 0u;
+}
+
+static void Bench_SlowTimer( void )
+{
+    Expiries++;
+    Activations += ( ActivateTask( 0u ) == E_OK ) ? 1u : 0u;
+}
+
+/*every ring holds the records expected, from the oldest one the timestamps never go backwards*/
+static boolean Bench_Check( uint8 Context, uint32 Records )
+{
+    const Trace_RingType *Ring = &Trace_Buffer.Ring[ Context ];
+    uint32 Count               = ( Ring->Head < TRACE_RECORDS ) ? Ring->Head : TRACE_RECORDS;
+    boolean Passed             = ( Ring->Head == Records ) ? TRUE : FALSE;
+
+    for( uint32 Record = Ring->Head - Count + 1u; Record < Ring->Head; Record++ )
+    {
+        if( Ring->Records[ Record & ( TRACE_RECORDS - 1u ) ].Stamp < Ring->Records[ ( Record - 1u ) & ( TRACE_RECORDS - 1u ) ].Stamp )
+        {
+            Passed = FALSE;
+        }
+    }
+
+    return Passed;
+}
+
+int main( int argc, char *argv[] )
+{
+    static Tmr_TimerType Fast;
+    static Tmr_TimerType Slow;
+    boolean Passed;
+    uint64 Start;
+    double Time;
+    FILE *Dump;
+
+    Sim_Init();
+    Sim_SetSysTickHandler( Bench_SysTick );
+    Trace_Init();
+
+    Start = Bench_Now();
+    for( uint32 Round = 0u; Round < BENCH_ROUNDS; Round++ )
+    {
+        TRACE( TRACE_CONTEXT_TASK, TRACE_EVENT_USER, Round );
+    }
+    Time = (double)( Bench_Now() - Start ) / BENCH_ROUNDS;
+    printf( "TRACE                   %6.2f ns/record, simulated SysTick read included\n", Time );
+
+    Trace_Init();
+    Os_Init( &Config );
+    Tmr_Init();
+    (void)Tmr_Start( &Fast, 3u, 3u, Bench_FastTimer );
+    (void)Tmr_Start( &Slow, 10u, 10u, Bench_SlowTimer );
+
+    /*StartOS without the endless loop, the ticks run once the idle unmasks the interrupts*/
+    while( Tmr_GetTicks() < BENCH_TICKS )
+    {
+        (void)Schedule();
+        Sim_SetInterruptMask( TRUE );
+        Tmr_Idle();
+        Sim_SetInterruptMask( FALSE );
+    }
+    (void)Schedule();
+
+    Passed = ( Bench_Check( TRACE_CONTEXT_TASK, Activations * 3u ) == TRUE ) && ( Bench_Check( TRACE_CONTEXT_ISR, Expiries ) == TRUE );
+    printf( "%u ticks, %u timer expiries, %u task runs traced on %u contexts  %s\n", Tmr_GetTicks(), Expiries, Activations,
+            TRACE_CONTEXTS, ( Passed == TRUE ) ? "ok" : "FAILED" );
+
+    if( argc > 1 )
+    {
+        Dump = fopen( argv[ 1 ], "wb" );
+        if( ( Dump == NULL ) || ( fwrite( &Trace_Buffer, sizeof( Trace_Buffer ), 1u, Dump ) != 1u ) )
+        {
+            Passed = FALSE;
+        }
+        if( Dump != NULL )
+        {
+            (void)fclose( Dump );
+        }
+    }
+
+    return ( Passed == TRUE ) ? 0 : 1;
+}
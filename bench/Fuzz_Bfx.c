@@ -0,0 +1,344 @@
+/**
+ * @file    Fuzz_Bfx.c
+ * @brief   **Fuzz Harness for the Bit Handling Routines**
+ *
+ * Feeds the 32 and 64 bit Bfx routines with operands, positions, lengths and shift counts taken
+ * from the fuzzer input and compares every result against the reference model, these routines have
+ * too many argument combinations to be checked exhaustively as the verifier does for 8 and 16 bits.
+ * The harness is built with the undefined behavior sanitizer, so shifts by the width of the type or
+ * of a negative value stop the run as well as a wrong result.
+ *
+ * The first byte of the input selects the routine, the next three bytes are the position, the
+ * length and the shift count, and the rest holds the data, the second operand and the mask, 8 bytes
+ * each. Positions and lengths are reduced to the range allowed by the specification, missing bytes
+ * read as zero.
+ *
+ * Built with clang the harness links against libFuzzer, which grows the corpus under coverage
+ * guidance, any other compiler gets a driver that replays the files given in the command line or
+ * in the directories given, or stdin when there are none, the way AFL runs its targets.
+ *
+ * $ meson test -C build fuzz_bfx
+ * $ ./build/fuzz_bfx -max_total_time=600 ../bench/corpus/bfx           (clang, libFuzzer)
+ * $ ./build/fuzz_bfx -merge=1 ../bench/corpus/bfx new_corpus           (clang, minimise the corpus)
+ * $ ./build/fuzz_bfx -runs=1000000                                     (other compilers, random inputs)
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "Std_Types.h"
+#include "Bfx.h"
+#include "Ref_Bfx.h"
+
+#define FUZZ_INPUT_SIZE 28u
+
+/**
+ * @brief   Routine arguments decoded from the fuzzer input
+ */
+typedef struct Fuzz_InputType_Tag
+{
+    uint8 Routine;  /*!< index of the routine in the table */
+    uint8 Position; /*!< bit position, or start of a bit field */
+    uint8 Length;   /*!< length of a bit field, the lowest bit is also the status to write */
+    uint8 Count;    /*!< shift count, or source position of a bit copy */
+    uint64 Data;    /*!< data operand */
+    uint64 Operand; /*!< second operand or pattern */
+    uint64 Mask;    /*!< mask of the three operand routines */
+} Fuzz_InputType;
+
+typedef boolean ( *Fuzz_RoutineType )( const Fuzz_InputType *Input, uint64 *Got, uint64 *Expected );
+
+/**
+ * @brief   Routine under test
+ */
+typedef struct Fuzz_EntryType_Tag
+{
+    const char *Name;         /*!< name of the Bfx routine */
+    Fuzz_RoutineType Routine; /*!< runs the routine and the reference, TRUE when both agree */
+} Fuzz_EntryType;
+
+/*one function per routine, the arguments are reduced to the width W before the call, the routine
+and the reference results are compared masked to the width*/
+/* clang-format off */
+#define FUZZ_ARGUMENTS( Type, W )                                                             \
+    Type Data       = (Type)( Input->Data & Ref_Ones( W ) );                                  \
+    Type Operand    = (Type)( Input->Operand & Ref_Ones( W ) );                               \
+    Type Mask       = (Type)( Input->Mask & Ref_Ones( W ) );                                  \
+    uint8 Pn        = Input->Position % ( W );                                                \
+    uint8 Ln        = Input->Length % ( ( W ) - Pn + 1u );                                    \
+    uint8 Cnt       = Input->Count % ( W );                                                   \
+    sint8 SatCnt    = (sint8)( (sint8)Input->Count % (sint8)( W ) );                          \
+    uint8 Status    = ( ( Input->Length & 1u ) != 0u ) ? TRUE : FALSE;                        \
+    (void)Operand; (void)Mask; (void)Ln; (void)Cnt; (void)SatCnt; (void)Status;
+#define FUZZ_INPLACE( Routine, Type, W, Call, Reference )                                     \
+    static boolean Fuzz_##Routine( const Fuzz_InputType *Input, uint64 *Got, uint64 *Expected ) \
+    {                                                                                         \
+        FUZZ_ARGUMENTS( Type, W )                                                             \
+        *Expected = ( Reference ) & Ref_Ones( W );                                            \
+        Routine Call;                                                                         \
+        *Got = (uint64)Data & Ref_Ones( W );                                                  \
+        return ( *Got == *Expected ) ? TRUE : FALSE;                                          \
+    }
+#define FUZZ_RETURN( Routine, Type, W, Call, Reference )                                      \
+    static boolean Fuzz_##Routine( const Fuzz_InputType *Input, uint64 *Got, uint64 *Expected ) \
+    {                                                                                         \
+        FUZZ_ARGUMENTS( Type, W )                                                             \
+        *Expected = ( Reference ) & Ref_Ones( W );                                            \
+        *Got      = (uint64)( Routine Call ) & Ref_Ones( W );                                 \
+        return ( *Got == *Expected ) ? TRUE : FALSE;                                          \
+    }
+/* clang-format on */
+
+FUZZ_INPLACE( Bfx_SetBit_u32u8, uint32, 32u, ( &Data, Pn ), Ref_PutBit( Data, Pn, 1u ) )
+FUZZ_INPLACE( Bfx_ClrBit_u32u8, uint32, 32u, ( &Data, Pn ), Ref_PutBit( Data, Pn, 0u ) )
+FUZZ_RETURN( Bfx_GetBit_u32u8_u8, uint32, 32u, ( Data, Pn ), Ref_Bit( Data, Pn ) )
+FUZZ_INPLACE( Bfx_PutBit_u32u8u8, uint32, 32u, ( &Data, Pn, Status ), Ref_PutBit( Data, Pn, Status ) )
+FUZZ_INPLACE( Bfx_SetBits_u32u8u8u8, uint32, 32u, ( &Data, Pn, Ln, Status ), Ref_SetBits( Data, Pn, Ln, Status ) )
+FUZZ_RETURN( Bfx_GetBits_u32u8u8_u32, uint32, 32u, ( Data, Pn, Ln ), Ref_GetBits( Data, Pn, Ln ) )
+FUZZ_INPLACE( Bfx_PutBits_u32u8u8u32, uint32, 32u, ( &Data, Pn, Ln, Operand ), Ref_PutBits( Data, Pn, Ln, Operand ) )
+FUZZ_INPLACE( Bfx_SetBitMask_u32u32, uint32, 32u, ( &Data, Operand ), Data | Operand )
+FUZZ_INPLACE( Bfx_ClrBitMask_u32u32, uint32, 32u, ( &Data, Operand ), Data & ~Operand )
+FUZZ_INPLACE( Bfx_ToggleBitMask_u32u32, uint32, 32u, ( &Data, Operand ), Data ^ Operand )
+FUZZ_RETURN( Bfx_TstBitMask_u32u32_u8, uint32, 32u, ( Data, Operand ), Ref_TstBitMask( Data, Operand, 32u ) )
+FUZZ_RETURN( Bfx_TstBitLnMask_u32u32_u8, uint32, 32u, ( Data, Operand ), Ref_TstBitLnMask( Data, Operand, 32u ) )
+FUZZ_INPLACE( Bfx_PutBitsMask_u32u32u32, uint32, 32u, ( &Data, Operand, Mask ), Ref_PutBitsMask( Data, Operand, Mask, 32u ) )
+FUZZ_INPLACE( Bfx_CopyBit_u32u8u32u8, uint32, 32u, ( &Data, Pn, Operand, Cnt ), Ref_PutBit( Data, Pn, Ref_Bit( Operand, Cnt ) ) )
+FUZZ_INPLACE( Bfx_ShiftBitRt_u32u8, uint32, 32u, ( &Data, Cnt ), Ref_ShiftRt( Data, Cnt, 32u ) )
+FUZZ_INPLACE( Bfx_ShiftBitLt_u32u8, uint32, 32u, ( &Data, Cnt ), Ref_ShiftLt( Data, Cnt, 32u ) )
+FUZZ_INPLACE( Bfx_RotBitRt_u32u8, uint32, 32u, ( &Data, Cnt ), Ref_RotRt( Data, Cnt, 32u ) )
+FUZZ_INPLACE( Bfx_RotBitLt_u32u8, uint32, 32u, ( &Data, Cnt ), Ref_RotLt( Data, Cnt, 32u ) )
+FUZZ_RETURN( Bfx_ShiftBitSat_u32s8_u32, uint32, 32u, ( Data, SatCnt ), Ref_ShiftSatU( Data, SatCnt, 32u ) )
+FUZZ_RETURN( Bfx_ShiftBitSat_s32s8_s32, sint32, 32u, ( Data, SatCnt ), Ref_ShiftSatS( (uint32)Data, SatCnt, 32u ) )
+FUZZ_RETURN( Bfx_DepositBits_u32u32_u32, uint32, 32u, ( Data, Operand ), Ref_Deposit( Data, Operand, 32u ) )
+FUZZ_RETURN( Bfx_ExtractBits_u32u32_u32, uint32, 32u, ( Data, Operand ), Ref_Extract( Data, Operand, 32u ) )
+
+FUZZ_INPLACE( Bfx_SetBit_u64u8, uint64, 64u, ( &Data, Pn ), Ref_PutBit( Data, Pn, 1u ) )
+FUZZ_INPLACE( Bfx_ClrBit_u64u8, uint64, 64u, ( &Data, Pn ), Ref_PutBit( Data, Pn, 0u ) )
+FUZZ_RETURN( Bfx_GetBit_u64u8_u8, uint64, 64u, ( Data, Pn ), Ref_Bit( Data, Pn ) )
+FUZZ_INPLACE( Bfx_PutBit_u64u8u8, uint64, 64u, ( &Data, Pn, Status ), Ref_PutBit( Data, Pn, Status ) )
+FUZZ_INPLACE( Bfx_SetBits_u64u8u8u8, uint64, 64u, ( &Data, Pn, Ln, Status ), Ref_SetBits( Data, Pn, Ln, Status ) )
+FUZZ_RETURN( Bfx_GetBits_u64u8u8_u64, uint64, 64u, ( Data, Pn, Ln ), Ref_GetBits( Data, Pn, Ln ) )
+FUZZ_INPLACE( Bfx_PutBits_u64u8u8u64, uint64, 64u, ( &Data, Pn, Ln, Operand ), Ref_PutBits( Data, Pn, Ln, Operand ) )
+FUZZ_INPLACE( Bfx_SetBitMask_u64u64, uint64, 64u, ( &Data, Operand ), Data | Operand )
+FUZZ_INPLACE( Bfx_ClrBitMask_u64u64, uint64, 64u, ( &Data, Operand ), Data & ~Operand )
+FUZZ_INPLACE( Bfx_ToggleBitMask_u64u64, uint64, 64u, ( &Data, Operand ), Data ^ Operand )
+FUZZ_RETURN( Bfx_TstBitMask_u64u64_u8, uint64, 64u, ( Data, Operand ), Ref_TstBitMask( Data, Operand, 64u ) )
+FUZZ_RETURN( Bfx_TstBitLnMask_u64u64_u8, uint64, 64u, ( Data, Operand ), Ref_TstBitLnMask( Data, Operand, 64u ) )
+FUZZ_INPLACE( Bfx_PutBitsMask_u64u64u64, uint64, 64u, ( &Data, Operand, Mask ), Ref_PutBitsMask( Data, Operand, Mask, 64u ) )
+FUZZ_INPLACE( Bfx_CopyBit_u64u8u64u8, uint64, 64u, ( &Data, Pn, Operand, Cnt ), Ref_PutBit( Data, Pn, Ref_Bit( Operand, Cnt ) ) )
+FUZZ_INPLACE( Bfx_ShiftBitRt_u64u8, uint64, 64u, ( &Data, Cnt ), Ref_ShiftRt( Data, Cnt, 64u ) )
+FUZZ_INPLACE( Bfx_ShiftBitLt_u64u8, uint64, 64u, ( &Data, Cnt ), Ref_ShiftLt( Data, Cnt, 64u ) )
+FUZZ_INPLACE( Bfx_RotBitRt_u64u8, uint64, 64u, ( &Data, Cnt ), Ref_RotRt( Data, Cnt, 64u ) )
+FUZZ_INPLACE( Bfx_RotBitLt_u64u8, uint64, 64u, ( &Data, Cnt ), Ref_RotLt( Data, Cnt, 64u ) )
+FUZZ_RETURN( Bfx_ShiftBitSat_u64s8_u64, uint64, 64u, ( Data, SatCnt ), Ref_ShiftSatU( Data, SatCnt, 64u ) )
+FUZZ_RETURN( Bfx_ShiftBitSat_s64s8_s64, sint64, 64u, ( Data, SatCnt ), Ref_ShiftSatS( (uint64)Data, SatCnt, 64u ) )
+FUZZ_RETURN( Bfx_DepositBits_u64u64_u64, uint64, 64u, ( Data, Operand ), Ref_Deposit( Data, Operand, 64u ) )
+FUZZ_RETURN( Bfx_ExtractBits_u64u64_u64, uint64, 64u, ( Data, Operand ), Ref_Extract( Data, Operand, 64u ) )
+FUZZ_INPLACE( Bfx_ToggleBits_u64, uint64, 64u, ( &Data ), ~Data )
+FUZZ_RETURN( Bfx_TstParityEven_u64_u8, uint64, 64u, ( Data ), Ref_ParityEven( Data, 64u ) )
+FUZZ_RETURN( Bfx_CountLeadingOnes_u64, uint64, 64u, ( Data ), Ref_CountLeading( Data, 64u, 1u ) )
+FUZZ_RETURN( Bfx_CountLeadingZeros_u64, uint64, 64u, ( Data ), Ref_CountLeading( Data, 64u, 0u ) )
+FUZZ_RETURN( Bfx_CountLeadingSigns_s64, sint64, 64u, ( Data ), Ref_CountLeadingSigns( (uint64)Data, 64u ) )
+
+/* clang-format off */
+#define FUZZ_ENTRY( Routine ) { #Routine, Fuzz_##Routine }
+static const Fuzz_EntryType Routines[] = {
+    FUZZ_ENTRY( Bfx_SetBit_u32u8 ),
+    FUZZ_ENTRY( Bfx_ClrBit_u32u8 ),
+    FUZZ_ENTRY( Bfx_GetBit_u32u8_u8 ),
+    FUZZ_ENTRY( Bfx_PutBit_u32u8u8 ),
+    FUZZ_ENTRY( Bfx_SetBits_u32u8u8u8 ),
+    FUZZ_ENTRY( Bfx_GetBits_u32u8u8_u32 ),
+    FUZZ_ENTRY( Bfx_PutBits_u32u8u8u32 ),
+    FUZZ_ENTRY( Bfx_SetBitMask_u32u32 ),
+    FUZZ_ENTRY( Bfx_ClrBitMask_u32u32 ),
+    FUZZ_ENTRY( Bfx_ToggleBitMask_u32u32 ),
+    FUZZ_ENTRY( Bfx_TstBitMask_u32u32_u8 ),
+    FUZZ_ENTRY( Bfx_TstBitLnMask_u32u32_u8 ),
+    FUZZ_ENTRY( Bfx_PutBitsMask_u32u32u32 ),
+    FUZZ_ENTRY( Bfx_CopyBit_u32u8u32u8 ),
+    FUZZ_ENTRY( Bfx_ShiftBitRt_u32u8 ),
+    FUZZ_ENTRY( Bfx_ShiftBitLt_u32u8 ),
+    FUZZ_ENTRY( Bfx_RotBitRt_u32u8 ),
+    FUZZ_ENTRY( Bfx_RotBitLt_u32u8 ),
+    FUZZ_ENTRY( Bfx_ShiftBitSat_u32s8_u32 ),
+    FUZZ_ENTRY( Bfx_ShiftBitSat_s32s8_s32 ),
+    FUZZ_ENTRY( Bfx_DepositBits_u32u32_u32 ),
+    FUZZ_ENTRY( Bfx_ExtractBits_u32u32_u32 ),
+    FUZZ_ENTRY( Bfx_SetBit_u64u8 ),
+    FUZZ_ENTRY( Bfx_ClrBit_u64u8 ),
+    FUZZ_ENTRY( Bfx_GetBit_u64u8_u8 ),
+    FUZZ_ENTRY( Bfx_PutBit_u64u8u8 ),
+    FUZZ_ENTRY( Bfx_SetBits_u64u8u8u8 ),
+    FUZZ_ENTRY( Bfx_GetBits_u64u8u8_u64 ),
+    FUZZ_ENTRY( Bfx_PutBits_u64u8u8u64 ),
+    FUZZ_ENTRY( Bfx_SetBitMask_u64u64 ),
+    FUZZ_ENTRY( Bfx_ClrBitMask_u64u64 ),
+    FUZZ_ENTRY( Bfx_ToggleBitMask_u64u64 ),
+    FUZZ_ENTRY( Bfx_TstBitMask_u64u64_u8 ),
+    FUZZ_ENTRY( Bfx_TstBitLnMask_u64u64_u8 ),
+    FUZZ_ENTRY( Bfx_PutBitsMask_u64u64u64 ),
+    FUZZ_ENTRY( Bfx_CopyBit_u64u8u64u8 ),
+    FUZZ_ENTRY( Bfx_ShiftBitRt_u64u8 ),
+    FUZZ_ENTRY( Bfx_ShiftBitLt_u64u8 ),
+    FUZZ_ENTRY( Bfx_RotBitRt_u64u8 ),
+    FUZZ_ENTRY( Bfx_RotBitLt_u64u8 ),
+    FUZZ_ENTRY( Bfx_ShiftBitSat_u64s8_u64 ),
+    FUZZ_ENTRY( Bfx_ShiftBitSat_s64s8_s64 ),
+    FUZZ_ENTRY( Bfx_DepositBits_u64u64_u64 ),
+    FUZZ_ENTRY( Bfx_ExtractBits_u64u64_u64 ),
+    FUZZ_ENTRY( Bfx_ToggleBits_u64 ),
+    FUZZ_ENTRY( Bfx_TstParityEven_u64_u8 ),
+    FUZZ_ENTRY( Bfx_CountLeadingOnes_u64 ),
+    FUZZ_ENTRY( Bfx_CountLeadingZeros_u64 ),
+    FUZZ_ENTRY( Bfx_CountLeadingSigns_s64 ),
+};
+/* clang-format on */
+
+static uint64 Fuzz_Read64( const uint8 *Bytes )
+{
+    uint64 Value = 0u;
+
+    for( uint8 i = 0u; i < 8u; i++ )
+    {
+        Value |= (uint64)Bytes[ i ] << ( 8u * i );
+    }
+    return Value;
+}
+
+int LLVMFuzzerTestOneInput( const uint8_t *Data, size_t Size );
+
+int LLVMFuzzerTestOneInput( const uint8_t *Data, size_t Size )
+{
+    uint8 Bytes[ FUZZ_INPUT_SIZE ] = { 0u };
+    const Fuzz_EntryType *Entry;
+    Fuzz_InputType Input;
+    uint64 Got;
+    uint64 Expected;
+
+    memcpy( Bytes, Data, ( Size < FUZZ_INPUT_SIZE ) ? Size : FUZZ_INPUT_SIZE );
+    Input.Routine  = Bytes[ 0 ] % ( sizeof( Routines ) / sizeof( Routines[ 0 ] ) );
+    Input.Position = Bytes[ 1 ];
+    Input.Length   = Bytes[ 2 ];
+    Input.Count    = Bytes[ 3 ];
+    Input.Data     = Fuzz_Read64( &Bytes[ 4 ] );
+    Input.Operand  = Fuzz_Read64( &Bytes[ 12 ] );
+    Input.Mask     = Fuzz_Read64( &Bytes[ 20 ] );
+
+    Entry = &Routines[ Input.Routine ];
+    if( Entry->Routine( &Input, &Got, &Expected ) == FALSE )
+    {
+        printf( "%s mismatch for position %u, length %u, count %u, data 0x%016llx, operand 0x%016llx, mask 0x%016llx\n",
+                Entry->Name, Input.Position, Input.Length, Input.Count, (unsigned long long)Input.Data,
+                (unsigned long long)Input.Operand, (unsigned long long)Input.Mask );
+        printf( "    got 0x%llx expected 0x%llx\n", (unsigned long long)Got, (unsigned long long)Expected );
+        abort();
+    }
+    return 0;
+}
+
+#if !defined( FUZZ_LIBFUZZER )
+static uint32 Fuzz_RunFile( const char *Path )
+{
+    uint8 Bytes[ FUZZ_INPUT_SIZE ];
+    size_t Size;
+    FILE *File = fopen( Path, "rb" );
+
+    if( File == NULL )
+    {
+        printf( "cannot open %s\n", Path );
+        exit( 1 );
+    }
+    Size = fread( Bytes, 1u, sizeof( Bytes ), File );
+    (void)fclose( File );
+    (void)LLVMFuzzerTestOneInput( Bytes, Size );
+    return 1u;
+}
+
+static uint32 Fuzz_RunPath( const char *Path )
+{
+    struct stat Info;
+    struct dirent *Entry;
+    char File[ 4096 ];
+    uint32 Inputs = 0u;
+    DIR *Directory;
+
+    if( ( stat( Path, &Info ) == 0 ) && S_ISDIR( Info.st_mode ) )
+    {
+        Directory = opendir( Path );
+        while( ( Directory != NULL ) && ( ( Entry = readdir( Directory ) ) != NULL ) )
+        {
+            if( Entry->d_name[ 0 ] != '.' )
+            {
+                (void)snprintf( File, sizeof( File ), "%s/%s", Path, Entry->d_name );
+                Inputs += Fuzz_RunFile( File );
+            }
+        }
+        if( Directory != NULL )
+        {
+            (void)closedir( Directory );
+        }
+    }
+    else
+    {
+        Inputs += Fuzz_RunFile( Path );
+    }
+    return Inputs;
+}
+
+static uint32 Fuzz_RunRandom( uint32 Runs )
+{
+    uint8 Bytes[ FUZZ_INPUT_SIZE ];
+    uint64 Seed = 0x9E3779B97F4A7C15u;
+
+    for( uint32 Run = 0u; Run < Runs; Run++ )
+    {
+        for( uint8 i = 0u; i < FUZZ_INPUT_SIZE; i++ )
+        {
+            /*xorshift bytes, with the operands biased to all zeros or all ones now and then since
+            that is where the shifts and the saturation go wrong*/
+            Seed ^= Seed << 13u;
+            Seed ^= Seed >> 7u;
+            Seed ^= Seed << 17u;
+            Bytes[ i ] = (uint8)Seed;
+            if( ( i >= 4u ) && ( ( ( Seed >> 40u ) & 7u ) == 0u ) )
+            {
+                Bytes[ i ] = ( ( Seed >> 43u ) & 1u ) ? 0xFFu : 0x00u;
+            }
+        }
+        (void)LLVMFuzzerTestOneInput( Bytes, sizeof( Bytes ) );
+    }
+    return Runs;
+}
+
+int main( int argc, char *argv[] )
+{
+    uint8 Bytes[ FUZZ_INPUT_SIZE ];
+    uint32 Inputs = 0u;
+    size_t Size;
+
+    for( int i = 1; i < argc; i++ )
+    {
+        if( strncmp( argv[ i ], "-runs=", 6u ) == 0 )
+        {
+            Inputs += Fuzz_RunRandom( (uint32)strtoul( &argv[ i ][ 6 ], NULL, 0 ) );
+        }
+        else
+        {
+            Inputs += Fuzz_RunPath( argv[ i ] );
+        }
+    }
+
+    if( argc == 1 )
+    {
+        Size = fread( Bytes, 1u, sizeof( Bytes ), stdin );
+        Inputs += (uint32)LLVMFuzzerTestOneInput( Bytes, Size ) + 1u;
+    }
+
+    printf( "%u inputs, no mismatches\n", Inputs );
+    return 0;
+}
+#endif
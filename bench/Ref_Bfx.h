@@ -0,0 +1,247 @@
+/**
+ * @file    Ref_Bfx.h
+ * @brief   **Reference Model of the Bit Handling Routines**
+ *
+ * Plain bit by bit versions of the Bfx routines for the host verifier and fuzz harness. Every
+ * routine works over a value of Width bits held in 64 bits and loops over the single bits, so it
+ * shares no shift or mask trick with the production code it checks. The arguments must be inside
+ * the range allowed by the specification.
+ */
+#ifndef REF_BFX_H
+#define REF_BFX_H
+
+#include "Std_Types.h"
+
+static inline uint64 Ref_Ones( uint8 Width )
+{
+    return ( Width == 64u ) ? ~0ull : ( ( 1ull << Width ) - 1u );
+}
+
+static inline uint64 Ref_Bit( uint64 Data, uint8 Pn )
+{
+    return ( Data >> Pn ) & 1u;
+}
+
+static inline uint64 Ref_PutBit( uint64 Data, uint8 Pn, uint64 Status )
+{
+    return ( Data & ~( 1ull << Pn ) ) | ( ( Status & 1u ) << Pn );
+}
+
+static inline uint64 Ref_PutBits( uint64 Data, uint8 Start, uint8 Ln, uint64 Pattern )
+{
+    for( uint8 i = 0u; i < Ln; i++ )
+    {
+        Data = Ref_PutBit( Data, Start + i, Ref_Bit( Pattern, i ) );
+    }
+    return Data;
+}
+
+static inline uint64 Ref_SetBits( uint64 Data, uint8 Start, uint8 Ln, uint64 Status )
+{
+    return Ref_PutBits( Data, Start, Ln, ( Status == TRUE ) ? ~0ull : 0u );
+}
+
+static inline uint64 Ref_GetBits( uint64 Data, uint8 Start, uint8 Ln )
+{
+    uint64 Bits = 0u;
+
+    for( uint8 i = 0u; i < Ln; i++ )
+    {
+        Bits = Ref_PutBit( Bits, i, Ref_Bit( Data, Start + i ) );
+    }
+    return Bits;
+}
+
+static inline uint64 Ref_PutBitsMask( uint64 Data, uint64 Pattern, uint64 Mask, uint8 Width )
+{
+    for( uint8 i = 0u; i < Width; i++ )
+    {
+        if( Ref_Bit( Mask, i ) != 0u )
+        {
+            Data = Ref_PutBit( Data, i, Ref_Bit( Pattern, i ) );
+        }
+    }
+    return Data;
+}
+
+static inline uint64 Ref_TstBitMask( uint64 Data, uint64 Mask, uint8 Width )
+{
+    uint64 All = TRUE;
+
+    for( uint8 i = 0u; i < Width; i++ )
+    {
+        if( ( Ref_Bit( Mask, i ) != 0u ) && ( Ref_Bit( Data, i ) == 0u ) )
+        {
+            All = FALSE;
+        }
+    }
+    return All;
+}
+
+static inline uint64 Ref_TstBitLnMask( uint64 Data, uint64 Mask, uint8 Width )
+{
+    uint64 Any = FALSE;
+
+    for( uint8 i = 0u; i < Width; i++ )
+    {
+        if( ( Ref_Bit( Mask, i ) != 0u ) && ( Ref_Bit( Data, i ) != 0u ) )
+        {
+            Any = TRUE;
+        }
+    }
+    return Any;
+}
+
+static inline uint64 Ref_ParityEven( uint64 Data, uint8 Width )
+{
+    uint64 Ones = 0u;
+
+    for( uint8 i = 0u; i < Width; i++ )
+    {
+        Ones += Ref_Bit( Data, i );
+    }
+    return ( ( Ones & 1u ) == 0u ) ? TRUE : FALSE;
+}
+
+static inline uint64 Ref_ShiftRt( uint64 Data, uint8 Cnt, uint8 Width )
+{
+    uint64 Result = 0u;
+
+    for( uint8 i = Cnt; i < Width; i++ )
+    {
+        Result = Ref_PutBit( Result, i - Cnt, Ref_Bit( Data, i ) );
+    }
+    return Result;
+}
+
+static inline uint64 Ref_ShiftLt( uint64 Data, uint8 Cnt, uint8 Width )
+{
+    uint64 Result = 0u;
+
+    for( uint8 i = Cnt; i < Width; i++ )
+    {
+        Result = Ref_PutBit( Result, i, Ref_Bit( Data, i - Cnt ) );
+    }
+    return Result;
+}
+
+static inline uint64 Ref_RotRt( uint64 Data, uint8 Cnt, uint8 Width )
+{
+    uint64 Result = 0u;
+
+    for( uint8 i = 0u; i < Width; i++ )
+    {
+        Result = Ref_PutBit( Result, i, Ref_Bit( Data, ( i + Cnt ) % Width ) );
+    }
+    return Result;
+}
+
+static inline uint64 Ref_RotLt( uint64 Data, uint8 Cnt, uint8 Width )
+{
+    return Ref_RotRt( Data, ( Width - Cnt ) % Width, Width );
+}
+
+static inline uint64 Ref_ShiftSatU( uint64 Data, sint8 Cnt, uint8 Width )
+{
+    uint64 Result;
+
+    if( Cnt >= 0 )
+    {
+        /*saturate when any bit set is shifted out*/
+        Result = ( Ref_ShiftRt( Data, Width - Cnt, Width ) != 0u ) ? Ref_Ones( Width ) : Ref_ShiftLt( Data, Cnt, Width );
+    }
+    else
+    {
+        Result = Ref_ShiftRt( Data, -Cnt, Width );
+    }
+    return Result;
+}
+
+static inline uint64 Ref_ShiftSatS( uint64 Data, sint8 Cnt, uint8 Width )
+{
+    uint64 Sign = Ref_Bit( Data, Width - 1u );
+    uint64 Result;
+
+    if( Cnt >= 0 )
+    {
+        Result = Ref_ShiftLt( Data, Cnt, Width );
+        /*saturate when a bit different from the sign is shifted out or into the sign*/
+        for( uint8 i = Width - 1u - Cnt; i < Width; i++ )
+        {
+            if( Ref_Bit( Data, i ) != Sign )
+            {
+                Result = ( Sign != 0u ) ? ( 1ull << ( Width - 1u ) ) : ( Ref_Ones( Width ) >> 1u );
+            }
+        }
+    }
+    else
+    {
+        Result = Ref_ShiftRt( Data, -Cnt, Width );
+        for( uint8 i = Width + Cnt; i < Width; i++ )
+        {
+            Result = Ref_PutBit( Result, i, Sign );
+        }
+    }
+    return Result;
+}
+
+static inline uint64 Ref_CountLeading( uint64 Data, uint8 Width, uint64 Value )
+{
+    uint64 Count = 0u;
+
+    for( uint8 i = Width; ( i > 0u ) && ( Ref_Bit( Data, i - 1u ) == Value ); i-- )
+    {
+        Count++;
+    }
+    return Count;
+}
+
+static inline uint64 Ref_CountLeadingSigns( uint64 Data, uint8 Width )
+{
+    return Ref_CountLeading( Data, Width - 1u, Ref_Bit( Data, Width - 1u ) );
+}
+
+static inline uint64 Ref_CountTrailingZeros( uint64 Data, uint8 Width )
+{
+    uint64 Count = 0u;
+
+    for( uint8 i = 0u; ( i < Width ) && ( Ref_Bit( Data, i ) == 0u ); i++ )
+    {
+        Count++;
+    }
+    return Count;
+}
+
+static inline uint64 Ref_Deposit( uint64 Data, uint64 Mask, uint8 Width )
+{
+    uint64 Result = 0u;
+    uint8 Next    = 0u;
+
+    for( uint8 i = 0u; i < Width; i++ )
+    {
+        if( Ref_Bit( Mask, i ) != 0u )
+        {
+            Result = Ref_PutBit( Result, i, Ref_Bit( Data, Next ) );
+            Next++;
+        }
+    }
+    return Result;
+}
+
+static inline uint64 Ref_Extract( uint64 Data, uint64 Mask, uint8 Width )
+{
+    uint64 Result = 0u;
+    uint8 Next    = 0u;
+
+    for( uint8 i = 0u; i < Width; i++ )
+    {
+        if( Ref_Bit( Mask, i ) != 0u )
+        {
+            Result = Ref_PutBit( Result, Next, Ref_Bit( Data, i ) );
+            Next++;
+        }
+    }
+    return Result;
+}
+
+#endif /* REF_BFX_H */
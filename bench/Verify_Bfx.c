@@ -0,0 +1,446 @@
+/**
+ * @file    Verify_Bfx.c
+ * @brief   **Exhaustive Differential Verifier for the Bit Handling Routines**
+ *
+ * Runs the scalar Bfx routines over their complete input space and compares every result against
+ * a reference model written with plain bit loops. The 8 and 16 bit routines are checked for every
+ * value of every argument inside the range allowed by the specification, the unary 32 bit routines
+ * are checked for all the 2^32 inputs. The 16 bit routines with three data operands would need 2^48
+ * inputs, for those the destination takes the inverted pattern so every bit written is a bit that
+ * changes. The block, transpose and 64 bit routines are left to the unit tests.
+ *
+ * The input space of a routine is numbered from 0 to 2^n - 1, the lowest bits of the number are
+ * the data operand and the upper bits the positions, counts or second operand. The space is cut in
+ * chunks and each thread owns an equal range of them, a thread that runs out of chunks steals half
+ * of the remaining range of the busiest thread, so a slow range never leaves cores idle.
+ *
+ * $ meson compile -C build verify
+ * $ ./build/verify_bfx [-j threads] [routine name filter]
+ *
+ * The verifier prints the number of inputs checked and the time spent per routine, plus the first
+ * input that mismatched, and fails when any routine disagrees with the reference.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "Std_Types.h"
+#include "Bench.h"
+#include "Bfx.h"
+#include "Ref_Bfx.h"
+
+#define VERIFY_CHUNK_BITS   12u
+#define VERIFY_MAX_THREADS  64u
+#define VERIFY_RANGE_HEAD   0x00000000FFFFFFFFull
+#define VERIFY_RANGE_TAIL_N 32u
+
+/**
+ * @brief   Result of a range of inputs
+ */
+typedef struct Verify_ResultType_Tag
+{
+    uint64 Checked;    /*!< inputs inside the valid range of the routine */
+    uint64 Mismatches; /*!< inputs where the routine and the reference disagree */
+    uint64 Failed;     /*!< lowest input that mismatched */
+    uint64 Got;        /*!< result of the routine for the lowest input that mismatched */
+    uint64 Expected;   /*!< result of the reference for the lowest input that mismatched */
+} Verify_ResultType;
+
+typedef void ( *Verify_RangeType )( uint64 First, uint64 Last, Verify_ResultType *Result );
+
+/**
+ * @brief   Routine under verification
+ */
+typedef struct Verify_RoutineType_Tag
+{
+    const char *Name;       /*!< name of the Bfx routine */
+    Verify_RangeType Range; /*!< checks a range of inputs */
+    uint8 Bits;             /*!< the input space has 2^Bits inputs */
+} Verify_RoutineType;
+
+/**
+ * @brief   Chunks left to a thread, the head in the lower half and the tail in the upper half,
+ *          packed in a single word so the owner and the thieves update it with one compare and swap
+ */
+typedef struct Verify_WorkerType_Tag
+{
+    uint64 Range;
+    Verify_ResultType Result;
+    const Verify_RoutineType *Routine;
+    struct Verify_WorkerType_Tag *Workers;
+    uint32 Threads;
+    uint32 Id;
+    pthread_t Thread;
+} Verify_WorkerType;
+
+static void Verify_Record( Verify_ResultType *Result, uint64 Index, uint64 Got, uint64 Expected )
+{
+    if( ( Result->Mismatches == 0u ) || ( Index < Result->Failed ) )
+    {
+        Result->Failed   = Index;
+        Result->Got      = Got;
+        Result->Expected = Expected;
+    }
+    Result->Mismatches++;
+}
+
+/*one range function per routine, Body runs for every input with the argument fields decoded from
+Index, VERIFY_SKIP leaves out the inputs outside the range of the specification and VERIFY_EXPECT
+compares the routine result against the reference*/
+/* clang-format off */
+#define VERIFY_ROUTINE( Routine, Body )                                                      \
+    static void Verify_##Routine( uint64 First, uint64 Last, Verify_ResultType *Result )      \
+    {                                                                                         \
+        for( uint64 Index = First; Index < Last; Index++ )                                    \
+        {                                                                                     \
+            Body                                                                              \
+        }                                                                                     \
+    }
+#define VERIFY_FIELD( Shift, Bits )         ( ( Index >> ( Shift ) ) & ( ( 1ull << ( Bits ) ) - 1u ) )
+#define VERIFY_SKIP( Condition )            if( Condition ) { continue; }
+#define VERIFY_EXPECT( Got, Expected )                                                        \
+    do                                                                                        \
+    {                                                                                         \
+        uint64 VerifyGot      = (uint64)( Got );                                              \
+        uint64 VerifyExpected = (uint64)( Expected );                                         \
+        Result->Checked++;                                                                    \
+        if( VerifyGot != VerifyExpected )                                                     \
+        {                                                                                     \
+            Verify_Record( Result, Index, VerifyGot, VerifyExpected );                        \
+        }                                                                                     \
+    } while( 0 )
+
+/*routines updating the data in place, Data is the first operand and the variadic part the rest*/
+#define VERIFY_INPLACE( Routine, Type, W, DataBits, Decode, Skip, Call, Reference )          \
+    VERIFY_ROUTINE( Routine,                                                                  \
+        Type Data = (Type)VERIFY_FIELD( 0u, DataBits );                                       \
+        Decode                                                                                \
+        VERIFY_SKIP( Skip )                                                                   \
+        uint64 Expected = ( Reference ) & Ref_Ones( W );                                      \
+        Routine Call;                                                                         \
+        VERIFY_EXPECT( Data, Expected ); )
+
+/*routines returning the result, the boolean results are compared as 0 or 1*/
+#define VERIFY_RETURN( Routine, Type, W, DataBits, Decode, Skip, Call, Reference )           \
+    VERIFY_ROUTINE( Routine,                                                                  \
+        Type Data = (Type)VERIFY_FIELD( 0u, DataBits );                                       \
+        Decode                                                                                \
+        VERIFY_SKIP( Skip )                                                                   \
+        uint64 Expected = ( Reference ) & Ref_Ones( W );                                      \
+        VERIFY_EXPECT( ( Routine Call ) & Ref_Ones( W ), Expected ); )
+/* clang-format on */
+
+/*8 bits, Pn is a bit position 0 to 7, Ln a bit count 0 to 8 and Cnt a shift count*/
+#define VERIFY_PN8  uint8 Pn = (uint8)VERIFY_FIELD( 8u, 3u );
+#define VERIFY_LN8  uint8 Start = (uint8)VERIFY_FIELD( 8u, 3u ); uint8 Ln = (uint8)VERIFY_FIELD( 11u, 4u );
+#define VERIFY_OP8  uint8 Operand = (uint8)VERIFY_FIELD( 8u, 8u );
+#define VERIFY_CNT8 sint8 Cnt = (sint8)( (sint8)VERIFY_FIELD( 8u, 4u ) - 8 );
+
+VERIFY_INPLACE( Bfx_SetBit_u8u8, uint8, 8u, 8u, VERIFY_PN8, FALSE, ( &Data, Pn ), Ref_PutBit( Data, Pn, 1u ) )
+VERIFY_INPLACE( Bfx_ClrBit_u8u8, uint8, 8u, 8u, VERIFY_PN8, FALSE, ( &Data, Pn ), Ref_PutBit( Data, Pn, 0u ) )
+VERIFY_RETURN( Bfx_GetBit_u8u8_u8, uint8, 8u, 8u, VERIFY_PN8, FALSE, ( Data, Pn ), Ref_Bit( Data, Pn ) )
+VERIFY_INPLACE( Bfx_PutBit_u8u8u8, uint8, 8u, 8u, VERIFY_PN8 uint8 Status = (uint8)VERIFY_FIELD( 11u, 1u );, FALSE, ( &Data, Pn, Status ), Ref_PutBit( Data, Pn, Status ) )
+VERIFY_INPLACE( Bfx_SetBits_u8u8u8u8, uint8, 8u, 8u, VERIFY_LN8 uint8 Status = (uint8)VERIFY_FIELD( 15u, 1u );, ( Start + Ln ) > 8u, ( &Data, Start, Ln, Status ), Ref_SetBits( Data, Start, Ln, Status ) )
+VERIFY_RETURN( Bfx_GetBits_u8u8u8_u8, uint8, 8u, 8u, VERIFY_LN8, ( Start + Ln ) > 8u, ( Data, Start, Ln ), Ref_GetBits( Data, Start, Ln ) )
+VERIFY_INPLACE( Bfx_PutBits_u8u8u8u8, uint8, 8u, 8u, VERIFY_LN8 uint8 Operand = (uint8)VERIFY_FIELD( 15u, 8u );, ( Start + Ln ) > 8u, ( &Data, Start, Ln, Operand ), Ref_PutBits( Data, Start, Ln, Operand ) )
+VERIFY_INPLACE( Bfx_SetBitMask_u8u8, uint8, 8u, 8u, VERIFY_OP8, FALSE, ( &Data, Operand ), Data | Operand )
+VERIFY_INPLACE( Bfx_ClrBitMask_u8u8, uint8, 8u, 8u, VERIFY_OP8, FALSE, ( &Data, Operand ), Data & ~Operand )
+VERIFY_INPLACE( Bfx_ToggleBitMask_u8u8, uint8, 8u, 8u, VERIFY_OP8, FALSE, ( &Data, Operand ), Data ^ Operand )
+VERIFY_RETURN( Bfx_TstBitMask_u8u8_u8, uint8, 8u, 8u, VERIFY_OP8, FALSE, ( Data, Operand ), Ref_TstBitMask( Data, Operand, 8u ) )
+VERIFY_RETURN( Bfx_TstBitLnMask_u8u8_u8, uint8, 8u, 8u, VERIFY_OP8, FALSE, ( Data, Operand ), Ref_TstBitLnMask( Data, Operand, 8u ) )
+VERIFY_RETURN( Bfx_DepositBits_u8u8_u8, uint8, 8u, 8u, VERIFY_OP8, FALSE, ( Data, Operand ), Ref_Deposit( Data, Operand, 8u ) )
+VERIFY_RETURN( Bfx_ExtractBits_u8u8_u8, uint8, 8u, 8u, VERIFY_OP8, FALSE, ( Data, Operand ), Ref_Extract( Data, Operand, 8u ) )
+VERIFY_INPLACE( Bfx_PutBitsMask_u8u8u8, uint8, 8u, 8u, VERIFY_OP8 uint8 Mask = (uint8)VERIFY_FIELD( 16u, 8u );, FALSE, ( &Data, Operand, Mask ), Ref_PutBitsMask( Data, Operand, Mask, 8u ) )
+VERIFY_INPLACE( Bfx_CopyBit_u8u8u8u8, uint8, 8u, 8u, VERIFY_PN8 uint8 Operand = (uint8)VERIFY_FIELD( 11u, 8u ); uint8 From = (uint8)VERIFY_FIELD( 19u, 3u );, FALSE, ( &Data, Pn, Operand, From ), Ref_PutBit( Data, Pn, Ref_Bit( Operand, From ) ) )
+VERIFY_INPLACE( Bfx_ToggleBits_u8, uint8, 8u, 8u, , FALSE, ( &Data ), ~Data )
+VERIFY_RETURN( Bfx_TstParityEven_u8_u8, uint8, 8u, 8u, , FALSE, ( Data ), Ref_ParityEven( Data, 8u ) )
+VERIFY_RETURN( Bfx_CountLeadingOnes_u8, uint8, 8u, 8u, , FALSE, ( Data ), Ref_CountLeading( Data, 8u, 1u ) )
+VERIFY_RETURN( Bfx_CountLeadingZeros_u8, uint8, 8u, 8u, , FALSE, ( Data ), Ref_CountLeading( Data, 8u, 0u ) )
+VERIFY_RETURN( Bfx_CountLeadingSigns_s8, sint8, 8u, 8u, , FALSE, ( Data ), Ref_CountLeadingSigns( (uint8)Data, 8u ) )
+VERIFY_INPLACE( Bfx_ShiftBitRt_u8u8, uint8, 8u, 8u, VERIFY_PN8, FALSE, ( &Data, Pn ), Ref_ShiftRt( Data, Pn, 8u ) )
+VERIFY_INPLACE( Bfx_ShiftBitLt_u8u8, uint8, 8u, 8u, VERIFY_PN8, FALSE, ( &Data, Pn ), Ref_ShiftLt( Data, Pn, 8u ) )
+VERIFY_INPLACE( Bfx_RotBitRt_u8u8, uint8, 8u, 8u, VERIFY_PN8, FALSE, ( &Data, Pn ), Ref_RotRt( Data, Pn, 8u ) )
+VERIFY_INPLACE( Bfx_RotBitLt_u8u8, uint8, 8u, 8u, VERIFY_PN8, FALSE, ( &Data, Pn ), Ref_RotLt( Data, Pn, 8u ) )
+VERIFY_RETURN( Bfx_ShiftBitSat_u8s8_u8, uint8, 8u, 8u, VERIFY_CNT8, Cnt == -8, ( Data, Cnt ), Ref_ShiftSatU( Data, Cnt, 8u ) )
+VERIFY_RETURN( Bfx_ShiftBitSat_s8s8_s8, sint8, 8u, 8u, VERIFY_CNT8, Cnt == -8, ( Data, Cnt ), Ref_ShiftSatS( (uint8)Data, Cnt, 8u ) )
+
+/*16 bits, the three operand routines take the inverted pattern as destination*/
+#define VERIFY_PN16  uint8 Pn = (uint8)VERIFY_FIELD( 16u, 4u );
+#define VERIFY_LN16  uint8 Start = (uint8)VERIFY_FIELD( 16u, 4u ); uint8 Ln = (uint8)VERIFY_FIELD( 20u, 5u );
+#define VERIFY_OP16  uint16 Operand = (uint16)VERIFY_FIELD( 16u, 16u );
+#define VERIFY_CNT16 sint8 Cnt = (sint8)( (sint8)VERIFY_FIELD( 16u, 5u ) - 16 );
+#define VERIFY_INV16 uint16 Operand = Data; Data = (uint16)~Operand;
+
+VERIFY_INPLACE( Bfx_SetBit_u16u8, uint16, 16u, 16u, VERIFY_PN16, FALSE, ( &Data, Pn ), Ref_PutBit( Data, Pn, 1u ) )
+VERIFY_INPLACE( Bfx_ClrBit_u16u8, uint16, 16u, 16u, VERIFY_PN16, FALSE, ( &Data, Pn ), Ref_PutBit( Data, Pn, 0u ) )
+VERIFY_RETURN( Bfx_GetBit_u16u8_u8, uint16, 16u, 16u, VERIFY_PN16, FALSE, ( Data, Pn ), Ref_Bit( Data, Pn ) )
+VERIFY_INPLACE( Bfx_PutBit_u16u8u8, uint16, 16u, 16u, VERIFY_PN16 uint8 Status = (uint8)VERIFY_FIELD( 20u, 1u );, FALSE, ( &Data, Pn, Status ), Ref_PutBit( Data, Pn, Status ) )
+VERIFY_INPLACE( Bfx_SetBits_u16u8u8u8, uint16, 16u, 16u, VERIFY_LN16 uint8 Status = (uint8)VERIFY_FIELD( 25u, 1u );, ( Start + Ln ) > 16u, ( &Data, Start, Ln, Status ), Ref_SetBits( Data, Start, Ln, Status ) )
+VERIFY_RETURN( Bfx_GetBits_u16u8u8_u16, uint16, 16u, 16u, VERIFY_LN16, ( Start + Ln ) > 16u, ( Data, Start, Ln ), Ref_GetBits( Data, Start, Ln ) )
+VERIFY_INPLACE( Bfx_PutBits_u16u8u8u16, uint16, 16u, 16u, VERIFY_LN16 VERIFY_INV16, ( Start + Ln ) > 16u, ( &Data, Start, Ln, Operand ), Ref_PutBits( Data, Start, Ln, Operand ) )
+VERIFY_INPLACE( Bfx_SetBitMask_u16u16, uint16, 16u, 16u, VERIFY_OP16, FALSE, ( &Data, Operand ), Data | Operand )
+VERIFY_INPLACE( Bfx_ClrBitMask_u16u16, uint16, 16u, 16u, VERIFY_OP16, FALSE, ( &Data, Operand ), Data & ~Operand )
+VERIFY_INPLACE( Bfx_ToggleBitMask_u16u16, uint16, 16u, 16u, VERIFY_OP16, FALSE, ( &Data, Operand ), Data ^ Operand )
+VERIFY_RETURN( Bfx_TstBitMask_u16u16_u8, uint16, 16u, 16u, VERIFY_OP16, FALSE, ( Data, Operand ), Ref_TstBitMask( Data, Operand, 16u ) )
+VERIFY_RETURN( Bfx_TstBitLnMask_u16u16_u8, uint16, 16u, 16u, VERIFY_OP16, FALSE, ( Data, Operand ), Ref_TstBitLnMask( Data, Operand, 16u ) )
+VERIFY_RETURN( Bfx_DepositBits_u16u16_u16, uint16, 16u, 16u, VERIFY_OP16, FALSE, ( Data, Operand ), Ref_Deposit( Data, Operand, 16u ) )
+VERIFY_RETURN( Bfx_ExtractBits_u16u16_u16, uint16, 16u, 16u, VERIFY_OP16, FALSE, ( Data, Operand ), Ref_Extract( Data, Operand, 16u ) )
+VERIFY_INPLACE( Bfx_PutBitsMask_u16u16u16, uint16, 16u, 16u, VERIFY_INV16 uint16 Mask = (uint16)VERIFY_FIELD( 16u, 16u );, FALSE, ( &Data, Operand, Mask ), Ref_PutBitsMask( Data, Operand, Mask, 16u ) )
+VERIFY_INPLACE( Bfx_CopyBit_u16u8u16u8, uint16, 16u, 16u, VERIFY_PN16 VERIFY_INV16 uint8 From = (uint8)VERIFY_FIELD( 20u, 4u );, FALSE, ( &Data, Pn, Operand, From ), Ref_PutBit( Data, Pn, Ref_Bit( Operand, From ) ) )
+VERIFY_INPLACE( Bfx_ToggleBits_u16, uint16, 16u, 16u, , FALSE, ( &Data ), ~Data )
+VERIFY_RETURN( Bfx_TstParityEven_u16_u8, uint16, 16u, 16u, , FALSE, ( Data ), Ref_ParityEven( Data, 16u ) )
+VERIFY_RETURN( Bfx_CountLeadingOnes_u16, uint16, 16u, 16u, , FALSE, ( Data ), Ref_CountLeading( Data, 16u, 1u ) )
+VERIFY_RETURN( Bfx_CountLeadingZeros_u16, uint16, 16u, 16u, , FALSE, ( Data ), Ref_CountLeading( Data, 16u, 0u ) )
+VERIFY_RETURN( Bfx_CountLeadingSigns_s16, sint16, 16u, 16u, , FALSE, ( Data ), Ref_CountLeadingSigns( (uint16)Data, 16u ) )
+VERIFY_INPLACE( Bfx_ShiftBitRt_u16u8, uint16, 16u, 16u, VERIFY_PN16, FALSE, ( &Data, Pn ), Ref_ShiftRt( Data, Pn, 16u ) )
+VERIFY_INPLACE( Bfx_ShiftBitLt_u16u8, uint16, 16u, 16u, VERIFY_PN16, FALSE, ( &Data, Pn ), Ref_ShiftLt( Data, Pn, 16u ) )
+VERIFY_INPLACE( Bfx_RotBitRt_u16u8, uint16, 16u, 16u, VERIFY_PN16, FALSE, ( &Data, Pn ), Ref_RotRt( Data, Pn, 16u ) )
+VERIFY_INPLACE( Bfx_RotBitLt_u16u8, uint16, 16u, 16u, VERIFY_PN16, FALSE, ( &Data, Pn ), Ref_RotLt( Data, Pn, 16u ) )
+VERIFY_RETURN( Bfx_ShiftBitSat_u16s8_u16, uint16, 16u, 16u, VERIFY_CNT16, Cnt == -16, ( Data, Cnt ), Ref_ShiftSatU( Data, Cnt, 16u ) )
+VERIFY_RETURN( Bfx_ShiftBitSat_s16s8_s16, sint16, 16u, 16u, VERIFY_CNT16, Cnt == -16, ( Data, Cnt ), Ref_ShiftSatS( (uint16)Data, Cnt, 16u ) )
+
+/*32 bits, the routines with a single operand only*/
+VERIFY_INPLACE( Bfx_ToggleBits_u32, uint32, 32u, 32u, , FALSE, ( &Data ), ~Data )
+VERIFY_RETURN( Bfx_TstParityEven_u32_u8, uint32, 32u, 32u, , FALSE, ( Data ), Ref_ParityEven( Data, 32u ) )
+VERIFY_RETURN( Bfx_CountLeadingOnes_u32, uint32, 32u, 32u, , FALSE, ( Data ), Ref_CountLeading( Data, 32u, 1u ) )
+VERIFY_RETURN( Bfx_CountLeadingZeros_u32, uint32, 32u, 32u, , FALSE, ( Data ), Ref_CountLeading( Data, 32u, 0u ) )
+VERIFY_RETURN( Bfx_CountLeadingSigns_s32, sint32, 32u, 32u, , FALSE, ( Data ), Ref_CountLeadingSigns( (uint32)Data, 32u ) )
+VERIFY_RETURN( Bfx_CountTrailingZeros_u32, uint32, 32u, 32u, , FALSE, ( Data ), Ref_CountTrailingZeros( Data, 32u ) )
+
+/* clang-format off */
+static const Verify_RoutineType Routines[] = {
+    { "Bfx_SetBit_u8u8",              Verify_Bfx_SetBit_u8u8,              11u },
+    { "Bfx_ClrBit_u8u8",              Verify_Bfx_ClrBit_u8u8,              11u },
+    { "Bfx_GetBit_u8u8_u8",           Verify_Bfx_GetBit_u8u8_u8,           11u },
+    { "Bfx_PutBit_u8u8u8",            Verify_Bfx_PutBit_u8u8u8,            12u },
+    { "Bfx_SetBits_u8u8u8u8",         Verify_Bfx_SetBits_u8u8u8u8,         16u },
+    { "Bfx_GetBits_u8u8u8_u8",        Verify_Bfx_GetBits_u8u8u8_u8,        15u },
+    { "Bfx_PutBits_u8u8u8u8",         Verify_Bfx_PutBits_u8u8u8u8,         23u },
+    { "Bfx_SetBitMask_u8u8",          Verify_Bfx_SetBitMask_u8u8,          16u },
+    { "Bfx_ClrBitMask_u8u8",          Verify_Bfx_ClrBitMask_u8u8,          16u },
+    { "Bfx_ToggleBitMask_u8u8",       Verify_Bfx_ToggleBitMask_u8u8,       16u },
+    { "Bfx_TstBitMask_u8u8_u8",       Verify_Bfx_TstBitMask_u8u8_u8,       16u },
+    { "Bfx_TstBitLnMask_u8u8_u8",     Verify_Bfx_TstBitLnMask_u8u8_u8,     16u },
+    { "Bfx_DepositBits_u8u8_u8",      Verify_Bfx_DepositBits_u8u8_u8,      16u },
+    { "Bfx_ExtractBits_u8u8_u8",      Verify_Bfx_ExtractBits_u8u8_u8,      16u },
+    { "Bfx_PutBitsMask_u8u8u8",       Verify_Bfx_PutBitsMask_u8u8u8,       24u },
+    { "Bfx_CopyBit_u8u8u8u8",         Verify_Bfx_CopyBit_u8u8u8u8,         22u },
+    { "Bfx_ToggleBits_u8",            Verify_Bfx_ToggleBits_u8,            8u  },
+    { "Bfx_TstParityEven_u8_u8",      Verify_Bfx_TstParityEven_u8_u8,      8u  },
+    { "Bfx_CountLeadingOnes_u8",      Verify_Bfx_CountLeadingOnes_u8,      8u  },
+    { "Bfx_CountLeadingZeros_u8",     Verify_Bfx_CountLeadingZeros_u8,     8u  },
+    { "Bfx_CountLeadingSigns_s8",     Verify_Bfx_CountLeadingSigns_s8,     8u  },
+    { "Bfx_ShiftBitRt_u8u8",          Verify_Bfx_ShiftBitRt_u8u8,          11u },
+    { "Bfx_ShiftBitLt_u8u8",          Verify_Bfx_ShiftBitLt_u8u8,          11u },
+    { "Bfx_RotBitRt_u8u8",            Verify_Bfx_RotBitRt_u8u8,            11u },
+    { "Bfx_RotBitLt_u8u8",            Verify_Bfx_RotBitLt_u8u8,            11u },
+    { "Bfx_ShiftBitSat_u8s8_u8",      Verify_Bfx_ShiftBitSat_u8s8_u8,      12u },
+    { "Bfx_ShiftBitSat_s8s8_s8",      Verify_Bfx_ShiftBitSat_s8s8_s8,      12u },
+    { "Bfx_SetBit_u16u8",             Verify_Bfx_SetBit_u16u8,             20u },
+    { "Bfx_ClrBit_u16u8",             Verify_Bfx_ClrBit_u16u8,             20u },
+    { "Bfx_GetBit_u16u8_u8",          Verify_Bfx_GetBit_u16u8_u8,          20u },
+    { "Bfx_PutBit_u16u8u8",           Verify_Bfx_PutBit_u16u8u8,           21u },
+    { "Bfx_SetBits_u16u8u8u8",        Verify_Bfx_SetBits_u16u8u8u8,        26u },
+    { "Bfx_GetBits_u16u8u8_u16",      Verify_Bfx_GetBits_u16u8u8_u16,      25u },
+    { "Bfx_PutBits_u16u8u8u16",       Verify_Bfx_PutBits_u16u8u8u16,       25u },
+    { "Bfx_SetBitMask_u16u16",        Verify_Bfx_SetBitMask_u16u16,        32u },
+    { "Bfx_ClrBitMask_u16u16",        Verify_Bfx_ClrBitMask_u16u16,        32u },
+    { "Bfx_ToggleBitMask_u16u16",     Verify_Bfx_ToggleBitMask_u16u16,     32u },
+    { "Bfx_TstBitMask_u16u16_u8",     Verify_Bfx_TstBitMask_u16u16_u8,     32u },
+    { "Bfx_TstBitLnMask_u16u16_u8",   Verify_Bfx_TstBitLnMask_u16u16_u8,   32u },
+    { "Bfx_DepositBits_u16u16_u16",   Verify_Bfx_DepositBits_u16u16_u16,   32u },
+    { "Bfx_ExtractBits_u16u16_u16",   Verify_Bfx_ExtractBits_u16u16_u16,   32u },
+    { "Bfx_PutBitsMask_u16u16u16",    Verify_Bfx_PutBitsMask_u16u16u16,    32u },
+    { "Bfx_CopyBit_u16u8u16u8",       Verify_Bfx_CopyBit_u16u8u16u8,       24u },
+    { "Bfx_ToggleBits_u16",           Verify_Bfx_ToggleBits_u16,           16u },
+    { "Bfx_TstParityEven_u16_u8",     Verify_Bfx_TstParityEven_u16_u8,     16u },
+    { "Bfx_CountLeadingOnes_u16",     Verify_Bfx_CountLeadingOnes_u16,     16u },
+    { "Bfx_CountLeadingZeros_u16",    Verify_Bfx_CountLeadingZeros_u16,    16u },
+    { "Bfx_CountLeadingSigns_s16",    Verify_Bfx_CountLeadingSigns_s16,    16u },
+    { "Bfx_ShiftBitRt_u16u8",         Verify_Bfx_ShiftBitRt_u16u8,         20u },
+    { "Bfx_ShiftBitLt_u16u8",         Verify_Bfx_ShiftBitLt_u16u8,         20u },
+    { "Bfx_RotBitRt_u16u8",           Verify_Bfx_RotBitRt_u16u8,           20u },
+    { "Bfx_RotBitLt_u16u8",           Verify_Bfx_RotBitLt_u16u8,           20u },
+    { "Bfx_ShiftBitSat_u16s8_u16",    Verify_Bfx_ShiftBitSat_u16s8_u16,    21u },
+    { "Bfx_ShiftBitSat_s16s8_s16",    Verify_Bfx_ShiftBitSat_s16s8_s16,    21u },
+    { "Bfx_ToggleBits_u32",           Verify_Bfx_ToggleBits_u32,           32u },
+    { "Bfx_TstParityEven_u32_u8",     Verify_Bfx_TstParityEven_u32_u8,     32u },
+    { "Bfx_CountLeadingOnes_u32",     Verify_Bfx_CountLeadingOnes_u32,     32u },
+    { "Bfx_CountLeadingZeros_u32",    Verify_Bfx_CountLeadingZeros_u32,    32u },
+    { "Bfx_CountLeadingSigns_s32",    Verify_Bfx_CountLeadingSigns_s32,    32u },
+    { "Bfx_CountTrailingZeros_u32",   Verify_Bfx_CountTrailingZeros_u32,   32u },
+};
+/* clang-format on */
+
+static boolean Verify_Take( uint64 *Range, uint32 *Chunk )
+{
+    uint64 Old = __atomic_load_n( Range, __ATOMIC_ACQUIRE );
+    uint32 Head;
+    uint32 Tail;
+
+    do
+    {
+        Head = (uint32)( Old & VERIFY_RANGE_HEAD );
+        Tail = (uint32)( Old >> VERIFY_RANGE_TAIL_N );
+        if( Head >= Tail )
+        {
+            return FALSE;
+        }
+    } while( __atomic_compare_exchange_n( Range, &Old, Old + 1u, FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) == FALSE );
+
+    *Chunk = Head;
+    return TRUE;
+}
+
+static boolean Verify_Steal( Verify_WorkerType *Thief )
+{
+    Verify_WorkerType *Victim;
+    uint64 Old;
+    uint32 Head;
+    uint32 Tail;
+    uint32 Half;
+
+    for( uint32 i = 1u; i < Thief->Threads; i++ )
+    {
+        Victim = &Thief->Workers[ ( Thief->Id + i ) % Thief->Threads ];
+        Old    = __atomic_load_n( &Victim->Range, __ATOMIC_ACQUIRE );
+        do
+        {
+            Head = (uint32)( Old & VERIFY_RANGE_HEAD );
+            Tail = (uint32)( Old >> VERIFY_RANGE_TAIL_N );
+            Half = ( Tail - Head ) / 2u;
+            if( ( Head >= Tail ) || ( Half == 0u ) )
+            {
+                break;
+            }
+        } while( __atomic_compare_exchange_n( &Victim->Range, &Old, ( (uint64)( Tail - Half ) << VERIFY_RANGE_TAIL_N ) | Head,
+                                              FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) == FALSE );
+
+        if( ( Head < Tail ) && ( Half != 0u ) )
+        {
+            /*the stolen upper half becomes the range of the thief*/
+            __atomic_store_n( &Thief->Range, ( (uint64)Tail << VERIFY_RANGE_TAIL_N ) | ( Tail - Half ), __ATOMIC_RELEASE );
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static void *Verify_Worker( void *Argument )
+{
+    Verify_WorkerType *Worker = Argument;
+    uint64 Inputs             = 1ull << Worker->Routine->Bits;
+    uint64 First;
+    uint64 Last;
+    uint32 Chunk;
+
+    do
+    {
+        while( Verify_Take( &Worker->Range, &Chunk ) == TRUE )
+        {
+            First = (uint64)Chunk << VERIFY_CHUNK_BITS;
+            Last  = First + ( 1ull << VERIFY_CHUNK_BITS );
+            Worker->Routine->Range( First, ( Last < Inputs ) ? Last : Inputs, &Worker->Result );
+        }
+    } while( Verify_Steal( Worker ) == TRUE );
+
+    return NULL;
+}
+
+static Verify_ResultType Verify_Run( const Verify_RoutineType *Routine, Verify_WorkerType *Workers, uint32 Threads )
+{
+    uint64 Inputs = 1ull << Routine->Bits;
+    uint32 Chunks = (uint32)( ( Inputs + ( 1ull << VERIFY_CHUNK_BITS ) - 1u ) >> VERIFY_CHUNK_BITS );
+    Verify_ResultType Total;
+
+    memset( &Total, 0, sizeof( Total ) );
+    for( uint32 i = 0u; i < Threads; i++ )
+    {
+        uint32 Head = (uint32)( ( (uint64)Chunks * i ) / Threads );
+        uint32 Tail = (uint32)( ( (uint64)Chunks * ( i + 1u ) ) / Threads );
+
+        memset( &Workers[ i ].Result, 0, sizeof( Workers[ i ].Result ) );
+        Workers[ i ].Range   = ( (uint64)Tail << VERIFY_RANGE_TAIL_N ) | Head;
+        Workers[ i ].Routine = Routine;
+        Workers[ i ].Workers = Workers;
+        Workers[ i ].Threads = Threads;
+        Workers[ i ].Id      = i;
+    }
+    for( uint32 i = 1u; i < Threads; i++ )
+    {
+        (void)pthread_create( &Workers[ i ].Thread, NULL, Verify_Worker, &Workers[ i ] );
+    }
+    (void)Verify_Worker( &Workers[ 0 ] );
+    for( uint32 i = 1u; i < Threads; i++ )
+    {
+        (void)pthread_join( Workers[ i ].Thread, NULL );
+    }
+
+    for( uint32 i = 0u; i < Threads; i++ )
+    {
+        Verify_ResultType *Result = &Workers[ i ].Result;
+
+        Total.Checked += Result->Checked;
+        if( Result->Mismatches != 0u )
+        {
+            if( ( Total.Mismatches == 0u ) || ( Result->Failed < Total.Failed ) )
+            {
+                Total.Failed   = Result->Failed;
+                Total.Got      = Result->Got;
+                Total.Expected = Result->Expected;
+            }
+            Total.Mismatches += Result->Mismatches;
+        }
+    }
+    return Total;
+}
+
+int main( int argc, char *argv[] )
+{
+    static Verify_WorkerType Workers[ VERIFY_MAX_THREADS ];
+    long Cores         = sysconf( _SC_NPROCESSORS_ONLN );
+    uint32 Threads     = ( Cores < 1 ) ? 1u : ( ( Cores > (long)VERIFY_MAX_THREADS ) ? VERIFY_MAX_THREADS : (uint32)Cores );
+    const char *Filter = "";
+    int Failed         = 0;
+    Verify_ResultType Result;
+    uint64 Start;
+
+    for( int i = 1; i < argc; i++ )
+    {
+        if( ( strcmp( argv[ i ], "-j" ) == 0 ) && ( ( i + 1 ) < argc ) )
+        {
+            i++;
+            Threads = (uint32)strtoul( argv[ i ], NULL, 0 );
+            Threads = ( Threads == 0u ) ? 1u : ( ( Threads > VERIFY_MAX_THREADS ) ? VERIFY_MAX_THREADS : Threads );
+        }
+        else
+        {
+            Filter = argv[ i ];
+        }
+    }
+
+    printf( "routine                        inputs checked   seconds  mismatches\n" );
+    for( uint32 r = 0u; r < ( sizeof( Routines ) / sizeof( Routines[ 0 ] ) ); r++ )
+    {
+        if( strstr( Routines[ r ].Name, Filter ) == NULL )
+        {
+            continue;
+        }
+
+        Start  = Bench_Now();
+        Result = Verify_Run( &Routines[ r ], Workers, Threads );
+        printf( "%-29s  %14llu  %8.2f  %10llu\n", Routines[ r ].Name, (unsigned long long)Result.Checked,
+                (double)( Bench_Now() - Start ) / 1e9, (unsigned long long)Result.Mismatches );
+        if( Result.Mismatches != 0u )
+        {
+            printf( "    first at input 0x%llx, got 0x%llx expected 0x%llx\n", (unsigned long long)Result.Failed,
+                    (unsigned long long)Result.Got, (unsigned long long)Result.Expected );
+            Failed = 1;
+        }
+        (void)fflush( stdout );
+    }
+
+    return Failed;
+}
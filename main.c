@@ -1,19 +1,51 @@
 #include "Std_Types.h"
+#include "Mcu.h"
+#include "Os.h"
+#include "Tmr.h"
+#include "Trace.h"
+#include "Reg_Map.h"
+
+/* clang-format off */
+#define MAIN_TRACE_EVENT_BLINK  ( TRACE_EVENT_USER + 0u )   /*!< led toggled, arg is the port output */
+/* clang-format on */
+
+static void Main_Blink( void );
+static void Main_BlinkTimer( void );
+
+/*task table, lowest priority first*/
+static const Os_TaskEntryType Main_Tasks[] = { Main_Blink };
+/*the core sleeps in the timer idle until the next timer or interrupt*/
+static const Os_ConfigType Main_Os = { Main_Tasks, 1u, Tmr_Idle };
+static Tmr_TimerType Main_Timer;
 
 int main( void )
 {
+    /*run the core at 64MHz from the PLL*/
+    (void)Mcu_InitClock();
+
     /*enable GPIOA clock*/
-    *(volatile uint32 *)0x40021034 |= 0x01;
+    REG_WRITE( &REG_RCC->IOPENR, REG_READ( &REG_RCC->IOPENR ) | 0x01u );
     /*Set pin 5 from port A as output*/
-    *(volatile uint32 *)0x50000000 &= ~( 2 << ( 5 << 1 ) );
-
-    for( ;; ) /*infinite loop*/
-    {
-        /*toggle pin 5 where the led is conected*/
-        *(volatile uint32 *)0x50000014 ^= ( 1 << 5 );
-        /*Dirty delay*/
-        for( uint32 i = 0; i < 100000; i++ )
-            ;
-    }
+    REG_WRITE( &REG_GPIOA->MODER, REG_READ( &REG_GPIOA->MODER ) & ~( 2u << ( 5u << 1u ) ) );
+
+    Trace_Init();
+    Os_Init( &Main_Os );
+    Tmr_Init();
+    /*toggle the led every 500ms*/
+    (void)Tmr_Start( &Main_Timer, 500u, 500u, Main_BlinkTimer );
+    StartOS();
+
     return 0;
 }
+
+static void Main_Blink( void )
+{
+    /*toggle pin 5 where the led is conected*/
+    REG_WRITE( &REG_GPIOA->ODR, REG_READ( &REG_GPIOA->ODR ) ^ ( 1u << 5u ) );
+    TRACE( TRACE_CONTEXT_TASK, MAIN_TRACE_EVENT_BLINK, REG_READ( &REG_GPIOA->ODR ) );
+}
+
+static void Main_BlinkTimer( void )
+{
+    (void)ActivateTask( 0u );
+}
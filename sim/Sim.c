@@ -0,0 +1,895 @@
+/**
+ * @file    Sim.c
+ * @brief   **Host Peripheral Simulator**
+ *
+ * Each peripheral keeps its registers in a RAM array indexed by the register offset. A core access
+ * finds the peripheral from the address, counts it, checks the clock gate and hands it to the model
+ * of the peripheral, which applies the side effects of the register. The DMA engine reaches the
+ * same models through the uncounted accesses, so a transfer to a GPIO register behaves like a core
+ * write without showing in the counters of the core.
+ */
+#include "Sim.h"
+#include "Reg.h"
+
+/* clang-format off */
+#define SIM_RCC_BASE            0x40021000u     /*!< RCC registers */
+#define SIM_FLASH_BASE          0x40022000u     /*!< flash interface registers */
+#define SIM_DMA_BASE            0x40020000u     /*!< DMA1 registers */
+#define SIM_GPIO_BASE           0x50000000u     /*!< GPIOA registers, the other ports follow */
+#define SIM_SYST_BASE           0xE000E010u     /*!< SysTick registers */
+#define SIM_BLOCK               0x400u          /*!< address range of a peripheral */
+#define SIM_BLOCK_WORDS         ( SIM_BLOCK / 4u )
+#define SIM_GPIO_PORTS          6u              /*!< ports A to F */
+#define SIM_SYST_WORDS          4u              /*!< CSR, RVR, CVR and CALIB */
+#define SIM_DMA_CHANNELS        7u              /*!< DMA1 channels */
+#define SIM_MAPS                8u              /*!< host memory windows seen by the DMA */
+#define SIM_ACCESS_CYCLES       1u              /*!< core cycles taken by a register access */
+
+#define SIM_RCC_CR              0x00u           /*!< clock control register */
+#define SIM_RCC_CFGR            0x08u           /*!< clock configuration register */
+#define SIM_RCC_PLLCFGR         0x0Cu           /*!< PLL configuration register */
+#define SIM_RCC_IOPENR          0x34u           /*!< GPIO clock enable register */
+#define SIM_RCC_AHBENR          0x38u           /*!< AHB clock enable register */
+#define SIM_CR_HSION            0x00000100u     /*!< HSI16 enable */
+#define SIM_CR_HSIRDY           0x00000400u     /*!< HSI16 ready */
+#define SIM_CR_PLLON            0x01000000u     /*!< PLL enable */
+#define SIM_CR_PLLRDY           0x02000000u     /*!< PLL locked */
+#define SIM_CFGR_SW             0x00000007u     /*!< system clock switch */
+#define SIM_CFGR_SWS            0x00000038u     /*!< system clock switch status */
+#define SIM_AHBENR_DMA1EN       0x00000001u     /*!< DMA1 clock enable */
+
+#define SIM_FLASH_ACR           0x00u           /*!< flash access control register */
+
+#define SIM_GPIO_MODER          0x00u           /*!< port mode register */
+#define SIM_GPIO_IDR            0x10u           /*!< input data register */
+#define SIM_GPIO_ODR            0x14u           /*!< output data register */
+#define SIM_GPIO_BSRR           0x18u           /*!< bit set and reset register */
+#define SIM_GPIO_BRR            0x28u           /*!< bit reset register */
+#define SIM_GPIO_PINS           16u             /*!< pins per port */
+
+#define SIM_SYST_CSR            0x00u           /*!< control and status register */
+#define SIM_SYST_RVR            0x04u           /*!< reload value register */
+#define SIM_SYST_CVR            0x08u           /*!< current value register */
+#define SIM_CSR_ENABLE          0x00000001u     /*!< counter enabled */
+#define SIM_CSR_TICKINT         0x00000002u     /*!< exception on count to zero */
+#define SIM_CSR_WRITABLE        0x00000007u     /*!< bits the core can write */
+#define SIM_CSR_COUNTFLAG       0x00010000u     /*!< counted to zero since the last read */
+#define SIM_SYST_MAX            0x00FFFFFFu     /*!< 24 bit counter */
+
+#define SIM_DMA_ISR             0x00u           /*!< interrupt status register */
+#define SIM_DMA_IFCR            0x04u           /*!< interrupt flag clear register */
+#define SIM_DMA_CCR             0x08u           /*!< first channel configuration register */
+#define SIM_DMA_STRIDE          0x14u           /*!< distance between channels */
+#define SIM_DMA_CNDTR           0x04u           /*!< items left, from CCR */
+#define SIM_DMA_CPAR            0x08u           /*!< peripheral address, from CCR */
+#define SIM_DMA_CMAR            0x0Cu           /*!< memory address, from CCR */
+#define SIM_CCR_EN              0x00000001u     /*!< channel enabled */
+#define SIM_CCR_DIR             0x00000010u     /*!< read from memory */
+#define SIM_CCR_CIRC            0x00000020u     /*!< circular mode */
+#define SIM_CCR_PINC            0x00000040u     /*!< peripheral address increment */
+#define SIM_CCR_MINC            0x00000080u     /*!< memory address increment */
+#define SIM_CCR_MEM2MEM         0x00004000u     /*!< memory to memory, runs without requests */
+#define SIM_ISR_GIF             0x1u            /*!< any flag of the channel */
+#define SIM_ISR_TCIF            0x2u            /*!< transfer complete */
+#define SIM_ISR_HTIF            0x4u            /*!< half transfer */
+#define SIM_ISR_TEIF            0x8u            /*!< transfer error */
+
+#define SIM_OFFSET( Address, Base )     ( ( Address ) - ( Base ) )
+#define SIM_WORD( Offset )              ( ( Offset ) >> 2u )
+/* clang-format on */
+
+/**
+ * @brief   Host memory the DMA reaches at a target address
+ */
+typedef struct Sim_MapType_Tag
+{
+    uint32 Address; /*!< target address of the first byte */
+    uint8 *Memory;  /*!< host memory behind it */
+    uint32 Size;    /*!< bytes mapped */
+} Sim_MapType;
+
+static uint32 Sim_Rcc[ SIM_BLOCK_WORDS ];                       /*!< RCC registers */
+static uint32 Sim_Flash[ SIM_BLOCK_WORDS ];                     /*!< flash interface registers */
+static uint32 Sim_Gpio[ SIM_GPIO_PORTS ][ SIM_BLOCK_WORDS ];    /*!< GPIO registers per port */
+static uint16 Sim_Input[ SIM_GPIO_PORTS ];                      /*!< external level of the pins */
+static uint32 Sim_Syst[ SIM_SYST_WORDS ];                       /*!< SysTick registers */
+static uint32 Sim_Dma[ SIM_BLOCK_WORDS ];                       /*!< DMA1 registers */
+static uint16 Sim_DmaCount[ SIM_DMA_CHANNELS ];                 /*!< CNDTR latched on enable */
+static uint16 Sim_DmaItem[ SIM_DMA_CHANNELS ];                  /*!< items moved since enable */
+static Sim_MapType Sim_Maps[ SIM_MAPS ];                        /*!< host memory windows */
+static uint32 Sim_MapCount;                                     /*!< windows in use */
+static Sim_CountersType Sim_Counters[ SIM_PERIPHERALS ];        /*!< core accesses per peripheral */
+static boolean Sim_PllLocks;                                    /*!< PLLRDY follows PLLON */
+static void ( *Sim_SysTickHandler )( void );                    /*!< called on each SysTick exception */
+static uint32 Sim_Cycles;                                       /*!< core cycles run by Sim_Advance */
+static uint32 Sim_Exceptions;                                   /*!< SysTick exceptions since Sim_Init */
+static boolean Sim_Masked;                                      /*!< PRIMASK set, exceptions wait */
+static boolean Sim_Pending;                                     /*!< SysTick exception pending */
+
+static void Sim_DmaEnable( uint32 Channel );
+
+/**
+ * @brief   **Peripheral of an address**
+ *
+ * @param[in] Address Register address
+ *
+ * @retval  Peripheral modelled at the address, SIM_OTHER when none
+ */
+static Sim_PeripheralType Sim_Find( uint32 Address )
+{
+    Sim_PeripheralType Peripheral = SIM_OTHER;
+
+    if( ( Address - SIM_RCC_BASE ) < SIM_BLOCK )
+    {
+        Peripheral = SIM_RCC;
+    }
+    else if( ( Address - SIM_FLASH_BASE ) < SIM_BLOCK )
+    {
+        Peripheral = SIM_FLASH;
+    }
+    else if( ( Address - SIM_GPIO_BASE ) < ( SIM_GPIO_PORTS * SIM_BLOCK ) )
+    {
+        Peripheral = SIM_GPIO;
+    }
+    else if( ( Address - SIM_SYST_BASE ) < ( SIM_SYST_WORDS * 4u ) )
+    {
+        Peripheral = SIM_SYSTICK;
+    }
+    else if( ( Address - SIM_DMA_BASE ) < SIM_BLOCK )
+    {
+        Peripheral = SIM_DMA;
+    }
+    return Peripheral;
+}
+
+/**
+ * @brief   **Peripheral clock enabled**
+ *
+ * Only the GPIO ports and DMA1 are gated, RCC, flash and SysTick are always clocked.
+ *
+ * @param[in] Peripheral Peripheral of the address
+ * @param[in] Address Register address
+ *
+ * @retval  TRUE when the peripheral clock runs
+ */
+static boolean Sim_Clocked( Sim_PeripheralType Peripheral, uint32 Address )
+{
+    boolean Clocked = TRUE;
+
+    if( Peripheral == SIM_GPIO )
+    {
+        Clocked = ( ( ( Sim_Rcc[ SIM_WORD( SIM_RCC_IOPENR ) ] >> ( ( Address - SIM_GPIO_BASE ) / SIM_BLOCK ) ) & 1u ) != 0u ) ? TRUE : FALSE;
+    }
+    else if( Peripheral == SIM_DMA )
+    {
+        Clocked = ( ( Sim_Rcc[ SIM_WORD( SIM_RCC_AHBENR ) ] & SIM_AHBENR_DMA1EN ) != 0u ) ? TRUE : FALSE;
+    }
+    return Clocked;
+}
+
+/**
+ * @brief   **GPIO input data**
+ *
+ * Output pins read their output latch, input and alternate function pins the external level and
+ * analog pins zero.
+ *
+ * @param[in] Port Port index
+ *
+ * @retval  IDR value
+ */
+static uint32 Sim_GpioIdr( uint32 Port )
+{
+    uint32 Moder = Sim_Gpio[ Port ][ SIM_WORD( SIM_GPIO_MODER ) ];
+    uint32 Odr   = Sim_Gpio[ Port ][ SIM_WORD( SIM_GPIO_ODR ) ];
+    uint32 Idr   = 0u;
+
+    for( uint32 Pin = 0u; Pin < SIM_GPIO_PINS; Pin++ )
+    {
+        uint32 Mode = ( Moder >> ( Pin << 1u ) ) & 3u;
+        uint32 Level = ( Mode == 1u ) ? ( Odr >> Pin ) : ( ( Mode == 3u ) ? 0u : ( (uint32)Sim_Input[ Port ] >> Pin ) );
+
+        Idr |= ( Level & 1u ) << Pin;
+    }
+    return Idr;
+}
+
+/**
+ * @brief   **Register read**
+ *
+ * @param[in] Peripheral Peripheral of the address
+ * @param[in] Address Register address, word aligned
+ * @param[in] Core TRUE for a core read, which applies the clear on read side effects
+ *
+ * @retval  Register value
+ */
+static uint32 Sim_Read( Sim_PeripheralType Peripheral, uint32 Address, boolean Core )
+{
+    uint32 Value = 0u;
+    uint32 Offset;
+
+    if( Peripheral == SIM_RCC )
+    {
+        Offset = SIM_OFFSET( Address, SIM_RCC_BASE );
+        Value  = Sim_Rcc[ SIM_WORD( Offset ) ];
+        if( Offset == SIM_RCC_CR )
+        {
+            Value = ( ( Value & SIM_CR_HSION ) != 0u ) ? ( Value | SIM_CR_HSIRDY ) : Value;
+            Value = ( ( ( Value & SIM_CR_PLLON ) != 0u ) && ( Sim_PllLocks == TRUE ) ) ? ( Value | SIM_CR_PLLRDY ) : Value;
+        }
+        else if( Offset == SIM_RCC_CFGR )
+        {
+            Value = ( Value & ~SIM_CFGR_SWS ) | ( ( Value & SIM_CFGR_SW ) << 3u );
+        }
+    }
+    else if( Peripheral == SIM_FLASH )
+    {
+        Value = Sim_Flash[ SIM_WORD( SIM_OFFSET( Address, SIM_FLASH_BASE ) ) ];
+    }
+    else if( Peripheral == SIM_GPIO )
+    {
+        Offset = SIM_OFFSET( Address, SIM_GPIO_BASE ) % SIM_BLOCK;
+        Value  = ( Offset == SIM_GPIO_IDR ) ? Sim_GpioIdr( SIM_OFFSET( Address, SIM_GPIO_BASE ) / SIM_BLOCK ) : Sim_Gpio[ SIM_OFFSET( Address, SIM_GPIO_BASE ) / SIM_BLOCK ][ SIM_WORD( Offset ) ];
+    }
+    else if( Peripheral == SIM_SYSTICK )
+    {
+        Offset = SIM_OFFSET( Address, SIM_SYST_BASE );
+        Value  = Sim_Syst[ SIM_WORD( Offset ) ];
+        if( ( Offset == SIM_SYST_CSR ) && ( Core == TRUE ) )
+        {
+            Sim_Syst[ SIM_WORD( SIM_SYST_CSR ) ] &= ~SIM_CSR_COUNTFLAG;
+        }
+    }
+    else if( Peripheral == SIM_DMA )
+    {
+        Value = Sim_Dma[ SIM_WORD( SIM_OFFSET( Address, SIM_DMA_BASE ) ) ];
+    }
+    return Value;
+}
+
+/**
+ * @brief   **Register write**
+ *
+ * @param[in] Peripheral Peripheral of the address
+ * @param[in] Address Register address, word aligned
+ * @param[in] Value Value written
+ *
+ * @retval  TRUE when the write changed the peripheral, FALSE for read only registers
+ */
+static boolean Sim_Write( Sim_PeripheralType Peripheral, uint32 Address, uint32 Value )
+{
+    boolean Applied = TRUE;
+    uint32 Offset;
+    uint32 *Reg;
+
+    if( Peripheral == SIM_RCC )
+    {
+        Offset = SIM_OFFSET( Address, SIM_RCC_BASE );
+        /*ready and status bits are computed on read*/
+        Value = ( Offset == SIM_RCC_CR ) ? ( Value & ~( SIM_CR_HSIRDY | SIM_CR_PLLRDY ) ) : Value;
+        Value = ( Offset == SIM_RCC_CFGR ) ? ( Value & ~SIM_CFGR_SWS ) : Value;
+        Sim_Rcc[ SIM_WORD( Offset ) ] = Value;
+    }
+    else if( Peripheral == SIM_FLASH )
+    {
+        Sim_Flash[ SIM_WORD( SIM_OFFSET( Address, SIM_FLASH_BASE ) ) ] = Value;
+    }
+    else if( Peripheral == SIM_GPIO )
+    {
+        Offset = SIM_OFFSET( Address, SIM_GPIO_BASE ) % SIM_BLOCK;
+        Reg    = Sim_Gpio[ SIM_OFFSET( Address, SIM_GPIO_BASE ) / SIM_BLOCK ];
+        if( Offset == SIM_GPIO_BSRR )
+        {
+            /*set wins over reset on the same pin*/
+            Reg[ SIM_WORD( SIM_GPIO_ODR ) ] = ( Reg[ SIM_WORD( SIM_GPIO_ODR ) ] & ~( Value >> 16u ) ) | ( Value & 0xFFFFu );
+        }
+        else if( Offset == SIM_GPIO_BRR )
+        {
+            Reg[ SIM_WORD( SIM_GPIO_ODR ) ] &= ~( Value & 0xFFFFu );
+        }
+        else if( Offset == SIM_GPIO_ODR )
+        {
+            Reg[ SIM_WORD( SIM_GPIO_ODR ) ] = Value & 0xFFFFu;
+        }
+        else if( ( Offset != SIM_GPIO_IDR ) && ( Offset < SIM_GPIO_BRR ) )
+        {
+            Reg[ SIM_WORD( Offset ) ] = Value;
+        }
+        else
+        {
+            Applied = FALSE;
+        }
+    }
+    else if( Peripheral == SIM_SYSTICK )
+    {
+        Offset = SIM_OFFSET( Address, SIM_SYST_BASE );
+        if( Offset == SIM_SYST_CSR )
+        {
+            Sim_Syst[ 0 ] = ( Sim_Syst[ 0 ] & SIM_CSR_COUNTFLAG ) | ( Value & SIM_CSR_WRITABLE );
+        }
+        else if( Offset == SIM_SYST_RVR )
+        {
+            Sim_Syst[ 1 ] = Value & SIM_SYST_MAX;
+        }
+        else if( Offset == SIM_SYST_CVR )
+        {
+            /*any write clears the counter and the flag*/
+            Sim_Syst[ 2 ] = 0u;
+            Sim_Syst[ 0 ] &= ~SIM_CSR_COUNTFLAG;
+        }
+        else
+        {
+            Applied = FALSE;
+        }
+    }
+    else if( Peripheral == SIM_DMA )
+    {
+        Offset = SIM_OFFSET( Address, SIM_DMA_BASE );
+        if( Offset == SIM_DMA_IFCR )
+        {
+            Sim_Dma[ SIM_WORD( SIM_DMA_ISR ) ] &= ~Value;
+        }
+        else if( ( Offset >= SIM_DMA_CCR ) && ( Offset < ( SIM_DMA_CCR + ( SIM_DMA_CHANNELS * SIM_DMA_STRIDE ) ) ) )
+        {
+            uint32 Channel = ( Offset - SIM_DMA_CCR ) / SIM_DMA_STRIDE;
+            uint32 Field   = ( Offset - SIM_DMA_CCR ) % SIM_DMA_STRIDE;
+            uint32 Ccr     = Sim_Dma[ SIM_WORD( SIM_DMA_CCR + ( Channel * SIM_DMA_STRIDE ) ) ];
+
+            if( Field == 0u )
+            {
+                Sim_Dma[ SIM_WORD( Offset ) ] = Value;
+                if( ( ( Ccr & SIM_CCR_EN ) == 0u ) && ( ( Value & SIM_CCR_EN ) != 0u ) )
+                {
+                    Sim_DmaEnable( Channel );
+                }
+            }
+            else if( ( Ccr & SIM_CCR_EN ) == 0u )
+            {
+                /*count and addresses are locked while the channel runs*/
+                Sim_Dma[ SIM_WORD( Offset ) ] = ( Field == SIM_DMA_CNDTR ) ? ( Value & 0xFFFFu ) : Value;
+            }
+            else
+            {
+                Applied = FALSE;
+            }
+        }
+        else
+        {
+            Applied = FALSE;
+        }
+    }
+    else
+    {
+        Applied = FALSE;
+    }
+    return Applied;
+}
+
+/**
+ * @brief   **Host memory behind a target address**
+ *
+ * @param[in] Address Target address
+ * @param[in] Size Bytes accessed
+ *
+ * @retval  Host pointer, NULL_PTR when no window holds all the bytes
+ */
+static uint8 *Sim_Memory( uint32 Address, uint32 Size )
+{
+    uint8 *Memory = NULL_PTR;
+
+    for( uint32 Map = 0u; ( Map < Sim_MapCount ) && ( Memory == NULL_PTR ); Map++ )
+    {
+        if( ( ( Address - Sim_Maps[ Map ].Address ) < Sim_Maps[ Map ].Size ) &&
+            ( ( Sim_Maps[ Map ].Size - ( Address - Sim_Maps[ Map ].Address ) ) >= Size ) )
+        {
+            Memory = &Sim_Maps[ Map ].Memory[ Address - Sim_Maps[ Map ].Address ];
+        }
+    }
+    return Memory;
+}
+
+/**
+ * @brief   **DMA bus read**
+ *
+ * @param[in] Address Target address
+ * @param[in] Size Bytes to read, 1, 2 or 4
+ * @param[out] Value Data read, zero extended
+ *
+ * @retval  TRUE on success, FALSE on a bus error
+ */
+static boolean Sim_BusRead( uint32 Address, uint32 Size, uint32 *Value )
+{
+    boolean Done                  = TRUE;
+    uint8 *Memory                 = Sim_Memory( Address, Size );
+    Sim_PeripheralType Peripheral = Sim_Find( Address );
+
+    *Value = 0u;
+    if( Memory != NULL_PTR )
+    {
+        for( uint32 Byte = 0u; Byte < Size; Byte++ )
+        {
+            *Value |= (uint32)Memory[ Byte ] << ( Byte << 3u );
+        }
+    }
+    else if( ( Peripheral != SIM_OTHER ) && ( Sim_Clocked( Peripheral, Address ) == TRUE ) )
+    {
+        *Value = Sim_Read( Peripheral, Address & ~3u, FALSE ) >> ( ( Address & 3u ) << 3u );
+        *Value &= ( Size < 4u ) ? ( ( 1u << ( Size << 3u ) ) - 1u ) : 0xFFFFFFFFu;
+    }
+    else
+    {
+        Done = FALSE;
+    }
+    return Done;
+}
+
+/**
+ * @brief   **DMA bus write**
+ *
+ * @param[in] Address Target address
+ * @param[in] Size Bytes to write, 1, 2 or 4
+ * @param[in] Value Data to write, the upper bytes beyond Size are dropped
+ *
+ * @retval  TRUE on success, FALSE on a bus error
+ */
+static boolean Sim_BusWrite( uint32 Address, uint32 Size, uint32 Value )
+{
+    boolean Done                  = TRUE;
+    uint8 *Memory                 = Sim_Memory( Address, Size );
+    Sim_PeripheralType Peripheral = Sim_Find( Address );
+
+    if( Memory != NULL_PTR )
+    {
+        for( uint32 Byte = 0u; Byte < Size; Byte++ )
+        {
+            Memory[ Byte ] = (uint8)( Value >> ( Byte << 3u ) );
+        }
+    }
+    else if( ( Peripheral != SIM_OTHER ) && ( Sim_Clocked( Peripheral, Address ) == TRUE ) )
+    {
+        (void)Sim_Write( Peripheral, Address & ~3u, Value );
+    }
+    else
+    {
+        Done = FALSE;
+    }
+    return Done;
+}
+
+/**
+ * @brief   **Move one DMA item**
+ *
+ * Reads one item from the source with its size and writes it to the destination with the other
+ * size, zero extended or truncated. A bus error disables the channel and sets TEIF.
+ *
+ * @param[in] Channel Channel index, 0 for channel 1
+ */
+static void Sim_DmaTransfer( uint32 Channel )
+{
+    uint32 *Reg   = &Sim_Dma[ SIM_WORD( SIM_DMA_CCR + ( Channel * SIM_DMA_STRIDE ) ) ];
+    uint32 Ccr    = Reg[ 0 ];
+    uint32 PSize  = 1u << ( ( Ccr >> 8u ) & 3u );
+    uint32 MSize  = 1u << ( ( Ccr >> 10u ) & 3u );
+    uint32 PAddr  = Reg[ SIM_WORD( SIM_DMA_CPAR ) ] + ( ( ( Ccr & SIM_CCR_PINC ) != 0u ) ? ( Sim_DmaItem[ Channel ] * PSize ) : 0u );
+    uint32 MAddr  = Reg[ SIM_WORD( SIM_DMA_CMAR ) ] + ( ( ( Ccr & SIM_CCR_MINC ) != 0u ) ? ( Sim_DmaItem[ Channel ] * MSize ) : 0u );
+    uint32 Flags  = 0u;
+    uint32 Value;
+    boolean Done;
+
+    PSize = ( PSize > 4u ) ? 4u : PSize;
+    MSize = ( MSize > 4u ) ? 4u : MSize;
+    if( ( Ccr & SIM_CCR_DIR ) != 0u )
+    {
+        Done = ( Sim_BusRead( MAddr, MSize, &Value ) == TRUE ) ? Sim_BusWrite( PAddr, PSize, Value ) : FALSE;
+    }
+    else
+    {
+        Done = ( Sim_BusRead( PAddr, PSize, &Value ) == TRUE ) ? Sim_BusWrite( MAddr, MSize, Value ) : FALSE;
+    }
+
+    if( Done == FALSE )
+    {
+        Reg[ 0 ] &= ~SIM_CCR_EN;
+        Flags = SIM_ISR_TEIF;
+    }
+    else
+    {
+        Sim_DmaItem[ Channel ]++;
+        Reg[ SIM_WORD( SIM_DMA_CNDTR ) ]--;
+        Flags = ( Reg[ SIM_WORD( SIM_DMA_CNDTR ) ] == ( Sim_DmaCount[ Channel ] >> 1u ) ) ? SIM_ISR_HTIF : 0u;
+        if( Reg[ SIM_WORD( SIM_DMA_CNDTR ) ] == 0u )
+        {
+            Flags |= SIM_ISR_TCIF;
+            if( ( Ccr & SIM_CCR_CIRC ) != 0u )
+            {
+                Reg[ SIM_WORD( SIM_DMA_CNDTR ) ] = Sim_DmaCount[ Channel ];
+                Sim_DmaItem[ Channel ]           = 0u;
+            }
+        }
+    }
+    Sim_Dma[ SIM_WORD( SIM_DMA_ISR ) ] |= ( Flags != 0u ) ? ( ( Flags | SIM_ISR_GIF ) << ( Channel << 2u ) ) : 0u;
+}
+
+/**
+ * @brief   **DMA channel enabled**
+ *
+ * Latches the item count, a memory to memory channel moves all its items at once.
+ *
+ * @param[in] Channel Channel index, 0 for channel 1
+ */
+static void Sim_DmaEnable( uint32 Channel )
+{
+    uint32 *Reg = &Sim_Dma[ SIM_WORD( SIM_DMA_CCR + ( Channel * SIM_DMA_STRIDE ) ) ];
+
+    Sim_DmaCount[ Channel ] = (uint16)Reg[ SIM_WORD( SIM_DMA_CNDTR ) ];
+    Sim_DmaItem[ Channel ]  = 0u;
+    if( ( Reg[ 0 ] & SIM_CCR_MEM2MEM ) != 0u )
+    {
+        for( uint32 Item = 0u; ( Item < Sim_DmaCount[ Channel ] ) && ( ( Reg[ 0 ] & SIM_CCR_EN ) != 0u ); Item++ )
+        {
+            Sim_DmaTransfer( Channel );
+        }
+    }
+}
+
+/**
+ * @brief   **Reset the simulator**
+ *
+ * Loads the reset value of every register, clears the counters, the external pin levels and the
+ * memory windows, and makes the PLL lock again.
+ */
+void Sim_Init( void )
+{
+    for( uint32 Word = 0u; Word < SIM_BLOCK_WORDS; Word++ )
+    {
+        Sim_Rcc[ Word ]   = 0u;
+        Sim_Flash[ Word ] = 0u;
+        Sim_Dma[ Word ]   = 0u;
+        for( uint32 Port = 0u; Port < SIM_GPIO_PORTS; Port++ )
+        {
+            Sim_Gpio[ Port ][ Word ] = 0u;
+        }
+    }
+    for( uint32 Port = 0u; Port < SIM_GPIO_PORTS; Port++ )
+    {
+        Sim_Gpio[ Port ][ SIM_WORD( SIM_GPIO_MODER ) ] = 0xFFFFFFFFu;
+        Sim_Input[ Port ]                              = 0u;
+    }
+    for( uint32 Channel = 0u; Channel < SIM_DMA_CHANNELS; Channel++ )
+    {
+        Sim_DmaCount[ Channel ] = 0u;
+        Sim_DmaItem[ Channel ]  = 0u;
+    }
+    for( uint32 Word = 0u; Word < SIM_SYST_WORDS; Word++ )
+    {
+        Sim_Syst[ Word ] = 0u;
+    }
+
+    /*reset values from the reference manual, SWD pins on GPIOA*/
+    Sim_Rcc[ SIM_WORD( SIM_RCC_CR ) ]           = SIM_CR_HSION;
+    Sim_Rcc[ SIM_WORD( SIM_RCC_PLLCFGR ) ]      = 0x00001000u;
+    Sim_Rcc[ SIM_WORD( SIM_RCC_AHBENR ) ]       = 0x00000100u;
+    Sim_Flash[ SIM_WORD( SIM_FLASH_ACR ) ]      = 0x00040600u;
+    Sim_Gpio[ 0 ][ SIM_WORD( SIM_GPIO_MODER ) ] = 0xEBFFFFFFu;
+    Sim_Gpio[ 0 ][ SIM_WORD( 0x08u ) ]          = 0x0C000000u;
+    Sim_Gpio[ 0 ][ SIM_WORD( 0x0Cu ) ]          = 0x24000000u;
+
+    Sim_MapCount       = 0u;
+    Sim_PllLocks       = TRUE;
+    Sim_SysTickHandler = NULL_PTR;
+    Sim_Cycles         = 0u;
+    Sim_Exceptions     = 0u;
+    Sim_Masked         = FALSE;
+    Sim_Pending        = FALSE;
+    Sim_ResetCounters();
+}
+
+/**
+ * @brief   **Clear the access counters**
+ *
+ * Call it right before the API call to profile, the counters then hold the accesses of that call.
+ */
+void Sim_ResetCounters( void )
+{
+    for( uint32 Peripheral = 0u; Peripheral < (uint32)SIM_PERIPHERALS; Peripheral++ )
+    {
+        Sim_Counters[ Peripheral ].Reads   = 0u;
+        Sim_Counters[ Peripheral ].Writes  = 0u;
+        Sim_Counters[ Peripheral ].Ignored = 0u;
+    }
+}
+
+/**
+ * @brief   **Access counters of a peripheral**
+ *
+ * @param[in] Peripheral Peripheral to look up
+ *
+ * @retval  Accesses done by the core since the last Sim_ResetCounters
+ */
+const Sim_CountersType *Sim_GetCounters( Sim_PeripheralType Peripheral )
+{
+    return &Sim_Counters[ ( Peripheral < SIM_PERIPHERALS ) ? Peripheral : SIM_OTHER ];
+}
+
+/**
+ * @brief   **Register writes on all the peripherals**
+ *
+ * @retval  Writes done by the core since the last Sim_ResetCounters
+ */
+uint32 Sim_GetWrites( void )
+{
+    uint32 Writes = 0u;
+
+    for( uint32 Peripheral = 0u; Peripheral < (uint32)SIM_PERIPHERALS; Peripheral++ )
+    {
+        Writes += Sim_Counters[ Peripheral ].Writes;
+    }
+    return Writes;
+}
+
+/**
+ * @brief   **Register value seen by a test**
+ *
+ * Reads a register without counting the access and without side effects like clearing COUNTFLAG,
+ * a peripheral with its clock disabled still returns its registers.
+ *
+ * @param[in] Address Register address
+ *
+ * @retval  Register value
+ */
+uint32 Sim_Peek32( uint32 Address )
+{
+    return Sim_Read( Sim_Find( Address ), Address & ~3u, FALSE );
+}
+
+/**
+ * @brief   **Make the PLL lock or not**
+ *
+ * @param[in] Locks TRUE so PLLRDY follows PLLON, FALSE so it never sets
+ */
+void Sim_SetPllLock( boolean Locks )
+{
+    Sim_PllLocks = Locks;
+}
+
+/**
+ * @brief   **Drive the external level of a port**
+ *
+ * @param[in] Port Port index, 0 for GPIOA
+ * @param[in] Levels Level of the pins, bit n is pin n
+ */
+void Sim_SetInput( uint8 Port, uint16 Levels )
+{
+    if( Port < SIM_GPIO_PORTS )
+    {
+        Sim_Input[ Port ] = Levels;
+    }
+}
+
+/**
+ * @brief   **Function to run on each SysTick exception**
+ *
+ * @param[in] Handler Exception handler, like SysTick_Handler, NULL_PTR for none
+ */
+void Sim_SetSysTickHandler( void ( *Handler )( void ) )
+{
+    Sim_SysTickHandler = Handler;
+}
+
+/**
+ * @brief   **Take the pending exception**
+ *
+ * Runs the SysTick handler when the exception is pending and the interrupts are not masked.
+ */
+static void Sim_TakeException( void )
+{
+    if( ( Sim_Pending == TRUE ) && ( Sim_Masked == FALSE ) )
+    {
+        Sim_Pending = FALSE;
+        Sim_Exceptions++;
+        if( Sim_SysTickHandler != NULL_PTR )
+        {
+            Sim_SysTickHandler();
+        }
+    }
+}
+
+/**
+ * @brief   **Mask the interrupts**
+ *
+ * The host version of PRIMASK, while masked a SysTick exception stays pending and its handler runs
+ * once unmasked, like the core does when leaving a critical section.
+ *
+ * @param[in] Masked TRUE to mask, FALSE to unmask
+ */
+void Sim_SetInterruptMask( boolean Masked )
+{
+    Sim_Masked = Masked;
+    Sim_TakeException();
+}
+
+/**
+ * @brief   **Run the core clock**
+ *
+ * SysTick counts down one per cycle, the counter reloads from RVR the cycle after reaching zero
+ * and the count to zero sets COUNTFLAG and, with TICKINT, pends the exception, taken at once
+ * unless the interrupts are masked.
+ *
+ * @param[in] Cycles Core clock cycles to run
+ */
+void Sim_Advance( uint32 Cycles )
+{
+    uint32 Step;
+
+    Sim_Cycles += Cycles;
+    while( ( Cycles > 0u ) && ( ( Sim_Syst[ 0 ] & SIM_CSR_ENABLE ) != 0u ) && ( ( Sim_Syst[ 1 ] | Sim_Syst[ 2 ] ) != 0u ) )
+    {
+        if( Sim_Syst[ 2 ] == 0u )
+        {
+            Sim_Syst[ 2 ] = Sim_Syst[ 1 ];
+            Cycles--;
+        }
+        else
+        {
+            Step = ( Cycles < Sim_Syst[ 2 ] ) ? Cycles : Sim_Syst[ 2 ];
+            Sim_Syst[ 2 ] -= Step;
+            Cycles -= Step;
+            if( Sim_Syst[ 2 ] == 0u )
+            {
+                Sim_Syst[ 0 ] |= SIM_CSR_COUNTFLAG;
+                Sim_Pending = ( ( Sim_Syst[ 0 ] & SIM_CSR_TICKINT ) != 0u ) ? TRUE : Sim_Pending;
+                Sim_TakeException();
+            }
+        }
+    }
+}
+
+/**
+ * @brief   **Sleep until the next interrupt**
+ *
+ * The host version of wfi, runs the clock until SysTick takes its next exception or, with the
+ * interrupts masked, pends it. Returns at once when an exception is already pending or SysTick
+ * cannot interrupt, there is nothing else to wake the core.
+ */
+void Sim_WaitForInterrupt( void )
+{
+    uint32 Exceptions = Sim_Exceptions;
+
+    if( ( ( Sim_Syst[ 0 ] & ( SIM_CSR_ENABLE | SIM_CSR_TICKINT ) ) == ( SIM_CSR_ENABLE | SIM_CSR_TICKINT ) ) &&
+        ( ( Sim_Syst[ 1 ] | Sim_Syst[ 2 ] ) != 0u ) )
+    {
+        while( ( Sim_Exceptions == Exceptions ) && ( Sim_Pending == FALSE ) )
+        {
+            Sim_Advance( ( Sim_Syst[ 2 ] == 0u ) ? 1u : Sim_Syst[ 2 ] );
+        }
+    }
+}
+
+/**
+ * @brief   **Cycles run**
+ *
+ * @retval  Core clock cycles given to Sim_Advance since Sim_Init, wraps around
+ */
+uint32 Sim_GetCycles( void )
+{
+    return Sim_Cycles;
+}
+
+/**
+ * @brief   **SysTick exceptions taken**
+ *
+ * @retval  Exceptions since Sim_Init
+ */
+uint32 Sim_GetSysTickExceptions( void )
+{
+    return Sim_Exceptions;
+}
+
+/**
+ * @brief   **Let the DMA reach host memory**
+ *
+ * The DMA accesses Size bytes from Address through Memory, for instance a buffer placed at its
+ * SRAM address. Up to eight windows, the ones beyond are not mapped.
+ *
+ * @param[in] Address Target address of the first byte
+ * @param[in] Memory Host memory behind it
+ * @param[in] Size Bytes to map
+ */
+void Sim_MapMemory( uint32 Address, void *Memory, uint32 Size )
+{
+    if( Sim_MapCount < SIM_MAPS )
+    {
+        Sim_Maps[ Sim_MapCount ].Address = Address;
+        Sim_Maps[ Sim_MapCount ].Memory  = (uint8 *)Memory;
+        Sim_Maps[ Sim_MapCount ].Size    = Size;
+        Sim_MapCount++;
+    }
+}
+
+/**
+ * @brief   **Peripheral DMA request**
+ *
+ * Moves one item on the channel when it is enabled with items left, like a request from the
+ * peripheral routed to it through DMAMUX.
+ *
+ * @param[in] Channel Channel number, 1 to 7
+ */
+void Sim_DmaRequest( uint8 Channel )
+{
+    uint32 Index = (uint32)Channel - 1u;
+
+    if( ( Index < SIM_DMA_CHANNELS ) && ( ( Sim_Rcc[ SIM_WORD( SIM_RCC_AHBENR ) ] & SIM_AHBENR_DMA1EN ) != 0u ) &&
+        ( ( Sim_Dma[ SIM_WORD( SIM_DMA_CCR + ( Index * SIM_DMA_STRIDE ) ) ] & SIM_CCR_EN ) != 0u ) &&
+        ( Sim_Dma[ SIM_WORD( SIM_DMA_CCR + ( Index * SIM_DMA_STRIDE ) + SIM_DMA_CNDTR ) ] != 0u ) )
+    {
+        Sim_DmaTransfer( Index );
+    }
+}
+
+/**
+ * @brief   **Core register read**
+ *
+ * Implements the Reg.h host access, reads of a peripheral with its clock disabled return zero. Each
+ * core access takes a cycle, so SysTick loads RVR between the enable and the next access like on
+ * the target.
+ *
+ * @param[in] Address Register address
+ *
+ * @retval  Register value
+ */
+uint32 Reg_HostRead32( uint32 Address )
+{
+    Sim_PeripheralType Peripheral = Sim_Find( Address );
+    uint32 Value                  = 0u;
+
+    Sim_Counters[ Peripheral ].Reads++;
+    if( Sim_Clocked( Peripheral, Address ) == TRUE )
+    {
+        Value = Sim_Read( Peripheral, Address & ~3u, TRUE );
+    }
+    Sim_Advance( SIM_ACCESS_CYCLES );
+    return Value;
+}
+
+/**
+ * @brief   **Core register write**
+ *
+ * Implements the Reg.h host access, writes to a peripheral with its clock disabled are lost.
+ *
+ * @param[in] Address Register address
+ * @param[in] Value Value to write
+ */
+void Reg_HostWrite32( uint32 Address, uint32 Value )
+{
+    Sim_PeripheralType Peripheral = Sim_Find( Address );
+
+    Sim_Counters[ Peripheral ].Writes++;
+    if( ( Sim_Clocked( Peripheral, Address ) == FALSE ) || ( Sim_Write( Peripheral, Address & ~3u, Value ) == FALSE ) )
+    {
+        Sim_Counters[ Peripheral ].Ignored++;
+    }
+    Sim_Advance( SIM_ACCESS_CYCLES );
+}
+
+/**
+ * @brief   **Core register byte write**
+ *
+ * Implements the Reg.h host access, the other bytes of the register keep the value they read, write
+ * only registers like BSRR or IFCR read zero so a byte write only acts on its own lane.
+ *
+ * @param[in] Address Register address
+ * @param[in] Value Value to write
+ */
+void Reg_HostWrite8( uint32 Address, uint8 Value )
+{
+    Sim_PeripheralType Peripheral = Sim_Find( Address );
+    uint32 Shift                  = ( Address & 3u ) << 3u;
+    uint32 Word                   = Sim_Read( Peripheral, Address & ~3u, FALSE );
+
+    Sim_Counters[ Peripheral ].Writes++;
+    if( ( Sim_Clocked( Peripheral, Address ) == FALSE ) ||
+        ( Sim_Write( Peripheral, Address & ~3u, ( Word & ~( 0xFFu << Shift ) ) | ( (uint32)Value << Shift ) ) == FALSE ) )
+    {
+        Sim_Counters[ Peripheral ].Ignored++;
+    }
+    Sim_Advance( SIM_ACCESS_CYCLES );
+}
@@ -0,0 +1,63 @@
+/**
+ * @file    Sim.h
+ * @brief   **Host Peripheral Simulator**
+ *
+ * Models the STM32G0 peripherals the drivers use, RCC, FLASH, GPIO, SysTick and DMA, so driver code
+ * built for the host (UTEST) runs unchanged on Linux. The simulator implements the Reg.h host
+ * accesses, every register read and write lands on the model of its peripheral and is counted, so
+ * tests can check the resulting register state and benchmarks can report the accesses each API
+ * call costs.
+ *
+ * The models follow the reference manual where the drivers depend on it: PLLRDY follows PLLON,
+ * SWS follows SW, GPIO ports and DMA ignore accesses while their clock is disabled, BSRR and BRR
+ * act on ODR, IDR reads the output latch on output pins and the external level on input pins,
+ * SysTick counts down the cycles given to Sim_Advance plus one per register access, and DMA
+ * channels move data between the registers and the host memory mapped with Sim_MapMemory.
+ * Accesses outside the models read zero and are counted as SIM_OTHER.
+ */
+#ifndef SIM_H
+#define SIM_H
+
+#include "Std_Types.h"
+
+/**
+ * @brief   Peripherals with their own access counters
+ */
+typedef enum Sim_PeripheralType_Tag
+{
+    SIM_RCC = 0,     /*!< reset and clock control */
+    SIM_FLASH,       /*!< flash interface */
+    SIM_GPIO,        /*!< all the GPIO ports */
+    SIM_SYSTICK,     /*!< SysTick timer */
+    SIM_DMA,         /*!< DMA1 */
+    SIM_OTHER,       /*!< any address without a model */
+    SIM_PERIPHERALS, /*!< number of counters */
+} Sim_PeripheralType;
+
+/**
+ * @brief   Register accesses done by the core on one peripheral
+ */
+typedef struct Sim_CountersType_Tag
+{
+    uint32 Reads;   /*!< register reads */
+    uint32 Writes;  /*!< register writes, ignored ones included */
+    uint32 Ignored; /*!< writes without effect, clock disabled or read only register */
+} Sim_CountersType;
+
+void Sim_Init( void );
+void Sim_ResetCounters( void );
+const Sim_CountersType *Sim_GetCounters( Sim_PeripheralType Peripheral );
+uint32 Sim_GetWrites( void );
+uint32 Sim_Peek32( uint32 Address );
+void Sim_SetPllLock( boolean Locks );
+void Sim_SetInput( uint8 Port, uint16 Levels );
+void Sim_SetSysTickHandler( void ( *Handler )( void ) );
+void Sim_SetInterruptMask( boolean Masked );
+void Sim_Advance( uint32 Cycles );
+void Sim_WaitForInterrupt( void );
+uint32 Sim_GetCycles( void );
+uint32 Sim_GetSysTickExceptions( void );
+void Sim_MapMemory( uint32 Address, void *Memory, uint32 Size );
+void Sim_DmaRequest( uint8 Channel );
+
+#endif /* SIM_H */
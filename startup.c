@@ -1,4 +1,47 @@
 #include "Std_Types.h"
+#include "Startup.h"
+
+/**
+ * @brief   Instrumented interrupt dispatch, every exception but the reset goes through
+ *          Startup_IrqDispatch which counts it and measures its handler with SysTick, STD_ON or
+ *          STD_OFF, set with meson configure -Dirq_stats=true
+ */
+#ifndef STARTUP_IRQ_STATS
+#define STARTUP_IRQ_STATS STD_OFF
+#endif
+
+/**
+ * @brief   Vector table copied to SRAM at reset with VTOR pointing to it, handlers can then be
+ *          replaced with Startup_SetHandler, STD_ON or STD_OFF, set with meson configure
+ *          -Dram_vectors=true
+ */
+#ifndef STARTUP_RAM_VECTORS
+#define STARTUP_RAM_VECTORS STD_OFF
+#endif
+
+#if ( STARTUP_IRQ_STATS == STD_ON ) || ( STARTUP_RAM_VECTORS == STD_ON )
+#include "Reg_Map.h"
+#endif
+
+/*a vector holds a handler address, on host unit tests (UTEST) the addresses are 64 bits wide and
+the barriers are compiler ones*/
+/* clang-format off */
+#if defined( UTEST )
+#include <stdint.h>
+typedef uintptr_t Startup_VectorType;
+#define STARTUP_BARRIER()       __atomic_thread_fence( __ATOMIC_SEQ_CST )
+#else
+typedef uint32 Startup_VectorType;
+#define STARTUP_BARRIER()       __asm volatile( "dsb\n\tisb" : : : "memory" )
+#endif
+/* clang-format on */
+
+#if ( STARTUP_IRQ_STATS == STD_ON )
+/*the handlers table is only read by the dispatcher*/
+#define STARTUP_VECTORS_SECTION ".rodata.isr_handlers"
+#else
+#define STARTUP_VECTORS_SECTION ".isr_vectors"
+#endif
 
 /*external reference varibales form linker scripts*/
 extern uint8 __stack_init;    /*stack init address*/
@@ -52,58 +95,220 @@ void CEC_IRQHandler( void )                                 __attribute__((weak,
 /* clang-format on */
 
 /*The following array should be place at the first FLASH memory adress and it holds
-the stack pointer plus the 48 interrupts vector addresses*/
-__attribute__((section(".isr_vectors"))) uint32 vectors[] =
+the stack pointer plus the 48 interrupts vector addresses, nothing references it so it is
+marked used to survive link time optimization*/
+__attribute__((section(STARTUP_VECTORS_SECTION), used)) Startup_VectorType vectors[ STARTUP_VECTORS ] =
 {
-    (uint32)&__stack_init, /*Stack init address*/
-    (uint32)Reset_Handler,  /*function main address*/
-    (uint32)NMI_Handler,  /*NMI interrupt service routine address*/
-    (uint32)HardFault_Handler,  /*Hard Fault interrupt service routine address*/
-    (uint32)0,
-    (uint32)0,
-    (uint32)0,
-    (uint32)0,
-    (uint32)0,
-    (uint32)0,
-    (uint32)0,
-    (uint32)SVC_Handler,
-    (uint32)0,
-    (uint32)0,
-    (uint32)PendSV_Handler,
-    (uint32)SysTick_Handler,
-    (uint32)WWDG_IRQHandler,                   /* Window WatchDog              */
-    (uint32)PVD_VDDIO2_IRQHandler,             /* PVD through EXTI Line detect */
-    (uint32)RTC_TAMP_IRQHandler,               /* RTC through the EXTI line    */
-    (uint32)FLASH_IRQHandler,                  /* FLASH                        */
-    (uint32)RCC_CRS_IRQHandler,                /* RCC & CRS                    */
-    (uint32)EXTI0_1_IRQHandler,                /* EXTI Line 0 and 1            */
-    (uint32)EXTI2_3_IRQHandler,                /* EXTI Line 2 and 3            */
-    (uint32)EXTI4_15_IRQHandler,               /* EXTI Line 4 to 15            */
-    (uint32)USB_UCPD1_2_IRQHandler,            /* USB, UCPD1, UCPD2            */
-    (uint32)DMA1_Channel1_IRQHandler,          /* DMA1 Channel 1               */
-    (uint32)DMA1_Channel2_3_IRQHandler,        /* DMA1 Channel 2 and Channel 3 */
-    (uint32)DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR_IRQHandler, /* DMA1 Ch4 to Ch7, DMA2 Ch1 to Ch5, DMAMUX1 overrun */
-    (uint32)ADC1_COMP_IRQHandler,              /* ADC1, COMP1 and COMP2         */
-    (uint32)TIM1_BRK_UP_TRG_COM_IRQHandler,    /* TIM1 Break, Update, Trigger and Commutation */
-    (uint32)TIM1_CC_IRQHandler,                /* TIM1 Capture Compare         */
-    (uint32)TIM2_IRQHandler,                   /* TIM2                         */
-    (uint32)TIM3_TIM4_IRQHandler,              /* TIM3, TIM4                   */
-    (uint32)TIM6_DAC_LPTIM1_IRQHandler,        /* TIM6, DAC and LPTIM1         */
-    (uint32)TIM7_LPTIM2_IRQHandler,            /* TIM7 and LPTIM2              */
-    (uint32)TIM14_IRQHandler,                  /* TIM14                        */
-    (uint32)TIM15_IRQHandler,                  /* TIM15                        */
-    (uint32)TIM16_FDCAN_IT0_IRQHandler,        /* TIM16 & FDCAN1_IT0 & FDCAN2_IT0 */
-    (uint32)TIM17_FDCAN_IT1_IRQHandler,        /* TIM17 & FDCAN1_IT1 & FDCAN2_IT1 */
-    (uint32)I2C1_IRQHandler,                   /* I2C1                         */
-    (uint32)I2C2_3_IRQHandler,                 /* I2C2, I2C3                   */
-    (uint32)SPI1_IRQHandler,                   /* SPI1                         */
-    (uint32)SPI2_3_IRQHandler,                 /* SPI2, SPI3                   */
-    (uint32)USART1_IRQHandler,                 /* USART1                       */
-    (uint32)USART2_LPUART2_IRQHandler,         /* USART2 & LPUART2             */
-    (uint32)USART3_4_5_6_LPUART1_IRQHandler,   /* USART3, USART4, USART5, USART6, LPUART1   */
-    (uint32)CEC_IRQHandler
+    (Startup_VectorType)&__stack_init, /*Stack init address*/
+    (Startup_VectorType)Reset_Handler,  /*function main address*/
+    (Startup_VectorType)NMI_Handler,  /*NMI interrupt service routine address*/
+    (Startup_VectorType)HardFault_Handler,  /*Hard Fault interrupt service routine address*/
+    (Startup_VectorType)0,
+    (Startup_VectorType)0,
+    (Startup_VectorType)0,
+    (Startup_VectorType)0,
+    (Startup_VectorType)0,
+    (Startup_VectorType)0,
+    (Startup_VectorType)0,
+    (Startup_VectorType)SVC_Handler,
+    (Startup_VectorType)0,
+    (Startup_VectorType)0,
+    (Startup_VectorType)PendSV_Handler,
+    (Startup_VectorType)SysTick_Handler,
+    (Startup_VectorType)WWDG_IRQHandler,                   /* Window WatchDog              */
+    (Startup_VectorType)PVD_VDDIO2_IRQHandler,             /* PVD through EXTI Line detect */
+    (Startup_VectorType)RTC_TAMP_IRQHandler,               /* RTC through the EXTI line    */
+    (Startup_VectorType)FLASH_IRQHandler,                  /* FLASH                        */
+    (Startup_VectorType)RCC_CRS_IRQHandler,                /* RCC & CRS                    */
+    (Startup_VectorType)EXTI0_1_IRQHandler,                /* EXTI Line 0 and 1            */
+    (Startup_VectorType)EXTI2_3_IRQHandler,                /* EXTI Line 2 and 3            */
+    (Startup_VectorType)EXTI4_15_IRQHandler,               /* EXTI Line 4 to 15            */
+    (Startup_VectorType)USB_UCPD1_2_IRQHandler,            /* USB, UCPD1, UCPD2            */
+    (Startup_VectorType)DMA1_Channel1_IRQHandler,          /* DMA1 Channel 1               */
+    (Startup_VectorType)DMA1_Channel2_3_IRQHandler,        /* DMA1 Channel 2 and Channel 3 */
+    (Startup_VectorType)DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR_IRQHandler, /* DMA1 Ch4 to Ch7, DMA2 Ch1 to Ch5, DMAMUX1 overrun */
+    (Startup_VectorType)ADC1_COMP_IRQHandler,              /* ADC1, COMP1 and COMP2         */
+    (Startup_VectorType)TIM1_BRK_UP_TRG_COM_IRQHandler,    /* TIM1 Break, Update, Trigger and Commutation */
+    (Startup_VectorType)TIM1_CC_IRQHandler,                /* TIM1 Capture Compare         */
+    (Startup_VectorType)TIM2_IRQHandler,                   /* TIM2                         */
+    (Startup_VectorType)TIM3_TIM4_IRQHandler,              /* TIM3, TIM4                   */
+    (Startup_VectorType)TIM6_DAC_LPTIM1_IRQHandler,        /* TIM6, DAC and LPTIM1         */
+    (Startup_VectorType)TIM7_LPTIM2_IRQHandler,            /* TIM7 and LPTIM2              */
+    (Startup_VectorType)TIM14_IRQHandler,                  /* TIM14                        */
+    (Startup_VectorType)TIM15_IRQHandler,                  /* TIM15                        */
+    (Startup_VectorType)TIM16_FDCAN_IT0_IRQHandler,        /* TIM16 & FDCAN1_IT0 & FDCAN2_IT0 */
+    (Startup_VectorType)TIM17_FDCAN_IT1_IRQHandler,        /* TIM17 & FDCAN1_IT1 & FDCAN2_IT1 */
+    (Startup_VectorType)I2C1_IRQHandler,                   /* I2C1                         */
+    (Startup_VectorType)I2C2_3_IRQHandler,                 /* I2C2, I2C3                   */
+    (Startup_VectorType)SPI1_IRQHandler,                   /* SPI1                         */
+    (Startup_VectorType)SPI2_3_IRQHandler,                 /* SPI2, SPI3                   */
+    (Startup_VectorType)USART1_IRQHandler,                 /* USART1                       */
+    (Startup_VectorType)USART2_LPUART2_IRQHandler,         /* USART2 & LPUART2             */
+    (Startup_VectorType)USART3_4_5_6_LPUART1_IRQHandler,   /* USART3, USART4, USART5, USART6, LPUART1   */
+    (Startup_VectorType)CEC_IRQHandler
 };
 
+#if ( STARTUP_RAM_VECTORS == STD_ON )
+/*the table the core uses once VTOR points to SRAM, VTOR needs it aligned to the table size rounded
+up to a power of two*/
+__attribute__((aligned(256))) static Startup_VectorType Startup_RamVectors[ STARTUP_VECTORS ];
+#endif
+
+/*STARTUP_CORE_TABLE is the table the core starts with, STARTUP_HANDLERS the one holding the handlers
+the exceptions run, they differ when the dispatcher sits in between*/
+#if ( STARTUP_IRQ_STATS == STD_ON ) && ( STARTUP_RAM_VECTORS == STD_ON )
+/*the dispatcher takes the handlers from SRAM too, so they can be replaced*/
+static Startup_VectorType Startup_RamHandlers[ STARTUP_VECTORS ];
+#define STARTUP_CORE_TABLE      Startup_Dispatch
+#define STARTUP_HANDLERS        Startup_RamHandlers
+#elif ( STARTUP_IRQ_STATS == STD_ON )
+#define STARTUP_CORE_TABLE      Startup_Dispatch
+#define STARTUP_HANDLERS        vectors
+#elif ( STARTUP_RAM_VECTORS == STD_ON )
+#define STARTUP_CORE_TABLE      vectors
+#define STARTUP_HANDLERS        Startup_RamVectors
+#else
+#define STARTUP_CORE_TABLE      vectors
+#define STARTUP_HANDLERS        vectors
+#endif
+
+#if ( STARTUP_IRQ_STATS == STD_ON )
+/* clang-format off */
+#define STARTUP_SYSTICK         15u             /*!< SysTick exception number */
+#define STARTUP_IRQ_MAGIC       0x53515249u     /*!< "IRQS", lets the host decoder find the table */
+
+#define STARTUP_DISPATCH_2      (Startup_VectorType)Startup_IrqDispatch, (Startup_VectorType)Startup_IrqDispatch
+#define STARTUP_DISPATCH_4      STARTUP_DISPATCH_2, STARTUP_DISPATCH_2
+#define STARTUP_DISPATCH_8      STARTUP_DISPATCH_4, STARTUP_DISPATCH_4
+#define STARTUP_DISPATCH_16     STARTUP_DISPATCH_8, STARTUP_DISPATCH_8
+#define STARTUP_DISPATCH_32     STARTUP_DISPATCH_16, STARTUP_DISPATCH_16
+/* clang-format on */
+
+/**
+ * @brief   Occurrences and cost of one exception
+ */
+typedef struct Startup_IrqStatsType_Tag
+{
+    uint32 Count;     /*!< entries since reset */
+    uint32 Last;      /*!< SysTick exceptions counted at the last entry */
+    uint32 MaxCycles; /*!< longest handler run in core clock cycles */
+} Startup_IrqStatsType;
+
+/**
+ * @brief   Statistics of every exception, indexed by exception number as the vector table
+ */
+typedef struct Startup_IrqTableType_Tag
+{
+    uint32 Magic;                               /*!< STARTUP_IRQ_MAGIC once initialised */
+    uint32 Vectors;                             /*!< entries in Irq */
+    Startup_IrqStatsType Irq[ STARTUP_VECTORS ]; /*!< statistics per exception number */
+} Startup_IrqTableType;
+
+void Startup_IrqDispatch( void );
+
+/*RAM table read with the debugger, tools/irq_stats.py decodes a dump of the SRAM holding it*/
+Startup_IrqTableType Startup_IrqTable;
+
+/*the table the core uses, every exception but the reset enters the dispatcher which calls the
+handler from vectors*/
+__attribute__((section(".isr_vectors"), used)) const Startup_VectorType Startup_Dispatch[ STARTUP_VECTORS ] =
+{
+    (Startup_VectorType)&__stack_init,
+    (Startup_VectorType)Reset_Handler,
+    STARTUP_DISPATCH_32,
+    STARTUP_DISPATCH_8,
+    STARTUP_DISPATCH_4,
+    STARTUP_DISPATCH_2
+};
+
+/**
+ * @brief  **Instrumented exception dispatch**
+ *
+ * Takes the exception number from IPSR, counts the entry, stamps it with the number of SysTick
+ * exceptions so far and calls the handler from vectors, or from its SRAM copy with
+ * STARTUP_RAM_VECTORS. The handler run is measured with the
+ * SysTick current value, a wrap to the reload value is accounted once, so runs longer than a
+ * SysTick period and handlers running before Tmr_Init are not measured right. The time of the
+ * interrupts nested in the handler is included in its cycles.
+ */
+void Startup_IrqDispatch( void )
+{
+    Startup_IrqStatsType *Stats;
+    uint32 Vector;
+    uint32 Entry;
+    uint32 Exit;
+    uint32 Cycles;
+
+    __asm volatile( "mrs %0, ipsr" : "=r"( Vector ) );
+    Entry = REG_READ( &REG_SYSTICK->CVR );
+    Stats = &Startup_IrqTable.Irq[ Vector ];
+    Stats->Count++;
+    Stats->Last = Startup_IrqTable.Irq[ STARTUP_SYSTICK ].Count;
+
+    ( (Startup_HandlerType)STARTUP_HANDLERS[ Vector ] )();
+
+    /*SysTick counts down and reloads at zero*/
+    Exit   = REG_READ( &REG_SYSTICK->CVR );
+    Cycles = ( Exit <= Entry ) ? ( Entry - Exit ) : ( ( Entry + REG_READ( &REG_SYSTICK->RVR ) + 1u ) - Exit );
+    if( Cycles > Stats->MaxCycles )
+    {
+        Stats->MaxCycles = Cycles;
+    }
+}
+#endif
+
+/**
+ * @brief  **Install an exception handler**
+ *
+ * Replaces the handler of a vector in the SRAM table, the next exception already enters the new
+ * one. The vector is a single word write, an exception taken meanwhile runs either the old or the
+ * new handler. The interrupt shall be disabled if the old handler is not to run after the call.
+ *
+ * @param[in] Vector Exception number, 2 to 47, STARTUP_IRQ( n ) for the device interrupt n
+ * @param[in] Handler New handler
+ *
+ * @retval  E_OK: handler installed
+ *          E_NOT_OK: reset or stack entry, vector out of the table, null handler or the table is
+ *          in flash because STARTUP_RAM_VECTORS is STD_OFF
+ */
+Std_ReturnType Startup_SetHandler( uint8 Vector, Startup_HandlerType Handler )
+{
+    Std_ReturnType Status = E_NOT_OK;
+
+#if ( STARTUP_RAM_VECTORS == STD_ON )
+    if( ( Vector >= 2u ) && ( Vector < STARTUP_VECTORS ) && ( Handler != NULL_PTR ) )
+    {
+        STARTUP_HANDLERS[ Vector ] = (Startup_VectorType)Handler;
+        Status = E_OK;
+    }
+#else
+    (void)Vector;
+    (void)Handler;
+#endif
+
+    return Status;
+}
+
+/**
+ * @brief  **Get an exception handler**
+ *
+ * @param[in] Vector Exception number, 2 to 47
+ *
+ * @retval  Handler the exception runs, NULL_PTR for the reset and stack entries and vectors out of
+ *          the table
+ */
+Startup_HandlerType Startup_GetHandler( uint8 Vector )
+{
+    Startup_HandlerType Handler = NULL_PTR;
+
+    if( ( Vector >= 2u ) && ( Vector < STARTUP_VECTORS ) )
+    {
+        Handler = (Startup_HandlerType)STARTUP_HANDLERS[ Vector ];
+    }
+
+    return Handler;
+}
+
 /**
  * @brief  **Common vector handler**
  * 
@@ -146,5 +351,23 @@ void Reset_Handler(void)
         source++;
     }
 
+#if ( STARTUP_IRQ_STATS == STD_ON )
+    Startup_IrqTable.Magic   = STARTUP_IRQ_MAGIC;
+    Startup_IrqTable.Vectors = STARTUP_VECTORS;
+#endif
+
+#if ( STARTUP_RAM_VECTORS == STD_ON )
+    /*move the vector table to SRAM, the barriers make sure the next exception already uses it*/
+    for( uint32 i = 0u; i < STARTUP_VECTORS; i++ )
+    {
+        Startup_RamVectors[ i ] = STARTUP_CORE_TABLE[ i ];
+#if ( STARTUP_IRQ_STATS == STD_ON )
+        Startup_RamHandlers[ i ] = vectors[ i ];
+#endif
+    }
+    REG_WRITE( &REG_SCB->VTOR, (uint32)(Startup_VectorType)Startup_RamVectors );
+    STARTUP_BARRIER();
+#endif
+
     (void)main();
 }
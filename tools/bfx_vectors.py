@@ -0,0 +1,382 @@
+#!/usr/bin/env python3
+"""Generate the table driven Bfx unit tests from the vector description in YAML.
+
+Every routine of the YAML file gets a table of vectors per width, the vectors written by hand plus
+the ones expanded from its sweep, the cartesian product of the values listed for each argument.
+The expected results come from a reference model written here with plain Python integers, a hand
+written vector that disagrees with the model stops the generation so a typo never reaches a test.
+One Unity test per routine loops over its table, a test file per width.
+
+    $ python3 tools/bfx_vectors.py utest/vectors/Bfx_Vectors.yaml utest
+
+The sweep values are numbers, taken modulo the width, or these names:
+
+    all             every bit position, length or shift count allowed for the argument
+    zero, ones      all bits cleared or set
+    alt, alt2       0x55.. and 0xAA..
+    lsb, msb        only the lowest or the highest bit set
+    max             the highest signed value
+    mid             0x0123456789ABCDEF cut to the width
+    bits            every value with a single bit set
+    lowmasks        every value with the lowest n bits set, n from 0 to the width
+    highmasks       every value with the highest n bits set, n from 0 to the width
+"""
+import itertools
+import os
+import sys
+
+import yaml
+
+WIDTHS = [8, 16, 32, 64]
+
+HEADER = """/**
+ * @file    Test_Bfx_Vectors_{w}bits.c
+ * @brief   **Table Driven Unit Test for the {w} Bit Handling Routines**
+ *
+ * Generated by tools/bfx_vectors.py from utest/vectors/Bfx_Vectors.yaml, do not edit, change the
+ * YAML file and run meson compile -C build vectors instead.
+ *
+ * Each test runs every vector in the table of its routine, {count} vectors in total. The expected
+ * results come from the reference model of the generator.
+ */
+#include <stdio.h>
+#include "unity.h"
+#include "Std_Types.h"
+#include "Bfx_{w}bits.h"
+
+void setUp( void )
+{{
+}}
+
+void tearDown( void )
+{{
+}}
+
+static char Message[ 64 ];
+
+static const char *Vector( const char *Routine, uint32 Index )
+{{
+    (void)snprintf( Message, sizeof( Message ), "%s vector %u", Routine, (unsigned)Index );
+    return Message;
+}}
+"""
+
+TEST = """
+/* clang-format off */
+static const struct
+{{
+{fields}
+}} {table}[] = {{
+{rows}
+}};
+/* clang-format on */
+
+/**
+ * @brief   **Test {name} vectors**
+ *
+ * The test runs the {count} vectors of the table, every vector holds the arguments and the
+ * expected result.{reqs}
+ */
+void test__{name}__vectors( void )
+{{
+    for( uint32 i = 0u; i < ( sizeof( {table} ) / sizeof( {table}[ 0 ] ) ); i++ )
+    {{
+{body}
+    }}
+}}
+"""
+
+
+def ones(w):
+    return (1 << w) - 1
+
+
+def signed(value, w):
+    value &= ones(w)
+    return value - (1 << w) if value >> (w - 1) else value
+
+
+def leading(value, w, bit):
+    count = 0
+    for i in reversed(range(w)):
+        if (value >> i) & 1 != bit:
+            break
+        count += 1
+    return count
+
+
+def deposit(data, mask, w):
+    result, bit = 0, 0
+    for i in range(w):
+        if (mask >> i) & 1:
+            result |= ((data >> bit) & 1) << i
+            bit += 1
+    return result
+
+
+def extract(data, mask, w):
+    result, bit = 0, 0
+    for i in range(w):
+        if (mask >> i) & 1:
+            result |= ((data >> i) & 1) << bit
+            bit += 1
+    return result
+
+
+def put_bits(data, start, length, pattern):
+    mask = ((1 << length) - 1) << start
+    return (data & ~mask) | ((pattern << start) & mask)
+
+
+def put_bit(data, pn, status):
+    return (data | (1 << pn)) if status else (data & ~(1 << pn))
+
+
+def sat(value, low, high):
+    return max(low, min(high, value))
+
+
+# argument kinds, the C type of the table field and how the routine takes it
+KINDS = {
+    "data": "uint{w}",
+    "sdata": "sint{w}",
+    "pn": "uint8",
+    "start": "uint8",
+    "ln": "uint8",
+    "cnt": "uint8",
+    "scnt": "sint8",
+    "status": "uint8",
+    "bool": "boolean",
+}
+
+# routine name, C name, arguments (name, kind), in place or the result kind, and the reference model
+# as a function of the width and the arguments
+# fmt: off
+ROUTINES = {
+    "SetBit":            ("Bfx_SetBit_u{w}u8", [("Data", "data"), ("BitPn", "pn")], "inplace",
+                          lambda w, d, p: d | (1 << p)),
+    "ClrBit":            ("Bfx_ClrBit_u{w}u8", [("Data", "data"), ("BitPn", "pn")], "inplace",
+                          lambda w, d, p: d & ~(1 << p)),
+    "GetBit":            ("Bfx_GetBit_u{w}u8_u8", [("Data", "data"), ("BitPn", "pn")], "bool",
+                          lambda w, d, p: (d >> p) & 1),
+    "PutBit":            ("Bfx_PutBit_u{w}u8u8", [("Data", "data"), ("BitPn", "pn"), ("Status", "bool")], "inplace",
+                          lambda w, d, p, s: put_bit(d, p, s)),
+    "SetBits":           ("Bfx_SetBits_u{w}u8u8u8", [("Data", "data"), ("BitStartPn", "start"), ("BitLn", "ln"), ("Status", "status")], "inplace",
+                          lambda w, d, p, n, s: put_bits(d, p, n, ones(w) if s else 0)),
+    "GetBits":           ("Bfx_GetBits_u{w}u8u8_u{w}", [("Data", "data"), ("BitStartPn", "start"), ("BitLn", "ln")], "data",
+                          lambda w, d, p, n: (d >> p) & ((1 << n) - 1)),
+    "PutBits":           ("Bfx_PutBits_u{w}u8u8u{w}", [("Data", "data"), ("BitStartPn", "start"), ("BitLn", "ln"), ("Pattern", "data")], "inplace",
+                          lambda w, d, p, n, t: put_bits(d, p, n, t)),
+    "SetBitMask":        ("Bfx_SetBitMask_u{w}u{w}", [("Data", "data"), ("Mask", "data")], "inplace",
+                          lambda w, d, m: d | m),
+    "ClrBitMask":        ("Bfx_ClrBitMask_u{w}u{w}", [("Data", "data"), ("Mask", "data")], "inplace",
+                          lambda w, d, m: d & ~m),
+    "TstBitMask":        ("Bfx_TstBitMask_u{w}u{w}_u8", [("Data", "data"), ("Mask", "data")], "bool",
+                          lambda w, d, m: int((d & m) == m)),
+    "TstBitLnMask":      ("Bfx_TstBitLnMask_u{w}u{w}_u8", [("Data", "data"), ("Mask", "data")], "bool",
+                          lambda w, d, m: int((d & m) != 0)),
+    "TstParityEven":     ("Bfx_TstParityEven_u{w}_u8", [("Data", "data")], "bool",
+                          lambda w, d: int(bin(d).count("1") % 2 == 0)),
+    "ToggleBits":        ("Bfx_ToggleBits_u{w}", [("Data", "data")], "inplace",
+                          lambda w, d: ~d),
+    "ToggleBitMask":     ("Bfx_ToggleBitMask_u{w}u{w}", [("Data", "data"), ("Mask", "data")], "inplace",
+                          lambda w, d, m: d ^ m),
+    "ShiftBitRt":        ("Bfx_ShiftBitRt_u{w}u8", [("Data", "data"), ("ShiftCnt", "cnt")], "inplace",
+                          lambda w, d, c: d >> c),
+    "ShiftBitLt":        ("Bfx_ShiftBitLt_u{w}u8", [("Data", "data"), ("ShiftCnt", "cnt")], "inplace",
+                          lambda w, d, c: d << c),
+    "RotBitRt":          ("Bfx_RotBitRt_u{w}u8", [("Data", "data"), ("ShiftCnt", "cnt")], "inplace",
+                          lambda w, d, c: (d >> c) | (d << (w - c))),
+    "RotBitLt":          ("Bfx_RotBitLt_u{w}u8", [("Data", "data"), ("ShiftCnt", "cnt")], "inplace",
+                          lambda w, d, c: (d << c) | (d >> (w - c))),
+    "CopyBit":           ("Bfx_CopyBit_u{w}u8u{w}u8", [("DestinationData", "data"), ("DestinationPosition", "pn"), ("SourceData", "data"), ("SourcePosition", "pn")], "inplace",
+                          lambda w, d, dp, s, sp: put_bit(d, dp, (s >> sp) & 1)),
+    "PutBitsMask":       ("Bfx_PutBitsMask_u{w}u{w}u{w}", [("Data", "data"), ("Pattern", "data"), ("Mask", "data")], "inplace",
+                          lambda w, d, t, m: (t & m) | (d & ~m)),
+    "ShiftBitSatU":      ("Bfx_ShiftBitSat_u{w}s8_u{w}", [("Data", "data"), ("ShiftCnt", "scnt")], "data",
+                          lambda w, d, c: min(d << c, ones(w)) if c >= 0 else d >> -c),
+    "ShiftBitSatS":      ("Bfx_ShiftBitSat_s{w}s8_s{w}", [("Data", "sdata"), ("ShiftCnt", "scnt")], "sdata",
+                          lambda w, d, c: sat(d << c, -(1 << (w - 1)), ones(w - 1)) if c >= 0 else d >> -c),
+    "CountLeadingOnes":  ("Bfx_CountLeadingOnes_u{w}", [("Data", "data")], "count",
+                          lambda w, d: leading(d, w, 1)),
+    "CountLeadingZeros": ("Bfx_CountLeadingZeros_u{w}", [("Data", "data")], "count",
+                          lambda w, d: leading(d, w, 0)),
+    "CountLeadingSigns": ("Bfx_CountLeadingSigns_s{w}", [("Data", "sdata")], "count",
+                          lambda w, d: leading(d & ones(w - 1), w - 1, (d >> (w - 1)) & 1)),
+    "CountTrailingZeros": ("Bfx_CountTrailingZeros_u{w}", [("Data", "data")], "count",
+                          lambda w, d: (d & -d).bit_length() - 1 if d else w),
+    "DepositBits":       ("Bfx_DepositBits_u{w}u{w}_u{w}", [("Data", "data"), ("Mask", "data")], "data",
+                          lambda w, d, m: deposit(d, m, w)),
+    "ExtractBits":       ("Bfx_ExtractBits_u{w}u{w}_u{w}", [("Data", "data"), ("Mask", "data")], "data",
+                          lambda w, d, m: extract(d, m, w)),
+}
+# fmt: on
+
+
+def fail(message):
+    sys.exit("bfx_vectors: " + message)
+
+
+def values(token, kind, w):
+    """Values of a sweep entry for the width."""
+    if token == "all":
+        return {
+            "pn": range(w),
+            "start": range(w),
+            "cnt": range(w),
+            "ln": range(w + 1),
+            "scnt": range(-(w - 1), w),
+            "status": [0, 1],
+            "bool": [0, 1],
+        }[kind]
+    named = {
+        "zero": [0],
+        "ones": [ones(w)],
+        "alt": [0x5555555555555555 & ones(w)],
+        "alt2": [0xAAAAAAAAAAAAAAAA & ones(w)],
+        "lsb": [1],
+        "msb": [1 << (w - 1)],
+        "max": [ones(w - 1)],
+        "mid": [0x0123456789ABCDEF & ones(w)],
+        "bits": [1 << i for i in range(w)],
+        "lowmasks": [(1 << i) - 1 for i in range(w + 1)],
+        "highmasks": [ones(w) ^ ((1 << (w - i)) - 1) for i in range(w + 1)],
+    }
+    if isinstance(token, str):
+        if token not in named:
+            fail("unknown sweep value " + token)
+        return named[token]
+    return [token]
+
+
+def valid(args, kinds, w):
+    """Arguments inside the range allowed by the specification."""
+    start = 0
+    for value, kind in zip(args, kinds):
+        if kind == "start":
+            start = value
+        if kind == "ln" and start + value > w:
+            return False
+    return True
+
+
+def normalize(value, kind, w):
+    if kind in ("data", "sdata"):
+        return signed(value, w) if kind == "sdata" else value & ones(w)
+    return value
+
+
+def literal(value, kind, w):
+    if kind == "data":
+        return "0x{:0{}X}u".format(value, w // 4)
+    if kind == "sdata":
+        return "INT{}_MIN".format(w) if value == -(1 << (w - 1)) else str(value)
+    if kind in ("scnt",):
+        return str(value)
+    if kind == "bool":
+        return "TRUE" if value else "FALSE"
+    return "{}u".format(value)
+
+
+def assertion(kind, w):
+    return {
+        "data": "TEST_ASSERT_EQUAL_HEX{}_MESSAGE".format(w),
+        "sdata": "TEST_ASSERT_EQUAL_INT{}_MESSAGE".format(w),
+        "bool": "TEST_ASSERT_EQUAL_UINT8_MESSAGE",
+        "count": "TEST_ASSERT_EQUAL_UINT8_MESSAGE",
+    }[kind]
+
+
+def vectors(routine, spec, w):
+    cname, arguments, result, model = ROUTINES[routine]
+    kinds = [kind for _, kind in arguments]
+    rkind = "data" if result == "inplace" else result
+    rows = []
+
+    for vector in spec.get("vectors", {}).get(w, []):
+        if len(vector) != len(arguments) + 1:
+            fail("{} {} bits vector {} needs {} values".format(routine, w, vector, len(arguments) + 1))
+        args = [normalize(v, k, w) for v, k in zip(vector, kinds)]
+        expected = normalize(model(w, *args), rkind, w)
+        if not valid(args, kinds, w) or normalize(vector[-1], rkind, w) != expected:
+            fail("{} {} bits vector {} disagrees with the model, expected {:#x}".format(routine, w, vector, expected))
+        rows.append(args + [expected])
+
+    sweep = spec.get("sweep", {})
+    if sweep:
+        lists = []
+        for name, kind in arguments:
+            tokens = sweep.get(name)
+            if tokens is None:
+                fail("{} sweep misses {}".format(routine, name))
+            tokens = tokens if isinstance(tokens, list) else [tokens]
+            lists.append([normalize(v, kind, w) for t in tokens for v in values(t, kind, w)])
+        for args in itertools.product(*lists):
+            if valid(args, kinds, w):
+                rows.append(list(args) + [normalize(model(w, *args), rkind, w)])
+    return rows
+
+
+def test(routine, spec, w, rows):
+    cname, arguments, result, _ = ROUTINES[routine]
+    name = cname.format(w=w)
+    table = name[len("Bfx_"):]
+    rkind = "data" if result == "inplace" else result
+    kinds = [kind for _, kind in arguments] + [rkind]
+    ctype = dict(KINDS, count="uint8")
+    fields = ["    {} {};".format(ctype[k].format(w=w), n) for (n, k) in arguments + [("Expected", rkind)]]
+    cells = [[literal(v, k, w) for v, k in zip(row, kinds)] for row in rows]
+    widths = [max(len(row[i]) for row in cells) for i in range(len(kinds))] if cells else []
+    lines = ["    { " + ", ".join(c.rjust(n) for c, n in zip(row, widths)) + " }," for row in cells]
+
+    call = ["{}[ i ].{}".format(table, n) for n, _ in arguments]
+    if result == "inplace":
+        first = arguments[0]
+        body = "        {} {} = {};\n".format(ctype[first[1]].format(w=w), first[0], call[0])
+        body += "        {}( {} );\n".format(name, ", ".join(["&" + first[0]] + call[1:]))
+        got = first[0]
+    else:
+        got = "{}( {} )".format(name, ", ".join(call))
+        body = ""
+    body += '        {}( {}[ i ].Expected, {}, Vector( "{}", i ) );'.format(assertion(rkind, w), table, got, name)
+
+    reqs = spec.get("reqs")
+    return TEST.format(
+        fields="\n".join(fields),
+        table=table,
+        rows="\n".join(lines),
+        name=name,
+        count=len(rows),
+        reqs="\n *\n * @test    " + ", ".join(reqs) if reqs else "",
+        body=body,
+    )
+
+
+def main():
+    if len(sys.argv) != 3:
+        fail("usage: bfx_vectors.py <vectors.yaml> <output directory>")
+    with open(sys.argv[1]) as stream:
+        table = yaml.safe_load(stream)
+
+    for routine in table:
+        if routine not in ROUTINES:
+            fail("unknown routine " + routine)
+
+    for w in WIDTHS:
+        tests = []
+        count = 0
+        for routine, spec in table.items():
+            if w not in spec.get("widths", WIDTHS):
+                continue
+            rows = vectors(routine, spec, w)
+            count += len(rows)
+            tests.append(test(routine, spec, w, rows))
+
+        path = os.path.join(sys.argv[2], "Test_Bfx_Vectors_{}bits.c".format(w))
+        with open(path, "w") as out:
+            out.write(HEADER.format(w=w, count=count) + "".join(tests))
+        print("{}: {} vectors".format(path, count))
+
+
+if __name__ == "__main__":
+    main()
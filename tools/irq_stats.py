@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Decode the interrupt statistics of a firmware built with meson configure -Dirq_stats=true.
+
+The instrumented dispatch in startup.c keeps a RAM table with the entries, the last entry stamp and
+the longest handler run of every exception. The table is found by its magic word in a dump of the
+SRAM, the exception names are taken from the vector table in startup.c. Exceptions are listed from
+the most to the least frequent with their rate per SysTick period, so an interrupt storm stands
+out at the top, and an exception without a handler of its own shows up with its vector name. With
+--self-test the decoder runs on a built in dump with known records and fails when its report is not
+the expected one, the test meson runs.
+
+    $ openocd -f board/st_nucleo_g0.cfg -c "init; halt; dump_image sram.bin 0x20000000 0x24000; resume; shutdown"
+    $ python3 tools/irq_stats.py sram.bin
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+MAGIC = 0x53515249
+SYSTICK = 15
+RECORD = struct.Struct("<III")
+VECTOR = re.compile(r"^\s*\(\w+\)\s*&?(\w+)\s*,?", re.MULTILINE)
+
+
+def vector_names(startup):
+    with open(startup, encoding="utf-8") as source:
+        text = source.read()
+    table = re.search(r"\bvectors\[[^\]]*\]\s*=\s*\{(.*?)\};", text, re.DOTALL)
+    if table is None:
+        sys.exit("irq_stats: no vector table found in " + startup)
+    return ["reserved" if name == "0" else name for name in VECTOR.findall(table.group(1))]
+
+
+def find_table(dump):
+    for offset in range(0, len(dump) - 8, 4):
+        magic, vectors = struct.unpack_from("<II", dump, offset)
+        if magic == MAGIC and 0 < vectors <= 64 and offset + 8 + vectors * RECORD.size <= len(dump):
+            return offset, [RECORD.unpack_from(dump, offset + 8 + i * RECORD.size) for i in range(vectors)]
+    sys.exit("irq_stats: no statistics table in the dump, is the firmware built with -Dirq_stats=true?")
+
+
+def report(names, base, offset, stats, clock):
+    """lines of the report, exceptions from the most to the least frequent"""
+    ticks = stats[SYSTICK][0] if len(stats) > SYSTICK else 0
+    total = sum(count for count, _, _ in stats)
+    lines = ["table at 0x{:08X}, {} SysTick periods, {} exceptions".format(base + offset, ticks, total),
+             "vector  name                                          count  per tick  last seen  max cycles  max us"]
+    for vector in sorted(range(len(stats)), key=lambda v: stats[v][0], reverse=True):
+        count, last, cycles = stats[vector]
+        if count == 0:
+            continue
+        name = names[vector] if vector < len(names) else "vector {}".format(vector)
+        lines.append("{:>6}  {:<40} {:>10}  {:>8.2f}  {:>9}  {:>10}  {:>6.1f}".format(
+            vector, name, count, count / max(ticks, 1), ticks - last, cycles, cycles * 1e6 / clock))
+    return lines
+
+
+def self_test(names):
+    """decode a dump with a rejected candidate, a zero vectors header, before a table of known records"""
+    stats = [(0, 0, 0)] * 48
+    stats[SYSTICK] = (1000, 1000, 704)
+    stats[3] = (1, 10, 64)
+    stats[23] = (4000, 998, 640)
+    dump = struct.pack("<II", MAGIC, 0) + bytes(8) + struct.pack("<II", MAGIC, len(stats))
+    dump += b"".join(RECORD.pack(*record) for record in stats) + bytes(16)
+    offset, found = find_table(dump)
+    expected = [
+        "table at 0x20000010, 1000 SysTick periods, 5001 exceptions",
+        "vector  name                                          count  per tick  last seen  max cycles  max us",
+        "    23  EXTI4_15_IRQHandler                            4000      4.00          2         640    10.0",
+        "    15  SysTick_Handler                                1000      1.00          0         704    11.0",
+        "     3  HardFault_Handler                                 1      0.00        990          64     1.0",
+    ]
+    lines = report(names, 0x20000000, offset, found, 64000000)
+    for line, wanted in zip(lines + [""] * len(expected), expected + [""] * len(lines)):
+        if line != wanted:
+            sys.exit("irq_stats: self test failed, got\n  {}\nexpected\n  {}".format(line, wanted))
+    print("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="decode the instrumented dispatch statistics")
+    parser.add_argument("dump", nargs="?", help="binary dump of the SRAM holding Startup_IrqTable")
+    parser.add_argument("--base", type=lambda value: int(value, 0), default=0x20000000, help="address of the dump")
+    parser.add_argument("--clock", type=int, default=64000000, help="core clock in Hz")
+    parser.add_argument("--startup", default=os.path.join(os.path.dirname(__file__), "..", "startup.c"))
+    parser.add_argument("--self-test", action="store_true", help="decode a built in dump with known records")
+    args = parser.parse_args()
+
+    names = vector_names(args.startup)
+    if args.self_test:
+        self_test(names)
+    elif args.dump is None:
+        parser.error("the dump is required")
+    else:
+        with open(args.dump, "rb") as stream:
+            offset, stats = find_table(stream.read())
+        print("\n".join(report(names, args.base, offset, stats, args.clock)))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Generate the Mcu driver configuration header from its YAML description.
+
+The clock tree is checked against the STM32G0 limits and the flash wait states are computed from
+the AHB clock for the voltage range 1, so the header never holds a latency too short for the clock
+it runs at.
+
+    $ python3 tools/mcu_cfg.py cfg/Mcu.yaml autosar/mcal/Mcu_Cfg.h
+"""
+import sys
+
+import yaml
+
+HSI16 = 16000000
+AHB_DIVIDERS = {1: 0, 2: 8, 4: 9, 8: 10, 16: 11, 64: 12, 128: 13, 256: 14, 512: 15}
+APB_DIVIDERS = {1: 0, 2: 4, 4: 5, 8: 6, 16: 7}
+# highest AHB clock for each flash latency in the voltage range 1
+FLASH_LATENCY = [24000000, 48000000, 64000000]
+
+HEADER = """/**
+ * @file    Mcu_Cfg.h
+ * @brief   **Mcu Driver Configuration**
+ *
+ * Generated by tools/mcu_cfg.py from cfg/Mcu.yaml, do not edit, change the YAML file and run
+ * meson compile -C build mcu_cfg instead.
+ *
+ * System clock {sysclk} Hz, AHB clock {hclk} Hz, APB clock {pclk} Hz.
+ */
+#ifndef MCU_CFG_H
+#define MCU_CFG_H
+
+/* clang-format off */
+{defines}
+/* clang-format on */
+
+#endif /* MCU_CFG_H */
+"""
+
+
+def check(condition, message):
+    if not condition:
+        sys.exit("mcu_cfg: " + message)
+
+
+def std(value):
+    return "STD_ON" if value else "STD_OFF"
+
+
+def define(name, value, comment):
+    return "#define {:<20}{:<12}/*!< {} */".format(name, value, comment)
+
+
+def generate(cfg):
+    clock = cfg["clock"]
+    pll = clock["pll"]
+    check(clock["source"] == "hsi16", "only the hsi16 clock source is supported")
+
+    m, n, r = pll["m"], pll["n"], pll["r"]
+    check(1 <= m <= 8, "pll m shall be 1 to 8")
+    check(8 <= n <= 86, "pll n shall be 8 to 86")
+    check(2 <= r <= 8, "pll r shall be 2 to 8")
+    check(2660000 <= HSI16 // m <= 16000000, "VCO input shall be 2.66 to 16MHz")
+    check(64000000 <= HSI16 // m * n <= 344000000, "VCO output shall be 64 to 344MHz")
+
+    sysclk = HSI16 // m * n // r if pll["enable"] else HSI16
+    check(sysclk <= 64000000, "system clock shall be up to 64MHz")
+    check(clock["ahb_divider"] in AHB_DIVIDERS, "invalid ahb divider")
+    check(clock["apb_divider"] in APB_DIVIDERS, "invalid apb divider")
+    hclk = sysclk // clock["ahb_divider"]
+    pclk = hclk // clock["apb_divider"]
+    latency = next(i for i, limit in enumerate(FLASH_LATENCY) if hclk <= limit)
+
+    defines = [
+        define("MCU_PLL", std(pll["enable"]), "system clock from the PLL, STD_ON or STD_OFF"),
+        define("MCU_PLL_M", "%du" % m, "PLL input divider"),
+        define("MCU_PLL_N", "%du" % n, "PLL VCO multiplier"),
+        define("MCU_PLL_R", "%du" % r, "PLL system clock divider"),
+        define("MCU_AHB_HPRE", "%du" % AHB_DIVIDERS[clock["ahb_divider"]],
+               "RCC_CFGR HPRE field, AHB divider %d" % clock["ahb_divider"]),
+        define("MCU_APB_PPRE", "%du" % APB_DIVIDERS[clock["apb_divider"]],
+               "RCC_CFGR PPRE field, APB divider %d" % clock["apb_divider"]),
+        define("MCU_FLASH_LATENCY", "%du" % latency, "flash wait states"),
+        define("MCU_FLASH_PREFETCH", std(cfg["flash"]["prefetch"]), "flash prefetch buffer, STD_ON or STD_OFF"),
+        define("MCU_FLASH_ICACHE", std(cfg["flash"]["icache"]), "flash instruction cache, STD_ON or STD_OFF"),
+        define("MCU_READY_TIMEOUT", "%du" % cfg["ready_timeout"], "polling iterations for the PLL lock and clock switch"),
+        define("MCU_CORE_CLOCK", "%du" % hclk, "core and SysTick clock in Hz"),
+    ]
+
+    return HEADER.format(sysclk=sysclk, hclk=hclk, pclk=pclk, defines="\n".join(defines))
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: mcu_cfg.py <config.yaml> <Mcu_Cfg.h>")
+    with open(sys.argv[1], encoding="utf-8") as source:
+        header = generate(yaml.safe_load(source))
+    with open(sys.argv[2], "w", encoding="utf-8") as output:
+        output.write(header)
+
+
+if __name__ == "__main__":
+    main()
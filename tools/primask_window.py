@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Interrupt lock time of every critical section of the firmware, from its Cortex-M0+ disassembly.
+
+Every cpsid i starts a window with the interrupts masked that ends at the next msr primask or
+cpsie i, the window is the cycles an interrupt arriving right after the cpsid waits, the
+instructions up to and including the one that unmasks. The cycles are the Cortex-M0+ ones with
+zero wait state memory, taken branches count 2 and a branch inside a window is counted as taken,
+the instructions are summed in address order so a loop inside a window is counted once. The Bfx
+atomic routines are inlined, their windows show up in the functions calling them.
+
+A direct call, bl or a b to another function, adds every instruction of the callee and of the
+functions it calls in turn. A call through a register, a recursive call or a call to a function
+missing in the disassembly has no bound, the window is reported as unbounded with the reason and
+the script fails, as it does with --limit on a window over the limit.
+
+    $ python3 tools/primask_window.py --objdump arm-none-eabi-objdump mezcalito.elf
+    $ python3 tools/primask_window.py --objdump arm-none-eabi-objdump --limit 16 mezcalito.elf
+"""
+import argparse
+import re
+import subprocess
+import sys
+
+FUNCTION = re.compile(r"^[0-9a-fA-F]+ <([\w.$]+)>:$")
+INSTRUCTION = re.compile(r"^\s*[0-9a-fA-F]+:\s+([a-z][\w.]*)\s*(.*)$")
+CALL = re.compile(r"<([\w.$]+)>")
+
+# Cortex-M0+ instruction cycles, the ones not listed take 1
+CYCLES = {
+    "ldr": 2, "ldrb": 2, "ldrh": 2, "ldrsb": 2, "ldrsh": 2,
+    "str": 2, "strb": 2, "strh": 2,
+    "b": 2, "bl": 3, "bx": 2, "blx": 2,
+    "mrs": 3, "msr": 3, "dmb": 3, "dsb": 3, "isb": 3,
+}
+
+
+def cycles(mnemonic, operands):
+    """cycles of one instruction, multiple loads and stores take one more per register"""
+    registers = len(re.findall(r"\br\d+\b|\blr\b|\bpc\b", operands.split("{", 1)[1])) if "{" in operands else 0
+    if mnemonic in ("push", "stmia", "stm"):
+        return 1 + registers
+    if mnemonic in ("pop", "ldmia", "ldm"):
+        return 1 + registers + (2 if "pc" in operands else 0)
+    if mnemonic.startswith("b") and mnemonic[1:].split(".")[0] in ("eq", "ne", "cs", "hs", "cc", "lo", "mi", "pl", "vs", "vc",
+                                                                    "hi", "ls", "ge", "lt", "gt", "le"):
+        return 2
+    return CYCLES.get(mnemonic.split(".")[0], 1)
+
+
+def functions(disassembly):
+    """instructions (mnemonic, operands) of every function, in address order"""
+    found = {}
+    body = None
+    for line in disassembly.splitlines():
+        match = FUNCTION.match(line.strip())
+        if match:
+            body = found.setdefault(match.group(1), [])
+            continue
+        match = INSTRUCTION.match(line)
+        if match is not None and body is not None:
+            body.append((match.group(1).lower(), match.group(2)))
+    return found
+
+
+def callee(mnemonic, operands, function):
+    """function a direct call or a branch to another function goes to, None for a local branch"""
+    if mnemonic.split(".")[0] not in ("bl", "b"):
+        return None
+    match = CALL.search(operands)
+    if match is None or match.group(1) == function:
+        return None
+    return match.group(1)
+
+
+def cost(instructions, function, found, costs, stack):
+    """cycles of the instructions and the functions they call, None and the reason when unbounded"""
+    total = 0
+    for mnemonic, operands in instructions:
+        total += cycles(mnemonic, operands.lower())
+        if mnemonic.split(".")[0] == "blx" or (mnemonic.split(".")[0] == "bx" and operands.strip().lower() != "lr"):
+            return None, "call through a register in " + function
+        target = callee(mnemonic, operands, function)
+        if target is None:
+            continue
+        if target in stack:
+            return None, "recursive call to " + target
+        if target not in found:
+            return None, "call to {} missing in the disassembly".format(target)
+        if target not in costs:
+            costs[target] = cost(found[target], target, found, costs, stack | {target})
+        if costs[target][0] is None:
+            return costs[target]
+        total += costs[target][0]
+    return total, None
+
+
+def windows(disassembly):
+    """(function, cycles, reason) of every masked window, cycles None when the window is unbounded"""
+    found = functions(disassembly)
+    costs = {}
+    result = []
+    for function, instructions in found.items():
+        window = None
+        for mnemonic, operands in instructions:
+            lower = operands.lower()
+            if mnemonic == "cpsid" and lower.startswith("i"):
+                window = []
+            elif window is not None:
+                window.append((mnemonic, operands))
+                if (mnemonic == "msr" and "primask" in lower) or (mnemonic == "cpsie" and lower.startswith("i")):
+                    total, reason = cost(window, function, found, costs, {function})
+                    result.append((function, total, reason))
+                    window = None
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description="interrupt lock time of the critical sections")
+    parser.add_argument("--objdump", default="arm-none-eabi-objdump")
+    parser.add_argument("--limit", type=int, help="fail when a window is longer than these cycles")
+    parser.add_argument("elf")
+    args = parser.parse_args()
+
+    output = subprocess.run([args.objdump, "-d", "--no-show-raw-insn", args.elf], check=True, capture_output=True, text=True).stdout
+    found = {}
+    unbounded = {}
+    for function, window, reason in windows(output):
+        found.setdefault(function, []).append(window if window is not None else float("inf"))
+        if reason is not None:
+            unbounded.setdefault(function, reason)
+
+    print("%-32s %7s %10s" % ("function", "windows", "max cycles"))
+    for function in sorted(found, key=lambda name: max(found[name]), reverse=True):
+        longest = max(found[function])
+        print(("%-32s %7d %10s  %s" % (function, len(found[function]), "unbounded" if function in unbounded else longest,
+                                        unbounded.get(function, ""))).rstrip())
+    if unbounded:
+        sys.exit("primask_window: {} functions have windows without a bound".format(len(unbounded)))
+    longest = max((max(cycles) for cycles in found.values()), default=0)
+    if args.limit is not None and longest > args.limit:
+        sys.exit("primask_window: a window takes %d cycles, over the limit of %d" % (longest, args.limit))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""Generate the register overlay header of the drivers from the YAML register map.
+
+Every peripheral becomes a struct of volatile words laid over its registers, the gaps filled with
+reserved words, and a constant base pointer per instance. Drivers then reach a register as a fixed
+offset from one base, the compiler loads the base once for all the registers of a peripheral
+instead of one literal per address. The struct sizes are checked at compile time. The bits listed
+for a register become mask macros named after the peripheral, the register and the bit, for
+instance REG_RCC_AHBENR_CRCEN.
+
+    $ python3 tools/reg_map.py cfg/Reg.yaml autosar/mcal/Reg_Map.h
+"""
+import sys
+
+import yaml
+
+HEADER = """/**
+ * @file    Reg_Map.h
+ * @brief   **Register Map**
+ *
+ * Generated by tools/reg_map.py from cfg/Reg.yaml, do not edit, change the YAML file and run
+ * meson compile -C build reg_map instead.
+ *
+ * Registers are accessed through the Reg.h macros with their address in the overlay, for instance
+ * REG_WRITE( &REG_GPIOA->BSRR, Pins ). On the target the base pointers are constants, on host
+ * unit tests (UTEST) they are handles the Reg.h host functions resolve, so the simulator or the
+ * test models the registers.
+ */
+#ifndef REG_MAP_H
+#define REG_MAP_H
+
+#include "Std_Types.h"
+#include "Reg.h"
+
+{structs}
+/* clang-format off */
+{bases}
+/* clang-format on */
+
+#endif /* REG_MAP_H */
+"""
+
+STRUCT = """/**
+ * @brief   {brief}
+ */
+typedef struct {name}_Tag
+{{
+{fields}
+}} {name};
+_Static_assert( sizeof( {name} ) == 0x{size:X}u, "{name} layout" );
+"""
+
+
+def check(condition, message):
+    if not condition:
+        sys.exit("reg_map: " + message)
+
+
+def type_name(name):
+    return "Reg_{}Type".format(name)
+
+
+def field(declaration, offset, comment):
+    return "    {:<32}/*!< 0x{:03X} {} */".format(declaration, offset, comment)
+
+
+def struct(name, brief, registers, blocks, size=None):
+    fields = []
+    offset = 0
+    reserved = 0
+    for register in registers:
+        check(len(register) in (3, 4, 5), "{}: register shall be [name, offset, description, count, block]".format(name))
+        reg, start, comment = register[:3]
+        count = register[3] if len(register) > 3 else 1
+        block = register[4] if len(register) > 4 else None
+        check(start % 4 == 0, "{}.{}: offset shall be word aligned".format(name, reg))
+        check(start >= offset, "{}.{}: registers shall be in offset order without overlap".format(name, reg))
+        if start > offset:
+            fields.append(field("uint32 Reserved{}[ {}u ];".format(reserved, (start - offset) // 4), offset, "reserved"))
+            reserved += 1
+        if block is not None:
+            check(block in blocks, "{}.{}: unknown block {}".format(name, reg, block))
+            declaration, width = type_name(block) + " " + reg, blocks[block]["size"]
+        else:
+            declaration, width = "volatile uint32 " + reg, 4
+        if count > 1:
+            declaration += "[ {}u ]".format(count)
+        fields.append(field(declaration + ";", start, comment))
+        offset = start + width * count
+    if size is not None:
+        check(size >= offset and size % 4 == 0, "{}: block size shall be word aligned and hold its registers".format(name))
+        if size > offset:
+            fields.append(field("uint32 Reserved{}[ {}u ];".format(reserved, (size - offset) // 4), offset, "reserved"))
+        offset = size
+    return STRUCT.format(name=type_name(name), brief=brief[0].upper() + brief[1:], fields="\n".join(fields), size=offset)
+
+
+def define(name, value, comment):
+    return "#define {:<24}{:<76}/*!< {} */".format(name, value, comment)
+
+
+def bases(key, peripheral):
+    name = type_name(peripheral.get("type", key.capitalize()))
+    instances = peripheral.get("instances", {key: peripheral.get("base")})
+    lines = []
+    for instance, base in instances.items():
+        check(isinstance(base, int), "{}: base address missing".format(instance))
+        lines.append(define("REG_{}_BASE".format(instance), "0x{:08X}u".format(base), peripheral["brief"]))
+        lines.append(define("REG_{}".format(instance), "REG_BASE( {}, REG_{}_BASE )".format(name, instance),
+                            instance + " registers"))
+    addresses = list(instances.values())
+    if len(addresses) > 2:
+        stride = addresses[1] - addresses[0]
+        check(all(b - a == stride for a, b in zip(addresses, addresses[1:])),
+              "{}: instances shall be at a constant stride".format(key))
+        first = next(iter(instances))
+        lines.append(define("REG_{}( Index )".format(key),
+                            "REG_BASE( {}, REG_{}_BASE + ( (uint32)( Index ) * 0x{:X}u ) )".format(name, first, stride),
+                            "instance at Index, 0 is " + first))
+    return "\n".join(lines)
+
+
+def bits(key, peripheral):
+    lines = []
+    names = [register[0] for register in peripheral["registers"]]
+    for reg, entries in peripheral.get("bits", {}).items():
+        check(reg in names, "{}: bits of unknown register {}".format(key, reg))
+        for entry in entries:
+            check(len(entry) in (3, 4), "{}.{}: bit shall be [name, position, description, width]".format(key, reg))
+            name, position, comment = entry[:3]
+            width = entry[3] if len(entry) > 3 else 1
+            check(0 <= position and position + width <= 32, "{}.{}.{}: bits out of the register".format(key, reg, name))
+            mask = ((1 << width) - 1) << position
+            lines.append(define("REG_{}_{}_{}".format(key, reg, name), "0x{:08X}u".format(mask), comment))
+    return lines
+
+
+def generate(cfg):
+    blocks = cfg.get("blocks", {})
+    structs = [struct(name, block["brief"], block["registers"], blocks, block["size"]) for name, block in blocks.items()]
+    structs += [struct(peripheral.get("type", key.capitalize()), peripheral["brief"], peripheral["registers"], blocks)
+                for key, peripheral in cfg["peripherals"].items()]
+    defines = ["\n".join([bases(key, peripheral)] + bits(key, peripheral)) for key, peripheral in cfg["peripherals"].items()]
+    return HEADER.format(structs="\n".join(structs), bases="\n\n".join(defines))
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: reg_map.py <registers.yaml> <Reg_Map.h>")
+    with open(sys.argv[1], encoding="utf-8") as source:
+        header = generate(yaml.safe_load(source))
+    with open(sys.argv[2], "w", encoding="utf-8") as output:
+        output.write(header)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""Compare the firmware size across build profiles.
+
+Prints the Berkeley sizes of each ELF file and the size of the symbols with a given prefix, the
+Bfx routines by default, with the delta against the first file. A routine missing from a build was
+inlined everywhere or removed as unused.
+
+    $ python3 tools/size_profiles.py --size arm-none-eabi-size --nm arm-none-eabi-nm \\
+          mezcalito_debug.elf mezcalito_release.elf mezcalito_speed.elf
+"""
+import argparse
+import os
+import subprocess
+
+
+def label(path):
+    return os.path.splitext(os.path.basename(path))[0]
+
+
+def berkeley(size, path):
+    """text, data and bss sizes of an ELF file"""
+    output = subprocess.run([size, "--format=berkeley", path], check=True, capture_output=True, text=True).stdout
+    text, data, bss = output.splitlines()[1].split()[:3]
+    return int(text), int(data), int(bss)
+
+
+def symbols(nm, path, prefix):
+    """sizes of the symbols starting with prefix, the clones made by the optimizer are added to
+    their original function"""
+    output = subprocess.run([nm, "--print-size", "--radix=d", path], check=True, capture_output=True, text=True).stdout
+    sizes = {}
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) == 4 and fields[3].startswith(prefix):
+            name = fields[3].split(".")[0]
+            sizes[name] = sizes.get(name, 0) + int(fields[1])
+    return sizes
+
+
+def delta(value, base):
+    return "%+d" % (value - base) if value != base else ""
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--size", default="arm-none-eabi-size")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--prefix", default="Bfx_")
+    parser.add_argument("elfs", nargs="+")
+    args = parser.parse_args()
+
+    names = [label(path) for path in args.elfs]
+    totals = [berkeley(args.size, path) for path in args.elfs]
+    print("%-24s %8s %8s %8s %8s" % ("profile", "text", "data", "bss", "delta"))
+    for name, total in zip(names, totals):
+        print("%-24s %8d %8d %8d %8s" % (name, *total, delta(sum(total), sum(totals[0]))))
+
+    tables = [symbols(args.nm, path, args.prefix) for path in args.elfs]
+    routines = sorted(set().union(*tables))
+    if routines:
+        print()
+        print("%-40s" % (args.prefix + "*") + "".join("%16s" % name.rsplit("_", 1)[-1] for name in names))
+        for routine in routines:
+            base = tables[0].get(routine, 0)
+            cells = []
+            for table in tables:
+                size = table.get(routine)
+                cells.append("%16s" % ("inlined" if size is None else "%d %s" % (size, delta(size, base))))
+            print("%-40s" % routine + "".join(cells))
+
+
+if __name__ == "__main__":
+    main()
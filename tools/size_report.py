@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+"""Per module and per symbol flash and RAM footprint of the firmware, with a regression gate.
+
+The input sections listed in the linker map file give the flash and RAM taken by every object
+file, nm gives the size of every symbol, attributed to the module whose sections hold it. Symbols
+named after a header only module, like the Bfx routines inlined in every user, are reported under
+that module instead. The startup files and the libgcc and newlib archive members are reported as a
+single toolchain module. The module sizes are compared to a baseline and the script fails when a
+module grows more than the threshold or the firmware does not fit the memory regions of the map.
+When the baseline given does not exist yet the per module gate is skipped with a warning, create it
+with --update, meson compile -C build size_baseline, and commit it.
+
+With -flto the map only lists the partitions of the link time optimiser, the code of all the
+modules is merged in them and a partition holds different functions on every build. Those sections
+go to a single lto module and the per module gate is skipped, only the memory regions are checked,
+meson passes a baseline for the debug profile only.
+
+    $ python3 tools/size_report.py --map mezcalito.map --baseline cfg/size_debug.json mezcalito.elf
+    $ python3 tools/size_report.py --map mezcalito.map --baseline cfg/size_debug.json --update mezcalito.elf
+"""
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+REGION = re.compile(r"^(\w+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+SECTION = re.compile(r"^ (\.[\w.$]+|COMMON)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+))?\s*$")
+CONTINUATION = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+)\s*$")
+
+
+def module_of(path):
+    """module name of an object file, meson names them after the source path with / replaced by _"""
+    name = os.path.basename(path)
+    if ".ltrans" in name:
+        return "lto"
+    if ".a(" in name or name.startswith("crt"):
+        return "toolchain"
+    name = re.sub(r"\.c\.o(bj)?$|\.o$", "", name)
+    return name.split("_")[-1] if name.startswith("autosar_") else name
+
+
+def parse_map(path):
+    """memory regions and input sections (name, address, size, module) of a GNU ld map file"""
+    regions = {}
+    sections = []
+    pending = None
+    in_memory = False
+    in_map = False
+    with open(path, encoding="utf-8", errors="replace") as source:
+        for line in source:
+            if line.startswith("Memory Configuration"):
+                in_memory = True
+                continue
+            if line.startswith("Linker script and memory map"):
+                in_memory = False
+                in_map = True
+                continue
+            if in_memory:
+                match = REGION.match(line)
+                if match and match.group(1) != "default":
+                    regions[match.group(1)] = (int(match.group(2), 16), int(match.group(3), 16))
+            elif in_map:
+                match = SECTION.match(line)
+                if match:
+                    if match.group(2) is None:
+                        pending = match.group(1)
+                    else:
+                        sections.append((match.group(1), int(match.group(2), 16), int(match.group(3), 16), module_of(match.group(4))))
+                        pending = None
+                    continue
+                match = CONTINUATION.match(line)
+                if match and pending is not None:
+                    sections.append((pending, int(match.group(1), 16), int(match.group(2), 16), module_of(match.group(3))))
+                pending = None
+    return regions, [section for section in sections if section[2] > 0]
+
+
+def memory(section):
+    """flash and RAM taken by an input section, initialised data takes both"""
+    name, _, size, _ = section
+    if name.startswith((".text", ".rodata", ".isr_vectors")):
+        return size, 0
+    if name.startswith(".data"):
+        return size, size
+    if name.startswith((".bss", "COMMON")):
+        return 0, size
+    return 0, 0
+
+
+def parse_nm(nm, elf, sections, headers):
+    """symbols (module, name, type, size) attributed by address to the input sections, the flash
+    and RAM of the symbols of header only modules is moved from the sections module to theirs"""
+    output = subprocess.run([nm, "--print-size", "--radix=d", elf], check=True, capture_output=True, text=True).stdout
+    symbols = []
+    moved = []
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) != 4:
+            continue
+        address, size, kind, name = int(fields[0]), int(fields[1]), fields[2], fields[3]
+        section = next((section for section in sections if section[1] <= address < section[1] + section[2]), None)
+        module = section[3] if section is not None else "?"
+        if name.split("_")[0] in headers and section is not None:
+            flash, ram = memory(section)
+            share = (size if flash else 0, size if ram else 0)
+            moved.append((module, name.split("_")[0], share))
+            module = name.split("_")[0]
+        symbols.append((module, name, kind, size))
+    return symbols, moved
+
+
+def footprint(sections, moved):
+    """flash and RAM per module"""
+    modules = {}
+    for section in sections:
+        flash, ram = memory(section)
+        entry = modules.setdefault(section[3], {"flash": 0, "ram": 0})
+        entry["flash"] += flash
+        entry["ram"] += ram
+    for source, target, (flash, ram) in moved:
+        modules[source]["flash"] -= flash
+        modules[source]["ram"] -= ram
+        entry = modules.setdefault(target, {"flash": 0, "ram": 0})
+        entry["flash"] += flash
+        entry["ram"] += ram
+    return modules
+
+
+def gate(modules, regions, baseline, threshold):
+    """errors for the modules grown over the threshold and the regions overflown"""
+    errors = []
+    for module in sorted(modules) if baseline else []:
+        for memory_type in ("flash", "ram"):
+            base = baseline.get(module, {}).get(memory_type, 0)
+            growth = modules[module][memory_type] - base
+            if growth > threshold:
+                errors.append("%s %s grew %d bytes, from %d to %d" % (module, memory_type, growth, base, modules[module][memory_type]))
+    used = {"flash": sum(entry["flash"] for entry in modules.values()), "ram": sum(entry["ram"] for entry in modules.values())}
+    for region, memory_type in (("FLASH", "flash"), ("SRAM", "ram")):
+        if region in regions and used[memory_type] > regions[region][1]:
+            errors.append("%s takes %d bytes of the %d available" % (memory_type, used[memory_type], regions[region][1]))
+    return errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--map", required=True, help="linker map file")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--baseline", help="json file with the module sizes to compare with")
+    parser.add_argument("--update", action="store_true", help="write the baseline instead of comparing")
+    parser.add_argument("--threshold", type=int, default=256, help="bytes a module can grow, default 256")
+    parser.add_argument("--headers", default="Bfx", help="comma separated header only modules")
+    parser.add_argument("elf")
+    args = parser.parse_args()
+
+    regions, sections = parse_map(args.map)
+    symbols, moved = parse_nm(args.nm, args.elf, sections, set(args.headers.split(",")))
+    modules = footprint(sections, moved)
+
+    lto = "lto" in modules
+    if lto and args.update:
+        sys.exit("size_report: the baseline can not be taken from an LTO build, use the debug profile")
+    baseline = {}
+    missing = False
+    if args.baseline and not args.update and not lto:
+        if os.path.exists(args.baseline):
+            with open(args.baseline, encoding="utf-8") as source:
+                baseline = json.load(source)
+        else:
+            missing = True
+
+    print("%-40s %4s %8s" % ("symbol", "type", "size"))
+    for module, name, kind, size in sorted(symbols, key=lambda symbol: (symbol[0], -symbol[3], symbol[1])):
+        if size > 0:
+            print("%-40s %4s %8d  %s" % (name, kind, size, module))
+    print()
+    print("%-16s %8s %8s %10s %10s" % ("module", "flash", "ram", "flash +/-", "ram +/-"))
+    for module in sorted(modules):
+        base = baseline.get(module, {"flash": 0, "ram": 0})
+        print("%-16s %8d %8d %+10d %+10d" % (module, modules[module]["flash"], modules[module]["ram"],
+                                            modules[module]["flash"] - base.get("flash", 0), modules[module]["ram"] - base.get("ram", 0)))
+    for region, (origin, length) in sorted(regions.items()):
+        memory_type = "flash" if region == "FLASH" else "ram"
+        used = sum(entry[memory_type] for entry in modules.values())
+        print("%-16s %8d of %d bytes, %.1f%%" % (region, used, length, 100.0 * used / length))
+
+    if args.update:
+        with open(args.baseline, "w", encoding="utf-8") as output:
+            json.dump(modules, output, indent=4, sort_keys=True)
+            output.write("\n")
+        print("baseline written to %s" % args.baseline)
+        return 0
+
+    if lto:
+        print("LTO build, the modules are merged by the link time optimiser, only the memory regions are checked")
+    elif missing:
+        print("warning: no baseline %s, only the memory regions are checked, create it with "
+              "meson compile -C build size_baseline and commit it" % args.baseline)
+    errors = gate(modules, regions, baseline, args.threshold)
+    for error in errors:
+        print("error: " + error)
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""Decode the binary trace buffer of a firmware built with meson configure -Dtrace=true.
+
+The Trace module keeps one ring of records per writer context, each record an event id, a 24 bit
+argument and a core clock timestamp. The buffer is found by its magic word in a dump of the SRAM or
+in the file bench_trace writes on the host simulator, the rings are unrolled from their oldest
+record and merged into one timeline. The event and context names are taken from the defines ending
+in TRACE_EVENT_<name> and TRACE_CONTEXT_<name> of Trace_Cfg.h and main.c. With --chrome the
+timeline is also written in the Chrome trace format, TASK_START and TASK_END pairs become spans,
+open it in chrome://tracing or ui.perfetto.dev. With --check the decoder fails when a ring is
+empty or its timestamps go backwards, the test meson runs on the simulator trace.
+
+    $ openocd -f board/st_nucleo_g0.cfg -c "init; halt; dump_image sram.bin 0x20000000 0x24000; resume; shutdown"
+    $ python3 tools/trace_decode.py sram.bin --chrome trace.json
+"""
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+MAGIC = 0x45435254
+HEADER = struct.Struct("<IHHI")
+RECORD = struct.Struct("<II")
+DEFINE = re.compile(r"^\s*#define\s+(\w*TRACE_(?:EVENT|CONTEXT)_\w+)\s+([^/\n]+)", re.MULTILINE)
+SOURCES = [os.path.join(os.path.dirname(__file__), "..", path) for path in ("autosar/services/Trace_Cfg.h", "main.c")]
+
+
+def names(sources):
+    values = {}
+    for path in sources:
+        with open(path, encoding="utf-8") as source:
+            for name, value in DEFINE.findall(source.read()):
+                value = re.sub(r"\b(0x[0-9A-Fa-f]+|\d+)[uU]\b", r"\1", value.strip())
+                value = re.sub(r"\b[A-Za-z_]\w*\b", lambda m: str(values.get(m.group(0), m.group(0))), value)
+                if re.fullmatch(r"[0-9A-Fa-fx\s()+\-*|<>]+", value) is None:
+                    sys.exit("trace_decode: cannot evaluate {} in {}".format(name, path))
+                values[name] = eval(value)
+    events = {value: name.replace("TRACE_EVENT_", "") for name, value in values.items() if "TRACE_EVENT_" in name and name != "TRACE_EVENT_USER"}
+    contexts = {value: name.split("TRACE_CONTEXT_")[1] for name, value in values.items() if "TRACE_CONTEXT_" in name}
+    return events, contexts
+
+
+def find_buffer(dump):
+    for offset in range(0, len(dump) - HEADER.size, 4):
+        magic, contexts, records, clock = HEADER.unpack_from(dump, offset)
+        ring = 4 + records * RECORD.size
+        if magic == MAGIC and 0 < contexts <= 16 and records > 0 and records & (records - 1) == 0 \
+                and offset + HEADER.size + contexts * ring <= len(dump):
+            return offset, contexts, records, clock
+    sys.exit("trace_decode: no trace buffer in the dump, is the firmware built with -Dtrace=true?")
+
+
+def unroll(dump, offset, records):
+    """records of one ring from the oldest, timestamps unwrapped, and the number overwritten"""
+    (head,) = struct.unpack_from("<I", dump, offset)
+    count = min(head, records)
+    ring = []
+    wraps = 0
+    last = None
+    for sequence in range(head - count, head):
+        stamp, word = RECORD.unpack_from(dump, offset + 4 + (sequence & (records - 1)) * RECORD.size)
+        if last is not None and last - stamp > 0x80000000:
+            wraps += 1
+        last = stamp
+        ring.append(((wraps << 32) + stamp, word >> 24, word & 0xFFFFFF))
+    return ring, head - count
+
+
+def chrome(timeline, clock, events, contexts):
+    trace = []
+    for stamp, context, event, arg in timeline:
+        name = events.get(event, "event 0x{:02X}".format(event))
+        entry = {"ts": stamp * 1e6 / clock, "pid": 0, "tid": contexts.get(context, context), "args": {"arg": arg}}
+        if name.endswith("_START") or name.endswith("_END"):
+            entry.update(name="{} {}".format(name.rsplit("_", 1)[0], arg), ph="B" if name.endswith("_START") else "E")
+        else:
+            entry.update(name=name, ph="i", s="t")
+        trace.append(entry)
+    return {"traceEvents": trace, "displayTimeUnit": "ns"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="decode the binary trace buffer into a timeline")
+    parser.add_argument("dump", help="binary dump of the SRAM holding Trace_Buffer, or the bench_trace output")
+    parser.add_argument("--base", type=lambda value: int(value, 0), default=0x20000000, help="address of the dump")
+    parser.add_argument("--clock", type=int, help="timestamp clock in Hz, taken from the buffer by default")
+    parser.add_argument("--names", nargs="+", default=SOURCES, help="sources with the event and context defines")
+    parser.add_argument("--chrome", help="write the timeline in the Chrome trace format to this file")
+    parser.add_argument("--check", action="store_true", help="fail on an empty ring or timestamps going backwards")
+    args = parser.parse_args()
+
+    events, contexts = names(args.names)
+    with open(args.dump, "rb") as stream:
+        dump = stream.read()
+    offset, count, records, clock = find_buffer(dump)
+    clock = args.clock or clock
+
+    timeline = []
+    errors = []
+    print("buffer at 0x{:08X}, {} contexts of {} records, {} Hz".format(args.base + offset, count, records, clock))
+    for context in range(count):
+        ring, lost = unroll(dump, offset + HEADER.size + context * (4 + records * RECORD.size), records)
+        print("context {:<8} {:>5} records, {} overwritten".format(contexts.get(context, context), len(ring), lost))
+        if not ring:
+            errors.append("context {} is empty".format(contexts.get(context, context)))
+        if any(later[0] < earlier[0] for earlier, later in zip(ring, ring[1:])):
+            errors.append("context {} timestamps go backwards".format(contexts.get(context, context)))
+        timeline += [(stamp, context, event, arg) for stamp, event, arg in ring]
+    timeline.sort()
+
+    print("      time us   delta us  context   event                        arg")
+    start = previous = timeline[0][0] if timeline else 0
+    for stamp, context, event, arg in timeline:
+        print("{:>13.3f}  {:>9.3f}  {:<8}  {:<24}  0x{:06X}".format((stamp - start) * 1e6 / clock, (stamp - previous) * 1e6 / clock,
+                                                                 contexts.get(context, context), events.get(event, "event 0x{:02X}".format(event)), arg))
+        previous = stamp
+
+    if args.chrome:
+        with open(args.chrome, "w", encoding="utf-8") as output:
+            json.dump(chrome(timeline, clock, events, contexts), output)
+    if args.check and errors:
+        sys.exit("trace_decode: " + ", ".join(errors))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+"""Generate the Unity runner of a unit test file, the main function that runs each of its tests.
+
+Ceedling generates the runners itself, this one is for the native meson build where every test file
+becomes a test binary. Tests are the functions named test_* taking void, in the order they are
+written. A test binary may also link test files shared between several configurations, their tests
+run after the ones of the first file.
+
+    $ python3 tools/unity_runner.py utest/Test_Bfx_8bits.c Test_Bfx_8bits_Runner.c
+    $ python3 tools/unity_runner.py utest/Test_Crc_Hw.c utest/Crc_Check.c Test_Crc_Hw_Runner.c
+"""
+import os
+import re
+import sys
+
+TEST = re.compile(r"^void\s+(test_\w+)\s*\(\s*void\s*\)", re.MULTILINE)
+
+RUNNER = """/* Generated by tools/unity_runner.py from {source}, do not edit */
+#include "unity.h"
+
+{prototypes}
+
+int main( void )
+{{
+    UNITY_BEGIN();
+{runs}
+    return UNITY_END();
+}}
+"""
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit("unity_runner: usage: unity_runner.py <test file>... <runner file>")
+    sources = sys.argv[1:-1]
+    tests = []
+    for source in sources:
+        with open(source) as stream:
+            tests += TEST.findall(stream.read())
+    if not tests:
+        sys.exit("unity_runner: no tests found in " + " ".join(sources))
+
+    with open(sys.argv[-1], "w") as out:
+        out.write(
+            RUNNER.format(
+                source=", ".join(os.path.basename(source) for source in sources),
+                prototypes="\n".join("void {}( void );".format(test) for test in tests),
+                runs="\n".join("    RUN_TEST( {} );".format(test) for test in tests),
+            )
+        )
+
+
+if __name__ == "__main__":
+    main()
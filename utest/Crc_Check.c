@@ -0,0 +1,94 @@
+/**
+ * @file    Crc_Check.c
+ * @brief   **Unit Test for the CRC Routines shared by all the configurations**
+ *
+ * The check value and chained cases, linked by meson with each of the Test_Crc*.c files so they run
+ * once per Crc_Cfg.h configuration. The test file of each configuration holds its setUp, its own
+ * cases and, for the hardware unit, the register model.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Crc.h"
+
+static const uint8 Check[ 9 ] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+/**
+ * @brief   **Test CRC8 check value**
+ *
+ * The test validates the CRC8 of the string "123456789", to pass the result should be 0x4B the
+ * SAE J1850 check value.
+ */
+void test__Crc_CalculateCRC8__check( void )
+{
+    uint8 Crc;
+    Crc = Crc_CalculateCRC8( Check, sizeof( Check ), 0u, TRUE );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0x4Bu, Crc, "Value is not 0x4B as supposed to be" );
+}
+
+/**
+ * @brief   **Test CRC8 in two calls**
+ *
+ * The test validates the CRC8 of the string "123456789" calculated in two calls of 5 and 4 bytes,
+ * to pass the result should be 0x4B the same as in a single call.
+ */
+void test__Crc_CalculateCRC8__chained( void )
+{
+    uint8 Crc;
+    Crc = Crc_CalculateCRC8( &Check[ 0 ], 5u, 0u, TRUE );
+    Crc = Crc_CalculateCRC8( &Check[ 5 ], 4u, Crc, FALSE );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0x4Bu, Crc, "Value is not 0x4B as supposed to be" );
+}
+
+/**
+ * @brief   **Test CRC16 check value**
+ *
+ * The test validates the CRC16 of the string "123456789", to pass the result should be 0x29B1 the
+ * CCITT check value.
+ */
+void test__Crc_CalculateCRC16__check( void )
+{
+    uint16 Crc;
+    Crc = Crc_CalculateCRC16( Check, sizeof( Check ), 0u, TRUE );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x29B1u, Crc, "Value is not 0x29B1 as supposed to be" );
+}
+
+/**
+ * @brief   **Test CRC16 in two calls**
+ *
+ * The test validates the CRC16 of the string "123456789" calculated in two calls of 6 and 3 bytes,
+ * to pass the result should be 0x29B1 the same as in a single call.
+ */
+void test__Crc_CalculateCRC16__chained( void )
+{
+    uint16 Crc;
+    Crc = Crc_CalculateCRC16( &Check[ 0 ], 6u, 0u, TRUE );
+    Crc = Crc_CalculateCRC16( &Check[ 6 ], 3u, Crc, FALSE );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x29B1u, Crc, "Value is not 0x29B1 as supposed to be" );
+}
+
+/**
+ * @brief   **Test CRC32 check value**
+ *
+ * The test validates the CRC32 of the string "123456789", to pass the result should be 0xCBF43926
+ * the IEEE 802.3 check value.
+ */
+void test__Crc_CalculateCRC32__check( void )
+{
+    uint32 Crc;
+    Crc = Crc_CalculateCRC32( Check, sizeof( Check ), 0u, TRUE );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xCBF43926u, Crc, "Value is not 0xCBF43926 as supposed to be" );
+}
+
+/**
+ * @brief   **Test CRC32 in two calls**
+ *
+ * The test validates the CRC32 of the string "123456789" calculated in two calls of 7 and 2 bytes,
+ * to pass the result should be 0xCBF43926 the same as in a single call.
+ */
+void test__Crc_CalculateCRC32__chained( void )
+{
+    uint32 Crc;
+    Crc = Crc_CalculateCRC32( &Check[ 0 ], 7u, 0u, TRUE );
+    Crc = Crc_CalculateCRC32( &Check[ 7 ], 2u, Crc, FALSE );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xCBF43926u, Crc, "Value is not 0xCBF43926 as supposed to be" );
+}
@@ -317,6 +317,21 @@ void test__Bfx_TstParityEven_u16_u8__false( void )
     TEST_ASSERT_MESSAGE( Tst == FALSE, "Value is not FALSE as supposed to be" );
 }
 
+/**
+ * @brief   **Test Non-Parity on the upper byte**
+ *
+ * The test validates if parity to one is FALSE over a variable with value 0x1000, with the only bit
+ * set in the upper byte, to pass the returned variable should be FALSE
+ * 
+ * @test    SWS_Bfx_00056, SWS_Bfx_00060
+ */
+void test__Bfx_TstParityEven_u16_u8__false_upper( void )
+{
+    uint16 Data = 0x1000u;
+    boolean Tst = Bfx_TstParityEven_u16_u8( Data );
+    TEST_ASSERT_MESSAGE( Tst == FALSE, "Value is not FALSE as supposed to be" );
+}
+
 /**
  * @brief   **Test toggle bits**
  *
@@ -598,7 +613,7 @@ void test__Bfx_ShiftBitSat_s16s8_s16__3leftp_nosaturation( void )
 void test__Bfx_ShiftBitSat_s16s8_s16__3leftn( void )
 {
     uint16 Shifted;
-    Shifted = Bfx_ShiftBitSat_s16s8_s16( 0xE600, 3 );
+    Shifted = Bfx_ShiftBitSat_s16s8_s16( (sint16)0xE600, 3 );
     TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x8000, Shifted, "Value is not 0x8000 as supposed to be" );
 }
 
@@ -613,7 +628,7 @@ void test__Bfx_ShiftBitSat_s16s8_s16__3leftn( void )
 void test__Bfx_ShiftBitSat_s16s8_s16__3leftn_nosaturation( void )
 {
     uint16 Shifted;
-    Shifted = Bfx_ShiftBitSat_s16s8_s16( 0xF800, 3 );
+    Shifted = Bfx_ShiftBitSat_s16s8_s16( (sint16)0xF800, 3 );
     TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0xC000, Shifted, "Value is not 0xC000 as supposed to be" );
 }
 
@@ -644,7 +659,7 @@ void test__Bfx_ShiftBitSat_s16s8_s16__11righp( void )
 void test__Bfx_ShiftBitSat_s16s8_s16__3righn( void )
 {
     sint16 Shifted;
-    Shifted = Bfx_ShiftBitSat_s16s8_s16( 0xE600, -11 );
+    Shifted = Bfx_ShiftBitSat_s16s8_s16( (sint16)0xE600, -11 );
     TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0xFFFC, Shifted, "Value is not 0xFFFC as supposed to be" );
 }
 
@@ -674,7 +689,7 @@ void test__Bfx_CountLeadingOnes_u16__3ones( void )
 void test__Bfx_CountLeadingSigns_s16__10ones( void )
 {
     uint8 Bits;
-    Bits = Bfx_CountLeadingSigns_s16( 0xFFE6 );
+    Bits = Bfx_CountLeadingSigns_s16( (sint16)0xFFE6 );
     TEST_ASSERT_EQUAL_MESSAGE( 10, Bits, "Value is not 2 as supposed to be" );
 }
 
@@ -707,3 +722,173 @@ void test__Bfx_CountLeadingZeros_u16__11zeroes( void )
     Zeroes = Bfx_CountLeadingZeros_u16( 0x0016 );
     TEST_ASSERT_EQUAL_MESSAGE( 11, Zeroes, "Value is not 3 as supposed to be" );
 }
+
+/**
+ * @brief   **Test count 7 zeroes**
+ *
+ * The test validates the count when the most significant bit set is in the upper byte, over a
+ * varible with value 0x0100, to pass Zeroes should be equal to 7.
+ * 
+ * @test    SWS_Bfx_91005, SWS_Bfx_00141
+ */
+void test__Bfx_CountLeadingZeros_u16__7zeroes( void )
+{
+    uint8 Zeroes;
+    Zeroes = Bfx_CountLeadingZeros_u16( 0x0100 );
+    TEST_ASSERT_EQUAL_MESSAGE( 7, Zeroes, "Value is not 7 as supposed to be" );
+}
+
+/**
+ * @brief   **Test count zeroes on a zero value**
+ *
+ * The test validates the count over a varible with value 0x0000, to pass Zeroes should be equal
+ * to 16, the width of the variable.
+ * 
+ * @test    SWS_Bfx_91005, SWS_Bfx_00141
+ */
+void test__Bfx_CountLeadingZeros_u16__allzeroes( void )
+{
+    uint8 Zeroes;
+    Zeroes = Bfx_CountLeadingZeros_u16( 0x0000 );
+    TEST_ASSERT_EQUAL_MESSAGE( 16, Zeroes, "Value is not 16 as supposed to be" );
+}
+
+/**
+ * @brief   **Test shift to the left 2 bits saturation with a bigger result**
+ *
+ * The test validates a shift to the left by 2 bits over a varible with value 0x5556, the truncated
+ * result 0x5558 is bigger than the input but bits were lost, to pass Data should be equal to 0x7FFF.
+ * 
+ * @test    SWS_Bfx_91002, SWS_Bfx_00134, SWS_Bfx_00135
+ */
+void test__Bfx_ShiftBitSat_s16s8_s16__2leftp_saturation( void )
+{
+    uint16 Shifted;
+    Shifted = Bfx_ShiftBitSat_s16s8_s16( 0x5556, 2 );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x7FFF, Shifted, "Value is not 0x7FFF as supposed to be" );
+}
+
+/**
+ * @brief   **Test deposit bits over a sparse mask**
+ *
+ * The test validates if the low order bits of a varible with value 0x00B5 are scattered over the
+ * mask 0xA5A5, to pass the result should have a value of 0x8521.
+ */
+void test__Bfx_DepositBits_u16u16_u16__sparse( void )
+{
+    uint16 Data;
+    uint16 Mask = 0xA5A5u;
+    Data        = Bfx_DepositBits_u16u16_u16( 0x00B5u, Mask );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x8521u, Data, "Value is not 0x8521 as supposed to be" );
+}
+
+/**
+ * @brief   **Test deposit bits over a constant contiguous mask**
+ *
+ * The test validates if the low order bits of a varible with value 0x002D are placed into the
+ * constant mask 0x0FC0, to pass the result should have a value of 0x0B40.
+ */
+void test__Bfx_DepositBits_u16u16_u16__contiguous( void )
+{
+    uint16 Data;
+    Data = Bfx_DepositBits_u16u16_u16( 0x002Du, 0x0FC0u );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x0B40u, Data, "Value is not 0x0B40 as supposed to be" );
+}
+
+/**
+ * @brief   **Test extract bits over a sparse mask**
+ *
+ * The test validates if the bits marked by the mask 0xA5A5 are gathered from a varible with value
+ * 0xF0F0, to pass the result should have a value of 0x00CC.
+ */
+void test__Bfx_ExtractBits_u16u16_u16__sparse( void )
+{
+    uint16 Data;
+    uint16 Mask = 0xA5A5u;
+    Data        = Bfx_ExtractBits_u16u16_u16( 0xF0F0u, Mask );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x00CCu, Data, "Value is not 0x00CC as supposed to be" );
+}
+
+/**
+ * @brief   **Test extract bits over a constant contiguous mask**
+ *
+ * The test validates if the bits marked by the constant mask 0x0FF0 are gathered from a varible
+ * with value 0x1234, to pass the result should have a value of 0x0023.
+ */
+void test__Bfx_ExtractBits_u16u16_u16__contiguous( void )
+{
+    uint16 Data;
+    Data = Bfx_ExtractBits_u16u16_u16( 0x1234u, 0x0FF0u );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x0023u, Data, "Value is not 0x0023 as supposed to be" );
+}
+
+/**
+ * @brief   **Test block count leading signs**
+ *
+ * The test validates the headroom of eleven values where the largest magnitude is -0x0200, to
+ * pass the count should be 6 no matter the position of the value in the array.
+ */
+void test__Bfx_CountLeadingSignsBlock_s16__min( void )
+{
+    sint16 Data[ 11 ] = { 0x0040, 0x0012, 0x0000, -0x0001, 0x0100, 0x00FF, -0x0100, 0x0001, 0x0002, 0x0003, -0x0200 };
+    uint8 Count;
+    Count = Bfx_CountLeadingSignsBlock_s16( Data, 11u );
+    TEST_ASSERT_EQUAL_MESSAGE( 6u, Count, "Count is not 6 as supposed to be" );
+}
+
+/**
+ * @brief   **Test block count leading signs of zeros**
+ *
+ * The test validates the headroom of values equal to 0 and -1, to pass the count should be 15.
+ */
+void test__Bfx_CountLeadingSignsBlock_s16__zeros( void )
+{
+    sint16 Data[ 3 ] = { 0x0000, -0x0001, 0x0000 };
+    uint8 Count;
+    Count = Bfx_CountLeadingSignsBlock_s16( Data, 3u );
+    TEST_ASSERT_EQUAL_MESSAGE( 15u, Count, "Count is not 15 as supposed to be" );
+}
+
+/**
+ * @brief   **Test block shift left with saturation**
+ *
+ * The test validates eleven values are shifted 3 bits to the left, to pass the values over 0x0FFF
+ * and below -0x1000 should saturate and the rest should be multiplied by 8.
+ */
+void test__Bfx_ShiftBlockSat_s16s8__left( void )
+{
+    sint16 Data[ 11 ]     = { 0x1000, -0x2000, 0x0100, 0x0FFF, -0x1000, -0x1001, 0x0001, 0x0000, 0x7FFF, -0x8000, -0x0003 };
+    sint16 Expected[ 11 ] = { 0x7FFF, -0x8000, 0x0800, 0x7FF8, -0x8000, -0x8000, 0x0008, 0x0000, 0x7FFF, -0x8000, -0x0018 };
+    Bfx_ShiftBlockSat_s16s8( Data, 11u, 3 );
+    TEST_ASSERT_EQUAL_INT16_ARRAY_MESSAGE( Expected, Data, 11, "Values are not shifted as supposed to be" );
+}
+
+/**
+ * @brief   **Test block shift right**
+ *
+ * The test validates eleven values are shifted 16 bits to the right, to pass the positive values
+ * should be 0 and the negative ones -1.
+ */
+void test__Bfx_ShiftBlockSat_s16s8__right( void )
+{
+    sint16 Data[ 11 ]     = { 0x1000, -0x2000, 0x0100, 0x0FFF, -0x1000, -0x1001, 0x0001, 0x0000, 0x7FFF, -0x8000, -0x0003 };
+    sint16 Expected[ 11 ] = { 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1 };
+    Bfx_ShiftBlockSat_s16s8( Data, 11u, -16 );
+    TEST_ASSERT_EQUAL_INT16_ARRAY_MESSAGE( Expected, Data, 11, "Values are not shifted as supposed to be" );
+}
+
+/**
+ * @brief   **Test block normalisation**
+ *
+ * The test validates four values are normalised with a common exponent, to pass the exponent
+ * should be 6 and -0x0200 should become -0x8000.
+ */
+void test__Bfx_NormalizeBlock_s16__exponent( void )
+{
+    sint16 Data[ 4 ]     = { 0x0040, -0x0200, 0x0012, 0x0000 };
+    sint16 Expected[ 4 ] = { 0x1000, -0x8000, 0x0480, 0x0000 };
+    uint8 Exponent;
+    Exponent = Bfx_NormalizeBlock_s16( Data, 4u );
+    TEST_ASSERT_EQUAL_MESSAGE( 6u, Exponent, "Exponent is not 6 as supposed to be" );
+    TEST_ASSERT_EQUAL_INT16_ARRAY_MESSAGE( Expected, Data, 4, "Values are not normalised as supposed to be" );
+}
@@ -707,3 +707,199 @@ void test__Bfx_CountLeadingZeros_u32__19zeroes( void )
     Zeroes = Bfx_CountLeadingZeros_u32( 0x00001600 );
     TEST_ASSERT_EQUAL_MESSAGE( 19, Zeroes, "Value is not 19 as supposed to be" );
 }
+
+/**
+ * @brief   **Test deposit bits over a sparse mask**
+ *
+ * The test validates if the low order bits of a varible with value 0x0000000F are scattered over the
+ * mask 0x80402010, to pass the result should have a value of 0x80402010.
+ */
+void test__Bfx_DepositBits_u32u32_u32__sparse( void )
+{
+    uint32 Data;
+    uint32 Mask = 0x80402010u;
+    Data        = Bfx_DepositBits_u32u32_u32( 0x0000000Fu, Mask );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x80402010u, Data, "Value is not 0x80402010 as supposed to be" );
+}
+
+/**
+ * @brief   **Test deposit bits over a constant contiguous mask**
+ *
+ * The test validates if the low order bits of a varible with value 0x000000A5 are placed into the
+ * constant mask 0x00FF0000, to pass the result should have a value of 0x00A50000.
+ */
+void test__Bfx_DepositBits_u32u32_u32__contiguous( void )
+{
+    uint32 Data;
+    Data = Bfx_DepositBits_u32u32_u32( 0x000000A5u, 0x00FF0000u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00A50000u, Data, "Value is not 0x00A50000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test extract bits over a sparse mask**
+ *
+ * The test validates if the bits marked by the mask 0x80C02010 are gathered from a varible with value
+ * 0x80402010, to pass the result should have a value of 0x00000017.
+ */
+void test__Bfx_ExtractBits_u32u32_u32__sparse( void )
+{
+    uint32 Data;
+    uint32 Mask = 0x80C02010u;
+    Data        = Bfx_ExtractBits_u32u32_u32( 0x80402010u, Mask );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000017u, Data, "Value is not 0x00000017 as supposed to be" );
+}
+
+/**
+ * @brief   **Test extract bits over a constant contiguous mask**
+ *
+ * The test validates if the bits marked by the constant mask 0x00FF0000 are gathered from a varible
+ * with value 0x12345678, to pass the result should have a value of 0x00000034.
+ */
+void test__Bfx_ExtractBits_u32u32_u32__contiguous( void )
+{
+    uint32 Data;
+    Data = Bfx_ExtractBits_u32u32_u32( 0x12345678u, 0x00FF0000u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000034u, Data, "Value is not 0x00000034 as supposed to be" );
+}
+
+/**
+ * @brief   **Test transpose of a 32x32 bit matrix**
+ *
+ * The test validates if a matrix with rows 0 and 1 equal to 0x80000006 and 0x00000002 is
+ * transposed, to pass rows 1, 2 and 31 should be 0x00000003, 0x00000001 and 0x00000001.
+ */
+void test__Bfx_Transpose32x32_u32__rows( void )
+{
+    uint32 Source[ 32 ]   = { 0x80000006u, 0x00000002u };
+    uint32 Expected[ 32 ] = { 0x00000000u, 0x00000003u, 0x00000001u };
+    uint32 Destination[ 32 ];
+    Expected[ 31 ] = 0x00000001u;
+    Bfx_Transpose32x32_u32( Source, Destination );
+    TEST_ASSERT_EQUAL_HEX32_ARRAY_MESSAGE( Expected, Destination, 32, "Matrix is not transposed as supposed to be" );
+}
+
+/**
+ * @brief   **Test transpose of a 32x32 bit matrix in place**
+ *
+ * The test validates if a matrix is transposed when source and destination are the same buffer, to
+ * pass a matrix with only the last row set should end with bit 31 set on every row.
+ */
+void test__Bfx_Transpose32x32_u32__inplace( void )
+{
+    uint32 Matrix[ 32 ] = { 0u };
+    Matrix[ 31 ]        = 0xFFFFFFFFu;
+    Bfx_Transpose32x32_u32( Matrix, Matrix );
+    for( uint8 i = 0u; i < 32u; i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x80000000u, Matrix[ i ], "Matrix is not transposed as supposed to be" );
+    }
+}
+
+/**
+ * @brief   **Test count 9 trailing zeroes**
+ *
+ * The test validates if the nine least significant bits are zero over a varible with value
+ * 0x80001600, to pass Zeroes should be equal to 9.
+ */
+void test__Bfx_CountTrailingZeros_u32__9zeroes( void )
+{
+    uint8 Zeroes;
+    Zeroes = Bfx_CountTrailingZeros_u32( 0x80001600u );
+    TEST_ASSERT_EQUAL_MESSAGE( 9, Zeroes, "Value is not 9 as supposed to be" );
+}
+
+/**
+ * @brief   **Test count trailing zeroes of zero**
+ *
+ * The test validates the count over a varible with value 0, to pass Zeroes should be equal to 32.
+ */
+void test__Bfx_CountTrailingZeros_u32__allzeroes( void )
+{
+    uint8 Zeroes;
+    Zeroes = Bfx_CountTrailingZeros_u32( 0u );
+    TEST_ASSERT_EQUAL_MESSAGE( 32, Zeroes, "Value is not 32 as supposed to be" );
+}
+
+/**
+ * @brief   **Test block count leading signs**
+ *
+ * The test validates the headroom of seven values where the largest magnitude is -0x00020000, to
+ * pass the count should be 14 no matter the position of the value in the array.
+ */
+void test__Bfx_CountLeadingSignsBlock_s32__min( void )
+{
+    sint32 Data[ 7 ] = { 0x00004000, 0x00000120, 0x00000000, -0x00000001, 0x0001FFFF, -0x00010000, -0x00020000 };
+    uint8 Count;
+    Count = Bfx_CountLeadingSignsBlock_s32( Data, 7u );
+    TEST_ASSERT_EQUAL_MESSAGE( 14u, Count, "Count is not 14 as supposed to be" );
+}
+
+/**
+ * @brief   **Test block count leading signs of an empty block**
+ *
+ * The test validates the headroom of a block with no values, to pass the count should be 31.
+ */
+void test__Bfx_CountLeadingSignsBlock_s32__empty( void )
+{
+    sint32 Data[ 1 ] = { 0x7FFFFFFF };
+    uint8 Count;
+    Count = Bfx_CountLeadingSignsBlock_s32( Data, 0u );
+    TEST_ASSERT_EQUAL_MESSAGE( 31u, Count, "Count is not 31 as supposed to be" );
+}
+
+/**
+ * @brief   **Test block shift left with saturation**
+ *
+ * The test validates nine values are shifted 3 bits to the left, to pass the values over
+ * 0x0FFFFFFF and below -0x10000000 should saturate and the rest should be multiplied by 8.
+ */
+void test__Bfx_ShiftBlockSat_s32s8__left( void )
+{
+    sint32 Data[ 9 ]     = { 0x10000000, -0x20000000, 0x00010000, 0x0FFFFFFF, -0x10000000, -0x10000001, 0x00000001, INT32_MAX, -0x00000003 };
+    sint32 Expected[ 9 ] = { INT32_MAX, INT32_MIN, 0x00080000, 0x7FFFFFF8, INT32_MIN, INT32_MIN, 0x00000008, INT32_MAX, -0x00000018 };
+    Bfx_ShiftBlockSat_s32s8( Data, 9u, 3 );
+    TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE( Expected, Data, 9, "Values are not shifted as supposed to be" );
+}
+
+/**
+ * @brief   **Test block shift right**
+ *
+ * The test validates nine values are shifted 4 bits to the right, to pass the values should be
+ * divided by 16 rounding toward minus infinity.
+ */
+void test__Bfx_ShiftBlockSat_s32s8__right( void )
+{
+    sint32 Data[ 9 ]     = { 0x10000000, -0x20000000, 0x00010000, 0x0FFFFFFF, -0x10000000, -0x10000001, 0x00000001, INT32_MAX, -0x00000003 };
+    sint32 Expected[ 9 ] = { 0x01000000, -0x02000000, 0x00001000, 0x00FFFFFF, -0x01000000, -0x01000001, 0x00000000, 0x07FFFFFF, -0x00000001 };
+    Bfx_ShiftBlockSat_s32s8( Data, 9u, -4 );
+    TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE( Expected, Data, 9, "Values are not shifted as supposed to be" );
+}
+
+/**
+ * @brief   **Test block normalisation**
+ *
+ * The test validates four values are normalised with a common exponent, to pass the exponent
+ * should be 14 and -0x00020000 should become -0x80000000.
+ */
+void test__Bfx_NormalizeBlock_s32__exponent( void )
+{
+    sint32 Data[ 4 ]     = { 0x00004000, -0x00020000, 0x00000120, 0x00000000 };
+    sint32 Expected[ 4 ] = { 0x10000000, INT32_MIN, 0x00480000, 0x00000000 };
+    uint8 Exponent;
+    Exponent = Bfx_NormalizeBlock_s32( Data, 4u );
+    TEST_ASSERT_EQUAL_MESSAGE( 14u, Exponent, "Exponent is not 14 as supposed to be" );
+    TEST_ASSERT_EQUAL_INT32_ARRAY_MESSAGE( Expected, Data, 4, "Values are not normalised as supposed to be" );
+}
+
+/**
+ * @brief   **Test count leading zeroes of zero**
+ *
+ * The test validates the leading zeros of a varible with value 0x00000000, to pass Zeroes should be
+ * equal to 32.
+ */
+void test__Bfx_CountLeadingZeros_u32__zero( void )
+{
+    uint8 Zeroes;
+    Zeroes = Bfx_CountLeadingZeros_u32( 0x00000000u );
+    TEST_ASSERT_EQUAL_MESSAGE( 32u, Zeroes, "Value is not 32 as supposed to be" );
+}
@@ -598,7 +598,7 @@ void test__Bfx_ShiftBitSat_s8s8_s8__3leftp_nosaturation( void )
 void test__Bfx_ShiftBitSat_s8s8_s8__3leftn_saturation( void )
 {
     uint8 Shifted;
-    Shifted = Bfx_ShiftBitSat_s8s8_s8( 0xE6, 3 );
+    Shifted = Bfx_ShiftBitSat_s8s8_s8( (sint8)0xE6, 3 );
     TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0x80, Shifted, "Value is not 0x80 as supposed to be" );
 }
 
@@ -613,7 +613,7 @@ void test__Bfx_ShiftBitSat_s8s8_s8__3leftn_saturation( void )
 void test__Bfx_ShiftBitSat_s8s8_s8__3leftn_nosaturation( void )
 {
     uint8 Shifted;
-    Shifted = Bfx_ShiftBitSat_s8s8_s8( 0xF8, 3 );
+    Shifted = Bfx_ShiftBitSat_s8s8_s8( (sint8)0xF8, 3 );
     TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0xC0, Shifted, "Value is not 0xC0 as supposed to be" );
 }
 
@@ -643,7 +643,7 @@ void test__Bfx_ShiftBitSat_s8s8_s8__3righp( void )
 void test__Bfx_ShiftBitSat_s8s8_s8__3righn( void )
 {
     uint8 Shifted;
-    Shifted = Bfx_ShiftBitSat_s8s8_s8( 0xE6, -3 );
+    Shifted = Bfx_ShiftBitSat_s8s8_s8( (sint8)0xE6, -3 );
     TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0xFC, Shifted, "Value is not 0xFC as supposed to be" );
 }
 
@@ -673,7 +673,7 @@ void test__Bfx_CountLeadingOnes_u8__3ones( void )
 void test__Bfx_CountLeadingSigns_s8__2ones( void )
 {
     uint8 Bits;
-    Bits = Bfx_CountLeadingSigns_s8( 0xE6 );
+    Bits = Bfx_CountLeadingSigns_s8( (sint8)0xE6 );
     TEST_ASSERT_EQUAL_MESSAGE( 2, Bits, "Value is not 2 as supposed to be" );
 }
 
@@ -706,3 +706,115 @@ void test__Bfx_CountLeadingZeros_u8__3zeroes( void )
     Zeroes = Bfx_CountLeadingZeros_u8( 0x16 );
     TEST_ASSERT_EQUAL_MESSAGE( 3, Zeroes, "Value is not 3 as supposed to be" );
 }
+
+/**
+ * @brief   **Test count zeroes on a zero value**
+ *
+ * The test validates the count over a varible with value 0x00, to pass Zeroes should be equal to
+ * 8, the width of the variable.
+ * 
+ * @test    SWS_Bfx_91005, SWS_Bfx_00141
+ */
+void test__Bfx_CountLeadingZeros_u8__allzeroes( void )
+{
+    uint8 Zeroes;
+    Zeroes = Bfx_CountLeadingZeros_u8( 0x00 );
+    TEST_ASSERT_EQUAL_MESSAGE( 8, Zeroes, "Value is not 8 as supposed to be" );
+}
+
+/**
+ * @brief   **Test shift to the left 2 bits saturation with a bigger result**
+ *
+ * The test validates a shift to the left by 2 bits over a varible with value 0x56, the truncated
+ * result 0x58 is bigger than the input but bits were lost, to pass Data should be equal to 0x7F.
+ * 
+ * @test    SWS_Bfx_91002, SWS_Bfx_00134, SWS_Bfx_00135
+ */
+void test__Bfx_ShiftBitSat_s8s8_s8__2leftp_saturation( void )
+{
+    uint8 Shifted;
+    Shifted = Bfx_ShiftBitSat_s8s8_s8( 0x56, 2 );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0x7F, Shifted, "Value is not 0x7F as supposed to be" );
+}
+
+/**
+ * @brief   **Test deposit bits over a sparse mask**
+ *
+ * The test validates if the low order bits of a varible with value 0x05 are scattered over the
+ * mask 0x5A, to pass the result should have a value of 0x12.
+ */
+void test__Bfx_DepositBits_u8u8_u8__sparse( void )
+{
+    uint8 Data;
+    uint8 Mask = 0x5Au;
+    Data       = Bfx_DepositBits_u8u8_u8( 0x05u, Mask );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0x12u, Data, "Value is not 0x12 as supposed to be" );
+}
+
+/**
+ * @brief   **Test deposit bits over a constant contiguous mask**
+ *
+ * The test validates if the low order bits of a varible with value 0x05 are placed into the
+ * constant mask 0x70, to pass the result should have a value of 0x50.
+ */
+void test__Bfx_DepositBits_u8u8_u8__contiguous( void )
+{
+    uint8 Data;
+    Data = Bfx_DepositBits_u8u8_u8( 0x05u, 0x70u );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0x50u, Data, "Value is not 0x50 as supposed to be" );
+}
+
+/**
+ * @brief   **Test extract bits over a sparse mask**
+ *
+ * The test validates if the bits marked by the mask 0x5A are gathered from a varible with value
+ * 0xC6, to pass the result should have a value of 0x09.
+ */
+void test__Bfx_ExtractBits_u8u8_u8__sparse( void )
+{
+    uint8 Data;
+    uint8 Mask = 0x5Au;
+    Data       = Bfx_ExtractBits_u8u8_u8( 0xC6u, Mask );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0x09u, Data, "Value is not 0x09 as supposed to be" );
+}
+
+/**
+ * @brief   **Test extract bits over a constant contiguous mask**
+ *
+ * The test validates if the bits marked by the constant mask 0x3C are gathered from a varible
+ * with value 0xB6, to pass the result should have a value of 0x0D.
+ */
+void test__Bfx_ExtractBits_u8u8_u8__contiguous( void )
+{
+    uint8 Data;
+    Data = Bfx_ExtractBits_u8u8_u8( 0xB6u, 0x3Cu );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0x0Du, Data, "Value is not 0x0D as supposed to be" );
+}
+/**
+ * @brief   **Test transpose of a 8x8 bit matrix**
+ *
+ * The test validates if the rows { 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81 } are transposed,
+ * to pass the result should be { 0x80, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80 }.
+ */
+void test__Bfx_Transpose8x8_u8__rows( void )
+{
+    uint8 Source[ 8 ]   = { 0x06u, 0x02u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x81u };
+    uint8 Expected[ 8 ] = { 0x80u, 0x03u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x80u };
+    uint8 Destination[ 8 ];
+    Bfx_Transpose8x8_u8( Source, Destination );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY_MESSAGE( Expected, Destination, 8, "Matrix is not transposed as supposed to be" );
+}
+
+/**
+ * @brief   **Test transpose of a 8x8 bit matrix in place**
+ *
+ * The test validates if a matrix is transposed when source and destination are the same buffer, to
+ * pass a matrix with only the first row set should end with bit 0 set on every row.
+ */
+void test__Bfx_Transpose8x8_u8__inplace( void )
+{
+    uint8 Matrix[ 8 ]   = { 0xFFu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u };
+    uint8 Expected[ 8 ] = { 0x01u, 0x01u, 0x01u, 0x01u, 0x01u, 0x01u, 0x01u, 0x01u };
+    Bfx_Transpose8x8_u8( Matrix, Matrix );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY_MESSAGE( Expected, Matrix, 8, "Matrix is not transposed as supposed to be" );
+}
@@ -0,0 +1,115 @@
+/**
+ * @file    Test_Bfx_Atomic.c
+ * @brief   **Unit Test for the Interrupt Safe 32 Bit Handling Routines**
+ *
+ * The atomic variants shall leave the shared word as the plain 32 bit routines do, the host build
+ * runs them on the compiler atomic builtins.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Bfx.h"
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test atomic set and clear bit**
+ *
+ * The test validates bits 0 and 31 are set and cleared over a word with value 0x00010000, to pass
+ * the word should read 0x80010001 after the sets and 0x00010000 after the clears.
+ */
+void test__Bfx_AtomicSetBit_u32u8__ends( void )
+{
+    volatile uint32 Data = 0x00010000u;
+
+    Bfx_AtomicSetBit_u32u8( &Data, 0u );
+    Bfx_AtomicSetBit_u32u8( &Data, 31u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x80010001u, Data, "Bits 0 and 31 were not set" );
+    Bfx_AtomicClrBit_u32u8( &Data, 0u );
+    Bfx_AtomicClrBit_u32u8( &Data, 31u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00010000u, Data, "Bits 0 and 31 were not cleared" );
+}
+
+/**
+ * @brief   **Test atomic test and set bit**
+ *
+ * The test validates the bit status before the set is returned, to pass the first call on bit 5
+ * should return FALSE, the second TRUE, and the word should only have bit 5 set.
+ */
+void test__Bfx_AtomicTstSetBit_u32u8_u8__twice( void )
+{
+    volatile uint32 Data = 0u;
+
+    TEST_ASSERT_FALSE_MESSAGE( Bfx_AtomicTstSetBit_u32u8_u8( &Data, 5u ), "Bit 5 was reported set" );
+    TEST_ASSERT_TRUE_MESSAGE( Bfx_AtomicTstSetBit_u32u8_u8( &Data, 5u ), "Bit 5 was reported clear" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000020u, Data, "Only bit 5 shall be set" );
+}
+
+/**
+ * @brief   **Test atomic set and clear bit mask**
+ *
+ * The test validates the mask bits are set and then cleared over a word with value 0x0000FFFF, to
+ * pass the word should read 0xF000FFFF after the set and 0xF0000FF0 after the clear.
+ */
+void test__Bfx_AtomicSetBitMask_u32u32__set_clear( void )
+{
+    volatile uint32 Data = 0x0000FFFFu;
+
+    Bfx_AtomicSetBitMask_u32u32( &Data, 0xF0000000u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xF000FFFFu, Data, "Mask bits were not set" );
+    Bfx_AtomicClrBitMask_u32u32( &Data, 0x0000F00Fu );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xF0000FF0u, Data, "Mask bits were not cleared" );
+}
+
+/**
+ * @brief   **Test atomic take bit mask**
+ *
+ * The test validates only the mask bits set in the word are returned and cleared, to pass the flags
+ * taken from 0x67 with mask 0xF0 should be 0x60 and the word left should be 0x07.
+ */
+void test__Bfx_AtomicTakeBitMask_u32u32_u32__flags( void )
+{
+    volatile uint32 Data = 0x67u;
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x60u, Bfx_AtomicTakeBitMask_u32u32_u32( &Data, 0xF0u ), "Taken flags are not 0x60" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x07u, Data, "Taken flags were not cleared" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0u, Bfx_AtomicTakeBitMask_u32u32_u32( &Data, 0xF0u ), "Flags were taken twice" );
+}
+
+/**
+ * @brief   **Test atomic toggle bit mask**
+ *
+ * The test validates the mask bits are toggled over a word with value 0x51, to pass the word should
+ * read 0x92 as Bfx_ToggleBitMask_u32u32 leaves it.
+ */
+void test__Bfx_AtomicToggleBitMask_u32u32__pattern( void )
+{
+    volatile uint32 Data = 0x51u;
+    uint32 Plain         = 0x51u;
+
+    Bfx_AtomicToggleBitMask_u32u32( &Data, 0xC3u );
+    Bfx_ToggleBitMask_u32u32( &Plain, 0xC3u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Plain, Data, "Mask bits were not toggled" );
+}
+
+/**
+ * @brief   **Test atomic put bits mask**
+ *
+ * The test validates the mask bits are replaced by the pattern bits and the rest are kept, to pass
+ * the word should read as Bfx_PutBitsMask_u32u32u32 leaves it, 0xA55A5AA5.
+ */
+void test__Bfx_AtomicPutBitsMask_u32u32u32__pattern( void )
+{
+    volatile uint32 Data = 0xA5A5A5A5u;
+    uint32 Plain         = 0xA5A5A5A5u;
+
+    Bfx_AtomicPutBitsMask_u32u32u32( &Data, 0x5A5A5A5Au, 0x00FFFF00u );
+    Bfx_PutBitsMask_u32u32u32( &Plain, 0x5A5A5A5Au, 0x00FFFF00u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Plain, Data, "Word differs from Bfx_PutBitsMask_u32u32u32" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xA55A5AA5u, Data, "Mask bits were not replaced" );
+}
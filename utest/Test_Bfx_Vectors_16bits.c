@@ -0,0 +1,3047 @@
+/**
+ * @file    Test_Bfx_Vectors_16bits.c
+ * @brief   **Table Driven Unit Test for the 16 Bit Handling Routines**
+ *
+ * Generated by tools/bfx_vectors.py from utest/vectors/Bfx_Vectors.yaml, do not edit, change the
+ * YAML file and run meson compile -C build vectors instead.
+ *
+ * Each test runs every vector in the table of its routine, 2285 vectors in total. The expected
+ * results come from the reference model of the generator.
+ */
+#include <stdio.h>
+#include "unity.h"
+#include "Std_Types.h"
+#include "Bfx_16bits.h"
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+static char Message[ 64 ];
+
+static const char *Vector( const char *Routine, uint32 Index )
+{
+    (void)snprintf( Message, sizeof( Message ), "%s vector %u", Routine, (unsigned)Index );
+    return Message;
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 BitPn;
+    uint16 Expected;
+} SetBit_u16u8[] = {
+    { 0x0000u,  0u, 0x0001u },
+    { 0x0000u,  1u, 0x0002u },
+    { 0x0000u,  2u, 0x0004u },
+    { 0x0000u,  3u, 0x0008u },
+    { 0x0000u,  4u, 0x0010u },
+    { 0x0000u,  5u, 0x0020u },
+    { 0x0000u,  6u, 0x0040u },
+    { 0x0000u,  7u, 0x0080u },
+    { 0x0000u,  8u, 0x0100u },
+    { 0x0000u,  9u, 0x0200u },
+    { 0x0000u, 10u, 0x0400u },
+    { 0x0000u, 11u, 0x0800u },
+    { 0x0000u, 12u, 0x1000u },
+    { 0x0000u, 13u, 0x2000u },
+    { 0x0000u, 14u, 0x4000u },
+    { 0x0000u, 15u, 0x8000u },
+    { 0xFFFFu,  0u, 0xFFFFu },
+    { 0xFFFFu,  1u, 0xFFFFu },
+    { 0xFFFFu,  2u, 0xFFFFu },
+    { 0xFFFFu,  3u, 0xFFFFu },
+    { 0xFFFFu,  4u, 0xFFFFu },
+    { 0xFFFFu,  5u, 0xFFFFu },
+    { 0xFFFFu,  6u, 0xFFFFu },
+    { 0xFFFFu,  7u, 0xFFFFu },
+    { 0xFFFFu,  8u, 0xFFFFu },
+    { 0xFFFFu,  9u, 0xFFFFu },
+    { 0xFFFFu, 10u, 0xFFFFu },
+    { 0xFFFFu, 11u, 0xFFFFu },
+    { 0xFFFFu, 12u, 0xFFFFu },
+    { 0xFFFFu, 13u, 0xFFFFu },
+    { 0xFFFFu, 14u, 0xFFFFu },
+    { 0xFFFFu, 15u, 0xFFFFu },
+    { 0x5555u,  0u, 0x5555u },
+    { 0x5555u,  1u, 0x5557u },
+    { 0x5555u,  2u, 0x5555u },
+    { 0x5555u,  3u, 0x555Du },
+    { 0x5555u,  4u, 0x5555u },
+    { 0x5555u,  5u, 0x5575u },
+    { 0x5555u,  6u, 0x5555u },
+    { 0x5555u,  7u, 0x55D5u },
+    { 0x5555u,  8u, 0x5555u },
+    { 0x5555u,  9u, 0x5755u },
+    { 0x5555u, 10u, 0x5555u },
+    { 0x5555u, 11u, 0x5D55u },
+    { 0x5555u, 12u, 0x5555u },
+    { 0x5555u, 13u, 0x7555u },
+    { 0x5555u, 14u, 0x5555u },
+    { 0x5555u, 15u, 0xD555u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_SetBit_u16u8 vectors**
+ *
+ * The test runs the 48 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00001, SWS_Bfx_00002, SWS_Bfx_00008
+ */
+void test__Bfx_SetBit_u16u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( SetBit_u16u8 ) / sizeof( SetBit_u16u8[ 0 ] ) ); i++ )
+    {
+        uint16 Data = SetBit_u16u8[ i ].Data;
+        Bfx_SetBit_u16u8( &Data, SetBit_u16u8[ i ].BitPn );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( SetBit_u16u8[ i ].Expected, Data, Vector( "Bfx_SetBit_u16u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 BitPn;
+    uint16 Expected;
+} ClrBit_u16u8[] = {
+    { 0x0000u,  0u, 0x0000u },
+    { 0x0000u,  1u, 0x0000u },
+    { 0x0000u,  2u, 0x0000u },
+    { 0x0000u,  3u, 0x0000u },
+    { 0x0000u,  4u, 0x0000u },
+    { 0x0000u,  5u, 0x0000u },
+    { 0x0000u,  6u, 0x0000u },
+    { 0x0000u,  7u, 0x0000u },
+    { 0x0000u,  8u, 0x0000u },
+    { 0x0000u,  9u, 0x0000u },
+    { 0x0000u, 10u, 0x0000u },
+    { 0x0000u, 11u, 0x0000u },
+    { 0x0000u, 12u, 0x0000u },
+    { 0x0000u, 13u, 0x0000u },
+    { 0x0000u, 14u, 0x0000u },
+    { 0x0000u, 15u, 0x0000u },
+    { 0xFFFFu,  0u, 0xFFFEu },
+    { 0xFFFFu,  1u, 0xFFFDu },
+    { 0xFFFFu,  2u, 0xFFFBu },
+    { 0xFFFFu,  3u, 0xFFF7u },
+    { 0xFFFFu,  4u, 0xFFEFu },
+    { 0xFFFFu,  5u, 0xFFDFu },
+    { 0xFFFFu,  6u, 0xFFBFu },
+    { 0xFFFFu,  7u, 0xFF7Fu },
+    { 0xFFFFu,  8u, 0xFEFFu },
+    { 0xFFFFu,  9u, 0xFDFFu },
+    { 0xFFFFu, 10u, 0xFBFFu },
+    { 0xFFFFu, 11u, 0xF7FFu },
+    { 0xFFFFu, 12u, 0xEFFFu },
+    { 0xFFFFu, 13u, 0xDFFFu },
+    { 0xFFFFu, 14u, 0xBFFFu },
+    { 0xFFFFu, 15u, 0x7FFFu },
+    { 0xAAAAu,  0u, 0xAAAAu },
+    { 0xAAAAu,  1u, 0xAAA8u },
+    { 0xAAAAu,  2u, 0xAAAAu },
+    { 0xAAAAu,  3u, 0xAAA2u },
+    { 0xAAAAu,  4u, 0xAAAAu },
+    { 0xAAAAu,  5u, 0xAA8Au },
+    { 0xAAAAu,  6u, 0xAAAAu },
+    { 0xAAAAu,  7u, 0xAA2Au },
+    { 0xAAAAu,  8u, 0xAAAAu },
+    { 0xAAAAu,  9u, 0xA8AAu },
+    { 0xAAAAu, 10u, 0xAAAAu },
+    { 0xAAAAu, 11u, 0xA2AAu },
+    { 0xAAAAu, 12u, 0xAAAAu },
+    { 0xAAAAu, 13u, 0x8AAAu },
+    { 0xAAAAu, 14u, 0xAAAAu },
+    { 0xAAAAu, 15u, 0x2AAAu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ClrBit_u16u8 vectors**
+ *
+ * The test runs the 48 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00010, SWS_Bfx_00011, SWS_Bfx_00015
+ */
+void test__Bfx_ClrBit_u16u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ClrBit_u16u8 ) / sizeof( ClrBit_u16u8[ 0 ] ) ); i++ )
+    {
+        uint16 Data = ClrBit_u16u8[ i ].Data;
+        Bfx_ClrBit_u16u8( &Data, ClrBit_u16u8[ i ].BitPn );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( ClrBit_u16u8[ i ].Expected, Data, Vector( "Bfx_ClrBit_u16u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 BitPn;
+    boolean Expected;
+} GetBit_u16u8_u8[] = {
+    { 0x0000u,  0u, FALSE },
+    { 0x0000u,  1u, FALSE },
+    { 0x0000u,  2u, FALSE },
+    { 0x0000u,  3u, FALSE },
+    { 0x0000u,  4u, FALSE },
+    { 0x0000u,  5u, FALSE },
+    { 0x0000u,  6u, FALSE },
+    { 0x0000u,  7u, FALSE },
+    { 0x0000u,  8u, FALSE },
+    { 0x0000u,  9u, FALSE },
+    { 0x0000u, 10u, FALSE },
+    { 0x0000u, 11u, FALSE },
+    { 0x0000u, 12u, FALSE },
+    { 0x0000u, 13u, FALSE },
+    { 0x0000u, 14u, FALSE },
+    { 0x0000u, 15u, FALSE },
+    { 0xFFFFu,  0u,  TRUE },
+    { 0xFFFFu,  1u,  TRUE },
+    { 0xFFFFu,  2u,  TRUE },
+    { 0xFFFFu,  3u,  TRUE },
+    { 0xFFFFu,  4u,  TRUE },
+    { 0xFFFFu,  5u,  TRUE },
+    { 0xFFFFu,  6u,  TRUE },
+    { 0xFFFFu,  7u,  TRUE },
+    { 0xFFFFu,  8u,  TRUE },
+    { 0xFFFFu,  9u,  TRUE },
+    { 0xFFFFu, 10u,  TRUE },
+    { 0xFFFFu, 11u,  TRUE },
+    { 0xFFFFu, 12u,  TRUE },
+    { 0xFFFFu, 13u,  TRUE },
+    { 0xFFFFu, 14u,  TRUE },
+    { 0xFFFFu, 15u,  TRUE },
+    { 0x5555u,  0u,  TRUE },
+    { 0x5555u,  1u, FALSE },
+    { 0x5555u,  2u,  TRUE },
+    { 0x5555u,  3u, FALSE },
+    { 0x5555u,  4u,  TRUE },
+    { 0x5555u,  5u, FALSE },
+    { 0x5555u,  6u,  TRUE },
+    { 0x5555u,  7u, FALSE },
+    { 0x5555u,  8u,  TRUE },
+    { 0x5555u,  9u, FALSE },
+    { 0x5555u, 10u,  TRUE },
+    { 0x5555u, 11u, FALSE },
+    { 0x5555u, 12u,  TRUE },
+    { 0x5555u, 13u, FALSE },
+    { 0x5555u, 14u,  TRUE },
+    { 0x5555u, 15u, FALSE },
+    { 0xCDEFu,  0u,  TRUE },
+    { 0xCDEFu,  1u,  TRUE },
+    { 0xCDEFu,  2u,  TRUE },
+    { 0xCDEFu,  3u,  TRUE },
+    { 0xCDEFu,  4u, FALSE },
+    { 0xCDEFu,  5u,  TRUE },
+    { 0xCDEFu,  6u,  TRUE },
+    { 0xCDEFu,  7u,  TRUE },
+    { 0xCDEFu,  8u,  TRUE },
+    { 0xCDEFu,  9u, FALSE },
+    { 0xCDEFu, 10u,  TRUE },
+    { 0xCDEFu, 11u,  TRUE },
+    { 0xCDEFu, 12u, FALSE },
+    { 0xCDEFu, 13u, FALSE },
+    { 0xCDEFu, 14u,  TRUE },
+    { 0xCDEFu, 15u,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_GetBit_u16u8_u8 vectors**
+ *
+ * The test runs the 64 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00016, SWS_Bfx_00017, SWS_Bfx_00020
+ */
+void test__Bfx_GetBit_u16u8_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( GetBit_u16u8_u8 ) / sizeof( GetBit_u16u8_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( GetBit_u16u8_u8[ i ].Expected, Bfx_GetBit_u16u8_u8( GetBit_u16u8_u8[ i ].Data, GetBit_u16u8_u8[ i ].BitPn ), Vector( "Bfx_GetBit_u16u8_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 BitPn;
+    boolean Status;
+    uint16 Expected;
+} PutBit_u16u8u8[] = {
+    { 0x0000u,  0u, FALSE, 0x0000u },
+    { 0x0000u,  0u,  TRUE, 0x0001u },
+    { 0x0000u,  1u, FALSE, 0x0000u },
+    { 0x0000u,  1u,  TRUE, 0x0002u },
+    { 0x0000u,  2u, FALSE, 0x0000u },
+    { 0x0000u,  2u,  TRUE, 0x0004u },
+    { 0x0000u,  3u, FALSE, 0x0000u },
+    { 0x0000u,  3u,  TRUE, 0x0008u },
+    { 0x0000u,  4u, FALSE, 0x0000u },
+    { 0x0000u,  4u,  TRUE, 0x0010u },
+    { 0x0000u,  5u, FALSE, 0x0000u },
+    { 0x0000u,  5u,  TRUE, 0x0020u },
+    { 0x0000u,  6u, FALSE, 0x0000u },
+    { 0x0000u,  6u,  TRUE, 0x0040u },
+    { 0x0000u,  7u, FALSE, 0x0000u },
+    { 0x0000u,  7u,  TRUE, 0x0080u },
+    { 0x0000u,  8u, FALSE, 0x0000u },
+    { 0x0000u,  8u,  TRUE, 0x0100u },
+    { 0x0000u,  9u, FALSE, 0x0000u },
+    { 0x0000u,  9u,  TRUE, 0x0200u },
+    { 0x0000u, 10u, FALSE, 0x0000u },
+    { 0x0000u, 10u,  TRUE, 0x0400u },
+    { 0x0000u, 11u, FALSE, 0x0000u },
+    { 0x0000u, 11u,  TRUE, 0x0800u },
+    { 0x0000u, 12u, FALSE, 0x0000u },
+    { 0x0000u, 12u,  TRUE, 0x1000u },
+    { 0x0000u, 13u, FALSE, 0x0000u },
+    { 0x0000u, 13u,  TRUE, 0x2000u },
+    { 0x0000u, 14u, FALSE, 0x0000u },
+    { 0x0000u, 14u,  TRUE, 0x4000u },
+    { 0x0000u, 15u, FALSE, 0x0000u },
+    { 0x0000u, 15u,  TRUE, 0x8000u },
+    { 0xFFFFu,  0u, FALSE, 0xFFFEu },
+    { 0xFFFFu,  0u,  TRUE, 0xFFFFu },
+    { 0xFFFFu,  1u, FALSE, 0xFFFDu },
+    { 0xFFFFu,  1u,  TRUE, 0xFFFFu },
+    { 0xFFFFu,  2u, FALSE, 0xFFFBu },
+    { 0xFFFFu,  2u,  TRUE, 0xFFFFu },
+    { 0xFFFFu,  3u, FALSE, 0xFFF7u },
+    { 0xFFFFu,  3u,  TRUE, 0xFFFFu },
+    { 0xFFFFu,  4u, FALSE, 0xFFEFu },
+    { 0xFFFFu,  4u,  TRUE, 0xFFFFu },
+    { 0xFFFFu,  5u, FALSE, 0xFFDFu },
+    { 0xFFFFu,  5u,  TRUE, 0xFFFFu },
+    { 0xFFFFu,  6u, FALSE, 0xFFBFu },
+    { 0xFFFFu,  6u,  TRUE, 0xFFFFu },
+    { 0xFFFFu,  7u, FALSE, 0xFF7Fu },
+    { 0xFFFFu,  7u,  TRUE, 0xFFFFu },
+    { 0xFFFFu,  8u, FALSE, 0xFEFFu },
+    { 0xFFFFu,  8u,  TRUE, 0xFFFFu },
+    { 0xFFFFu,  9u, FALSE, 0xFDFFu },
+    { 0xFFFFu,  9u,  TRUE, 0xFFFFu },
+    { 0xFFFFu, 10u, FALSE, 0xFBFFu },
+    { 0xFFFFu, 10u,  TRUE, 0xFFFFu },
+    { 0xFFFFu, 11u, FALSE, 0xF7FFu },
+    { 0xFFFFu, 11u,  TRUE, 0xFFFFu },
+    { 0xFFFFu, 12u, FALSE, 0xEFFFu },
+    { 0xFFFFu, 12u,  TRUE, 0xFFFFu },
+    { 0xFFFFu, 13u, FALSE, 0xDFFFu },
+    { 0xFFFFu, 13u,  TRUE, 0xFFFFu },
+    { 0xFFFFu, 14u, FALSE, 0xBFFFu },
+    { 0xFFFFu, 14u,  TRUE, 0xFFFFu },
+    { 0xFFFFu, 15u, FALSE, 0x7FFFu },
+    { 0xFFFFu, 15u,  TRUE, 0xFFFFu },
+    { 0xCDEFu,  0u, FALSE, 0xCDEEu },
+    { 0xCDEFu,  0u,  TRUE, 0xCDEFu },
+    { 0xCDEFu,  1u, FALSE, 0xCDEDu },
+    { 0xCDEFu,  1u,  TRUE, 0xCDEFu },
+    { 0xCDEFu,  2u, FALSE, 0xCDEBu },
+    { 0xCDEFu,  2u,  TRUE, 0xCDEFu },
+    { 0xCDEFu,  3u, FALSE, 0xCDE7u },
+    { 0xCDEFu,  3u,  TRUE, 0xCDEFu },
+    { 0xCDEFu,  4u, FALSE, 0xCDEFu },
+    { 0xCDEFu,  4u,  TRUE, 0xCDFFu },
+    { 0xCDEFu,  5u, FALSE, 0xCDCFu },
+    { 0xCDEFu,  5u,  TRUE, 0xCDEFu },
+    { 0xCDEFu,  6u, FALSE, 0xCDAFu },
+    { 0xCDEFu,  6u,  TRUE, 0xCDEFu },
+    { 0xCDEFu,  7u, FALSE, 0xCD6Fu },
+    { 0xCDEFu,  7u,  TRUE, 0xCDEFu },
+    { 0xCDEFu,  8u, FALSE, 0xCCEFu },
+    { 0xCDEFu,  8u,  TRUE, 0xCDEFu },
+    { 0xCDEFu,  9u, FALSE, 0xCDEFu },
+    { 0xCDEFu,  9u,  TRUE, 0xCFEFu },
+    { 0xCDEFu, 10u, FALSE, 0xC9EFu },
+    { 0xCDEFu, 10u,  TRUE, 0xCDEFu },
+    { 0xCDEFu, 11u, FALSE, 0xC5EFu },
+    { 0xCDEFu, 11u,  TRUE, 0xCDEFu },
+    { 0xCDEFu, 12u, FALSE, 0xCDEFu },
+    { 0xCDEFu, 12u,  TRUE, 0xDDEFu },
+    { 0xCDEFu, 13u, FALSE, 0xCDEFu },
+    { 0xCDEFu, 13u,  TRUE, 0xEDEFu },
+    { 0xCDEFu, 14u, FALSE, 0x8DEFu },
+    { 0xCDEFu, 14u,  TRUE, 0xCDEFu },
+    { 0xCDEFu, 15u, FALSE, 0x4DEFu },
+    { 0xCDEFu, 15u,  TRUE, 0xCDEFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_PutBit_u16u8u8 vectors**
+ *
+ * The test runs the 96 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00130, SWS_Bfx_00132
+ */
+void test__Bfx_PutBit_u16u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( PutBit_u16u8u8 ) / sizeof( PutBit_u16u8u8[ 0 ] ) ); i++ )
+    {
+        uint16 Data = PutBit_u16u8u8[ i ].Data;
+        Bfx_PutBit_u16u8u8( &Data, PutBit_u16u8u8[ i ].BitPn, PutBit_u16u8u8[ i ].Status );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( PutBit_u16u8u8[ i ].Expected, Data, Vector( "Bfx_PutBit_u16u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 BitStartPn;
+    uint8 BitLn;
+    uint8 Status;
+    uint16 Expected;
+} SetBits_u16u8u8u8[] = {
+    { 0x5555u,  0u,  0u, 0u, 0x5555u },
+    { 0x5555u,  0u,  0u, 1u, 0x5555u },
+    { 0x5555u,  0u,  1u, 0u, 0x5554u },
+    { 0x5555u,  0u,  1u, 1u, 0x5555u },
+    { 0x5555u,  0u,  2u, 0u, 0x5554u },
+    { 0x5555u,  0u,  2u, 1u, 0x5557u },
+    { 0x5555u,  0u,  3u, 0u, 0x5550u },
+    { 0x5555u,  0u,  3u, 1u, 0x5557u },
+    { 0x5555u,  0u,  4u, 0u, 0x5550u },
+    { 0x5555u,  0u,  4u, 1u, 0x555Fu },
+    { 0x5555u,  0u,  5u, 0u, 0x5540u },
+    { 0x5555u,  0u,  5u, 1u, 0x555Fu },
+    { 0x5555u,  0u,  6u, 0u, 0x5540u },
+    { 0x5555u,  0u,  6u, 1u, 0x557Fu },
+    { 0x5555u,  0u,  7u, 0u, 0x5500u },
+    { 0x5555u,  0u,  7u, 1u, 0x557Fu },
+    { 0x5555u,  0u,  8u, 0u, 0x5500u },
+    { 0x5555u,  0u,  8u, 1u, 0x55FFu },
+    { 0x5555u,  0u,  9u, 0u, 0x5400u },
+    { 0x5555u,  0u,  9u, 1u, 0x55FFu },
+    { 0x5555u,  0u, 10u, 0u, 0x5400u },
+    { 0x5555u,  0u, 10u, 1u, 0x57FFu },
+    { 0x5555u,  0u, 11u, 0u, 0x5000u },
+    { 0x5555u,  0u, 11u, 1u, 0x57FFu },
+    { 0x5555u,  0u, 12u, 0u, 0x5000u },
+    { 0x5555u,  0u, 12u, 1u, 0x5FFFu },
+    { 0x5555u,  0u, 13u, 0u, 0x4000u },
+    { 0x5555u,  0u, 13u, 1u, 0x5FFFu },
+    { 0x5555u,  0u, 14u, 0u, 0x4000u },
+    { 0x5555u,  0u, 14u, 1u, 0x7FFFu },
+    { 0x5555u,  0u, 15u, 0u, 0x0000u },
+    { 0x5555u,  0u, 15u, 1u, 0x7FFFu },
+    { 0x5555u,  0u, 16u, 0u, 0x0000u },
+    { 0x5555u,  0u, 16u, 1u, 0xFFFFu },
+    { 0x5555u,  1u,  0u, 0u, 0x5555u },
+    { 0x5555u,  1u,  0u, 1u, 0x5555u },
+    { 0x5555u,  1u,  1u, 0u, 0x5555u },
+    { 0x5555u,  1u,  1u, 1u, 0x5557u },
+    { 0x5555u,  1u,  2u, 0u, 0x5551u },
+    { 0x5555u,  1u,  2u, 1u, 0x5557u },
+    { 0x5555u,  1u,  3u, 0u, 0x5551u },
+    { 0x5555u,  1u,  3u, 1u, 0x555Fu },
+    { 0x5555u,  1u,  4u, 0u, 0x5541u },
+    { 0x5555u,  1u,  4u, 1u, 0x555Fu },
+    { 0x5555u,  1u,  5u, 0u, 0x5541u },
+    { 0x5555u,  1u,  5u, 1u, 0x557Fu },
+    { 0x5555u,  1u,  6u, 0u, 0x5501u },
+    { 0x5555u,  1u,  6u, 1u, 0x557Fu },
+    { 0x5555u,  1u,  7u, 0u, 0x5501u },
+    { 0x5555u,  1u,  7u, 1u, 0x55FFu },
+    { 0x5555u,  1u,  8u, 0u, 0x5401u },
+    { 0x5555u,  1u,  8u, 1u, 0x55FFu },
+    { 0x5555u,  1u,  9u, 0u, 0x5401u },
+    { 0x5555u,  1u,  9u, 1u, 0x57FFu },
+    { 0x5555u,  1u, 10u, 0u, 0x5001u },
+    { 0x5555u,  1u, 10u, 1u, 0x57FFu },
+    { 0x5555u,  1u, 11u, 0u, 0x5001u },
+    { 0x5555u,  1u, 11u, 1u, 0x5FFFu },
+    { 0x5555u,  1u, 12u, 0u, 0x4001u },
+    { 0x5555u,  1u, 12u, 1u, 0x5FFFu },
+    { 0x5555u,  1u, 13u, 0u, 0x4001u },
+    { 0x5555u,  1u, 13u, 1u, 0x7FFFu },
+    { 0x5555u,  1u, 14u, 0u, 0x0001u },
+    { 0x5555u,  1u, 14u, 1u, 0x7FFFu },
+    { 0x5555u,  1u, 15u, 0u, 0x0001u },
+    { 0x5555u,  1u, 15u, 1u, 0xFFFFu },
+    { 0x5555u,  2u,  0u, 0u, 0x5555u },
+    { 0x5555u,  2u,  0u, 1u, 0x5555u },
+    { 0x5555u,  2u,  1u, 0u, 0x5551u },
+    { 0x5555u,  2u,  1u, 1u, 0x5555u },
+    { 0x5555u,  2u,  2u, 0u, 0x5551u },
+    { 0x5555u,  2u,  2u, 1u, 0x555Du },
+    { 0x5555u,  2u,  3u, 0u, 0x5541u },
+    { 0x5555u,  2u,  3u, 1u, 0x555Du },
+    { 0x5555u,  2u,  4u, 0u, 0x5541u },
+    { 0x5555u,  2u,  4u, 1u, 0x557Du },
+    { 0x5555u,  2u,  5u, 0u, 0x5501u },
+    { 0x5555u,  2u,  5u, 1u, 0x557Du },
+    { 0x5555u,  2u,  6u, 0u, 0x5501u },
+    { 0x5555u,  2u,  6u, 1u, 0x55FDu },
+    { 0x5555u,  2u,  7u, 0u, 0x5401u },
+    { 0x5555u,  2u,  7u, 1u, 0x55FDu },
+    { 0x5555u,  2u,  8u, 0u, 0x5401u },
+    { 0x5555u,  2u,  8u, 1u, 0x57FDu },
+    { 0x5555u,  2u,  9u, 0u, 0x5001u },
+    { 0x5555u,  2u,  9u, 1u, 0x57FDu },
+    { 0x5555u,  2u, 10u, 0u, 0x5001u },
+    { 0x5555u,  2u, 10u, 1u, 0x5FFDu },
+    { 0x5555u,  2u, 11u, 0u, 0x4001u },
+    { 0x5555u,  2u, 11u, 1u, 0x5FFDu },
+    { 0x5555u,  2u, 12u, 0u, 0x4001u },
+    { 0x5555u,  2u, 12u, 1u, 0x7FFDu },
+    { 0x5555u,  2u, 13u, 0u, 0x0001u },
+    { 0x5555u,  2u, 13u, 1u, 0x7FFDu },
+    { 0x5555u,  2u, 14u, 0u, 0x0001u },
+    { 0x5555u,  2u, 14u, 1u, 0xFFFDu },
+    { 0x5555u,  3u,  0u, 0u, 0x5555u },
+    { 0x5555u,  3u,  0u, 1u, 0x5555u },
+    { 0x5555u,  3u,  1u, 0u, 0x5555u },
+    { 0x5555u,  3u,  1u, 1u, 0x555Du },
+    { 0x5555u,  3u,  2u, 0u, 0x5545u },
+    { 0x5555u,  3u,  2u, 1u, 0x555Du },
+    { 0x5555u,  3u,  3u, 0u, 0x5545u },
+    { 0x5555u,  3u,  3u, 1u, 0x557Du },
+    { 0x5555u,  3u,  4u, 0u, 0x5505u },
+    { 0x5555u,  3u,  4u, 1u, 0x557Du },
+    { 0x5555u,  3u,  5u, 0u, 0x5505u },
+    { 0x5555u,  3u,  5u, 1u, 0x55FDu },
+    { 0x5555u,  3u,  6u, 0u, 0x5405u },
+    { 0x5555u,  3u,  6u, 1u, 0x55FDu },
+    { 0x5555u,  3u,  7u, 0u, 0x5405u },
+    { 0x5555u,  3u,  7u, 1u, 0x57FDu },
+    { 0x5555u,  3u,  8u, 0u, 0x5005u },
+    { 0x5555u,  3u,  8u, 1u, 0x57FDu },
+    { 0x5555u,  3u,  9u, 0u, 0x5005u },
+    { 0x5555u,  3u,  9u, 1u, 0x5FFDu },
+    { 0x5555u,  3u, 10u, 0u, 0x4005u },
+    { 0x5555u,  3u, 10u, 1u, 0x5FFDu },
+    { 0x5555u,  3u, 11u, 0u, 0x4005u },
+    { 0x5555u,  3u, 11u, 1u, 0x7FFDu },
+    { 0x5555u,  3u, 12u, 0u, 0x0005u },
+    { 0x5555u,  3u, 12u, 1u, 0x7FFDu },
+    { 0x5555u,  3u, 13u, 0u, 0x0005u },
+    { 0x5555u,  3u, 13u, 1u, 0xFFFDu },
+    { 0x5555u,  4u,  0u, 0u, 0x5555u },
+    { 0x5555u,  4u,  0u, 1u, 0x5555u },
+    { 0x5555u,  4u,  1u, 0u, 0x5545u },
+    { 0x5555u,  4u,  1u, 1u, 0x5555u },
+    { 0x5555u,  4u,  2u, 0u, 0x5545u },
+    { 0x5555u,  4u,  2u, 1u, 0x5575u },
+    { 0x5555u,  4u,  3u, 0u, 0x5505u },
+    { 0x5555u,  4u,  3u, 1u, 0x5575u },
+    { 0x5555u,  4u,  4u, 0u, 0x5505u },
+    { 0x5555u,  4u,  4u, 1u, 0x55F5u },
+    { 0x5555u,  4u,  5u, 0u, 0x5405u },
+    { 0x5555u,  4u,  5u, 1u, 0x55F5u },
+    { 0x5555u,  4u,  6u, 0u, 0x5405u },
+    { 0x5555u,  4u,  6u, 1u, 0x57F5u },
+    { 0x5555u,  4u,  7u, 0u, 0x5005u },
+    { 0x5555u,  4u,  7u, 1u, 0x57F5u },
+    { 0x5555u,  4u,  8u, 0u, 0x5005u },
+    { 0x5555u,  4u,  8u, 1u, 0x5FF5u },
+    { 0x5555u,  4u,  9u, 0u, 0x4005u },
+    { 0x5555u,  4u,  9u, 1u, 0x5FF5u },
+    { 0x5555u,  4u, 10u, 0u, 0x4005u },
+    { 0x5555u,  4u, 10u, 1u, 0x7FF5u },
+    { 0x5555u,  4u, 11u, 0u, 0x0005u },
+    { 0x5555u,  4u, 11u, 1u, 0x7FF5u },
+    { 0x5555u,  4u, 12u, 0u, 0x0005u },
+    { 0x5555u,  4u, 12u, 1u, 0xFFF5u },
+    { 0x5555u,  5u,  0u, 0u, 0x5555u },
+    { 0x5555u,  5u,  0u, 1u, 0x5555u },
+    { 0x5555u,  5u,  1u, 0u, 0x5555u },
+    { 0x5555u,  5u,  1u, 1u, 0x5575u },
+    { 0x5555u,  5u,  2u, 0u, 0x5515u },
+    { 0x5555u,  5u,  2u, 1u, 0x5575u },
+    { 0x5555u,  5u,  3u, 0u, 0x5515u },
+    { 0x5555u,  5u,  3u, 1u, 0x55F5u },
+    { 0x5555u,  5u,  4u, 0u, 0x5415u },
+    { 0x5555u,  5u,  4u, 1u, 0x55F5u },
+    { 0x5555u,  5u,  5u, 0u, 0x5415u },
+    { 0x5555u,  5u,  5u, 1u, 0x57F5u },
+    { 0x5555u,  5u,  6u, 0u, 0x5015u },
+    { 0x5555u,  5u,  6u, 1u, 0x57F5u },
+    { 0x5555u,  5u,  7u, 0u, 0x5015u },
+    { 0x5555u,  5u,  7u, 1u, 0x5FF5u },
+    { 0x5555u,  5u,  8u, 0u, 0x4015u },
+    { 0x5555u,  5u,  8u, 1u, 0x5FF5u },
+    { 0x5555u,  5u,  9u, 0u, 0x4015u },
+    { 0x5555u,  5u,  9u, 1u, 0x7FF5u },
+    { 0x5555u,  5u, 10u, 0u, 0x0015u },
+    { 0x5555u,  5u, 10u, 1u, 0x7FF5u },
+    { 0x5555u,  5u, 11u, 0u, 0x0015u },
+    { 0x5555u,  5u, 11u, 1u, 0xFFF5u },
+    { 0x5555u,  6u,  0u, 0u, 0x5555u },
+    { 0x5555u,  6u,  0u, 1u, 0x5555u },
+    { 0x5555u,  6u,  1u, 0u, 0x5515u },
+    { 0x5555u,  6u,  1u, 1u, 0x5555u },
+    { 0x5555u,  6u,  2u, 0u, 0x5515u },
+    { 0x5555u,  6u,  2u, 1u, 0x55D5u },
+    { 0x5555u,  6u,  3u, 0u, 0x5415u },
+    { 0x5555u,  6u,  3u, 1u, 0x55D5u },
+    { 0x5555u,  6u,  4u, 0u, 0x5415u },
+    { 0x5555u,  6u,  4u, 1u, 0x57D5u },
+    { 0x5555u,  6u,  5u, 0u, 0x5015u },
+    { 0x5555u,  6u,  5u, 1u, 0x57D5u },
+    { 0x5555u,  6u,  6u, 0u, 0x5015u },
+    { 0x5555u,  6u,  6u, 1u, 0x5FD5u },
+    { 0x5555u,  6u,  7u, 0u, 0x4015u },
+    { 0x5555u,  6u,  7u, 1u, 0x5FD5u },
+    { 0x5555u,  6u,  8u, 0u, 0x4015u },
+    { 0x5555u,  6u,  8u, 1u, 0x7FD5u },
+    { 0x5555u,  6u,  9u, 0u, 0x0015u },
+    { 0x5555u,  6u,  9u, 1u, 0x7FD5u },
+    { 0x5555u,  6u, 10u, 0u, 0x0015u },
+    { 0x5555u,  6u, 10u, 1u, 0xFFD5u },
+    { 0x5555u,  7u,  0u, 0u, 0x5555u },
+    { 0x5555u,  7u,  0u, 1u, 0x5555u },
+    { 0x5555u,  7u,  1u, 0u, 0x5555u },
+    { 0x5555u,  7u,  1u, 1u, 0x55D5u },
+    { 0x5555u,  7u,  2u, 0u, 0x5455u },
+    { 0x5555u,  7u,  2u, 1u, 0x55D5u },
+    { 0x5555u,  7u,  3u, 0u, 0x5455u },
+    { 0x5555u,  7u,  3u, 1u, 0x57D5u },
+    { 0x5555u,  7u,  4u, 0u, 0x5055u },
+    { 0x5555u,  7u,  4u, 1u, 0x57D5u },
+    { 0x5555u,  7u,  5u, 0u, 0x5055u },
+    { 0x5555u,  7u,  5u, 1u, 0x5FD5u },
+    { 0x5555u,  7u,  6u, 0u, 0x4055u },
+    { 0x5555u,  7u,  6u, 1u, 0x5FD5u },
+    { 0x5555u,  7u,  7u, 0u, 0x4055u },
+    { 0x5555u,  7u,  7u, 1u, 0x7FD5u },
+    { 0x5555u,  7u,  8u, 0u, 0x0055u },
+    { 0x5555u,  7u,  8u, 1u, 0x7FD5u },
+    { 0x5555u,  7u,  9u, 0u, 0x0055u },
+    { 0x5555u,  7u,  9u, 1u, 0xFFD5u },
+    { 0x5555u,  8u,  0u, 0u, 0x5555u },
+    { 0x5555u,  8u,  0u, 1u, 0x5555u },
+    { 0x5555u,  8u,  1u, 0u, 0x5455u },
+    { 0x5555u,  8u,  1u, 1u, 0x5555u },
+    { 0x5555u,  8u,  2u, 0u, 0x5455u },
+    { 0x5555u,  8u,  2u, 1u, 0x5755u },
+    { 0x5555u,  8u,  3u, 0u, 0x5055u },
+    { 0x5555u,  8u,  3u, 1u, 0x5755u },
+    { 0x5555u,  8u,  4u, 0u, 0x5055u },
+    { 0x5555u,  8u,  4u, 1u, 0x5F55u },
+    { 0x5555u,  8u,  5u, 0u, 0x4055u },
+    { 0x5555u,  8u,  5u, 1u, 0x5F55u },
+    { 0x5555u,  8u,  6u, 0u, 0x4055u },
+    { 0x5555u,  8u,  6u, 1u, 0x7F55u },
+    { 0x5555u,  8u,  7u, 0u, 0x0055u },
+    { 0x5555u,  8u,  7u, 1u, 0x7F55u },
+    { 0x5555u,  8u,  8u, 0u, 0x0055u },
+    { 0x5555u,  8u,  8u, 1u, 0xFF55u },
+    { 0x5555u,  9u,  0u, 0u, 0x5555u },
+    { 0x5555u,  9u,  0u, 1u, 0x5555u },
+    { 0x5555u,  9u,  1u, 0u, 0x5555u },
+    { 0x5555u,  9u,  1u, 1u, 0x5755u },
+    { 0x5555u,  9u,  2u, 0u, 0x5155u },
+    { 0x5555u,  9u,  2u, 1u, 0x5755u },
+    { 0x5555u,  9u,  3u, 0u, 0x5155u },
+    { 0x5555u,  9u,  3u, 1u, 0x5F55u },
+    { 0x5555u,  9u,  4u, 0u, 0x4155u },
+    { 0x5555u,  9u,  4u, 1u, 0x5F55u },
+    { 0x5555u,  9u,  5u, 0u, 0x4155u },
+    { 0x5555u,  9u,  5u, 1u, 0x7F55u },
+    { 0x5555u,  9u,  6u, 0u, 0x0155u },
+    { 0x5555u,  9u,  6u, 1u, 0x7F55u },
+    { 0x5555u,  9u,  7u, 0u, 0x0155u },
+    { 0x5555u,  9u,  7u, 1u, 0xFF55u },
+    { 0x5555u, 10u,  0u, 0u, 0x5555u },
+    { 0x5555u, 10u,  0u, 1u, 0x5555u },
+    { 0x5555u, 10u,  1u, 0u, 0x5155u },
+    { 0x5555u, 10u,  1u, 1u, 0x5555u },
+    { 0x5555u, 10u,  2u, 0u, 0x5155u },
+    { 0x5555u, 10u,  2u, 1u, 0x5D55u },
+    { 0x5555u, 10u,  3u, 0u, 0x4155u },
+    { 0x5555u, 10u,  3u, 1u, 0x5D55u },
+    { 0x5555u, 10u,  4u, 0u, 0x4155u },
+    { 0x5555u, 10u,  4u, 1u, 0x7D55u },
+    { 0x5555u, 10u,  5u, 0u, 0x0155u },
+    { 0x5555u, 10u,  5u, 1u, 0x7D55u },
+    { 0x5555u, 10u,  6u, 0u, 0x0155u },
+    { 0x5555u, 10u,  6u, 1u, 0xFD55u },
+    { 0x5555u, 11u,  0u, 0u, 0x5555u },
+    { 0x5555u, 11u,  0u, 1u, 0x5555u },
+    { 0x5555u, 11u,  1u, 0u, 0x5555u },
+    { 0x5555u, 11u,  1u, 1u, 0x5D55u },
+    { 0x5555u, 11u,  2u, 0u, 0x4555u },
+    { 0x5555u, 11u,  2u, 1u, 0x5D55u },
+    { 0x5555u, 11u,  3u, 0u, 0x4555u },
+    { 0x5555u, 11u,  3u, 1u, 0x7D55u },
+    { 0x5555u, 11u,  4u, 0u, 0x0555u },
+    { 0x5555u, 11u,  4u, 1u, 0x7D55u },
+    { 0x5555u, 11u,  5u, 0u, 0x0555u },
+    { 0x5555u, 11u,  5u, 1u, 0xFD55u },
+    { 0x5555u, 12u,  0u, 0u, 0x5555u },
+    { 0x5555u, 12u,  0u, 1u, 0x5555u },
+    { 0x5555u, 12u,  1u, 0u, 0x4555u },
+    { 0x5555u, 12u,  1u, 1u, 0x5555u },
+    { 0x5555u, 12u,  2u, 0u, 0x4555u },
+    { 0x5555u, 12u,  2u, 1u, 0x7555u },
+    { 0x5555u, 12u,  3u, 0u, 0x0555u },
+    { 0x5555u, 12u,  3u, 1u, 0x7555u },
+    { 0x5555u, 12u,  4u, 0u, 0x0555u },
+    { 0x5555u, 12u,  4u, 1u, 0xF555u },
+    { 0x5555u, 13u,  0u, 0u, 0x5555u },
+    { 0x5555u, 13u,  0u, 1u, 0x5555u },
+    { 0x5555u, 13u,  1u, 0u, 0x5555u },
+    { 0x5555u, 13u,  1u, 1u, 0x7555u },
+    { 0x5555u, 13u,  2u, 0u, 0x1555u },
+    { 0x5555u, 13u,  2u, 1u, 0x7555u },
+    { 0x5555u, 13u,  3u, 0u, 0x1555u },
+    { 0x5555u, 13u,  3u, 1u, 0xF555u },
+    { 0x5555u, 14u,  0u, 0u, 0x5555u },
+    { 0x5555u, 14u,  0u, 1u, 0x5555u },
+    { 0x5555u, 14u,  1u, 0u, 0x1555u },
+    { 0x5555u, 14u,  1u, 1u, 0x5555u },
+    { 0x5555u, 14u,  2u, 0u, 0x1555u },
+    { 0x5555u, 14u,  2u, 1u, 0xD555u },
+    { 0x5555u, 15u,  0u, 0u, 0x5555u },
+    { 0x5555u, 15u,  0u, 1u, 0x5555u },
+    { 0x5555u, 15u,  1u, 0u, 0x5555u },
+    { 0x5555u, 15u,  1u, 1u, 0xD555u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_SetBits_u16u8u8u8 vectors**
+ *
+ * The test runs the 304 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00021, SWS_Bfx_00022, SWS_Bfx_00025
+ */
+void test__Bfx_SetBits_u16u8u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( SetBits_u16u8u8u8 ) / sizeof( SetBits_u16u8u8u8[ 0 ] ) ); i++ )
+    {
+        uint16 Data = SetBits_u16u8u8u8[ i ].Data;
+        Bfx_SetBits_u16u8u8u8( &Data, SetBits_u16u8u8u8[ i ].BitStartPn, SetBits_u16u8u8u8[ i ].BitLn, SetBits_u16u8u8u8[ i ].Status );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( SetBits_u16u8u8u8[ i ].Expected, Data, Vector( "Bfx_SetBits_u16u8u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 BitStartPn;
+    uint8 BitLn;
+    uint16 Expected;
+} GetBits_u16u8u8_u16[] = {
+    { 0xCDEFu,  0u,  0u, 0x0000u },
+    { 0xCDEFu,  0u,  1u, 0x0001u },
+    { 0xCDEFu,  0u,  2u, 0x0003u },
+    { 0xCDEFu,  0u,  3u, 0x0007u },
+    { 0xCDEFu,  0u,  4u, 0x000Fu },
+    { 0xCDEFu,  0u,  5u, 0x000Fu },
+    { 0xCDEFu,  0u,  6u, 0x002Fu },
+    { 0xCDEFu,  0u,  7u, 0x006Fu },
+    { 0xCDEFu,  0u,  8u, 0x00EFu },
+    { 0xCDEFu,  0u,  9u, 0x01EFu },
+    { 0xCDEFu,  0u, 10u, 0x01EFu },
+    { 0xCDEFu,  0u, 11u, 0x05EFu },
+    { 0xCDEFu,  0u, 12u, 0x0DEFu },
+    { 0xCDEFu,  0u, 13u, 0x0DEFu },
+    { 0xCDEFu,  0u, 14u, 0x0DEFu },
+    { 0xCDEFu,  0u, 15u, 0x4DEFu },
+    { 0xCDEFu,  0u, 16u, 0xCDEFu },
+    { 0xCDEFu,  1u,  0u, 0x0000u },
+    { 0xCDEFu,  1u,  1u, 0x0001u },
+    { 0xCDEFu,  1u,  2u, 0x0003u },
+    { 0xCDEFu,  1u,  3u, 0x0007u },
+    { 0xCDEFu,  1u,  4u, 0x0007u },
+    { 0xCDEFu,  1u,  5u, 0x0017u },
+    { 0xCDEFu,  1u,  6u, 0x0037u },
+    { 0xCDEFu,  1u,  7u, 0x0077u },
+    { 0xCDEFu,  1u,  8u, 0x00F7u },
+    { 0xCDEFu,  1u,  9u, 0x00F7u },
+    { 0xCDEFu,  1u, 10u, 0x02F7u },
+    { 0xCDEFu,  1u, 11u, 0x06F7u },
+    { 0xCDEFu,  1u, 12u, 0x06F7u },
+    { 0xCDEFu,  1u, 13u, 0x06F7u },
+    { 0xCDEFu,  1u, 14u, 0x26F7u },
+    { 0xCDEFu,  1u, 15u, 0x66F7u },
+    { 0xCDEFu,  2u,  0u, 0x0000u },
+    { 0xCDEFu,  2u,  1u, 0x0001u },
+    { 0xCDEFu,  2u,  2u, 0x0003u },
+    { 0xCDEFu,  2u,  3u, 0x0003u },
+    { 0xCDEFu,  2u,  4u, 0x000Bu },
+    { 0xCDEFu,  2u,  5u, 0x001Bu },
+    { 0xCDEFu,  2u,  6u, 0x003Bu },
+    { 0xCDEFu,  2u,  7u, 0x007Bu },
+    { 0xCDEFu,  2u,  8u, 0x007Bu },
+    { 0xCDEFu,  2u,  9u, 0x017Bu },
+    { 0xCDEFu,  2u, 10u, 0x037Bu },
+    { 0xCDEFu,  2u, 11u, 0x037Bu },
+    { 0xCDEFu,  2u, 12u, 0x037Bu },
+    { 0xCDEFu,  2u, 13u, 0x137Bu },
+    { 0xCDEFu,  2u, 14u, 0x337Bu },
+    { 0xCDEFu,  3u,  0u, 0x0000u },
+    { 0xCDEFu,  3u,  1u, 0x0001u },
+    { 0xCDEFu,  3u,  2u, 0x0001u },
+    { 0xCDEFu,  3u,  3u, 0x0005u },
+    { 0xCDEFu,  3u,  4u, 0x000Du },
+    { 0xCDEFu,  3u,  5u, 0x001Du },
+    { 0xCDEFu,  3u,  6u, 0x003Du },
+    { 0xCDEFu,  3u,  7u, 0x003Du },
+    { 0xCDEFu,  3u,  8u, 0x00BDu },
+    { 0xCDEFu,  3u,  9u, 0x01BDu },
+    { 0xCDEFu,  3u, 10u, 0x01BDu },
+    { 0xCDEFu,  3u, 11u, 0x01BDu },
+    { 0xCDEFu,  3u, 12u, 0x09BDu },
+    { 0xCDEFu,  3u, 13u, 0x19BDu },
+    { 0xCDEFu,  4u,  0u, 0x0000u },
+    { 0xCDEFu,  4u,  1u, 0x0000u },
+    { 0xCDEFu,  4u,  2u, 0x0002u },
+    { 0xCDEFu,  4u,  3u, 0x0006u },
+    { 0xCDEFu,  4u,  4u, 0x000Eu },
+    { 0xCDEFu,  4u,  5u, 0x001Eu },
+    { 0xCDEFu,  4u,  6u, 0x001Eu },
+    { 0xCDEFu,  4u,  7u, 0x005Eu },
+    { 0xCDEFu,  4u,  8u, 0x00DEu },
+    { 0xCDEFu,  4u,  9u, 0x00DEu },
+    { 0xCDEFu,  4u, 10u, 0x00DEu },
+    { 0xCDEFu,  4u, 11u, 0x04DEu },
+    { 0xCDEFu,  4u, 12u, 0x0CDEu },
+    { 0xCDEFu,  5u,  0u, 0x0000u },
+    { 0xCDEFu,  5u,  1u, 0x0001u },
+    { 0xCDEFu,  5u,  2u, 0x0003u },
+    { 0xCDEFu,  5u,  3u, 0x0007u },
+    { 0xCDEFu,  5u,  4u, 0x000Fu },
+    { 0xCDEFu,  5u,  5u, 0x000Fu },
+    { 0xCDEFu,  5u,  6u, 0x002Fu },
+    { 0xCDEFu,  5u,  7u, 0x006Fu },
+    { 0xCDEFu,  5u,  8u, 0x006Fu },
+    { 0xCDEFu,  5u,  9u, 0x006Fu },
+    { 0xCDEFu,  5u, 10u, 0x026Fu },
+    { 0xCDEFu,  5u, 11u, 0x066Fu },
+    { 0xCDEFu,  6u,  0u, 0x0000u },
+    { 0xCDEFu,  6u,  1u, 0x0001u },
+    { 0xCDEFu,  6u,  2u, 0x0003u },
+    { 0xCDEFu,  6u,  3u, 0x0007u },
+    { 0xCDEFu,  6u,  4u, 0x0007u },
+    { 0xCDEFu,  6u,  5u, 0x0017u },
+    { 0xCDEFu,  6u,  6u, 0x0037u },
+    { 0xCDEFu,  6u,  7u, 0x0037u },
+    { 0xCDEFu,  6u,  8u, 0x0037u },
+    { 0xCDEFu,  6u,  9u, 0x0137u },
+    { 0xCDEFu,  6u, 10u, 0x0337u },
+    { 0xCDEFu,  7u,  0u, 0x0000u },
+    { 0xCDEFu,  7u,  1u, 0x0001u },
+    { 0xCDEFu,  7u,  2u, 0x0003u },
+    { 0xCDEFu,  7u,  3u, 0x0003u },
+    { 0xCDEFu,  7u,  4u, 0x000Bu },
+    { 0xCDEFu,  7u,  5u, 0x001Bu },
+    { 0xCDEFu,  7u,  6u, 0x001Bu },
+    { 0xCDEFu,  7u,  7u, 0x001Bu },
+    { 0xCDEFu,  7u,  8u, 0x009Bu },
+    { 0xCDEFu,  7u,  9u, 0x019Bu },
+    { 0xCDEFu,  8u,  0u, 0x0000u },
+    { 0xCDEFu,  8u,  1u, 0x0001u },
+    { 0xCDEFu,  8u,  2u, 0x0001u },
+    { 0xCDEFu,  8u,  3u, 0x0005u },
+    { 0xCDEFu,  8u,  4u, 0x000Du },
+    { 0xCDEFu,  8u,  5u, 0x000Du },
+    { 0xCDEFu,  8u,  6u, 0x000Du },
+    { 0xCDEFu,  8u,  7u, 0x004Du },
+    { 0xCDEFu,  8u,  8u, 0x00CDu },
+    { 0xCDEFu,  9u,  0u, 0x0000u },
+    { 0xCDEFu,  9u,  1u, 0x0000u },
+    { 0xCDEFu,  9u,  2u, 0x0002u },
+    { 0xCDEFu,  9u,  3u, 0x0006u },
+    { 0xCDEFu,  9u,  4u, 0x0006u },
+    { 0xCDEFu,  9u,  5u, 0x0006u },
+    { 0xCDEFu,  9u,  6u, 0x0026u },
+    { 0xCDEFu,  9u,  7u, 0x0066u },
+    { 0xCDEFu, 10u,  0u, 0x0000u },
+    { 0xCDEFu, 10u,  1u, 0x0001u },
+    { 0xCDEFu, 10u,  2u, 0x0003u },
+    { 0xCDEFu, 10u,  3u, 0x0003u },
+    { 0xCDEFu, 10u,  4u, 0x0003u },
+    { 0xCDEFu, 10u,  5u, 0x0013u },
+    { 0xCDEFu, 10u,  6u, 0x0033u },
+    { 0xCDEFu, 11u,  0u, 0x0000u },
+    { 0xCDEFu, 11u,  1u, 0x0001u },
+    { 0xCDEFu, 11u,  2u, 0x0001u },
+    { 0xCDEFu, 11u,  3u, 0x0001u },
+    { 0xCDEFu, 11u,  4u, 0x0009u },
+    { 0xCDEFu, 11u,  5u, 0x0019u },
+    { 0xCDEFu, 12u,  0u, 0x0000u },
+    { 0xCDEFu, 12u,  1u, 0x0000u },
+    { 0xCDEFu, 12u,  2u, 0x0000u },
+    { 0xCDEFu, 12u,  3u, 0x0004u },
+    { 0xCDEFu, 12u,  4u, 0x000Cu },
+    { 0xCDEFu, 13u,  0u, 0x0000u },
+    { 0xCDEFu, 13u,  1u, 0x0000u },
+    { 0xCDEFu, 13u,  2u, 0x0002u },
+    { 0xCDEFu, 13u,  3u, 0x0006u },
+    { 0xCDEFu, 14u,  0u, 0x0000u },
+    { 0xCDEFu, 14u,  1u, 0x0001u },
+    { 0xCDEFu, 14u,  2u, 0x0003u },
+    { 0xCDEFu, 15u,  0u, 0x0000u },
+    { 0xCDEFu, 15u,  1u, 0x0001u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_GetBits_u16u8u8_u16 vectors**
+ *
+ * The test runs the 152 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00028, SWS_Bfx_00029, SWS_Bfx_00034
+ */
+void test__Bfx_GetBits_u16u8u8_u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( GetBits_u16u8u8_u16 ) / sizeof( GetBits_u16u8u8_u16[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( GetBits_u16u8u8_u16[ i ].Expected, Bfx_GetBits_u16u8u8_u16( GetBits_u16u8u8_u16[ i ].Data, GetBits_u16u8u8_u16[ i ].BitStartPn, GetBits_u16u8u8_u16[ i ].BitLn ), Vector( "Bfx_GetBits_u16u8u8_u16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 BitStartPn;
+    uint8 BitLn;
+    uint16 Pattern;
+    uint16 Expected;
+} PutBits_u16u8u8u16[] = {
+    { 0xFFFFu,  0u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  0u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  0u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  0u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  0u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  0u,  5u, 0xCDEFu, 0xFFEFu },
+    { 0xFFFFu,  0u,  6u, 0xCDEFu, 0xFFEFu },
+    { 0xFFFFu,  0u,  7u, 0xCDEFu, 0xFFEFu },
+    { 0xFFFFu,  0u,  8u, 0xCDEFu, 0xFFEFu },
+    { 0xFFFFu,  0u,  9u, 0xCDEFu, 0xFFEFu },
+    { 0xFFFFu,  0u, 10u, 0xCDEFu, 0xFDEFu },
+    { 0xFFFFu,  0u, 11u, 0xCDEFu, 0xFDEFu },
+    { 0xFFFFu,  0u, 12u, 0xCDEFu, 0xFDEFu },
+    { 0xFFFFu,  0u, 13u, 0xCDEFu, 0xEDEFu },
+    { 0xFFFFu,  0u, 14u, 0xCDEFu, 0xCDEFu },
+    { 0xFFFFu,  0u, 15u, 0xCDEFu, 0xCDEFu },
+    { 0xFFFFu,  0u, 16u, 0xCDEFu, 0xCDEFu },
+    { 0xFFFFu,  1u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  1u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  1u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  1u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  1u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  1u,  5u, 0xCDEFu, 0xFFDFu },
+    { 0xFFFFu,  1u,  6u, 0xCDEFu, 0xFFDFu },
+    { 0xFFFFu,  1u,  7u, 0xCDEFu, 0xFFDFu },
+    { 0xFFFFu,  1u,  8u, 0xCDEFu, 0xFFDFu },
+    { 0xFFFFu,  1u,  9u, 0xCDEFu, 0xFFDFu },
+    { 0xFFFFu,  1u, 10u, 0xCDEFu, 0xFBDFu },
+    { 0xFFFFu,  1u, 11u, 0xCDEFu, 0xFBDFu },
+    { 0xFFFFu,  1u, 12u, 0xCDEFu, 0xFBDFu },
+    { 0xFFFFu,  1u, 13u, 0xCDEFu, 0xDBDFu },
+    { 0xFFFFu,  1u, 14u, 0xCDEFu, 0x9BDFu },
+    { 0xFFFFu,  1u, 15u, 0xCDEFu, 0x9BDFu },
+    { 0xFFFFu,  2u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  2u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  2u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  2u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  2u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  2u,  5u, 0xCDEFu, 0xFFBFu },
+    { 0xFFFFu,  2u,  6u, 0xCDEFu, 0xFFBFu },
+    { 0xFFFFu,  2u,  7u, 0xCDEFu, 0xFFBFu },
+    { 0xFFFFu,  2u,  8u, 0xCDEFu, 0xFFBFu },
+    { 0xFFFFu,  2u,  9u, 0xCDEFu, 0xFFBFu },
+    { 0xFFFFu,  2u, 10u, 0xCDEFu, 0xF7BFu },
+    { 0xFFFFu,  2u, 11u, 0xCDEFu, 0xF7BFu },
+    { 0xFFFFu,  2u, 12u, 0xCDEFu, 0xF7BFu },
+    { 0xFFFFu,  2u, 13u, 0xCDEFu, 0xB7BFu },
+    { 0xFFFFu,  2u, 14u, 0xCDEFu, 0x37BFu },
+    { 0xFFFFu,  3u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  3u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  3u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  3u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  3u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  3u,  5u, 0xCDEFu, 0xFF7Fu },
+    { 0xFFFFu,  3u,  6u, 0xCDEFu, 0xFF7Fu },
+    { 0xFFFFu,  3u,  7u, 0xCDEFu, 0xFF7Fu },
+    { 0xFFFFu,  3u,  8u, 0xCDEFu, 0xFF7Fu },
+    { 0xFFFFu,  3u,  9u, 0xCDEFu, 0xFF7Fu },
+    { 0xFFFFu,  3u, 10u, 0xCDEFu, 0xEF7Fu },
+    { 0xFFFFu,  3u, 11u, 0xCDEFu, 0xEF7Fu },
+    { 0xFFFFu,  3u, 12u, 0xCDEFu, 0xEF7Fu },
+    { 0xFFFFu,  3u, 13u, 0xCDEFu, 0x6F7Fu },
+    { 0xFFFFu,  4u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  4u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  4u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  4u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  4u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  4u,  5u, 0xCDEFu, 0xFEFFu },
+    { 0xFFFFu,  4u,  6u, 0xCDEFu, 0xFEFFu },
+    { 0xFFFFu,  4u,  7u, 0xCDEFu, 0xFEFFu },
+    { 0xFFFFu,  4u,  8u, 0xCDEFu, 0xFEFFu },
+    { 0xFFFFu,  4u,  9u, 0xCDEFu, 0xFEFFu },
+    { 0xFFFFu,  4u, 10u, 0xCDEFu, 0xDEFFu },
+    { 0xFFFFu,  4u, 11u, 0xCDEFu, 0xDEFFu },
+    { 0xFFFFu,  4u, 12u, 0xCDEFu, 0xDEFFu },
+    { 0xFFFFu,  5u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  5u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  5u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  5u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  5u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  5u,  5u, 0xCDEFu, 0xFDFFu },
+    { 0xFFFFu,  5u,  6u, 0xCDEFu, 0xFDFFu },
+    { 0xFFFFu,  5u,  7u, 0xCDEFu, 0xFDFFu },
+    { 0xFFFFu,  5u,  8u, 0xCDEFu, 0xFDFFu },
+    { 0xFFFFu,  5u,  9u, 0xCDEFu, 0xFDFFu },
+    { 0xFFFFu,  5u, 10u, 0xCDEFu, 0xBDFFu },
+    { 0xFFFFu,  5u, 11u, 0xCDEFu, 0xBDFFu },
+    { 0xFFFFu,  6u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  6u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  6u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  6u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  6u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  6u,  5u, 0xCDEFu, 0xFBFFu },
+    { 0xFFFFu,  6u,  6u, 0xCDEFu, 0xFBFFu },
+    { 0xFFFFu,  6u,  7u, 0xCDEFu, 0xFBFFu },
+    { 0xFFFFu,  6u,  8u, 0xCDEFu, 0xFBFFu },
+    { 0xFFFFu,  6u,  9u, 0xCDEFu, 0xFBFFu },
+    { 0xFFFFu,  6u, 10u, 0xCDEFu, 0x7BFFu },
+    { 0xFFFFu,  7u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  7u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  7u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  7u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  7u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  7u,  5u, 0xCDEFu, 0xF7FFu },
+    { 0xFFFFu,  7u,  6u, 0xCDEFu, 0xF7FFu },
+    { 0xFFFFu,  7u,  7u, 0xCDEFu, 0xF7FFu },
+    { 0xFFFFu,  7u,  8u, 0xCDEFu, 0xF7FFu },
+    { 0xFFFFu,  7u,  9u, 0xCDEFu, 0xF7FFu },
+    { 0xFFFFu,  8u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  8u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  8u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  8u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  8u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  8u,  5u, 0xCDEFu, 0xEFFFu },
+    { 0xFFFFu,  8u,  6u, 0xCDEFu, 0xEFFFu },
+    { 0xFFFFu,  8u,  7u, 0xCDEFu, 0xEFFFu },
+    { 0xFFFFu,  8u,  8u, 0xCDEFu, 0xEFFFu },
+    { 0xFFFFu,  9u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  9u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  9u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  9u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  9u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu,  9u,  5u, 0xCDEFu, 0xDFFFu },
+    { 0xFFFFu,  9u,  6u, 0xCDEFu, 0xDFFFu },
+    { 0xFFFFu,  9u,  7u, 0xCDEFu, 0xDFFFu },
+    { 0xFFFFu, 10u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 10u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 10u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 10u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 10u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 10u,  5u, 0xCDEFu, 0xBFFFu },
+    { 0xFFFFu, 10u,  6u, 0xCDEFu, 0xBFFFu },
+    { 0xFFFFu, 11u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 11u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 11u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 11u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 11u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 11u,  5u, 0xCDEFu, 0x7FFFu },
+    { 0xFFFFu, 12u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 12u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 12u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 12u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 12u,  4u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 13u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 13u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 13u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 13u,  3u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 14u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 14u,  1u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 14u,  2u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 15u,  0u, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 15u,  1u, 0xCDEFu, 0xFFFFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_PutBits_u16u8u8u16 vectors**
+ *
+ * The test runs the 152 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00110, SWS_Bfx_00112
+ */
+void test__Bfx_PutBits_u16u8u8u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( PutBits_u16u8u8u16 ) / sizeof( PutBits_u16u8u8u16[ 0 ] ) ); i++ )
+    {
+        uint16 Data = PutBits_u16u8u8u16[ i ].Data;
+        Bfx_PutBits_u16u8u8u16( &Data, PutBits_u16u8u8u16[ i ].BitStartPn, PutBits_u16u8u8u16[ i ].BitLn, PutBits_u16u8u8u16[ i ].Pattern );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( PutBits_u16u8u8u16[ i ].Expected, Data, Vector( "Bfx_PutBits_u16u8u8u16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint16 Mask;
+    uint16 Expected;
+} SetBitMask_u16u16[] = {
+    { 0x0000u, 0x0000u, 0x0000u },
+    { 0x0000u, 0xFFFFu, 0xFFFFu },
+    { 0x0000u, 0x5555u, 0x5555u },
+    { 0x0000u, 0xAAAAu, 0xAAAAu },
+    { 0x0000u, 0x0001u, 0x0001u },
+    { 0x0000u, 0x8000u, 0x8000u },
+    { 0x0000u, 0xCDEFu, 0xCDEFu },
+    { 0xFFFFu, 0x0000u, 0xFFFFu },
+    { 0xFFFFu, 0xFFFFu, 0xFFFFu },
+    { 0xFFFFu, 0x5555u, 0xFFFFu },
+    { 0xFFFFu, 0xAAAAu, 0xFFFFu },
+    { 0xFFFFu, 0x0001u, 0xFFFFu },
+    { 0xFFFFu, 0x8000u, 0xFFFFu },
+    { 0xFFFFu, 0xCDEFu, 0xFFFFu },
+    { 0x5555u, 0x0000u, 0x5555u },
+    { 0x5555u, 0xFFFFu, 0xFFFFu },
+    { 0x5555u, 0x5555u, 0x5555u },
+    { 0x5555u, 0xAAAAu, 0xFFFFu },
+    { 0x5555u, 0x0001u, 0x5555u },
+    { 0x5555u, 0x8000u, 0xD555u },
+    { 0x5555u, 0xCDEFu, 0xDDFFu },
+    { 0xCDEFu, 0x0000u, 0xCDEFu },
+    { 0xCDEFu, 0xFFFFu, 0xFFFFu },
+    { 0xCDEFu, 0x5555u, 0xDDFFu },
+    { 0xCDEFu, 0xAAAAu, 0xEFEFu },
+    { 0xCDEFu, 0x0001u, 0xCDEFu },
+    { 0xCDEFu, 0x8000u, 0xCDEFu },
+    { 0xCDEFu, 0xCDEFu, 0xCDEFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_SetBitMask_u16u16 vectors**
+ *
+ * The test runs the 28 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00035, SWS_Bfx_00036, SWS_Bfx_00038
+ */
+void test__Bfx_SetBitMask_u16u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( SetBitMask_u16u16 ) / sizeof( SetBitMask_u16u16[ 0 ] ) ); i++ )
+    {
+        uint16 Data = SetBitMask_u16u16[ i ].Data;
+        Bfx_SetBitMask_u16u16( &Data, SetBitMask_u16u16[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( SetBitMask_u16u16[ i ].Expected, Data, Vector( "Bfx_SetBitMask_u16u16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint16 Mask;
+    uint16 Expected;
+} ClrBitMask_u16u16[] = {
+    { 0x0000u, 0x0000u, 0x0000u },
+    { 0x0000u, 0xFFFFu, 0x0000u },
+    { 0x0000u, 0x5555u, 0x0000u },
+    { 0x0000u, 0xAAAAu, 0x0000u },
+    { 0x0000u, 0x0001u, 0x0000u },
+    { 0x0000u, 0x8000u, 0x0000u },
+    { 0x0000u, 0xCDEFu, 0x0000u },
+    { 0xFFFFu, 0x0000u, 0xFFFFu },
+    { 0xFFFFu, 0xFFFFu, 0x0000u },
+    { 0xFFFFu, 0x5555u, 0xAAAAu },
+    { 0xFFFFu, 0xAAAAu, 0x5555u },
+    { 0xFFFFu, 0x0001u, 0xFFFEu },
+    { 0xFFFFu, 0x8000u, 0x7FFFu },
+    { 0xFFFFu, 0xCDEFu, 0x3210u },
+    { 0x5555u, 0x0000u, 0x5555u },
+    { 0x5555u, 0xFFFFu, 0x0000u },
+    { 0x5555u, 0x5555u, 0x0000u },
+    { 0x5555u, 0xAAAAu, 0x5555u },
+    { 0x5555u, 0x0001u, 0x5554u },
+    { 0x5555u, 0x8000u, 0x5555u },
+    { 0x5555u, 0xCDEFu, 0x1010u },
+    { 0xCDEFu, 0x0000u, 0xCDEFu },
+    { 0xCDEFu, 0xFFFFu, 0x0000u },
+    { 0xCDEFu, 0x5555u, 0x88AAu },
+    { 0xCDEFu, 0xAAAAu, 0x4545u },
+    { 0xCDEFu, 0x0001u, 0xCDEEu },
+    { 0xCDEFu, 0x8000u, 0x4DEFu },
+    { 0xCDEFu, 0xCDEFu, 0x0000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ClrBitMask_u16u16 vectors**
+ *
+ * The test runs the 28 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00039, SWS_Bfx_00040, SWS_Bfx_00045
+ */
+void test__Bfx_ClrBitMask_u16u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ClrBitMask_u16u16 ) / sizeof( ClrBitMask_u16u16[ 0 ] ) ); i++ )
+    {
+        uint16 Data = ClrBitMask_u16u16[ i ].Data;
+        Bfx_ClrBitMask_u16u16( &Data, ClrBitMask_u16u16[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( ClrBitMask_u16u16[ i ].Expected, Data, Vector( "Bfx_ClrBitMask_u16u16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint16 Mask;
+    boolean Expected;
+} TstBitMask_u16u16_u8[] = {
+    { 0x0000u, 0x0000u,  TRUE },
+    { 0x0000u, 0xFFFFu, FALSE },
+    { 0x0000u, 0x5555u, FALSE },
+    { 0x0000u, 0xAAAAu, FALSE },
+    { 0x0000u, 0x0001u, FALSE },
+    { 0x0000u, 0x8000u, FALSE },
+    { 0x0000u, 0xCDEFu, FALSE },
+    { 0xFFFFu, 0x0000u,  TRUE },
+    { 0xFFFFu, 0xFFFFu,  TRUE },
+    { 0xFFFFu, 0x5555u,  TRUE },
+    { 0xFFFFu, 0xAAAAu,  TRUE },
+    { 0xFFFFu, 0x0001u,  TRUE },
+    { 0xFFFFu, 0x8000u,  TRUE },
+    { 0xFFFFu, 0xCDEFu,  TRUE },
+    { 0x5555u, 0x0000u,  TRUE },
+    { 0x5555u, 0xFFFFu, FALSE },
+    { 0x5555u, 0x5555u,  TRUE },
+    { 0x5555u, 0xAAAAu, FALSE },
+    { 0x5555u, 0x0001u,  TRUE },
+    { 0x5555u, 0x8000u, FALSE },
+    { 0x5555u, 0xCDEFu, FALSE },
+    { 0xCDEFu, 0x0000u,  TRUE },
+    { 0xCDEFu, 0xFFFFu, FALSE },
+    { 0xCDEFu, 0x5555u, FALSE },
+    { 0xCDEFu, 0xAAAAu, FALSE },
+    { 0xCDEFu, 0x0001u,  TRUE },
+    { 0xCDEFu, 0x8000u,  TRUE },
+    { 0xCDEFu, 0xCDEFu,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_TstBitMask_u16u16_u8 vectors**
+ *
+ * The test runs the 28 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00046, SWS_Bfx_00047, SWS_Bfx_00050
+ */
+void test__Bfx_TstBitMask_u16u16_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( TstBitMask_u16u16_u8 ) / sizeof( TstBitMask_u16u16_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( TstBitMask_u16u16_u8[ i ].Expected, Bfx_TstBitMask_u16u16_u8( TstBitMask_u16u16_u8[ i ].Data, TstBitMask_u16u16_u8[ i ].Mask ), Vector( "Bfx_TstBitMask_u16u16_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint16 Mask;
+    boolean Expected;
+} TstBitLnMask_u16u16_u8[] = {
+    { 0x0000u, 0x0000u, FALSE },
+    { 0x0000u, 0xFFFFu, FALSE },
+    { 0x0000u, 0x5555u, FALSE },
+    { 0x0000u, 0xAAAAu, FALSE },
+    { 0x0000u, 0x0001u, FALSE },
+    { 0x0000u, 0x8000u, FALSE },
+    { 0x0000u, 0xCDEFu, FALSE },
+    { 0xFFFFu, 0x0000u, FALSE },
+    { 0xFFFFu, 0xFFFFu,  TRUE },
+    { 0xFFFFu, 0x5555u,  TRUE },
+    { 0xFFFFu, 0xAAAAu,  TRUE },
+    { 0xFFFFu, 0x0001u,  TRUE },
+    { 0xFFFFu, 0x8000u,  TRUE },
+    { 0xFFFFu, 0xCDEFu,  TRUE },
+    { 0x5555u, 0x0000u, FALSE },
+    { 0x5555u, 0xFFFFu,  TRUE },
+    { 0x5555u, 0x5555u,  TRUE },
+    { 0x5555u, 0xAAAAu, FALSE },
+    { 0x5555u, 0x0001u,  TRUE },
+    { 0x5555u, 0x8000u, FALSE },
+    { 0x5555u, 0xCDEFu,  TRUE },
+    { 0xCDEFu, 0x0000u, FALSE },
+    { 0xCDEFu, 0xFFFFu,  TRUE },
+    { 0xCDEFu, 0x5555u,  TRUE },
+    { 0xCDEFu, 0xAAAAu,  TRUE },
+    { 0xCDEFu, 0x0001u,  TRUE },
+    { 0xCDEFu, 0x8000u,  TRUE },
+    { 0xCDEFu, 0xCDEFu,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_TstBitLnMask_u16u16_u8 vectors**
+ *
+ * The test runs the 28 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00051, SWS_Bfx_00055
+ */
+void test__Bfx_TstBitLnMask_u16u16_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( TstBitLnMask_u16u16_u8 ) / sizeof( TstBitLnMask_u16u16_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( TstBitLnMask_u16u16_u8[ i ].Expected, Bfx_TstBitLnMask_u16u16_u8( TstBitLnMask_u16u16_u8[ i ].Data, TstBitLnMask_u16u16_u8[ i ].Mask ), Vector( "Bfx_TstBitLnMask_u16u16_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    boolean Expected;
+} TstParityEven_u16_u8[] = {
+    { 0x8000u, FALSE },
+    { 0x8001u,  TRUE },
+    { 0x0000u,  TRUE },
+    { 0xFFFFu,  TRUE },
+    { 0x5555u,  TRUE },
+    { 0xCDEFu,  TRUE },
+    { 0x0001u, FALSE },
+    { 0x0002u, FALSE },
+    { 0x0004u, FALSE },
+    { 0x0008u, FALSE },
+    { 0x0010u, FALSE },
+    { 0x0020u, FALSE },
+    { 0x0040u, FALSE },
+    { 0x0080u, FALSE },
+    { 0x0100u, FALSE },
+    { 0x0200u, FALSE },
+    { 0x0400u, FALSE },
+    { 0x0800u, FALSE },
+    { 0x1000u, FALSE },
+    { 0x2000u, FALSE },
+    { 0x4000u, FALSE },
+    { 0x8000u, FALSE },
+    { 0x0000u,  TRUE },
+    { 0x0001u, FALSE },
+    { 0x0003u,  TRUE },
+    { 0x0007u, FALSE },
+    { 0x000Fu,  TRUE },
+    { 0x001Fu, FALSE },
+    { 0x003Fu,  TRUE },
+    { 0x007Fu, FALSE },
+    { 0x00FFu,  TRUE },
+    { 0x01FFu, FALSE },
+    { 0x03FFu,  TRUE },
+    { 0x07FFu, FALSE },
+    { 0x0FFFu,  TRUE },
+    { 0x1FFFu, FALSE },
+    { 0x3FFFu,  TRUE },
+    { 0x7FFFu, FALSE },
+    { 0xFFFFu,  TRUE },
+    { 0x0000u,  TRUE },
+    { 0x8000u, FALSE },
+    { 0xC000u,  TRUE },
+    { 0xE000u, FALSE },
+    { 0xF000u,  TRUE },
+    { 0xF800u, FALSE },
+    { 0xFC00u,  TRUE },
+    { 0xFE00u, FALSE },
+    { 0xFF00u,  TRUE },
+    { 0xFF80u, FALSE },
+    { 0xFFC0u,  TRUE },
+    { 0xFFE0u, FALSE },
+    { 0xFFF0u,  TRUE },
+    { 0xFFF8u, FALSE },
+    { 0xFFFCu,  TRUE },
+    { 0xFFFEu, FALSE },
+    { 0xFFFFu,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_TstParityEven_u16_u8 vectors**
+ *
+ * The test runs the 56 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00056, SWS_Bfx_00060
+ */
+void test__Bfx_TstParityEven_u16_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( TstParityEven_u16_u8 ) / sizeof( TstParityEven_u16_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( TstParityEven_u16_u8[ i ].Expected, Bfx_TstParityEven_u16_u8( TstParityEven_u16_u8[ i ].Data ), Vector( "Bfx_TstParityEven_u16_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint16 Expected;
+} ToggleBits_u16[] = {
+    { 0x0000u, 0xFFFFu },
+    { 0xFFFFu, 0x0000u },
+    { 0x5555u, 0xAAAAu },
+    { 0xCDEFu, 0x3210u },
+    { 0x0001u, 0xFFFEu },
+    { 0x0002u, 0xFFFDu },
+    { 0x0004u, 0xFFFBu },
+    { 0x0008u, 0xFFF7u },
+    { 0x0010u, 0xFFEFu },
+    { 0x0020u, 0xFFDFu },
+    { 0x0040u, 0xFFBFu },
+    { 0x0080u, 0xFF7Fu },
+    { 0x0100u, 0xFEFFu },
+    { 0x0200u, 0xFDFFu },
+    { 0x0400u, 0xFBFFu },
+    { 0x0800u, 0xF7FFu },
+    { 0x1000u, 0xEFFFu },
+    { 0x2000u, 0xDFFFu },
+    { 0x4000u, 0xBFFFu },
+    { 0x8000u, 0x7FFFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ToggleBits_u16 vectors**
+ *
+ * The test runs the 20 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00061, SWS_Bfx_00065
+ */
+void test__Bfx_ToggleBits_u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ToggleBits_u16 ) / sizeof( ToggleBits_u16[ 0 ] ) ); i++ )
+    {
+        uint16 Data = ToggleBits_u16[ i ].Data;
+        Bfx_ToggleBits_u16( &Data );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( ToggleBits_u16[ i ].Expected, Data, Vector( "Bfx_ToggleBits_u16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint16 Mask;
+    uint16 Expected;
+} ToggleBitMask_u16u16[] = {
+    { 0x0000u, 0x0000u, 0x0000u },
+    { 0x0000u, 0xFFFFu, 0xFFFFu },
+    { 0x0000u, 0x5555u, 0x5555u },
+    { 0x0000u, 0xAAAAu, 0xAAAAu },
+    { 0x0000u, 0x0001u, 0x0001u },
+    { 0x0000u, 0x8000u, 0x8000u },
+    { 0x0000u, 0xCDEFu, 0xCDEFu },
+    { 0xFFFFu, 0x0000u, 0xFFFFu },
+    { 0xFFFFu, 0xFFFFu, 0x0000u },
+    { 0xFFFFu, 0x5555u, 0xAAAAu },
+    { 0xFFFFu, 0xAAAAu, 0x5555u },
+    { 0xFFFFu, 0x0001u, 0xFFFEu },
+    { 0xFFFFu, 0x8000u, 0x7FFFu },
+    { 0xFFFFu, 0xCDEFu, 0x3210u },
+    { 0x5555u, 0x0000u, 0x5555u },
+    { 0x5555u, 0xFFFFu, 0xAAAAu },
+    { 0x5555u, 0x5555u, 0x0000u },
+    { 0x5555u, 0xAAAAu, 0xFFFFu },
+    { 0x5555u, 0x0001u, 0x5554u },
+    { 0x5555u, 0x8000u, 0xD555u },
+    { 0x5555u, 0xCDEFu, 0x98BAu },
+    { 0xCDEFu, 0x0000u, 0xCDEFu },
+    { 0xCDEFu, 0xFFFFu, 0x3210u },
+    { 0xCDEFu, 0x5555u, 0x98BAu },
+    { 0xCDEFu, 0xAAAAu, 0x6745u },
+    { 0xCDEFu, 0x0001u, 0xCDEEu },
+    { 0xCDEFu, 0x8000u, 0x4DEFu },
+    { 0xCDEFu, 0xCDEFu, 0x0000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ToggleBitMask_u16u16 vectors**
+ *
+ * The test runs the 28 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00066, SWS_Bfx_00069
+ */
+void test__Bfx_ToggleBitMask_u16u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ToggleBitMask_u16u16 ) / sizeof( ToggleBitMask_u16u16[ 0 ] ) ); i++ )
+    {
+        uint16 Data = ToggleBitMask_u16u16[ i ].Data;
+        Bfx_ToggleBitMask_u16u16( &Data, ToggleBitMask_u16u16[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( ToggleBitMask_u16u16[ i ].Expected, Data, Vector( "Bfx_ToggleBitMask_u16u16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 ShiftCnt;
+    uint16 Expected;
+} ShiftBitRt_u16u8[] = {
+    { 0xFFFFu,  0u, 0xFFFFu },
+    { 0xFFFFu,  1u, 0x7FFFu },
+    { 0xFFFFu,  2u, 0x3FFFu },
+    { 0xFFFFu,  3u, 0x1FFFu },
+    { 0xFFFFu,  4u, 0x0FFFu },
+    { 0xFFFFu,  5u, 0x07FFu },
+    { 0xFFFFu,  6u, 0x03FFu },
+    { 0xFFFFu,  7u, 0x01FFu },
+    { 0xFFFFu,  8u, 0x00FFu },
+    { 0xFFFFu,  9u, 0x007Fu },
+    { 0xFFFFu, 10u, 0x003Fu },
+    { 0xFFFFu, 11u, 0x001Fu },
+    { 0xFFFFu, 12u, 0x000Fu },
+    { 0xFFFFu, 13u, 0x0007u },
+    { 0xFFFFu, 14u, 0x0003u },
+    { 0xFFFFu, 15u, 0x0001u },
+    { 0xCDEFu,  0u, 0xCDEFu },
+    { 0xCDEFu,  1u, 0x66F7u },
+    { 0xCDEFu,  2u, 0x337Bu },
+    { 0xCDEFu,  3u, 0x19BDu },
+    { 0xCDEFu,  4u, 0x0CDEu },
+    { 0xCDEFu,  5u, 0x066Fu },
+    { 0xCDEFu,  6u, 0x0337u },
+    { 0xCDEFu,  7u, 0x019Bu },
+    { 0xCDEFu,  8u, 0x00CDu },
+    { 0xCDEFu,  9u, 0x0066u },
+    { 0xCDEFu, 10u, 0x0033u },
+    { 0xCDEFu, 11u, 0x0019u },
+    { 0xCDEFu, 12u, 0x000Cu },
+    { 0xCDEFu, 13u, 0x0006u },
+    { 0xCDEFu, 14u, 0x0003u },
+    { 0xCDEFu, 15u, 0x0001u },
+    { 0x0001u,  0u, 0x0001u },
+    { 0x0001u,  1u, 0x0000u },
+    { 0x0001u,  2u, 0x0000u },
+    { 0x0001u,  3u, 0x0000u },
+    { 0x0001u,  4u, 0x0000u },
+    { 0x0001u,  5u, 0x0000u },
+    { 0x0001u,  6u, 0x0000u },
+    { 0x0001u,  7u, 0x0000u },
+    { 0x0001u,  8u, 0x0000u },
+    { 0x0001u,  9u, 0x0000u },
+    { 0x0001u, 10u, 0x0000u },
+    { 0x0001u, 11u, 0x0000u },
+    { 0x0001u, 12u, 0x0000u },
+    { 0x0001u, 13u, 0x0000u },
+    { 0x0001u, 14u, 0x0000u },
+    { 0x0001u, 15u, 0x0000u },
+    { 0x8000u,  0u, 0x8000u },
+    { 0x8000u,  1u, 0x4000u },
+    { 0x8000u,  2u, 0x2000u },
+    { 0x8000u,  3u, 0x1000u },
+    { 0x8000u,  4u, 0x0800u },
+    { 0x8000u,  5u, 0x0400u },
+    { 0x8000u,  6u, 0x0200u },
+    { 0x8000u,  7u, 0x0100u },
+    { 0x8000u,  8u, 0x0080u },
+    { 0x8000u,  9u, 0x0040u },
+    { 0x8000u, 10u, 0x0020u },
+    { 0x8000u, 11u, 0x0010u },
+    { 0x8000u, 12u, 0x0008u },
+    { 0x8000u, 13u, 0x0004u },
+    { 0x8000u, 14u, 0x0002u },
+    { 0x8000u, 15u, 0x0001u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitRt_u16u8 vectors**
+ *
+ * The test runs the 64 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00070, SWS_Bfx_00075
+ */
+void test__Bfx_ShiftBitRt_u16u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitRt_u16u8 ) / sizeof( ShiftBitRt_u16u8[ 0 ] ) ); i++ )
+    {
+        uint16 Data = ShiftBitRt_u16u8[ i ].Data;
+        Bfx_ShiftBitRt_u16u8( &Data, ShiftBitRt_u16u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( ShiftBitRt_u16u8[ i ].Expected, Data, Vector( "Bfx_ShiftBitRt_u16u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 ShiftCnt;
+    uint16 Expected;
+} ShiftBitLt_u16u8[] = {
+    { 0xFFFFu,  0u, 0xFFFFu },
+    { 0xFFFFu,  1u, 0xFFFEu },
+    { 0xFFFFu,  2u, 0xFFFCu },
+    { 0xFFFFu,  3u, 0xFFF8u },
+    { 0xFFFFu,  4u, 0xFFF0u },
+    { 0xFFFFu,  5u, 0xFFE0u },
+    { 0xFFFFu,  6u, 0xFFC0u },
+    { 0xFFFFu,  7u, 0xFF80u },
+    { 0xFFFFu,  8u, 0xFF00u },
+    { 0xFFFFu,  9u, 0xFE00u },
+    { 0xFFFFu, 10u, 0xFC00u },
+    { 0xFFFFu, 11u, 0xF800u },
+    { 0xFFFFu, 12u, 0xF000u },
+    { 0xFFFFu, 13u, 0xE000u },
+    { 0xFFFFu, 14u, 0xC000u },
+    { 0xFFFFu, 15u, 0x8000u },
+    { 0xCDEFu,  0u, 0xCDEFu },
+    { 0xCDEFu,  1u, 0x9BDEu },
+    { 0xCDEFu,  2u, 0x37BCu },
+    { 0xCDEFu,  3u, 0x6F78u },
+    { 0xCDEFu,  4u, 0xDEF0u },
+    { 0xCDEFu,  5u, 0xBDE0u },
+    { 0xCDEFu,  6u, 0x7BC0u },
+    { 0xCDEFu,  7u, 0xF780u },
+    { 0xCDEFu,  8u, 0xEF00u },
+    { 0xCDEFu,  9u, 0xDE00u },
+    { 0xCDEFu, 10u, 0xBC00u },
+    { 0xCDEFu, 11u, 0x7800u },
+    { 0xCDEFu, 12u, 0xF000u },
+    { 0xCDEFu, 13u, 0xE000u },
+    { 0xCDEFu, 14u, 0xC000u },
+    { 0xCDEFu, 15u, 0x8000u },
+    { 0x0001u,  0u, 0x0001u },
+    { 0x0001u,  1u, 0x0002u },
+    { 0x0001u,  2u, 0x0004u },
+    { 0x0001u,  3u, 0x0008u },
+    { 0x0001u,  4u, 0x0010u },
+    { 0x0001u,  5u, 0x0020u },
+    { 0x0001u,  6u, 0x0040u },
+    { 0x0001u,  7u, 0x0080u },
+    { 0x0001u,  8u, 0x0100u },
+    { 0x0001u,  9u, 0x0200u },
+    { 0x0001u, 10u, 0x0400u },
+    { 0x0001u, 11u, 0x0800u },
+    { 0x0001u, 12u, 0x1000u },
+    { 0x0001u, 13u, 0x2000u },
+    { 0x0001u, 14u, 0x4000u },
+    { 0x0001u, 15u, 0x8000u },
+    { 0x8000u,  0u, 0x8000u },
+    { 0x8000u,  1u, 0x0000u },
+    { 0x8000u,  2u, 0x0000u },
+    { 0x8000u,  3u, 0x0000u },
+    { 0x8000u,  4u, 0x0000u },
+    { 0x8000u,  5u, 0x0000u },
+    { 0x8000u,  6u, 0x0000u },
+    { 0x8000u,  7u, 0x0000u },
+    { 0x8000u,  8u, 0x0000u },
+    { 0x8000u,  9u, 0x0000u },
+    { 0x8000u, 10u, 0x0000u },
+    { 0x8000u, 11u, 0x0000u },
+    { 0x8000u, 12u, 0x0000u },
+    { 0x8000u, 13u, 0x0000u },
+    { 0x8000u, 14u, 0x0000u },
+    { 0x8000u, 15u, 0x0000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitLt_u16u8 vectors**
+ *
+ * The test runs the 64 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00076, SWS_Bfx_00080
+ */
+void test__Bfx_ShiftBitLt_u16u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitLt_u16u8 ) / sizeof( ShiftBitLt_u16u8[ 0 ] ) ); i++ )
+    {
+        uint16 Data = ShiftBitLt_u16u8[ i ].Data;
+        Bfx_ShiftBitLt_u16u8( &Data, ShiftBitLt_u16u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( ShiftBitLt_u16u8[ i ].Expected, Data, Vector( "Bfx_ShiftBitLt_u16u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 ShiftCnt;
+    uint16 Expected;
+} RotBitRt_u16u8[] = {
+    { 0x8000u,  0u, 0x8000u },
+    { 0xFFFFu,  0u, 0xFFFFu },
+    { 0xFFFFu,  1u, 0xFFFFu },
+    { 0xFFFFu,  2u, 0xFFFFu },
+    { 0xFFFFu,  3u, 0xFFFFu },
+    { 0xFFFFu,  4u, 0xFFFFu },
+    { 0xFFFFu,  5u, 0xFFFFu },
+    { 0xFFFFu,  6u, 0xFFFFu },
+    { 0xFFFFu,  7u, 0xFFFFu },
+    { 0xFFFFu,  8u, 0xFFFFu },
+    { 0xFFFFu,  9u, 0xFFFFu },
+    { 0xFFFFu, 10u, 0xFFFFu },
+    { 0xFFFFu, 11u, 0xFFFFu },
+    { 0xFFFFu, 12u, 0xFFFFu },
+    { 0xFFFFu, 13u, 0xFFFFu },
+    { 0xFFFFu, 14u, 0xFFFFu },
+    { 0xFFFFu, 15u, 0xFFFFu },
+    { 0xCDEFu,  0u, 0xCDEFu },
+    { 0xCDEFu,  1u, 0xE6F7u },
+    { 0xCDEFu,  2u, 0xF37Bu },
+    { 0xCDEFu,  3u, 0xF9BDu },
+    { 0xCDEFu,  4u, 0xFCDEu },
+    { 0xCDEFu,  5u, 0x7E6Fu },
+    { 0xCDEFu,  6u, 0xBF37u },
+    { 0xCDEFu,  7u, 0xDF9Bu },
+    { 0xCDEFu,  8u, 0xEFCDu },
+    { 0xCDEFu,  9u, 0xF7E6u },
+    { 0xCDEFu, 10u, 0x7BF3u },
+    { 0xCDEFu, 11u, 0xBDF9u },
+    { 0xCDEFu, 12u, 0xDEFCu },
+    { 0xCDEFu, 13u, 0x6F7Eu },
+    { 0xCDEFu, 14u, 0x37BFu },
+    { 0xCDEFu, 15u, 0x9BDFu },
+    { 0x0001u,  0u, 0x0001u },
+    { 0x0001u,  1u, 0x8000u },
+    { 0x0001u,  2u, 0x4000u },
+    { 0x0001u,  3u, 0x2000u },
+    { 0x0001u,  4u, 0x1000u },
+    { 0x0001u,  5u, 0x0800u },
+    { 0x0001u,  6u, 0x0400u },
+    { 0x0001u,  7u, 0x0200u },
+    { 0x0001u,  8u, 0x0100u },
+    { 0x0001u,  9u, 0x0080u },
+    { 0x0001u, 10u, 0x0040u },
+    { 0x0001u, 11u, 0x0020u },
+    { 0x0001u, 12u, 0x0010u },
+    { 0x0001u, 13u, 0x0008u },
+    { 0x0001u, 14u, 0x0004u },
+    { 0x0001u, 15u, 0x0002u },
+    { 0x8000u,  0u, 0x8000u },
+    { 0x8000u,  1u, 0x4000u },
+    { 0x8000u,  2u, 0x2000u },
+    { 0x8000u,  3u, 0x1000u },
+    { 0x8000u,  4u, 0x0800u },
+    { 0x8000u,  5u, 0x0400u },
+    { 0x8000u,  6u, 0x0200u },
+    { 0x8000u,  7u, 0x0100u },
+    { 0x8000u,  8u, 0x0080u },
+    { 0x8000u,  9u, 0x0040u },
+    { 0x8000u, 10u, 0x0020u },
+    { 0x8000u, 11u, 0x0010u },
+    { 0x8000u, 12u, 0x0008u },
+    { 0x8000u, 13u, 0x0004u },
+    { 0x8000u, 14u, 0x0002u },
+    { 0x8000u, 15u, 0x0001u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_RotBitRt_u16u8 vectors**
+ *
+ * The test runs the 65 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00086, SWS_Bfx_00090
+ */
+void test__Bfx_RotBitRt_u16u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( RotBitRt_u16u8 ) / sizeof( RotBitRt_u16u8[ 0 ] ) ); i++ )
+    {
+        uint16 Data = RotBitRt_u16u8[ i ].Data;
+        Bfx_RotBitRt_u16u8( &Data, RotBitRt_u16u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( RotBitRt_u16u8[ i ].Expected, Data, Vector( "Bfx_RotBitRt_u16u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 ShiftCnt;
+    uint16 Expected;
+} RotBitLt_u16u8[] = {
+    { 0x8000u,  0u, 0x8000u },
+    { 0xFFFFu,  0u, 0xFFFFu },
+    { 0xFFFFu,  1u, 0xFFFFu },
+    { 0xFFFFu,  2u, 0xFFFFu },
+    { 0xFFFFu,  3u, 0xFFFFu },
+    { 0xFFFFu,  4u, 0xFFFFu },
+    { 0xFFFFu,  5u, 0xFFFFu },
+    { 0xFFFFu,  6u, 0xFFFFu },
+    { 0xFFFFu,  7u, 0xFFFFu },
+    { 0xFFFFu,  8u, 0xFFFFu },
+    { 0xFFFFu,  9u, 0xFFFFu },
+    { 0xFFFFu, 10u, 0xFFFFu },
+    { 0xFFFFu, 11u, 0xFFFFu },
+    { 0xFFFFu, 12u, 0xFFFFu },
+    { 0xFFFFu, 13u, 0xFFFFu },
+    { 0xFFFFu, 14u, 0xFFFFu },
+    { 0xFFFFu, 15u, 0xFFFFu },
+    { 0xCDEFu,  0u, 0xCDEFu },
+    { 0xCDEFu,  1u, 0x9BDFu },
+    { 0xCDEFu,  2u, 0x37BFu },
+    { 0xCDEFu,  3u, 0x6F7Eu },
+    { 0xCDEFu,  4u, 0xDEFCu },
+    { 0xCDEFu,  5u, 0xBDF9u },
+    { 0xCDEFu,  6u, 0x7BF3u },
+    { 0xCDEFu,  7u, 0xF7E6u },
+    { 0xCDEFu,  8u, 0xEFCDu },
+    { 0xCDEFu,  9u, 0xDF9Bu },
+    { 0xCDEFu, 10u, 0xBF37u },
+    { 0xCDEFu, 11u, 0x7E6Fu },
+    { 0xCDEFu, 12u, 0xFCDEu },
+    { 0xCDEFu, 13u, 0xF9BDu },
+    { 0xCDEFu, 14u, 0xF37Bu },
+    { 0xCDEFu, 15u, 0xE6F7u },
+    { 0x0001u,  0u, 0x0001u },
+    { 0x0001u,  1u, 0x0002u },
+    { 0x0001u,  2u, 0x0004u },
+    { 0x0001u,  3u, 0x0008u },
+    { 0x0001u,  4u, 0x0010u },
+    { 0x0001u,  5u, 0x0020u },
+    { 0x0001u,  6u, 0x0040u },
+    { 0x0001u,  7u, 0x0080u },
+    { 0x0001u,  8u, 0x0100u },
+    { 0x0001u,  9u, 0x0200u },
+    { 0x0001u, 10u, 0x0400u },
+    { 0x0001u, 11u, 0x0800u },
+    { 0x0001u, 12u, 0x1000u },
+    { 0x0001u, 13u, 0x2000u },
+    { 0x0001u, 14u, 0x4000u },
+    { 0x0001u, 15u, 0x8000u },
+    { 0x8000u,  0u, 0x8000u },
+    { 0x8000u,  1u, 0x0001u },
+    { 0x8000u,  2u, 0x0002u },
+    { 0x8000u,  3u, 0x0004u },
+    { 0x8000u,  4u, 0x0008u },
+    { 0x8000u,  5u, 0x0010u },
+    { 0x8000u,  6u, 0x0020u },
+    { 0x8000u,  7u, 0x0040u },
+    { 0x8000u,  8u, 0x0080u },
+    { 0x8000u,  9u, 0x0100u },
+    { 0x8000u, 10u, 0x0200u },
+    { 0x8000u, 11u, 0x0400u },
+    { 0x8000u, 12u, 0x0800u },
+    { 0x8000u, 13u, 0x1000u },
+    { 0x8000u, 14u, 0x2000u },
+    { 0x8000u, 15u, 0x4000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_RotBitLt_u16u8 vectors**
+ *
+ * The test runs the 65 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00095, SWS_Bfx_00098
+ */
+void test__Bfx_RotBitLt_u16u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( RotBitLt_u16u8 ) / sizeof( RotBitLt_u16u8[ 0 ] ) ); i++ )
+    {
+        uint16 Data = RotBitLt_u16u8[ i ].Data;
+        Bfx_RotBitLt_u16u8( &Data, RotBitLt_u16u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( RotBitLt_u16u8[ i ].Expected, Data, Vector( "Bfx_RotBitLt_u16u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 DestinationData;
+    uint8 DestinationPosition;
+    uint16 SourceData;
+    uint8 SourcePosition;
+    uint16 Expected;
+} CopyBit_u16u8u16u8[] = {
+    { 0xAAAAu,  0u, 0x5555u,  0u, 0xAAABu },
+    { 0xAAAAu,  0u, 0x5555u,  1u, 0xAAAAu },
+    { 0xAAAAu,  0u, 0x5555u,  2u, 0xAAABu },
+    { 0xAAAAu,  0u, 0x5555u,  3u, 0xAAAAu },
+    { 0xAAAAu,  0u, 0x5555u,  4u, 0xAAABu },
+    { 0xAAAAu,  0u, 0x5555u,  5u, 0xAAAAu },
+    { 0xAAAAu,  0u, 0x5555u,  6u, 0xAAABu },
+    { 0xAAAAu,  0u, 0x5555u,  7u, 0xAAAAu },
+    { 0xAAAAu,  0u, 0x5555u,  8u, 0xAAABu },
+    { 0xAAAAu,  0u, 0x5555u,  9u, 0xAAAAu },
+    { 0xAAAAu,  0u, 0x5555u, 10u, 0xAAABu },
+    { 0xAAAAu,  0u, 0x5555u, 11u, 0xAAAAu },
+    { 0xAAAAu,  0u, 0x5555u, 12u, 0xAAABu },
+    { 0xAAAAu,  0u, 0x5555u, 13u, 0xAAAAu },
+    { 0xAAAAu,  0u, 0x5555u, 14u, 0xAAABu },
+    { 0xAAAAu,  0u, 0x5555u, 15u, 0xAAAAu },
+    { 0xAAAAu,  1u, 0x5555u,  0u, 0xAAAAu },
+    { 0xAAAAu,  1u, 0x5555u,  1u, 0xAAA8u },
+    { 0xAAAAu,  1u, 0x5555u,  2u, 0xAAAAu },
+    { 0xAAAAu,  1u, 0x5555u,  3u, 0xAAA8u },
+    { 0xAAAAu,  1u, 0x5555u,  4u, 0xAAAAu },
+    { 0xAAAAu,  1u, 0x5555u,  5u, 0xAAA8u },
+    { 0xAAAAu,  1u, 0x5555u,  6u, 0xAAAAu },
+    { 0xAAAAu,  1u, 0x5555u,  7u, 0xAAA8u },
+    { 0xAAAAu,  1u, 0x5555u,  8u, 0xAAAAu },
+    { 0xAAAAu,  1u, 0x5555u,  9u, 0xAAA8u },
+    { 0xAAAAu,  1u, 0x5555u, 10u, 0xAAAAu },
+    { 0xAAAAu,  1u, 0x5555u, 11u, 0xAAA8u },
+    { 0xAAAAu,  1u, 0x5555u, 12u, 0xAAAAu },
+    { 0xAAAAu,  1u, 0x5555u, 13u, 0xAAA8u },
+    { 0xAAAAu,  1u, 0x5555u, 14u, 0xAAAAu },
+    { 0xAAAAu,  1u, 0x5555u, 15u, 0xAAA8u },
+    { 0xAAAAu,  2u, 0x5555u,  0u, 0xAAAEu },
+    { 0xAAAAu,  2u, 0x5555u,  1u, 0xAAAAu },
+    { 0xAAAAu,  2u, 0x5555u,  2u, 0xAAAEu },
+    { 0xAAAAu,  2u, 0x5555u,  3u, 0xAAAAu },
+    { 0xAAAAu,  2u, 0x5555u,  4u, 0xAAAEu },
+    { 0xAAAAu,  2u, 0x5555u,  5u, 0xAAAAu },
+    { 0xAAAAu,  2u, 0x5555u,  6u, 0xAAAEu },
+    { 0xAAAAu,  2u, 0x5555u,  7u, 0xAAAAu },
+    { 0xAAAAu,  2u, 0x5555u,  8u, 0xAAAEu },
+    { 0xAAAAu,  2u, 0x5555u,  9u, 0xAAAAu },
+    { 0xAAAAu,  2u, 0x5555u, 10u, 0xAAAEu },
+    { 0xAAAAu,  2u, 0x5555u, 11u, 0xAAAAu },
+    { 0xAAAAu,  2u, 0x5555u, 12u, 0xAAAEu },
+    { 0xAAAAu,  2u, 0x5555u, 13u, 0xAAAAu },
+    { 0xAAAAu,  2u, 0x5555u, 14u, 0xAAAEu },
+    { 0xAAAAu,  2u, 0x5555u, 15u, 0xAAAAu },
+    { 0xAAAAu,  3u, 0x5555u,  0u, 0xAAAAu },
+    { 0xAAAAu,  3u, 0x5555u,  1u, 0xAAA2u },
+    { 0xAAAAu,  3u, 0x5555u,  2u, 0xAAAAu },
+    { 0xAAAAu,  3u, 0x5555u,  3u, 0xAAA2u },
+    { 0xAAAAu,  3u, 0x5555u,  4u, 0xAAAAu },
+    { 0xAAAAu,  3u, 0x5555u,  5u, 0xAAA2u },
+    { 0xAAAAu,  3u, 0x5555u,  6u, 0xAAAAu },
+    { 0xAAAAu,  3u, 0x5555u,  7u, 0xAAA2u },
+    { 0xAAAAu,  3u, 0x5555u,  8u, 0xAAAAu },
+    { 0xAAAAu,  3u, 0x5555u,  9u, 0xAAA2u },
+    { 0xAAAAu,  3u, 0x5555u, 10u, 0xAAAAu },
+    { 0xAAAAu,  3u, 0x5555u, 11u, 0xAAA2u },
+    { 0xAAAAu,  3u, 0x5555u, 12u, 0xAAAAu },
+    { 0xAAAAu,  3u, 0x5555u, 13u, 0xAAA2u },
+    { 0xAAAAu,  3u, 0x5555u, 14u, 0xAAAAu },
+    { 0xAAAAu,  3u, 0x5555u, 15u, 0xAAA2u },
+    { 0xAAAAu,  4u, 0x5555u,  0u, 0xAABAu },
+    { 0xAAAAu,  4u, 0x5555u,  1u, 0xAAAAu },
+    { 0xAAAAu,  4u, 0x5555u,  2u, 0xAABAu },
+    { 0xAAAAu,  4u, 0x5555u,  3u, 0xAAAAu },
+    { 0xAAAAu,  4u, 0x5555u,  4u, 0xAABAu },
+    { 0xAAAAu,  4u, 0x5555u,  5u, 0xAAAAu },
+    { 0xAAAAu,  4u, 0x5555u,  6u, 0xAABAu },
+    { 0xAAAAu,  4u, 0x5555u,  7u, 0xAAAAu },
+    { 0xAAAAu,  4u, 0x5555u,  8u, 0xAABAu },
+    { 0xAAAAu,  4u, 0x5555u,  9u, 0xAAAAu },
+    { 0xAAAAu,  4u, 0x5555u, 10u, 0xAABAu },
+    { 0xAAAAu,  4u, 0x5555u, 11u, 0xAAAAu },
+    { 0xAAAAu,  4u, 0x5555u, 12u, 0xAABAu },
+    { 0xAAAAu,  4u, 0x5555u, 13u, 0xAAAAu },
+    { 0xAAAAu,  4u, 0x5555u, 14u, 0xAABAu },
+    { 0xAAAAu,  4u, 0x5555u, 15u, 0xAAAAu },
+    { 0xAAAAu,  5u, 0x5555u,  0u, 0xAAAAu },
+    { 0xAAAAu,  5u, 0x5555u,  1u, 0xAA8Au },
+    { 0xAAAAu,  5u, 0x5555u,  2u, 0xAAAAu },
+    { 0xAAAAu,  5u, 0x5555u,  3u, 0xAA8Au },
+    { 0xAAAAu,  5u, 0x5555u,  4u, 0xAAAAu },
+    { 0xAAAAu,  5u, 0x5555u,  5u, 0xAA8Au },
+    { 0xAAAAu,  5u, 0x5555u,  6u, 0xAAAAu },
+    { 0xAAAAu,  5u, 0x5555u,  7u, 0xAA8Au },
+    { 0xAAAAu,  5u, 0x5555u,  8u, 0xAAAAu },
+    { 0xAAAAu,  5u, 0x5555u,  9u, 0xAA8Au },
+    { 0xAAAAu,  5u, 0x5555u, 10u, 0xAAAAu },
+    { 0xAAAAu,  5u, 0x5555u, 11u, 0xAA8Au },
+    { 0xAAAAu,  5u, 0x5555u, 12u, 0xAAAAu },
+    { 0xAAAAu,  5u, 0x5555u, 13u, 0xAA8Au },
+    { 0xAAAAu,  5u, 0x5555u, 14u, 0xAAAAu },
+    { 0xAAAAu,  5u, 0x5555u, 15u, 0xAA8Au },
+    { 0xAAAAu,  6u, 0x5555u,  0u, 0xAAEAu },
+    { 0xAAAAu,  6u, 0x5555u,  1u, 0xAAAAu },
+    { 0xAAAAu,  6u, 0x5555u,  2u, 0xAAEAu },
+    { 0xAAAAu,  6u, 0x5555u,  3u, 0xAAAAu },
+    { 0xAAAAu,  6u, 0x5555u,  4u, 0xAAEAu },
+    { 0xAAAAu,  6u, 0x5555u,  5u, 0xAAAAu },
+    { 0xAAAAu,  6u, 0x5555u,  6u, 0xAAEAu },
+    { 0xAAAAu,  6u, 0x5555u,  7u, 0xAAAAu },
+    { 0xAAAAu,  6u, 0x5555u,  8u, 0xAAEAu },
+    { 0xAAAAu,  6u, 0x5555u,  9u, 0xAAAAu },
+    { 0xAAAAu,  6u, 0x5555u, 10u, 0xAAEAu },
+    { 0xAAAAu,  6u, 0x5555u, 11u, 0xAAAAu },
+    { 0xAAAAu,  6u, 0x5555u, 12u, 0xAAEAu },
+    { 0xAAAAu,  6u, 0x5555u, 13u, 0xAAAAu },
+    { 0xAAAAu,  6u, 0x5555u, 14u, 0xAAEAu },
+    { 0xAAAAu,  6u, 0x5555u, 15u, 0xAAAAu },
+    { 0xAAAAu,  7u, 0x5555u,  0u, 0xAAAAu },
+    { 0xAAAAu,  7u, 0x5555u,  1u, 0xAA2Au },
+    { 0xAAAAu,  7u, 0x5555u,  2u, 0xAAAAu },
+    { 0xAAAAu,  7u, 0x5555u,  3u, 0xAA2Au },
+    { 0xAAAAu,  7u, 0x5555u,  4u, 0xAAAAu },
+    { 0xAAAAu,  7u, 0x5555u,  5u, 0xAA2Au },
+    { 0xAAAAu,  7u, 0x5555u,  6u, 0xAAAAu },
+    { 0xAAAAu,  7u, 0x5555u,  7u, 0xAA2Au },
+    { 0xAAAAu,  7u, 0x5555u,  8u, 0xAAAAu },
+    { 0xAAAAu,  7u, 0x5555u,  9u, 0xAA2Au },
+    { 0xAAAAu,  7u, 0x5555u, 10u, 0xAAAAu },
+    { 0xAAAAu,  7u, 0x5555u, 11u, 0xAA2Au },
+    { 0xAAAAu,  7u, 0x5555u, 12u, 0xAAAAu },
+    { 0xAAAAu,  7u, 0x5555u, 13u, 0xAA2Au },
+    { 0xAAAAu,  7u, 0x5555u, 14u, 0xAAAAu },
+    { 0xAAAAu,  7u, 0x5555u, 15u, 0xAA2Au },
+    { 0xAAAAu,  8u, 0x5555u,  0u, 0xABAAu },
+    { 0xAAAAu,  8u, 0x5555u,  1u, 0xAAAAu },
+    { 0xAAAAu,  8u, 0x5555u,  2u, 0xABAAu },
+    { 0xAAAAu,  8u, 0x5555u,  3u, 0xAAAAu },
+    { 0xAAAAu,  8u, 0x5555u,  4u, 0xABAAu },
+    { 0xAAAAu,  8u, 0x5555u,  5u, 0xAAAAu },
+    { 0xAAAAu,  8u, 0x5555u,  6u, 0xABAAu },
+    { 0xAAAAu,  8u, 0x5555u,  7u, 0xAAAAu },
+    { 0xAAAAu,  8u, 0x5555u,  8u, 0xABAAu },
+    { 0xAAAAu,  8u, 0x5555u,  9u, 0xAAAAu },
+    { 0xAAAAu,  8u, 0x5555u, 10u, 0xABAAu },
+    { 0xAAAAu,  8u, 0x5555u, 11u, 0xAAAAu },
+    { 0xAAAAu,  8u, 0x5555u, 12u, 0xABAAu },
+    { 0xAAAAu,  8u, 0x5555u, 13u, 0xAAAAu },
+    { 0xAAAAu,  8u, 0x5555u, 14u, 0xABAAu },
+    { 0xAAAAu,  8u, 0x5555u, 15u, 0xAAAAu },
+    { 0xAAAAu,  9u, 0x5555u,  0u, 0xAAAAu },
+    { 0xAAAAu,  9u, 0x5555u,  1u, 0xA8AAu },
+    { 0xAAAAu,  9u, 0x5555u,  2u, 0xAAAAu },
+    { 0xAAAAu,  9u, 0x5555u,  3u, 0xA8AAu },
+    { 0xAAAAu,  9u, 0x5555u,  4u, 0xAAAAu },
+    { 0xAAAAu,  9u, 0x5555u,  5u, 0xA8AAu },
+    { 0xAAAAu,  9u, 0x5555u,  6u, 0xAAAAu },
+    { 0xAAAAu,  9u, 0x5555u,  7u, 0xA8AAu },
+    { 0xAAAAu,  9u, 0x5555u,  8u, 0xAAAAu },
+    { 0xAAAAu,  9u, 0x5555u,  9u, 0xA8AAu },
+    { 0xAAAAu,  9u, 0x5555u, 10u, 0xAAAAu },
+    { 0xAAAAu,  9u, 0x5555u, 11u, 0xA8AAu },
+    { 0xAAAAu,  9u, 0x5555u, 12u, 0xAAAAu },
+    { 0xAAAAu,  9u, 0x5555u, 13u, 0xA8AAu },
+    { 0xAAAAu,  9u, 0x5555u, 14u, 0xAAAAu },
+    { 0xAAAAu,  9u, 0x5555u, 15u, 0xA8AAu },
+    { 0xAAAAu, 10u, 0x5555u,  0u, 0xAEAAu },
+    { 0xAAAAu, 10u, 0x5555u,  1u, 0xAAAAu },
+    { 0xAAAAu, 10u, 0x5555u,  2u, 0xAEAAu },
+    { 0xAAAAu, 10u, 0x5555u,  3u, 0xAAAAu },
+    { 0xAAAAu, 10u, 0x5555u,  4u, 0xAEAAu },
+    { 0xAAAAu, 10u, 0x5555u,  5u, 0xAAAAu },
+    { 0xAAAAu, 10u, 0x5555u,  6u, 0xAEAAu },
+    { 0xAAAAu, 10u, 0x5555u,  7u, 0xAAAAu },
+    { 0xAAAAu, 10u, 0x5555u,  8u, 0xAEAAu },
+    { 0xAAAAu, 10u, 0x5555u,  9u, 0xAAAAu },
+    { 0xAAAAu, 10u, 0x5555u, 10u, 0xAEAAu },
+    { 0xAAAAu, 10u, 0x5555u, 11u, 0xAAAAu },
+    { 0xAAAAu, 10u, 0x5555u, 12u, 0xAEAAu },
+    { 0xAAAAu, 10u, 0x5555u, 13u, 0xAAAAu },
+    { 0xAAAAu, 10u, 0x5555u, 14u, 0xAEAAu },
+    { 0xAAAAu, 10u, 0x5555u, 15u, 0xAAAAu },
+    { 0xAAAAu, 11u, 0x5555u,  0u, 0xAAAAu },
+    { 0xAAAAu, 11u, 0x5555u,  1u, 0xA2AAu },
+    { 0xAAAAu, 11u, 0x5555u,  2u, 0xAAAAu },
+    { 0xAAAAu, 11u, 0x5555u,  3u, 0xA2AAu },
+    { 0xAAAAu, 11u, 0x5555u,  4u, 0xAAAAu },
+    { 0xAAAAu, 11u, 0x5555u,  5u, 0xA2AAu },
+    { 0xAAAAu, 11u, 0x5555u,  6u, 0xAAAAu },
+    { 0xAAAAu, 11u, 0x5555u,  7u, 0xA2AAu },
+    { 0xAAAAu, 11u, 0x5555u,  8u, 0xAAAAu },
+    { 0xAAAAu, 11u, 0x5555u,  9u, 0xA2AAu },
+    { 0xAAAAu, 11u, 0x5555u, 10u, 0xAAAAu },
+    { 0xAAAAu, 11u, 0x5555u, 11u, 0xA2AAu },
+    { 0xAAAAu, 11u, 0x5555u, 12u, 0xAAAAu },
+    { 0xAAAAu, 11u, 0x5555u, 13u, 0xA2AAu },
+    { 0xAAAAu, 11u, 0x5555u, 14u, 0xAAAAu },
+    { 0xAAAAu, 11u, 0x5555u, 15u, 0xA2AAu },
+    { 0xAAAAu, 12u, 0x5555u,  0u, 0xBAAAu },
+    { 0xAAAAu, 12u, 0x5555u,  1u, 0xAAAAu },
+    { 0xAAAAu, 12u, 0x5555u,  2u, 0xBAAAu },
+    { 0xAAAAu, 12u, 0x5555u,  3u, 0xAAAAu },
+    { 0xAAAAu, 12u, 0x5555u,  4u, 0xBAAAu },
+    { 0xAAAAu, 12u, 0x5555u,  5u, 0xAAAAu },
+    { 0xAAAAu, 12u, 0x5555u,  6u, 0xBAAAu },
+    { 0xAAAAu, 12u, 0x5555u,  7u, 0xAAAAu },
+    { 0xAAAAu, 12u, 0x5555u,  8u, 0xBAAAu },
+    { 0xAAAAu, 12u, 0x5555u,  9u, 0xAAAAu },
+    { 0xAAAAu, 12u, 0x5555u, 10u, 0xBAAAu },
+    { 0xAAAAu, 12u, 0x5555u, 11u, 0xAAAAu },
+    { 0xAAAAu, 12u, 0x5555u, 12u, 0xBAAAu },
+    { 0xAAAAu, 12u, 0x5555u, 13u, 0xAAAAu },
+    { 0xAAAAu, 12u, 0x5555u, 14u, 0xBAAAu },
+    { 0xAAAAu, 12u, 0x5555u, 15u, 0xAAAAu },
+    { 0xAAAAu, 13u, 0x5555u,  0u, 0xAAAAu },
+    { 0xAAAAu, 13u, 0x5555u,  1u, 0x8AAAu },
+    { 0xAAAAu, 13u, 0x5555u,  2u, 0xAAAAu },
+    { 0xAAAAu, 13u, 0x5555u,  3u, 0x8AAAu },
+    { 0xAAAAu, 13u, 0x5555u,  4u, 0xAAAAu },
+    { 0xAAAAu, 13u, 0x5555u,  5u, 0x8AAAu },
+    { 0xAAAAu, 13u, 0x5555u,  6u, 0xAAAAu },
+    { 0xAAAAu, 13u, 0x5555u,  7u, 0x8AAAu },
+    { 0xAAAAu, 13u, 0x5555u,  8u, 0xAAAAu },
+    { 0xAAAAu, 13u, 0x5555u,  9u, 0x8AAAu },
+    { 0xAAAAu, 13u, 0x5555u, 10u, 0xAAAAu },
+    { 0xAAAAu, 13u, 0x5555u, 11u, 0x8AAAu },
+    { 0xAAAAu, 13u, 0x5555u, 12u, 0xAAAAu },
+    { 0xAAAAu, 13u, 0x5555u, 13u, 0x8AAAu },
+    { 0xAAAAu, 13u, 0x5555u, 14u, 0xAAAAu },
+    { 0xAAAAu, 13u, 0x5555u, 15u, 0x8AAAu },
+    { 0xAAAAu, 14u, 0x5555u,  0u, 0xEAAAu },
+    { 0xAAAAu, 14u, 0x5555u,  1u, 0xAAAAu },
+    { 0xAAAAu, 14u, 0x5555u,  2u, 0xEAAAu },
+    { 0xAAAAu, 14u, 0x5555u,  3u, 0xAAAAu },
+    { 0xAAAAu, 14u, 0x5555u,  4u, 0xEAAAu },
+    { 0xAAAAu, 14u, 0x5555u,  5u, 0xAAAAu },
+    { 0xAAAAu, 14u, 0x5555u,  6u, 0xEAAAu },
+    { 0xAAAAu, 14u, 0x5555u,  7u, 0xAAAAu },
+    { 0xAAAAu, 14u, 0x5555u,  8u, 0xEAAAu },
+    { 0xAAAAu, 14u, 0x5555u,  9u, 0xAAAAu },
+    { 0xAAAAu, 14u, 0x5555u, 10u, 0xEAAAu },
+    { 0xAAAAu, 14u, 0x5555u, 11u, 0xAAAAu },
+    { 0xAAAAu, 14u, 0x5555u, 12u, 0xEAAAu },
+    { 0xAAAAu, 14u, 0x5555u, 13u, 0xAAAAu },
+    { 0xAAAAu, 14u, 0x5555u, 14u, 0xEAAAu },
+    { 0xAAAAu, 14u, 0x5555u, 15u, 0xAAAAu },
+    { 0xAAAAu, 15u, 0x5555u,  0u, 0xAAAAu },
+    { 0xAAAAu, 15u, 0x5555u,  1u, 0x2AAAu },
+    { 0xAAAAu, 15u, 0x5555u,  2u, 0xAAAAu },
+    { 0xAAAAu, 15u, 0x5555u,  3u, 0x2AAAu },
+    { 0xAAAAu, 15u, 0x5555u,  4u, 0xAAAAu },
+    { 0xAAAAu, 15u, 0x5555u,  5u, 0x2AAAu },
+    { 0xAAAAu, 15u, 0x5555u,  6u, 0xAAAAu },
+    { 0xAAAAu, 15u, 0x5555u,  7u, 0x2AAAu },
+    { 0xAAAAu, 15u, 0x5555u,  8u, 0xAAAAu },
+    { 0xAAAAu, 15u, 0x5555u,  9u, 0x2AAAu },
+    { 0xAAAAu, 15u, 0x5555u, 10u, 0xAAAAu },
+    { 0xAAAAu, 15u, 0x5555u, 11u, 0x2AAAu },
+    { 0xAAAAu, 15u, 0x5555u, 12u, 0xAAAAu },
+    { 0xAAAAu, 15u, 0x5555u, 13u, 0x2AAAu },
+    { 0xAAAAu, 15u, 0x5555u, 14u, 0xAAAAu },
+    { 0xAAAAu, 15u, 0x5555u, 15u, 0x2AAAu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CopyBit_u16u8u16u8 vectors**
+ *
+ * The test runs the 256 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00101, SWS_Bfx_00108
+ */
+void test__Bfx_CopyBit_u16u8u16u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CopyBit_u16u8u16u8 ) / sizeof( CopyBit_u16u8u16u8[ 0 ] ) ); i++ )
+    {
+        uint16 DestinationData = CopyBit_u16u8u16u8[ i ].DestinationData;
+        Bfx_CopyBit_u16u8u16u8( &DestinationData, CopyBit_u16u8u16u8[ i ].DestinationPosition, CopyBit_u16u8u16u8[ i ].SourceData, CopyBit_u16u8u16u8[ i ].SourcePosition );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( CopyBit_u16u8u16u8[ i ].Expected, DestinationData, Vector( "Bfx_CopyBit_u16u8u16u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint16 Pattern;
+    uint16 Mask;
+    uint16 Expected;
+} PutBitsMask_u16u16u16[] = {
+    { 0x0000u, 0x0000u, 0x0000u, 0x0000u },
+    { 0x0000u, 0x0000u, 0xFFFFu, 0x0000u },
+    { 0x0000u, 0x0000u, 0xAAAAu, 0x0000u },
+    { 0x0000u, 0x0000u, 0xCDEFu, 0x0000u },
+    { 0x0000u, 0xFFFFu, 0x0000u, 0x0000u },
+    { 0x0000u, 0xFFFFu, 0xFFFFu, 0xFFFFu },
+    { 0x0000u, 0xFFFFu, 0xAAAAu, 0xAAAAu },
+    { 0x0000u, 0xFFFFu, 0xCDEFu, 0xCDEFu },
+    { 0x0000u, 0x5555u, 0x0000u, 0x0000u },
+    { 0x0000u, 0x5555u, 0xFFFFu, 0x5555u },
+    { 0x0000u, 0x5555u, 0xAAAAu, 0x0000u },
+    { 0x0000u, 0x5555u, 0xCDEFu, 0x4545u },
+    { 0x0000u, 0xCDEFu, 0x0000u, 0x0000u },
+    { 0x0000u, 0xCDEFu, 0xFFFFu, 0xCDEFu },
+    { 0x0000u, 0xCDEFu, 0xAAAAu, 0x88AAu },
+    { 0x0000u, 0xCDEFu, 0xCDEFu, 0xCDEFu },
+    { 0xFFFFu, 0x0000u, 0x0000u, 0xFFFFu },
+    { 0xFFFFu, 0x0000u, 0xFFFFu, 0x0000u },
+    { 0xFFFFu, 0x0000u, 0xAAAAu, 0x5555u },
+    { 0xFFFFu, 0x0000u, 0xCDEFu, 0x3210u },
+    { 0xFFFFu, 0xFFFFu, 0x0000u, 0xFFFFu },
+    { 0xFFFFu, 0xFFFFu, 0xFFFFu, 0xFFFFu },
+    { 0xFFFFu, 0xFFFFu, 0xAAAAu, 0xFFFFu },
+    { 0xFFFFu, 0xFFFFu, 0xCDEFu, 0xFFFFu },
+    { 0xFFFFu, 0x5555u, 0x0000u, 0xFFFFu },
+    { 0xFFFFu, 0x5555u, 0xFFFFu, 0x5555u },
+    { 0xFFFFu, 0x5555u, 0xAAAAu, 0x5555u },
+    { 0xFFFFu, 0x5555u, 0xCDEFu, 0x7755u },
+    { 0xFFFFu, 0xCDEFu, 0x0000u, 0xFFFFu },
+    { 0xFFFFu, 0xCDEFu, 0xFFFFu, 0xCDEFu },
+    { 0xFFFFu, 0xCDEFu, 0xAAAAu, 0xDDFFu },
+    { 0xFFFFu, 0xCDEFu, 0xCDEFu, 0xFFFFu },
+    { 0x5555u, 0x0000u, 0x0000u, 0x5555u },
+    { 0x5555u, 0x0000u, 0xFFFFu, 0x0000u },
+    { 0x5555u, 0x0000u, 0xAAAAu, 0x5555u },
+    { 0x5555u, 0x0000u, 0xCDEFu, 0x1010u },
+    { 0x5555u, 0xFFFFu, 0x0000u, 0x5555u },
+    { 0x5555u, 0xFFFFu, 0xFFFFu, 0xFFFFu },
+    { 0x5555u, 0xFFFFu, 0xAAAAu, 0xFFFFu },
+    { 0x5555u, 0xFFFFu, 0xCDEFu, 0xDDFFu },
+    { 0x5555u, 0x5555u, 0x0000u, 0x5555u },
+    { 0x5555u, 0x5555u, 0xFFFFu, 0x5555u },
+    { 0x5555u, 0x5555u, 0xAAAAu, 0x5555u },
+    { 0x5555u, 0x5555u, 0xCDEFu, 0x5555u },
+    { 0x5555u, 0xCDEFu, 0x0000u, 0x5555u },
+    { 0x5555u, 0xCDEFu, 0xFFFFu, 0xCDEFu },
+    { 0x5555u, 0xCDEFu, 0xAAAAu, 0xDDFFu },
+    { 0x5555u, 0xCDEFu, 0xCDEFu, 0xDDFFu },
+    { 0xCDEFu, 0x0000u, 0x0000u, 0xCDEFu },
+    { 0xCDEFu, 0x0000u, 0xFFFFu, 0x0000u },
+    { 0xCDEFu, 0x0000u, 0xAAAAu, 0x4545u },
+    { 0xCDEFu, 0x0000u, 0xCDEFu, 0x0000u },
+    { 0xCDEFu, 0xFFFFu, 0x0000u, 0xCDEFu },
+    { 0xCDEFu, 0xFFFFu, 0xFFFFu, 0xFFFFu },
+    { 0xCDEFu, 0xFFFFu, 0xAAAAu, 0xEFEFu },
+    { 0xCDEFu, 0xFFFFu, 0xCDEFu, 0xCDEFu },
+    { 0xCDEFu, 0x5555u, 0x0000u, 0xCDEFu },
+    { 0xCDEFu, 0x5555u, 0xFFFFu, 0x5555u },
+    { 0xCDEFu, 0x5555u, 0xAAAAu, 0x4545u },
+    { 0xCDEFu, 0x5555u, 0xCDEFu, 0x4545u },
+    { 0xCDEFu, 0xCDEFu, 0x0000u, 0xCDEFu },
+    { 0xCDEFu, 0xCDEFu, 0xFFFFu, 0xCDEFu },
+    { 0xCDEFu, 0xCDEFu, 0xAAAAu, 0xCDEFu },
+    { 0xCDEFu, 0xCDEFu, 0xCDEFu, 0xCDEFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_PutBitsMask_u16u16u16 vectors**
+ *
+ * The test runs the 64 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00120, SWS_Bfx_00124
+ */
+void test__Bfx_PutBitsMask_u16u16u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( PutBitsMask_u16u16u16 ) / sizeof( PutBitsMask_u16u16u16[ 0 ] ) ); i++ )
+    {
+        uint16 Data = PutBitsMask_u16u16u16[ i ].Data;
+        Bfx_PutBitsMask_u16u16u16( &Data, PutBitsMask_u16u16u16[ i ].Pattern, PutBitsMask_u16u16u16[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( PutBitsMask_u16u16u16[ i ].Expected, Data, Vector( "Bfx_PutBitsMask_u16u16u16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    sint8 ShiftCnt;
+    uint16 Expected;
+} ShiftBitSat_u16s8_u16[] = {
+    { 0x5556u,   2, 0xFFFFu },
+    { 0x0000u, -15, 0x0000u },
+    { 0x0000u, -14, 0x0000u },
+    { 0x0000u, -13, 0x0000u },
+    { 0x0000u, -12, 0x0000u },
+    { 0x0000u, -11, 0x0000u },
+    { 0x0000u, -10, 0x0000u },
+    { 0x0000u,  -9, 0x0000u },
+    { 0x0000u,  -8, 0x0000u },
+    { 0x0000u,  -7, 0x0000u },
+    { 0x0000u,  -6, 0x0000u },
+    { 0x0000u,  -5, 0x0000u },
+    { 0x0000u,  -4, 0x0000u },
+    { 0x0000u,  -3, 0x0000u },
+    { 0x0000u,  -2, 0x0000u },
+    { 0x0000u,  -1, 0x0000u },
+    { 0x0000u,   0, 0x0000u },
+    { 0x0000u,   1, 0x0000u },
+    { 0x0000u,   2, 0x0000u },
+    { 0x0000u,   3, 0x0000u },
+    { 0x0000u,   4, 0x0000u },
+    { 0x0000u,   5, 0x0000u },
+    { 0x0000u,   6, 0x0000u },
+    { 0x0000u,   7, 0x0000u },
+    { 0x0000u,   8, 0x0000u },
+    { 0x0000u,   9, 0x0000u },
+    { 0x0000u,  10, 0x0000u },
+    { 0x0000u,  11, 0x0000u },
+    { 0x0000u,  12, 0x0000u },
+    { 0x0000u,  13, 0x0000u },
+    { 0x0000u,  14, 0x0000u },
+    { 0x0000u,  15, 0x0000u },
+    { 0xFFFFu, -15, 0x0001u },
+    { 0xFFFFu, -14, 0x0003u },
+    { 0xFFFFu, -13, 0x0007u },
+    { 0xFFFFu, -12, 0x000Fu },
+    { 0xFFFFu, -11, 0x001Fu },
+    { 0xFFFFu, -10, 0x003Fu },
+    { 0xFFFFu,  -9, 0x007Fu },
+    { 0xFFFFu,  -8, 0x00FFu },
+    { 0xFFFFu,  -7, 0x01FFu },
+    { 0xFFFFu,  -6, 0x03FFu },
+    { 0xFFFFu,  -5, 0x07FFu },
+    { 0xFFFFu,  -4, 0x0FFFu },
+    { 0xFFFFu,  -3, 0x1FFFu },
+    { 0xFFFFu,  -2, 0x3FFFu },
+    { 0xFFFFu,  -1, 0x7FFFu },
+    { 0xFFFFu,   0, 0xFFFFu },
+    { 0xFFFFu,   1, 0xFFFFu },
+    { 0xFFFFu,   2, 0xFFFFu },
+    { 0xFFFFu,   3, 0xFFFFu },
+    { 0xFFFFu,   4, 0xFFFFu },
+    { 0xFFFFu,   5, 0xFFFFu },
+    { 0xFFFFu,   6, 0xFFFFu },
+    { 0xFFFFu,   7, 0xFFFFu },
+    { 0xFFFFu,   8, 0xFFFFu },
+    { 0xFFFFu,   9, 0xFFFFu },
+    { 0xFFFFu,  10, 0xFFFFu },
+    { 0xFFFFu,  11, 0xFFFFu },
+    { 0xFFFFu,  12, 0xFFFFu },
+    { 0xFFFFu,  13, 0xFFFFu },
+    { 0xFFFFu,  14, 0xFFFFu },
+    { 0xFFFFu,  15, 0xFFFFu },
+    { 0x0001u, -15, 0x0000u },
+    { 0x0001u, -14, 0x0000u },
+    { 0x0001u, -13, 0x0000u },
+    { 0x0001u, -12, 0x0000u },
+    { 0x0001u, -11, 0x0000u },
+    { 0x0001u, -10, 0x0000u },
+    { 0x0001u,  -9, 0x0000u },
+    { 0x0001u,  -8, 0x0000u },
+    { 0x0001u,  -7, 0x0000u },
+    { 0x0001u,  -6, 0x0000u },
+    { 0x0001u,  -5, 0x0000u },
+    { 0x0001u,  -4, 0x0000u },
+    { 0x0001u,  -3, 0x0000u },
+    { 0x0001u,  -2, 0x0000u },
+    { 0x0001u,  -1, 0x0000u },
+    { 0x0001u,   0, 0x0001u },
+    { 0x0001u,   1, 0x0002u },
+    { 0x0001u,   2, 0x0004u },
+    { 0x0001u,   3, 0x0008u },
+    { 0x0001u,   4, 0x0010u },
+    { 0x0001u,   5, 0x0020u },
+    { 0x0001u,   6, 0x0040u },
+    { 0x0001u,   7, 0x0080u },
+    { 0x0001u,   8, 0x0100u },
+    { 0x0001u,   9, 0x0200u },
+    { 0x0001u,  10, 0x0400u },
+    { 0x0001u,  11, 0x0800u },
+    { 0x0001u,  12, 0x1000u },
+    { 0x0001u,  13, 0x2000u },
+    { 0x0001u,  14, 0x4000u },
+    { 0x0001u,  15, 0x8000u },
+    { 0x8000u, -15, 0x0001u },
+    { 0x8000u, -14, 0x0002u },
+    { 0x8000u, -13, 0x0004u },
+    { 0x8000u, -12, 0x0008u },
+    { 0x8000u, -11, 0x0010u },
+    { 0x8000u, -10, 0x0020u },
+    { 0x8000u,  -9, 0x0040u },
+    { 0x8000u,  -8, 0x0080u },
+    { 0x8000u,  -7, 0x0100u },
+    { 0x8000u,  -6, 0x0200u },
+    { 0x8000u,  -5, 0x0400u },
+    { 0x8000u,  -4, 0x0800u },
+    { 0x8000u,  -3, 0x1000u },
+    { 0x8000u,  -2, 0x2000u },
+    { 0x8000u,  -1, 0x4000u },
+    { 0x8000u,   0, 0x8000u },
+    { 0x8000u,   1, 0xFFFFu },
+    { 0x8000u,   2, 0xFFFFu },
+    { 0x8000u,   3, 0xFFFFu },
+    { 0x8000u,   4, 0xFFFFu },
+    { 0x8000u,   5, 0xFFFFu },
+    { 0x8000u,   6, 0xFFFFu },
+    { 0x8000u,   7, 0xFFFFu },
+    { 0x8000u,   8, 0xFFFFu },
+    { 0x8000u,   9, 0xFFFFu },
+    { 0x8000u,  10, 0xFFFFu },
+    { 0x8000u,  11, 0xFFFFu },
+    { 0x8000u,  12, 0xFFFFu },
+    { 0x8000u,  13, 0xFFFFu },
+    { 0x8000u,  14, 0xFFFFu },
+    { 0x8000u,  15, 0xFFFFu },
+    { 0xCDEFu, -15, 0x0001u },
+    { 0xCDEFu, -14, 0x0003u },
+    { 0xCDEFu, -13, 0x0006u },
+    { 0xCDEFu, -12, 0x000Cu },
+    { 0xCDEFu, -11, 0x0019u },
+    { 0xCDEFu, -10, 0x0033u },
+    { 0xCDEFu,  -9, 0x0066u },
+    { 0xCDEFu,  -8, 0x00CDu },
+    { 0xCDEFu,  -7, 0x019Bu },
+    { 0xCDEFu,  -6, 0x0337u },
+    { 0xCDEFu,  -5, 0x066Fu },
+    { 0xCDEFu,  -4, 0x0CDEu },
+    { 0xCDEFu,  -3, 0x19BDu },
+    { 0xCDEFu,  -2, 0x337Bu },
+    { 0xCDEFu,  -1, 0x66F7u },
+    { 0xCDEFu,   0, 0xCDEFu },
+    { 0xCDEFu,   1, 0xFFFFu },
+    { 0xCDEFu,   2, 0xFFFFu },
+    { 0xCDEFu,   3, 0xFFFFu },
+    { 0xCDEFu,   4, 0xFFFFu },
+    { 0xCDEFu,   5, 0xFFFFu },
+    { 0xCDEFu,   6, 0xFFFFu },
+    { 0xCDEFu,   7, 0xFFFFu },
+    { 0xCDEFu,   8, 0xFFFFu },
+    { 0xCDEFu,   9, 0xFFFFu },
+    { 0xCDEFu,  10, 0xFFFFu },
+    { 0xCDEFu,  11, 0xFFFFu },
+    { 0xCDEFu,  12, 0xFFFFu },
+    { 0xCDEFu,  13, 0xFFFFu },
+    { 0xCDEFu,  14, 0xFFFFu },
+    { 0xCDEFu,  15, 0xFFFFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitSat_u16s8_u16 vectors**
+ *
+ * The test runs the 156 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91002, SWS_Bfx_00134, SWS_Bfx_00135
+ */
+void test__Bfx_ShiftBitSat_u16s8_u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitSat_u16s8_u16 ) / sizeof( ShiftBitSat_u16s8_u16[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( ShiftBitSat_u16s8_u16[ i ].Expected, Bfx_ShiftBitSat_u16s8_u16( ShiftBitSat_u16s8_u16[ i ].Data, ShiftBitSat_u16s8_u16[ i ].ShiftCnt ), Vector( "Bfx_ShiftBitSat_u16s8_u16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    sint16 Data;
+    sint8 ShiftCnt;
+    sint16 Expected;
+} ShiftBitSat_s16s8_s16[] = {
+    {         0, -15,         0 },
+    {         0, -14,         0 },
+    {         0, -13,         0 },
+    {         0, -12,         0 },
+    {         0, -11,         0 },
+    {         0, -10,         0 },
+    {         0,  -9,         0 },
+    {         0,  -8,         0 },
+    {         0,  -7,         0 },
+    {         0,  -6,         0 },
+    {         0,  -5,         0 },
+    {         0,  -4,         0 },
+    {         0,  -3,         0 },
+    {         0,  -2,         0 },
+    {         0,  -1,         0 },
+    {         0,   0,         0 },
+    {         0,   1,         0 },
+    {         0,   2,         0 },
+    {         0,   3,         0 },
+    {         0,   4,         0 },
+    {         0,   5,         0 },
+    {         0,   6,         0 },
+    {         0,   7,         0 },
+    {         0,   8,         0 },
+    {         0,   9,         0 },
+    {         0,  10,         0 },
+    {         0,  11,         0 },
+    {         0,  12,         0 },
+    {         0,  13,         0 },
+    {         0,  14,         0 },
+    {         0,  15,         0 },
+    {        -1, -15,        -1 },
+    {        -1, -14,        -1 },
+    {        -1, -13,        -1 },
+    {        -1, -12,        -1 },
+    {        -1, -11,        -1 },
+    {        -1, -10,        -1 },
+    {        -1,  -9,        -1 },
+    {        -1,  -8,        -1 },
+    {        -1,  -7,        -1 },
+    {        -1,  -6,        -1 },
+    {        -1,  -5,        -1 },
+    {        -1,  -4,        -1 },
+    {        -1,  -3,        -1 },
+    {        -1,  -2,        -1 },
+    {        -1,  -1,        -1 },
+    {        -1,   0,        -1 },
+    {        -1,   1,        -2 },
+    {        -1,   2,        -4 },
+    {        -1,   3,        -8 },
+    {        -1,   4,       -16 },
+    {        -1,   5,       -32 },
+    {        -1,   6,       -64 },
+    {        -1,   7,      -128 },
+    {        -1,   8,      -256 },
+    {        -1,   9,      -512 },
+    {        -1,  10,     -1024 },
+    {        -1,  11,     -2048 },
+    {        -1,  12,     -4096 },
+    {        -1,  13,     -8192 },
+    {        -1,  14,    -16384 },
+    {        -1,  15, INT16_MIN },
+    {         1, -15,         0 },
+    {         1, -14,         0 },
+    {         1, -13,         0 },
+    {         1, -12,         0 },
+    {         1, -11,         0 },
+    {         1, -10,         0 },
+    {         1,  -9,         0 },
+    {         1,  -8,         0 },
+    {         1,  -7,         0 },
+    {         1,  -6,         0 },
+    {         1,  -5,         0 },
+    {         1,  -4,         0 },
+    {         1,  -3,         0 },
+    {         1,  -2,         0 },
+    {         1,  -1,         0 },
+    {         1,   0,         1 },
+    {         1,   1,         2 },
+    {         1,   2,         4 },
+    {         1,   3,         8 },
+    {         1,   4,        16 },
+    {         1,   5,        32 },
+    {         1,   6,        64 },
+    {         1,   7,       128 },
+    {         1,   8,       256 },
+    {         1,   9,       512 },
+    {         1,  10,      1024 },
+    {         1,  11,      2048 },
+    {         1,  12,      4096 },
+    {         1,  13,      8192 },
+    {         1,  14,     16384 },
+    {         1,  15,     32767 },
+    { INT16_MIN, -15,        -1 },
+    { INT16_MIN, -14,        -2 },
+    { INT16_MIN, -13,        -4 },
+    { INT16_MIN, -12,        -8 },
+    { INT16_MIN, -11,       -16 },
+    { INT16_MIN, -10,       -32 },
+    { INT16_MIN,  -9,       -64 },
+    { INT16_MIN,  -8,      -128 },
+    { INT16_MIN,  -7,      -256 },
+    { INT16_MIN,  -6,      -512 },
+    { INT16_MIN,  -5,     -1024 },
+    { INT16_MIN,  -4,     -2048 },
+    { INT16_MIN,  -3,     -4096 },
+    { INT16_MIN,  -2,     -8192 },
+    { INT16_MIN,  -1,    -16384 },
+    { INT16_MIN,   0, INT16_MIN },
+    { INT16_MIN,   1, INT16_MIN },
+    { INT16_MIN,   2, INT16_MIN },
+    { INT16_MIN,   3, INT16_MIN },
+    { INT16_MIN,   4, INT16_MIN },
+    { INT16_MIN,   5, INT16_MIN },
+    { INT16_MIN,   6, INT16_MIN },
+    { INT16_MIN,   7, INT16_MIN },
+    { INT16_MIN,   8, INT16_MIN },
+    { INT16_MIN,   9, INT16_MIN },
+    { INT16_MIN,  10, INT16_MIN },
+    { INT16_MIN,  11, INT16_MIN },
+    { INT16_MIN,  12, INT16_MIN },
+    { INT16_MIN,  13, INT16_MIN },
+    { INT16_MIN,  14, INT16_MIN },
+    { INT16_MIN,  15, INT16_MIN },
+    {     32767, -15,         0 },
+    {     32767, -14,         1 },
+    {     32767, -13,         3 },
+    {     32767, -12,         7 },
+    {     32767, -11,        15 },
+    {     32767, -10,        31 },
+    {     32767,  -9,        63 },
+    {     32767,  -8,       127 },
+    {     32767,  -7,       255 },
+    {     32767,  -6,       511 },
+    {     32767,  -5,      1023 },
+    {     32767,  -4,      2047 },
+    {     32767,  -3,      4095 },
+    {     32767,  -2,      8191 },
+    {     32767,  -1,     16383 },
+    {     32767,   0,     32767 },
+    {     32767,   1,     32767 },
+    {     32767,   2,     32767 },
+    {     32767,   3,     32767 },
+    {     32767,   4,     32767 },
+    {     32767,   5,     32767 },
+    {     32767,   6,     32767 },
+    {     32767,   7,     32767 },
+    {     32767,   8,     32767 },
+    {     32767,   9,     32767 },
+    {     32767,  10,     32767 },
+    {     32767,  11,     32767 },
+    {     32767,  12,     32767 },
+    {     32767,  13,     32767 },
+    {     32767,  14,     32767 },
+    {     32767,  15,     32767 },
+    {    -12817, -15,        -1 },
+    {    -12817, -14,        -1 },
+    {    -12817, -13,        -2 },
+    {    -12817, -12,        -4 },
+    {    -12817, -11,        -7 },
+    {    -12817, -10,       -13 },
+    {    -12817,  -9,       -26 },
+    {    -12817,  -8,       -51 },
+    {    -12817,  -7,      -101 },
+    {    -12817,  -6,      -201 },
+    {    -12817,  -5,      -401 },
+    {    -12817,  -4,      -802 },
+    {    -12817,  -3,     -1603 },
+    {    -12817,  -2,     -3205 },
+    {    -12817,  -1,     -6409 },
+    {    -12817,   0,    -12817 },
+    {    -12817,   1,    -25634 },
+    {    -12817,   2, INT16_MIN },
+    {    -12817,   3, INT16_MIN },
+    {    -12817,   4, INT16_MIN },
+    {    -12817,   5, INT16_MIN },
+    {    -12817,   6, INT16_MIN },
+    {    -12817,   7, INT16_MIN },
+    {    -12817,   8, INT16_MIN },
+    {    -12817,   9, INT16_MIN },
+    {    -12817,  10, INT16_MIN },
+    {    -12817,  11, INT16_MIN },
+    {    -12817,  12, INT16_MIN },
+    {    -12817,  13, INT16_MIN },
+    {    -12817,  14, INT16_MIN },
+    {    -12817,  15, INT16_MIN },
+    {    -21846, -15,        -1 },
+    {    -21846, -14,        -2 },
+    {    -21846, -13,        -3 },
+    {    -21846, -12,        -6 },
+    {    -21846, -11,       -11 },
+    {    -21846, -10,       -22 },
+    {    -21846,  -9,       -43 },
+    {    -21846,  -8,       -86 },
+    {    -21846,  -7,      -171 },
+    {    -21846,  -6,      -342 },
+    {    -21846,  -5,      -683 },
+    {    -21846,  -4,     -1366 },
+    {    -21846,  -3,     -2731 },
+    {    -21846,  -2,     -5462 },
+    {    -21846,  -1,    -10923 },
+    {    -21846,   0,    -21846 },
+    {    -21846,   1, INT16_MIN },
+    {    -21846,   2, INT16_MIN },
+    {    -21846,   3, INT16_MIN },
+    {    -21846,   4, INT16_MIN },
+    {    -21846,   5, INT16_MIN },
+    {    -21846,   6, INT16_MIN },
+    {    -21846,   7, INT16_MIN },
+    {    -21846,   8, INT16_MIN },
+    {    -21846,   9, INT16_MIN },
+    {    -21846,  10, INT16_MIN },
+    {    -21846,  11, INT16_MIN },
+    {    -21846,  12, INT16_MIN },
+    {    -21846,  13, INT16_MIN },
+    {    -21846,  14, INT16_MIN },
+    {    -21846,  15, INT16_MIN },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitSat_s16s8_s16 vectors**
+ *
+ * The test runs the 217 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91002, SWS_Bfx_00134, SWS_Bfx_00135
+ */
+void test__Bfx_ShiftBitSat_s16s8_s16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitSat_s16s8_s16 ) / sizeof( ShiftBitSat_s16s8_s16[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_INT16_MESSAGE( ShiftBitSat_s16s8_s16[ i ].Expected, Bfx_ShiftBitSat_s16s8_s16( ShiftBitSat_s16s8_s16[ i ].Data, ShiftBitSat_s16s8_s16[ i ].ShiftCnt ), Vector( "Bfx_ShiftBitSat_s16s8_s16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 Expected;
+} CountLeadingOnes_u16[] = {
+    { 0x0000u,  0u },
+    { 0xFFFFu, 16u },
+    { 0xCDEFu,  2u },
+    { 0x0001u,  0u },
+    { 0x0002u,  0u },
+    { 0x0004u,  0u },
+    { 0x0008u,  0u },
+    { 0x0010u,  0u },
+    { 0x0020u,  0u },
+    { 0x0040u,  0u },
+    { 0x0080u,  0u },
+    { 0x0100u,  0u },
+    { 0x0200u,  0u },
+    { 0x0400u,  0u },
+    { 0x0800u,  0u },
+    { 0x1000u,  0u },
+    { 0x2000u,  0u },
+    { 0x4000u,  0u },
+    { 0x8000u,  1u },
+    { 0x0000u,  0u },
+    { 0x8000u,  1u },
+    { 0xC000u,  2u },
+    { 0xE000u,  3u },
+    { 0xF000u,  4u },
+    { 0xF800u,  5u },
+    { 0xFC00u,  6u },
+    { 0xFE00u,  7u },
+    { 0xFF00u,  8u },
+    { 0xFF80u,  9u },
+    { 0xFFC0u, 10u },
+    { 0xFFE0u, 11u },
+    { 0xFFF0u, 12u },
+    { 0xFFF8u, 13u },
+    { 0xFFFCu, 14u },
+    { 0xFFFEu, 15u },
+    { 0xFFFFu, 16u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CountLeadingOnes_u16 vectors**
+ *
+ * The test runs the 36 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91003, SWS_Bfx_00137
+ */
+void test__Bfx_CountLeadingOnes_u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CountLeadingOnes_u16 ) / sizeof( CountLeadingOnes_u16[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( CountLeadingOnes_u16[ i ].Expected, Bfx_CountLeadingOnes_u16( CountLeadingOnes_u16[ i ].Data ), Vector( "Bfx_CountLeadingOnes_u16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    sint16 Data;
+    uint8 Expected;
+} CountLeadingSigns_s16[] = {
+    {         0, 15u },
+    {        -1, 15u },
+    {    -12817,  1u },
+    {     32767,  0u },
+    {         1, 14u },
+    {         2, 13u },
+    {         4, 12u },
+    {         8, 11u },
+    {        16, 10u },
+    {        32,  9u },
+    {        64,  8u },
+    {       128,  7u },
+    {       256,  6u },
+    {       512,  5u },
+    {      1024,  4u },
+    {      2048,  3u },
+    {      4096,  2u },
+    {      8192,  1u },
+    {     16384,  0u },
+    { INT16_MIN,  0u },
+    {         0, 15u },
+    {         1, 14u },
+    {         3, 13u },
+    {         7, 12u },
+    {        15, 11u },
+    {        31, 10u },
+    {        63,  9u },
+    {       127,  8u },
+    {       255,  7u },
+    {       511,  6u },
+    {      1023,  5u },
+    {      2047,  4u },
+    {      4095,  3u },
+    {      8191,  2u },
+    {     16383,  1u },
+    {     32767,  0u },
+    {        -1, 15u },
+    {         0, 15u },
+    { INT16_MIN,  0u },
+    {    -16384,  1u },
+    {     -8192,  2u },
+    {     -4096,  3u },
+    {     -2048,  4u },
+    {     -1024,  5u },
+    {      -512,  6u },
+    {      -256,  7u },
+    {      -128,  8u },
+    {       -64,  9u },
+    {       -32, 10u },
+    {       -16, 11u },
+    {        -8, 12u },
+    {        -4, 13u },
+    {        -2, 14u },
+    {        -1, 15u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CountLeadingSigns_s16 vectors**
+ *
+ * The test runs the 54 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91004, SWS_Bfx_00139
+ */
+void test__Bfx_CountLeadingSigns_s16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CountLeadingSigns_s16 ) / sizeof( CountLeadingSigns_s16[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( CountLeadingSigns_s16[ i ].Expected, Bfx_CountLeadingSigns_s16( CountLeadingSigns_s16[ i ].Data ), Vector( "Bfx_CountLeadingSigns_s16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint8 Expected;
+} CountLeadingZeros_u16[] = {
+    { 0x0100u,  7u },
+    { 0x0000u, 16u },
+    { 0x0000u, 16u },
+    { 0xFFFFu,  0u },
+    { 0xCDEFu,  0u },
+    { 0x0001u, 15u },
+    { 0x0002u, 14u },
+    { 0x0004u, 13u },
+    { 0x0008u, 12u },
+    { 0x0010u, 11u },
+    { 0x0020u, 10u },
+    { 0x0040u,  9u },
+    { 0x0080u,  8u },
+    { 0x0100u,  7u },
+    { 0x0200u,  6u },
+    { 0x0400u,  5u },
+    { 0x0800u,  4u },
+    { 0x1000u,  3u },
+    { 0x2000u,  2u },
+    { 0x4000u,  1u },
+    { 0x8000u,  0u },
+    { 0x0000u, 16u },
+    { 0x0001u, 15u },
+    { 0x0003u, 14u },
+    { 0x0007u, 13u },
+    { 0x000Fu, 12u },
+    { 0x001Fu, 11u },
+    { 0x003Fu, 10u },
+    { 0x007Fu,  9u },
+    { 0x00FFu,  8u },
+    { 0x01FFu,  7u },
+    { 0x03FFu,  6u },
+    { 0x07FFu,  5u },
+    { 0x0FFFu,  4u },
+    { 0x1FFFu,  3u },
+    { 0x3FFFu,  2u },
+    { 0x7FFFu,  1u },
+    { 0xFFFFu,  0u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CountLeadingZeros_u16 vectors**
+ *
+ * The test runs the 38 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91005, SWS_Bfx_00141
+ */
+void test__Bfx_CountLeadingZeros_u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CountLeadingZeros_u16 ) / sizeof( CountLeadingZeros_u16[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( CountLeadingZeros_u16[ i ].Expected, Bfx_CountLeadingZeros_u16( CountLeadingZeros_u16[ i ].Data ), Vector( "Bfx_CountLeadingZeros_u16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint16 Mask;
+    uint16 Expected;
+} DepositBits_u16u16_u16[] = {
+    { 0xFFFFu, 0x0000u, 0x0000u },
+    { 0xFFFFu, 0xFFFFu, 0xFFFFu },
+    { 0xFFFFu, 0x5555u, 0x5555u },
+    { 0xFFFFu, 0xAAAAu, 0xAAAAu },
+    { 0xFFFFu, 0xCDEFu, 0xCDEFu },
+    { 0xFFFFu, 0x0001u, 0x0001u },
+    { 0xFFFFu, 0x0002u, 0x0002u },
+    { 0xFFFFu, 0x0004u, 0x0004u },
+    { 0xFFFFu, 0x0008u, 0x0008u },
+    { 0xFFFFu, 0x0010u, 0x0010u },
+    { 0xFFFFu, 0x0020u, 0x0020u },
+    { 0xFFFFu, 0x0040u, 0x0040u },
+    { 0xFFFFu, 0x0080u, 0x0080u },
+    { 0xFFFFu, 0x0100u, 0x0100u },
+    { 0xFFFFu, 0x0200u, 0x0200u },
+    { 0xFFFFu, 0x0400u, 0x0400u },
+    { 0xFFFFu, 0x0800u, 0x0800u },
+    { 0xFFFFu, 0x1000u, 0x1000u },
+    { 0xFFFFu, 0x2000u, 0x2000u },
+    { 0xFFFFu, 0x4000u, 0x4000u },
+    { 0xFFFFu, 0x8000u, 0x8000u },
+    { 0xCDEFu, 0x0000u, 0x0000u },
+    { 0xCDEFu, 0xFFFFu, 0xCDEFu },
+    { 0xCDEFu, 0x5555u, 0x5455u },
+    { 0xCDEFu, 0xAAAAu, 0xA8AAu },
+    { 0xCDEFu, 0xCDEFu, 0xC5CFu },
+    { 0xCDEFu, 0x0001u, 0x0001u },
+    { 0xCDEFu, 0x0002u, 0x0002u },
+    { 0xCDEFu, 0x0004u, 0x0004u },
+    { 0xCDEFu, 0x0008u, 0x0008u },
+    { 0xCDEFu, 0x0010u, 0x0010u },
+    { 0xCDEFu, 0x0020u, 0x0020u },
+    { 0xCDEFu, 0x0040u, 0x0040u },
+    { 0xCDEFu, 0x0080u, 0x0080u },
+    { 0xCDEFu, 0x0100u, 0x0100u },
+    { 0xCDEFu, 0x0200u, 0x0200u },
+    { 0xCDEFu, 0x0400u, 0x0400u },
+    { 0xCDEFu, 0x0800u, 0x0800u },
+    { 0xCDEFu, 0x1000u, 0x1000u },
+    { 0xCDEFu, 0x2000u, 0x2000u },
+    { 0xCDEFu, 0x4000u, 0x4000u },
+    { 0xCDEFu, 0x8000u, 0x8000u },
+    { 0x5555u, 0x0000u, 0x0000u },
+    { 0x5555u, 0xFFFFu, 0x5555u },
+    { 0x5555u, 0x5555u, 0x1111u },
+    { 0x5555u, 0xAAAAu, 0x2222u },
+    { 0x5555u, 0xCDEFu, 0x44A5u },
+    { 0x5555u, 0x0001u, 0x0001u },
+    { 0x5555u, 0x0002u, 0x0002u },
+    { 0x5555u, 0x0004u, 0x0004u },
+    { 0x5555u, 0x0008u, 0x0008u },
+    { 0x5555u, 0x0010u, 0x0010u },
+    { 0x5555u, 0x0020u, 0x0020u },
+    { 0x5555u, 0x0040u, 0x0040u },
+    { 0x5555u, 0x0080u, 0x0080u },
+    { 0x5555u, 0x0100u, 0x0100u },
+    { 0x5555u, 0x0200u, 0x0200u },
+    { 0x5555u, 0x0400u, 0x0400u },
+    { 0x5555u, 0x0800u, 0x0800u },
+    { 0x5555u, 0x1000u, 0x1000u },
+    { 0x5555u, 0x2000u, 0x2000u },
+    { 0x5555u, 0x4000u, 0x4000u },
+    { 0x5555u, 0x8000u, 0x8000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_DepositBits_u16u16_u16 vectors**
+ *
+ * The test runs the 63 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ */
+void test__Bfx_DepositBits_u16u16_u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( DepositBits_u16u16_u16 ) / sizeof( DepositBits_u16u16_u16[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( DepositBits_u16u16_u16[ i ].Expected, Bfx_DepositBits_u16u16_u16( DepositBits_u16u16_u16[ i ].Data, DepositBits_u16u16_u16[ i ].Mask ), Vector( "Bfx_DepositBits_u16u16_u16", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint16 Data;
+    uint16 Mask;
+    uint16 Expected;
+} ExtractBits_u16u16_u16[] = {
+    { 0xFFFFu, 0x0000u, 0x0000u },
+    { 0xFFFFu, 0xFFFFu, 0xFFFFu },
+    { 0xFFFFu, 0x5555u, 0x00FFu },
+    { 0xFFFFu, 0xAAAAu, 0x00FFu },
+    { 0xFFFFu, 0xCDEFu, 0x0FFFu },
+    { 0xFFFFu, 0x0001u, 0x0001u },
+    { 0xFFFFu, 0x0002u, 0x0001u },
+    { 0xFFFFu, 0x0004u, 0x0001u },
+    { 0xFFFFu, 0x0008u, 0x0001u },
+    { 0xFFFFu, 0x0010u, 0x0001u },
+    { 0xFFFFu, 0x0020u, 0x0001u },
+    { 0xFFFFu, 0x0040u, 0x0001u },
+    { 0xFFFFu, 0x0080u, 0x0001u },
+    { 0xFFFFu, 0x0100u, 0x0001u },
+    { 0xFFFFu, 0x0200u, 0x0001u },
+    { 0xFFFFu, 0x0400u, 0x0001u },
+    { 0xFFFFu, 0x0800u, 0x0001u },
+    { 0xFFFFu, 0x1000u, 0x0001u },
+    { 0xFFFFu, 0x2000u, 0x0001u },
+    { 0xFFFFu, 0x4000u, 0x0001u },
+    { 0xFFFFu, 0x8000u, 0x0001u },
+    { 0xCDEFu, 0x0000u, 0x0000u },
+    { 0xCDEFu, 0xFFFFu, 0xCDEFu },
+    { 0xCDEFu, 0x5555u, 0x00BBu },
+    { 0xCDEFu, 0xAAAAu, 0x00AFu },
+    { 0xCDEFu, 0xCDEFu, 0x0FFFu },
+    { 0xCDEFu, 0x0001u, 0x0001u },
+    { 0xCDEFu, 0x0002u, 0x0001u },
+    { 0xCDEFu, 0x0004u, 0x0001u },
+    { 0xCDEFu, 0x0008u, 0x0001u },
+    { 0xCDEFu, 0x0010u, 0x0000u },
+    { 0xCDEFu, 0x0020u, 0x0001u },
+    { 0xCDEFu, 0x0040u, 0x0001u },
+    { 0xCDEFu, 0x0080u, 0x0001u },
+    { 0xCDEFu, 0x0100u, 0x0001u },
+    { 0xCDEFu, 0x0200u, 0x0000u },
+    { 0xCDEFu, 0x0400u, 0x0001u },
+    { 0xCDEFu, 0x0800u, 0x0001u },
+    { 0xCDEFu, 0x1000u, 0x0000u },
+    { 0xCDEFu, 0x2000u, 0x0000u },
+    { 0xCDEFu, 0x4000u, 0x0001u },
+    { 0xCDEFu, 0x8000u, 0x0001u },
+    { 0x5555u, 0x0000u, 0x0000u },
+    { 0x5555u, 0xFFFFu, 0x5555u },
+    { 0x5555u, 0x5555u, 0x00FFu },
+    { 0x5555u, 0xAAAAu, 0x0000u },
+    { 0x5555u, 0xCDEFu, 0x05A5u },
+    { 0x5555u, 0x0001u, 0x0001u },
+    { 0x5555u, 0x0002u, 0x0000u },
+    { 0x5555u, 0x0004u, 0x0001u },
+    { 0x5555u, 0x0008u, 0x0000u },
+    { 0x5555u, 0x0010u, 0x0001u },
+    { 0x5555u, 0x0020u, 0x0000u },
+    { 0x5555u, 0x0040u, 0x0001u },
+    { 0x5555u, 0x0080u, 0x0000u },
+    { 0x5555u, 0x0100u, 0x0001u },
+    { 0x5555u, 0x0200u, 0x0000u },
+    { 0x5555u, 0x0400u, 0x0001u },
+    { 0x5555u, 0x0800u, 0x0000u },
+    { 0x5555u, 0x1000u, 0x0001u },
+    { 0x5555u, 0x2000u, 0x0000u },
+    { 0x5555u, 0x4000u, 0x0001u },
+    { 0x5555u, 0x8000u, 0x0000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ExtractBits_u16u16_u16 vectors**
+ *
+ * The test runs the 63 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ */
+void test__Bfx_ExtractBits_u16u16_u16__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ExtractBits_u16u16_u16 ) / sizeof( ExtractBits_u16u16_u16[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( ExtractBits_u16u16_u16[ i ].Expected, Bfx_ExtractBits_u16u16_u16( ExtractBits_u16u16_u16[ i ].Data, ExtractBits_u16u16_u16[ i ].Mask ), Vector( "Bfx_ExtractBits_u16u16_u16", i ) );
+    }
+}
@@ -0,0 +1,6702 @@
+/**
+ * @file    Test_Bfx_Vectors_32bits.c
+ * @brief   **Table Driven Unit Test for the 32 Bit Handling Routines**
+ *
+ * Generated by tools/bfx_vectors.py from utest/vectors/Bfx_Vectors.yaml, do not edit, change the
+ * YAML file and run meson compile -C build vectors instead.
+ *
+ * Each test runs every vector in the table of its routine, 5917 vectors in total. The expected
+ * results come from the reference model of the generator.
+ */
+#include <stdio.h>
+#include "unity.h"
+#include "Std_Types.h"
+#include "Bfx_32bits.h"
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+static char Message[ 64 ];
+
+static const char *Vector( const char *Routine, uint32 Index )
+{
+    (void)snprintf( Message, sizeof( Message ), "%s vector %u", Routine, (unsigned)Index );
+    return Message;
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 BitPn;
+    uint32 Expected;
+} SetBit_u32u8[] = {
+    { 0x00000000u,  0u, 0x00000001u },
+    { 0x00000000u,  1u, 0x00000002u },
+    { 0x00000000u,  2u, 0x00000004u },
+    { 0x00000000u,  3u, 0x00000008u },
+    { 0x00000000u,  4u, 0x00000010u },
+    { 0x00000000u,  5u, 0x00000020u },
+    { 0x00000000u,  6u, 0x00000040u },
+    { 0x00000000u,  7u, 0x00000080u },
+    { 0x00000000u,  8u, 0x00000100u },
+    { 0x00000000u,  9u, 0x00000200u },
+    { 0x00000000u, 10u, 0x00000400u },
+    { 0x00000000u, 11u, 0x00000800u },
+    { 0x00000000u, 12u, 0x00001000u },
+    { 0x00000000u, 13u, 0x00002000u },
+    { 0x00000000u, 14u, 0x00004000u },
+    { 0x00000000u, 15u, 0x00008000u },
+    { 0x00000000u, 16u, 0x00010000u },
+    { 0x00000000u, 17u, 0x00020000u },
+    { 0x00000000u, 18u, 0x00040000u },
+    { 0x00000000u, 19u, 0x00080000u },
+    { 0x00000000u, 20u, 0x00100000u },
+    { 0x00000000u, 21u, 0x00200000u },
+    { 0x00000000u, 22u, 0x00400000u },
+    { 0x00000000u, 23u, 0x00800000u },
+    { 0x00000000u, 24u, 0x01000000u },
+    { 0x00000000u, 25u, 0x02000000u },
+    { 0x00000000u, 26u, 0x04000000u },
+    { 0x00000000u, 27u, 0x08000000u },
+    { 0x00000000u, 28u, 0x10000000u },
+    { 0x00000000u, 29u, 0x20000000u },
+    { 0x00000000u, 30u, 0x40000000u },
+    { 0x00000000u, 31u, 0x80000000u },
+    { 0xFFFFFFFFu,  0u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  1u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  2u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  3u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  4u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  5u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  6u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  7u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  8u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  9u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 10u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 11u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 12u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 13u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 14u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 15u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 16u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 17u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 18u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 19u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 20u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 21u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 22u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 23u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 24u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 25u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 26u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 27u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 28u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 29u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 30u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 31u, 0xFFFFFFFFu },
+    { 0x55555555u,  0u, 0x55555555u },
+    { 0x55555555u,  1u, 0x55555557u },
+    { 0x55555555u,  2u, 0x55555555u },
+    { 0x55555555u,  3u, 0x5555555Du },
+    { 0x55555555u,  4u, 0x55555555u },
+    { 0x55555555u,  5u, 0x55555575u },
+    { 0x55555555u,  6u, 0x55555555u },
+    { 0x55555555u,  7u, 0x555555D5u },
+    { 0x55555555u,  8u, 0x55555555u },
+    { 0x55555555u,  9u, 0x55555755u },
+    { 0x55555555u, 10u, 0x55555555u },
+    { 0x55555555u, 11u, 0x55555D55u },
+    { 0x55555555u, 12u, 0x55555555u },
+    { 0x55555555u, 13u, 0x55557555u },
+    { 0x55555555u, 14u, 0x55555555u },
+    { 0x55555555u, 15u, 0x5555D555u },
+    { 0x55555555u, 16u, 0x55555555u },
+    { 0x55555555u, 17u, 0x55575555u },
+    { 0x55555555u, 18u, 0x55555555u },
+    { 0x55555555u, 19u, 0x555D5555u },
+    { 0x55555555u, 20u, 0x55555555u },
+    { 0x55555555u, 21u, 0x55755555u },
+    { 0x55555555u, 22u, 0x55555555u },
+    { 0x55555555u, 23u, 0x55D55555u },
+    { 0x55555555u, 24u, 0x55555555u },
+    { 0x55555555u, 25u, 0x57555555u },
+    { 0x55555555u, 26u, 0x55555555u },
+    { 0x55555555u, 27u, 0x5D555555u },
+    { 0x55555555u, 28u, 0x55555555u },
+    { 0x55555555u, 29u, 0x75555555u },
+    { 0x55555555u, 30u, 0x55555555u },
+    { 0x55555555u, 31u, 0xD5555555u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_SetBit_u32u8 vectors**
+ *
+ * The test runs the 96 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00001, SWS_Bfx_00002, SWS_Bfx_00008
+ */
+void test__Bfx_SetBit_u32u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( SetBit_u32u8 ) / sizeof( SetBit_u32u8[ 0 ] ) ); i++ )
+    {
+        uint32 Data = SetBit_u32u8[ i ].Data;
+        Bfx_SetBit_u32u8( &Data, SetBit_u32u8[ i ].BitPn );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( SetBit_u32u8[ i ].Expected, Data, Vector( "Bfx_SetBit_u32u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 BitPn;
+    uint32 Expected;
+} ClrBit_u32u8[] = {
+    { 0x00000000u,  0u, 0x00000000u },
+    { 0x00000000u,  1u, 0x00000000u },
+    { 0x00000000u,  2u, 0x00000000u },
+    { 0x00000000u,  3u, 0x00000000u },
+    { 0x00000000u,  4u, 0x00000000u },
+    { 0x00000000u,  5u, 0x00000000u },
+    { 0x00000000u,  6u, 0x00000000u },
+    { 0x00000000u,  7u, 0x00000000u },
+    { 0x00000000u,  8u, 0x00000000u },
+    { 0x00000000u,  9u, 0x00000000u },
+    { 0x00000000u, 10u, 0x00000000u },
+    { 0x00000000u, 11u, 0x00000000u },
+    { 0x00000000u, 12u, 0x00000000u },
+    { 0x00000000u, 13u, 0x00000000u },
+    { 0x00000000u, 14u, 0x00000000u },
+    { 0x00000000u, 15u, 0x00000000u },
+    { 0x00000000u, 16u, 0x00000000u },
+    { 0x00000000u, 17u, 0x00000000u },
+    { 0x00000000u, 18u, 0x00000000u },
+    { 0x00000000u, 19u, 0x00000000u },
+    { 0x00000000u, 20u, 0x00000000u },
+    { 0x00000000u, 21u, 0x00000000u },
+    { 0x00000000u, 22u, 0x00000000u },
+    { 0x00000000u, 23u, 0x00000000u },
+    { 0x00000000u, 24u, 0x00000000u },
+    { 0x00000000u, 25u, 0x00000000u },
+    { 0x00000000u, 26u, 0x00000000u },
+    { 0x00000000u, 27u, 0x00000000u },
+    { 0x00000000u, 28u, 0x00000000u },
+    { 0x00000000u, 29u, 0x00000000u },
+    { 0x00000000u, 30u, 0x00000000u },
+    { 0x00000000u, 31u, 0x00000000u },
+    { 0xFFFFFFFFu,  0u, 0xFFFFFFFEu },
+    { 0xFFFFFFFFu,  1u, 0xFFFFFFFDu },
+    { 0xFFFFFFFFu,  2u, 0xFFFFFFFBu },
+    { 0xFFFFFFFFu,  3u, 0xFFFFFFF7u },
+    { 0xFFFFFFFFu,  4u, 0xFFFFFFEFu },
+    { 0xFFFFFFFFu,  5u, 0xFFFFFFDFu },
+    { 0xFFFFFFFFu,  6u, 0xFFFFFFBFu },
+    { 0xFFFFFFFFu,  7u, 0xFFFFFF7Fu },
+    { 0xFFFFFFFFu,  8u, 0xFFFFFEFFu },
+    { 0xFFFFFFFFu,  9u, 0xFFFFFDFFu },
+    { 0xFFFFFFFFu, 10u, 0xFFFFFBFFu },
+    { 0xFFFFFFFFu, 11u, 0xFFFFF7FFu },
+    { 0xFFFFFFFFu, 12u, 0xFFFFEFFFu },
+    { 0xFFFFFFFFu, 13u, 0xFFFFDFFFu },
+    { 0xFFFFFFFFu, 14u, 0xFFFFBFFFu },
+    { 0xFFFFFFFFu, 15u, 0xFFFF7FFFu },
+    { 0xFFFFFFFFu, 16u, 0xFFFEFFFFu },
+    { 0xFFFFFFFFu, 17u, 0xFFFDFFFFu },
+    { 0xFFFFFFFFu, 18u, 0xFFFBFFFFu },
+    { 0xFFFFFFFFu, 19u, 0xFFF7FFFFu },
+    { 0xFFFFFFFFu, 20u, 0xFFEFFFFFu },
+    { 0xFFFFFFFFu, 21u, 0xFFDFFFFFu },
+    { 0xFFFFFFFFu, 22u, 0xFFBFFFFFu },
+    { 0xFFFFFFFFu, 23u, 0xFF7FFFFFu },
+    { 0xFFFFFFFFu, 24u, 0xFEFFFFFFu },
+    { 0xFFFFFFFFu, 25u, 0xFDFFFFFFu },
+    { 0xFFFFFFFFu, 26u, 0xFBFFFFFFu },
+    { 0xFFFFFFFFu, 27u, 0xF7FFFFFFu },
+    { 0xFFFFFFFFu, 28u, 0xEFFFFFFFu },
+    { 0xFFFFFFFFu, 29u, 0xDFFFFFFFu },
+    { 0xFFFFFFFFu, 30u, 0xBFFFFFFFu },
+    { 0xFFFFFFFFu, 31u, 0x7FFFFFFFu },
+    { 0xAAAAAAAAu,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x2AAAAAAAu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ClrBit_u32u8 vectors**
+ *
+ * The test runs the 96 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00010, SWS_Bfx_00011, SWS_Bfx_00015
+ */
+void test__Bfx_ClrBit_u32u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ClrBit_u32u8 ) / sizeof( ClrBit_u32u8[ 0 ] ) ); i++ )
+    {
+        uint32 Data = ClrBit_u32u8[ i ].Data;
+        Bfx_ClrBit_u32u8( &Data, ClrBit_u32u8[ i ].BitPn );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( ClrBit_u32u8[ i ].Expected, Data, Vector( "Bfx_ClrBit_u32u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 BitPn;
+    boolean Expected;
+} GetBit_u32u8_u8[] = {
+    { 0x00000000u,  0u, FALSE },
+    { 0x00000000u,  1u, FALSE },
+    { 0x00000000u,  2u, FALSE },
+    { 0x00000000u,  3u, FALSE },
+    { 0x00000000u,  4u, FALSE },
+    { 0x00000000u,  5u, FALSE },
+    { 0x00000000u,  6u, FALSE },
+    { 0x00000000u,  7u, FALSE },
+    { 0x00000000u,  8u, FALSE },
+    { 0x00000000u,  9u, FALSE },
+    { 0x00000000u, 10u, FALSE },
+    { 0x00000000u, 11u, FALSE },
+    { 0x00000000u, 12u, FALSE },
+    { 0x00000000u, 13u, FALSE },
+    { 0x00000000u, 14u, FALSE },
+    { 0x00000000u, 15u, FALSE },
+    { 0x00000000u, 16u, FALSE },
+    { 0x00000000u, 17u, FALSE },
+    { 0x00000000u, 18u, FALSE },
+    { 0x00000000u, 19u, FALSE },
+    { 0x00000000u, 20u, FALSE },
+    { 0x00000000u, 21u, FALSE },
+    { 0x00000000u, 22u, FALSE },
+    { 0x00000000u, 23u, FALSE },
+    { 0x00000000u, 24u, FALSE },
+    { 0x00000000u, 25u, FALSE },
+    { 0x00000000u, 26u, FALSE },
+    { 0x00000000u, 27u, FALSE },
+    { 0x00000000u, 28u, FALSE },
+    { 0x00000000u, 29u, FALSE },
+    { 0x00000000u, 30u, FALSE },
+    { 0x00000000u, 31u, FALSE },
+    { 0xFFFFFFFFu,  0u,  TRUE },
+    { 0xFFFFFFFFu,  1u,  TRUE },
+    { 0xFFFFFFFFu,  2u,  TRUE },
+    { 0xFFFFFFFFu,  3u,  TRUE },
+    { 0xFFFFFFFFu,  4u,  TRUE },
+    { 0xFFFFFFFFu,  5u,  TRUE },
+    { 0xFFFFFFFFu,  6u,  TRUE },
+    { 0xFFFFFFFFu,  7u,  TRUE },
+    { 0xFFFFFFFFu,  8u,  TRUE },
+    { 0xFFFFFFFFu,  9u,  TRUE },
+    { 0xFFFFFFFFu, 10u,  TRUE },
+    { 0xFFFFFFFFu, 11u,  TRUE },
+    { 0xFFFFFFFFu, 12u,  TRUE },
+    { 0xFFFFFFFFu, 13u,  TRUE },
+    { 0xFFFFFFFFu, 14u,  TRUE },
+    { 0xFFFFFFFFu, 15u,  TRUE },
+    { 0xFFFFFFFFu, 16u,  TRUE },
+    { 0xFFFFFFFFu, 17u,  TRUE },
+    { 0xFFFFFFFFu, 18u,  TRUE },
+    { 0xFFFFFFFFu, 19u,  TRUE },
+    { 0xFFFFFFFFu, 20u,  TRUE },
+    { 0xFFFFFFFFu, 21u,  TRUE },
+    { 0xFFFFFFFFu, 22u,  TRUE },
+    { 0xFFFFFFFFu, 23u,  TRUE },
+    { 0xFFFFFFFFu, 24u,  TRUE },
+    { 0xFFFFFFFFu, 25u,  TRUE },
+    { 0xFFFFFFFFu, 26u,  TRUE },
+    { 0xFFFFFFFFu, 27u,  TRUE },
+    { 0xFFFFFFFFu, 28u,  TRUE },
+    { 0xFFFFFFFFu, 29u,  TRUE },
+    { 0xFFFFFFFFu, 30u,  TRUE },
+    { 0xFFFFFFFFu, 31u,  TRUE },
+    { 0x55555555u,  0u,  TRUE },
+    { 0x55555555u,  1u, FALSE },
+    { 0x55555555u,  2u,  TRUE },
+    { 0x55555555u,  3u, FALSE },
+    { 0x55555555u,  4u,  TRUE },
+    { 0x55555555u,  5u, FALSE },
+    { 0x55555555u,  6u,  TRUE },
+    { 0x55555555u,  7u, FALSE },
+    { 0x55555555u,  8u,  TRUE },
+    { 0x55555555u,  9u, FALSE },
+    { 0x55555555u, 10u,  TRUE },
+    { 0x55555555u, 11u, FALSE },
+    { 0x55555555u, 12u,  TRUE },
+    { 0x55555555u, 13u, FALSE },
+    { 0x55555555u, 14u,  TRUE },
+    { 0x55555555u, 15u, FALSE },
+    { 0x55555555u, 16u,  TRUE },
+    { 0x55555555u, 17u, FALSE },
+    { 0x55555555u, 18u,  TRUE },
+    { 0x55555555u, 19u, FALSE },
+    { 0x55555555u, 20u,  TRUE },
+    { 0x55555555u, 21u, FALSE },
+    { 0x55555555u, 22u,  TRUE },
+    { 0x55555555u, 23u, FALSE },
+    { 0x55555555u, 24u,  TRUE },
+    { 0x55555555u, 25u, FALSE },
+    { 0x55555555u, 26u,  TRUE },
+    { 0x55555555u, 27u, FALSE },
+    { 0x55555555u, 28u,  TRUE },
+    { 0x55555555u, 29u, FALSE },
+    { 0x55555555u, 30u,  TRUE },
+    { 0x55555555u, 31u, FALSE },
+    { 0x89ABCDEFu,  0u,  TRUE },
+    { 0x89ABCDEFu,  1u,  TRUE },
+    { 0x89ABCDEFu,  2u,  TRUE },
+    { 0x89ABCDEFu,  3u,  TRUE },
+    { 0x89ABCDEFu,  4u, FALSE },
+    { 0x89ABCDEFu,  5u,  TRUE },
+    { 0x89ABCDEFu,  6u,  TRUE },
+    { 0x89ABCDEFu,  7u,  TRUE },
+    { 0x89ABCDEFu,  8u,  TRUE },
+    { 0x89ABCDEFu,  9u, FALSE },
+    { 0x89ABCDEFu, 10u,  TRUE },
+    { 0x89ABCDEFu, 11u,  TRUE },
+    { 0x89ABCDEFu, 12u, FALSE },
+    { 0x89ABCDEFu, 13u, FALSE },
+    { 0x89ABCDEFu, 14u,  TRUE },
+    { 0x89ABCDEFu, 15u,  TRUE },
+    { 0x89ABCDEFu, 16u,  TRUE },
+    { 0x89ABCDEFu, 17u,  TRUE },
+    { 0x89ABCDEFu, 18u, FALSE },
+    { 0x89ABCDEFu, 19u,  TRUE },
+    { 0x89ABCDEFu, 20u, FALSE },
+    { 0x89ABCDEFu, 21u,  TRUE },
+    { 0x89ABCDEFu, 22u, FALSE },
+    { 0x89ABCDEFu, 23u,  TRUE },
+    { 0x89ABCDEFu, 24u,  TRUE },
+    { 0x89ABCDEFu, 25u, FALSE },
+    { 0x89ABCDEFu, 26u, FALSE },
+    { 0x89ABCDEFu, 27u,  TRUE },
+    { 0x89ABCDEFu, 28u, FALSE },
+    { 0x89ABCDEFu, 29u, FALSE },
+    { 0x89ABCDEFu, 30u, FALSE },
+    { 0x89ABCDEFu, 31u,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_GetBit_u32u8_u8 vectors**
+ *
+ * The test runs the 128 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00016, SWS_Bfx_00017, SWS_Bfx_00020
+ */
+void test__Bfx_GetBit_u32u8_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( GetBit_u32u8_u8 ) / sizeof( GetBit_u32u8_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( GetBit_u32u8_u8[ i ].Expected, Bfx_GetBit_u32u8_u8( GetBit_u32u8_u8[ i ].Data, GetBit_u32u8_u8[ i ].BitPn ), Vector( "Bfx_GetBit_u32u8_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 BitPn;
+    boolean Status;
+    uint32 Expected;
+} PutBit_u32u8u8[] = {
+    { 0x00000000u,  0u, FALSE, 0x00000000u },
+    { 0x00000000u,  0u,  TRUE, 0x00000001u },
+    { 0x00000000u,  1u, FALSE, 0x00000000u },
+    { 0x00000000u,  1u,  TRUE, 0x00000002u },
+    { 0x00000000u,  2u, FALSE, 0x00000000u },
+    { 0x00000000u,  2u,  TRUE, 0x00000004u },
+    { 0x00000000u,  3u, FALSE, 0x00000000u },
+    { 0x00000000u,  3u,  TRUE, 0x00000008u },
+    { 0x00000000u,  4u, FALSE, 0x00000000u },
+    { 0x00000000u,  4u,  TRUE, 0x00000010u },
+    { 0x00000000u,  5u, FALSE, 0x00000000u },
+    { 0x00000000u,  5u,  TRUE, 0x00000020u },
+    { 0x00000000u,  6u, FALSE, 0x00000000u },
+    { 0x00000000u,  6u,  TRUE, 0x00000040u },
+    { 0x00000000u,  7u, FALSE, 0x00000000u },
+    { 0x00000000u,  7u,  TRUE, 0x00000080u },
+    { 0x00000000u,  8u, FALSE, 0x00000000u },
+    { 0x00000000u,  8u,  TRUE, 0x00000100u },
+    { 0x00000000u,  9u, FALSE, 0x00000000u },
+    { 0x00000000u,  9u,  TRUE, 0x00000200u },
+    { 0x00000000u, 10u, FALSE, 0x00000000u },
+    { 0x00000000u, 10u,  TRUE, 0x00000400u },
+    { 0x00000000u, 11u, FALSE, 0x00000000u },
+    { 0x00000000u, 11u,  TRUE, 0x00000800u },
+    { 0x00000000u, 12u, FALSE, 0x00000000u },
+    { 0x00000000u, 12u,  TRUE, 0x00001000u },
+    { 0x00000000u, 13u, FALSE, 0x00000000u },
+    { 0x00000000u, 13u,  TRUE, 0x00002000u },
+    { 0x00000000u, 14u, FALSE, 0x00000000u },
+    { 0x00000000u, 14u,  TRUE, 0x00004000u },
+    { 0x00000000u, 15u, FALSE, 0x00000000u },
+    { 0x00000000u, 15u,  TRUE, 0x00008000u },
+    { 0x00000000u, 16u, FALSE, 0x00000000u },
+    { 0x00000000u, 16u,  TRUE, 0x00010000u },
+    { 0x00000000u, 17u, FALSE, 0x00000000u },
+    { 0x00000000u, 17u,  TRUE, 0x00020000u },
+    { 0x00000000u, 18u, FALSE, 0x00000000u },
+    { 0x00000000u, 18u,  TRUE, 0x00040000u },
+    { 0x00000000u, 19u, FALSE, 0x00000000u },
+    { 0x00000000u, 19u,  TRUE, 0x00080000u },
+    { 0x00000000u, 20u, FALSE, 0x00000000u },
+    { 0x00000000u, 20u,  TRUE, 0x00100000u },
+    { 0x00000000u, 21u, FALSE, 0x00000000u },
+    { 0x00000000u, 21u,  TRUE, 0x00200000u },
+    { 0x00000000u, 22u, FALSE, 0x00000000u },
+    { 0x00000000u, 22u,  TRUE, 0x00400000u },
+    { 0x00000000u, 23u, FALSE, 0x00000000u },
+    { 0x00000000u, 23u,  TRUE, 0x00800000u },
+    { 0x00000000u, 24u, FALSE, 0x00000000u },
+    { 0x00000000u, 24u,  TRUE, 0x01000000u },
+    { 0x00000000u, 25u, FALSE, 0x00000000u },
+    { 0x00000000u, 25u,  TRUE, 0x02000000u },
+    { 0x00000000u, 26u, FALSE, 0x00000000u },
+    { 0x00000000u, 26u,  TRUE, 0x04000000u },
+    { 0x00000000u, 27u, FALSE, 0x00000000u },
+    { 0x00000000u, 27u,  TRUE, 0x08000000u },
+    { 0x00000000u, 28u, FALSE, 0x00000000u },
+    { 0x00000000u, 28u,  TRUE, 0x10000000u },
+    { 0x00000000u, 29u, FALSE, 0x00000000u },
+    { 0x00000000u, 29u,  TRUE, 0x20000000u },
+    { 0x00000000u, 30u, FALSE, 0x00000000u },
+    { 0x00000000u, 30u,  TRUE, 0x40000000u },
+    { 0x00000000u, 31u, FALSE, 0x00000000u },
+    { 0x00000000u, 31u,  TRUE, 0x80000000u },
+    { 0xFFFFFFFFu,  0u, FALSE, 0xFFFFFFFEu },
+    { 0xFFFFFFFFu,  0u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  1u, FALSE, 0xFFFFFFFDu },
+    { 0xFFFFFFFFu,  1u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  2u, FALSE, 0xFFFFFFFBu },
+    { 0xFFFFFFFFu,  2u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  3u, FALSE, 0xFFFFFFF7u },
+    { 0xFFFFFFFFu,  3u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  4u, FALSE, 0xFFFFFFEFu },
+    { 0xFFFFFFFFu,  4u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  5u, FALSE, 0xFFFFFFDFu },
+    { 0xFFFFFFFFu,  5u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  6u, FALSE, 0xFFFFFFBFu },
+    { 0xFFFFFFFFu,  6u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  7u, FALSE, 0xFFFFFF7Fu },
+    { 0xFFFFFFFFu,  7u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  8u, FALSE, 0xFFFFFEFFu },
+    { 0xFFFFFFFFu,  8u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  9u, FALSE, 0xFFFFFDFFu },
+    { 0xFFFFFFFFu,  9u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 10u, FALSE, 0xFFFFFBFFu },
+    { 0xFFFFFFFFu, 10u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 11u, FALSE, 0xFFFFF7FFu },
+    { 0xFFFFFFFFu, 11u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 12u, FALSE, 0xFFFFEFFFu },
+    { 0xFFFFFFFFu, 12u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 13u, FALSE, 0xFFFFDFFFu },
+    { 0xFFFFFFFFu, 13u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 14u, FALSE, 0xFFFFBFFFu },
+    { 0xFFFFFFFFu, 14u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 15u, FALSE, 0xFFFF7FFFu },
+    { 0xFFFFFFFFu, 15u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 16u, FALSE, 0xFFFEFFFFu },
+    { 0xFFFFFFFFu, 16u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 17u, FALSE, 0xFFFDFFFFu },
+    { 0xFFFFFFFFu, 17u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 18u, FALSE, 0xFFFBFFFFu },
+    { 0xFFFFFFFFu, 18u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 19u, FALSE, 0xFFF7FFFFu },
+    { 0xFFFFFFFFu, 19u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 20u, FALSE, 0xFFEFFFFFu },
+    { 0xFFFFFFFFu, 20u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 21u, FALSE, 0xFFDFFFFFu },
+    { 0xFFFFFFFFu, 21u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 22u, FALSE, 0xFFBFFFFFu },
+    { 0xFFFFFFFFu, 22u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 23u, FALSE, 0xFF7FFFFFu },
+    { 0xFFFFFFFFu, 23u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 24u, FALSE, 0xFEFFFFFFu },
+    { 0xFFFFFFFFu, 24u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 25u, FALSE, 0xFDFFFFFFu },
+    { 0xFFFFFFFFu, 25u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 26u, FALSE, 0xFBFFFFFFu },
+    { 0xFFFFFFFFu, 26u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 27u, FALSE, 0xF7FFFFFFu },
+    { 0xFFFFFFFFu, 27u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 28u, FALSE, 0xEFFFFFFFu },
+    { 0xFFFFFFFFu, 28u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 29u, FALSE, 0xDFFFFFFFu },
+    { 0xFFFFFFFFu, 29u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 30u, FALSE, 0xBFFFFFFFu },
+    { 0xFFFFFFFFu, 30u,  TRUE, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 31u, FALSE, 0x7FFFFFFFu },
+    { 0xFFFFFFFFu, 31u,  TRUE, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  0u, FALSE, 0x89ABCDEEu },
+    { 0x89ABCDEFu,  0u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  1u, FALSE, 0x89ABCDEDu },
+    { 0x89ABCDEFu,  1u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  2u, FALSE, 0x89ABCDEBu },
+    { 0x89ABCDEFu,  2u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  3u, FALSE, 0x89ABCDE7u },
+    { 0x89ABCDEFu,  3u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  4u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  4u,  TRUE, 0x89ABCDFFu },
+    { 0x89ABCDEFu,  5u, FALSE, 0x89ABCDCFu },
+    { 0x89ABCDEFu,  5u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  6u, FALSE, 0x89ABCDAFu },
+    { 0x89ABCDEFu,  6u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  7u, FALSE, 0x89ABCD6Fu },
+    { 0x89ABCDEFu,  7u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  8u, FALSE, 0x89ABCCEFu },
+    { 0x89ABCDEFu,  8u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  9u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  9u,  TRUE, 0x89ABCFEFu },
+    { 0x89ABCDEFu, 10u, FALSE, 0x89ABC9EFu },
+    { 0x89ABCDEFu, 10u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 11u, FALSE, 0x89ABC5EFu },
+    { 0x89ABCDEFu, 11u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 12u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 12u,  TRUE, 0x89ABDDEFu },
+    { 0x89ABCDEFu, 13u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 13u,  TRUE, 0x89ABEDEFu },
+    { 0x89ABCDEFu, 14u, FALSE, 0x89AB8DEFu },
+    { 0x89ABCDEFu, 14u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 15u, FALSE, 0x89AB4DEFu },
+    { 0x89ABCDEFu, 15u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 16u, FALSE, 0x89AACDEFu },
+    { 0x89ABCDEFu, 16u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 17u, FALSE, 0x89A9CDEFu },
+    { 0x89ABCDEFu, 17u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 18u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 18u,  TRUE, 0x89AFCDEFu },
+    { 0x89ABCDEFu, 19u, FALSE, 0x89A3CDEFu },
+    { 0x89ABCDEFu, 19u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 20u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 20u,  TRUE, 0x89BBCDEFu },
+    { 0x89ABCDEFu, 21u, FALSE, 0x898BCDEFu },
+    { 0x89ABCDEFu, 21u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 22u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 22u,  TRUE, 0x89EBCDEFu },
+    { 0x89ABCDEFu, 23u, FALSE, 0x892BCDEFu },
+    { 0x89ABCDEFu, 23u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 24u, FALSE, 0x88ABCDEFu },
+    { 0x89ABCDEFu, 24u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 25u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 25u,  TRUE, 0x8BABCDEFu },
+    { 0x89ABCDEFu, 26u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 26u,  TRUE, 0x8DABCDEFu },
+    { 0x89ABCDEFu, 27u, FALSE, 0x81ABCDEFu },
+    { 0x89ABCDEFu, 27u,  TRUE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 28u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 28u,  TRUE, 0x99ABCDEFu },
+    { 0x89ABCDEFu, 29u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 29u,  TRUE, 0xA9ABCDEFu },
+    { 0x89ABCDEFu, 30u, FALSE, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 30u,  TRUE, 0xC9ABCDEFu },
+    { 0x89ABCDEFu, 31u, FALSE, 0x09ABCDEFu },
+    { 0x89ABCDEFu, 31u,  TRUE, 0x89ABCDEFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_PutBit_u32u8u8 vectors**
+ *
+ * The test runs the 192 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00130, SWS_Bfx_00132
+ */
+void test__Bfx_PutBit_u32u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( PutBit_u32u8u8 ) / sizeof( PutBit_u32u8u8[ 0 ] ) ); i++ )
+    {
+        uint32 Data = PutBit_u32u8u8[ i ].Data;
+        Bfx_PutBit_u32u8u8( &Data, PutBit_u32u8u8[ i ].BitPn, PutBit_u32u8u8[ i ].Status );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( PutBit_u32u8u8[ i ].Expected, Data, Vector( "Bfx_PutBit_u32u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 BitStartPn;
+    uint8 BitLn;
+    uint8 Status;
+    uint32 Expected;
+} SetBits_u32u8u8u8[] = {
+    { 0x00000000u,  0u, 32u, 1u, 0xFFFFFFFFu },
+    { 0x55555555u,  0u,  0u, 0u, 0x55555555u },
+    { 0x55555555u,  0u,  0u, 1u, 0x55555555u },
+    { 0x55555555u,  0u,  1u, 0u, 0x55555554u },
+    { 0x55555555u,  0u,  1u, 1u, 0x55555555u },
+    { 0x55555555u,  0u,  2u, 0u, 0x55555554u },
+    { 0x55555555u,  0u,  2u, 1u, 0x55555557u },
+    { 0x55555555u,  0u,  3u, 0u, 0x55555550u },
+    { 0x55555555u,  0u,  3u, 1u, 0x55555557u },
+    { 0x55555555u,  0u,  4u, 0u, 0x55555550u },
+    { 0x55555555u,  0u,  4u, 1u, 0x5555555Fu },
+    { 0x55555555u,  0u,  5u, 0u, 0x55555540u },
+    { 0x55555555u,  0u,  5u, 1u, 0x5555555Fu },
+    { 0x55555555u,  0u,  6u, 0u, 0x55555540u },
+    { 0x55555555u,  0u,  6u, 1u, 0x5555557Fu },
+    { 0x55555555u,  0u,  7u, 0u, 0x55555500u },
+    { 0x55555555u,  0u,  7u, 1u, 0x5555557Fu },
+    { 0x55555555u,  0u,  8u, 0u, 0x55555500u },
+    { 0x55555555u,  0u,  8u, 1u, 0x555555FFu },
+    { 0x55555555u,  0u,  9u, 0u, 0x55555400u },
+    { 0x55555555u,  0u,  9u, 1u, 0x555555FFu },
+    { 0x55555555u,  0u, 10u, 0u, 0x55555400u },
+    { 0x55555555u,  0u, 10u, 1u, 0x555557FFu },
+    { 0x55555555u,  0u, 11u, 0u, 0x55555000u },
+    { 0x55555555u,  0u, 11u, 1u, 0x555557FFu },
+    { 0x55555555u,  0u, 12u, 0u, 0x55555000u },
+    { 0x55555555u,  0u, 12u, 1u, 0x55555FFFu },
+    { 0x55555555u,  0u, 13u, 0u, 0x55554000u },
+    { 0x55555555u,  0u, 13u, 1u, 0x55555FFFu },
+    { 0x55555555u,  0u, 14u, 0u, 0x55554000u },
+    { 0x55555555u,  0u, 14u, 1u, 0x55557FFFu },
+    { 0x55555555u,  0u, 15u, 0u, 0x55550000u },
+    { 0x55555555u,  0u, 15u, 1u, 0x55557FFFu },
+    { 0x55555555u,  0u, 16u, 0u, 0x55550000u },
+    { 0x55555555u,  0u, 16u, 1u, 0x5555FFFFu },
+    { 0x55555555u,  0u, 17u, 0u, 0x55540000u },
+    { 0x55555555u,  0u, 17u, 1u, 0x5555FFFFu },
+    { 0x55555555u,  0u, 18u, 0u, 0x55540000u },
+    { 0x55555555u,  0u, 18u, 1u, 0x5557FFFFu },
+    { 0x55555555u,  0u, 19u, 0u, 0x55500000u },
+    { 0x55555555u,  0u, 19u, 1u, 0x5557FFFFu },
+    { 0x55555555u,  0u, 20u, 0u, 0x55500000u },
+    { 0x55555555u,  0u, 20u, 1u, 0x555FFFFFu },
+    { 0x55555555u,  0u, 21u, 0u, 0x55400000u },
+    { 0x55555555u,  0u, 21u, 1u, 0x555FFFFFu },
+    { 0x55555555u,  0u, 22u, 0u, 0x55400000u },
+    { 0x55555555u,  0u, 22u, 1u, 0x557FFFFFu },
+    { 0x55555555u,  0u, 23u, 0u, 0x55000000u },
+    { 0x55555555u,  0u, 23u, 1u, 0x557FFFFFu },
+    { 0x55555555u,  0u, 24u, 0u, 0x55000000u },
+    { 0x55555555u,  0u, 24u, 1u, 0x55FFFFFFu },
+    { 0x55555555u,  0u, 25u, 0u, 0x54000000u },
+    { 0x55555555u,  0u, 25u, 1u, 0x55FFFFFFu },
+    { 0x55555555u,  0u, 26u, 0u, 0x54000000u },
+    { 0x55555555u,  0u, 26u, 1u, 0x57FFFFFFu },
+    { 0x55555555u,  0u, 27u, 0u, 0x50000000u },
+    { 0x55555555u,  0u, 27u, 1u, 0x57FFFFFFu },
+    { 0x55555555u,  0u, 28u, 0u, 0x50000000u },
+    { 0x55555555u,  0u, 28u, 1u, 0x5FFFFFFFu },
+    { 0x55555555u,  0u, 29u, 0u, 0x40000000u },
+    { 0x55555555u,  0u, 29u, 1u, 0x5FFFFFFFu },
+    { 0x55555555u,  0u, 30u, 0u, 0x40000000u },
+    { 0x55555555u,  0u, 30u, 1u, 0x7FFFFFFFu },
+    { 0x55555555u,  0u, 31u, 0u, 0x00000000u },
+    { 0x55555555u,  0u, 31u, 1u, 0x7FFFFFFFu },
+    { 0x55555555u,  0u, 32u, 0u, 0x00000000u },
+    { 0x55555555u,  0u, 32u, 1u, 0xFFFFFFFFu },
+    { 0x55555555u,  1u,  0u, 0u, 0x55555555u },
+    { 0x55555555u,  1u,  0u, 1u, 0x55555555u },
+    { 0x55555555u,  1u,  1u, 0u, 0x55555555u },
+    { 0x55555555u,  1u,  1u, 1u, 0x55555557u },
+    { 0x55555555u,  1u,  2u, 0u, 0x55555551u },
+    { 0x55555555u,  1u,  2u, 1u, 0x55555557u },
+    { 0x55555555u,  1u,  3u, 0u, 0x55555551u },
+    { 0x55555555u,  1u,  3u, 1u, 0x5555555Fu },
+    { 0x55555555u,  1u,  4u, 0u, 0x55555541u },
+    { 0x55555555u,  1u,  4u, 1u, 0x5555555Fu },
+    { 0x55555555u,  1u,  5u, 0u, 0x55555541u },
+    { 0x55555555u,  1u,  5u, 1u, 0x5555557Fu },
+    { 0x55555555u,  1u,  6u, 0u, 0x55555501u },
+    { 0x55555555u,  1u,  6u, 1u, 0x5555557Fu },
+    { 0x55555555u,  1u,  7u, 0u, 0x55555501u },
+    { 0x55555555u,  1u,  7u, 1u, 0x555555FFu },
+    { 0x55555555u,  1u,  8u, 0u, 0x55555401u },
+    { 0x55555555u,  1u,  8u, 1u, 0x555555FFu },
+    { 0x55555555u,  1u,  9u, 0u, 0x55555401u },
+    { 0x55555555u,  1u,  9u, 1u, 0x555557FFu },
+    { 0x55555555u,  1u, 10u, 0u, 0x55555001u },
+    { 0x55555555u,  1u, 10u, 1u, 0x555557FFu },
+    { 0x55555555u,  1u, 11u, 0u, 0x55555001u },
+    { 0x55555555u,  1u, 11u, 1u, 0x55555FFFu },
+    { 0x55555555u,  1u, 12u, 0u, 0x55554001u },
+    { 0x55555555u,  1u, 12u, 1u, 0x55555FFFu },
+    { 0x55555555u,  1u, 13u, 0u, 0x55554001u },
+    { 0x55555555u,  1u, 13u, 1u, 0x55557FFFu },
+    { 0x55555555u,  1u, 14u, 0u, 0x55550001u },
+    { 0x55555555u,  1u, 14u, 1u, 0x55557FFFu },
+    { 0x55555555u,  1u, 15u, 0u, 0x55550001u },
+    { 0x55555555u,  1u, 15u, 1u, 0x5555FFFFu },
+    { 0x55555555u,  1u, 16u, 0u, 0x55540001u },
+    { 0x55555555u,  1u, 16u, 1u, 0x5555FFFFu },
+    { 0x55555555u,  1u, 17u, 0u, 0x55540001u },
+    { 0x55555555u,  1u, 17u, 1u, 0x5557FFFFu },
+    { 0x55555555u,  1u, 18u, 0u, 0x55500001u },
+    { 0x55555555u,  1u, 18u, 1u, 0x5557FFFFu },
+    { 0x55555555u,  1u, 19u, 0u, 0x55500001u },
+    { 0x55555555u,  1u, 19u, 1u, 0x555FFFFFu },
+    { 0x55555555u,  1u, 20u, 0u, 0x55400001u },
+    { 0x55555555u,  1u, 20u, 1u, 0x555FFFFFu },
+    { 0x55555555u,  1u, 21u, 0u, 0x55400001u },
+    { 0x55555555u,  1u, 21u, 1u, 0x557FFFFFu },
+    { 0x55555555u,  1u, 22u, 0u, 0x55000001u },
+    { 0x55555555u,  1u, 22u, 1u, 0x557FFFFFu },
+    { 0x55555555u,  1u, 23u, 0u, 0x55000001u },
+    { 0x55555555u,  1u, 23u, 1u, 0x55FFFFFFu },
+    { 0x55555555u,  1u, 24u, 0u, 0x54000001u },
+    { 0x55555555u,  1u, 24u, 1u, 0x55FFFFFFu },
+    { 0x55555555u,  1u, 25u, 0u, 0x54000001u },
+    { 0x55555555u,  1u, 25u, 1u, 0x57FFFFFFu },
+    { 0x55555555u,  1u, 26u, 0u, 0x50000001u },
+    { 0x55555555u,  1u, 26u, 1u, 0x57FFFFFFu },
+    { 0x55555555u,  1u, 27u, 0u, 0x50000001u },
+    { 0x55555555u,  1u, 27u, 1u, 0x5FFFFFFFu },
+    { 0x55555555u,  1u, 28u, 0u, 0x40000001u },
+    { 0x55555555u,  1u, 28u, 1u, 0x5FFFFFFFu },
+    { 0x55555555u,  1u, 29u, 0u, 0x40000001u },
+    { 0x55555555u,  1u, 29u, 1u, 0x7FFFFFFFu },
+    { 0x55555555u,  1u, 30u, 0u, 0x00000001u },
+    { 0x55555555u,  1u, 30u, 1u, 0x7FFFFFFFu },
+    { 0x55555555u,  1u, 31u, 0u, 0x00000001u },
+    { 0x55555555u,  1u, 31u, 1u, 0xFFFFFFFFu },
+    { 0x55555555u,  2u,  0u, 0u, 0x55555555u },
+    { 0x55555555u,  2u,  0u, 1u, 0x55555555u },
+    { 0x55555555u,  2u,  1u, 0u, 0x55555551u },
+    { 0x55555555u,  2u,  1u, 1u, 0x55555555u },
+    { 0x55555555u,  2u,  2u, 0u, 0x55555551u },
+    { 0x55555555u,  2u,  2u, 1u, 0x5555555Du },
+    { 0x55555555u,  2u,  3u, 0u, 0x55555541u },
+    { 0x55555555u,  2u,  3u, 1u, 0x5555555Du },
+    { 0x55555555u,  2u,  4u, 0u, 0x55555541u },
+    { 0x55555555u,  2u,  4u, 1u, 0x5555557Du },
+    { 0x55555555u,  2u,  5u, 0u, 0x55555501u },
+    { 0x55555555u,  2u,  5u, 1u, 0x5555557Du },
+    { 0x55555555u,  2u,  6u, 0u, 0x55555501u },
+    { 0x55555555u,  2u,  6u, 1u, 0x555555FDu },
+    { 0x55555555u,  2u,  7u, 0u, 0x55555401u },
+    { 0x55555555u,  2u,  7u, 1u, 0x555555FDu },
+    { 0x55555555u,  2u,  8u, 0u, 0x55555401u },
+    { 0x55555555u,  2u,  8u, 1u, 0x555557FDu },
+    { 0x55555555u,  2u,  9u, 0u, 0x55555001u },
+    { 0x55555555u,  2u,  9u, 1u, 0x555557FDu },
+    { 0x55555555u,  2u, 10u, 0u, 0x55555001u },
+    { 0x55555555u,  2u, 10u, 1u, 0x55555FFDu },
+    { 0x55555555u,  2u, 11u, 0u, 0x55554001u },
+    { 0x55555555u,  2u, 11u, 1u, 0x55555FFDu },
+    { 0x55555555u,  2u, 12u, 0u, 0x55554001u },
+    { 0x55555555u,  2u, 12u, 1u, 0x55557FFDu },
+    { 0x55555555u,  2u, 13u, 0u, 0x55550001u },
+    { 0x55555555u,  2u, 13u, 1u, 0x55557FFDu },
+    { 0x55555555u,  2u, 14u, 0u, 0x55550001u },
+    { 0x55555555u,  2u, 14u, 1u, 0x5555FFFDu },
+    { 0x55555555u,  2u, 15u, 0u, 0x55540001u },
+    { 0x55555555u,  2u, 15u, 1u, 0x5555FFFDu },
+    { 0x55555555u,  2u, 16u, 0u, 0x55540001u },
+    { 0x55555555u,  2u, 16u, 1u, 0x5557FFFDu },
+    { 0x55555555u,  2u, 17u, 0u, 0x55500001u },
+    { 0x55555555u,  2u, 17u, 1u, 0x5557FFFDu },
+    { 0x55555555u,  2u, 18u, 0u, 0x55500001u },
+    { 0x55555555u,  2u, 18u, 1u, 0x555FFFFDu },
+    { 0x55555555u,  2u, 19u, 0u, 0x55400001u },
+    { 0x55555555u,  2u, 19u, 1u, 0x555FFFFDu },
+    { 0x55555555u,  2u, 20u, 0u, 0x55400001u },
+    { 0x55555555u,  2u, 20u, 1u, 0x557FFFFDu },
+    { 0x55555555u,  2u, 21u, 0u, 0x55000001u },
+    { 0x55555555u,  2u, 21u, 1u, 0x557FFFFDu },
+    { 0x55555555u,  2u, 22u, 0u, 0x55000001u },
+    { 0x55555555u,  2u, 22u, 1u, 0x55FFFFFDu },
+    { 0x55555555u,  2u, 23u, 0u, 0x54000001u },
+    { 0x55555555u,  2u, 23u, 1u, 0x55FFFFFDu },
+    { 0x55555555u,  2u, 24u, 0u, 0x54000001u },
+    { 0x55555555u,  2u, 24u, 1u, 0x57FFFFFDu },
+    { 0x55555555u,  2u, 25u, 0u, 0x50000001u },
+    { 0x55555555u,  2u, 25u, 1u, 0x57FFFFFDu },
+    { 0x55555555u,  2u, 26u, 0u, 0x50000001u },
+    { 0x55555555u,  2u, 26u, 1u, 0x5FFFFFFDu },
+    { 0x55555555u,  2u, 27u, 0u, 0x40000001u },
+    { 0x55555555u,  2u, 27u, 1u, 0x5FFFFFFDu },
+    { 0x55555555u,  2u, 28u, 0u, 0x40000001u },
+    { 0x55555555u,  2u, 28u, 1u, 0x7FFFFFFDu },
+    { 0x55555555u,  2u, 29u, 0u, 0x00000001u },
+    { 0x55555555u,  2u, 29u, 1u, 0x7FFFFFFDu },
+    { 0x55555555u,  2u, 30u, 0u, 0x00000001u },
+    { 0x55555555u,  2u, 30u, 1u, 0xFFFFFFFDu },
+    { 0x55555555u,  3u,  0u, 0u, 0x55555555u },
+    { 0x55555555u,  3u,  0u, 1u, 0x55555555u },
+    { 0x55555555u,  3u,  1u, 0u, 0x55555555u },
+    { 0x55555555u,  3u,  1u, 1u, 0x5555555Du },
+    { 0x55555555u,  3u,  2u, 0u, 0x55555545u },
+    { 0x55555555u,  3u,  2u, 1u, 0x5555555Du },
+    { 0x55555555u,  3u,  3u, 0u, 0x55555545u },
+    { 0x55555555u,  3u,  3u, 1u, 0x5555557Du },
+    { 0x55555555u,  3u,  4u, 0u, 0x55555505u },
+    { 0x55555555u,  3u,  4u, 1u, 0x5555557Du },
+    { 0x55555555u,  3u,  5u, 0u, 0x55555505u },
+    { 0x55555555u,  3u,  5u, 1u, 0x555555FDu },
+    { 0x55555555u,  3u,  6u, 0u, 0x55555405u },
+    { 0x55555555u,  3u,  6u, 1u, 0x555555FDu },
+    { 0x55555555u,  3u,  7u, 0u, 0x55555405u },
+    { 0x55555555u,  3u,  7u, 1u, 0x555557FDu },
+    { 0x55555555u,  3u,  8u, 0u, 0x55555005u },
+    { 0x55555555u,  3u,  8u, 1u, 0x555557FDu },
+    { 0x55555555u,  3u,  9u, 0u, 0x55555005u },
+    { 0x55555555u,  3u,  9u, 1u, 0x55555FFDu },
+    { 0x55555555u,  3u, 10u, 0u, 0x55554005u },
+    { 0x55555555u,  3u, 10u, 1u, 0x55555FFDu },
+    { 0x55555555u,  3u, 11u, 0u, 0x55554005u },
+    { 0x55555555u,  3u, 11u, 1u, 0x55557FFDu },
+    { 0x55555555u,  3u, 12u, 0u, 0x55550005u },
+    { 0x55555555u,  3u, 12u, 1u, 0x55557FFDu },
+    { 0x55555555u,  3u, 13u, 0u, 0x55550005u },
+    { 0x55555555u,  3u, 13u, 1u, 0x5555FFFDu },
+    { 0x55555555u,  3u, 14u, 0u, 0x55540005u },
+    { 0x55555555u,  3u, 14u, 1u, 0x5555FFFDu },
+    { 0x55555555u,  3u, 15u, 0u, 0x55540005u },
+    { 0x55555555u,  3u, 15u, 1u, 0x5557FFFDu },
+    { 0x55555555u,  3u, 16u, 0u, 0x55500005u },
+    { 0x55555555u,  3u, 16u, 1u, 0x5557FFFDu },
+    { 0x55555555u,  3u, 17u, 0u, 0x55500005u },
+    { 0x55555555u,  3u, 17u, 1u, 0x555FFFFDu },
+    { 0x55555555u,  3u, 18u, 0u, 0x55400005u },
+    { 0x55555555u,  3u, 18u, 1u, 0x555FFFFDu },
+    { 0x55555555u,  3u, 19u, 0u, 0x55400005u },
+    { 0x55555555u,  3u, 19u, 1u, 0x557FFFFDu },
+    { 0x55555555u,  3u, 20u, 0u, 0x55000005u },
+    { 0x55555555u,  3u, 20u, 1u, 0x557FFFFDu },
+    { 0x55555555u,  3u, 21u, 0u, 0x55000005u },
+    { 0x55555555u,  3u, 21u, 1u, 0x55FFFFFDu },
+    { 0x55555555u,  3u, 22u, 0u, 0x54000005u },
+    { 0x55555555u,  3u, 22u, 1u, 0x55FFFFFDu },
+    { 0x55555555u,  3u, 23u, 0u, 0x54000005u },
+    { 0x55555555u,  3u, 23u, 1u, 0x57FFFFFDu },
+    { 0x55555555u,  3u, 24u, 0u, 0x50000005u },
+    { 0x55555555u,  3u, 24u, 1u, 0x57FFFFFDu },
+    { 0x55555555u,  3u, 25u, 0u, 0x50000005u },
+    { 0x55555555u,  3u, 25u, 1u, 0x5FFFFFFDu },
+    { 0x55555555u,  3u, 26u, 0u, 0x40000005u },
+    { 0x55555555u,  3u, 26u, 1u, 0x5FFFFFFDu },
+    { 0x55555555u,  3u, 27u, 0u, 0x40000005u },
+    { 0x55555555u,  3u, 27u, 1u, 0x7FFFFFFDu },
+    { 0x55555555u,  3u, 28u, 0u, 0x00000005u },
+    { 0x55555555u,  3u, 28u, 1u, 0x7FFFFFFDu },
+    { 0x55555555u,  3u, 29u, 0u, 0x00000005u },
+    { 0x55555555u,  3u, 29u, 1u, 0xFFFFFFFDu },
+    { 0x55555555u,  4u,  0u, 0u, 0x55555555u },
+    { 0x55555555u,  4u,  0u, 1u, 0x55555555u },
+    { 0x55555555u,  4u,  1u, 0u, 0x55555545u },
+    { 0x55555555u,  4u,  1u, 1u, 0x55555555u },
+    { 0x55555555u,  4u,  2u, 0u, 0x55555545u },
+    { 0x55555555u,  4u,  2u, 1u, 0x55555575u },
+    { 0x55555555u,  4u,  3u, 0u, 0x55555505u },
+    { 0x55555555u,  4u,  3u, 1u, 0x55555575u },
+    { 0x55555555u,  4u,  4u, 0u, 0x55555505u },
+    { 0x55555555u,  4u,  4u, 1u, 0x555555F5u },
+    { 0x55555555u,  4u,  5u, 0u, 0x55555405u },
+    { 0x55555555u,  4u,  5u, 1u, 0x555555F5u },
+    { 0x55555555u,  4u,  6u, 0u, 0x55555405u },
+    { 0x55555555u,  4u,  6u, 1u, 0x555557F5u },
+    { 0x55555555u,  4u,  7u, 0u, 0x55555005u },
+    { 0x55555555u,  4u,  7u, 1u, 0x555557F5u },
+    { 0x55555555u,  4u,  8u, 0u, 0x55555005u },
+    { 0x55555555u,  4u,  8u, 1u, 0x55555FF5u },
+    { 0x55555555u,  4u,  9u, 0u, 0x55554005u },
+    { 0x55555555u,  4u,  9u, 1u, 0x55555FF5u },
+    { 0x55555555u,  4u, 10u, 0u, 0x55554005u },
+    { 0x55555555u,  4u, 10u, 1u, 0x55557FF5u },
+    { 0x55555555u,  4u, 11u, 0u, 0x55550005u },
+    { 0x55555555u,  4u, 11u, 1u, 0x55557FF5u },
+    { 0x55555555u,  4u, 12u, 0u, 0x55550005u },
+    { 0x55555555u,  4u, 12u, 1u, 0x5555FFF5u },
+    { 0x55555555u,  4u, 13u, 0u, 0x55540005u },
+    { 0x55555555u,  4u, 13u, 1u, 0x5555FFF5u },
+    { 0x55555555u,  4u, 14u, 0u, 0x55540005u },
+    { 0x55555555u,  4u, 14u, 1u, 0x5557FFF5u },
+    { 0x55555555u,  4u, 15u, 0u, 0x55500005u },
+    { 0x55555555u,  4u, 15u, 1u, 0x5557FFF5u },
+    { 0x55555555u,  4u, 16u, 0u, 0x55500005u },
+    { 0x55555555u,  4u, 16u, 1u, 0x555FFFF5u },
+    { 0x55555555u,  4u, 17u, 0u, 0x55400005u },
+    { 0x55555555u,  4u, 17u, 1u, 0x555FFFF5u },
+    { 0x55555555u,  4u, 18u, 0u, 0x55400005u },
+    { 0x55555555u,  4u, 18u, 1u, 0x557FFFF5u },
+    { 0x55555555u,  4u, 19u, 0u, 0x55000005u },
+    { 0x55555555u,  4u, 19u, 1u, 0x557FFFF5u },
+    { 0x55555555u,  4u, 20u, 0u, 0x55000005u },
+    { 0x55555555u,  4u, 20u, 1u, 0x55FFFFF5u },
+    { 0x55555555u,  4u, 21u, 0u, 0x54000005u },
+    { 0x55555555u,  4u, 21u, 1u, 0x55FFFFF5u },
+    { 0x55555555u,  4u, 22u, 0u, 0x54000005u },
+    { 0x55555555u,  4u, 22u, 1u, 0x57FFFFF5u },
+    { 0x55555555u,  4u, 23u, 0u, 0x50000005u },
+    { 0x55555555u,  4u, 23u, 1u, 0x57FFFFF5u },
+    { 0x55555555u,  4u, 24u, 0u, 0x50000005u },
+    { 0x55555555u,  4u, 24u, 1u, 0x5FFFFFF5u },
+    { 0x55555555u,  4u, 25u, 0u, 0x40000005u },
+    { 0x55555555u,  4u, 25u, 1u, 0x5FFFFFF5u },
+    { 0x55555555u,  4u, 26u, 0u, 0x40000005u },
+    { 0x55555555u,  4u, 26u, 1u, 0x7FFFFFF5u },
+    { 0x55555555u,  4u, 27u, 0u, 0x00000005u },
+    { 0x55555555u,  4u, 27u, 1u, 0x7FFFFFF5u },
+    { 0x55555555u,  4u, 28u, 0u, 0x00000005u },
+    { 0x55555555u,  4u, 28u, 1u, 0xFFFFFFF5u },
+    { 0x55555555u,  5u,  0u, 0u, 0x55555555u },
+    { 0x55555555u,  5u,  0u, 1u, 0x55555555u },
+    { 0x55555555u,  5u,  1u, 0u, 0x55555555u },
+    { 0x55555555u,  5u,  1u, 1u, 0x55555575u },
+    { 0x55555555u,  5u,  2u, 0u, 0x55555515u },
+    { 0x55555555u,  5u,  2u, 1u, 0x55555575u },
+    { 0x55555555u,  5u,  3u, 0u, 0x55555515u },
+    { 0x55555555u,  5u,  3u, 1u, 0x555555F5u },
+    { 0x55555555u,  5u,  4u, 0u, 0x55555415u },
+    { 0x55555555u,  5u,  4u, 1u, 0x555555F5u },
+    { 0x55555555u,  5u,  5u, 0u, 0x55555415u },
+    { 0x55555555u,  5u,  5u, 1u, 0x555557F5u },
+    { 0x55555555u,  5u,  6u, 0u, 0x55555015u },
+    { 0x55555555u,  5u,  6u, 1u, 0x555557F5u },
+    { 0x55555555u,  5u,  7u, 0u, 0x55555015u },
+    { 0x55555555u,  5u,  7u, 1u, 0x55555FF5u },
+    { 0x55555555u,  5u,  8u, 0u, 0x55554015u },
+    { 0x55555555u,  5u,  8u, 1u, 0x55555FF5u },
+    { 0x55555555u,  5u,  9u, 0u, 0x55554015u },
+    { 0x55555555u,  5u,  9u, 1u, 0x55557FF5u },
+    { 0x55555555u,  5u, 10u, 0u, 0x55550015u },
+    { 0x55555555u,  5u, 10u, 1u, 0x55557FF5u },
+    { 0x55555555u,  5u, 11u, 0u, 0x55550015u },
+    { 0x55555555u,  5u, 11u, 1u, 0x5555FFF5u },
+    { 0x55555555u,  5u, 12u, 0u, 0x55540015u },
+    { 0x55555555u,  5u, 12u, 1u, 0x5555FFF5u },
+    { 0x55555555u,  5u, 13u, 0u, 0x55540015u },
+    { 0x55555555u,  5u, 13u, 1u, 0x5557FFF5u },
+    { 0x55555555u,  5u, 14u, 0u, 0x55500015u },
+    { 0x55555555u,  5u, 14u, 1u, 0x5557FFF5u },
+    { 0x55555555u,  5u, 15u, 0u, 0x55500015u },
+    { 0x55555555u,  5u, 15u, 1u, 0x555FFFF5u },
+    { 0x55555555u,  5u, 16u, 0u, 0x55400015u },
+    { 0x55555555u,  5u, 16u, 1u, 0x555FFFF5u },
+    { 0x55555555u,  5u, 17u, 0u, 0x55400015u },
+    { 0x55555555u,  5u, 17u, 1u, 0x557FFFF5u },
+    { 0x55555555u,  5u, 18u, 0u, 0x55000015u },
+    { 0x55555555u,  5u, 18u, 1u, 0x557FFFF5u },
+    { 0x55555555u,  5u, 19u, 0u, 0x55000015u },
+    { 0x55555555u,  5u, 19u, 1u, 0x55FFFFF5u },
+    { 0x55555555u,  5u, 20u, 0u, 0x54000015u },
+    { 0x55555555u,  5u, 20u, 1u, 0x55FFFFF5u },
+    { 0x55555555u,  5u, 21u, 0u, 0x54000015u },
+    { 0x55555555u,  5u, 21u, 1u, 0x57FFFFF5u },
+    { 0x55555555u,  5u, 22u, 0u, 0x50000015u },
+    { 0x55555555u,  5u, 22u, 1u, 0x57FFFFF5u },
+    { 0x55555555u,  5u, 23u, 0u, 0x50000015u },
+    { 0x55555555u,  5u, 23u, 1u, 0x5FFFFFF5u },
+    { 0x55555555u,  5u, 24u, 0u, 0x40000015u },
+    { 0x55555555u,  5u, 24u, 1u, 0x5FFFFFF5u },
+    { 0x55555555u,  5u, 25u, 0u, 0x40000015u },
+    { 0x55555555u,  5u, 25u, 1u, 0x7FFFFFF5u },
+    { 0x55555555u,  5u, 26u, 0u, 0x00000015u },
+    { 0x55555555u,  5u, 26u, 1u, 0x7FFFFFF5u },
+    { 0x55555555u,  5u, 27u, 0u, 0x00000015u },
+    { 0x55555555u,  5u, 27u, 1u, 0xFFFFFFF5u },
+    { 0x55555555u,  6u,  0u, 0u, 0x55555555u },
+    { 0x55555555u,  6u,  0u, 1u, 0x55555555u },
+    { 0x55555555u,  6u,  1u, 0u, 0x55555515u },
+    { 0x55555555u,  6u,  1u, 1u, 0x55555555u },
+    { 0x55555555u,  6u,  2u, 0u, 0x55555515u },
+    { 0x55555555u,  6u,  2u, 1u, 0x555555D5u },
+    { 0x55555555u,  6u,  3u, 0u, 0x55555415u },
+    { 0x55555555u,  6u,  3u, 1u, 0x555555D5u },
+    { 0x55555555u,  6u,  4u, 0u, 0x55555415u },
+    { 0x55555555u,  6u,  4u, 1u, 0x555557D5u },
+    { 0x55555555u,  6u,  5u, 0u, 0x55555015u },
+    { 0x55555555u,  6u,  5u, 1u, 0x555557D5u },
+    { 0x55555555u,  6u,  6u, 0u, 0x55555015u },
+    { 0x55555555u,  6u,  6u, 1u, 0x55555FD5u },
+    { 0x55555555u,  6u,  7u, 0u, 0x55554015u },
+    { 0x55555555u,  6u,  7u, 1u, 0x55555FD5u },
+    { 0x55555555u,  6u,  8u, 0u, 0x55554015u },
+    { 0x55555555u,  6u,  8u, 1u, 0x55557FD5u },
+    { 0x55555555u,  6u,  9u, 0u, 0x55550015u },
+    { 0x55555555u,  6u,  9u, 1u, 0x55557FD5u },
+    { 0x55555555u,  6u, 10u, 0u, 0x55550015u },
+    { 0x55555555u,  6u, 10u, 1u, 0x5555FFD5u },
+    { 0x55555555u,  6u, 11u, 0u, 0x55540015u },
+    { 0x55555555u,  6u, 11u, 1u, 0x5555FFD5u },
+    { 0x55555555u,  6u, 12u, 0u, 0x55540015u },
+    { 0x55555555u,  6u, 12u, 1u, 0x5557FFD5u },
+    { 0x55555555u,  6u, 13u, 0u, 0x55500015u },
+    { 0x55555555u,  6u, 13u, 1u, 0x5557FFD5u },
+    { 0x55555555u,  6u, 14u, 0u, 0x55500015u },
+    { 0x55555555u,  6u, 14u, 1u, 0x555FFFD5u },
+    { 0x55555555u,  6u, 15u, 0u, 0x55400015u },
+    { 0x55555555u,  6u, 15u, 1u, 0x555FFFD5u },
+    { 0x55555555u,  6u, 16u, 0u, 0x55400015u },
+    { 0x55555555u,  6u, 16u, 1u, 0x557FFFD5u },
+    { 0x55555555u,  6u, 17u, 0u, 0x55000015u },
+    { 0x55555555u,  6u, 17u, 1u, 0x557FFFD5u },
+    { 0x55555555u,  6u, 18u, 0u, 0x55000015u },
+    { 0x55555555u,  6u, 18u, 1u, 0x55FFFFD5u },
+    { 0x55555555u,  6u, 19u, 0u, 0x54000015u },
+    { 0x55555555u,  6u, 19u, 1u, 0x55FFFFD5u },
+    { 0x55555555u,  6u, 20u, 0u, 0x54000015u },
+    { 0x55555555u,  6u, 20u, 1u, 0x57FFFFD5u },
+    { 0x55555555u,  6u, 21u, 0u, 0x50000015u },
+    { 0x55555555u,  6u, 21u, 1u, 0x57FFFFD5u },
+    { 0x55555555u,  6u, 22u, 0u, 0x50000015u },
+    { 0x55555555u,  6u, 22u, 1u, 0x5FFFFFD5u },
+    { 0x55555555u,  6u, 23u, 0u, 0x40000015u },
+    { 0x55555555u,  6u, 23u, 1u, 0x5FFFFFD5u },
+    { 0x55555555u,  6u, 24u, 0u, 0x40000015u },
+    { 0x55555555u,  6u, 24u, 1u, 0x7FFFFFD5u },
+    { 0x55555555u,  6u, 25u, 0u, 0x00000015u },
+    { 0x55555555u,  6u, 25u, 1u, 0x7FFFFFD5u },
+    { 0x55555555u,  6u, 26u, 0u, 0x00000015u },
+    { 0x55555555u,  6u, 26u, 1u, 0xFFFFFFD5u },
+    { 0x55555555u,  7u,  0u, 0u, 0x55555555u },
+    { 0x55555555u,  7u,  0u, 1u, 0x55555555u },
+    { 0x55555555u,  7u,  1u, 0u, 0x55555555u },
+    { 0x55555555u,  7u,  1u, 1u, 0x555555D5u },
+    { 0x55555555u,  7u,  2u, 0u, 0x55555455u },
+    { 0x55555555u,  7u,  2u, 1u, 0x555555D5u },
+    { 0x55555555u,  7u,  3u, 0u, 0x55555455u },
+    { 0x55555555u,  7u,  3u, 1u, 0x555557D5u },
+    { 0x55555555u,  7u,  4u, 0u, 0x55555055u },
+    { 0x55555555u,  7u,  4u, 1u, 0x555557D5u },
+    { 0x55555555u,  7u,  5u, 0u, 0x55555055u },
+    { 0x55555555u,  7u,  5u, 1u, 0x55555FD5u },
+    { 0x55555555u,  7u,  6u, 0u, 0x55554055u },
+    { 0x55555555u,  7u,  6u, 1u, 0x55555FD5u },
+    { 0x55555555u,  7u,  7u, 0u, 0x55554055u },
+    { 0x55555555u,  7u,  7u, 1u, 0x55557FD5u },
+    { 0x55555555u,  7u,  8u, 0u, 0x55550055u },
+    { 0x55555555u,  7u,  8u, 1u, 0x55557FD5u },
+    { 0x55555555u,  7u,  9u, 0u, 0x55550055u },
+    { 0x55555555u,  7u,  9u, 1u, 0x5555FFD5u },
+    { 0x55555555u,  7u, 10u, 0u, 0x55540055u },
+    { 0x55555555u,  7u, 10u, 1u, 0x5555FFD5u },
+    { 0x55555555u,  7u, 11u, 0u, 0x55540055u },
+    { 0x55555555u,  7u, 11u, 1u, 0x5557FFD5u },
+    { 0x55555555u,  7u, 12u, 0u, 0x55500055u },
+    { 0x55555555u,  7u, 12u, 1u, 0x5557FFD5u },
+    { 0x55555555u,  7u, 13u, 0u, 0x55500055u },
+    { 0x55555555u,  7u, 13u, 1u, 0x555FFFD5u },
+    { 0x55555555u,  7u, 14u, 0u, 0x55400055u },
+    { 0x55555555u,  7u, 14u, 1u, 0x555FFFD5u },
+    { 0x55555555u,  7u, 15u, 0u, 0x55400055u },
+    { 0x55555555u,  7u, 15u, 1u, 0x557FFFD5u },
+    { 0x55555555u,  7u, 16u, 0u, 0x55000055u },
+    { 0x55555555u,  7u, 16u, 1u, 0x557FFFD5u },
+    { 0x55555555u,  7u, 17u, 0u, 0x55000055u },
+    { 0x55555555u,  7u, 17u, 1u, 0x55FFFFD5u },
+    { 0x55555555u,  7u, 18u, 0u, 0x54000055u },
+    { 0x55555555u,  7u, 18u, 1u, 0x55FFFFD5u },
+    { 0x55555555u,  7u, 19u, 0u, 0x54000055u },
+    { 0x55555555u,  7u, 19u, 1u, 0x57FFFFD5u },
+    { 0x55555555u,  7u, 20u, 0u, 0x50000055u },
+    { 0x55555555u,  7u, 20u, 1u, 0x57FFFFD5u },
+    { 0x55555555u,  7u, 21u, 0u, 0x50000055u },
+    { 0x55555555u,  7u, 21u, 1u, 0x5FFFFFD5u },
+    { 0x55555555u,  7u, 22u, 0u, 0x40000055u },
+    { 0x55555555u,  7u, 22u, 1u, 0x5FFFFFD5u },
+    { 0x55555555u,  7u, 23u, 0u, 0x40000055u },
+    { 0x55555555u,  7u, 23u, 1u, 0x7FFFFFD5u },
+    { 0x55555555u,  7u, 24u, 0u, 0x00000055u },
+    { 0x55555555u,  7u, 24u, 1u, 0x7FFFFFD5u },
+    { 0x55555555u,  7u, 25u, 0u, 0x00000055u },
+    { 0x55555555u,  7u, 25u, 1u, 0xFFFFFFD5u },
+    { 0x55555555u,  8u,  0u, 0u, 0x55555555u },
+    { 0x55555555u,  8u,  0u, 1u, 0x55555555u },
+    { 0x55555555u,  8u,  1u, 0u, 0x55555455u },
+    { 0x55555555u,  8u,  1u, 1u, 0x55555555u },
+    { 0x55555555u,  8u,  2u, 0u, 0x55555455u },
+    { 0x55555555u,  8u,  2u, 1u, 0x55555755u },
+    { 0x55555555u,  8u,  3u, 0u, 0x55555055u },
+    { 0x55555555u,  8u,  3u, 1u, 0x55555755u },
+    { 0x55555555u,  8u,  4u, 0u, 0x55555055u },
+    { 0x55555555u,  8u,  4u, 1u, 0x55555F55u },
+    { 0x55555555u,  8u,  5u, 0u, 0x55554055u },
+    { 0x55555555u,  8u,  5u, 1u, 0x55555F55u },
+    { 0x55555555u,  8u,  6u, 0u, 0x55554055u },
+    { 0x55555555u,  8u,  6u, 1u, 0x55557F55u },
+    { 0x55555555u,  8u,  7u, 0u, 0x55550055u },
+    { 0x55555555u,  8u,  7u, 1u, 0x55557F55u },
+    { 0x55555555u,  8u,  8u, 0u, 0x55550055u },
+    { 0x55555555u,  8u,  8u, 1u, 0x5555FF55u },
+    { 0x55555555u,  8u,  9u, 0u, 0x55540055u },
+    { 0x55555555u,  8u,  9u, 1u, 0x5555FF55u },
+    { 0x55555555u,  8u, 10u, 0u, 0x55540055u },
+    { 0x55555555u,  8u, 10u, 1u, 0x5557FF55u },
+    { 0x55555555u,  8u, 11u, 0u, 0x55500055u },
+    { 0x55555555u,  8u, 11u, 1u, 0x5557FF55u },
+    { 0x55555555u,  8u, 12u, 0u, 0x55500055u },
+    { 0x55555555u,  8u, 12u, 1u, 0x555FFF55u },
+    { 0x55555555u,  8u, 13u, 0u, 0x55400055u },
+    { 0x55555555u,  8u, 13u, 1u, 0x555FFF55u },
+    { 0x55555555u,  8u, 14u, 0u, 0x55400055u },
+    { 0x55555555u,  8u, 14u, 1u, 0x557FFF55u },
+    { 0x55555555u,  8u, 15u, 0u, 0x55000055u },
+    { 0x55555555u,  8u, 15u, 1u, 0x557FFF55u },
+    { 0x55555555u,  8u, 16u, 0u, 0x55000055u },
+    { 0x55555555u,  8u, 16u, 1u, 0x55FFFF55u },
+    { 0x55555555u,  8u, 17u, 0u, 0x54000055u },
+    { 0x55555555u,  8u, 17u, 1u, 0x55FFFF55u },
+    { 0x55555555u,  8u, 18u, 0u, 0x54000055u },
+    { 0x55555555u,  8u, 18u, 1u, 0x57FFFF55u },
+    { 0x55555555u,  8u, 19u, 0u, 0x50000055u },
+    { 0x55555555u,  8u, 19u, 1u, 0x57FFFF55u },
+    { 0x55555555u,  8u, 20u, 0u, 0x50000055u },
+    { 0x55555555u,  8u, 20u, 1u, 0x5FFFFF55u },
+    { 0x55555555u,  8u, 21u, 0u, 0x40000055u },
+    { 0x55555555u,  8u, 21u, 1u, 0x5FFFFF55u },
+    { 0x55555555u,  8u, 22u, 0u, 0x40000055u },
+    { 0x55555555u,  8u, 22u, 1u, 0x7FFFFF55u },
+    { 0x55555555u,  8u, 23u, 0u, 0x00000055u },
+    { 0x55555555u,  8u, 23u, 1u, 0x7FFFFF55u },
+    { 0x55555555u,  8u, 24u, 0u, 0x00000055u },
+    { 0x55555555u,  8u, 24u, 1u, 0xFFFFFF55u },
+    { 0x55555555u,  9u,  0u, 0u, 0x55555555u },
+    { 0x55555555u,  9u,  0u, 1u, 0x55555555u },
+    { 0x55555555u,  9u,  1u, 0u, 0x55555555u },
+    { 0x55555555u,  9u,  1u, 1u, 0x55555755u },
+    { 0x55555555u,  9u,  2u, 0u, 0x55555155u },
+    { 0x55555555u,  9u,  2u, 1u, 0x55555755u },
+    { 0x55555555u,  9u,  3u, 0u, 0x55555155u },
+    { 0x55555555u,  9u,  3u, 1u, 0x55555F55u },
+    { 0x55555555u,  9u,  4u, 0u, 0x55554155u },
+    { 0x55555555u,  9u,  4u, 1u, 0x55555F55u },
+    { 0x55555555u,  9u,  5u, 0u, 0x55554155u },
+    { 0x55555555u,  9u,  5u, 1u, 0x55557F55u },
+    { 0x55555555u,  9u,  6u, 0u, 0x55550155u },
+    { 0x55555555u,  9u,  6u, 1u, 0x55557F55u },
+    { 0x55555555u,  9u,  7u, 0u, 0x55550155u },
+    { 0x55555555u,  9u,  7u, 1u, 0x5555FF55u },
+    { 0x55555555u,  9u,  8u, 0u, 0x55540155u },
+    { 0x55555555u,  9u,  8u, 1u, 0x5555FF55u },
+    { 0x55555555u,  9u,  9u, 0u, 0x55540155u },
+    { 0x55555555u,  9u,  9u, 1u, 0x5557FF55u },
+    { 0x55555555u,  9u, 10u, 0u, 0x55500155u },
+    { 0x55555555u,  9u, 10u, 1u, 0x5557FF55u },
+    { 0x55555555u,  9u, 11u, 0u, 0x55500155u },
+    { 0x55555555u,  9u, 11u, 1u, 0x555FFF55u },
+    { 0x55555555u,  9u, 12u, 0u, 0x55400155u },
+    { 0x55555555u,  9u, 12u, 1u, 0x555FFF55u },
+    { 0x55555555u,  9u, 13u, 0u, 0x55400155u },
+    { 0x55555555u,  9u, 13u, 1u, 0x557FFF55u },
+    { 0x55555555u,  9u, 14u, 0u, 0x55000155u },
+    { 0x55555555u,  9u, 14u, 1u, 0x557FFF55u },
+    { 0x55555555u,  9u, 15u, 0u, 0x55000155u },
+    { 0x55555555u,  9u, 15u, 1u, 0x55FFFF55u },
+    { 0x55555555u,  9u, 16u, 0u, 0x54000155u },
+    { 0x55555555u,  9u, 16u, 1u, 0x55FFFF55u },
+    { 0x55555555u,  9u, 17u, 0u, 0x54000155u },
+    { 0x55555555u,  9u, 17u, 1u, 0x57FFFF55u },
+    { 0x55555555u,  9u, 18u, 0u, 0x50000155u },
+    { 0x55555555u,  9u, 18u, 1u, 0x57FFFF55u },
+    { 0x55555555u,  9u, 19u, 0u, 0x50000155u },
+    { 0x55555555u,  9u, 19u, 1u, 0x5FFFFF55u },
+    { 0x55555555u,  9u, 20u, 0u, 0x40000155u },
+    { 0x55555555u,  9u, 20u, 1u, 0x5FFFFF55u },
+    { 0x55555555u,  9u, 21u, 0u, 0x40000155u },
+    { 0x55555555u,  9u, 21u, 1u, 0x7FFFFF55u },
+    { 0x55555555u,  9u, 22u, 0u, 0x00000155u },
+    { 0x55555555u,  9u, 22u, 1u, 0x7FFFFF55u },
+    { 0x55555555u,  9u, 23u, 0u, 0x00000155u },
+    { 0x55555555u,  9u, 23u, 1u, 0xFFFFFF55u },
+    { 0x55555555u, 10u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 10u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 10u,  1u, 0u, 0x55555155u },
+    { 0x55555555u, 10u,  1u, 1u, 0x55555555u },
+    { 0x55555555u, 10u,  2u, 0u, 0x55555155u },
+    { 0x55555555u, 10u,  2u, 1u, 0x55555D55u },
+    { 0x55555555u, 10u,  3u, 0u, 0x55554155u },
+    { 0x55555555u, 10u,  3u, 1u, 0x55555D55u },
+    { 0x55555555u, 10u,  4u, 0u, 0x55554155u },
+    { 0x55555555u, 10u,  4u, 1u, 0x55557D55u },
+    { 0x55555555u, 10u,  5u, 0u, 0x55550155u },
+    { 0x55555555u, 10u,  5u, 1u, 0x55557D55u },
+    { 0x55555555u, 10u,  6u, 0u, 0x55550155u },
+    { 0x55555555u, 10u,  6u, 1u, 0x5555FD55u },
+    { 0x55555555u, 10u,  7u, 0u, 0x55540155u },
+    { 0x55555555u, 10u,  7u, 1u, 0x5555FD55u },
+    { 0x55555555u, 10u,  8u, 0u, 0x55540155u },
+    { 0x55555555u, 10u,  8u, 1u, 0x5557FD55u },
+    { 0x55555555u, 10u,  9u, 0u, 0x55500155u },
+    { 0x55555555u, 10u,  9u, 1u, 0x5557FD55u },
+    { 0x55555555u, 10u, 10u, 0u, 0x55500155u },
+    { 0x55555555u, 10u, 10u, 1u, 0x555FFD55u },
+    { 0x55555555u, 10u, 11u, 0u, 0x55400155u },
+    { 0x55555555u, 10u, 11u, 1u, 0x555FFD55u },
+    { 0x55555555u, 10u, 12u, 0u, 0x55400155u },
+    { 0x55555555u, 10u, 12u, 1u, 0x557FFD55u },
+    { 0x55555555u, 10u, 13u, 0u, 0x55000155u },
+    { 0x55555555u, 10u, 13u, 1u, 0x557FFD55u },
+    { 0x55555555u, 10u, 14u, 0u, 0x55000155u },
+    { 0x55555555u, 10u, 14u, 1u, 0x55FFFD55u },
+    { 0x55555555u, 10u, 15u, 0u, 0x54000155u },
+    { 0x55555555u, 10u, 15u, 1u, 0x55FFFD55u },
+    { 0x55555555u, 10u, 16u, 0u, 0x54000155u },
+    { 0x55555555u, 10u, 16u, 1u, 0x57FFFD55u },
+    { 0x55555555u, 10u, 17u, 0u, 0x50000155u },
+    { 0x55555555u, 10u, 17u, 1u, 0x57FFFD55u },
+    { 0x55555555u, 10u, 18u, 0u, 0x50000155u },
+    { 0x55555555u, 10u, 18u, 1u, 0x5FFFFD55u },
+    { 0x55555555u, 10u, 19u, 0u, 0x40000155u },
+    { 0x55555555u, 10u, 19u, 1u, 0x5FFFFD55u },
+    { 0x55555555u, 10u, 20u, 0u, 0x40000155u },
+    { 0x55555555u, 10u, 20u, 1u, 0x7FFFFD55u },
+    { 0x55555555u, 10u, 21u, 0u, 0x00000155u },
+    { 0x55555555u, 10u, 21u, 1u, 0x7FFFFD55u },
+    { 0x55555555u, 10u, 22u, 0u, 0x00000155u },
+    { 0x55555555u, 10u, 22u, 1u, 0xFFFFFD55u },
+    { 0x55555555u, 11u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 11u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 11u,  1u, 0u, 0x55555555u },
+    { 0x55555555u, 11u,  1u, 1u, 0x55555D55u },
+    { 0x55555555u, 11u,  2u, 0u, 0x55554555u },
+    { 0x55555555u, 11u,  2u, 1u, 0x55555D55u },
+    { 0x55555555u, 11u,  3u, 0u, 0x55554555u },
+    { 0x55555555u, 11u,  3u, 1u, 0x55557D55u },
+    { 0x55555555u, 11u,  4u, 0u, 0x55550555u },
+    { 0x55555555u, 11u,  4u, 1u, 0x55557D55u },
+    { 0x55555555u, 11u,  5u, 0u, 0x55550555u },
+    { 0x55555555u, 11u,  5u, 1u, 0x5555FD55u },
+    { 0x55555555u, 11u,  6u, 0u, 0x55540555u },
+    { 0x55555555u, 11u,  6u, 1u, 0x5555FD55u },
+    { 0x55555555u, 11u,  7u, 0u, 0x55540555u },
+    { 0x55555555u, 11u,  7u, 1u, 0x5557FD55u },
+    { 0x55555555u, 11u,  8u, 0u, 0x55500555u },
+    { 0x55555555u, 11u,  8u, 1u, 0x5557FD55u },
+    { 0x55555555u, 11u,  9u, 0u, 0x55500555u },
+    { 0x55555555u, 11u,  9u, 1u, 0x555FFD55u },
+    { 0x55555555u, 11u, 10u, 0u, 0x55400555u },
+    { 0x55555555u, 11u, 10u, 1u, 0x555FFD55u },
+    { 0x55555555u, 11u, 11u, 0u, 0x55400555u },
+    { 0x55555555u, 11u, 11u, 1u, 0x557FFD55u },
+    { 0x55555555u, 11u, 12u, 0u, 0x55000555u },
+    { 0x55555555u, 11u, 12u, 1u, 0x557FFD55u },
+    { 0x55555555u, 11u, 13u, 0u, 0x55000555u },
+    { 0x55555555u, 11u, 13u, 1u, 0x55FFFD55u },
+    { 0x55555555u, 11u, 14u, 0u, 0x54000555u },
+    { 0x55555555u, 11u, 14u, 1u, 0x55FFFD55u },
+    { 0x55555555u, 11u, 15u, 0u, 0x54000555u },
+    { 0x55555555u, 11u, 15u, 1u, 0x57FFFD55u },
+    { 0x55555555u, 11u, 16u, 0u, 0x50000555u },
+    { 0x55555555u, 11u, 16u, 1u, 0x57FFFD55u },
+    { 0x55555555u, 11u, 17u, 0u, 0x50000555u },
+    { 0x55555555u, 11u, 17u, 1u, 0x5FFFFD55u },
+    { 0x55555555u, 11u, 18u, 0u, 0x40000555u },
+    { 0x55555555u, 11u, 18u, 1u, 0x5FFFFD55u },
+    { 0x55555555u, 11u, 19u, 0u, 0x40000555u },
+    { 0x55555555u, 11u, 19u, 1u, 0x7FFFFD55u },
+    { 0x55555555u, 11u, 20u, 0u, 0x00000555u },
+    { 0x55555555u, 11u, 20u, 1u, 0x7FFFFD55u },
+    { 0x55555555u, 11u, 21u, 0u, 0x00000555u },
+    { 0x55555555u, 11u, 21u, 1u, 0xFFFFFD55u },
+    { 0x55555555u, 12u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 12u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 12u,  1u, 0u, 0x55554555u },
+    { 0x55555555u, 12u,  1u, 1u, 0x55555555u },
+    { 0x55555555u, 12u,  2u, 0u, 0x55554555u },
+    { 0x55555555u, 12u,  2u, 1u, 0x55557555u },
+    { 0x55555555u, 12u,  3u, 0u, 0x55550555u },
+    { 0x55555555u, 12u,  3u, 1u, 0x55557555u },
+    { 0x55555555u, 12u,  4u, 0u, 0x55550555u },
+    { 0x55555555u, 12u,  4u, 1u, 0x5555F555u },
+    { 0x55555555u, 12u,  5u, 0u, 0x55540555u },
+    { 0x55555555u, 12u,  5u, 1u, 0x5555F555u },
+    { 0x55555555u, 12u,  6u, 0u, 0x55540555u },
+    { 0x55555555u, 12u,  6u, 1u, 0x5557F555u },
+    { 0x55555555u, 12u,  7u, 0u, 0x55500555u },
+    { 0x55555555u, 12u,  7u, 1u, 0x5557F555u },
+    { 0x55555555u, 12u,  8u, 0u, 0x55500555u },
+    { 0x55555555u, 12u,  8u, 1u, 0x555FF555u },
+    { 0x55555555u, 12u,  9u, 0u, 0x55400555u },
+    { 0x55555555u, 12u,  9u, 1u, 0x555FF555u },
+    { 0x55555555u, 12u, 10u, 0u, 0x55400555u },
+    { 0x55555555u, 12u, 10u, 1u, 0x557FF555u },
+    { 0x55555555u, 12u, 11u, 0u, 0x55000555u },
+    { 0x55555555u, 12u, 11u, 1u, 0x557FF555u },
+    { 0x55555555u, 12u, 12u, 0u, 0x55000555u },
+    { 0x55555555u, 12u, 12u, 1u, 0x55FFF555u },
+    { 0x55555555u, 12u, 13u, 0u, 0x54000555u },
+    { 0x55555555u, 12u, 13u, 1u, 0x55FFF555u },
+    { 0x55555555u, 12u, 14u, 0u, 0x54000555u },
+    { 0x55555555u, 12u, 14u, 1u, 0x57FFF555u },
+    { 0x55555555u, 12u, 15u, 0u, 0x50000555u },
+    { 0x55555555u, 12u, 15u, 1u, 0x57FFF555u },
+    { 0x55555555u, 12u, 16u, 0u, 0x50000555u },
+    { 0x55555555u, 12u, 16u, 1u, 0x5FFFF555u },
+    { 0x55555555u, 12u, 17u, 0u, 0x40000555u },
+    { 0x55555555u, 12u, 17u, 1u, 0x5FFFF555u },
+    { 0x55555555u, 12u, 18u, 0u, 0x40000555u },
+    { 0x55555555u, 12u, 18u, 1u, 0x7FFFF555u },
+    { 0x55555555u, 12u, 19u, 0u, 0x00000555u },
+    { 0x55555555u, 12u, 19u, 1u, 0x7FFFF555u },
+    { 0x55555555u, 12u, 20u, 0u, 0x00000555u },
+    { 0x55555555u, 12u, 20u, 1u, 0xFFFFF555u },
+    { 0x55555555u, 13u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 13u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 13u,  1u, 0u, 0x55555555u },
+    { 0x55555555u, 13u,  1u, 1u, 0x55557555u },
+    { 0x55555555u, 13u,  2u, 0u, 0x55551555u },
+    { 0x55555555u, 13u,  2u, 1u, 0x55557555u },
+    { 0x55555555u, 13u,  3u, 0u, 0x55551555u },
+    { 0x55555555u, 13u,  3u, 1u, 0x5555F555u },
+    { 0x55555555u, 13u,  4u, 0u, 0x55541555u },
+    { 0x55555555u, 13u,  4u, 1u, 0x5555F555u },
+    { 0x55555555u, 13u,  5u, 0u, 0x55541555u },
+    { 0x55555555u, 13u,  5u, 1u, 0x5557F555u },
+    { 0x55555555u, 13u,  6u, 0u, 0x55501555u },
+    { 0x55555555u, 13u,  6u, 1u, 0x5557F555u },
+    { 0x55555555u, 13u,  7u, 0u, 0x55501555u },
+    { 0x55555555u, 13u,  7u, 1u, 0x555FF555u },
+    { 0x55555555u, 13u,  8u, 0u, 0x55401555u },
+    { 0x55555555u, 13u,  8u, 1u, 0x555FF555u },
+    { 0x55555555u, 13u,  9u, 0u, 0x55401555u },
+    { 0x55555555u, 13u,  9u, 1u, 0x557FF555u },
+    { 0x55555555u, 13u, 10u, 0u, 0x55001555u },
+    { 0x55555555u, 13u, 10u, 1u, 0x557FF555u },
+    { 0x55555555u, 13u, 11u, 0u, 0x55001555u },
+    { 0x55555555u, 13u, 11u, 1u, 0x55FFF555u },
+    { 0x55555555u, 13u, 12u, 0u, 0x54001555u },
+    { 0x55555555u, 13u, 12u, 1u, 0x55FFF555u },
+    { 0x55555555u, 13u, 13u, 0u, 0x54001555u },
+    { 0x55555555u, 13u, 13u, 1u, 0x57FFF555u },
+    { 0x55555555u, 13u, 14u, 0u, 0x50001555u },
+    { 0x55555555u, 13u, 14u, 1u, 0x57FFF555u },
+    { 0x55555555u, 13u, 15u, 0u, 0x50001555u },
+    { 0x55555555u, 13u, 15u, 1u, 0x5FFFF555u },
+    { 0x55555555u, 13u, 16u, 0u, 0x40001555u },
+    { 0x55555555u, 13u, 16u, 1u, 0x5FFFF555u },
+    { 0x55555555u, 13u, 17u, 0u, 0x40001555u },
+    { 0x55555555u, 13u, 17u, 1u, 0x7FFFF555u },
+    { 0x55555555u, 13u, 18u, 0u, 0x00001555u },
+    { 0x55555555u, 13u, 18u, 1u, 0x7FFFF555u },
+    { 0x55555555u, 13u, 19u, 0u, 0x00001555u },
+    { 0x55555555u, 13u, 19u, 1u, 0xFFFFF555u },
+    { 0x55555555u, 14u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 14u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 14u,  1u, 0u, 0x55551555u },
+    { 0x55555555u, 14u,  1u, 1u, 0x55555555u },
+    { 0x55555555u, 14u,  2u, 0u, 0x55551555u },
+    { 0x55555555u, 14u,  2u, 1u, 0x5555D555u },
+    { 0x55555555u, 14u,  3u, 0u, 0x55541555u },
+    { 0x55555555u, 14u,  3u, 1u, 0x5555D555u },
+    { 0x55555555u, 14u,  4u, 0u, 0x55541555u },
+    { 0x55555555u, 14u,  4u, 1u, 0x5557D555u },
+    { 0x55555555u, 14u,  5u, 0u, 0x55501555u },
+    { 0x55555555u, 14u,  5u, 1u, 0x5557D555u },
+    { 0x55555555u, 14u,  6u, 0u, 0x55501555u },
+    { 0x55555555u, 14u,  6u, 1u, 0x555FD555u },
+    { 0x55555555u, 14u,  7u, 0u, 0x55401555u },
+    { 0x55555555u, 14u,  7u, 1u, 0x555FD555u },
+    { 0x55555555u, 14u,  8u, 0u, 0x55401555u },
+    { 0x55555555u, 14u,  8u, 1u, 0x557FD555u },
+    { 0x55555555u, 14u,  9u, 0u, 0x55001555u },
+    { 0x55555555u, 14u,  9u, 1u, 0x557FD555u },
+    { 0x55555555u, 14u, 10u, 0u, 0x55001555u },
+    { 0x55555555u, 14u, 10u, 1u, 0x55FFD555u },
+    { 0x55555555u, 14u, 11u, 0u, 0x54001555u },
+    { 0x55555555u, 14u, 11u, 1u, 0x55FFD555u },
+    { 0x55555555u, 14u, 12u, 0u, 0x54001555u },
+    { 0x55555555u, 14u, 12u, 1u, 0x57FFD555u },
+    { 0x55555555u, 14u, 13u, 0u, 0x50001555u },
+    { 0x55555555u, 14u, 13u, 1u, 0x57FFD555u },
+    { 0x55555555u, 14u, 14u, 0u, 0x50001555u },
+    { 0x55555555u, 14u, 14u, 1u, 0x5FFFD555u },
+    { 0x55555555u, 14u, 15u, 0u, 0x40001555u },
+    { 0x55555555u, 14u, 15u, 1u, 0x5FFFD555u },
+    { 0x55555555u, 14u, 16u, 0u, 0x40001555u },
+    { 0x55555555u, 14u, 16u, 1u, 0x7FFFD555u },
+    { 0x55555555u, 14u, 17u, 0u, 0x00001555u },
+    { 0x55555555u, 14u, 17u, 1u, 0x7FFFD555u },
+    { 0x55555555u, 14u, 18u, 0u, 0x00001555u },
+    { 0x55555555u, 14u, 18u, 1u, 0xFFFFD555u },
+    { 0x55555555u, 15u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 15u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 15u,  1u, 0u, 0x55555555u },
+    { 0x55555555u, 15u,  1u, 1u, 0x5555D555u },
+    { 0x55555555u, 15u,  2u, 0u, 0x55545555u },
+    { 0x55555555u, 15u,  2u, 1u, 0x5555D555u },
+    { 0x55555555u, 15u,  3u, 0u, 0x55545555u },
+    { 0x55555555u, 15u,  3u, 1u, 0x5557D555u },
+    { 0x55555555u, 15u,  4u, 0u, 0x55505555u },
+    { 0x55555555u, 15u,  4u, 1u, 0x5557D555u },
+    { 0x55555555u, 15u,  5u, 0u, 0x55505555u },
+    { 0x55555555u, 15u,  5u, 1u, 0x555FD555u },
+    { 0x55555555u, 15u,  6u, 0u, 0x55405555u },
+    { 0x55555555u, 15u,  6u, 1u, 0x555FD555u },
+    { 0x55555555u, 15u,  7u, 0u, 0x55405555u },
+    { 0x55555555u, 15u,  7u, 1u, 0x557FD555u },
+    { 0x55555555u, 15u,  8u, 0u, 0x55005555u },
+    { 0x55555555u, 15u,  8u, 1u, 0x557FD555u },
+    { 0x55555555u, 15u,  9u, 0u, 0x55005555u },
+    { 0x55555555u, 15u,  9u, 1u, 0x55FFD555u },
+    { 0x55555555u, 15u, 10u, 0u, 0x54005555u },
+    { 0x55555555u, 15u, 10u, 1u, 0x55FFD555u },
+    { 0x55555555u, 15u, 11u, 0u, 0x54005555u },
+    { 0x55555555u, 15u, 11u, 1u, 0x57FFD555u },
+    { 0x55555555u, 15u, 12u, 0u, 0x50005555u },
+    { 0x55555555u, 15u, 12u, 1u, 0x57FFD555u },
+    { 0x55555555u, 15u, 13u, 0u, 0x50005555u },
+    { 0x55555555u, 15u, 13u, 1u, 0x5FFFD555u },
+    { 0x55555555u, 15u, 14u, 0u, 0x40005555u },
+    { 0x55555555u, 15u, 14u, 1u, 0x5FFFD555u },
+    { 0x55555555u, 15u, 15u, 0u, 0x40005555u },
+    { 0x55555555u, 15u, 15u, 1u, 0x7FFFD555u },
+    { 0x55555555u, 15u, 16u, 0u, 0x00005555u },
+    { 0x55555555u, 15u, 16u, 1u, 0x7FFFD555u },
+    { 0x55555555u, 15u, 17u, 0u, 0x00005555u },
+    { 0x55555555u, 15u, 17u, 1u, 0xFFFFD555u },
+    { 0x55555555u, 16u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 16u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 16u,  1u, 0u, 0x55545555u },
+    { 0x55555555u, 16u,  1u, 1u, 0x55555555u },
+    { 0x55555555u, 16u,  2u, 0u, 0x55545555u },
+    { 0x55555555u, 16u,  2u, 1u, 0x55575555u },
+    { 0x55555555u, 16u,  3u, 0u, 0x55505555u },
+    { 0x55555555u, 16u,  3u, 1u, 0x55575555u },
+    { 0x55555555u, 16u,  4u, 0u, 0x55505555u },
+    { 0x55555555u, 16u,  4u, 1u, 0x555F5555u },
+    { 0x55555555u, 16u,  5u, 0u, 0x55405555u },
+    { 0x55555555u, 16u,  5u, 1u, 0x555F5555u },
+    { 0x55555555u, 16u,  6u, 0u, 0x55405555u },
+    { 0x55555555u, 16u,  6u, 1u, 0x557F5555u },
+    { 0x55555555u, 16u,  7u, 0u, 0x55005555u },
+    { 0x55555555u, 16u,  7u, 1u, 0x557F5555u },
+    { 0x55555555u, 16u,  8u, 0u, 0x55005555u },
+    { 0x55555555u, 16u,  8u, 1u, 0x55FF5555u },
+    { 0x55555555u, 16u,  9u, 0u, 0x54005555u },
+    { 0x55555555u, 16u,  9u, 1u, 0x55FF5555u },
+    { 0x55555555u, 16u, 10u, 0u, 0x54005555u },
+    { 0x55555555u, 16u, 10u, 1u, 0x57FF5555u },
+    { 0x55555555u, 16u, 11u, 0u, 0x50005555u },
+    { 0x55555555u, 16u, 11u, 1u, 0x57FF5555u },
+    { 0x55555555u, 16u, 12u, 0u, 0x50005555u },
+    { 0x55555555u, 16u, 12u, 1u, 0x5FFF5555u },
+    { 0x55555555u, 16u, 13u, 0u, 0x40005555u },
+    { 0x55555555u, 16u, 13u, 1u, 0x5FFF5555u },
+    { 0x55555555u, 16u, 14u, 0u, 0x40005555u },
+    { 0x55555555u, 16u, 14u, 1u, 0x7FFF5555u },
+    { 0x55555555u, 16u, 15u, 0u, 0x00005555u },
+    { 0x55555555u, 16u, 15u, 1u, 0x7FFF5555u },
+    { 0x55555555u, 16u, 16u, 0u, 0x00005555u },
+    { 0x55555555u, 16u, 16u, 1u, 0xFFFF5555u },
+    { 0x55555555u, 17u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 17u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 17u,  1u, 0u, 0x55555555u },
+    { 0x55555555u, 17u,  1u, 1u, 0x55575555u },
+    { 0x55555555u, 17u,  2u, 0u, 0x55515555u },
+    { 0x55555555u, 17u,  2u, 1u, 0x55575555u },
+    { 0x55555555u, 17u,  3u, 0u, 0x55515555u },
+    { 0x55555555u, 17u,  3u, 1u, 0x555F5555u },
+    { 0x55555555u, 17u,  4u, 0u, 0x55415555u },
+    { 0x55555555u, 17u,  4u, 1u, 0x555F5555u },
+    { 0x55555555u, 17u,  5u, 0u, 0x55415555u },
+    { 0x55555555u, 17u,  5u, 1u, 0x557F5555u },
+    { 0x55555555u, 17u,  6u, 0u, 0x55015555u },
+    { 0x55555555u, 17u,  6u, 1u, 0x557F5555u },
+    { 0x55555555u, 17u,  7u, 0u, 0x55015555u },
+    { 0x55555555u, 17u,  7u, 1u, 0x55FF5555u },
+    { 0x55555555u, 17u,  8u, 0u, 0x54015555u },
+    { 0x55555555u, 17u,  8u, 1u, 0x55FF5555u },
+    { 0x55555555u, 17u,  9u, 0u, 0x54015555u },
+    { 0x55555555u, 17u,  9u, 1u, 0x57FF5555u },
+    { 0x55555555u, 17u, 10u, 0u, 0x50015555u },
+    { 0x55555555u, 17u, 10u, 1u, 0x57FF5555u },
+    { 0x55555555u, 17u, 11u, 0u, 0x50015555u },
+    { 0x55555555u, 17u, 11u, 1u, 0x5FFF5555u },
+    { 0x55555555u, 17u, 12u, 0u, 0x40015555u },
+    { 0x55555555u, 17u, 12u, 1u, 0x5FFF5555u },
+    { 0x55555555u, 17u, 13u, 0u, 0x40015555u },
+    { 0x55555555u, 17u, 13u, 1u, 0x7FFF5555u },
+    { 0x55555555u, 17u, 14u, 0u, 0x00015555u },
+    { 0x55555555u, 17u, 14u, 1u, 0x7FFF5555u },
+    { 0x55555555u, 17u, 15u, 0u, 0x00015555u },
+    { 0x55555555u, 17u, 15u, 1u, 0xFFFF5555u },
+    { 0x55555555u, 18u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 18u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 18u,  1u, 0u, 0x55515555u },
+    { 0x55555555u, 18u,  1u, 1u, 0x55555555u },
+    { 0x55555555u, 18u,  2u, 0u, 0x55515555u },
+    { 0x55555555u, 18u,  2u, 1u, 0x555D5555u },
+    { 0x55555555u, 18u,  3u, 0u, 0x55415555u },
+    { 0x55555555u, 18u,  3u, 1u, 0x555D5555u },
+    { 0x55555555u, 18u,  4u, 0u, 0x55415555u },
+    { 0x55555555u, 18u,  4u, 1u, 0x557D5555u },
+    { 0x55555555u, 18u,  5u, 0u, 0x55015555u },
+    { 0x55555555u, 18u,  5u, 1u, 0x557D5555u },
+    { 0x55555555u, 18u,  6u, 0u, 0x55015555u },
+    { 0x55555555u, 18u,  6u, 1u, 0x55FD5555u },
+    { 0x55555555u, 18u,  7u, 0u, 0x54015555u },
+    { 0x55555555u, 18u,  7u, 1u, 0x55FD5555u },
+    { 0x55555555u, 18u,  8u, 0u, 0x54015555u },
+    { 0x55555555u, 18u,  8u, 1u, 0x57FD5555u },
+    { 0x55555555u, 18u,  9u, 0u, 0x50015555u },
+    { 0x55555555u, 18u,  9u, 1u, 0x57FD5555u },
+    { 0x55555555u, 18u, 10u, 0u, 0x50015555u },
+    { 0x55555555u, 18u, 10u, 1u, 0x5FFD5555u },
+    { 0x55555555u, 18u, 11u, 0u, 0x40015555u },
+    { 0x55555555u, 18u, 11u, 1u, 0x5FFD5555u },
+    { 0x55555555u, 18u, 12u, 0u, 0x40015555u },
+    { 0x55555555u, 18u, 12u, 1u, 0x7FFD5555u },
+    { 0x55555555u, 18u, 13u, 0u, 0x00015555u },
+    { 0x55555555u, 18u, 13u, 1u, 0x7FFD5555u },
+    { 0x55555555u, 18u, 14u, 0u, 0x00015555u },
+    { 0x55555555u, 18u, 14u, 1u, 0xFFFD5555u },
+    { 0x55555555u, 19u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 19u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 19u,  1u, 0u, 0x55555555u },
+    { 0x55555555u, 19u,  1u, 1u, 0x555D5555u },
+    { 0x55555555u, 19u,  2u, 0u, 0x55455555u },
+    { 0x55555555u, 19u,  2u, 1u, 0x555D5555u },
+    { 0x55555555u, 19u,  3u, 0u, 0x55455555u },
+    { 0x55555555u, 19u,  3u, 1u, 0x557D5555u },
+    { 0x55555555u, 19u,  4u, 0u, 0x55055555u },
+    { 0x55555555u, 19u,  4u, 1u, 0x557D5555u },
+    { 0x55555555u, 19u,  5u, 0u, 0x55055555u },
+    { 0x55555555u, 19u,  5u, 1u, 0x55FD5555u },
+    { 0x55555555u, 19u,  6u, 0u, 0x54055555u },
+    { 0x55555555u, 19u,  6u, 1u, 0x55FD5555u },
+    { 0x55555555u, 19u,  7u, 0u, 0x54055555u },
+    { 0x55555555u, 19u,  7u, 1u, 0x57FD5555u },
+    { 0x55555555u, 19u,  8u, 0u, 0x50055555u },
+    { 0x55555555u, 19u,  8u, 1u, 0x57FD5555u },
+    { 0x55555555u, 19u,  9u, 0u, 0x50055555u },
+    { 0x55555555u, 19u,  9u, 1u, 0x5FFD5555u },
+    { 0x55555555u, 19u, 10u, 0u, 0x40055555u },
+    { 0x55555555u, 19u, 10u, 1u, 0x5FFD5555u },
+    { 0x55555555u, 19u, 11u, 0u, 0x40055555u },
+    { 0x55555555u, 19u, 11u, 1u, 0x7FFD5555u },
+    { 0x55555555u, 19u, 12u, 0u, 0x00055555u },
+    { 0x55555555u, 19u, 12u, 1u, 0x7FFD5555u },
+    { 0x55555555u, 19u, 13u, 0u, 0x00055555u },
+    { 0x55555555u, 19u, 13u, 1u, 0xFFFD5555u },
+    { 0x55555555u, 20u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 20u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 20u,  1u, 0u, 0x55455555u },
+    { 0x55555555u, 20u,  1u, 1u, 0x55555555u },
+    { 0x55555555u, 20u,  2u, 0u, 0x55455555u },
+    { 0x55555555u, 20u,  2u, 1u, 0x55755555u },
+    { 0x55555555u, 20u,  3u, 0u, 0x55055555u },
+    { 0x55555555u, 20u,  3u, 1u, 0x55755555u },
+    { 0x55555555u, 20u,  4u, 0u, 0x55055555u },
+    { 0x55555555u, 20u,  4u, 1u, 0x55F55555u },
+    { 0x55555555u, 20u,  5u, 0u, 0x54055555u },
+    { 0x55555555u, 20u,  5u, 1u, 0x55F55555u },
+    { 0x55555555u, 20u,  6u, 0u, 0x54055555u },
+    { 0x55555555u, 20u,  6u, 1u, 0x57F55555u },
+    { 0x55555555u, 20u,  7u, 0u, 0x50055555u },
+    { 0x55555555u, 20u,  7u, 1u, 0x57F55555u },
+    { 0x55555555u, 20u,  8u, 0u, 0x50055555u },
+    { 0x55555555u, 20u,  8u, 1u, 0x5FF55555u },
+    { 0x55555555u, 20u,  9u, 0u, 0x40055555u },
+    { 0x55555555u, 20u,  9u, 1u, 0x5FF55555u },
+    { 0x55555555u, 20u, 10u, 0u, 0x40055555u },
+    { 0x55555555u, 20u, 10u, 1u, 0x7FF55555u },
+    { 0x55555555u, 20u, 11u, 0u, 0x00055555u },
+    { 0x55555555u, 20u, 11u, 1u, 0x7FF55555u },
+    { 0x55555555u, 20u, 12u, 0u, 0x00055555u },
+    { 0x55555555u, 20u, 12u, 1u, 0xFFF55555u },
+    { 0x55555555u, 21u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 21u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 21u,  1u, 0u, 0x55555555u },
+    { 0x55555555u, 21u,  1u, 1u, 0x55755555u },
+    { 0x55555555u, 21u,  2u, 0u, 0x55155555u },
+    { 0x55555555u, 21u,  2u, 1u, 0x55755555u },
+    { 0x55555555u, 21u,  3u, 0u, 0x55155555u },
+    { 0x55555555u, 21u,  3u, 1u, 0x55F55555u },
+    { 0x55555555u, 21u,  4u, 0u, 0x54155555u },
+    { 0x55555555u, 21u,  4u, 1u, 0x55F55555u },
+    { 0x55555555u, 21u,  5u, 0u, 0x54155555u },
+    { 0x55555555u, 21u,  5u, 1u, 0x57F55555u },
+    { 0x55555555u, 21u,  6u, 0u, 0x50155555u },
+    { 0x55555555u, 21u,  6u, 1u, 0x57F55555u },
+    { 0x55555555u, 21u,  7u, 0u, 0x50155555u },
+    { 0x55555555u, 21u,  7u, 1u, 0x5FF55555u },
+    { 0x55555555u, 21u,  8u, 0u, 0x40155555u },
+    { 0x55555555u, 21u,  8u, 1u, 0x5FF55555u },
+    { 0x55555555u, 21u,  9u, 0u, 0x40155555u },
+    { 0x55555555u, 21u,  9u, 1u, 0x7FF55555u },
+    { 0x55555555u, 21u, 10u, 0u, 0x00155555u },
+    { 0x55555555u, 21u, 10u, 1u, 0x7FF55555u },
+    { 0x55555555u, 21u, 11u, 0u, 0x00155555u },
+    { 0x55555555u, 21u, 11u, 1u, 0xFFF55555u },
+    { 0x55555555u, 22u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 22u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 22u,  1u, 0u, 0x55155555u },
+    { 0x55555555u, 22u,  1u, 1u, 0x55555555u },
+    { 0x55555555u, 22u,  2u, 0u, 0x55155555u },
+    { 0x55555555u, 22u,  2u, 1u, 0x55D55555u },
+    { 0x55555555u, 22u,  3u, 0u, 0x54155555u },
+    { 0x55555555u, 22u,  3u, 1u, 0x55D55555u },
+    { 0x55555555u, 22u,  4u, 0u, 0x54155555u },
+    { 0x55555555u, 22u,  4u, 1u, 0x57D55555u },
+    { 0x55555555u, 22u,  5u, 0u, 0x50155555u },
+    { 0x55555555u, 22u,  5u, 1u, 0x57D55555u },
+    { 0x55555555u, 22u,  6u, 0u, 0x50155555u },
+    { 0x55555555u, 22u,  6u, 1u, 0x5FD55555u },
+    { 0x55555555u, 22u,  7u, 0u, 0x40155555u },
+    { 0x55555555u, 22u,  7u, 1u, 0x5FD55555u },
+    { 0x55555555u, 22u,  8u, 0u, 0x40155555u },
+    { 0x55555555u, 22u,  8u, 1u, 0x7FD55555u },
+    { 0x55555555u, 22u,  9u, 0u, 0x00155555u },
+    { 0x55555555u, 22u,  9u, 1u, 0x7FD55555u },
+    { 0x55555555u, 22u, 10u, 0u, 0x00155555u },
+    { 0x55555555u, 22u, 10u, 1u, 0xFFD55555u },
+    { 0x55555555u, 23u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 23u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 23u,  1u, 0u, 0x55555555u },
+    { 0x55555555u, 23u,  1u, 1u, 0x55D55555u },
+    { 0x55555555u, 23u,  2u, 0u, 0x54555555u },
+    { 0x55555555u, 23u,  2u, 1u, 0x55D55555u },
+    { 0x55555555u, 23u,  3u, 0u, 0x54555555u },
+    { 0x55555555u, 23u,  3u, 1u, 0x57D55555u },
+    { 0x55555555u, 23u,  4u, 0u, 0x50555555u },
+    { 0x55555555u, 23u,  4u, 1u, 0x57D55555u },
+    { 0x55555555u, 23u,  5u, 0u, 0x50555555u },
+    { 0x55555555u, 23u,  5u, 1u, 0x5FD55555u },
+    { 0x55555555u, 23u,  6u, 0u, 0x40555555u },
+    { 0x55555555u, 23u,  6u, 1u, 0x5FD55555u },
+    { 0x55555555u, 23u,  7u, 0u, 0x40555555u },
+    { 0x55555555u, 23u,  7u, 1u, 0x7FD55555u },
+    { 0x55555555u, 23u,  8u, 0u, 0x00555555u },
+    { 0x55555555u, 23u,  8u, 1u, 0x7FD55555u },
+    { 0x55555555u, 23u,  9u, 0u, 0x00555555u },
+    { 0x55555555u, 23u,  9u, 1u, 0xFFD55555u },
+    { 0x55555555u, 24u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 24u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 24u,  1u, 0u, 0x54555555u },
+    { 0x55555555u, 24u,  1u, 1u, 0x55555555u },
+    { 0x55555555u, 24u,  2u, 0u, 0x54555555u },
+    { 0x55555555u, 24u,  2u, 1u, 0x57555555u },
+    { 0x55555555u, 24u,  3u, 0u, 0x50555555u },
+    { 0x55555555u, 24u,  3u, 1u, 0x57555555u },
+    { 0x55555555u, 24u,  4u, 0u, 0x50555555u },
+    { 0x55555555u, 24u,  4u, 1u, 0x5F555555u },
+    { 0x55555555u, 24u,  5u, 0u, 0x40555555u },
+    { 0x55555555u, 24u,  5u, 1u, 0x5F555555u },
+    { 0x55555555u, 24u,  6u, 0u, 0x40555555u },
+    { 0x55555555u, 24u,  6u, 1u, 0x7F555555u },
+    { 0x55555555u, 24u,  7u, 0u, 0x00555555u },
+    { 0x55555555u, 24u,  7u, 1u, 0x7F555555u },
+    { 0x55555555u, 24u,  8u, 0u, 0x00555555u },
+    { 0x55555555u, 24u,  8u, 1u, 0xFF555555u },
+    { 0x55555555u, 25u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 25u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 25u,  1u, 0u, 0x55555555u },
+    { 0x55555555u, 25u,  1u, 1u, 0x57555555u },
+    { 0x55555555u, 25u,  2u, 0u, 0x51555555u },
+    { 0x55555555u, 25u,  2u, 1u, 0x57555555u },
+    { 0x55555555u, 25u,  3u, 0u, 0x51555555u },
+    { 0x55555555u, 25u,  3u, 1u, 0x5F555555u },
+    { 0x55555555u, 25u,  4u, 0u, 0x41555555u },
+    { 0x55555555u, 25u,  4u, 1u, 0x5F555555u },
+    { 0x55555555u, 25u,  5u, 0u, 0x41555555u },
+    { 0x55555555u, 25u,  5u, 1u, 0x7F555555u },
+    { 0x55555555u, 25u,  6u, 0u, 0x01555555u },
+    { 0x55555555u, 25u,  6u, 1u, 0x7F555555u },
+    { 0x55555555u, 25u,  7u, 0u, 0x01555555u },
+    { 0x55555555u, 25u,  7u, 1u, 0xFF555555u },
+    { 0x55555555u, 26u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 26u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 26u,  1u, 0u, 0x51555555u },
+    { 0x55555555u, 26u,  1u, 1u, 0x55555555u },
+    { 0x55555555u, 26u,  2u, 0u, 0x51555555u },
+    { 0x55555555u, 26u,  2u, 1u, 0x5D555555u },
+    { 0x55555555u, 26u,  3u, 0u, 0x41555555u },
+    { 0x55555555u, 26u,  3u, 1u, 0x5D555555u },
+    { 0x55555555u, 26u,  4u, 0u, 0x41555555u },
+    { 0x55555555u, 26u,  4u, 1u, 0x7D555555u },
+    { 0x55555555u, 26u,  5u, 0u, 0x01555555u },
+    { 0x55555555u, 26u,  5u, 1u, 0x7D555555u },
+    { 0x55555555u, 26u,  6u, 0u, 0x01555555u },
+    { 0x55555555u, 26u,  6u, 1u, 0xFD555555u },
+    { 0x55555555u, 27u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 27u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 27u,  1u, 0u, 0x55555555u },
+    { 0x55555555u, 27u,  1u, 1u, 0x5D555555u },
+    { 0x55555555u, 27u,  2u, 0u, 0x45555555u },
+    { 0x55555555u, 27u,  2u, 1u, 0x5D555555u },
+    { 0x55555555u, 27u,  3u, 0u, 0x45555555u },
+    { 0x55555555u, 27u,  3u, 1u, 0x7D555555u },
+    { 0x55555555u, 27u,  4u, 0u, 0x05555555u },
+    { 0x55555555u, 27u,  4u, 1u, 0x7D555555u },
+    { 0x55555555u, 27u,  5u, 0u, 0x05555555u },
+    { 0x55555555u, 27u,  5u, 1u, 0xFD555555u },
+    { 0x55555555u, 28u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 28u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 28u,  1u, 0u, 0x45555555u },
+    { 0x55555555u, 28u,  1u, 1u, 0x55555555u },
+    { 0x55555555u, 28u,  2u, 0u, 0x45555555u },
+    { 0x55555555u, 28u,  2u, 1u, 0x75555555u },
+    { 0x55555555u, 28u,  3u, 0u, 0x05555555u },
+    { 0x55555555u, 28u,  3u, 1u, 0x75555555u },
+    { 0x55555555u, 28u,  4u, 0u, 0x05555555u },
+    { 0x55555555u, 28u,  4u, 1u, 0xF5555555u },
+    { 0x55555555u, 29u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 29u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 29u,  1u, 0u, 0x55555555u },
+    { 0x55555555u, 29u,  1u, 1u, 0x75555555u },
+    { 0x55555555u, 29u,  2u, 0u, 0x15555555u },
+    { 0x55555555u, 29u,  2u, 1u, 0x75555555u },
+    { 0x55555555u, 29u,  3u, 0u, 0x15555555u },
+    { 0x55555555u, 29u,  3u, 1u, 0xF5555555u },
+    { 0x55555555u, 30u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 30u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 30u,  1u, 0u, 0x15555555u },
+    { 0x55555555u, 30u,  1u, 1u, 0x55555555u },
+    { 0x55555555u, 30u,  2u, 0u, 0x15555555u },
+    { 0x55555555u, 30u,  2u, 1u, 0xD5555555u },
+    { 0x55555555u, 31u,  0u, 0u, 0x55555555u },
+    { 0x55555555u, 31u,  0u, 1u, 0x55555555u },
+    { 0x55555555u, 31u,  1u, 0u, 0x55555555u },
+    { 0x55555555u, 31u,  1u, 1u, 0xD5555555u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_SetBits_u32u8u8u8 vectors**
+ *
+ * The test runs the 1121 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00021, SWS_Bfx_00022, SWS_Bfx_00025
+ */
+void test__Bfx_SetBits_u32u8u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( SetBits_u32u8u8u8 ) / sizeof( SetBits_u32u8u8u8[ 0 ] ) ); i++ )
+    {
+        uint32 Data = SetBits_u32u8u8u8[ i ].Data;
+        Bfx_SetBits_u32u8u8u8( &Data, SetBits_u32u8u8u8[ i ].BitStartPn, SetBits_u32u8u8u8[ i ].BitLn, SetBits_u32u8u8u8[ i ].Status );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( SetBits_u32u8u8u8[ i ].Expected, Data, Vector( "Bfx_SetBits_u32u8u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 BitStartPn;
+    uint8 BitLn;
+    uint32 Expected;
+} GetBits_u32u8u8_u32[] = {
+    { 0x89ABCDEFu,  0u,  0u, 0x00000000u },
+    { 0x89ABCDEFu,  0u,  1u, 0x00000001u },
+    { 0x89ABCDEFu,  0u,  2u, 0x00000003u },
+    { 0x89ABCDEFu,  0u,  3u, 0x00000007u },
+    { 0x89ABCDEFu,  0u,  4u, 0x0000000Fu },
+    { 0x89ABCDEFu,  0u,  5u, 0x0000000Fu },
+    { 0x89ABCDEFu,  0u,  6u, 0x0000002Fu },
+    { 0x89ABCDEFu,  0u,  7u, 0x0000006Fu },
+    { 0x89ABCDEFu,  0u,  8u, 0x000000EFu },
+    { 0x89ABCDEFu,  0u,  9u, 0x000001EFu },
+    { 0x89ABCDEFu,  0u, 10u, 0x000001EFu },
+    { 0x89ABCDEFu,  0u, 11u, 0x000005EFu },
+    { 0x89ABCDEFu,  0u, 12u, 0x00000DEFu },
+    { 0x89ABCDEFu,  0u, 13u, 0x00000DEFu },
+    { 0x89ABCDEFu,  0u, 14u, 0x00000DEFu },
+    { 0x89ABCDEFu,  0u, 15u, 0x00004DEFu },
+    { 0x89ABCDEFu,  0u, 16u, 0x0000CDEFu },
+    { 0x89ABCDEFu,  0u, 17u, 0x0001CDEFu },
+    { 0x89ABCDEFu,  0u, 18u, 0x0003CDEFu },
+    { 0x89ABCDEFu,  0u, 19u, 0x0003CDEFu },
+    { 0x89ABCDEFu,  0u, 20u, 0x000BCDEFu },
+    { 0x89ABCDEFu,  0u, 21u, 0x000BCDEFu },
+    { 0x89ABCDEFu,  0u, 22u, 0x002BCDEFu },
+    { 0x89ABCDEFu,  0u, 23u, 0x002BCDEFu },
+    { 0x89ABCDEFu,  0u, 24u, 0x00ABCDEFu },
+    { 0x89ABCDEFu,  0u, 25u, 0x01ABCDEFu },
+    { 0x89ABCDEFu,  0u, 26u, 0x01ABCDEFu },
+    { 0x89ABCDEFu,  0u, 27u, 0x01ABCDEFu },
+    { 0x89ABCDEFu,  0u, 28u, 0x09ABCDEFu },
+    { 0x89ABCDEFu,  0u, 29u, 0x09ABCDEFu },
+    { 0x89ABCDEFu,  0u, 30u, 0x09ABCDEFu },
+    { 0x89ABCDEFu,  0u, 31u, 0x09ABCDEFu },
+    { 0x89ABCDEFu,  0u, 32u, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  1u,  0u, 0x00000000u },
+    { 0x89ABCDEFu,  1u,  1u, 0x00000001u },
+    { 0x89ABCDEFu,  1u,  2u, 0x00000003u },
+    { 0x89ABCDEFu,  1u,  3u, 0x00000007u },
+    { 0x89ABCDEFu,  1u,  4u, 0x00000007u },
+    { 0x89ABCDEFu,  1u,  5u, 0x00000017u },
+    { 0x89ABCDEFu,  1u,  6u, 0x00000037u },
+    { 0x89ABCDEFu,  1u,  7u, 0x00000077u },
+    { 0x89ABCDEFu,  1u,  8u, 0x000000F7u },
+    { 0x89ABCDEFu,  1u,  9u, 0x000000F7u },
+    { 0x89ABCDEFu,  1u, 10u, 0x000002F7u },
+    { 0x89ABCDEFu,  1u, 11u, 0x000006F7u },
+    { 0x89ABCDEFu,  1u, 12u, 0x000006F7u },
+    { 0x89ABCDEFu,  1u, 13u, 0x000006F7u },
+    { 0x89ABCDEFu,  1u, 14u, 0x000026F7u },
+    { 0x89ABCDEFu,  1u, 15u, 0x000066F7u },
+    { 0x89ABCDEFu,  1u, 16u, 0x0000E6F7u },
+    { 0x89ABCDEFu,  1u, 17u, 0x0001E6F7u },
+    { 0x89ABCDEFu,  1u, 18u, 0x0001E6F7u },
+    { 0x89ABCDEFu,  1u, 19u, 0x0005E6F7u },
+    { 0x89ABCDEFu,  1u, 20u, 0x0005E6F7u },
+    { 0x89ABCDEFu,  1u, 21u, 0x0015E6F7u },
+    { 0x89ABCDEFu,  1u, 22u, 0x0015E6F7u },
+    { 0x89ABCDEFu,  1u, 23u, 0x0055E6F7u },
+    { 0x89ABCDEFu,  1u, 24u, 0x00D5E6F7u },
+    { 0x89ABCDEFu,  1u, 25u, 0x00D5E6F7u },
+    { 0x89ABCDEFu,  1u, 26u, 0x00D5E6F7u },
+    { 0x89ABCDEFu,  1u, 27u, 0x04D5E6F7u },
+    { 0x89ABCDEFu,  1u, 28u, 0x04D5E6F7u },
+    { 0x89ABCDEFu,  1u, 29u, 0x04D5E6F7u },
+    { 0x89ABCDEFu,  1u, 30u, 0x04D5E6F7u },
+    { 0x89ABCDEFu,  1u, 31u, 0x44D5E6F7u },
+    { 0x89ABCDEFu,  2u,  0u, 0x00000000u },
+    { 0x89ABCDEFu,  2u,  1u, 0x00000001u },
+    { 0x89ABCDEFu,  2u,  2u, 0x00000003u },
+    { 0x89ABCDEFu,  2u,  3u, 0x00000003u },
+    { 0x89ABCDEFu,  2u,  4u, 0x0000000Bu },
+    { 0x89ABCDEFu,  2u,  5u, 0x0000001Bu },
+    { 0x89ABCDEFu,  2u,  6u, 0x0000003Bu },
+    { 0x89ABCDEFu,  2u,  7u, 0x0000007Bu },
+    { 0x89ABCDEFu,  2u,  8u, 0x0000007Bu },
+    { 0x89ABCDEFu,  2u,  9u, 0x0000017Bu },
+    { 0x89ABCDEFu,  2u, 10u, 0x0000037Bu },
+    { 0x89ABCDEFu,  2u, 11u, 0x0000037Bu },
+    { 0x89ABCDEFu,  2u, 12u, 0x0000037Bu },
+    { 0x89ABCDEFu,  2u, 13u, 0x0000137Bu },
+    { 0x89ABCDEFu,  2u, 14u, 0x0000337Bu },
+    { 0x89ABCDEFu,  2u, 15u, 0x0000737Bu },
+    { 0x89ABCDEFu,  2u, 16u, 0x0000F37Bu },
+    { 0x89ABCDEFu,  2u, 17u, 0x0000F37Bu },
+    { 0x89ABCDEFu,  2u, 18u, 0x0002F37Bu },
+    { 0x89ABCDEFu,  2u, 19u, 0x0002F37Bu },
+    { 0x89ABCDEFu,  2u, 20u, 0x000AF37Bu },
+    { 0x89ABCDEFu,  2u, 21u, 0x000AF37Bu },
+    { 0x89ABCDEFu,  2u, 22u, 0x002AF37Bu },
+    { 0x89ABCDEFu,  2u, 23u, 0x006AF37Bu },
+    { 0x89ABCDEFu,  2u, 24u, 0x006AF37Bu },
+    { 0x89ABCDEFu,  2u, 25u, 0x006AF37Bu },
+    { 0x89ABCDEFu,  2u, 26u, 0x026AF37Bu },
+    { 0x89ABCDEFu,  2u, 27u, 0x026AF37Bu },
+    { 0x89ABCDEFu,  2u, 28u, 0x026AF37Bu },
+    { 0x89ABCDEFu,  2u, 29u, 0x026AF37Bu },
+    { 0x89ABCDEFu,  2u, 30u, 0x226AF37Bu },
+    { 0x89ABCDEFu,  3u,  0u, 0x00000000u },
+    { 0x89ABCDEFu,  3u,  1u, 0x00000001u },
+    { 0x89ABCDEFu,  3u,  2u, 0x00000001u },
+    { 0x89ABCDEFu,  3u,  3u, 0x00000005u },
+    { 0x89ABCDEFu,  3u,  4u, 0x0000000Du },
+    { 0x89ABCDEFu,  3u,  5u, 0x0000001Du },
+    { 0x89ABCDEFu,  3u,  6u, 0x0000003Du },
+    { 0x89ABCDEFu,  3u,  7u, 0x0000003Du },
+    { 0x89ABCDEFu,  3u,  8u, 0x000000BDu },
+    { 0x89ABCDEFu,  3u,  9u, 0x000001BDu },
+    { 0x89ABCDEFu,  3u, 10u, 0x000001BDu },
+    { 0x89ABCDEFu,  3u, 11u, 0x000001BDu },
+    { 0x89ABCDEFu,  3u, 12u, 0x000009BDu },
+    { 0x89ABCDEFu,  3u, 13u, 0x000019BDu },
+    { 0x89ABCDEFu,  3u, 14u, 0x000039BDu },
+    { 0x89ABCDEFu,  3u, 15u, 0x000079BDu },
+    { 0x89ABCDEFu,  3u, 16u, 0x000079BDu },
+    { 0x89ABCDEFu,  3u, 17u, 0x000179BDu },
+    { 0x89ABCDEFu,  3u, 18u, 0x000179BDu },
+    { 0x89ABCDEFu,  3u, 19u, 0x000579BDu },
+    { 0x89ABCDEFu,  3u, 20u, 0x000579BDu },
+    { 0x89ABCDEFu,  3u, 21u, 0x001579BDu },
+    { 0x89ABCDEFu,  3u, 22u, 0x003579BDu },
+    { 0x89ABCDEFu,  3u, 23u, 0x003579BDu },
+    { 0x89ABCDEFu,  3u, 24u, 0x003579BDu },
+    { 0x89ABCDEFu,  3u, 25u, 0x013579BDu },
+    { 0x89ABCDEFu,  3u, 26u, 0x013579BDu },
+    { 0x89ABCDEFu,  3u, 27u, 0x013579BDu },
+    { 0x89ABCDEFu,  3u, 28u, 0x013579BDu },
+    { 0x89ABCDEFu,  3u, 29u, 0x113579BDu },
+    { 0x89ABCDEFu,  4u,  0u, 0x00000000u },
+    { 0x89ABCDEFu,  4u,  1u, 0x00000000u },
+    { 0x89ABCDEFu,  4u,  2u, 0x00000002u },
+    { 0x89ABCDEFu,  4u,  3u, 0x00000006u },
+    { 0x89ABCDEFu,  4u,  4u, 0x0000000Eu },
+    { 0x89ABCDEFu,  4u,  5u, 0x0000001Eu },
+    { 0x89ABCDEFu,  4u,  6u, 0x0000001Eu },
+    { 0x89ABCDEFu,  4u,  7u, 0x0000005Eu },
+    { 0x89ABCDEFu,  4u,  8u, 0x000000DEu },
+    { 0x89ABCDEFu,  4u,  9u, 0x000000DEu },
+    { 0x89ABCDEFu,  4u, 10u, 0x000000DEu },
+    { 0x89ABCDEFu,  4u, 11u, 0x000004DEu },
+    { 0x89ABCDEFu,  4u, 12u, 0x00000CDEu },
+    { 0x89ABCDEFu,  4u, 13u, 0x00001CDEu },
+    { 0x89ABCDEFu,  4u, 14u, 0x00003CDEu },
+    { 0x89ABCDEFu,  4u, 15u, 0x00003CDEu },
+    { 0x89ABCDEFu,  4u, 16u, 0x0000BCDEu },
+    { 0x89ABCDEFu,  4u, 17u, 0x0000BCDEu },
+    { 0x89ABCDEFu,  4u, 18u, 0x0002BCDEu },
+    { 0x89ABCDEFu,  4u, 19u, 0x0002BCDEu },
+    { 0x89ABCDEFu,  4u, 20u, 0x000ABCDEu },
+    { 0x89ABCDEFu,  4u, 21u, 0x001ABCDEu },
+    { 0x89ABCDEFu,  4u, 22u, 0x001ABCDEu },
+    { 0x89ABCDEFu,  4u, 23u, 0x001ABCDEu },
+    { 0x89ABCDEFu,  4u, 24u, 0x009ABCDEu },
+    { 0x89ABCDEFu,  4u, 25u, 0x009ABCDEu },
+    { 0x89ABCDEFu,  4u, 26u, 0x009ABCDEu },
+    { 0x89ABCDEFu,  4u, 27u, 0x009ABCDEu },
+    { 0x89ABCDEFu,  4u, 28u, 0x089ABCDEu },
+    { 0x89ABCDEFu,  5u,  0u, 0x00000000u },
+    { 0x89ABCDEFu,  5u,  1u, 0x00000001u },
+    { 0x89ABCDEFu,  5u,  2u, 0x00000003u },
+    { 0x89ABCDEFu,  5u,  3u, 0x00000007u },
+    { 0x89ABCDEFu,  5u,  4u, 0x0000000Fu },
+    { 0x89ABCDEFu,  5u,  5u, 0x0000000Fu },
+    { 0x89ABCDEFu,  5u,  6u, 0x0000002Fu },
+    { 0x89ABCDEFu,  5u,  7u, 0x0000006Fu },
+    { 0x89ABCDEFu,  5u,  8u, 0x0000006Fu },
+    { 0x89ABCDEFu,  5u,  9u, 0x0000006Fu },
+    { 0x89ABCDEFu,  5u, 10u, 0x0000026Fu },
+    { 0x89ABCDEFu,  5u, 11u, 0x0000066Fu },
+    { 0x89ABCDEFu,  5u, 12u, 0x00000E6Fu },
+    { 0x89ABCDEFu,  5u, 13u, 0x00001E6Fu },
+    { 0x89ABCDEFu,  5u, 14u, 0x00001E6Fu },
+    { 0x89ABCDEFu,  5u, 15u, 0x00005E6Fu },
+    { 0x89ABCDEFu,  5u, 16u, 0x00005E6Fu },
+    { 0x89ABCDEFu,  5u, 17u, 0x00015E6Fu },
+    { 0x89ABCDEFu,  5u, 18u, 0x00015E6Fu },
+    { 0x89ABCDEFu,  5u, 19u, 0x00055E6Fu },
+    { 0x89ABCDEFu,  5u, 20u, 0x000D5E6Fu },
+    { 0x89ABCDEFu,  5u, 21u, 0x000D5E6Fu },
+    { 0x89ABCDEFu,  5u, 22u, 0x000D5E6Fu },
+    { 0x89ABCDEFu,  5u, 23u, 0x004D5E6Fu },
+    { 0x89ABCDEFu,  5u, 24u, 0x004D5E6Fu },
+    { 0x89ABCDEFu,  5u, 25u, 0x004D5E6Fu },
+    { 0x89ABCDEFu,  5u, 26u, 0x004D5E6Fu },
+    { 0x89ABCDEFu,  5u, 27u, 0x044D5E6Fu },
+    { 0x89ABCDEFu,  6u,  0u, 0x00000000u },
+    { 0x89ABCDEFu,  6u,  1u, 0x00000001u },
+    { 0x89ABCDEFu,  6u,  2u, 0x00000003u },
+    { 0x89ABCDEFu,  6u,  3u, 0x00000007u },
+    { 0x89ABCDEFu,  6u,  4u, 0x00000007u },
+    { 0x89ABCDEFu,  6u,  5u, 0x00000017u },
+    { 0x89ABCDEFu,  6u,  6u, 0x00000037u },
+    { 0x89ABCDEFu,  6u,  7u, 0x00000037u },
+    { 0x89ABCDEFu,  6u,  8u, 0x00000037u },
+    { 0x89ABCDEFu,  6u,  9u, 0x00000137u },
+    { 0x89ABCDEFu,  6u, 10u, 0x00000337u },
+    { 0x89ABCDEFu,  6u, 11u, 0x00000737u },
+    { 0x89ABCDEFu,  6u, 12u, 0x00000F37u },
+    { 0x89ABCDEFu,  6u, 13u, 0x00000F37u },
+    { 0x89ABCDEFu,  6u, 14u, 0x00002F37u },
+    { 0x89ABCDEFu,  6u, 15u, 0x00002F37u },
+    { 0x89ABCDEFu,  6u, 16u, 0x0000AF37u },
+    { 0x89ABCDEFu,  6u, 17u, 0x0000AF37u },
+    { 0x89ABCDEFu,  6u, 18u, 0x0002AF37u },
+    { 0x89ABCDEFu,  6u, 19u, 0x0006AF37u },
+    { 0x89ABCDEFu,  6u, 20u, 0x0006AF37u },
+    { 0x89ABCDEFu,  6u, 21u, 0x0006AF37u },
+    { 0x89ABCDEFu,  6u, 22u, 0x0026AF37u },
+    { 0x89ABCDEFu,  6u, 23u, 0x0026AF37u },
+    { 0x89ABCDEFu,  6u, 24u, 0x0026AF37u },
+    { 0x89ABCDEFu,  6u, 25u, 0x0026AF37u },
+    { 0x89ABCDEFu,  6u, 26u, 0x0226AF37u },
+    { 0x89ABCDEFu,  7u,  0u, 0x00000000u },
+    { 0x89ABCDEFu,  7u,  1u, 0x00000001u },
+    { 0x89ABCDEFu,  7u,  2u, 0x00000003u },
+    { 0x89ABCDEFu,  7u,  3u, 0x00000003u },
+    { 0x89ABCDEFu,  7u,  4u, 0x0000000Bu },
+    { 0x89ABCDEFu,  7u,  5u, 0x0000001Bu },
+    { 0x89ABCDEFu,  7u,  6u, 0x0000001Bu },
+    { 0x89ABCDEFu,  7u,  7u, 0x0000001Bu },
+    { 0x89ABCDEFu,  7u,  8u, 0x0000009Bu },
+    { 0x89ABCDEFu,  7u,  9u, 0x0000019Bu },
+    { 0x89ABCDEFu,  7u, 10u, 0x0000039Bu },
+    { 0x89ABCDEFu,  7u, 11u, 0x0000079Bu },
+    { 0x89ABCDEFu,  7u, 12u, 0x0000079Bu },
+    { 0x89ABCDEFu,  7u, 13u, 0x0000179Bu },
+    { 0x89ABCDEFu,  7u, 14u, 0x0000179Bu },
+    { 0x89ABCDEFu,  7u, 15u, 0x0000579Bu },
+    { 0x89ABCDEFu,  7u, 16u, 0x0000579Bu },
+    { 0x89ABCDEFu,  7u, 17u, 0x0001579Bu },
+    { 0x89ABCDEFu,  7u, 18u, 0x0003579Bu },
+    { 0x89ABCDEFu,  7u, 19u, 0x0003579Bu },
+    { 0x89ABCDEFu,  7u, 20u, 0x0003579Bu },
+    { 0x89ABCDEFu,  7u, 21u, 0x0013579Bu },
+    { 0x89ABCDEFu,  7u, 22u, 0x0013579Bu },
+    { 0x89ABCDEFu,  7u, 23u, 0x0013579Bu },
+    { 0x89ABCDEFu,  7u, 24u, 0x0013579Bu },
+    { 0x89ABCDEFu,  7u, 25u, 0x0113579Bu },
+    { 0x89ABCDEFu,  8u,  0u, 0x00000000u },
+    { 0x89ABCDEFu,  8u,  1u, 0x00000001u },
+    { 0x89ABCDEFu,  8u,  2u, 0x00000001u },
+    { 0x89ABCDEFu,  8u,  3u, 0x00000005u },
+    { 0x89ABCDEFu,  8u,  4u, 0x0000000Du },
+    { 0x89ABCDEFu,  8u,  5u, 0x0000000Du },
+    { 0x89ABCDEFu,  8u,  6u, 0x0000000Du },
+    { 0x89ABCDEFu,  8u,  7u, 0x0000004Du },
+    { 0x89ABCDEFu,  8u,  8u, 0x000000CDu },
+    { 0x89ABCDEFu,  8u,  9u, 0x000001CDu },
+    { 0x89ABCDEFu,  8u, 10u, 0x000003CDu },
+    { 0x89ABCDEFu,  8u, 11u, 0x000003CDu },
+    { 0x89ABCDEFu,  8u, 12u, 0x00000BCDu },
+    { 0x89ABCDEFu,  8u, 13u, 0x00000BCDu },
+    { 0x89ABCDEFu,  8u, 14u, 0x00002BCDu },
+    { 0x89ABCDEFu,  8u, 15u, 0x00002BCDu },
+    { 0x89ABCDEFu,  8u, 16u, 0x0000ABCDu },
+    { 0x89ABCDEFu,  8u, 17u, 0x0001ABCDu },
+    { 0x89ABCDEFu,  8u, 18u, 0x0001ABCDu },
+    { 0x89ABCDEFu,  8u, 19u, 0x0001ABCDu },
+    { 0x89ABCDEFu,  8u, 20u, 0x0009ABCDu },
+    { 0x89ABCDEFu,  8u, 21u, 0x0009ABCDu },
+    { 0x89ABCDEFu,  8u, 22u, 0x0009ABCDu },
+    { 0x89ABCDEFu,  8u, 23u, 0x0009ABCDu },
+    { 0x89ABCDEFu,  8u, 24u, 0x0089ABCDu },
+    { 0x89ABCDEFu,  9u,  0u, 0x00000000u },
+    { 0x89ABCDEFu,  9u,  1u, 0x00000000u },
+    { 0x89ABCDEFu,  9u,  2u, 0x00000002u },
+    { 0x89ABCDEFu,  9u,  3u, 0x00000006u },
+    { 0x89ABCDEFu,  9u,  4u, 0x00000006u },
+    { 0x89ABCDEFu,  9u,  5u, 0x00000006u },
+    { 0x89ABCDEFu,  9u,  6u, 0x00000026u },
+    { 0x89ABCDEFu,  9u,  7u, 0x00000066u },
+    { 0x89ABCDEFu,  9u,  8u, 0x000000E6u },
+    { 0x89ABCDEFu,  9u,  9u, 0x000001E6u },
+    { 0x89ABCDEFu,  9u, 10u, 0x000001E6u },
+    { 0x89ABCDEFu,  9u, 11u, 0x000005E6u },
+    { 0x89ABCDEFu,  9u, 12u, 0x000005E6u },
+    { 0x89ABCDEFu,  9u, 13u, 0x000015E6u },
+    { 0x89ABCDEFu,  9u, 14u, 0x000015E6u },
+    { 0x89ABCDEFu,  9u, 15u, 0x000055E6u },
+    { 0x89ABCDEFu,  9u, 16u, 0x0000D5E6u },
+    { 0x89ABCDEFu,  9u, 17u, 0x0000D5E6u },
+    { 0x89ABCDEFu,  9u, 18u, 0x0000D5E6u },
+    { 0x89ABCDEFu,  9u, 19u, 0x0004D5E6u },
+    { 0x89ABCDEFu,  9u, 20u, 0x0004D5E6u },
+    { 0x89ABCDEFu,  9u, 21u, 0x0004D5E6u },
+    { 0x89ABCDEFu,  9u, 22u, 0x0004D5E6u },
+    { 0x89ABCDEFu,  9u, 23u, 0x0044D5E6u },
+    { 0x89ABCDEFu, 10u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 10u,  1u, 0x00000001u },
+    { 0x89ABCDEFu, 10u,  2u, 0x00000003u },
+    { 0x89ABCDEFu, 10u,  3u, 0x00000003u },
+    { 0x89ABCDEFu, 10u,  4u, 0x00000003u },
+    { 0x89ABCDEFu, 10u,  5u, 0x00000013u },
+    { 0x89ABCDEFu, 10u,  6u, 0x00000033u },
+    { 0x89ABCDEFu, 10u,  7u, 0x00000073u },
+    { 0x89ABCDEFu, 10u,  8u, 0x000000F3u },
+    { 0x89ABCDEFu, 10u,  9u, 0x000000F3u },
+    { 0x89ABCDEFu, 10u, 10u, 0x000002F3u },
+    { 0x89ABCDEFu, 10u, 11u, 0x000002F3u },
+    { 0x89ABCDEFu, 10u, 12u, 0x00000AF3u },
+    { 0x89ABCDEFu, 10u, 13u, 0x00000AF3u },
+    { 0x89ABCDEFu, 10u, 14u, 0x00002AF3u },
+    { 0x89ABCDEFu, 10u, 15u, 0x00006AF3u },
+    { 0x89ABCDEFu, 10u, 16u, 0x00006AF3u },
+    { 0x89ABCDEFu, 10u, 17u, 0x00006AF3u },
+    { 0x89ABCDEFu, 10u, 18u, 0x00026AF3u },
+    { 0x89ABCDEFu, 10u, 19u, 0x00026AF3u },
+    { 0x89ABCDEFu, 10u, 20u, 0x00026AF3u },
+    { 0x89ABCDEFu, 10u, 21u, 0x00026AF3u },
+    { 0x89ABCDEFu, 10u, 22u, 0x00226AF3u },
+    { 0x89ABCDEFu, 11u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 11u,  1u, 0x00000001u },
+    { 0x89ABCDEFu, 11u,  2u, 0x00000001u },
+    { 0x89ABCDEFu, 11u,  3u, 0x00000001u },
+    { 0x89ABCDEFu, 11u,  4u, 0x00000009u },
+    { 0x89ABCDEFu, 11u,  5u, 0x00000019u },
+    { 0x89ABCDEFu, 11u,  6u, 0x00000039u },
+    { 0x89ABCDEFu, 11u,  7u, 0x00000079u },
+    { 0x89ABCDEFu, 11u,  8u, 0x00000079u },
+    { 0x89ABCDEFu, 11u,  9u, 0x00000179u },
+    { 0x89ABCDEFu, 11u, 10u, 0x00000179u },
+    { 0x89ABCDEFu, 11u, 11u, 0x00000579u },
+    { 0x89ABCDEFu, 11u, 12u, 0x00000579u },
+    { 0x89ABCDEFu, 11u, 13u, 0x00001579u },
+    { 0x89ABCDEFu, 11u, 14u, 0x00003579u },
+    { 0x89ABCDEFu, 11u, 15u, 0x00003579u },
+    { 0x89ABCDEFu, 11u, 16u, 0x00003579u },
+    { 0x89ABCDEFu, 11u, 17u, 0x00013579u },
+    { 0x89ABCDEFu, 11u, 18u, 0x00013579u },
+    { 0x89ABCDEFu, 11u, 19u, 0x00013579u },
+    { 0x89ABCDEFu, 11u, 20u, 0x00013579u },
+    { 0x89ABCDEFu, 11u, 21u, 0x00113579u },
+    { 0x89ABCDEFu, 12u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 12u,  1u, 0x00000000u },
+    { 0x89ABCDEFu, 12u,  2u, 0x00000000u },
+    { 0x89ABCDEFu, 12u,  3u, 0x00000004u },
+    { 0x89ABCDEFu, 12u,  4u, 0x0000000Cu },
+    { 0x89ABCDEFu, 12u,  5u, 0x0000001Cu },
+    { 0x89ABCDEFu, 12u,  6u, 0x0000003Cu },
+    { 0x89ABCDEFu, 12u,  7u, 0x0000003Cu },
+    { 0x89ABCDEFu, 12u,  8u, 0x000000BCu },
+    { 0x89ABCDEFu, 12u,  9u, 0x000000BCu },
+    { 0x89ABCDEFu, 12u, 10u, 0x000002BCu },
+    { 0x89ABCDEFu, 12u, 11u, 0x000002BCu },
+    { 0x89ABCDEFu, 12u, 12u, 0x00000ABCu },
+    { 0x89ABCDEFu, 12u, 13u, 0x00001ABCu },
+    { 0x89ABCDEFu, 12u, 14u, 0x00001ABCu },
+    { 0x89ABCDEFu, 12u, 15u, 0x00001ABCu },
+    { 0x89ABCDEFu, 12u, 16u, 0x00009ABCu },
+    { 0x89ABCDEFu, 12u, 17u, 0x00009ABCu },
+    { 0x89ABCDEFu, 12u, 18u, 0x00009ABCu },
+    { 0x89ABCDEFu, 12u, 19u, 0x00009ABCu },
+    { 0x89ABCDEFu, 12u, 20u, 0x00089ABCu },
+    { 0x89ABCDEFu, 13u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 13u,  1u, 0x00000000u },
+    { 0x89ABCDEFu, 13u,  2u, 0x00000002u },
+    { 0x89ABCDEFu, 13u,  3u, 0x00000006u },
+    { 0x89ABCDEFu, 13u,  4u, 0x0000000Eu },
+    { 0x89ABCDEFu, 13u,  5u, 0x0000001Eu },
+    { 0x89ABCDEFu, 13u,  6u, 0x0000001Eu },
+    { 0x89ABCDEFu, 13u,  7u, 0x0000005Eu },
+    { 0x89ABCDEFu, 13u,  8u, 0x0000005Eu },
+    { 0x89ABCDEFu, 13u,  9u, 0x0000015Eu },
+    { 0x89ABCDEFu, 13u, 10u, 0x0000015Eu },
+    { 0x89ABCDEFu, 13u, 11u, 0x0000055Eu },
+    { 0x89ABCDEFu, 13u, 12u, 0x00000D5Eu },
+    { 0x89ABCDEFu, 13u, 13u, 0x00000D5Eu },
+    { 0x89ABCDEFu, 13u, 14u, 0x00000D5Eu },
+    { 0x89ABCDEFu, 13u, 15u, 0x00004D5Eu },
+    { 0x89ABCDEFu, 13u, 16u, 0x00004D5Eu },
+    { 0x89ABCDEFu, 13u, 17u, 0x00004D5Eu },
+    { 0x89ABCDEFu, 13u, 18u, 0x00004D5Eu },
+    { 0x89ABCDEFu, 13u, 19u, 0x00044D5Eu },
+    { 0x89ABCDEFu, 14u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 14u,  1u, 0x00000001u },
+    { 0x89ABCDEFu, 14u,  2u, 0x00000003u },
+    { 0x89ABCDEFu, 14u,  3u, 0x00000007u },
+    { 0x89ABCDEFu, 14u,  4u, 0x0000000Fu },
+    { 0x89ABCDEFu, 14u,  5u, 0x0000000Fu },
+    { 0x89ABCDEFu, 14u,  6u, 0x0000002Fu },
+    { 0x89ABCDEFu, 14u,  7u, 0x0000002Fu },
+    { 0x89ABCDEFu, 14u,  8u, 0x000000AFu },
+    { 0x89ABCDEFu, 14u,  9u, 0x000000AFu },
+    { 0x89ABCDEFu, 14u, 10u, 0x000002AFu },
+    { 0x89ABCDEFu, 14u, 11u, 0x000006AFu },
+    { 0x89ABCDEFu, 14u, 12u, 0x000006AFu },
+    { 0x89ABCDEFu, 14u, 13u, 0x000006AFu },
+    { 0x89ABCDEFu, 14u, 14u, 0x000026AFu },
+    { 0x89ABCDEFu, 14u, 15u, 0x000026AFu },
+    { 0x89ABCDEFu, 14u, 16u, 0x000026AFu },
+    { 0x89ABCDEFu, 14u, 17u, 0x000026AFu },
+    { 0x89ABCDEFu, 14u, 18u, 0x000226AFu },
+    { 0x89ABCDEFu, 15u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 15u,  1u, 0x00000001u },
+    { 0x89ABCDEFu, 15u,  2u, 0x00000003u },
+    { 0x89ABCDEFu, 15u,  3u, 0x00000007u },
+    { 0x89ABCDEFu, 15u,  4u, 0x00000007u },
+    { 0x89ABCDEFu, 15u,  5u, 0x00000017u },
+    { 0x89ABCDEFu, 15u,  6u, 0x00000017u },
+    { 0x89ABCDEFu, 15u,  7u, 0x00000057u },
+    { 0x89ABCDEFu, 15u,  8u, 0x00000057u },
+    { 0x89ABCDEFu, 15u,  9u, 0x00000157u },
+    { 0x89ABCDEFu, 15u, 10u, 0x00000357u },
+    { 0x89ABCDEFu, 15u, 11u, 0x00000357u },
+    { 0x89ABCDEFu, 15u, 12u, 0x00000357u },
+    { 0x89ABCDEFu, 15u, 13u, 0x00001357u },
+    { 0x89ABCDEFu, 15u, 14u, 0x00001357u },
+    { 0x89ABCDEFu, 15u, 15u, 0x00001357u },
+    { 0x89ABCDEFu, 15u, 16u, 0x00001357u },
+    { 0x89ABCDEFu, 15u, 17u, 0x00011357u },
+    { 0x89ABCDEFu, 16u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 16u,  1u, 0x00000001u },
+    { 0x89ABCDEFu, 16u,  2u, 0x00000003u },
+    { 0x89ABCDEFu, 16u,  3u, 0x00000003u },
+    { 0x89ABCDEFu, 16u,  4u, 0x0000000Bu },
+    { 0x89ABCDEFu, 16u,  5u, 0x0000000Bu },
+    { 0x89ABCDEFu, 16u,  6u, 0x0000002Bu },
+    { 0x89ABCDEFu, 16u,  7u, 0x0000002Bu },
+    { 0x89ABCDEFu, 16u,  8u, 0x000000ABu },
+    { 0x89ABCDEFu, 16u,  9u, 0x000001ABu },
+    { 0x89ABCDEFu, 16u, 10u, 0x000001ABu },
+    { 0x89ABCDEFu, 16u, 11u, 0x000001ABu },
+    { 0x89ABCDEFu, 16u, 12u, 0x000009ABu },
+    { 0x89ABCDEFu, 16u, 13u, 0x000009ABu },
+    { 0x89ABCDEFu, 16u, 14u, 0x000009ABu },
+    { 0x89ABCDEFu, 16u, 15u, 0x000009ABu },
+    { 0x89ABCDEFu, 16u, 16u, 0x000089ABu },
+    { 0x89ABCDEFu, 17u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 17u,  1u, 0x00000001u },
+    { 0x89ABCDEFu, 17u,  2u, 0x00000001u },
+    { 0x89ABCDEFu, 17u,  3u, 0x00000005u },
+    { 0x89ABCDEFu, 17u,  4u, 0x00000005u },
+    { 0x89ABCDEFu, 17u,  5u, 0x00000015u },
+    { 0x89ABCDEFu, 17u,  6u, 0x00000015u },
+    { 0x89ABCDEFu, 17u,  7u, 0x00000055u },
+    { 0x89ABCDEFu, 17u,  8u, 0x000000D5u },
+    { 0x89ABCDEFu, 17u,  9u, 0x000000D5u },
+    { 0x89ABCDEFu, 17u, 10u, 0x000000D5u },
+    { 0x89ABCDEFu, 17u, 11u, 0x000004D5u },
+    { 0x89ABCDEFu, 17u, 12u, 0x000004D5u },
+    { 0x89ABCDEFu, 17u, 13u, 0x000004D5u },
+    { 0x89ABCDEFu, 17u, 14u, 0x000004D5u },
+    { 0x89ABCDEFu, 17u, 15u, 0x000044D5u },
+    { 0x89ABCDEFu, 18u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 18u,  1u, 0x00000000u },
+    { 0x89ABCDEFu, 18u,  2u, 0x00000002u },
+    { 0x89ABCDEFu, 18u,  3u, 0x00000002u },
+    { 0x89ABCDEFu, 18u,  4u, 0x0000000Au },
+    { 0x89ABCDEFu, 18u,  5u, 0x0000000Au },
+    { 0x89ABCDEFu, 18u,  6u, 0x0000002Au },
+    { 0x89ABCDEFu, 18u,  7u, 0x0000006Au },
+    { 0x89ABCDEFu, 18u,  8u, 0x0000006Au },
+    { 0x89ABCDEFu, 18u,  9u, 0x0000006Au },
+    { 0x89ABCDEFu, 18u, 10u, 0x0000026Au },
+    { 0x89ABCDEFu, 18u, 11u, 0x0000026Au },
+    { 0x89ABCDEFu, 18u, 12u, 0x0000026Au },
+    { 0x89ABCDEFu, 18u, 13u, 0x0000026Au },
+    { 0x89ABCDEFu, 18u, 14u, 0x0000226Au },
+    { 0x89ABCDEFu, 19u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 19u,  1u, 0x00000001u },
+    { 0x89ABCDEFu, 19u,  2u, 0x00000001u },
+    { 0x89ABCDEFu, 19u,  3u, 0x00000005u },
+    { 0x89ABCDEFu, 19u,  4u, 0x00000005u },
+    { 0x89ABCDEFu, 19u,  5u, 0x00000015u },
+    { 0x89ABCDEFu, 19u,  6u, 0x00000035u },
+    { 0x89ABCDEFu, 19u,  7u, 0x00000035u },
+    { 0x89ABCDEFu, 19u,  8u, 0x00000035u },
+    { 0x89ABCDEFu, 19u,  9u, 0x00000135u },
+    { 0x89ABCDEFu, 19u, 10u, 0x00000135u },
+    { 0x89ABCDEFu, 19u, 11u, 0x00000135u },
+    { 0x89ABCDEFu, 19u, 12u, 0x00000135u },
+    { 0x89ABCDEFu, 19u, 13u, 0x00001135u },
+    { 0x89ABCDEFu, 20u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 20u,  1u, 0x00000000u },
+    { 0x89ABCDEFu, 20u,  2u, 0x00000002u },
+    { 0x89ABCDEFu, 20u,  3u, 0x00000002u },
+    { 0x89ABCDEFu, 20u,  4u, 0x0000000Au },
+    { 0x89ABCDEFu, 20u,  5u, 0x0000001Au },
+    { 0x89ABCDEFu, 20u,  6u, 0x0000001Au },
+    { 0x89ABCDEFu, 20u,  7u, 0x0000001Au },
+    { 0x89ABCDEFu, 20u,  8u, 0x0000009Au },
+    { 0x89ABCDEFu, 20u,  9u, 0x0000009Au },
+    { 0x89ABCDEFu, 20u, 10u, 0x0000009Au },
+    { 0x89ABCDEFu, 20u, 11u, 0x0000009Au },
+    { 0x89ABCDEFu, 20u, 12u, 0x0000089Au },
+    { 0x89ABCDEFu, 21u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 21u,  1u, 0x00000001u },
+    { 0x89ABCDEFu, 21u,  2u, 0x00000001u },
+    { 0x89ABCDEFu, 21u,  3u, 0x00000005u },
+    { 0x89ABCDEFu, 21u,  4u, 0x0000000Du },
+    { 0x89ABCDEFu, 21u,  5u, 0x0000000Du },
+    { 0x89ABCDEFu, 21u,  6u, 0x0000000Du },
+    { 0x89ABCDEFu, 21u,  7u, 0x0000004Du },
+    { 0x89ABCDEFu, 21u,  8u, 0x0000004Du },
+    { 0x89ABCDEFu, 21u,  9u, 0x0000004Du },
+    { 0x89ABCDEFu, 21u, 10u, 0x0000004Du },
+    { 0x89ABCDEFu, 21u, 11u, 0x0000044Du },
+    { 0x89ABCDEFu, 22u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 22u,  1u, 0x00000000u },
+    { 0x89ABCDEFu, 22u,  2u, 0x00000002u },
+    { 0x89ABCDEFu, 22u,  3u, 0x00000006u },
+    { 0x89ABCDEFu, 22u,  4u, 0x00000006u },
+    { 0x89ABCDEFu, 22u,  5u, 0x00000006u },
+    { 0x89ABCDEFu, 22u,  6u, 0x00000026u },
+    { 0x89ABCDEFu, 22u,  7u, 0x00000026u },
+    { 0x89ABCDEFu, 22u,  8u, 0x00000026u },
+    { 0x89ABCDEFu, 22u,  9u, 0x00000026u },
+    { 0x89ABCDEFu, 22u, 10u, 0x00000226u },
+    { 0x89ABCDEFu, 23u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 23u,  1u, 0x00000001u },
+    { 0x89ABCDEFu, 23u,  2u, 0x00000003u },
+    { 0x89ABCDEFu, 23u,  3u, 0x00000003u },
+    { 0x89ABCDEFu, 23u,  4u, 0x00000003u },
+    { 0x89ABCDEFu, 23u,  5u, 0x00000013u },
+    { 0x89ABCDEFu, 23u,  6u, 0x00000013u },
+    { 0x89ABCDEFu, 23u,  7u, 0x00000013u },
+    { 0x89ABCDEFu, 23u,  8u, 0x00000013u },
+    { 0x89ABCDEFu, 23u,  9u, 0x00000113u },
+    { 0x89ABCDEFu, 24u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 24u,  1u, 0x00000001u },
+    { 0x89ABCDEFu, 24u,  2u, 0x00000001u },
+    { 0x89ABCDEFu, 24u,  3u, 0x00000001u },
+    { 0x89ABCDEFu, 24u,  4u, 0x00000009u },
+    { 0x89ABCDEFu, 24u,  5u, 0x00000009u },
+    { 0x89ABCDEFu, 24u,  6u, 0x00000009u },
+    { 0x89ABCDEFu, 24u,  7u, 0x00000009u },
+    { 0x89ABCDEFu, 24u,  8u, 0x00000089u },
+    { 0x89ABCDEFu, 25u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 25u,  1u, 0x00000000u },
+    { 0x89ABCDEFu, 25u,  2u, 0x00000000u },
+    { 0x89ABCDEFu, 25u,  3u, 0x00000004u },
+    { 0x89ABCDEFu, 25u,  4u, 0x00000004u },
+    { 0x89ABCDEFu, 25u,  5u, 0x00000004u },
+    { 0x89ABCDEFu, 25u,  6u, 0x00000004u },
+    { 0x89ABCDEFu, 25u,  7u, 0x00000044u },
+    { 0x89ABCDEFu, 26u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 26u,  1u, 0x00000000u },
+    { 0x89ABCDEFu, 26u,  2u, 0x00000002u },
+    { 0x89ABCDEFu, 26u,  3u, 0x00000002u },
+    { 0x89ABCDEFu, 26u,  4u, 0x00000002u },
+    { 0x89ABCDEFu, 26u,  5u, 0x00000002u },
+    { 0x89ABCDEFu, 26u,  6u, 0x00000022u },
+    { 0x89ABCDEFu, 27u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 27u,  1u, 0x00000001u },
+    { 0x89ABCDEFu, 27u,  2u, 0x00000001u },
+    { 0x89ABCDEFu, 27u,  3u, 0x00000001u },
+    { 0x89ABCDEFu, 27u,  4u, 0x00000001u },
+    { 0x89ABCDEFu, 27u,  5u, 0x00000011u },
+    { 0x89ABCDEFu, 28u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 28u,  1u, 0x00000000u },
+    { 0x89ABCDEFu, 28u,  2u, 0x00000000u },
+    { 0x89ABCDEFu, 28u,  3u, 0x00000000u },
+    { 0x89ABCDEFu, 28u,  4u, 0x00000008u },
+    { 0x89ABCDEFu, 29u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 29u,  1u, 0x00000000u },
+    { 0x89ABCDEFu, 29u,  2u, 0x00000000u },
+    { 0x89ABCDEFu, 29u,  3u, 0x00000004u },
+    { 0x89ABCDEFu, 30u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 30u,  1u, 0x00000000u },
+    { 0x89ABCDEFu, 30u,  2u, 0x00000002u },
+    { 0x89ABCDEFu, 31u,  0u, 0x00000000u },
+    { 0x89ABCDEFu, 31u,  1u, 0x00000001u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_GetBits_u32u8u8_u32 vectors**
+ *
+ * The test runs the 560 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00028, SWS_Bfx_00029, SWS_Bfx_00034
+ */
+void test__Bfx_GetBits_u32u8u8_u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( GetBits_u32u8u8_u32 ) / sizeof( GetBits_u32u8u8_u32[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( GetBits_u32u8u8_u32[ i ].Expected, Bfx_GetBits_u32u8u8_u32( GetBits_u32u8u8_u32[ i ].Data, GetBits_u32u8u8_u32[ i ].BitStartPn, GetBits_u32u8u8_u32[ i ].BitLn ), Vector( "Bfx_GetBits_u32u8u8_u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 BitStartPn;
+    uint8 BitLn;
+    uint32 Pattern;
+    uint32 Expected;
+} PutBits_u32u8u8u32[] = {
+    { 0xFFFFFFFFu,  0u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  0u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  0u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  0u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  0u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  0u,  5u, 0x89ABCDEFu, 0xFFFFFFEFu },
+    { 0xFFFFFFFFu,  0u,  6u, 0x89ABCDEFu, 0xFFFFFFEFu },
+    { 0xFFFFFFFFu,  0u,  7u, 0x89ABCDEFu, 0xFFFFFFEFu },
+    { 0xFFFFFFFFu,  0u,  8u, 0x89ABCDEFu, 0xFFFFFFEFu },
+    { 0xFFFFFFFFu,  0u,  9u, 0x89ABCDEFu, 0xFFFFFFEFu },
+    { 0xFFFFFFFFu,  0u, 10u, 0x89ABCDEFu, 0xFFFFFDEFu },
+    { 0xFFFFFFFFu,  0u, 11u, 0x89ABCDEFu, 0xFFFFFDEFu },
+    { 0xFFFFFFFFu,  0u, 12u, 0x89ABCDEFu, 0xFFFFFDEFu },
+    { 0xFFFFFFFFu,  0u, 13u, 0x89ABCDEFu, 0xFFFFEDEFu },
+    { 0xFFFFFFFFu,  0u, 14u, 0x89ABCDEFu, 0xFFFFCDEFu },
+    { 0xFFFFFFFFu,  0u, 15u, 0x89ABCDEFu, 0xFFFFCDEFu },
+    { 0xFFFFFFFFu,  0u, 16u, 0x89ABCDEFu, 0xFFFFCDEFu },
+    { 0xFFFFFFFFu,  0u, 17u, 0x89ABCDEFu, 0xFFFFCDEFu },
+    { 0xFFFFFFFFu,  0u, 18u, 0x89ABCDEFu, 0xFFFFCDEFu },
+    { 0xFFFFFFFFu,  0u, 19u, 0x89ABCDEFu, 0xFFFBCDEFu },
+    { 0xFFFFFFFFu,  0u, 20u, 0x89ABCDEFu, 0xFFFBCDEFu },
+    { 0xFFFFFFFFu,  0u, 21u, 0x89ABCDEFu, 0xFFEBCDEFu },
+    { 0xFFFFFFFFu,  0u, 22u, 0x89ABCDEFu, 0xFFEBCDEFu },
+    { 0xFFFFFFFFu,  0u, 23u, 0x89ABCDEFu, 0xFFABCDEFu },
+    { 0xFFFFFFFFu,  0u, 24u, 0x89ABCDEFu, 0xFFABCDEFu },
+    { 0xFFFFFFFFu,  0u, 25u, 0x89ABCDEFu, 0xFFABCDEFu },
+    { 0xFFFFFFFFu,  0u, 26u, 0x89ABCDEFu, 0xFDABCDEFu },
+    { 0xFFFFFFFFu,  0u, 27u, 0x89ABCDEFu, 0xF9ABCDEFu },
+    { 0xFFFFFFFFu,  0u, 28u, 0x89ABCDEFu, 0xF9ABCDEFu },
+    { 0xFFFFFFFFu,  0u, 29u, 0x89ABCDEFu, 0xE9ABCDEFu },
+    { 0xFFFFFFFFu,  0u, 30u, 0x89ABCDEFu, 0xC9ABCDEFu },
+    { 0xFFFFFFFFu,  0u, 31u, 0x89ABCDEFu, 0x89ABCDEFu },
+    { 0xFFFFFFFFu,  0u, 32u, 0x89ABCDEFu, 0x89ABCDEFu },
+    { 0xFFFFFFFFu,  1u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  1u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  1u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  1u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  1u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  1u,  5u, 0x89ABCDEFu, 0xFFFFFFDFu },
+    { 0xFFFFFFFFu,  1u,  6u, 0x89ABCDEFu, 0xFFFFFFDFu },
+    { 0xFFFFFFFFu,  1u,  7u, 0x89ABCDEFu, 0xFFFFFFDFu },
+    { 0xFFFFFFFFu,  1u,  8u, 0x89ABCDEFu, 0xFFFFFFDFu },
+    { 0xFFFFFFFFu,  1u,  9u, 0x89ABCDEFu, 0xFFFFFFDFu },
+    { 0xFFFFFFFFu,  1u, 10u, 0x89ABCDEFu, 0xFFFFFBDFu },
+    { 0xFFFFFFFFu,  1u, 11u, 0x89ABCDEFu, 0xFFFFFBDFu },
+    { 0xFFFFFFFFu,  1u, 12u, 0x89ABCDEFu, 0xFFFFFBDFu },
+    { 0xFFFFFFFFu,  1u, 13u, 0x89ABCDEFu, 0xFFFFDBDFu },
+    { 0xFFFFFFFFu,  1u, 14u, 0x89ABCDEFu, 0xFFFF9BDFu },
+    { 0xFFFFFFFFu,  1u, 15u, 0x89ABCDEFu, 0xFFFF9BDFu },
+    { 0xFFFFFFFFu,  1u, 16u, 0x89ABCDEFu, 0xFFFF9BDFu },
+    { 0xFFFFFFFFu,  1u, 17u, 0x89ABCDEFu, 0xFFFF9BDFu },
+    { 0xFFFFFFFFu,  1u, 18u, 0x89ABCDEFu, 0xFFFF9BDFu },
+    { 0xFFFFFFFFu,  1u, 19u, 0x89ABCDEFu, 0xFFF79BDFu },
+    { 0xFFFFFFFFu,  1u, 20u, 0x89ABCDEFu, 0xFFF79BDFu },
+    { 0xFFFFFFFFu,  1u, 21u, 0x89ABCDEFu, 0xFFD79BDFu },
+    { 0xFFFFFFFFu,  1u, 22u, 0x89ABCDEFu, 0xFFD79BDFu },
+    { 0xFFFFFFFFu,  1u, 23u, 0x89ABCDEFu, 0xFF579BDFu },
+    { 0xFFFFFFFFu,  1u, 24u, 0x89ABCDEFu, 0xFF579BDFu },
+    { 0xFFFFFFFFu,  1u, 25u, 0x89ABCDEFu, 0xFF579BDFu },
+    { 0xFFFFFFFFu,  1u, 26u, 0x89ABCDEFu, 0xFB579BDFu },
+    { 0xFFFFFFFFu,  1u, 27u, 0x89ABCDEFu, 0xF3579BDFu },
+    { 0xFFFFFFFFu,  1u, 28u, 0x89ABCDEFu, 0xF3579BDFu },
+    { 0xFFFFFFFFu,  1u, 29u, 0x89ABCDEFu, 0xD3579BDFu },
+    { 0xFFFFFFFFu,  1u, 30u, 0x89ABCDEFu, 0x93579BDFu },
+    { 0xFFFFFFFFu,  1u, 31u, 0x89ABCDEFu, 0x13579BDFu },
+    { 0xFFFFFFFFu,  2u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  2u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  2u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  2u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  2u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  2u,  5u, 0x89ABCDEFu, 0xFFFFFFBFu },
+    { 0xFFFFFFFFu,  2u,  6u, 0x89ABCDEFu, 0xFFFFFFBFu },
+    { 0xFFFFFFFFu,  2u,  7u, 0x89ABCDEFu, 0xFFFFFFBFu },
+    { 0xFFFFFFFFu,  2u,  8u, 0x89ABCDEFu, 0xFFFFFFBFu },
+    { 0xFFFFFFFFu,  2u,  9u, 0x89ABCDEFu, 0xFFFFFFBFu },
+    { 0xFFFFFFFFu,  2u, 10u, 0x89ABCDEFu, 0xFFFFF7BFu },
+    { 0xFFFFFFFFu,  2u, 11u, 0x89ABCDEFu, 0xFFFFF7BFu },
+    { 0xFFFFFFFFu,  2u, 12u, 0x89ABCDEFu, 0xFFFFF7BFu },
+    { 0xFFFFFFFFu,  2u, 13u, 0x89ABCDEFu, 0xFFFFB7BFu },
+    { 0xFFFFFFFFu,  2u, 14u, 0x89ABCDEFu, 0xFFFF37BFu },
+    { 0xFFFFFFFFu,  2u, 15u, 0x89ABCDEFu, 0xFFFF37BFu },
+    { 0xFFFFFFFFu,  2u, 16u, 0x89ABCDEFu, 0xFFFF37BFu },
+    { 0xFFFFFFFFu,  2u, 17u, 0x89ABCDEFu, 0xFFFF37BFu },
+    { 0xFFFFFFFFu,  2u, 18u, 0x89ABCDEFu, 0xFFFF37BFu },
+    { 0xFFFFFFFFu,  2u, 19u, 0x89ABCDEFu, 0xFFEF37BFu },
+    { 0xFFFFFFFFu,  2u, 20u, 0x89ABCDEFu, 0xFFEF37BFu },
+    { 0xFFFFFFFFu,  2u, 21u, 0x89ABCDEFu, 0xFFAF37BFu },
+    { 0xFFFFFFFFu,  2u, 22u, 0x89ABCDEFu, 0xFFAF37BFu },
+    { 0xFFFFFFFFu,  2u, 23u, 0x89ABCDEFu, 0xFEAF37BFu },
+    { 0xFFFFFFFFu,  2u, 24u, 0x89ABCDEFu, 0xFEAF37BFu },
+    { 0xFFFFFFFFu,  2u, 25u, 0x89ABCDEFu, 0xFEAF37BFu },
+    { 0xFFFFFFFFu,  2u, 26u, 0x89ABCDEFu, 0xF6AF37BFu },
+    { 0xFFFFFFFFu,  2u, 27u, 0x89ABCDEFu, 0xE6AF37BFu },
+    { 0xFFFFFFFFu,  2u, 28u, 0x89ABCDEFu, 0xE6AF37BFu },
+    { 0xFFFFFFFFu,  2u, 29u, 0x89ABCDEFu, 0xA6AF37BFu },
+    { 0xFFFFFFFFu,  2u, 30u, 0x89ABCDEFu, 0x26AF37BFu },
+    { 0xFFFFFFFFu,  3u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  3u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  3u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  3u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  3u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  3u,  5u, 0x89ABCDEFu, 0xFFFFFF7Fu },
+    { 0xFFFFFFFFu,  3u,  6u, 0x89ABCDEFu, 0xFFFFFF7Fu },
+    { 0xFFFFFFFFu,  3u,  7u, 0x89ABCDEFu, 0xFFFFFF7Fu },
+    { 0xFFFFFFFFu,  3u,  8u, 0x89ABCDEFu, 0xFFFFFF7Fu },
+    { 0xFFFFFFFFu,  3u,  9u, 0x89ABCDEFu, 0xFFFFFF7Fu },
+    { 0xFFFFFFFFu,  3u, 10u, 0x89ABCDEFu, 0xFFFFEF7Fu },
+    { 0xFFFFFFFFu,  3u, 11u, 0x89ABCDEFu, 0xFFFFEF7Fu },
+    { 0xFFFFFFFFu,  3u, 12u, 0x89ABCDEFu, 0xFFFFEF7Fu },
+    { 0xFFFFFFFFu,  3u, 13u, 0x89ABCDEFu, 0xFFFF6F7Fu },
+    { 0xFFFFFFFFu,  3u, 14u, 0x89ABCDEFu, 0xFFFE6F7Fu },
+    { 0xFFFFFFFFu,  3u, 15u, 0x89ABCDEFu, 0xFFFE6F7Fu },
+    { 0xFFFFFFFFu,  3u, 16u, 0x89ABCDEFu, 0xFFFE6F7Fu },
+    { 0xFFFFFFFFu,  3u, 17u, 0x89ABCDEFu, 0xFFFE6F7Fu },
+    { 0xFFFFFFFFu,  3u, 18u, 0x89ABCDEFu, 0xFFFE6F7Fu },
+    { 0xFFFFFFFFu,  3u, 19u, 0x89ABCDEFu, 0xFFDE6F7Fu },
+    { 0xFFFFFFFFu,  3u, 20u, 0x89ABCDEFu, 0xFFDE6F7Fu },
+    { 0xFFFFFFFFu,  3u, 21u, 0x89ABCDEFu, 0xFF5E6F7Fu },
+    { 0xFFFFFFFFu,  3u, 22u, 0x89ABCDEFu, 0xFF5E6F7Fu },
+    { 0xFFFFFFFFu,  3u, 23u, 0x89ABCDEFu, 0xFD5E6F7Fu },
+    { 0xFFFFFFFFu,  3u, 24u, 0x89ABCDEFu, 0xFD5E6F7Fu },
+    { 0xFFFFFFFFu,  3u, 25u, 0x89ABCDEFu, 0xFD5E6F7Fu },
+    { 0xFFFFFFFFu,  3u, 26u, 0x89ABCDEFu, 0xED5E6F7Fu },
+    { 0xFFFFFFFFu,  3u, 27u, 0x89ABCDEFu, 0xCD5E6F7Fu },
+    { 0xFFFFFFFFu,  3u, 28u, 0x89ABCDEFu, 0xCD5E6F7Fu },
+    { 0xFFFFFFFFu,  3u, 29u, 0x89ABCDEFu, 0x4D5E6F7Fu },
+    { 0xFFFFFFFFu,  4u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  4u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  4u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  4u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  4u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  4u,  5u, 0x89ABCDEFu, 0xFFFFFEFFu },
+    { 0xFFFFFFFFu,  4u,  6u, 0x89ABCDEFu, 0xFFFFFEFFu },
+    { 0xFFFFFFFFu,  4u,  7u, 0x89ABCDEFu, 0xFFFFFEFFu },
+    { 0xFFFFFFFFu,  4u,  8u, 0x89ABCDEFu, 0xFFFFFEFFu },
+    { 0xFFFFFFFFu,  4u,  9u, 0x89ABCDEFu, 0xFFFFFEFFu },
+    { 0xFFFFFFFFu,  4u, 10u, 0x89ABCDEFu, 0xFFFFDEFFu },
+    { 0xFFFFFFFFu,  4u, 11u, 0x89ABCDEFu, 0xFFFFDEFFu },
+    { 0xFFFFFFFFu,  4u, 12u, 0x89ABCDEFu, 0xFFFFDEFFu },
+    { 0xFFFFFFFFu,  4u, 13u, 0x89ABCDEFu, 0xFFFEDEFFu },
+    { 0xFFFFFFFFu,  4u, 14u, 0x89ABCDEFu, 0xFFFCDEFFu },
+    { 0xFFFFFFFFu,  4u, 15u, 0x89ABCDEFu, 0xFFFCDEFFu },
+    { 0xFFFFFFFFu,  4u, 16u, 0x89ABCDEFu, 0xFFFCDEFFu },
+    { 0xFFFFFFFFu,  4u, 17u, 0x89ABCDEFu, 0xFFFCDEFFu },
+    { 0xFFFFFFFFu,  4u, 18u, 0x89ABCDEFu, 0xFFFCDEFFu },
+    { 0xFFFFFFFFu,  4u, 19u, 0x89ABCDEFu, 0xFFBCDEFFu },
+    { 0xFFFFFFFFu,  4u, 20u, 0x89ABCDEFu, 0xFFBCDEFFu },
+    { 0xFFFFFFFFu,  4u, 21u, 0x89ABCDEFu, 0xFEBCDEFFu },
+    { 0xFFFFFFFFu,  4u, 22u, 0x89ABCDEFu, 0xFEBCDEFFu },
+    { 0xFFFFFFFFu,  4u, 23u, 0x89ABCDEFu, 0xFABCDEFFu },
+    { 0xFFFFFFFFu,  4u, 24u, 0x89ABCDEFu, 0xFABCDEFFu },
+    { 0xFFFFFFFFu,  4u, 25u, 0x89ABCDEFu, 0xFABCDEFFu },
+    { 0xFFFFFFFFu,  4u, 26u, 0x89ABCDEFu, 0xDABCDEFFu },
+    { 0xFFFFFFFFu,  4u, 27u, 0x89ABCDEFu, 0x9ABCDEFFu },
+    { 0xFFFFFFFFu,  4u, 28u, 0x89ABCDEFu, 0x9ABCDEFFu },
+    { 0xFFFFFFFFu,  5u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  5u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  5u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  5u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  5u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  5u,  5u, 0x89ABCDEFu, 0xFFFFFDFFu },
+    { 0xFFFFFFFFu,  5u,  6u, 0x89ABCDEFu, 0xFFFFFDFFu },
+    { 0xFFFFFFFFu,  5u,  7u, 0x89ABCDEFu, 0xFFFFFDFFu },
+    { 0xFFFFFFFFu,  5u,  8u, 0x89ABCDEFu, 0xFFFFFDFFu },
+    { 0xFFFFFFFFu,  5u,  9u, 0x89ABCDEFu, 0xFFFFFDFFu },
+    { 0xFFFFFFFFu,  5u, 10u, 0x89ABCDEFu, 0xFFFFBDFFu },
+    { 0xFFFFFFFFu,  5u, 11u, 0x89ABCDEFu, 0xFFFFBDFFu },
+    { 0xFFFFFFFFu,  5u, 12u, 0x89ABCDEFu, 0xFFFFBDFFu },
+    { 0xFFFFFFFFu,  5u, 13u, 0x89ABCDEFu, 0xFFFDBDFFu },
+    { 0xFFFFFFFFu,  5u, 14u, 0x89ABCDEFu, 0xFFF9BDFFu },
+    { 0xFFFFFFFFu,  5u, 15u, 0x89ABCDEFu, 0xFFF9BDFFu },
+    { 0xFFFFFFFFu,  5u, 16u, 0x89ABCDEFu, 0xFFF9BDFFu },
+    { 0xFFFFFFFFu,  5u, 17u, 0x89ABCDEFu, 0xFFF9BDFFu },
+    { 0xFFFFFFFFu,  5u, 18u, 0x89ABCDEFu, 0xFFF9BDFFu },
+    { 0xFFFFFFFFu,  5u, 19u, 0x89ABCDEFu, 0xFF79BDFFu },
+    { 0xFFFFFFFFu,  5u, 20u, 0x89ABCDEFu, 0xFF79BDFFu },
+    { 0xFFFFFFFFu,  5u, 21u, 0x89ABCDEFu, 0xFD79BDFFu },
+    { 0xFFFFFFFFu,  5u, 22u, 0x89ABCDEFu, 0xFD79BDFFu },
+    { 0xFFFFFFFFu,  5u, 23u, 0x89ABCDEFu, 0xF579BDFFu },
+    { 0xFFFFFFFFu,  5u, 24u, 0x89ABCDEFu, 0xF579BDFFu },
+    { 0xFFFFFFFFu,  5u, 25u, 0x89ABCDEFu, 0xF579BDFFu },
+    { 0xFFFFFFFFu,  5u, 26u, 0x89ABCDEFu, 0xB579BDFFu },
+    { 0xFFFFFFFFu,  5u, 27u, 0x89ABCDEFu, 0x3579BDFFu },
+    { 0xFFFFFFFFu,  6u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  6u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  6u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  6u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  6u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  6u,  5u, 0x89ABCDEFu, 0xFFFFFBFFu },
+    { 0xFFFFFFFFu,  6u,  6u, 0x89ABCDEFu, 0xFFFFFBFFu },
+    { 0xFFFFFFFFu,  6u,  7u, 0x89ABCDEFu, 0xFFFFFBFFu },
+    { 0xFFFFFFFFu,  6u,  8u, 0x89ABCDEFu, 0xFFFFFBFFu },
+    { 0xFFFFFFFFu,  6u,  9u, 0x89ABCDEFu, 0xFFFFFBFFu },
+    { 0xFFFFFFFFu,  6u, 10u, 0x89ABCDEFu, 0xFFFF7BFFu },
+    { 0xFFFFFFFFu,  6u, 11u, 0x89ABCDEFu, 0xFFFF7BFFu },
+    { 0xFFFFFFFFu,  6u, 12u, 0x89ABCDEFu, 0xFFFF7BFFu },
+    { 0xFFFFFFFFu,  6u, 13u, 0x89ABCDEFu, 0xFFFB7BFFu },
+    { 0xFFFFFFFFu,  6u, 14u, 0x89ABCDEFu, 0xFFF37BFFu },
+    { 0xFFFFFFFFu,  6u, 15u, 0x89ABCDEFu, 0xFFF37BFFu },
+    { 0xFFFFFFFFu,  6u, 16u, 0x89ABCDEFu, 0xFFF37BFFu },
+    { 0xFFFFFFFFu,  6u, 17u, 0x89ABCDEFu, 0xFFF37BFFu },
+    { 0xFFFFFFFFu,  6u, 18u, 0x89ABCDEFu, 0xFFF37BFFu },
+    { 0xFFFFFFFFu,  6u, 19u, 0x89ABCDEFu, 0xFEF37BFFu },
+    { 0xFFFFFFFFu,  6u, 20u, 0x89ABCDEFu, 0xFEF37BFFu },
+    { 0xFFFFFFFFu,  6u, 21u, 0x89ABCDEFu, 0xFAF37BFFu },
+    { 0xFFFFFFFFu,  6u, 22u, 0x89ABCDEFu, 0xFAF37BFFu },
+    { 0xFFFFFFFFu,  6u, 23u, 0x89ABCDEFu, 0xEAF37BFFu },
+    { 0xFFFFFFFFu,  6u, 24u, 0x89ABCDEFu, 0xEAF37BFFu },
+    { 0xFFFFFFFFu,  6u, 25u, 0x89ABCDEFu, 0xEAF37BFFu },
+    { 0xFFFFFFFFu,  6u, 26u, 0x89ABCDEFu, 0x6AF37BFFu },
+    { 0xFFFFFFFFu,  7u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  7u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  7u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  7u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  7u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  7u,  5u, 0x89ABCDEFu, 0xFFFFF7FFu },
+    { 0xFFFFFFFFu,  7u,  6u, 0x89ABCDEFu, 0xFFFFF7FFu },
+    { 0xFFFFFFFFu,  7u,  7u, 0x89ABCDEFu, 0xFFFFF7FFu },
+    { 0xFFFFFFFFu,  7u,  8u, 0x89ABCDEFu, 0xFFFFF7FFu },
+    { 0xFFFFFFFFu,  7u,  9u, 0x89ABCDEFu, 0xFFFFF7FFu },
+    { 0xFFFFFFFFu,  7u, 10u, 0x89ABCDEFu, 0xFFFEF7FFu },
+    { 0xFFFFFFFFu,  7u, 11u, 0x89ABCDEFu, 0xFFFEF7FFu },
+    { 0xFFFFFFFFu,  7u, 12u, 0x89ABCDEFu, 0xFFFEF7FFu },
+    { 0xFFFFFFFFu,  7u, 13u, 0x89ABCDEFu, 0xFFF6F7FFu },
+    { 0xFFFFFFFFu,  7u, 14u, 0x89ABCDEFu, 0xFFE6F7FFu },
+    { 0xFFFFFFFFu,  7u, 15u, 0x89ABCDEFu, 0xFFE6F7FFu },
+    { 0xFFFFFFFFu,  7u, 16u, 0x89ABCDEFu, 0xFFE6F7FFu },
+    { 0xFFFFFFFFu,  7u, 17u, 0x89ABCDEFu, 0xFFE6F7FFu },
+    { 0xFFFFFFFFu,  7u, 18u, 0x89ABCDEFu, 0xFFE6F7FFu },
+    { 0xFFFFFFFFu,  7u, 19u, 0x89ABCDEFu, 0xFDE6F7FFu },
+    { 0xFFFFFFFFu,  7u, 20u, 0x89ABCDEFu, 0xFDE6F7FFu },
+    { 0xFFFFFFFFu,  7u, 21u, 0x89ABCDEFu, 0xF5E6F7FFu },
+    { 0xFFFFFFFFu,  7u, 22u, 0x89ABCDEFu, 0xF5E6F7FFu },
+    { 0xFFFFFFFFu,  7u, 23u, 0x89ABCDEFu, 0xD5E6F7FFu },
+    { 0xFFFFFFFFu,  7u, 24u, 0x89ABCDEFu, 0xD5E6F7FFu },
+    { 0xFFFFFFFFu,  7u, 25u, 0x89ABCDEFu, 0xD5E6F7FFu },
+    { 0xFFFFFFFFu,  8u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  8u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  8u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  8u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  8u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  8u,  5u, 0x89ABCDEFu, 0xFFFFEFFFu },
+    { 0xFFFFFFFFu,  8u,  6u, 0x89ABCDEFu, 0xFFFFEFFFu },
+    { 0xFFFFFFFFu,  8u,  7u, 0x89ABCDEFu, 0xFFFFEFFFu },
+    { 0xFFFFFFFFu,  8u,  8u, 0x89ABCDEFu, 0xFFFFEFFFu },
+    { 0xFFFFFFFFu,  8u,  9u, 0x89ABCDEFu, 0xFFFFEFFFu },
+    { 0xFFFFFFFFu,  8u, 10u, 0x89ABCDEFu, 0xFFFDEFFFu },
+    { 0xFFFFFFFFu,  8u, 11u, 0x89ABCDEFu, 0xFFFDEFFFu },
+    { 0xFFFFFFFFu,  8u, 12u, 0x89ABCDEFu, 0xFFFDEFFFu },
+    { 0xFFFFFFFFu,  8u, 13u, 0x89ABCDEFu, 0xFFEDEFFFu },
+    { 0xFFFFFFFFu,  8u, 14u, 0x89ABCDEFu, 0xFFCDEFFFu },
+    { 0xFFFFFFFFu,  8u, 15u, 0x89ABCDEFu, 0xFFCDEFFFu },
+    { 0xFFFFFFFFu,  8u, 16u, 0x89ABCDEFu, 0xFFCDEFFFu },
+    { 0xFFFFFFFFu,  8u, 17u, 0x89ABCDEFu, 0xFFCDEFFFu },
+    { 0xFFFFFFFFu,  8u, 18u, 0x89ABCDEFu, 0xFFCDEFFFu },
+    { 0xFFFFFFFFu,  8u, 19u, 0x89ABCDEFu, 0xFBCDEFFFu },
+    { 0xFFFFFFFFu,  8u, 20u, 0x89ABCDEFu, 0xFBCDEFFFu },
+    { 0xFFFFFFFFu,  8u, 21u, 0x89ABCDEFu, 0xEBCDEFFFu },
+    { 0xFFFFFFFFu,  8u, 22u, 0x89ABCDEFu, 0xEBCDEFFFu },
+    { 0xFFFFFFFFu,  8u, 23u, 0x89ABCDEFu, 0xABCDEFFFu },
+    { 0xFFFFFFFFu,  8u, 24u, 0x89ABCDEFu, 0xABCDEFFFu },
+    { 0xFFFFFFFFu,  9u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  9u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  9u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  9u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  9u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  9u,  5u, 0x89ABCDEFu, 0xFFFFDFFFu },
+    { 0xFFFFFFFFu,  9u,  6u, 0x89ABCDEFu, 0xFFFFDFFFu },
+    { 0xFFFFFFFFu,  9u,  7u, 0x89ABCDEFu, 0xFFFFDFFFu },
+    { 0xFFFFFFFFu,  9u,  8u, 0x89ABCDEFu, 0xFFFFDFFFu },
+    { 0xFFFFFFFFu,  9u,  9u, 0x89ABCDEFu, 0xFFFFDFFFu },
+    { 0xFFFFFFFFu,  9u, 10u, 0x89ABCDEFu, 0xFFFBDFFFu },
+    { 0xFFFFFFFFu,  9u, 11u, 0x89ABCDEFu, 0xFFFBDFFFu },
+    { 0xFFFFFFFFu,  9u, 12u, 0x89ABCDEFu, 0xFFFBDFFFu },
+    { 0xFFFFFFFFu,  9u, 13u, 0x89ABCDEFu, 0xFFDBDFFFu },
+    { 0xFFFFFFFFu,  9u, 14u, 0x89ABCDEFu, 0xFF9BDFFFu },
+    { 0xFFFFFFFFu,  9u, 15u, 0x89ABCDEFu, 0xFF9BDFFFu },
+    { 0xFFFFFFFFu,  9u, 16u, 0x89ABCDEFu, 0xFF9BDFFFu },
+    { 0xFFFFFFFFu,  9u, 17u, 0x89ABCDEFu, 0xFF9BDFFFu },
+    { 0xFFFFFFFFu,  9u, 18u, 0x89ABCDEFu, 0xFF9BDFFFu },
+    { 0xFFFFFFFFu,  9u, 19u, 0x89ABCDEFu, 0xF79BDFFFu },
+    { 0xFFFFFFFFu,  9u, 20u, 0x89ABCDEFu, 0xF79BDFFFu },
+    { 0xFFFFFFFFu,  9u, 21u, 0x89ABCDEFu, 0xD79BDFFFu },
+    { 0xFFFFFFFFu,  9u, 22u, 0x89ABCDEFu, 0xD79BDFFFu },
+    { 0xFFFFFFFFu,  9u, 23u, 0x89ABCDEFu, 0x579BDFFFu },
+    { 0xFFFFFFFFu, 10u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 10u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 10u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 10u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 10u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 10u,  5u, 0x89ABCDEFu, 0xFFFFBFFFu },
+    { 0xFFFFFFFFu, 10u,  6u, 0x89ABCDEFu, 0xFFFFBFFFu },
+    { 0xFFFFFFFFu, 10u,  7u, 0x89ABCDEFu, 0xFFFFBFFFu },
+    { 0xFFFFFFFFu, 10u,  8u, 0x89ABCDEFu, 0xFFFFBFFFu },
+    { 0xFFFFFFFFu, 10u,  9u, 0x89ABCDEFu, 0xFFFFBFFFu },
+    { 0xFFFFFFFFu, 10u, 10u, 0x89ABCDEFu, 0xFFF7BFFFu },
+    { 0xFFFFFFFFu, 10u, 11u, 0x89ABCDEFu, 0xFFF7BFFFu },
+    { 0xFFFFFFFFu, 10u, 12u, 0x89ABCDEFu, 0xFFF7BFFFu },
+    { 0xFFFFFFFFu, 10u, 13u, 0x89ABCDEFu, 0xFFB7BFFFu },
+    { 0xFFFFFFFFu, 10u, 14u, 0x89ABCDEFu, 0xFF37BFFFu },
+    { 0xFFFFFFFFu, 10u, 15u, 0x89ABCDEFu, 0xFF37BFFFu },
+    { 0xFFFFFFFFu, 10u, 16u, 0x89ABCDEFu, 0xFF37BFFFu },
+    { 0xFFFFFFFFu, 10u, 17u, 0x89ABCDEFu, 0xFF37BFFFu },
+    { 0xFFFFFFFFu, 10u, 18u, 0x89ABCDEFu, 0xFF37BFFFu },
+    { 0xFFFFFFFFu, 10u, 19u, 0x89ABCDEFu, 0xEF37BFFFu },
+    { 0xFFFFFFFFu, 10u, 20u, 0x89ABCDEFu, 0xEF37BFFFu },
+    { 0xFFFFFFFFu, 10u, 21u, 0x89ABCDEFu, 0xAF37BFFFu },
+    { 0xFFFFFFFFu, 10u, 22u, 0x89ABCDEFu, 0xAF37BFFFu },
+    { 0xFFFFFFFFu, 11u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 11u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 11u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 11u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 11u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 11u,  5u, 0x89ABCDEFu, 0xFFFF7FFFu },
+    { 0xFFFFFFFFu, 11u,  6u, 0x89ABCDEFu, 0xFFFF7FFFu },
+    { 0xFFFFFFFFu, 11u,  7u, 0x89ABCDEFu, 0xFFFF7FFFu },
+    { 0xFFFFFFFFu, 11u,  8u, 0x89ABCDEFu, 0xFFFF7FFFu },
+    { 0xFFFFFFFFu, 11u,  9u, 0x89ABCDEFu, 0xFFFF7FFFu },
+    { 0xFFFFFFFFu, 11u, 10u, 0x89ABCDEFu, 0xFFEF7FFFu },
+    { 0xFFFFFFFFu, 11u, 11u, 0x89ABCDEFu, 0xFFEF7FFFu },
+    { 0xFFFFFFFFu, 11u, 12u, 0x89ABCDEFu, 0xFFEF7FFFu },
+    { 0xFFFFFFFFu, 11u, 13u, 0x89ABCDEFu, 0xFF6F7FFFu },
+    { 0xFFFFFFFFu, 11u, 14u, 0x89ABCDEFu, 0xFE6F7FFFu },
+    { 0xFFFFFFFFu, 11u, 15u, 0x89ABCDEFu, 0xFE6F7FFFu },
+    { 0xFFFFFFFFu, 11u, 16u, 0x89ABCDEFu, 0xFE6F7FFFu },
+    { 0xFFFFFFFFu, 11u, 17u, 0x89ABCDEFu, 0xFE6F7FFFu },
+    { 0xFFFFFFFFu, 11u, 18u, 0x89ABCDEFu, 0xFE6F7FFFu },
+    { 0xFFFFFFFFu, 11u, 19u, 0x89ABCDEFu, 0xDE6F7FFFu },
+    { 0xFFFFFFFFu, 11u, 20u, 0x89ABCDEFu, 0xDE6F7FFFu },
+    { 0xFFFFFFFFu, 11u, 21u, 0x89ABCDEFu, 0x5E6F7FFFu },
+    { 0xFFFFFFFFu, 12u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 12u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 12u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 12u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 12u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 12u,  5u, 0x89ABCDEFu, 0xFFFEFFFFu },
+    { 0xFFFFFFFFu, 12u,  6u, 0x89ABCDEFu, 0xFFFEFFFFu },
+    { 0xFFFFFFFFu, 12u,  7u, 0x89ABCDEFu, 0xFFFEFFFFu },
+    { 0xFFFFFFFFu, 12u,  8u, 0x89ABCDEFu, 0xFFFEFFFFu },
+    { 0xFFFFFFFFu, 12u,  9u, 0x89ABCDEFu, 0xFFFEFFFFu },
+    { 0xFFFFFFFFu, 12u, 10u, 0x89ABCDEFu, 0xFFDEFFFFu },
+    { 0xFFFFFFFFu, 12u, 11u, 0x89ABCDEFu, 0xFFDEFFFFu },
+    { 0xFFFFFFFFu, 12u, 12u, 0x89ABCDEFu, 0xFFDEFFFFu },
+    { 0xFFFFFFFFu, 12u, 13u, 0x89ABCDEFu, 0xFEDEFFFFu },
+    { 0xFFFFFFFFu, 12u, 14u, 0x89ABCDEFu, 0xFCDEFFFFu },
+    { 0xFFFFFFFFu, 12u, 15u, 0x89ABCDEFu, 0xFCDEFFFFu },
+    { 0xFFFFFFFFu, 12u, 16u, 0x89ABCDEFu, 0xFCDEFFFFu },
+    { 0xFFFFFFFFu, 12u, 17u, 0x89ABCDEFu, 0xFCDEFFFFu },
+    { 0xFFFFFFFFu, 12u, 18u, 0x89ABCDEFu, 0xFCDEFFFFu },
+    { 0xFFFFFFFFu, 12u, 19u, 0x89ABCDEFu, 0xBCDEFFFFu },
+    { 0xFFFFFFFFu, 12u, 20u, 0x89ABCDEFu, 0xBCDEFFFFu },
+    { 0xFFFFFFFFu, 13u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 13u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 13u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 13u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 13u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 13u,  5u, 0x89ABCDEFu, 0xFFFDFFFFu },
+    { 0xFFFFFFFFu, 13u,  6u, 0x89ABCDEFu, 0xFFFDFFFFu },
+    { 0xFFFFFFFFu, 13u,  7u, 0x89ABCDEFu, 0xFFFDFFFFu },
+    { 0xFFFFFFFFu, 13u,  8u, 0x89ABCDEFu, 0xFFFDFFFFu },
+    { 0xFFFFFFFFu, 13u,  9u, 0x89ABCDEFu, 0xFFFDFFFFu },
+    { 0xFFFFFFFFu, 13u, 10u, 0x89ABCDEFu, 0xFFBDFFFFu },
+    { 0xFFFFFFFFu, 13u, 11u, 0x89ABCDEFu, 0xFFBDFFFFu },
+    { 0xFFFFFFFFu, 13u, 12u, 0x89ABCDEFu, 0xFFBDFFFFu },
+    { 0xFFFFFFFFu, 13u, 13u, 0x89ABCDEFu, 0xFDBDFFFFu },
+    { 0xFFFFFFFFu, 13u, 14u, 0x89ABCDEFu, 0xF9BDFFFFu },
+    { 0xFFFFFFFFu, 13u, 15u, 0x89ABCDEFu, 0xF9BDFFFFu },
+    { 0xFFFFFFFFu, 13u, 16u, 0x89ABCDEFu, 0xF9BDFFFFu },
+    { 0xFFFFFFFFu, 13u, 17u, 0x89ABCDEFu, 0xF9BDFFFFu },
+    { 0xFFFFFFFFu, 13u, 18u, 0x89ABCDEFu, 0xF9BDFFFFu },
+    { 0xFFFFFFFFu, 13u, 19u, 0x89ABCDEFu, 0x79BDFFFFu },
+    { 0xFFFFFFFFu, 14u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 14u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 14u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 14u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 14u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 14u,  5u, 0x89ABCDEFu, 0xFFFBFFFFu },
+    { 0xFFFFFFFFu, 14u,  6u, 0x89ABCDEFu, 0xFFFBFFFFu },
+    { 0xFFFFFFFFu, 14u,  7u, 0x89ABCDEFu, 0xFFFBFFFFu },
+    { 0xFFFFFFFFu, 14u,  8u, 0x89ABCDEFu, 0xFFFBFFFFu },
+    { 0xFFFFFFFFu, 14u,  9u, 0x89ABCDEFu, 0xFFFBFFFFu },
+    { 0xFFFFFFFFu, 14u, 10u, 0x89ABCDEFu, 0xFF7BFFFFu },
+    { 0xFFFFFFFFu, 14u, 11u, 0x89ABCDEFu, 0xFF7BFFFFu },
+    { 0xFFFFFFFFu, 14u, 12u, 0x89ABCDEFu, 0xFF7BFFFFu },
+    { 0xFFFFFFFFu, 14u, 13u, 0x89ABCDEFu, 0xFB7BFFFFu },
+    { 0xFFFFFFFFu, 14u, 14u, 0x89ABCDEFu, 0xF37BFFFFu },
+    { 0xFFFFFFFFu, 14u, 15u, 0x89ABCDEFu, 0xF37BFFFFu },
+    { 0xFFFFFFFFu, 14u, 16u, 0x89ABCDEFu, 0xF37BFFFFu },
+    { 0xFFFFFFFFu, 14u, 17u, 0x89ABCDEFu, 0xF37BFFFFu },
+    { 0xFFFFFFFFu, 14u, 18u, 0x89ABCDEFu, 0xF37BFFFFu },
+    { 0xFFFFFFFFu, 15u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 15u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 15u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 15u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 15u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 15u,  5u, 0x89ABCDEFu, 0xFFF7FFFFu },
+    { 0xFFFFFFFFu, 15u,  6u, 0x89ABCDEFu, 0xFFF7FFFFu },
+    { 0xFFFFFFFFu, 15u,  7u, 0x89ABCDEFu, 0xFFF7FFFFu },
+    { 0xFFFFFFFFu, 15u,  8u, 0x89ABCDEFu, 0xFFF7FFFFu },
+    { 0xFFFFFFFFu, 15u,  9u, 0x89ABCDEFu, 0xFFF7FFFFu },
+    { 0xFFFFFFFFu, 15u, 10u, 0x89ABCDEFu, 0xFEF7FFFFu },
+    { 0xFFFFFFFFu, 15u, 11u, 0x89ABCDEFu, 0xFEF7FFFFu },
+    { 0xFFFFFFFFu, 15u, 12u, 0x89ABCDEFu, 0xFEF7FFFFu },
+    { 0xFFFFFFFFu, 15u, 13u, 0x89ABCDEFu, 0xF6F7FFFFu },
+    { 0xFFFFFFFFu, 15u, 14u, 0x89ABCDEFu, 0xE6F7FFFFu },
+    { 0xFFFFFFFFu, 15u, 15u, 0x89ABCDEFu, 0xE6F7FFFFu },
+    { 0xFFFFFFFFu, 15u, 16u, 0x89ABCDEFu, 0xE6F7FFFFu },
+    { 0xFFFFFFFFu, 15u, 17u, 0x89ABCDEFu, 0xE6F7FFFFu },
+    { 0xFFFFFFFFu, 16u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 16u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 16u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 16u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 16u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 16u,  5u, 0x89ABCDEFu, 0xFFEFFFFFu },
+    { 0xFFFFFFFFu, 16u,  6u, 0x89ABCDEFu, 0xFFEFFFFFu },
+    { 0xFFFFFFFFu, 16u,  7u, 0x89ABCDEFu, 0xFFEFFFFFu },
+    { 0xFFFFFFFFu, 16u,  8u, 0x89ABCDEFu, 0xFFEFFFFFu },
+    { 0xFFFFFFFFu, 16u,  9u, 0x89ABCDEFu, 0xFFEFFFFFu },
+    { 0xFFFFFFFFu, 16u, 10u, 0x89ABCDEFu, 0xFDEFFFFFu },
+    { 0xFFFFFFFFu, 16u, 11u, 0x89ABCDEFu, 0xFDEFFFFFu },
+    { 0xFFFFFFFFu, 16u, 12u, 0x89ABCDEFu, 0xFDEFFFFFu },
+    { 0xFFFFFFFFu, 16u, 13u, 0x89ABCDEFu, 0xEDEFFFFFu },
+    { 0xFFFFFFFFu, 16u, 14u, 0x89ABCDEFu, 0xCDEFFFFFu },
+    { 0xFFFFFFFFu, 16u, 15u, 0x89ABCDEFu, 0xCDEFFFFFu },
+    { 0xFFFFFFFFu, 16u, 16u, 0x89ABCDEFu, 0xCDEFFFFFu },
+    { 0xFFFFFFFFu, 17u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 17u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 17u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 17u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 17u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 17u,  5u, 0x89ABCDEFu, 0xFFDFFFFFu },
+    { 0xFFFFFFFFu, 17u,  6u, 0x89ABCDEFu, 0xFFDFFFFFu },
+    { 0xFFFFFFFFu, 17u,  7u, 0x89ABCDEFu, 0xFFDFFFFFu },
+    { 0xFFFFFFFFu, 17u,  8u, 0x89ABCDEFu, 0xFFDFFFFFu },
+    { 0xFFFFFFFFu, 17u,  9u, 0x89ABCDEFu, 0xFFDFFFFFu },
+    { 0xFFFFFFFFu, 17u, 10u, 0x89ABCDEFu, 0xFBDFFFFFu },
+    { 0xFFFFFFFFu, 17u, 11u, 0x89ABCDEFu, 0xFBDFFFFFu },
+    { 0xFFFFFFFFu, 17u, 12u, 0x89ABCDEFu, 0xFBDFFFFFu },
+    { 0xFFFFFFFFu, 17u, 13u, 0x89ABCDEFu, 0xDBDFFFFFu },
+    { 0xFFFFFFFFu, 17u, 14u, 0x89ABCDEFu, 0x9BDFFFFFu },
+    { 0xFFFFFFFFu, 17u, 15u, 0x89ABCDEFu, 0x9BDFFFFFu },
+    { 0xFFFFFFFFu, 18u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 18u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 18u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 18u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 18u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 18u,  5u, 0x89ABCDEFu, 0xFFBFFFFFu },
+    { 0xFFFFFFFFu, 18u,  6u, 0x89ABCDEFu, 0xFFBFFFFFu },
+    { 0xFFFFFFFFu, 18u,  7u, 0x89ABCDEFu, 0xFFBFFFFFu },
+    { 0xFFFFFFFFu, 18u,  8u, 0x89ABCDEFu, 0xFFBFFFFFu },
+    { 0xFFFFFFFFu, 18u,  9u, 0x89ABCDEFu, 0xFFBFFFFFu },
+    { 0xFFFFFFFFu, 18u, 10u, 0x89ABCDEFu, 0xF7BFFFFFu },
+    { 0xFFFFFFFFu, 18u, 11u, 0x89ABCDEFu, 0xF7BFFFFFu },
+    { 0xFFFFFFFFu, 18u, 12u, 0x89ABCDEFu, 0xF7BFFFFFu },
+    { 0xFFFFFFFFu, 18u, 13u, 0x89ABCDEFu, 0xB7BFFFFFu },
+    { 0xFFFFFFFFu, 18u, 14u, 0x89ABCDEFu, 0x37BFFFFFu },
+    { 0xFFFFFFFFu, 19u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 19u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 19u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 19u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 19u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 19u,  5u, 0x89ABCDEFu, 0xFF7FFFFFu },
+    { 0xFFFFFFFFu, 19u,  6u, 0x89ABCDEFu, 0xFF7FFFFFu },
+    { 0xFFFFFFFFu, 19u,  7u, 0x89ABCDEFu, 0xFF7FFFFFu },
+    { 0xFFFFFFFFu, 19u,  8u, 0x89ABCDEFu, 0xFF7FFFFFu },
+    { 0xFFFFFFFFu, 19u,  9u, 0x89ABCDEFu, 0xFF7FFFFFu },
+    { 0xFFFFFFFFu, 19u, 10u, 0x89ABCDEFu, 0xEF7FFFFFu },
+    { 0xFFFFFFFFu, 19u, 11u, 0x89ABCDEFu, 0xEF7FFFFFu },
+    { 0xFFFFFFFFu, 19u, 12u, 0x89ABCDEFu, 0xEF7FFFFFu },
+    { 0xFFFFFFFFu, 19u, 13u, 0x89ABCDEFu, 0x6F7FFFFFu },
+    { 0xFFFFFFFFu, 20u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 20u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 20u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 20u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 20u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 20u,  5u, 0x89ABCDEFu, 0xFEFFFFFFu },
+    { 0xFFFFFFFFu, 20u,  6u, 0x89ABCDEFu, 0xFEFFFFFFu },
+    { 0xFFFFFFFFu, 20u,  7u, 0x89ABCDEFu, 0xFEFFFFFFu },
+    { 0xFFFFFFFFu, 20u,  8u, 0x89ABCDEFu, 0xFEFFFFFFu },
+    { 0xFFFFFFFFu, 20u,  9u, 0x89ABCDEFu, 0xFEFFFFFFu },
+    { 0xFFFFFFFFu, 20u, 10u, 0x89ABCDEFu, 0xDEFFFFFFu },
+    { 0xFFFFFFFFu, 20u, 11u, 0x89ABCDEFu, 0xDEFFFFFFu },
+    { 0xFFFFFFFFu, 20u, 12u, 0x89ABCDEFu, 0xDEFFFFFFu },
+    { 0xFFFFFFFFu, 21u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 21u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 21u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 21u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 21u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 21u,  5u, 0x89ABCDEFu, 0xFDFFFFFFu },
+    { 0xFFFFFFFFu, 21u,  6u, 0x89ABCDEFu, 0xFDFFFFFFu },
+    { 0xFFFFFFFFu, 21u,  7u, 0x89ABCDEFu, 0xFDFFFFFFu },
+    { 0xFFFFFFFFu, 21u,  8u, 0x89ABCDEFu, 0xFDFFFFFFu },
+    { 0xFFFFFFFFu, 21u,  9u, 0x89ABCDEFu, 0xFDFFFFFFu },
+    { 0xFFFFFFFFu, 21u, 10u, 0x89ABCDEFu, 0xBDFFFFFFu },
+    { 0xFFFFFFFFu, 21u, 11u, 0x89ABCDEFu, 0xBDFFFFFFu },
+    { 0xFFFFFFFFu, 22u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 22u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 22u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 22u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 22u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 22u,  5u, 0x89ABCDEFu, 0xFBFFFFFFu },
+    { 0xFFFFFFFFu, 22u,  6u, 0x89ABCDEFu, 0xFBFFFFFFu },
+    { 0xFFFFFFFFu, 22u,  7u, 0x89ABCDEFu, 0xFBFFFFFFu },
+    { 0xFFFFFFFFu, 22u,  8u, 0x89ABCDEFu, 0xFBFFFFFFu },
+    { 0xFFFFFFFFu, 22u,  9u, 0x89ABCDEFu, 0xFBFFFFFFu },
+    { 0xFFFFFFFFu, 22u, 10u, 0x89ABCDEFu, 0x7BFFFFFFu },
+    { 0xFFFFFFFFu, 23u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 23u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 23u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 23u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 23u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 23u,  5u, 0x89ABCDEFu, 0xF7FFFFFFu },
+    { 0xFFFFFFFFu, 23u,  6u, 0x89ABCDEFu, 0xF7FFFFFFu },
+    { 0xFFFFFFFFu, 23u,  7u, 0x89ABCDEFu, 0xF7FFFFFFu },
+    { 0xFFFFFFFFu, 23u,  8u, 0x89ABCDEFu, 0xF7FFFFFFu },
+    { 0xFFFFFFFFu, 23u,  9u, 0x89ABCDEFu, 0xF7FFFFFFu },
+    { 0xFFFFFFFFu, 24u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 24u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 24u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 24u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 24u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 24u,  5u, 0x89ABCDEFu, 0xEFFFFFFFu },
+    { 0xFFFFFFFFu, 24u,  6u, 0x89ABCDEFu, 0xEFFFFFFFu },
+    { 0xFFFFFFFFu, 24u,  7u, 0x89ABCDEFu, 0xEFFFFFFFu },
+    { 0xFFFFFFFFu, 24u,  8u, 0x89ABCDEFu, 0xEFFFFFFFu },
+    { 0xFFFFFFFFu, 25u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 25u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 25u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 25u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 25u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 25u,  5u, 0x89ABCDEFu, 0xDFFFFFFFu },
+    { 0xFFFFFFFFu, 25u,  6u, 0x89ABCDEFu, 0xDFFFFFFFu },
+    { 0xFFFFFFFFu, 25u,  7u, 0x89ABCDEFu, 0xDFFFFFFFu },
+    { 0xFFFFFFFFu, 26u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 26u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 26u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 26u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 26u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 26u,  5u, 0x89ABCDEFu, 0xBFFFFFFFu },
+    { 0xFFFFFFFFu, 26u,  6u, 0x89ABCDEFu, 0xBFFFFFFFu },
+    { 0xFFFFFFFFu, 27u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 27u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 27u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 27u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 27u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 27u,  5u, 0x89ABCDEFu, 0x7FFFFFFFu },
+    { 0xFFFFFFFFu, 28u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 28u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 28u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 28u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 28u,  4u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 29u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 29u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 29u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 29u,  3u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 30u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 30u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 30u,  2u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 31u,  0u, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 31u,  1u, 0x89ABCDEFu, 0xFFFFFFFFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_PutBits_u32u8u8u32 vectors**
+ *
+ * The test runs the 560 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00110, SWS_Bfx_00112
+ */
+void test__Bfx_PutBits_u32u8u8u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( PutBits_u32u8u8u32 ) / sizeof( PutBits_u32u8u8u32[ 0 ] ) ); i++ )
+    {
+        uint32 Data = PutBits_u32u8u8u32[ i ].Data;
+        Bfx_PutBits_u32u8u8u32( &Data, PutBits_u32u8u8u32[ i ].BitStartPn, PutBits_u32u8u8u32[ i ].BitLn, PutBits_u32u8u8u32[ i ].Pattern );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( PutBits_u32u8u8u32[ i ].Expected, Data, Vector( "Bfx_PutBits_u32u8u8u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint32 Mask;
+    uint32 Expected;
+} SetBitMask_u32u32[] = {
+    { 0x00000000u, 0x00000000u, 0x00000000u },
+    { 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu },
+    { 0x00000000u, 0x55555555u, 0x55555555u },
+    { 0x00000000u, 0xAAAAAAAAu, 0xAAAAAAAAu },
+    { 0x00000000u, 0x00000001u, 0x00000001u },
+    { 0x00000000u, 0x80000000u, 0x80000000u },
+    { 0x00000000u, 0x89ABCDEFu, 0x89ABCDEFu },
+    { 0xFFFFFFFFu, 0x00000000u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0x55555555u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0xAAAAAAAAu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0x00000001u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0x80000000u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0x55555555u, 0x00000000u, 0x55555555u },
+    { 0x55555555u, 0xFFFFFFFFu, 0xFFFFFFFFu },
+    { 0x55555555u, 0x55555555u, 0x55555555u },
+    { 0x55555555u, 0xAAAAAAAAu, 0xFFFFFFFFu },
+    { 0x55555555u, 0x00000001u, 0x55555555u },
+    { 0x55555555u, 0x80000000u, 0xD5555555u },
+    { 0x55555555u, 0x89ABCDEFu, 0xDDFFDDFFu },
+    { 0x89ABCDEFu, 0x00000000u, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0xFFFFFFFFu, 0xFFFFFFFFu },
+    { 0x89ABCDEFu, 0x55555555u, 0xDDFFDDFFu },
+    { 0x89ABCDEFu, 0xAAAAAAAAu, 0xABABEFEFu },
+    { 0x89ABCDEFu, 0x00000001u, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0x80000000u, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0x89ABCDEFu, 0x89ABCDEFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_SetBitMask_u32u32 vectors**
+ *
+ * The test runs the 28 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00035, SWS_Bfx_00036, SWS_Bfx_00038
+ */
+void test__Bfx_SetBitMask_u32u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( SetBitMask_u32u32 ) / sizeof( SetBitMask_u32u32[ 0 ] ) ); i++ )
+    {
+        uint32 Data = SetBitMask_u32u32[ i ].Data;
+        Bfx_SetBitMask_u32u32( &Data, SetBitMask_u32u32[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( SetBitMask_u32u32[ i ].Expected, Data, Vector( "Bfx_SetBitMask_u32u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint32 Mask;
+    uint32 Expected;
+} ClrBitMask_u32u32[] = {
+    { 0x00000000u, 0x00000000u, 0x00000000u },
+    { 0x00000000u, 0xFFFFFFFFu, 0x00000000u },
+    { 0x00000000u, 0x55555555u, 0x00000000u },
+    { 0x00000000u, 0xAAAAAAAAu, 0x00000000u },
+    { 0x00000000u, 0x00000001u, 0x00000000u },
+    { 0x00000000u, 0x80000000u, 0x00000000u },
+    { 0x00000000u, 0x89ABCDEFu, 0x00000000u },
+    { 0xFFFFFFFFu, 0x00000000u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u },
+    { 0xFFFFFFFFu, 0x55555555u, 0xAAAAAAAAu },
+    { 0xFFFFFFFFu, 0xAAAAAAAAu, 0x55555555u },
+    { 0xFFFFFFFFu, 0x00000001u, 0xFFFFFFFEu },
+    { 0xFFFFFFFFu, 0x80000000u, 0x7FFFFFFFu },
+    { 0xFFFFFFFFu, 0x89ABCDEFu, 0x76543210u },
+    { 0x55555555u, 0x00000000u, 0x55555555u },
+    { 0x55555555u, 0xFFFFFFFFu, 0x00000000u },
+    { 0x55555555u, 0x55555555u, 0x00000000u },
+    { 0x55555555u, 0xAAAAAAAAu, 0x55555555u },
+    { 0x55555555u, 0x00000001u, 0x55555554u },
+    { 0x55555555u, 0x80000000u, 0x55555555u },
+    { 0x55555555u, 0x89ABCDEFu, 0x54541010u },
+    { 0x89ABCDEFu, 0x00000000u, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0xFFFFFFFFu, 0x00000000u },
+    { 0x89ABCDEFu, 0x55555555u, 0x88AA88AAu },
+    { 0x89ABCDEFu, 0xAAAAAAAAu, 0x01014545u },
+    { 0x89ABCDEFu, 0x00000001u, 0x89ABCDEEu },
+    { 0x89ABCDEFu, 0x80000000u, 0x09ABCDEFu },
+    { 0x89ABCDEFu, 0x89ABCDEFu, 0x00000000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ClrBitMask_u32u32 vectors**
+ *
+ * The test runs the 28 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00039, SWS_Bfx_00040, SWS_Bfx_00045
+ */
+void test__Bfx_ClrBitMask_u32u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ClrBitMask_u32u32 ) / sizeof( ClrBitMask_u32u32[ 0 ] ) ); i++ )
+    {
+        uint32 Data = ClrBitMask_u32u32[ i ].Data;
+        Bfx_ClrBitMask_u32u32( &Data, ClrBitMask_u32u32[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( ClrBitMask_u32u32[ i ].Expected, Data, Vector( "Bfx_ClrBitMask_u32u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint32 Mask;
+    boolean Expected;
+} TstBitMask_u32u32_u8[] = {
+    { 0x00000000u, 0x00000000u,  TRUE },
+    { 0x00000000u, 0xFFFFFFFFu, FALSE },
+    { 0x00000000u, 0x55555555u, FALSE },
+    { 0x00000000u, 0xAAAAAAAAu, FALSE },
+    { 0x00000000u, 0x00000001u, FALSE },
+    { 0x00000000u, 0x80000000u, FALSE },
+    { 0x00000000u, 0x89ABCDEFu, FALSE },
+    { 0xFFFFFFFFu, 0x00000000u,  TRUE },
+    { 0xFFFFFFFFu, 0xFFFFFFFFu,  TRUE },
+    { 0xFFFFFFFFu, 0x55555555u,  TRUE },
+    { 0xFFFFFFFFu, 0xAAAAAAAAu,  TRUE },
+    { 0xFFFFFFFFu, 0x00000001u,  TRUE },
+    { 0xFFFFFFFFu, 0x80000000u,  TRUE },
+    { 0xFFFFFFFFu, 0x89ABCDEFu,  TRUE },
+    { 0x55555555u, 0x00000000u,  TRUE },
+    { 0x55555555u, 0xFFFFFFFFu, FALSE },
+    { 0x55555555u, 0x55555555u,  TRUE },
+    { 0x55555555u, 0xAAAAAAAAu, FALSE },
+    { 0x55555555u, 0x00000001u,  TRUE },
+    { 0x55555555u, 0x80000000u, FALSE },
+    { 0x55555555u, 0x89ABCDEFu, FALSE },
+    { 0x89ABCDEFu, 0x00000000u,  TRUE },
+    { 0x89ABCDEFu, 0xFFFFFFFFu, FALSE },
+    { 0x89ABCDEFu, 0x55555555u, FALSE },
+    { 0x89ABCDEFu, 0xAAAAAAAAu, FALSE },
+    { 0x89ABCDEFu, 0x00000001u,  TRUE },
+    { 0x89ABCDEFu, 0x80000000u,  TRUE },
+    { 0x89ABCDEFu, 0x89ABCDEFu,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_TstBitMask_u32u32_u8 vectors**
+ *
+ * The test runs the 28 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00046, SWS_Bfx_00047, SWS_Bfx_00050
+ */
+void test__Bfx_TstBitMask_u32u32_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( TstBitMask_u32u32_u8 ) / sizeof( TstBitMask_u32u32_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( TstBitMask_u32u32_u8[ i ].Expected, Bfx_TstBitMask_u32u32_u8( TstBitMask_u32u32_u8[ i ].Data, TstBitMask_u32u32_u8[ i ].Mask ), Vector( "Bfx_TstBitMask_u32u32_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint32 Mask;
+    boolean Expected;
+} TstBitLnMask_u32u32_u8[] = {
+    { 0x00000000u, 0x00000000u, FALSE },
+    { 0x00000000u, 0xFFFFFFFFu, FALSE },
+    { 0x00000000u, 0x55555555u, FALSE },
+    { 0x00000000u, 0xAAAAAAAAu, FALSE },
+    { 0x00000000u, 0x00000001u, FALSE },
+    { 0x00000000u, 0x80000000u, FALSE },
+    { 0x00000000u, 0x89ABCDEFu, FALSE },
+    { 0xFFFFFFFFu, 0x00000000u, FALSE },
+    { 0xFFFFFFFFu, 0xFFFFFFFFu,  TRUE },
+    { 0xFFFFFFFFu, 0x55555555u,  TRUE },
+    { 0xFFFFFFFFu, 0xAAAAAAAAu,  TRUE },
+    { 0xFFFFFFFFu, 0x00000001u,  TRUE },
+    { 0xFFFFFFFFu, 0x80000000u,  TRUE },
+    { 0xFFFFFFFFu, 0x89ABCDEFu,  TRUE },
+    { 0x55555555u, 0x00000000u, FALSE },
+    { 0x55555555u, 0xFFFFFFFFu,  TRUE },
+    { 0x55555555u, 0x55555555u,  TRUE },
+    { 0x55555555u, 0xAAAAAAAAu, FALSE },
+    { 0x55555555u, 0x00000001u,  TRUE },
+    { 0x55555555u, 0x80000000u, FALSE },
+    { 0x55555555u, 0x89ABCDEFu,  TRUE },
+    { 0x89ABCDEFu, 0x00000000u, FALSE },
+    { 0x89ABCDEFu, 0xFFFFFFFFu,  TRUE },
+    { 0x89ABCDEFu, 0x55555555u,  TRUE },
+    { 0x89ABCDEFu, 0xAAAAAAAAu,  TRUE },
+    { 0x89ABCDEFu, 0x00000001u,  TRUE },
+    { 0x89ABCDEFu, 0x80000000u,  TRUE },
+    { 0x89ABCDEFu, 0x89ABCDEFu,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_TstBitLnMask_u32u32_u8 vectors**
+ *
+ * The test runs the 28 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00051, SWS_Bfx_00055
+ */
+void test__Bfx_TstBitLnMask_u32u32_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( TstBitLnMask_u32u32_u8 ) / sizeof( TstBitLnMask_u32u32_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( TstBitLnMask_u32u32_u8[ i ].Expected, Bfx_TstBitLnMask_u32u32_u8( TstBitLnMask_u32u32_u8[ i ].Data, TstBitLnMask_u32u32_u8[ i ].Mask ), Vector( "Bfx_TstBitLnMask_u32u32_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    boolean Expected;
+} TstParityEven_u32_u8[] = {
+    { 0x00000000u,  TRUE },
+    { 0xFFFFFFFFu,  TRUE },
+    { 0x55555555u,  TRUE },
+    { 0x89ABCDEFu,  TRUE },
+    { 0x00000001u, FALSE },
+    { 0x00000002u, FALSE },
+    { 0x00000004u, FALSE },
+    { 0x00000008u, FALSE },
+    { 0x00000010u, FALSE },
+    { 0x00000020u, FALSE },
+    { 0x00000040u, FALSE },
+    { 0x00000080u, FALSE },
+    { 0x00000100u, FALSE },
+    { 0x00000200u, FALSE },
+    { 0x00000400u, FALSE },
+    { 0x00000800u, FALSE },
+    { 0x00001000u, FALSE },
+    { 0x00002000u, FALSE },
+    { 0x00004000u, FALSE },
+    { 0x00008000u, FALSE },
+    { 0x00010000u, FALSE },
+    { 0x00020000u, FALSE },
+    { 0x00040000u, FALSE },
+    { 0x00080000u, FALSE },
+    { 0x00100000u, FALSE },
+    { 0x00200000u, FALSE },
+    { 0x00400000u, FALSE },
+    { 0x00800000u, FALSE },
+    { 0x01000000u, FALSE },
+    { 0x02000000u, FALSE },
+    { 0x04000000u, FALSE },
+    { 0x08000000u, FALSE },
+    { 0x10000000u, FALSE },
+    { 0x20000000u, FALSE },
+    { 0x40000000u, FALSE },
+    { 0x80000000u, FALSE },
+    { 0x00000000u,  TRUE },
+    { 0x00000001u, FALSE },
+    { 0x00000003u,  TRUE },
+    { 0x00000007u, FALSE },
+    { 0x0000000Fu,  TRUE },
+    { 0x0000001Fu, FALSE },
+    { 0x0000003Fu,  TRUE },
+    { 0x0000007Fu, FALSE },
+    { 0x000000FFu,  TRUE },
+    { 0x000001FFu, FALSE },
+    { 0x000003FFu,  TRUE },
+    { 0x000007FFu, FALSE },
+    { 0x00000FFFu,  TRUE },
+    { 0x00001FFFu, FALSE },
+    { 0x00003FFFu,  TRUE },
+    { 0x00007FFFu, FALSE },
+    { 0x0000FFFFu,  TRUE },
+    { 0x0001FFFFu, FALSE },
+    { 0x0003FFFFu,  TRUE },
+    { 0x0007FFFFu, FALSE },
+    { 0x000FFFFFu,  TRUE },
+    { 0x001FFFFFu, FALSE },
+    { 0x003FFFFFu,  TRUE },
+    { 0x007FFFFFu, FALSE },
+    { 0x00FFFFFFu,  TRUE },
+    { 0x01FFFFFFu, FALSE },
+    { 0x03FFFFFFu,  TRUE },
+    { 0x07FFFFFFu, FALSE },
+    { 0x0FFFFFFFu,  TRUE },
+    { 0x1FFFFFFFu, FALSE },
+    { 0x3FFFFFFFu,  TRUE },
+    { 0x7FFFFFFFu, FALSE },
+    { 0xFFFFFFFFu,  TRUE },
+    { 0x00000000u,  TRUE },
+    { 0x80000000u, FALSE },
+    { 0xC0000000u,  TRUE },
+    { 0xE0000000u, FALSE },
+    { 0xF0000000u,  TRUE },
+    { 0xF8000000u, FALSE },
+    { 0xFC000000u,  TRUE },
+    { 0xFE000000u, FALSE },
+    { 0xFF000000u,  TRUE },
+    { 0xFF800000u, FALSE },
+    { 0xFFC00000u,  TRUE },
+    { 0xFFE00000u, FALSE },
+    { 0xFFF00000u,  TRUE },
+    { 0xFFF80000u, FALSE },
+    { 0xFFFC0000u,  TRUE },
+    { 0xFFFE0000u, FALSE },
+    { 0xFFFF0000u,  TRUE },
+    { 0xFFFF8000u, FALSE },
+    { 0xFFFFC000u,  TRUE },
+    { 0xFFFFE000u, FALSE },
+    { 0xFFFFF000u,  TRUE },
+    { 0xFFFFF800u, FALSE },
+    { 0xFFFFFC00u,  TRUE },
+    { 0xFFFFFE00u, FALSE },
+    { 0xFFFFFF00u,  TRUE },
+    { 0xFFFFFF80u, FALSE },
+    { 0xFFFFFFC0u,  TRUE },
+    { 0xFFFFFFE0u, FALSE },
+    { 0xFFFFFFF0u,  TRUE },
+    { 0xFFFFFFF8u, FALSE },
+    { 0xFFFFFFFCu,  TRUE },
+    { 0xFFFFFFFEu, FALSE },
+    { 0xFFFFFFFFu,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_TstParityEven_u32_u8 vectors**
+ *
+ * The test runs the 102 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00056, SWS_Bfx_00060
+ */
+void test__Bfx_TstParityEven_u32_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( TstParityEven_u32_u8 ) / sizeof( TstParityEven_u32_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( TstParityEven_u32_u8[ i ].Expected, Bfx_TstParityEven_u32_u8( TstParityEven_u32_u8[ i ].Data ), Vector( "Bfx_TstParityEven_u32_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint32 Expected;
+} ToggleBits_u32[] = {
+    { 0x00000000u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0x00000000u },
+    { 0x55555555u, 0xAAAAAAAAu },
+    { 0x89ABCDEFu, 0x76543210u },
+    { 0x00000001u, 0xFFFFFFFEu },
+    { 0x00000002u, 0xFFFFFFFDu },
+    { 0x00000004u, 0xFFFFFFFBu },
+    { 0x00000008u, 0xFFFFFFF7u },
+    { 0x00000010u, 0xFFFFFFEFu },
+    { 0x00000020u, 0xFFFFFFDFu },
+    { 0x00000040u, 0xFFFFFFBFu },
+    { 0x00000080u, 0xFFFFFF7Fu },
+    { 0x00000100u, 0xFFFFFEFFu },
+    { 0x00000200u, 0xFFFFFDFFu },
+    { 0x00000400u, 0xFFFFFBFFu },
+    { 0x00000800u, 0xFFFFF7FFu },
+    { 0x00001000u, 0xFFFFEFFFu },
+    { 0x00002000u, 0xFFFFDFFFu },
+    { 0x00004000u, 0xFFFFBFFFu },
+    { 0x00008000u, 0xFFFF7FFFu },
+    { 0x00010000u, 0xFFFEFFFFu },
+    { 0x00020000u, 0xFFFDFFFFu },
+    { 0x00040000u, 0xFFFBFFFFu },
+    { 0x00080000u, 0xFFF7FFFFu },
+    { 0x00100000u, 0xFFEFFFFFu },
+    { 0x00200000u, 0xFFDFFFFFu },
+    { 0x00400000u, 0xFFBFFFFFu },
+    { 0x00800000u, 0xFF7FFFFFu },
+    { 0x01000000u, 0xFEFFFFFFu },
+    { 0x02000000u, 0xFDFFFFFFu },
+    { 0x04000000u, 0xFBFFFFFFu },
+    { 0x08000000u, 0xF7FFFFFFu },
+    { 0x10000000u, 0xEFFFFFFFu },
+    { 0x20000000u, 0xDFFFFFFFu },
+    { 0x40000000u, 0xBFFFFFFFu },
+    { 0x80000000u, 0x7FFFFFFFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ToggleBits_u32 vectors**
+ *
+ * The test runs the 36 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00061, SWS_Bfx_00065
+ */
+void test__Bfx_ToggleBits_u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ToggleBits_u32 ) / sizeof( ToggleBits_u32[ 0 ] ) ); i++ )
+    {
+        uint32 Data = ToggleBits_u32[ i ].Data;
+        Bfx_ToggleBits_u32( &Data );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( ToggleBits_u32[ i ].Expected, Data, Vector( "Bfx_ToggleBits_u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint32 Mask;
+    uint32 Expected;
+} ToggleBitMask_u32u32[] = {
+    { 0x00000000u, 0x00000000u, 0x00000000u },
+    { 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu },
+    { 0x00000000u, 0x55555555u, 0x55555555u },
+    { 0x00000000u, 0xAAAAAAAAu, 0xAAAAAAAAu },
+    { 0x00000000u, 0x00000001u, 0x00000001u },
+    { 0x00000000u, 0x80000000u, 0x80000000u },
+    { 0x00000000u, 0x89ABCDEFu, 0x89ABCDEFu },
+    { 0xFFFFFFFFu, 0x00000000u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u },
+    { 0xFFFFFFFFu, 0x55555555u, 0xAAAAAAAAu },
+    { 0xFFFFFFFFu, 0xAAAAAAAAu, 0x55555555u },
+    { 0xFFFFFFFFu, 0x00000001u, 0xFFFFFFFEu },
+    { 0xFFFFFFFFu, 0x80000000u, 0x7FFFFFFFu },
+    { 0xFFFFFFFFu, 0x89ABCDEFu, 0x76543210u },
+    { 0x55555555u, 0x00000000u, 0x55555555u },
+    { 0x55555555u, 0xFFFFFFFFu, 0xAAAAAAAAu },
+    { 0x55555555u, 0x55555555u, 0x00000000u },
+    { 0x55555555u, 0xAAAAAAAAu, 0xFFFFFFFFu },
+    { 0x55555555u, 0x00000001u, 0x55555554u },
+    { 0x55555555u, 0x80000000u, 0xD5555555u },
+    { 0x55555555u, 0x89ABCDEFu, 0xDCFE98BAu },
+    { 0x89ABCDEFu, 0x00000000u, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0xFFFFFFFFu, 0x76543210u },
+    { 0x89ABCDEFu, 0x55555555u, 0xDCFE98BAu },
+    { 0x89ABCDEFu, 0xAAAAAAAAu, 0x23016745u },
+    { 0x89ABCDEFu, 0x00000001u, 0x89ABCDEEu },
+    { 0x89ABCDEFu, 0x80000000u, 0x09ABCDEFu },
+    { 0x89ABCDEFu, 0x89ABCDEFu, 0x00000000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ToggleBitMask_u32u32 vectors**
+ *
+ * The test runs the 28 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00066, SWS_Bfx_00069
+ */
+void test__Bfx_ToggleBitMask_u32u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ToggleBitMask_u32u32 ) / sizeof( ToggleBitMask_u32u32[ 0 ] ) ); i++ )
+    {
+        uint32 Data = ToggleBitMask_u32u32[ i ].Data;
+        Bfx_ToggleBitMask_u32u32( &Data, ToggleBitMask_u32u32[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( ToggleBitMask_u32u32[ i ].Expected, Data, Vector( "Bfx_ToggleBitMask_u32u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 ShiftCnt;
+    uint32 Expected;
+} ShiftBitRt_u32u8[] = {
+    { 0xFFFFFFFFu,  0u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  1u, 0x7FFFFFFFu },
+    { 0xFFFFFFFFu,  2u, 0x3FFFFFFFu },
+    { 0xFFFFFFFFu,  3u, 0x1FFFFFFFu },
+    { 0xFFFFFFFFu,  4u, 0x0FFFFFFFu },
+    { 0xFFFFFFFFu,  5u, 0x07FFFFFFu },
+    { 0xFFFFFFFFu,  6u, 0x03FFFFFFu },
+    { 0xFFFFFFFFu,  7u, 0x01FFFFFFu },
+    { 0xFFFFFFFFu,  8u, 0x00FFFFFFu },
+    { 0xFFFFFFFFu,  9u, 0x007FFFFFu },
+    { 0xFFFFFFFFu, 10u, 0x003FFFFFu },
+    { 0xFFFFFFFFu, 11u, 0x001FFFFFu },
+    { 0xFFFFFFFFu, 12u, 0x000FFFFFu },
+    { 0xFFFFFFFFu, 13u, 0x0007FFFFu },
+    { 0xFFFFFFFFu, 14u, 0x0003FFFFu },
+    { 0xFFFFFFFFu, 15u, 0x0001FFFFu },
+    { 0xFFFFFFFFu, 16u, 0x0000FFFFu },
+    { 0xFFFFFFFFu, 17u, 0x00007FFFu },
+    { 0xFFFFFFFFu, 18u, 0x00003FFFu },
+    { 0xFFFFFFFFu, 19u, 0x00001FFFu },
+    { 0xFFFFFFFFu, 20u, 0x00000FFFu },
+    { 0xFFFFFFFFu, 21u, 0x000007FFu },
+    { 0xFFFFFFFFu, 22u, 0x000003FFu },
+    { 0xFFFFFFFFu, 23u, 0x000001FFu },
+    { 0xFFFFFFFFu, 24u, 0x000000FFu },
+    { 0xFFFFFFFFu, 25u, 0x0000007Fu },
+    { 0xFFFFFFFFu, 26u, 0x0000003Fu },
+    { 0xFFFFFFFFu, 27u, 0x0000001Fu },
+    { 0xFFFFFFFFu, 28u, 0x0000000Fu },
+    { 0xFFFFFFFFu, 29u, 0x00000007u },
+    { 0xFFFFFFFFu, 30u, 0x00000003u },
+    { 0xFFFFFFFFu, 31u, 0x00000001u },
+    { 0x89ABCDEFu,  0u, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  1u, 0x44D5E6F7u },
+    { 0x89ABCDEFu,  2u, 0x226AF37Bu },
+    { 0x89ABCDEFu,  3u, 0x113579BDu },
+    { 0x89ABCDEFu,  4u, 0x089ABCDEu },
+    { 0x89ABCDEFu,  5u, 0x044D5E6Fu },
+    { 0x89ABCDEFu,  6u, 0x0226AF37u },
+    { 0x89ABCDEFu,  7u, 0x0113579Bu },
+    { 0x89ABCDEFu,  8u, 0x0089ABCDu },
+    { 0x89ABCDEFu,  9u, 0x0044D5E6u },
+    { 0x89ABCDEFu, 10u, 0x00226AF3u },
+    { 0x89ABCDEFu, 11u, 0x00113579u },
+    { 0x89ABCDEFu, 12u, 0x00089ABCu },
+    { 0x89ABCDEFu, 13u, 0x00044D5Eu },
+    { 0x89ABCDEFu, 14u, 0x000226AFu },
+    { 0x89ABCDEFu, 15u, 0x00011357u },
+    { 0x89ABCDEFu, 16u, 0x000089ABu },
+    { 0x89ABCDEFu, 17u, 0x000044D5u },
+    { 0x89ABCDEFu, 18u, 0x0000226Au },
+    { 0x89ABCDEFu, 19u, 0x00001135u },
+    { 0x89ABCDEFu, 20u, 0x0000089Au },
+    { 0x89ABCDEFu, 21u, 0x0000044Du },
+    { 0x89ABCDEFu, 22u, 0x00000226u },
+    { 0x89ABCDEFu, 23u, 0x00000113u },
+    { 0x89ABCDEFu, 24u, 0x00000089u },
+    { 0x89ABCDEFu, 25u, 0x00000044u },
+    { 0x89ABCDEFu, 26u, 0x00000022u },
+    { 0x89ABCDEFu, 27u, 0x00000011u },
+    { 0x89ABCDEFu, 28u, 0x00000008u },
+    { 0x89ABCDEFu, 29u, 0x00000004u },
+    { 0x89ABCDEFu, 30u, 0x00000002u },
+    { 0x89ABCDEFu, 31u, 0x00000001u },
+    { 0x00000001u,  0u, 0x00000001u },
+    { 0x00000001u,  1u, 0x00000000u },
+    { 0x00000001u,  2u, 0x00000000u },
+    { 0x00000001u,  3u, 0x00000000u },
+    { 0x00000001u,  4u, 0x00000000u },
+    { 0x00000001u,  5u, 0x00000000u },
+    { 0x00000001u,  6u, 0x00000000u },
+    { 0x00000001u,  7u, 0x00000000u },
+    { 0x00000001u,  8u, 0x00000000u },
+    { 0x00000001u,  9u, 0x00000000u },
+    { 0x00000001u, 10u, 0x00000000u },
+    { 0x00000001u, 11u, 0x00000000u },
+    { 0x00000001u, 12u, 0x00000000u },
+    { 0x00000001u, 13u, 0x00000000u },
+    { 0x00000001u, 14u, 0x00000000u },
+    { 0x00000001u, 15u, 0x00000000u },
+    { 0x00000001u, 16u, 0x00000000u },
+    { 0x00000001u, 17u, 0x00000000u },
+    { 0x00000001u, 18u, 0x00000000u },
+    { 0x00000001u, 19u, 0x00000000u },
+    { 0x00000001u, 20u, 0x00000000u },
+    { 0x00000001u, 21u, 0x00000000u },
+    { 0x00000001u, 22u, 0x00000000u },
+    { 0x00000001u, 23u, 0x00000000u },
+    { 0x00000001u, 24u, 0x00000000u },
+    { 0x00000001u, 25u, 0x00000000u },
+    { 0x00000001u, 26u, 0x00000000u },
+    { 0x00000001u, 27u, 0x00000000u },
+    { 0x00000001u, 28u, 0x00000000u },
+    { 0x00000001u, 29u, 0x00000000u },
+    { 0x00000001u, 30u, 0x00000000u },
+    { 0x00000001u, 31u, 0x00000000u },
+    { 0x80000000u,  0u, 0x80000000u },
+    { 0x80000000u,  1u, 0x40000000u },
+    { 0x80000000u,  2u, 0x20000000u },
+    { 0x80000000u,  3u, 0x10000000u },
+    { 0x80000000u,  4u, 0x08000000u },
+    { 0x80000000u,  5u, 0x04000000u },
+    { 0x80000000u,  6u, 0x02000000u },
+    { 0x80000000u,  7u, 0x01000000u },
+    { 0x80000000u,  8u, 0x00800000u },
+    { 0x80000000u,  9u, 0x00400000u },
+    { 0x80000000u, 10u, 0x00200000u },
+    { 0x80000000u, 11u, 0x00100000u },
+    { 0x80000000u, 12u, 0x00080000u },
+    { 0x80000000u, 13u, 0x00040000u },
+    { 0x80000000u, 14u, 0x00020000u },
+    { 0x80000000u, 15u, 0x00010000u },
+    { 0x80000000u, 16u, 0x00008000u },
+    { 0x80000000u, 17u, 0x00004000u },
+    { 0x80000000u, 18u, 0x00002000u },
+    { 0x80000000u, 19u, 0x00001000u },
+    { 0x80000000u, 20u, 0x00000800u },
+    { 0x80000000u, 21u, 0x00000400u },
+    { 0x80000000u, 22u, 0x00000200u },
+    { 0x80000000u, 23u, 0x00000100u },
+    { 0x80000000u, 24u, 0x00000080u },
+    { 0x80000000u, 25u, 0x00000040u },
+    { 0x80000000u, 26u, 0x00000020u },
+    { 0x80000000u, 27u, 0x00000010u },
+    { 0x80000000u, 28u, 0x00000008u },
+    { 0x80000000u, 29u, 0x00000004u },
+    { 0x80000000u, 30u, 0x00000002u },
+    { 0x80000000u, 31u, 0x00000001u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitRt_u32u8 vectors**
+ *
+ * The test runs the 128 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00070, SWS_Bfx_00075
+ */
+void test__Bfx_ShiftBitRt_u32u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitRt_u32u8 ) / sizeof( ShiftBitRt_u32u8[ 0 ] ) ); i++ )
+    {
+        uint32 Data = ShiftBitRt_u32u8[ i ].Data;
+        Bfx_ShiftBitRt_u32u8( &Data, ShiftBitRt_u32u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( ShiftBitRt_u32u8[ i ].Expected, Data, Vector( "Bfx_ShiftBitRt_u32u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 ShiftCnt;
+    uint32 Expected;
+} ShiftBitLt_u32u8[] = {
+    { 0xFFFFFFFFu,  0u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  1u, 0xFFFFFFFEu },
+    { 0xFFFFFFFFu,  2u, 0xFFFFFFFCu },
+    { 0xFFFFFFFFu,  3u, 0xFFFFFFF8u },
+    { 0xFFFFFFFFu,  4u, 0xFFFFFFF0u },
+    { 0xFFFFFFFFu,  5u, 0xFFFFFFE0u },
+    { 0xFFFFFFFFu,  6u, 0xFFFFFFC0u },
+    { 0xFFFFFFFFu,  7u, 0xFFFFFF80u },
+    { 0xFFFFFFFFu,  8u, 0xFFFFFF00u },
+    { 0xFFFFFFFFu,  9u, 0xFFFFFE00u },
+    { 0xFFFFFFFFu, 10u, 0xFFFFFC00u },
+    { 0xFFFFFFFFu, 11u, 0xFFFFF800u },
+    { 0xFFFFFFFFu, 12u, 0xFFFFF000u },
+    { 0xFFFFFFFFu, 13u, 0xFFFFE000u },
+    { 0xFFFFFFFFu, 14u, 0xFFFFC000u },
+    { 0xFFFFFFFFu, 15u, 0xFFFF8000u },
+    { 0xFFFFFFFFu, 16u, 0xFFFF0000u },
+    { 0xFFFFFFFFu, 17u, 0xFFFE0000u },
+    { 0xFFFFFFFFu, 18u, 0xFFFC0000u },
+    { 0xFFFFFFFFu, 19u, 0xFFF80000u },
+    { 0xFFFFFFFFu, 20u, 0xFFF00000u },
+    { 0xFFFFFFFFu, 21u, 0xFFE00000u },
+    { 0xFFFFFFFFu, 22u, 0xFFC00000u },
+    { 0xFFFFFFFFu, 23u, 0xFF800000u },
+    { 0xFFFFFFFFu, 24u, 0xFF000000u },
+    { 0xFFFFFFFFu, 25u, 0xFE000000u },
+    { 0xFFFFFFFFu, 26u, 0xFC000000u },
+    { 0xFFFFFFFFu, 27u, 0xF8000000u },
+    { 0xFFFFFFFFu, 28u, 0xF0000000u },
+    { 0xFFFFFFFFu, 29u, 0xE0000000u },
+    { 0xFFFFFFFFu, 30u, 0xC0000000u },
+    { 0xFFFFFFFFu, 31u, 0x80000000u },
+    { 0x89ABCDEFu,  0u, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  1u, 0x13579BDEu },
+    { 0x89ABCDEFu,  2u, 0x26AF37BCu },
+    { 0x89ABCDEFu,  3u, 0x4D5E6F78u },
+    { 0x89ABCDEFu,  4u, 0x9ABCDEF0u },
+    { 0x89ABCDEFu,  5u, 0x3579BDE0u },
+    { 0x89ABCDEFu,  6u, 0x6AF37BC0u },
+    { 0x89ABCDEFu,  7u, 0xD5E6F780u },
+    { 0x89ABCDEFu,  8u, 0xABCDEF00u },
+    { 0x89ABCDEFu,  9u, 0x579BDE00u },
+    { 0x89ABCDEFu, 10u, 0xAF37BC00u },
+    { 0x89ABCDEFu, 11u, 0x5E6F7800u },
+    { 0x89ABCDEFu, 12u, 0xBCDEF000u },
+    { 0x89ABCDEFu, 13u, 0x79BDE000u },
+    { 0x89ABCDEFu, 14u, 0xF37BC000u },
+    { 0x89ABCDEFu, 15u, 0xE6F78000u },
+    { 0x89ABCDEFu, 16u, 0xCDEF0000u },
+    { 0x89ABCDEFu, 17u, 0x9BDE0000u },
+    { 0x89ABCDEFu, 18u, 0x37BC0000u },
+    { 0x89ABCDEFu, 19u, 0x6F780000u },
+    { 0x89ABCDEFu, 20u, 0xDEF00000u },
+    { 0x89ABCDEFu, 21u, 0xBDE00000u },
+    { 0x89ABCDEFu, 22u, 0x7BC00000u },
+    { 0x89ABCDEFu, 23u, 0xF7800000u },
+    { 0x89ABCDEFu, 24u, 0xEF000000u },
+    { 0x89ABCDEFu, 25u, 0xDE000000u },
+    { 0x89ABCDEFu, 26u, 0xBC000000u },
+    { 0x89ABCDEFu, 27u, 0x78000000u },
+    { 0x89ABCDEFu, 28u, 0xF0000000u },
+    { 0x89ABCDEFu, 29u, 0xE0000000u },
+    { 0x89ABCDEFu, 30u, 0xC0000000u },
+    { 0x89ABCDEFu, 31u, 0x80000000u },
+    { 0x00000001u,  0u, 0x00000001u },
+    { 0x00000001u,  1u, 0x00000002u },
+    { 0x00000001u,  2u, 0x00000004u },
+    { 0x00000001u,  3u, 0x00000008u },
+    { 0x00000001u,  4u, 0x00000010u },
+    { 0x00000001u,  5u, 0x00000020u },
+    { 0x00000001u,  6u, 0x00000040u },
+    { 0x00000001u,  7u, 0x00000080u },
+    { 0x00000001u,  8u, 0x00000100u },
+    { 0x00000001u,  9u, 0x00000200u },
+    { 0x00000001u, 10u, 0x00000400u },
+    { 0x00000001u, 11u, 0x00000800u },
+    { 0x00000001u, 12u, 0x00001000u },
+    { 0x00000001u, 13u, 0x00002000u },
+    { 0x00000001u, 14u, 0x00004000u },
+    { 0x00000001u, 15u, 0x00008000u },
+    { 0x00000001u, 16u, 0x00010000u },
+    { 0x00000001u, 17u, 0x00020000u },
+    { 0x00000001u, 18u, 0x00040000u },
+    { 0x00000001u, 19u, 0x00080000u },
+    { 0x00000001u, 20u, 0x00100000u },
+    { 0x00000001u, 21u, 0x00200000u },
+    { 0x00000001u, 22u, 0x00400000u },
+    { 0x00000001u, 23u, 0x00800000u },
+    { 0x00000001u, 24u, 0x01000000u },
+    { 0x00000001u, 25u, 0x02000000u },
+    { 0x00000001u, 26u, 0x04000000u },
+    { 0x00000001u, 27u, 0x08000000u },
+    { 0x00000001u, 28u, 0x10000000u },
+    { 0x00000001u, 29u, 0x20000000u },
+    { 0x00000001u, 30u, 0x40000000u },
+    { 0x00000001u, 31u, 0x80000000u },
+    { 0x80000000u,  0u, 0x80000000u },
+    { 0x80000000u,  1u, 0x00000000u },
+    { 0x80000000u,  2u, 0x00000000u },
+    { 0x80000000u,  3u, 0x00000000u },
+    { 0x80000000u,  4u, 0x00000000u },
+    { 0x80000000u,  5u, 0x00000000u },
+    { 0x80000000u,  6u, 0x00000000u },
+    { 0x80000000u,  7u, 0x00000000u },
+    { 0x80000000u,  8u, 0x00000000u },
+    { 0x80000000u,  9u, 0x00000000u },
+    { 0x80000000u, 10u, 0x00000000u },
+    { 0x80000000u, 11u, 0x00000000u },
+    { 0x80000000u, 12u, 0x00000000u },
+    { 0x80000000u, 13u, 0x00000000u },
+    { 0x80000000u, 14u, 0x00000000u },
+    { 0x80000000u, 15u, 0x00000000u },
+    { 0x80000000u, 16u, 0x00000000u },
+    { 0x80000000u, 17u, 0x00000000u },
+    { 0x80000000u, 18u, 0x00000000u },
+    { 0x80000000u, 19u, 0x00000000u },
+    { 0x80000000u, 20u, 0x00000000u },
+    { 0x80000000u, 21u, 0x00000000u },
+    { 0x80000000u, 22u, 0x00000000u },
+    { 0x80000000u, 23u, 0x00000000u },
+    { 0x80000000u, 24u, 0x00000000u },
+    { 0x80000000u, 25u, 0x00000000u },
+    { 0x80000000u, 26u, 0x00000000u },
+    { 0x80000000u, 27u, 0x00000000u },
+    { 0x80000000u, 28u, 0x00000000u },
+    { 0x80000000u, 29u, 0x00000000u },
+    { 0x80000000u, 30u, 0x00000000u },
+    { 0x80000000u, 31u, 0x00000000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitLt_u32u8 vectors**
+ *
+ * The test runs the 128 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00076, SWS_Bfx_00080
+ */
+void test__Bfx_ShiftBitLt_u32u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitLt_u32u8 ) / sizeof( ShiftBitLt_u32u8[ 0 ] ) ); i++ )
+    {
+        uint32 Data = ShiftBitLt_u32u8[ i ].Data;
+        Bfx_ShiftBitLt_u32u8( &Data, ShiftBitLt_u32u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( ShiftBitLt_u32u8[ i ].Expected, Data, Vector( "Bfx_ShiftBitLt_u32u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 ShiftCnt;
+    uint32 Expected;
+} RotBitRt_u32u8[] = {
+    { 0xFFFFFFFFu,  0u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  1u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  2u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  3u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  4u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  5u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  6u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  7u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  8u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  9u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 10u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 11u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 12u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 13u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 14u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 15u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 16u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 17u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 18u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 19u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 20u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 21u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 22u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 23u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 24u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 25u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 26u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 27u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 28u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 29u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 30u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 31u, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  0u, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  1u, 0xC4D5E6F7u },
+    { 0x89ABCDEFu,  2u, 0xE26AF37Bu },
+    { 0x89ABCDEFu,  3u, 0xF13579BDu },
+    { 0x89ABCDEFu,  4u, 0xF89ABCDEu },
+    { 0x89ABCDEFu,  5u, 0x7C4D5E6Fu },
+    { 0x89ABCDEFu,  6u, 0xBE26AF37u },
+    { 0x89ABCDEFu,  7u, 0xDF13579Bu },
+    { 0x89ABCDEFu,  8u, 0xEF89ABCDu },
+    { 0x89ABCDEFu,  9u, 0xF7C4D5E6u },
+    { 0x89ABCDEFu, 10u, 0x7BE26AF3u },
+    { 0x89ABCDEFu, 11u, 0xBDF13579u },
+    { 0x89ABCDEFu, 12u, 0xDEF89ABCu },
+    { 0x89ABCDEFu, 13u, 0x6F7C4D5Eu },
+    { 0x89ABCDEFu, 14u, 0x37BE26AFu },
+    { 0x89ABCDEFu, 15u, 0x9BDF1357u },
+    { 0x89ABCDEFu, 16u, 0xCDEF89ABu },
+    { 0x89ABCDEFu, 17u, 0xE6F7C4D5u },
+    { 0x89ABCDEFu, 18u, 0xF37BE26Au },
+    { 0x89ABCDEFu, 19u, 0x79BDF135u },
+    { 0x89ABCDEFu, 20u, 0xBCDEF89Au },
+    { 0x89ABCDEFu, 21u, 0x5E6F7C4Du },
+    { 0x89ABCDEFu, 22u, 0xAF37BE26u },
+    { 0x89ABCDEFu, 23u, 0x579BDF13u },
+    { 0x89ABCDEFu, 24u, 0xABCDEF89u },
+    { 0x89ABCDEFu, 25u, 0xD5E6F7C4u },
+    { 0x89ABCDEFu, 26u, 0x6AF37BE2u },
+    { 0x89ABCDEFu, 27u, 0x3579BDF1u },
+    { 0x89ABCDEFu, 28u, 0x9ABCDEF8u },
+    { 0x89ABCDEFu, 29u, 0x4D5E6F7Cu },
+    { 0x89ABCDEFu, 30u, 0x26AF37BEu },
+    { 0x89ABCDEFu, 31u, 0x13579BDFu },
+    { 0x00000001u,  0u, 0x00000001u },
+    { 0x00000001u,  1u, 0x80000000u },
+    { 0x00000001u,  2u, 0x40000000u },
+    { 0x00000001u,  3u, 0x20000000u },
+    { 0x00000001u,  4u, 0x10000000u },
+    { 0x00000001u,  5u, 0x08000000u },
+    { 0x00000001u,  6u, 0x04000000u },
+    { 0x00000001u,  7u, 0x02000000u },
+    { 0x00000001u,  8u, 0x01000000u },
+    { 0x00000001u,  9u, 0x00800000u },
+    { 0x00000001u, 10u, 0x00400000u },
+    { 0x00000001u, 11u, 0x00200000u },
+    { 0x00000001u, 12u, 0x00100000u },
+    { 0x00000001u, 13u, 0x00080000u },
+    { 0x00000001u, 14u, 0x00040000u },
+    { 0x00000001u, 15u, 0x00020000u },
+    { 0x00000001u, 16u, 0x00010000u },
+    { 0x00000001u, 17u, 0x00008000u },
+    { 0x00000001u, 18u, 0x00004000u },
+    { 0x00000001u, 19u, 0x00002000u },
+    { 0x00000001u, 20u, 0x00001000u },
+    { 0x00000001u, 21u, 0x00000800u },
+    { 0x00000001u, 22u, 0x00000400u },
+    { 0x00000001u, 23u, 0x00000200u },
+    { 0x00000001u, 24u, 0x00000100u },
+    { 0x00000001u, 25u, 0x00000080u },
+    { 0x00000001u, 26u, 0x00000040u },
+    { 0x00000001u, 27u, 0x00000020u },
+    { 0x00000001u, 28u, 0x00000010u },
+    { 0x00000001u, 29u, 0x00000008u },
+    { 0x00000001u, 30u, 0x00000004u },
+    { 0x00000001u, 31u, 0x00000002u },
+    { 0x80000000u,  0u, 0x80000000u },
+    { 0x80000000u,  1u, 0x40000000u },
+    { 0x80000000u,  2u, 0x20000000u },
+    { 0x80000000u,  3u, 0x10000000u },
+    { 0x80000000u,  4u, 0x08000000u },
+    { 0x80000000u,  5u, 0x04000000u },
+    { 0x80000000u,  6u, 0x02000000u },
+    { 0x80000000u,  7u, 0x01000000u },
+    { 0x80000000u,  8u, 0x00800000u },
+    { 0x80000000u,  9u, 0x00400000u },
+    { 0x80000000u, 10u, 0x00200000u },
+    { 0x80000000u, 11u, 0x00100000u },
+    { 0x80000000u, 12u, 0x00080000u },
+    { 0x80000000u, 13u, 0x00040000u },
+    { 0x80000000u, 14u, 0x00020000u },
+    { 0x80000000u, 15u, 0x00010000u },
+    { 0x80000000u, 16u, 0x00008000u },
+    { 0x80000000u, 17u, 0x00004000u },
+    { 0x80000000u, 18u, 0x00002000u },
+    { 0x80000000u, 19u, 0x00001000u },
+    { 0x80000000u, 20u, 0x00000800u },
+    { 0x80000000u, 21u, 0x00000400u },
+    { 0x80000000u, 22u, 0x00000200u },
+    { 0x80000000u, 23u, 0x00000100u },
+    { 0x80000000u, 24u, 0x00000080u },
+    { 0x80000000u, 25u, 0x00000040u },
+    { 0x80000000u, 26u, 0x00000020u },
+    { 0x80000000u, 27u, 0x00000010u },
+    { 0x80000000u, 28u, 0x00000008u },
+    { 0x80000000u, 29u, 0x00000004u },
+    { 0x80000000u, 30u, 0x00000002u },
+    { 0x80000000u, 31u, 0x00000001u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_RotBitRt_u32u8 vectors**
+ *
+ * The test runs the 128 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00086, SWS_Bfx_00090
+ */
+void test__Bfx_RotBitRt_u32u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( RotBitRt_u32u8 ) / sizeof( RotBitRt_u32u8[ 0 ] ) ); i++ )
+    {
+        uint32 Data = RotBitRt_u32u8[ i ].Data;
+        Bfx_RotBitRt_u32u8( &Data, RotBitRt_u32u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( RotBitRt_u32u8[ i ].Expected, Data, Vector( "Bfx_RotBitRt_u32u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 ShiftCnt;
+    uint32 Expected;
+} RotBitLt_u32u8[] = {
+    { 0xFFFFFFFFu,  0u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  1u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  2u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  3u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  4u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  5u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  6u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  7u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  8u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  9u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 10u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 11u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 12u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 13u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 14u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 15u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 16u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 17u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 18u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 19u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 20u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 21u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 22u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 23u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 24u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 25u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 26u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 27u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 28u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 29u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 30u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 31u, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  0u, 0x89ABCDEFu },
+    { 0x89ABCDEFu,  1u, 0x13579BDFu },
+    { 0x89ABCDEFu,  2u, 0x26AF37BEu },
+    { 0x89ABCDEFu,  3u, 0x4D5E6F7Cu },
+    { 0x89ABCDEFu,  4u, 0x9ABCDEF8u },
+    { 0x89ABCDEFu,  5u, 0x3579BDF1u },
+    { 0x89ABCDEFu,  6u, 0x6AF37BE2u },
+    { 0x89ABCDEFu,  7u, 0xD5E6F7C4u },
+    { 0x89ABCDEFu,  8u, 0xABCDEF89u },
+    { 0x89ABCDEFu,  9u, 0x579BDF13u },
+    { 0x89ABCDEFu, 10u, 0xAF37BE26u },
+    { 0x89ABCDEFu, 11u, 0x5E6F7C4Du },
+    { 0x89ABCDEFu, 12u, 0xBCDEF89Au },
+    { 0x89ABCDEFu, 13u, 0x79BDF135u },
+    { 0x89ABCDEFu, 14u, 0xF37BE26Au },
+    { 0x89ABCDEFu, 15u, 0xE6F7C4D5u },
+    { 0x89ABCDEFu, 16u, 0xCDEF89ABu },
+    { 0x89ABCDEFu, 17u, 0x9BDF1357u },
+    { 0x89ABCDEFu, 18u, 0x37BE26AFu },
+    { 0x89ABCDEFu, 19u, 0x6F7C4D5Eu },
+    { 0x89ABCDEFu, 20u, 0xDEF89ABCu },
+    { 0x89ABCDEFu, 21u, 0xBDF13579u },
+    { 0x89ABCDEFu, 22u, 0x7BE26AF3u },
+    { 0x89ABCDEFu, 23u, 0xF7C4D5E6u },
+    { 0x89ABCDEFu, 24u, 0xEF89ABCDu },
+    { 0x89ABCDEFu, 25u, 0xDF13579Bu },
+    { 0x89ABCDEFu, 26u, 0xBE26AF37u },
+    { 0x89ABCDEFu, 27u, 0x7C4D5E6Fu },
+    { 0x89ABCDEFu, 28u, 0xF89ABCDEu },
+    { 0x89ABCDEFu, 29u, 0xF13579BDu },
+    { 0x89ABCDEFu, 30u, 0xE26AF37Bu },
+    { 0x89ABCDEFu, 31u, 0xC4D5E6F7u },
+    { 0x00000001u,  0u, 0x00000001u },
+    { 0x00000001u,  1u, 0x00000002u },
+    { 0x00000001u,  2u, 0x00000004u },
+    { 0x00000001u,  3u, 0x00000008u },
+    { 0x00000001u,  4u, 0x00000010u },
+    { 0x00000001u,  5u, 0x00000020u },
+    { 0x00000001u,  6u, 0x00000040u },
+    { 0x00000001u,  7u, 0x00000080u },
+    { 0x00000001u,  8u, 0x00000100u },
+    { 0x00000001u,  9u, 0x00000200u },
+    { 0x00000001u, 10u, 0x00000400u },
+    { 0x00000001u, 11u, 0x00000800u },
+    { 0x00000001u, 12u, 0x00001000u },
+    { 0x00000001u, 13u, 0x00002000u },
+    { 0x00000001u, 14u, 0x00004000u },
+    { 0x00000001u, 15u, 0x00008000u },
+    { 0x00000001u, 16u, 0x00010000u },
+    { 0x00000001u, 17u, 0x00020000u },
+    { 0x00000001u, 18u, 0x00040000u },
+    { 0x00000001u, 19u, 0x00080000u },
+    { 0x00000001u, 20u, 0x00100000u },
+    { 0x00000001u, 21u, 0x00200000u },
+    { 0x00000001u, 22u, 0x00400000u },
+    { 0x00000001u, 23u, 0x00800000u },
+    { 0x00000001u, 24u, 0x01000000u },
+    { 0x00000001u, 25u, 0x02000000u },
+    { 0x00000001u, 26u, 0x04000000u },
+    { 0x00000001u, 27u, 0x08000000u },
+    { 0x00000001u, 28u, 0x10000000u },
+    { 0x00000001u, 29u, 0x20000000u },
+    { 0x00000001u, 30u, 0x40000000u },
+    { 0x00000001u, 31u, 0x80000000u },
+    { 0x80000000u,  0u, 0x80000000u },
+    { 0x80000000u,  1u, 0x00000001u },
+    { 0x80000000u,  2u, 0x00000002u },
+    { 0x80000000u,  3u, 0x00000004u },
+    { 0x80000000u,  4u, 0x00000008u },
+    { 0x80000000u,  5u, 0x00000010u },
+    { 0x80000000u,  6u, 0x00000020u },
+    { 0x80000000u,  7u, 0x00000040u },
+    { 0x80000000u,  8u, 0x00000080u },
+    { 0x80000000u,  9u, 0x00000100u },
+    { 0x80000000u, 10u, 0x00000200u },
+    { 0x80000000u, 11u, 0x00000400u },
+    { 0x80000000u, 12u, 0x00000800u },
+    { 0x80000000u, 13u, 0x00001000u },
+    { 0x80000000u, 14u, 0x00002000u },
+    { 0x80000000u, 15u, 0x00004000u },
+    { 0x80000000u, 16u, 0x00008000u },
+    { 0x80000000u, 17u, 0x00010000u },
+    { 0x80000000u, 18u, 0x00020000u },
+    { 0x80000000u, 19u, 0x00040000u },
+    { 0x80000000u, 20u, 0x00080000u },
+    { 0x80000000u, 21u, 0x00100000u },
+    { 0x80000000u, 22u, 0x00200000u },
+    { 0x80000000u, 23u, 0x00400000u },
+    { 0x80000000u, 24u, 0x00800000u },
+    { 0x80000000u, 25u, 0x01000000u },
+    { 0x80000000u, 26u, 0x02000000u },
+    { 0x80000000u, 27u, 0x04000000u },
+    { 0x80000000u, 28u, 0x08000000u },
+    { 0x80000000u, 29u, 0x10000000u },
+    { 0x80000000u, 30u, 0x20000000u },
+    { 0x80000000u, 31u, 0x40000000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_RotBitLt_u32u8 vectors**
+ *
+ * The test runs the 128 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00095, SWS_Bfx_00098
+ */
+void test__Bfx_RotBitLt_u32u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( RotBitLt_u32u8 ) / sizeof( RotBitLt_u32u8[ 0 ] ) ); i++ )
+    {
+        uint32 Data = RotBitLt_u32u8[ i ].Data;
+        Bfx_RotBitLt_u32u8( &Data, RotBitLt_u32u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( RotBitLt_u32u8[ i ].Expected, Data, Vector( "Bfx_RotBitLt_u32u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 DestinationData;
+    uint8 DestinationPosition;
+    uint32 SourceData;
+    uint8 SourcePosition;
+    uint32 Expected;
+} CopyBit_u32u8u32u8[] = {
+    { 0xAAAAAAAAu,  0u, 0x55555555u,  0u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u,  2u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u,  4u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u,  6u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u,  8u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 10u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 12u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 14u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 16u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 18u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 20u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 22u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 24u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 26u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 28u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 30u, 0xAAAAAAABu },
+    { 0xAAAAAAAAu,  0u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u,  1u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u,  3u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u,  5u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u,  7u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u,  9u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 11u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 13u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 15u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 17u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 19u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 21u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 23u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 25u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 27u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 29u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  1u, 0x55555555u, 31u, 0xAAAAAAA8u },
+    { 0xAAAAAAAAu,  2u, 0x55555555u,  0u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u,  2u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u,  4u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u,  6u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u,  8u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 10u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 12u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 14u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 16u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 18u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 20u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 22u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 24u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 26u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 28u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 30u, 0xAAAAAAAEu },
+    { 0xAAAAAAAAu,  2u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u,  1u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u,  3u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u,  5u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u,  7u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u,  9u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 11u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 13u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 15u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 17u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 19u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 21u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 23u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 25u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 27u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 29u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  3u, 0x55555555u, 31u, 0xAAAAAAA2u },
+    { 0xAAAAAAAAu,  4u, 0x55555555u,  0u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u,  2u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u,  4u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u,  6u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u,  8u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 10u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 12u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 14u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 16u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 18u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 20u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 22u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 24u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 26u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 28u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 30u, 0xAAAAAABAu },
+    { 0xAAAAAAAAu,  4u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u,  1u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u,  3u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u,  5u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u,  7u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u,  9u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 11u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 13u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 15u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 17u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 19u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 21u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 23u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 25u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 27u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 29u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  5u, 0x55555555u, 31u, 0xAAAAAA8Au },
+    { 0xAAAAAAAAu,  6u, 0x55555555u,  0u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u,  2u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u,  4u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u,  6u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u,  8u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 10u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 12u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 14u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 16u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 18u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 20u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 22u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 24u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 26u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 28u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 30u, 0xAAAAAAEAu },
+    { 0xAAAAAAAAu,  6u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u,  1u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u,  3u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u,  5u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u,  7u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u,  9u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 11u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 13u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 15u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 17u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 19u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 21u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 23u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 25u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 27u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 29u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  7u, 0x55555555u, 31u, 0xAAAAAA2Au },
+    { 0xAAAAAAAAu,  8u, 0x55555555u,  0u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u,  2u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u,  4u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u,  6u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u,  8u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 10u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 12u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 14u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 16u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 18u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 20u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 22u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 24u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 26u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 28u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 30u, 0xAAAAABAAu },
+    { 0xAAAAAAAAu,  8u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u,  1u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u,  3u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u,  5u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u,  7u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u,  9u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 11u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 13u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 15u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 17u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 19u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 21u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 23u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 25u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 27u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 29u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu,  9u, 0x55555555u, 31u, 0xAAAAA8AAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u,  0u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u,  2u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u,  4u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u,  6u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u,  8u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 10u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 12u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 14u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 16u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 18u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 20u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 22u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 24u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 26u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 28u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 30u, 0xAAAAAEAAu },
+    { 0xAAAAAAAAu, 10u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u,  1u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u,  3u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u,  5u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u,  7u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u,  9u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 11u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 13u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 15u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 17u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 19u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 21u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 23u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 25u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 27u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 29u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 11u, 0x55555555u, 31u, 0xAAAAA2AAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u,  0u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u,  2u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u,  4u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u,  6u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u,  8u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 10u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 12u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 14u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 16u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 18u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 20u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 22u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 24u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 26u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 28u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 30u, 0xAAAABAAAu },
+    { 0xAAAAAAAAu, 12u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u,  1u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u,  3u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u,  5u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u,  7u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u,  9u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 11u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 13u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 15u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 17u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 19u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 21u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 23u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 25u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 27u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 29u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 13u, 0x55555555u, 31u, 0xAAAA8AAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u,  0u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u,  2u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u,  4u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u,  6u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u,  8u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 10u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 12u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 14u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 16u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 18u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 20u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 22u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 24u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 26u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 28u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 30u, 0xAAAAEAAAu },
+    { 0xAAAAAAAAu, 14u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u,  1u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u,  3u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u,  5u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u,  7u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u,  9u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 11u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 13u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 15u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 17u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 19u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 21u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 23u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 25u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 27u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 29u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 15u, 0x55555555u, 31u, 0xAAAA2AAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u,  0u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u,  2u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u,  4u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u,  6u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u,  8u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 10u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 12u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 14u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 16u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 18u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 20u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 22u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 24u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 26u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 28u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 30u, 0xAAABAAAAu },
+    { 0xAAAAAAAAu, 16u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u,  1u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u,  3u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u,  5u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u,  7u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u,  9u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 11u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 13u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 15u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 17u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 19u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 21u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 23u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 25u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 27u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 29u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 17u, 0x55555555u, 31u, 0xAAA8AAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u,  0u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u,  2u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u,  4u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u,  6u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u,  8u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 10u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 12u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 14u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 16u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 18u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 20u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 22u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 24u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 26u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 28u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 30u, 0xAAAEAAAAu },
+    { 0xAAAAAAAAu, 18u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u,  1u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u,  3u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u,  5u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u,  7u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u,  9u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 11u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 13u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 15u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 17u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 19u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 21u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 23u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 25u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 27u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 29u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 19u, 0x55555555u, 31u, 0xAAA2AAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u,  0u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u,  2u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u,  4u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u,  6u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u,  8u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 10u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 12u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 14u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 16u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 18u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 20u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 22u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 24u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 26u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 28u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 30u, 0xAABAAAAAu },
+    { 0xAAAAAAAAu, 20u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u,  1u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u,  3u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u,  5u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u,  7u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u,  9u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 11u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 13u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 15u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 17u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 19u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 21u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 23u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 25u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 27u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 29u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 21u, 0x55555555u, 31u, 0xAA8AAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u,  0u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u,  2u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u,  4u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u,  6u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u,  8u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 10u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 12u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 14u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 16u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 18u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 20u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 22u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 24u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 26u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 28u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 30u, 0xAAEAAAAAu },
+    { 0xAAAAAAAAu, 22u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u,  1u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u,  3u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u,  5u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u,  7u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u,  9u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 11u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 13u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 15u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 17u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 19u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 21u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 23u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 25u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 27u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 29u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 23u, 0x55555555u, 31u, 0xAA2AAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u,  0u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u,  2u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u,  4u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u,  6u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u,  8u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 10u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 12u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 14u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 16u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 18u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 20u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 22u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 24u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 26u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 28u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 30u, 0xABAAAAAAu },
+    { 0xAAAAAAAAu, 24u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u,  1u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u,  3u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u,  5u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u,  7u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u,  9u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 11u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 13u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 15u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 17u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 19u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 21u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 23u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 25u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 27u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 29u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 25u, 0x55555555u, 31u, 0xA8AAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u,  0u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u,  2u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u,  4u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u,  6u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u,  8u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 10u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 12u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 14u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 16u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 18u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 20u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 22u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 24u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 26u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 28u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 30u, 0xAEAAAAAAu },
+    { 0xAAAAAAAAu, 26u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u,  1u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u,  3u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u,  5u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u,  7u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u,  9u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 11u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 13u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 15u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 17u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 19u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 21u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 23u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 25u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 27u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 29u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 27u, 0x55555555u, 31u, 0xA2AAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u,  0u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u,  2u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u,  4u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u,  6u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u,  8u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 10u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 12u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 14u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 16u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 18u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 20u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 22u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 24u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 26u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 28u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 30u, 0xBAAAAAAAu },
+    { 0xAAAAAAAAu, 28u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u,  1u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u,  3u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u,  5u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u,  7u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u,  9u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 11u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 13u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 15u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 17u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 19u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 21u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 23u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 25u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 27u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 29u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 29u, 0x55555555u, 31u, 0x8AAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u,  0u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u,  1u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u,  2u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u,  3u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u,  4u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u,  5u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u,  6u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u,  7u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u,  8u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u,  9u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 10u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 11u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 12u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 13u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 14u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 15u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 16u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 17u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 18u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 19u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 20u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 21u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 22u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 23u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 24u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 25u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 26u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 27u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 28u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 29u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 30u, 0xEAAAAAAAu },
+    { 0xAAAAAAAAu, 30u, 0x55555555u, 31u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u,  0u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u,  1u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u,  2u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u,  3u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u,  4u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u,  5u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u,  6u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u,  7u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u,  8u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u,  9u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 10u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 11u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 12u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 13u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 14u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 15u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 16u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 17u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 18u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 19u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 20u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 21u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 22u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 23u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 24u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 25u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 26u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 27u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 28u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 29u, 0x2AAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 30u, 0xAAAAAAAAu },
+    { 0xAAAAAAAAu, 31u, 0x55555555u, 31u, 0x2AAAAAAAu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CopyBit_u32u8u32u8 vectors**
+ *
+ * The test runs the 1024 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00101, SWS_Bfx_00108
+ */
+void test__Bfx_CopyBit_u32u8u32u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CopyBit_u32u8u32u8 ) / sizeof( CopyBit_u32u8u32u8[ 0 ] ) ); i++ )
+    {
+        uint32 DestinationData = CopyBit_u32u8u32u8[ i ].DestinationData;
+        Bfx_CopyBit_u32u8u32u8( &DestinationData, CopyBit_u32u8u32u8[ i ].DestinationPosition, CopyBit_u32u8u32u8[ i ].SourceData, CopyBit_u32u8u32u8[ i ].SourcePosition );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( CopyBit_u32u8u32u8[ i ].Expected, DestinationData, Vector( "Bfx_CopyBit_u32u8u32u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint32 Pattern;
+    uint32 Mask;
+    uint32 Expected;
+} PutBitsMask_u32u32u32[] = {
+    { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u },
+    { 0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0x00000000u },
+    { 0x00000000u, 0x00000000u, 0xAAAAAAAAu, 0x00000000u },
+    { 0x00000000u, 0x00000000u, 0x89ABCDEFu, 0x00000000u },
+    { 0x00000000u, 0xFFFFFFFFu, 0x00000000u, 0x00000000u },
+    { 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu },
+    { 0x00000000u, 0xFFFFFFFFu, 0xAAAAAAAAu, 0xAAAAAAAAu },
+    { 0x00000000u, 0xFFFFFFFFu, 0x89ABCDEFu, 0x89ABCDEFu },
+    { 0x00000000u, 0x55555555u, 0x00000000u, 0x00000000u },
+    { 0x00000000u, 0x55555555u, 0xFFFFFFFFu, 0x55555555u },
+    { 0x00000000u, 0x55555555u, 0xAAAAAAAAu, 0x00000000u },
+    { 0x00000000u, 0x55555555u, 0x89ABCDEFu, 0x01014545u },
+    { 0x00000000u, 0x89ABCDEFu, 0x00000000u, 0x00000000u },
+    { 0x00000000u, 0x89ABCDEFu, 0xFFFFFFFFu, 0x89ABCDEFu },
+    { 0x00000000u, 0x89ABCDEFu, 0xAAAAAAAAu, 0x88AA88AAu },
+    { 0x00000000u, 0x89ABCDEFu, 0x89ABCDEFu, 0x89ABCDEFu },
+    { 0xFFFFFFFFu, 0x00000000u, 0x00000000u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0x00000000u, 0xFFFFFFFFu, 0x00000000u },
+    { 0xFFFFFFFFu, 0x00000000u, 0xAAAAAAAAu, 0x55555555u },
+    { 0xFFFFFFFFu, 0x00000000u, 0x89ABCDEFu, 0x76543210u },
+    { 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xAAAAAAAAu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0xFFFFFFFFu, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0x55555555u, 0x00000000u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0x55555555u, 0xFFFFFFFFu, 0x55555555u },
+    { 0xFFFFFFFFu, 0x55555555u, 0xAAAAAAAAu, 0x55555555u },
+    { 0xFFFFFFFFu, 0x55555555u, 0x89ABCDEFu, 0x77557755u },
+    { 0xFFFFFFFFu, 0x89ABCDEFu, 0x00000000u, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0x89ABCDEFu, 0xFFFFFFFFu, 0x89ABCDEFu },
+    { 0xFFFFFFFFu, 0x89ABCDEFu, 0xAAAAAAAAu, 0xDDFFDDFFu },
+    { 0xFFFFFFFFu, 0x89ABCDEFu, 0x89ABCDEFu, 0xFFFFFFFFu },
+    { 0x55555555u, 0x00000000u, 0x00000000u, 0x55555555u },
+    { 0x55555555u, 0x00000000u, 0xFFFFFFFFu, 0x00000000u },
+    { 0x55555555u, 0x00000000u, 0xAAAAAAAAu, 0x55555555u },
+    { 0x55555555u, 0x00000000u, 0x89ABCDEFu, 0x54541010u },
+    { 0x55555555u, 0xFFFFFFFFu, 0x00000000u, 0x55555555u },
+    { 0x55555555u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu },
+    { 0x55555555u, 0xFFFFFFFFu, 0xAAAAAAAAu, 0xFFFFFFFFu },
+    { 0x55555555u, 0xFFFFFFFFu, 0x89ABCDEFu, 0xDDFFDDFFu },
+    { 0x55555555u, 0x55555555u, 0x00000000u, 0x55555555u },
+    { 0x55555555u, 0x55555555u, 0xFFFFFFFFu, 0x55555555u },
+    { 0x55555555u, 0x55555555u, 0xAAAAAAAAu, 0x55555555u },
+    { 0x55555555u, 0x55555555u, 0x89ABCDEFu, 0x55555555u },
+    { 0x55555555u, 0x89ABCDEFu, 0x00000000u, 0x55555555u },
+    { 0x55555555u, 0x89ABCDEFu, 0xFFFFFFFFu, 0x89ABCDEFu },
+    { 0x55555555u, 0x89ABCDEFu, 0xAAAAAAAAu, 0xDDFFDDFFu },
+    { 0x55555555u, 0x89ABCDEFu, 0x89ABCDEFu, 0xDDFFDDFFu },
+    { 0x89ABCDEFu, 0x00000000u, 0x00000000u, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0x00000000u, 0xFFFFFFFFu, 0x00000000u },
+    { 0x89ABCDEFu, 0x00000000u, 0xAAAAAAAAu, 0x01014545u },
+    { 0x89ABCDEFu, 0x00000000u, 0x89ABCDEFu, 0x00000000u },
+    { 0x89ABCDEFu, 0xFFFFFFFFu, 0x00000000u, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu },
+    { 0x89ABCDEFu, 0xFFFFFFFFu, 0xAAAAAAAAu, 0xABABEFEFu },
+    { 0x89ABCDEFu, 0xFFFFFFFFu, 0x89ABCDEFu, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0x55555555u, 0x00000000u, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0x55555555u, 0xFFFFFFFFu, 0x55555555u },
+    { 0x89ABCDEFu, 0x55555555u, 0xAAAAAAAAu, 0x01014545u },
+    { 0x89ABCDEFu, 0x55555555u, 0x89ABCDEFu, 0x01014545u },
+    { 0x89ABCDEFu, 0x89ABCDEFu, 0x00000000u, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0x89ABCDEFu, 0xFFFFFFFFu, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0x89ABCDEFu, 0xAAAAAAAAu, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0x89ABCDEFu, 0x89ABCDEFu, 0x89ABCDEFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_PutBitsMask_u32u32u32 vectors**
+ *
+ * The test runs the 64 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00120, SWS_Bfx_00124
+ */
+void test__Bfx_PutBitsMask_u32u32u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( PutBitsMask_u32u32u32 ) / sizeof( PutBitsMask_u32u32u32[ 0 ] ) ); i++ )
+    {
+        uint32 Data = PutBitsMask_u32u32u32[ i ].Data;
+        Bfx_PutBitsMask_u32u32u32( &Data, PutBitsMask_u32u32u32[ i ].Pattern, PutBitsMask_u32u32u32[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( PutBitsMask_u32u32u32[ i ].Expected, Data, Vector( "Bfx_PutBitsMask_u32u32u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    sint8 ShiftCnt;
+    uint32 Expected;
+} ShiftBitSat_u32s8_u32[] = {
+    { 0x55555556u,   2, 0xFFFFFFFFu },
+    { 0x00000000u, -31, 0x00000000u },
+    { 0x00000000u, -30, 0x00000000u },
+    { 0x00000000u, -29, 0x00000000u },
+    { 0x00000000u, -28, 0x00000000u },
+    { 0x00000000u, -27, 0x00000000u },
+    { 0x00000000u, -26, 0x00000000u },
+    { 0x00000000u, -25, 0x00000000u },
+    { 0x00000000u, -24, 0x00000000u },
+    { 0x00000000u, -23, 0x00000000u },
+    { 0x00000000u, -22, 0x00000000u },
+    { 0x00000000u, -21, 0x00000000u },
+    { 0x00000000u, -20, 0x00000000u },
+    { 0x00000000u, -19, 0x00000000u },
+    { 0x00000000u, -18, 0x00000000u },
+    { 0x00000000u, -17, 0x00000000u },
+    { 0x00000000u, -16, 0x00000000u },
+    { 0x00000000u, -15, 0x00000000u },
+    { 0x00000000u, -14, 0x00000000u },
+    { 0x00000000u, -13, 0x00000000u },
+    { 0x00000000u, -12, 0x00000000u },
+    { 0x00000000u, -11, 0x00000000u },
+    { 0x00000000u, -10, 0x00000000u },
+    { 0x00000000u,  -9, 0x00000000u },
+    { 0x00000000u,  -8, 0x00000000u },
+    { 0x00000000u,  -7, 0x00000000u },
+    { 0x00000000u,  -6, 0x00000000u },
+    { 0x00000000u,  -5, 0x00000000u },
+    { 0x00000000u,  -4, 0x00000000u },
+    { 0x00000000u,  -3, 0x00000000u },
+    { 0x00000000u,  -2, 0x00000000u },
+    { 0x00000000u,  -1, 0x00000000u },
+    { 0x00000000u,   0, 0x00000000u },
+    { 0x00000000u,   1, 0x00000000u },
+    { 0x00000000u,   2, 0x00000000u },
+    { 0x00000000u,   3, 0x00000000u },
+    { 0x00000000u,   4, 0x00000000u },
+    { 0x00000000u,   5, 0x00000000u },
+    { 0x00000000u,   6, 0x00000000u },
+    { 0x00000000u,   7, 0x00000000u },
+    { 0x00000000u,   8, 0x00000000u },
+    { 0x00000000u,   9, 0x00000000u },
+    { 0x00000000u,  10, 0x00000000u },
+    { 0x00000000u,  11, 0x00000000u },
+    { 0x00000000u,  12, 0x00000000u },
+    { 0x00000000u,  13, 0x00000000u },
+    { 0x00000000u,  14, 0x00000000u },
+    { 0x00000000u,  15, 0x00000000u },
+    { 0x00000000u,  16, 0x00000000u },
+    { 0x00000000u,  17, 0x00000000u },
+    { 0x00000000u,  18, 0x00000000u },
+    { 0x00000000u,  19, 0x00000000u },
+    { 0x00000000u,  20, 0x00000000u },
+    { 0x00000000u,  21, 0x00000000u },
+    { 0x00000000u,  22, 0x00000000u },
+    { 0x00000000u,  23, 0x00000000u },
+    { 0x00000000u,  24, 0x00000000u },
+    { 0x00000000u,  25, 0x00000000u },
+    { 0x00000000u,  26, 0x00000000u },
+    { 0x00000000u,  27, 0x00000000u },
+    { 0x00000000u,  28, 0x00000000u },
+    { 0x00000000u,  29, 0x00000000u },
+    { 0x00000000u,  30, 0x00000000u },
+    { 0x00000000u,  31, 0x00000000u },
+    { 0xFFFFFFFFu, -31, 0x00000001u },
+    { 0xFFFFFFFFu, -30, 0x00000003u },
+    { 0xFFFFFFFFu, -29, 0x00000007u },
+    { 0xFFFFFFFFu, -28, 0x0000000Fu },
+    { 0xFFFFFFFFu, -27, 0x0000001Fu },
+    { 0xFFFFFFFFu, -26, 0x0000003Fu },
+    { 0xFFFFFFFFu, -25, 0x0000007Fu },
+    { 0xFFFFFFFFu, -24, 0x000000FFu },
+    { 0xFFFFFFFFu, -23, 0x000001FFu },
+    { 0xFFFFFFFFu, -22, 0x000003FFu },
+    { 0xFFFFFFFFu, -21, 0x000007FFu },
+    { 0xFFFFFFFFu, -20, 0x00000FFFu },
+    { 0xFFFFFFFFu, -19, 0x00001FFFu },
+    { 0xFFFFFFFFu, -18, 0x00003FFFu },
+    { 0xFFFFFFFFu, -17, 0x00007FFFu },
+    { 0xFFFFFFFFu, -16, 0x0000FFFFu },
+    { 0xFFFFFFFFu, -15, 0x0001FFFFu },
+    { 0xFFFFFFFFu, -14, 0x0003FFFFu },
+    { 0xFFFFFFFFu, -13, 0x0007FFFFu },
+    { 0xFFFFFFFFu, -12, 0x000FFFFFu },
+    { 0xFFFFFFFFu, -11, 0x001FFFFFu },
+    { 0xFFFFFFFFu, -10, 0x003FFFFFu },
+    { 0xFFFFFFFFu,  -9, 0x007FFFFFu },
+    { 0xFFFFFFFFu,  -8, 0x00FFFFFFu },
+    { 0xFFFFFFFFu,  -7, 0x01FFFFFFu },
+    { 0xFFFFFFFFu,  -6, 0x03FFFFFFu },
+    { 0xFFFFFFFFu,  -5, 0x07FFFFFFu },
+    { 0xFFFFFFFFu,  -4, 0x0FFFFFFFu },
+    { 0xFFFFFFFFu,  -3, 0x1FFFFFFFu },
+    { 0xFFFFFFFFu,  -2, 0x3FFFFFFFu },
+    { 0xFFFFFFFFu,  -1, 0x7FFFFFFFu },
+    { 0xFFFFFFFFu,   0, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,   1, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,   2, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,   3, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,   4, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,   5, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,   6, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,   7, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,   8, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,   9, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  10, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  11, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  12, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  13, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  14, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  15, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  16, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  17, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  18, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  19, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  20, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  21, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  22, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  23, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  24, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  25, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  26, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  27, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  28, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  29, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  30, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu,  31, 0xFFFFFFFFu },
+    { 0x00000001u, -31, 0x00000000u },
+    { 0x00000001u, -30, 0x00000000u },
+    { 0x00000001u, -29, 0x00000000u },
+    { 0x00000001u, -28, 0x00000000u },
+    { 0x00000001u, -27, 0x00000000u },
+    { 0x00000001u, -26, 0x00000000u },
+    { 0x00000001u, -25, 0x00000000u },
+    { 0x00000001u, -24, 0x00000000u },
+    { 0x00000001u, -23, 0x00000000u },
+    { 0x00000001u, -22, 0x00000000u },
+    { 0x00000001u, -21, 0x00000000u },
+    { 0x00000001u, -20, 0x00000000u },
+    { 0x00000001u, -19, 0x00000000u },
+    { 0x00000001u, -18, 0x00000000u },
+    { 0x00000001u, -17, 0x00000000u },
+    { 0x00000001u, -16, 0x00000000u },
+    { 0x00000001u, -15, 0x00000000u },
+    { 0x00000001u, -14, 0x00000000u },
+    { 0x00000001u, -13, 0x00000000u },
+    { 0x00000001u, -12, 0x00000000u },
+    { 0x00000001u, -11, 0x00000000u },
+    { 0x00000001u, -10, 0x00000000u },
+    { 0x00000001u,  -9, 0x00000000u },
+    { 0x00000001u,  -8, 0x00000000u },
+    { 0x00000001u,  -7, 0x00000000u },
+    { 0x00000001u,  -6, 0x00000000u },
+    { 0x00000001u,  -5, 0x00000000u },
+    { 0x00000001u,  -4, 0x00000000u },
+    { 0x00000001u,  -3, 0x00000000u },
+    { 0x00000001u,  -2, 0x00000000u },
+    { 0x00000001u,  -1, 0x00000000u },
+    { 0x00000001u,   0, 0x00000001u },
+    { 0x00000001u,   1, 0x00000002u },
+    { 0x00000001u,   2, 0x00000004u },
+    { 0x00000001u,   3, 0x00000008u },
+    { 0x00000001u,   4, 0x00000010u },
+    { 0x00000001u,   5, 0x00000020u },
+    { 0x00000001u,   6, 0x00000040u },
+    { 0x00000001u,   7, 0x00000080u },
+    { 0x00000001u,   8, 0x00000100u },
+    { 0x00000001u,   9, 0x00000200u },
+    { 0x00000001u,  10, 0x00000400u },
+    { 0x00000001u,  11, 0x00000800u },
+    { 0x00000001u,  12, 0x00001000u },
+    { 0x00000001u,  13, 0x00002000u },
+    { 0x00000001u,  14, 0x00004000u },
+    { 0x00000001u,  15, 0x00008000u },
+    { 0x00000001u,  16, 0x00010000u },
+    { 0x00000001u,  17, 0x00020000u },
+    { 0x00000001u,  18, 0x00040000u },
+    { 0x00000001u,  19, 0x00080000u },
+    { 0x00000001u,  20, 0x00100000u },
+    { 0x00000001u,  21, 0x00200000u },
+    { 0x00000001u,  22, 0x00400000u },
+    { 0x00000001u,  23, 0x00800000u },
+    { 0x00000001u,  24, 0x01000000u },
+    { 0x00000001u,  25, 0x02000000u },
+    { 0x00000001u,  26, 0x04000000u },
+    { 0x00000001u,  27, 0x08000000u },
+    { 0x00000001u,  28, 0x10000000u },
+    { 0x00000001u,  29, 0x20000000u },
+    { 0x00000001u,  30, 0x40000000u },
+    { 0x00000001u,  31, 0x80000000u },
+    { 0x80000000u, -31, 0x00000001u },
+    { 0x80000000u, -30, 0x00000002u },
+    { 0x80000000u, -29, 0x00000004u },
+    { 0x80000000u, -28, 0x00000008u },
+    { 0x80000000u, -27, 0x00000010u },
+    { 0x80000000u, -26, 0x00000020u },
+    { 0x80000000u, -25, 0x00000040u },
+    { 0x80000000u, -24, 0x00000080u },
+    { 0x80000000u, -23, 0x00000100u },
+    { 0x80000000u, -22, 0x00000200u },
+    { 0x80000000u, -21, 0x00000400u },
+    { 0x80000000u, -20, 0x00000800u },
+    { 0x80000000u, -19, 0x00001000u },
+    { 0x80000000u, -18, 0x00002000u },
+    { 0x80000000u, -17, 0x00004000u },
+    { 0x80000000u, -16, 0x00008000u },
+    { 0x80000000u, -15, 0x00010000u },
+    { 0x80000000u, -14, 0x00020000u },
+    { 0x80000000u, -13, 0x00040000u },
+    { 0x80000000u, -12, 0x00080000u },
+    { 0x80000000u, -11, 0x00100000u },
+    { 0x80000000u, -10, 0x00200000u },
+    { 0x80000000u,  -9, 0x00400000u },
+    { 0x80000000u,  -8, 0x00800000u },
+    { 0x80000000u,  -7, 0x01000000u },
+    { 0x80000000u,  -6, 0x02000000u },
+    { 0x80000000u,  -5, 0x04000000u },
+    { 0x80000000u,  -4, 0x08000000u },
+    { 0x80000000u,  -3, 0x10000000u },
+    { 0x80000000u,  -2, 0x20000000u },
+    { 0x80000000u,  -1, 0x40000000u },
+    { 0x80000000u,   0, 0x80000000u },
+    { 0x80000000u,   1, 0xFFFFFFFFu },
+    { 0x80000000u,   2, 0xFFFFFFFFu },
+    { 0x80000000u,   3, 0xFFFFFFFFu },
+    { 0x80000000u,   4, 0xFFFFFFFFu },
+    { 0x80000000u,   5, 0xFFFFFFFFu },
+    { 0x80000000u,   6, 0xFFFFFFFFu },
+    { 0x80000000u,   7, 0xFFFFFFFFu },
+    { 0x80000000u,   8, 0xFFFFFFFFu },
+    { 0x80000000u,   9, 0xFFFFFFFFu },
+    { 0x80000000u,  10, 0xFFFFFFFFu },
+    { 0x80000000u,  11, 0xFFFFFFFFu },
+    { 0x80000000u,  12, 0xFFFFFFFFu },
+    { 0x80000000u,  13, 0xFFFFFFFFu },
+    { 0x80000000u,  14, 0xFFFFFFFFu },
+    { 0x80000000u,  15, 0xFFFFFFFFu },
+    { 0x80000000u,  16, 0xFFFFFFFFu },
+    { 0x80000000u,  17, 0xFFFFFFFFu },
+    { 0x80000000u,  18, 0xFFFFFFFFu },
+    { 0x80000000u,  19, 0xFFFFFFFFu },
+    { 0x80000000u,  20, 0xFFFFFFFFu },
+    { 0x80000000u,  21, 0xFFFFFFFFu },
+    { 0x80000000u,  22, 0xFFFFFFFFu },
+    { 0x80000000u,  23, 0xFFFFFFFFu },
+    { 0x80000000u,  24, 0xFFFFFFFFu },
+    { 0x80000000u,  25, 0xFFFFFFFFu },
+    { 0x80000000u,  26, 0xFFFFFFFFu },
+    { 0x80000000u,  27, 0xFFFFFFFFu },
+    { 0x80000000u,  28, 0xFFFFFFFFu },
+    { 0x80000000u,  29, 0xFFFFFFFFu },
+    { 0x80000000u,  30, 0xFFFFFFFFu },
+    { 0x80000000u,  31, 0xFFFFFFFFu },
+    { 0x89ABCDEFu, -31, 0x00000001u },
+    { 0x89ABCDEFu, -30, 0x00000002u },
+    { 0x89ABCDEFu, -29, 0x00000004u },
+    { 0x89ABCDEFu, -28, 0x00000008u },
+    { 0x89ABCDEFu, -27, 0x00000011u },
+    { 0x89ABCDEFu, -26, 0x00000022u },
+    { 0x89ABCDEFu, -25, 0x00000044u },
+    { 0x89ABCDEFu, -24, 0x00000089u },
+    { 0x89ABCDEFu, -23, 0x00000113u },
+    { 0x89ABCDEFu, -22, 0x00000226u },
+    { 0x89ABCDEFu, -21, 0x0000044Du },
+    { 0x89ABCDEFu, -20, 0x0000089Au },
+    { 0x89ABCDEFu, -19, 0x00001135u },
+    { 0x89ABCDEFu, -18, 0x0000226Au },
+    { 0x89ABCDEFu, -17, 0x000044D5u },
+    { 0x89ABCDEFu, -16, 0x000089ABu },
+    { 0x89ABCDEFu, -15, 0x00011357u },
+    { 0x89ABCDEFu, -14, 0x000226AFu },
+    { 0x89ABCDEFu, -13, 0x00044D5Eu },
+    { 0x89ABCDEFu, -12, 0x00089ABCu },
+    { 0x89ABCDEFu, -11, 0x00113579u },
+    { 0x89ABCDEFu, -10, 0x00226AF3u },
+    { 0x89ABCDEFu,  -9, 0x0044D5E6u },
+    { 0x89ABCDEFu,  -8, 0x0089ABCDu },
+    { 0x89ABCDEFu,  -7, 0x0113579Bu },
+    { 0x89ABCDEFu,  -6, 0x0226AF37u },
+    { 0x89ABCDEFu,  -5, 0x044D5E6Fu },
+    { 0x89ABCDEFu,  -4, 0x089ABCDEu },
+    { 0x89ABCDEFu,  -3, 0x113579BDu },
+    { 0x89ABCDEFu,  -2, 0x226AF37Bu },
+    { 0x89ABCDEFu,  -1, 0x44D5E6F7u },
+    { 0x89ABCDEFu,   0, 0x89ABCDEFu },
+    { 0x89ABCDEFu,   1, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,   2, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,   3, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,   4, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,   5, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,   6, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,   7, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,   8, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,   9, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  10, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  11, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  12, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  13, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  14, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  15, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  16, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  17, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  18, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  19, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  20, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  21, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  22, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  23, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  24, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  25, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  26, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  27, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  28, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  29, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  30, 0xFFFFFFFFu },
+    { 0x89ABCDEFu,  31, 0xFFFFFFFFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitSat_u32s8_u32 vectors**
+ *
+ * The test runs the 316 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91002, SWS_Bfx_00134, SWS_Bfx_00135
+ */
+void test__Bfx_ShiftBitSat_u32s8_u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitSat_u32s8_u32 ) / sizeof( ShiftBitSat_u32s8_u32[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( ShiftBitSat_u32s8_u32[ i ].Expected, Bfx_ShiftBitSat_u32s8_u32( ShiftBitSat_u32s8_u32[ i ].Data, ShiftBitSat_u32s8_u32[ i ].ShiftCnt ), Vector( "Bfx_ShiftBitSat_u32s8_u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    sint32 Data;
+    sint8 ShiftCnt;
+    sint32 Expected;
+} ShiftBitSat_s32s8_s32[] = {
+    {  1431655766,   2,  2147483647 },
+    {           0, -31,           0 },
+    {           0, -30,           0 },
+    {           0, -29,           0 },
+    {           0, -28,           0 },
+    {           0, -27,           0 },
+    {           0, -26,           0 },
+    {           0, -25,           0 },
+    {           0, -24,           0 },
+    {           0, -23,           0 },
+    {           0, -22,           0 },
+    {           0, -21,           0 },
+    {           0, -20,           0 },
+    {           0, -19,           0 },
+    {           0, -18,           0 },
+    {           0, -17,           0 },
+    {           0, -16,           0 },
+    {           0, -15,           0 },
+    {           0, -14,           0 },
+    {           0, -13,           0 },
+    {           0, -12,           0 },
+    {           0, -11,           0 },
+    {           0, -10,           0 },
+    {           0,  -9,           0 },
+    {           0,  -8,           0 },
+    {           0,  -7,           0 },
+    {           0,  -6,           0 },
+    {           0,  -5,           0 },
+    {           0,  -4,           0 },
+    {           0,  -3,           0 },
+    {           0,  -2,           0 },
+    {           0,  -1,           0 },
+    {           0,   0,           0 },
+    {           0,   1,           0 },
+    {           0,   2,           0 },
+    {           0,   3,           0 },
+    {           0,   4,           0 },
+    {           0,   5,           0 },
+    {           0,   6,           0 },
+    {           0,   7,           0 },
+    {           0,   8,           0 },
+    {           0,   9,           0 },
+    {           0,  10,           0 },
+    {           0,  11,           0 },
+    {           0,  12,           0 },
+    {           0,  13,           0 },
+    {           0,  14,           0 },
+    {           0,  15,           0 },
+    {           0,  16,           0 },
+    {           0,  17,           0 },
+    {           0,  18,           0 },
+    {           0,  19,           0 },
+    {           0,  20,           0 },
+    {           0,  21,           0 },
+    {           0,  22,           0 },
+    {           0,  23,           0 },
+    {           0,  24,           0 },
+    {           0,  25,           0 },
+    {           0,  26,           0 },
+    {           0,  27,           0 },
+    {           0,  28,           0 },
+    {           0,  29,           0 },
+    {           0,  30,           0 },
+    {           0,  31,           0 },
+    {          -1, -31,          -1 },
+    {          -1, -30,          -1 },
+    {          -1, -29,          -1 },
+    {          -1, -28,          -1 },
+    {          -1, -27,          -1 },
+    {          -1, -26,          -1 },
+    {          -1, -25,          -1 },
+    {          -1, -24,          -1 },
+    {          -1, -23,          -1 },
+    {          -1, -22,          -1 },
+    {          -1, -21,          -1 },
+    {          -1, -20,          -1 },
+    {          -1, -19,          -1 },
+    {          -1, -18,          -1 },
+    {          -1, -17,          -1 },
+    {          -1, -16,          -1 },
+    {          -1, -15,          -1 },
+    {          -1, -14,          -1 },
+    {          -1, -13,          -1 },
+    {          -1, -12,          -1 },
+    {          -1, -11,          -1 },
+    {          -1, -10,          -1 },
+    {          -1,  -9,          -1 },
+    {          -1,  -8,          -1 },
+    {          -1,  -7,          -1 },
+    {          -1,  -6,          -1 },
+    {          -1,  -5,          -1 },
+    {          -1,  -4,          -1 },
+    {          -1,  -3,          -1 },
+    {          -1,  -2,          -1 },
+    {          -1,  -1,          -1 },
+    {          -1,   0,          -1 },
+    {          -1,   1,          -2 },
+    {          -1,   2,          -4 },
+    {          -1,   3,          -8 },
+    {          -1,   4,         -16 },
+    {          -1,   5,         -32 },
+    {          -1,   6,         -64 },
+    {          -1,   7,        -128 },
+    {          -1,   8,        -256 },
+    {          -1,   9,        -512 },
+    {          -1,  10,       -1024 },
+    {          -1,  11,       -2048 },
+    {          -1,  12,       -4096 },
+    {          -1,  13,       -8192 },
+    {          -1,  14,      -16384 },
+    {          -1,  15,      -32768 },
+    {          -1,  16,      -65536 },
+    {          -1,  17,     -131072 },
+    {          -1,  18,     -262144 },
+    {          -1,  19,     -524288 },
+    {          -1,  20,    -1048576 },
+    {          -1,  21,    -2097152 },
+    {          -1,  22,    -4194304 },
+    {          -1,  23,    -8388608 },
+    {          -1,  24,   -16777216 },
+    {          -1,  25,   -33554432 },
+    {          -1,  26,   -67108864 },
+    {          -1,  27,  -134217728 },
+    {          -1,  28,  -268435456 },
+    {          -1,  29,  -536870912 },
+    {          -1,  30, -1073741824 },
+    {          -1,  31,   INT32_MIN },
+    {           1, -31,           0 },
+    {           1, -30,           0 },
+    {           1, -29,           0 },
+    {           1, -28,           0 },
+    {           1, -27,           0 },
+    {           1, -26,           0 },
+    {           1, -25,           0 },
+    {           1, -24,           0 },
+    {           1, -23,           0 },
+    {           1, -22,           0 },
+    {           1, -21,           0 },
+    {           1, -20,           0 },
+    {           1, -19,           0 },
+    {           1, -18,           0 },
+    {           1, -17,           0 },
+    {           1, -16,           0 },
+    {           1, -15,           0 },
+    {           1, -14,           0 },
+    {           1, -13,           0 },
+    {           1, -12,           0 },
+    {           1, -11,           0 },
+    {           1, -10,           0 },
+    {           1,  -9,           0 },
+    {           1,  -8,           0 },
+    {           1,  -7,           0 },
+    {           1,  -6,           0 },
+    {           1,  -5,           0 },
+    {           1,  -4,           0 },
+    {           1,  -3,           0 },
+    {           1,  -2,           0 },
+    {           1,  -1,           0 },
+    {           1,   0,           1 },
+    {           1,   1,           2 },
+    {           1,   2,           4 },
+    {           1,   3,           8 },
+    {           1,   4,          16 },
+    {           1,   5,          32 },
+    {           1,   6,          64 },
+    {           1,   7,         128 },
+    {           1,   8,         256 },
+    {           1,   9,         512 },
+    {           1,  10,        1024 },
+    {           1,  11,        2048 },
+    {           1,  12,        4096 },
+    {           1,  13,        8192 },
+    {           1,  14,       16384 },
+    {           1,  15,       32768 },
+    {           1,  16,       65536 },
+    {           1,  17,      131072 },
+    {           1,  18,      262144 },
+    {           1,  19,      524288 },
+    {           1,  20,     1048576 },
+    {           1,  21,     2097152 },
+    {           1,  22,     4194304 },
+    {           1,  23,     8388608 },
+    {           1,  24,    16777216 },
+    {           1,  25,    33554432 },
+    {           1,  26,    67108864 },
+    {           1,  27,   134217728 },
+    {           1,  28,   268435456 },
+    {           1,  29,   536870912 },
+    {           1,  30,  1073741824 },
+    {           1,  31,  2147483647 },
+    {   INT32_MIN, -31,          -1 },
+    {   INT32_MIN, -30,          -2 },
+    {   INT32_MIN, -29,          -4 },
+    {   INT32_MIN, -28,          -8 },
+    {   INT32_MIN, -27,         -16 },
+    {   INT32_MIN, -26,         -32 },
+    {   INT32_MIN, -25,         -64 },
+    {   INT32_MIN, -24,        -128 },
+    {   INT32_MIN, -23,        -256 },
+    {   INT32_MIN, -22,        -512 },
+    {   INT32_MIN, -21,       -1024 },
+    {   INT32_MIN, -20,       -2048 },
+    {   INT32_MIN, -19,       -4096 },
+    {   INT32_MIN, -18,       -8192 },
+    {   INT32_MIN, -17,      -16384 },
+    {   INT32_MIN, -16,      -32768 },
+    {   INT32_MIN, -15,      -65536 },
+    {   INT32_MIN, -14,     -131072 },
+    {   INT32_MIN, -13,     -262144 },
+    {   INT32_MIN, -12,     -524288 },
+    {   INT32_MIN, -11,    -1048576 },
+    {   INT32_MIN, -10,    -2097152 },
+    {   INT32_MIN,  -9,    -4194304 },
+    {   INT32_MIN,  -8,    -8388608 },
+    {   INT32_MIN,  -7,   -16777216 },
+    {   INT32_MIN,  -6,   -33554432 },
+    {   INT32_MIN,  -5,   -67108864 },
+    {   INT32_MIN,  -4,  -134217728 },
+    {   INT32_MIN,  -3,  -268435456 },
+    {   INT32_MIN,  -2,  -536870912 },
+    {   INT32_MIN,  -1, -1073741824 },
+    {   INT32_MIN,   0,   INT32_MIN },
+    {   INT32_MIN,   1,   INT32_MIN },
+    {   INT32_MIN,   2,   INT32_MIN },
+    {   INT32_MIN,   3,   INT32_MIN },
+    {   INT32_MIN,   4,   INT32_MIN },
+    {   INT32_MIN,   5,   INT32_MIN },
+    {   INT32_MIN,   6,   INT32_MIN },
+    {   INT32_MIN,   7,   INT32_MIN },
+    {   INT32_MIN,   8,   INT32_MIN },
+    {   INT32_MIN,   9,   INT32_MIN },
+    {   INT32_MIN,  10,   INT32_MIN },
+    {   INT32_MIN,  11,   INT32_MIN },
+    {   INT32_MIN,  12,   INT32_MIN },
+    {   INT32_MIN,  13,   INT32_MIN },
+    {   INT32_MIN,  14,   INT32_MIN },
+    {   INT32_MIN,  15,   INT32_MIN },
+    {   INT32_MIN,  16,   INT32_MIN },
+    {   INT32_MIN,  17,   INT32_MIN },
+    {   INT32_MIN,  18,   INT32_MIN },
+    {   INT32_MIN,  19,   INT32_MIN },
+    {   INT32_MIN,  20,   INT32_MIN },
+    {   INT32_MIN,  21,   INT32_MIN },
+    {   INT32_MIN,  22,   INT32_MIN },
+    {   INT32_MIN,  23,   INT32_MIN },
+    {   INT32_MIN,  24,   INT32_MIN },
+    {   INT32_MIN,  25,   INT32_MIN },
+    {   INT32_MIN,  26,   INT32_MIN },
+    {   INT32_MIN,  27,   INT32_MIN },
+    {   INT32_MIN,  28,   INT32_MIN },
+    {   INT32_MIN,  29,   INT32_MIN },
+    {   INT32_MIN,  30,   INT32_MIN },
+    {   INT32_MIN,  31,   INT32_MIN },
+    {  2147483647, -31,           0 },
+    {  2147483647, -30,           1 },
+    {  2147483647, -29,           3 },
+    {  2147483647, -28,           7 },
+    {  2147483647, -27,          15 },
+    {  2147483647, -26,          31 },
+    {  2147483647, -25,          63 },
+    {  2147483647, -24,         127 },
+    {  2147483647, -23,         255 },
+    {  2147483647, -22,         511 },
+    {  2147483647, -21,        1023 },
+    {  2147483647, -20,        2047 },
+    {  2147483647, -19,        4095 },
+    {  2147483647, -18,        8191 },
+    {  2147483647, -17,       16383 },
+    {  2147483647, -16,       32767 },
+    {  2147483647, -15,       65535 },
+    {  2147483647, -14,      131071 },
+    {  2147483647, -13,      262143 },
+    {  2147483647, -12,      524287 },
+    {  2147483647, -11,     1048575 },
+    {  2147483647, -10,     2097151 },
+    {  2147483647,  -9,     4194303 },
+    {  2147483647,  -8,     8388607 },
+    {  2147483647,  -7,    16777215 },
+    {  2147483647,  -6,    33554431 },
+    {  2147483647,  -5,    67108863 },
+    {  2147483647,  -4,   134217727 },
+    {  2147483647,  -3,   268435455 },
+    {  2147483647,  -2,   536870911 },
+    {  2147483647,  -1,  1073741823 },
+    {  2147483647,   0,  2147483647 },
+    {  2147483647,   1,  2147483647 },
+    {  2147483647,   2,  2147483647 },
+    {  2147483647,   3,  2147483647 },
+    {  2147483647,   4,  2147483647 },
+    {  2147483647,   5,  2147483647 },
+    {  2147483647,   6,  2147483647 },
+    {  2147483647,   7,  2147483647 },
+    {  2147483647,   8,  2147483647 },
+    {  2147483647,   9,  2147483647 },
+    {  2147483647,  10,  2147483647 },
+    {  2147483647,  11,  2147483647 },
+    {  2147483647,  12,  2147483647 },
+    {  2147483647,  13,  2147483647 },
+    {  2147483647,  14,  2147483647 },
+    {  2147483647,  15,  2147483647 },
+    {  2147483647,  16,  2147483647 },
+    {  2147483647,  17,  2147483647 },
+    {  2147483647,  18,  2147483647 },
+    {  2147483647,  19,  2147483647 },
+    {  2147483647,  20,  2147483647 },
+    {  2147483647,  21,  2147483647 },
+    {  2147483647,  22,  2147483647 },
+    {  2147483647,  23,  2147483647 },
+    {  2147483647,  24,  2147483647 },
+    {  2147483647,  25,  2147483647 },
+    {  2147483647,  26,  2147483647 },
+    {  2147483647,  27,  2147483647 },
+    {  2147483647,  28,  2147483647 },
+    {  2147483647,  29,  2147483647 },
+    {  2147483647,  30,  2147483647 },
+    {  2147483647,  31,  2147483647 },
+    { -1985229329, -31,          -1 },
+    { -1985229329, -30,          -2 },
+    { -1985229329, -29,          -4 },
+    { -1985229329, -28,          -8 },
+    { -1985229329, -27,         -15 },
+    { -1985229329, -26,         -30 },
+    { -1985229329, -25,         -60 },
+    { -1985229329, -24,        -119 },
+    { -1985229329, -23,        -237 },
+    { -1985229329, -22,        -474 },
+    { -1985229329, -21,        -947 },
+    { -1985229329, -20,       -1894 },
+    { -1985229329, -19,       -3787 },
+    { -1985229329, -18,       -7574 },
+    { -1985229329, -17,      -15147 },
+    { -1985229329, -16,      -30293 },
+    { -1985229329, -15,      -60585 },
+    { -1985229329, -14,     -121169 },
+    { -1985229329, -13,     -242338 },
+    { -1985229329, -12,     -484676 },
+    { -1985229329, -11,     -969351 },
+    { -1985229329, -10,    -1938701 },
+    { -1985229329,  -9,    -3877402 },
+    { -1985229329,  -8,    -7754803 },
+    { -1985229329,  -7,   -15509605 },
+    { -1985229329,  -6,   -31019209 },
+    { -1985229329,  -5,   -62038417 },
+    { -1985229329,  -4,  -124076834 },
+    { -1985229329,  -3,  -248153667 },
+    { -1985229329,  -2,  -496307333 },
+    { -1985229329,  -1,  -992614665 },
+    { -1985229329,   0, -1985229329 },
+    { -1985229329,   1,   INT32_MIN },
+    { -1985229329,   2,   INT32_MIN },
+    { -1985229329,   3,   INT32_MIN },
+    { -1985229329,   4,   INT32_MIN },
+    { -1985229329,   5,   INT32_MIN },
+    { -1985229329,   6,   INT32_MIN },
+    { -1985229329,   7,   INT32_MIN },
+    { -1985229329,   8,   INT32_MIN },
+    { -1985229329,   9,   INT32_MIN },
+    { -1985229329,  10,   INT32_MIN },
+    { -1985229329,  11,   INT32_MIN },
+    { -1985229329,  12,   INT32_MIN },
+    { -1985229329,  13,   INT32_MIN },
+    { -1985229329,  14,   INT32_MIN },
+    { -1985229329,  15,   INT32_MIN },
+    { -1985229329,  16,   INT32_MIN },
+    { -1985229329,  17,   INT32_MIN },
+    { -1985229329,  18,   INT32_MIN },
+    { -1985229329,  19,   INT32_MIN },
+    { -1985229329,  20,   INT32_MIN },
+    { -1985229329,  21,   INT32_MIN },
+    { -1985229329,  22,   INT32_MIN },
+    { -1985229329,  23,   INT32_MIN },
+    { -1985229329,  24,   INT32_MIN },
+    { -1985229329,  25,   INT32_MIN },
+    { -1985229329,  26,   INT32_MIN },
+    { -1985229329,  27,   INT32_MIN },
+    { -1985229329,  28,   INT32_MIN },
+    { -1985229329,  29,   INT32_MIN },
+    { -1985229329,  30,   INT32_MIN },
+    { -1985229329,  31,   INT32_MIN },
+    { -1431655766, -31,          -1 },
+    { -1431655766, -30,          -2 },
+    { -1431655766, -29,          -3 },
+    { -1431655766, -28,          -6 },
+    { -1431655766, -27,         -11 },
+    { -1431655766, -26,         -22 },
+    { -1431655766, -25,         -43 },
+    { -1431655766, -24,         -86 },
+    { -1431655766, -23,        -171 },
+    { -1431655766, -22,        -342 },
+    { -1431655766, -21,        -683 },
+    { -1431655766, -20,       -1366 },
+    { -1431655766, -19,       -2731 },
+    { -1431655766, -18,       -5462 },
+    { -1431655766, -17,      -10923 },
+    { -1431655766, -16,      -21846 },
+    { -1431655766, -15,      -43691 },
+    { -1431655766, -14,      -87382 },
+    { -1431655766, -13,     -174763 },
+    { -1431655766, -12,     -349526 },
+    { -1431655766, -11,     -699051 },
+    { -1431655766, -10,    -1398102 },
+    { -1431655766,  -9,    -2796203 },
+    { -1431655766,  -8,    -5592406 },
+    { -1431655766,  -7,   -11184811 },
+    { -1431655766,  -6,   -22369622 },
+    { -1431655766,  -5,   -44739243 },
+    { -1431655766,  -4,   -89478486 },
+    { -1431655766,  -3,  -178956971 },
+    { -1431655766,  -2,  -357913942 },
+    { -1431655766,  -1,  -715827883 },
+    { -1431655766,   0, -1431655766 },
+    { -1431655766,   1,   INT32_MIN },
+    { -1431655766,   2,   INT32_MIN },
+    { -1431655766,   3,   INT32_MIN },
+    { -1431655766,   4,   INT32_MIN },
+    { -1431655766,   5,   INT32_MIN },
+    { -1431655766,   6,   INT32_MIN },
+    { -1431655766,   7,   INT32_MIN },
+    { -1431655766,   8,   INT32_MIN },
+    { -1431655766,   9,   INT32_MIN },
+    { -1431655766,  10,   INT32_MIN },
+    { -1431655766,  11,   INT32_MIN },
+    { -1431655766,  12,   INT32_MIN },
+    { -1431655766,  13,   INT32_MIN },
+    { -1431655766,  14,   INT32_MIN },
+    { -1431655766,  15,   INT32_MIN },
+    { -1431655766,  16,   INT32_MIN },
+    { -1431655766,  17,   INT32_MIN },
+    { -1431655766,  18,   INT32_MIN },
+    { -1431655766,  19,   INT32_MIN },
+    { -1431655766,  20,   INT32_MIN },
+    { -1431655766,  21,   INT32_MIN },
+    { -1431655766,  22,   INT32_MIN },
+    { -1431655766,  23,   INT32_MIN },
+    { -1431655766,  24,   INT32_MIN },
+    { -1431655766,  25,   INT32_MIN },
+    { -1431655766,  26,   INT32_MIN },
+    { -1431655766,  27,   INT32_MIN },
+    { -1431655766,  28,   INT32_MIN },
+    { -1431655766,  29,   INT32_MIN },
+    { -1431655766,  30,   INT32_MIN },
+    { -1431655766,  31,   INT32_MIN },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitSat_s32s8_s32 vectors**
+ *
+ * The test runs the 442 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91002, SWS_Bfx_00134, SWS_Bfx_00135
+ */
+void test__Bfx_ShiftBitSat_s32s8_s32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitSat_s32s8_s32 ) / sizeof( ShiftBitSat_s32s8_s32[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_INT32_MESSAGE( ShiftBitSat_s32s8_s32[ i ].Expected, Bfx_ShiftBitSat_s32s8_s32( ShiftBitSat_s32s8_s32[ i ].Data, ShiftBitSat_s32s8_s32[ i ].ShiftCnt ), Vector( "Bfx_ShiftBitSat_s32s8_s32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 Expected;
+} CountLeadingOnes_u32[] = {
+    { 0x00000000u,  0u },
+    { 0xFFFFFFFFu, 32u },
+    { 0x89ABCDEFu,  1u },
+    { 0x00000001u,  0u },
+    { 0x00000002u,  0u },
+    { 0x00000004u,  0u },
+    { 0x00000008u,  0u },
+    { 0x00000010u,  0u },
+    { 0x00000020u,  0u },
+    { 0x00000040u,  0u },
+    { 0x00000080u,  0u },
+    { 0x00000100u,  0u },
+    { 0x00000200u,  0u },
+    { 0x00000400u,  0u },
+    { 0x00000800u,  0u },
+    { 0x00001000u,  0u },
+    { 0x00002000u,  0u },
+    { 0x00004000u,  0u },
+    { 0x00008000u,  0u },
+    { 0x00010000u,  0u },
+    { 0x00020000u,  0u },
+    { 0x00040000u,  0u },
+    { 0x00080000u,  0u },
+    { 0x00100000u,  0u },
+    { 0x00200000u,  0u },
+    { 0x00400000u,  0u },
+    { 0x00800000u,  0u },
+    { 0x01000000u,  0u },
+    { 0x02000000u,  0u },
+    { 0x04000000u,  0u },
+    { 0x08000000u,  0u },
+    { 0x10000000u,  0u },
+    { 0x20000000u,  0u },
+    { 0x40000000u,  0u },
+    { 0x80000000u,  1u },
+    { 0x00000000u,  0u },
+    { 0x80000000u,  1u },
+    { 0xC0000000u,  2u },
+    { 0xE0000000u,  3u },
+    { 0xF0000000u,  4u },
+    { 0xF8000000u,  5u },
+    { 0xFC000000u,  6u },
+    { 0xFE000000u,  7u },
+    { 0xFF000000u,  8u },
+    { 0xFF800000u,  9u },
+    { 0xFFC00000u, 10u },
+    { 0xFFE00000u, 11u },
+    { 0xFFF00000u, 12u },
+    { 0xFFF80000u, 13u },
+    { 0xFFFC0000u, 14u },
+    { 0xFFFE0000u, 15u },
+    { 0xFFFF0000u, 16u },
+    { 0xFFFF8000u, 17u },
+    { 0xFFFFC000u, 18u },
+    { 0xFFFFE000u, 19u },
+    { 0xFFFFF000u, 20u },
+    { 0xFFFFF800u, 21u },
+    { 0xFFFFFC00u, 22u },
+    { 0xFFFFFE00u, 23u },
+    { 0xFFFFFF00u, 24u },
+    { 0xFFFFFF80u, 25u },
+    { 0xFFFFFFC0u, 26u },
+    { 0xFFFFFFE0u, 27u },
+    { 0xFFFFFFF0u, 28u },
+    { 0xFFFFFFF8u, 29u },
+    { 0xFFFFFFFCu, 30u },
+    { 0xFFFFFFFEu, 31u },
+    { 0xFFFFFFFFu, 32u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CountLeadingOnes_u32 vectors**
+ *
+ * The test runs the 68 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91003, SWS_Bfx_00137
+ */
+void test__Bfx_CountLeadingOnes_u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CountLeadingOnes_u32 ) / sizeof( CountLeadingOnes_u32[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( CountLeadingOnes_u32[ i ].Expected, Bfx_CountLeadingOnes_u32( CountLeadingOnes_u32[ i ].Data ), Vector( "Bfx_CountLeadingOnes_u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    sint32 Data;
+    uint8 Expected;
+} CountLeadingSigns_s32[] = {
+    {           0, 31u },
+    {          -1, 31u },
+    { -1985229329,  0u },
+    {  2147483647,  0u },
+    {           1, 30u },
+    {           2, 29u },
+    {           4, 28u },
+    {           8, 27u },
+    {          16, 26u },
+    {          32, 25u },
+    {          64, 24u },
+    {         128, 23u },
+    {         256, 22u },
+    {         512, 21u },
+    {        1024, 20u },
+    {        2048, 19u },
+    {        4096, 18u },
+    {        8192, 17u },
+    {       16384, 16u },
+    {       32768, 15u },
+    {       65536, 14u },
+    {      131072, 13u },
+    {      262144, 12u },
+    {      524288, 11u },
+    {     1048576, 10u },
+    {     2097152,  9u },
+    {     4194304,  8u },
+    {     8388608,  7u },
+    {    16777216,  6u },
+    {    33554432,  5u },
+    {    67108864,  4u },
+    {   134217728,  3u },
+    {   268435456,  2u },
+    {   536870912,  1u },
+    {  1073741824,  0u },
+    {   INT32_MIN,  0u },
+    {           0, 31u },
+    {           1, 30u },
+    {           3, 29u },
+    {           7, 28u },
+    {          15, 27u },
+    {          31, 26u },
+    {          63, 25u },
+    {         127, 24u },
+    {         255, 23u },
+    {         511, 22u },
+    {        1023, 21u },
+    {        2047, 20u },
+    {        4095, 19u },
+    {        8191, 18u },
+    {       16383, 17u },
+    {       32767, 16u },
+    {       65535, 15u },
+    {      131071, 14u },
+    {      262143, 13u },
+    {      524287, 12u },
+    {     1048575, 11u },
+    {     2097151, 10u },
+    {     4194303,  9u },
+    {     8388607,  8u },
+    {    16777215,  7u },
+    {    33554431,  6u },
+    {    67108863,  5u },
+    {   134217727,  4u },
+    {   268435455,  3u },
+    {   536870911,  2u },
+    {  1073741823,  1u },
+    {  2147483647,  0u },
+    {          -1, 31u },
+    {           0, 31u },
+    {   INT32_MIN,  0u },
+    { -1073741824,  1u },
+    {  -536870912,  2u },
+    {  -268435456,  3u },
+    {  -134217728,  4u },
+    {   -67108864,  5u },
+    {   -33554432,  6u },
+    {   -16777216,  7u },
+    {    -8388608,  8u },
+    {    -4194304,  9u },
+    {    -2097152, 10u },
+    {    -1048576, 11u },
+    {     -524288, 12u },
+    {     -262144, 13u },
+    {     -131072, 14u },
+    {      -65536, 15u },
+    {      -32768, 16u },
+    {      -16384, 17u },
+    {       -8192, 18u },
+    {       -4096, 19u },
+    {       -2048, 20u },
+    {       -1024, 21u },
+    {        -512, 22u },
+    {        -256, 23u },
+    {        -128, 24u },
+    {         -64, 25u },
+    {         -32, 26u },
+    {         -16, 27u },
+    {          -8, 28u },
+    {          -4, 29u },
+    {          -2, 30u },
+    {          -1, 31u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CountLeadingSigns_s32 vectors**
+ *
+ * The test runs the 102 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91004, SWS_Bfx_00139
+ */
+void test__Bfx_CountLeadingSigns_s32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CountLeadingSigns_s32 ) / sizeof( CountLeadingSigns_s32[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( CountLeadingSigns_s32[ i ].Expected, Bfx_CountLeadingSigns_s32( CountLeadingSigns_s32[ i ].Data ), Vector( "Bfx_CountLeadingSigns_s32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 Expected;
+} CountLeadingZeros_u32[] = {
+    { 0x00000000u, 32u },
+    { 0xFFFFFFFFu,  0u },
+    { 0x89ABCDEFu,  0u },
+    { 0x00000001u, 31u },
+    { 0x00000002u, 30u },
+    { 0x00000004u, 29u },
+    { 0x00000008u, 28u },
+    { 0x00000010u, 27u },
+    { 0x00000020u, 26u },
+    { 0x00000040u, 25u },
+    { 0x00000080u, 24u },
+    { 0x00000100u, 23u },
+    { 0x00000200u, 22u },
+    { 0x00000400u, 21u },
+    { 0x00000800u, 20u },
+    { 0x00001000u, 19u },
+    { 0x00002000u, 18u },
+    { 0x00004000u, 17u },
+    { 0x00008000u, 16u },
+    { 0x00010000u, 15u },
+    { 0x00020000u, 14u },
+    { 0x00040000u, 13u },
+    { 0x00080000u, 12u },
+    { 0x00100000u, 11u },
+    { 0x00200000u, 10u },
+    { 0x00400000u,  9u },
+    { 0x00800000u,  8u },
+    { 0x01000000u,  7u },
+    { 0x02000000u,  6u },
+    { 0x04000000u,  5u },
+    { 0x08000000u,  4u },
+    { 0x10000000u,  3u },
+    { 0x20000000u,  2u },
+    { 0x40000000u,  1u },
+    { 0x80000000u,  0u },
+    { 0x00000000u, 32u },
+    { 0x00000001u, 31u },
+    { 0x00000003u, 30u },
+    { 0x00000007u, 29u },
+    { 0x0000000Fu, 28u },
+    { 0x0000001Fu, 27u },
+    { 0x0000003Fu, 26u },
+    { 0x0000007Fu, 25u },
+    { 0x000000FFu, 24u },
+    { 0x000001FFu, 23u },
+    { 0x000003FFu, 22u },
+    { 0x000007FFu, 21u },
+    { 0x00000FFFu, 20u },
+    { 0x00001FFFu, 19u },
+    { 0x00003FFFu, 18u },
+    { 0x00007FFFu, 17u },
+    { 0x0000FFFFu, 16u },
+    { 0x0001FFFFu, 15u },
+    { 0x0003FFFFu, 14u },
+    { 0x0007FFFFu, 13u },
+    { 0x000FFFFFu, 12u },
+    { 0x001FFFFFu, 11u },
+    { 0x003FFFFFu, 10u },
+    { 0x007FFFFFu,  9u },
+    { 0x00FFFFFFu,  8u },
+    { 0x01FFFFFFu,  7u },
+    { 0x03FFFFFFu,  6u },
+    { 0x07FFFFFFu,  5u },
+    { 0x0FFFFFFFu,  4u },
+    { 0x1FFFFFFFu,  3u },
+    { 0x3FFFFFFFu,  2u },
+    { 0x7FFFFFFFu,  1u },
+    { 0xFFFFFFFFu,  0u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CountLeadingZeros_u32 vectors**
+ *
+ * The test runs the 68 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91005, SWS_Bfx_00141
+ */
+void test__Bfx_CountLeadingZeros_u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CountLeadingZeros_u32 ) / sizeof( CountLeadingZeros_u32[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( CountLeadingZeros_u32[ i ].Expected, Bfx_CountLeadingZeros_u32( CountLeadingZeros_u32[ i ].Data ), Vector( "Bfx_CountLeadingZeros_u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint8 Expected;
+} CountTrailingZeros_u32[] = {
+    { 0x00000000u, 32u },
+    { 0xFFFFFFFFu,  0u },
+    { 0x89ABCDEFu,  0u },
+    { 0x00000001u,  0u },
+    { 0x00000002u,  1u },
+    { 0x00000004u,  2u },
+    { 0x00000008u,  3u },
+    { 0x00000010u,  4u },
+    { 0x00000020u,  5u },
+    { 0x00000040u,  6u },
+    { 0x00000080u,  7u },
+    { 0x00000100u,  8u },
+    { 0x00000200u,  9u },
+    { 0x00000400u, 10u },
+    { 0x00000800u, 11u },
+    { 0x00001000u, 12u },
+    { 0x00002000u, 13u },
+    { 0x00004000u, 14u },
+    { 0x00008000u, 15u },
+    { 0x00010000u, 16u },
+    { 0x00020000u, 17u },
+    { 0x00040000u, 18u },
+    { 0x00080000u, 19u },
+    { 0x00100000u, 20u },
+    { 0x00200000u, 21u },
+    { 0x00400000u, 22u },
+    { 0x00800000u, 23u },
+    { 0x01000000u, 24u },
+    { 0x02000000u, 25u },
+    { 0x04000000u, 26u },
+    { 0x08000000u, 27u },
+    { 0x10000000u, 28u },
+    { 0x20000000u, 29u },
+    { 0x40000000u, 30u },
+    { 0x80000000u, 31u },
+    { 0x00000000u, 32u },
+    { 0x80000000u, 31u },
+    { 0xC0000000u, 30u },
+    { 0xE0000000u, 29u },
+    { 0xF0000000u, 28u },
+    { 0xF8000000u, 27u },
+    { 0xFC000000u, 26u },
+    { 0xFE000000u, 25u },
+    { 0xFF000000u, 24u },
+    { 0xFF800000u, 23u },
+    { 0xFFC00000u, 22u },
+    { 0xFFE00000u, 21u },
+    { 0xFFF00000u, 20u },
+    { 0xFFF80000u, 19u },
+    { 0xFFFC0000u, 18u },
+    { 0xFFFE0000u, 17u },
+    { 0xFFFF0000u, 16u },
+    { 0xFFFF8000u, 15u },
+    { 0xFFFFC000u, 14u },
+    { 0xFFFFE000u, 13u },
+    { 0xFFFFF000u, 12u },
+    { 0xFFFFF800u, 11u },
+    { 0xFFFFFC00u, 10u },
+    { 0xFFFFFE00u,  9u },
+    { 0xFFFFFF00u,  8u },
+    { 0xFFFFFF80u,  7u },
+    { 0xFFFFFFC0u,  6u },
+    { 0xFFFFFFE0u,  5u },
+    { 0xFFFFFFF0u,  4u },
+    { 0xFFFFFFF8u,  3u },
+    { 0xFFFFFFFCu,  2u },
+    { 0xFFFFFFFEu,  1u },
+    { 0xFFFFFFFFu,  0u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CountTrailingZeros_u32 vectors**
+ *
+ * The test runs the 68 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ */
+void test__Bfx_CountTrailingZeros_u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CountTrailingZeros_u32 ) / sizeof( CountTrailingZeros_u32[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( CountTrailingZeros_u32[ i ].Expected, Bfx_CountTrailingZeros_u32( CountTrailingZeros_u32[ i ].Data ), Vector( "Bfx_CountTrailingZeros_u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint32 Mask;
+    uint32 Expected;
+} DepositBits_u32u32_u32[] = {
+    { 0xFFFFFFFFu, 0x00000000u, 0x00000000u },
+    { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0x55555555u, 0x55555555u },
+    { 0xFFFFFFFFu, 0xAAAAAAAAu, 0xAAAAAAAAu },
+    { 0xFFFFFFFFu, 0x89ABCDEFu, 0x89ABCDEFu },
+    { 0xFFFFFFFFu, 0x00000001u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000002u, 0x00000002u },
+    { 0xFFFFFFFFu, 0x00000004u, 0x00000004u },
+    { 0xFFFFFFFFu, 0x00000008u, 0x00000008u },
+    { 0xFFFFFFFFu, 0x00000010u, 0x00000010u },
+    { 0xFFFFFFFFu, 0x00000020u, 0x00000020u },
+    { 0xFFFFFFFFu, 0x00000040u, 0x00000040u },
+    { 0xFFFFFFFFu, 0x00000080u, 0x00000080u },
+    { 0xFFFFFFFFu, 0x00000100u, 0x00000100u },
+    { 0xFFFFFFFFu, 0x00000200u, 0x00000200u },
+    { 0xFFFFFFFFu, 0x00000400u, 0x00000400u },
+    { 0xFFFFFFFFu, 0x00000800u, 0x00000800u },
+    { 0xFFFFFFFFu, 0x00001000u, 0x00001000u },
+    { 0xFFFFFFFFu, 0x00002000u, 0x00002000u },
+    { 0xFFFFFFFFu, 0x00004000u, 0x00004000u },
+    { 0xFFFFFFFFu, 0x00008000u, 0x00008000u },
+    { 0xFFFFFFFFu, 0x00010000u, 0x00010000u },
+    { 0xFFFFFFFFu, 0x00020000u, 0x00020000u },
+    { 0xFFFFFFFFu, 0x00040000u, 0x00040000u },
+    { 0xFFFFFFFFu, 0x00080000u, 0x00080000u },
+    { 0xFFFFFFFFu, 0x00100000u, 0x00100000u },
+    { 0xFFFFFFFFu, 0x00200000u, 0x00200000u },
+    { 0xFFFFFFFFu, 0x00400000u, 0x00400000u },
+    { 0xFFFFFFFFu, 0x00800000u, 0x00800000u },
+    { 0xFFFFFFFFu, 0x01000000u, 0x01000000u },
+    { 0xFFFFFFFFu, 0x02000000u, 0x02000000u },
+    { 0xFFFFFFFFu, 0x04000000u, 0x04000000u },
+    { 0xFFFFFFFFu, 0x08000000u, 0x08000000u },
+    { 0xFFFFFFFFu, 0x10000000u, 0x10000000u },
+    { 0xFFFFFFFFu, 0x20000000u, 0x20000000u },
+    { 0xFFFFFFFFu, 0x40000000u, 0x40000000u },
+    { 0xFFFFFFFFu, 0x80000000u, 0x80000000u },
+    { 0x89ABCDEFu, 0x00000000u, 0x00000000u },
+    { 0x89ABCDEFu, 0xFFFFFFFFu, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0x55555555u, 0x50515455u },
+    { 0x89ABCDEFu, 0xAAAAAAAAu, 0xA0A2A8AAu },
+    { 0x89ABCDEFu, 0x89ABCDEFu, 0x81A8C5CFu },
+    { 0x89ABCDEFu, 0x00000001u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00000002u, 0x00000002u },
+    { 0x89ABCDEFu, 0x00000004u, 0x00000004u },
+    { 0x89ABCDEFu, 0x00000008u, 0x00000008u },
+    { 0x89ABCDEFu, 0x00000010u, 0x00000010u },
+    { 0x89ABCDEFu, 0x00000020u, 0x00000020u },
+    { 0x89ABCDEFu, 0x00000040u, 0x00000040u },
+    { 0x89ABCDEFu, 0x00000080u, 0x00000080u },
+    { 0x89ABCDEFu, 0x00000100u, 0x00000100u },
+    { 0x89ABCDEFu, 0x00000200u, 0x00000200u },
+    { 0x89ABCDEFu, 0x00000400u, 0x00000400u },
+    { 0x89ABCDEFu, 0x00000800u, 0x00000800u },
+    { 0x89ABCDEFu, 0x00001000u, 0x00001000u },
+    { 0x89ABCDEFu, 0x00002000u, 0x00002000u },
+    { 0x89ABCDEFu, 0x00004000u, 0x00004000u },
+    { 0x89ABCDEFu, 0x00008000u, 0x00008000u },
+    { 0x89ABCDEFu, 0x00010000u, 0x00010000u },
+    { 0x89ABCDEFu, 0x00020000u, 0x00020000u },
+    { 0x89ABCDEFu, 0x00040000u, 0x00040000u },
+    { 0x89ABCDEFu, 0x00080000u, 0x00080000u },
+    { 0x89ABCDEFu, 0x00100000u, 0x00100000u },
+    { 0x89ABCDEFu, 0x00200000u, 0x00200000u },
+    { 0x89ABCDEFu, 0x00400000u, 0x00400000u },
+    { 0x89ABCDEFu, 0x00800000u, 0x00800000u },
+    { 0x89ABCDEFu, 0x01000000u, 0x01000000u },
+    { 0x89ABCDEFu, 0x02000000u, 0x02000000u },
+    { 0x89ABCDEFu, 0x04000000u, 0x04000000u },
+    { 0x89ABCDEFu, 0x08000000u, 0x08000000u },
+    { 0x89ABCDEFu, 0x10000000u, 0x10000000u },
+    { 0x89ABCDEFu, 0x20000000u, 0x20000000u },
+    { 0x89ABCDEFu, 0x40000000u, 0x40000000u },
+    { 0x89ABCDEFu, 0x80000000u, 0x80000000u },
+    { 0x55555555u, 0x00000000u, 0x00000000u },
+    { 0x55555555u, 0xFFFFFFFFu, 0x55555555u },
+    { 0x55555555u, 0x55555555u, 0x11111111u },
+    { 0x55555555u, 0xAAAAAAAAu, 0x22222222u },
+    { 0x55555555u, 0x89ABCDEFu, 0x088944A5u },
+    { 0x55555555u, 0x00000001u, 0x00000001u },
+    { 0x55555555u, 0x00000002u, 0x00000002u },
+    { 0x55555555u, 0x00000004u, 0x00000004u },
+    { 0x55555555u, 0x00000008u, 0x00000008u },
+    { 0x55555555u, 0x00000010u, 0x00000010u },
+    { 0x55555555u, 0x00000020u, 0x00000020u },
+    { 0x55555555u, 0x00000040u, 0x00000040u },
+    { 0x55555555u, 0x00000080u, 0x00000080u },
+    { 0x55555555u, 0x00000100u, 0x00000100u },
+    { 0x55555555u, 0x00000200u, 0x00000200u },
+    { 0x55555555u, 0x00000400u, 0x00000400u },
+    { 0x55555555u, 0x00000800u, 0x00000800u },
+    { 0x55555555u, 0x00001000u, 0x00001000u },
+    { 0x55555555u, 0x00002000u, 0x00002000u },
+    { 0x55555555u, 0x00004000u, 0x00004000u },
+    { 0x55555555u, 0x00008000u, 0x00008000u },
+    { 0x55555555u, 0x00010000u, 0x00010000u },
+    { 0x55555555u, 0x00020000u, 0x00020000u },
+    { 0x55555555u, 0x00040000u, 0x00040000u },
+    { 0x55555555u, 0x00080000u, 0x00080000u },
+    { 0x55555555u, 0x00100000u, 0x00100000u },
+    { 0x55555555u, 0x00200000u, 0x00200000u },
+    { 0x55555555u, 0x00400000u, 0x00400000u },
+    { 0x55555555u, 0x00800000u, 0x00800000u },
+    { 0x55555555u, 0x01000000u, 0x01000000u },
+    { 0x55555555u, 0x02000000u, 0x02000000u },
+    { 0x55555555u, 0x04000000u, 0x04000000u },
+    { 0x55555555u, 0x08000000u, 0x08000000u },
+    { 0x55555555u, 0x10000000u, 0x10000000u },
+    { 0x55555555u, 0x20000000u, 0x20000000u },
+    { 0x55555555u, 0x40000000u, 0x40000000u },
+    { 0x55555555u, 0x80000000u, 0x80000000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_DepositBits_u32u32_u32 vectors**
+ *
+ * The test runs the 111 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ */
+void test__Bfx_DepositBits_u32u32_u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( DepositBits_u32u32_u32 ) / sizeof( DepositBits_u32u32_u32[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( DepositBits_u32u32_u32[ i ].Expected, Bfx_DepositBits_u32u32_u32( DepositBits_u32u32_u32[ i ].Data, DepositBits_u32u32_u32[ i ].Mask ), Vector( "Bfx_DepositBits_u32u32_u32", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint32 Data;
+    uint32 Mask;
+    uint32 Expected;
+} ExtractBits_u32u32_u32[] = {
+    { 0xFFFFFFFFu, 0x00000000u, 0x00000000u },
+    { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu },
+    { 0xFFFFFFFFu, 0x55555555u, 0x0000FFFFu },
+    { 0xFFFFFFFFu, 0xAAAAAAAAu, 0x0000FFFFu },
+    { 0xFFFFFFFFu, 0x89ABCDEFu, 0x000FFFFFu },
+    { 0xFFFFFFFFu, 0x00000001u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000002u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000004u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000008u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000010u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000020u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000040u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000080u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000100u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000200u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000400u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00000800u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00001000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00002000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00004000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00008000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00010000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00020000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00040000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00080000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00100000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00200000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00400000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x00800000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x01000000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x02000000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x04000000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x08000000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x10000000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x20000000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x40000000u, 0x00000001u },
+    { 0xFFFFFFFFu, 0x80000000u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00000000u, 0x00000000u },
+    { 0x89ABCDEFu, 0xFFFFFFFFu, 0x89ABCDEFu },
+    { 0x89ABCDEFu, 0x55555555u, 0x000011BBu },
+    { 0x89ABCDEFu, 0xAAAAAAAAu, 0x0000AFAFu },
+    { 0x89ABCDEFu, 0x89ABCDEFu, 0x000FFFFFu },
+    { 0x89ABCDEFu, 0x00000001u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00000002u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00000004u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00000008u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00000010u, 0x00000000u },
+    { 0x89ABCDEFu, 0x00000020u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00000040u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00000080u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00000100u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00000200u, 0x00000000u },
+    { 0x89ABCDEFu, 0x00000400u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00000800u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00001000u, 0x00000000u },
+    { 0x89ABCDEFu, 0x00002000u, 0x00000000u },
+    { 0x89ABCDEFu, 0x00004000u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00008000u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00010000u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00020000u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00040000u, 0x00000000u },
+    { 0x89ABCDEFu, 0x00080000u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00100000u, 0x00000000u },
+    { 0x89ABCDEFu, 0x00200000u, 0x00000001u },
+    { 0x89ABCDEFu, 0x00400000u, 0x00000000u },
+    { 0x89ABCDEFu, 0x00800000u, 0x00000001u },
+    { 0x89ABCDEFu, 0x01000000u, 0x00000001u },
+    { 0x89ABCDEFu, 0x02000000u, 0x00000000u },
+    { 0x89ABCDEFu, 0x04000000u, 0x00000000u },
+    { 0x89ABCDEFu, 0x08000000u, 0x00000001u },
+    { 0x89ABCDEFu, 0x10000000u, 0x00000000u },
+    { 0x89ABCDEFu, 0x20000000u, 0x00000000u },
+    { 0x89ABCDEFu, 0x40000000u, 0x00000000u },
+    { 0x89ABCDEFu, 0x80000000u, 0x00000001u },
+    { 0x55555555u, 0x00000000u, 0x00000000u },
+    { 0x55555555u, 0xFFFFFFFFu, 0x55555555u },
+    { 0x55555555u, 0x55555555u, 0x0000FFFFu },
+    { 0x55555555u, 0xAAAAAAAAu, 0x00000000u },
+    { 0x55555555u, 0x89ABCDEFu, 0x000215A5u },
+    { 0x55555555u, 0x00000001u, 0x00000001u },
+    { 0x55555555u, 0x00000002u, 0x00000000u },
+    { 0x55555555u, 0x00000004u, 0x00000001u },
+    { 0x55555555u, 0x00000008u, 0x00000000u },
+    { 0x55555555u, 0x00000010u, 0x00000001u },
+    { 0x55555555u, 0x00000020u, 0x00000000u },
+    { 0x55555555u, 0x00000040u, 0x00000001u },
+    { 0x55555555u, 0x00000080u, 0x00000000u },
+    { 0x55555555u, 0x00000100u, 0x00000001u },
+    { 0x55555555u, 0x00000200u, 0x00000000u },
+    { 0x55555555u, 0x00000400u, 0x00000001u },
+    { 0x55555555u, 0x00000800u, 0x00000000u },
+    { 0x55555555u, 0x00001000u, 0x00000001u },
+    { 0x55555555u, 0x00002000u, 0x00000000u },
+    { 0x55555555u, 0x00004000u, 0x00000001u },
+    { 0x55555555u, 0x00008000u, 0x00000000u },
+    { 0x55555555u, 0x00010000u, 0x00000001u },
+    { 0x55555555u, 0x00020000u, 0x00000000u },
+    { 0x55555555u, 0x00040000u, 0x00000001u },
+    { 0x55555555u, 0x00080000u, 0x00000000u },
+    { 0x55555555u, 0x00100000u, 0x00000001u },
+    { 0x55555555u, 0x00200000u, 0x00000000u },
+    { 0x55555555u, 0x00400000u, 0x00000001u },
+    { 0x55555555u, 0x00800000u, 0x00000000u },
+    { 0x55555555u, 0x01000000u, 0x00000001u },
+    { 0x55555555u, 0x02000000u, 0x00000000u },
+    { 0x55555555u, 0x04000000u, 0x00000001u },
+    { 0x55555555u, 0x08000000u, 0x00000000u },
+    { 0x55555555u, 0x10000000u, 0x00000001u },
+    { 0x55555555u, 0x20000000u, 0x00000000u },
+    { 0x55555555u, 0x40000000u, 0x00000001u },
+    { 0x55555555u, 0x80000000u, 0x00000000u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ExtractBits_u32u32_u32 vectors**
+ *
+ * The test runs the 111 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ */
+void test__Bfx_ExtractBits_u32u32_u32__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ExtractBits_u32u32_u32 ) / sizeof( ExtractBits_u32u32_u32[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( ExtractBits_u32u32_u32[ i ].Expected, Bfx_ExtractBits_u32u32_u32( ExtractBits_u32u32_u32[ i ].Data, ExtractBits_u32u32_u32[ i ].Mask ), Vector( "Bfx_ExtractBits_u32u32_u32", i ) );
+    }
+}
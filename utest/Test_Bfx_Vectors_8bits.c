@@ -0,0 +1,1864 @@
+/**
+ * @file    Test_Bfx_Vectors_8bits.c
+ * @brief   **Table Driven Unit Test for the 8 Bit Handling Routines**
+ *
+ * Generated by tools/bfx_vectors.py from utest/vectors/Bfx_Vectors.yaml, do not edit, change the
+ * YAML file and run meson compile -C build vectors instead.
+ *
+ * Each test runs every vector in the table of its routine, 1102 vectors in total. The expected
+ * results come from the reference model of the generator.
+ */
+#include <stdio.h>
+#include "unity.h"
+#include "Std_Types.h"
+#include "Bfx_8bits.h"
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+static char Message[ 64 ];
+
+static const char *Vector( const char *Routine, uint32 Index )
+{
+    (void)snprintf( Message, sizeof( Message ), "%s vector %u", Routine, (unsigned)Index );
+    return Message;
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 BitPn;
+    uint8 Expected;
+} SetBit_u8u8[] = {
+    { 0x00u, 2u, 0x04u },
+    { 0x7Fu, 7u, 0xFFu },
+    { 0x00u, 0u, 0x01u },
+    { 0x00u, 1u, 0x02u },
+    { 0x00u, 2u, 0x04u },
+    { 0x00u, 3u, 0x08u },
+    { 0x00u, 4u, 0x10u },
+    { 0x00u, 5u, 0x20u },
+    { 0x00u, 6u, 0x40u },
+    { 0x00u, 7u, 0x80u },
+    { 0xFFu, 0u, 0xFFu },
+    { 0xFFu, 1u, 0xFFu },
+    { 0xFFu, 2u, 0xFFu },
+    { 0xFFu, 3u, 0xFFu },
+    { 0xFFu, 4u, 0xFFu },
+    { 0xFFu, 5u, 0xFFu },
+    { 0xFFu, 6u, 0xFFu },
+    { 0xFFu, 7u, 0xFFu },
+    { 0x55u, 0u, 0x55u },
+    { 0x55u, 1u, 0x57u },
+    { 0x55u, 2u, 0x55u },
+    { 0x55u, 3u, 0x5Du },
+    { 0x55u, 4u, 0x55u },
+    { 0x55u, 5u, 0x75u },
+    { 0x55u, 6u, 0x55u },
+    { 0x55u, 7u, 0xD5u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_SetBit_u8u8 vectors**
+ *
+ * The test runs the 26 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00001, SWS_Bfx_00002, SWS_Bfx_00008
+ */
+void test__Bfx_SetBit_u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( SetBit_u8u8 ) / sizeof( SetBit_u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = SetBit_u8u8[ i ].Data;
+        Bfx_SetBit_u8u8( &Data, SetBit_u8u8[ i ].BitPn );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( SetBit_u8u8[ i ].Expected, Data, Vector( "Bfx_SetBit_u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 BitPn;
+    uint8 Expected;
+} ClrBit_u8u8[] = {
+    { 0xFFu, 2u, 0xFBu },
+    { 0x00u, 0u, 0x00u },
+    { 0x00u, 1u, 0x00u },
+    { 0x00u, 2u, 0x00u },
+    { 0x00u, 3u, 0x00u },
+    { 0x00u, 4u, 0x00u },
+    { 0x00u, 5u, 0x00u },
+    { 0x00u, 6u, 0x00u },
+    { 0x00u, 7u, 0x00u },
+    { 0xFFu, 0u, 0xFEu },
+    { 0xFFu, 1u, 0xFDu },
+    { 0xFFu, 2u, 0xFBu },
+    { 0xFFu, 3u, 0xF7u },
+    { 0xFFu, 4u, 0xEFu },
+    { 0xFFu, 5u, 0xDFu },
+    { 0xFFu, 6u, 0xBFu },
+    { 0xFFu, 7u, 0x7Fu },
+    { 0xAAu, 0u, 0xAAu },
+    { 0xAAu, 1u, 0xA8u },
+    { 0xAAu, 2u, 0xAAu },
+    { 0xAAu, 3u, 0xA2u },
+    { 0xAAu, 4u, 0xAAu },
+    { 0xAAu, 5u, 0x8Au },
+    { 0xAAu, 6u, 0xAAu },
+    { 0xAAu, 7u, 0x2Au },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ClrBit_u8u8 vectors**
+ *
+ * The test runs the 25 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00010, SWS_Bfx_00011, SWS_Bfx_00015
+ */
+void test__Bfx_ClrBit_u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ClrBit_u8u8 ) / sizeof( ClrBit_u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = ClrBit_u8u8[ i ].Data;
+        Bfx_ClrBit_u8u8( &Data, ClrBit_u8u8[ i ].BitPn );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( ClrBit_u8u8[ i ].Expected, Data, Vector( "Bfx_ClrBit_u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 BitPn;
+    boolean Expected;
+} GetBit_u8u8_u8[] = {
+    { 0x8Au, 1u,  TRUE },
+    { 0x8Au, 2u, FALSE },
+    { 0x00u, 0u, FALSE },
+    { 0x00u, 1u, FALSE },
+    { 0x00u, 2u, FALSE },
+    { 0x00u, 3u, FALSE },
+    { 0x00u, 4u, FALSE },
+    { 0x00u, 5u, FALSE },
+    { 0x00u, 6u, FALSE },
+    { 0x00u, 7u, FALSE },
+    { 0xFFu, 0u,  TRUE },
+    { 0xFFu, 1u,  TRUE },
+    { 0xFFu, 2u,  TRUE },
+    { 0xFFu, 3u,  TRUE },
+    { 0xFFu, 4u,  TRUE },
+    { 0xFFu, 5u,  TRUE },
+    { 0xFFu, 6u,  TRUE },
+    { 0xFFu, 7u,  TRUE },
+    { 0x55u, 0u,  TRUE },
+    { 0x55u, 1u, FALSE },
+    { 0x55u, 2u,  TRUE },
+    { 0x55u, 3u, FALSE },
+    { 0x55u, 4u,  TRUE },
+    { 0x55u, 5u, FALSE },
+    { 0x55u, 6u,  TRUE },
+    { 0x55u, 7u, FALSE },
+    { 0xEFu, 0u,  TRUE },
+    { 0xEFu, 1u,  TRUE },
+    { 0xEFu, 2u,  TRUE },
+    { 0xEFu, 3u,  TRUE },
+    { 0xEFu, 4u, FALSE },
+    { 0xEFu, 5u,  TRUE },
+    { 0xEFu, 6u,  TRUE },
+    { 0xEFu, 7u,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_GetBit_u8u8_u8 vectors**
+ *
+ * The test runs the 34 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00016, SWS_Bfx_00017, SWS_Bfx_00020
+ */
+void test__Bfx_GetBit_u8u8_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( GetBit_u8u8_u8 ) / sizeof( GetBit_u8u8_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( GetBit_u8u8_u8[ i ].Expected, Bfx_GetBit_u8u8_u8( GetBit_u8u8_u8[ i ].Data, GetBit_u8u8_u8[ i ].BitPn ), Vector( "Bfx_GetBit_u8u8_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 BitPn;
+    boolean Status;
+    uint8 Expected;
+} PutBit_u8u8u8[] = {
+    { 0x0Fu, 4u,  TRUE, 0x1Fu },
+    { 0x0Fu, 3u, FALSE, 0x07u },
+    { 0x00u, 0u, FALSE, 0x00u },
+    { 0x00u, 0u,  TRUE, 0x01u },
+    { 0x00u, 1u, FALSE, 0x00u },
+    { 0x00u, 1u,  TRUE, 0x02u },
+    { 0x00u, 2u, FALSE, 0x00u },
+    { 0x00u, 2u,  TRUE, 0x04u },
+    { 0x00u, 3u, FALSE, 0x00u },
+    { 0x00u, 3u,  TRUE, 0x08u },
+    { 0x00u, 4u, FALSE, 0x00u },
+    { 0x00u, 4u,  TRUE, 0x10u },
+    { 0x00u, 5u, FALSE, 0x00u },
+    { 0x00u, 5u,  TRUE, 0x20u },
+    { 0x00u, 6u, FALSE, 0x00u },
+    { 0x00u, 6u,  TRUE, 0x40u },
+    { 0x00u, 7u, FALSE, 0x00u },
+    { 0x00u, 7u,  TRUE, 0x80u },
+    { 0xFFu, 0u, FALSE, 0xFEu },
+    { 0xFFu, 0u,  TRUE, 0xFFu },
+    { 0xFFu, 1u, FALSE, 0xFDu },
+    { 0xFFu, 1u,  TRUE, 0xFFu },
+    { 0xFFu, 2u, FALSE, 0xFBu },
+    { 0xFFu, 2u,  TRUE, 0xFFu },
+    { 0xFFu, 3u, FALSE, 0xF7u },
+    { 0xFFu, 3u,  TRUE, 0xFFu },
+    { 0xFFu, 4u, FALSE, 0xEFu },
+    { 0xFFu, 4u,  TRUE, 0xFFu },
+    { 0xFFu, 5u, FALSE, 0xDFu },
+    { 0xFFu, 5u,  TRUE, 0xFFu },
+    { 0xFFu, 6u, FALSE, 0xBFu },
+    { 0xFFu, 6u,  TRUE, 0xFFu },
+    { 0xFFu, 7u, FALSE, 0x7Fu },
+    { 0xFFu, 7u,  TRUE, 0xFFu },
+    { 0xEFu, 0u, FALSE, 0xEEu },
+    { 0xEFu, 0u,  TRUE, 0xEFu },
+    { 0xEFu, 1u, FALSE, 0xEDu },
+    { 0xEFu, 1u,  TRUE, 0xEFu },
+    { 0xEFu, 2u, FALSE, 0xEBu },
+    { 0xEFu, 2u,  TRUE, 0xEFu },
+    { 0xEFu, 3u, FALSE, 0xE7u },
+    { 0xEFu, 3u,  TRUE, 0xEFu },
+    { 0xEFu, 4u, FALSE, 0xEFu },
+    { 0xEFu, 4u,  TRUE, 0xFFu },
+    { 0xEFu, 5u, FALSE, 0xCFu },
+    { 0xEFu, 5u,  TRUE, 0xEFu },
+    { 0xEFu, 6u, FALSE, 0xAFu },
+    { 0xEFu, 6u,  TRUE, 0xEFu },
+    { 0xEFu, 7u, FALSE, 0x6Fu },
+    { 0xEFu, 7u,  TRUE, 0xEFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_PutBit_u8u8u8 vectors**
+ *
+ * The test runs the 50 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00130, SWS_Bfx_00132
+ */
+void test__Bfx_PutBit_u8u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( PutBit_u8u8u8 ) / sizeof( PutBit_u8u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = PutBit_u8u8u8[ i ].Data;
+        Bfx_PutBit_u8u8u8( &Data, PutBit_u8u8u8[ i ].BitPn, PutBit_u8u8u8[ i ].Status );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( PutBit_u8u8u8[ i ].Expected, Data, Vector( "Bfx_PutBit_u8u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 BitStartPn;
+    uint8 BitLn;
+    uint8 Status;
+    uint8 Expected;
+} SetBits_u8u8u8u8[] = {
+    { 0xC8u, 2u, 3u, 1u, 0xDCu },
+    { 0xC8u, 0u, 8u, 0u, 0x00u },
+    { 0x55u, 0u, 0u, 0u, 0x55u },
+    { 0x55u, 0u, 0u, 1u, 0x55u },
+    { 0x55u, 0u, 1u, 0u, 0x54u },
+    { 0x55u, 0u, 1u, 1u, 0x55u },
+    { 0x55u, 0u, 2u, 0u, 0x54u },
+    { 0x55u, 0u, 2u, 1u, 0x57u },
+    { 0x55u, 0u, 3u, 0u, 0x50u },
+    { 0x55u, 0u, 3u, 1u, 0x57u },
+    { 0x55u, 0u, 4u, 0u, 0x50u },
+    { 0x55u, 0u, 4u, 1u, 0x5Fu },
+    { 0x55u, 0u, 5u, 0u, 0x40u },
+    { 0x55u, 0u, 5u, 1u, 0x5Fu },
+    { 0x55u, 0u, 6u, 0u, 0x40u },
+    { 0x55u, 0u, 6u, 1u, 0x7Fu },
+    { 0x55u, 0u, 7u, 0u, 0x00u },
+    { 0x55u, 0u, 7u, 1u, 0x7Fu },
+    { 0x55u, 0u, 8u, 0u, 0x00u },
+    { 0x55u, 0u, 8u, 1u, 0xFFu },
+    { 0x55u, 1u, 0u, 0u, 0x55u },
+    { 0x55u, 1u, 0u, 1u, 0x55u },
+    { 0x55u, 1u, 1u, 0u, 0x55u },
+    { 0x55u, 1u, 1u, 1u, 0x57u },
+    { 0x55u, 1u, 2u, 0u, 0x51u },
+    { 0x55u, 1u, 2u, 1u, 0x57u },
+    { 0x55u, 1u, 3u, 0u, 0x51u },
+    { 0x55u, 1u, 3u, 1u, 0x5Fu },
+    { 0x55u, 1u, 4u, 0u, 0x41u },
+    { 0x55u, 1u, 4u, 1u, 0x5Fu },
+    { 0x55u, 1u, 5u, 0u, 0x41u },
+    { 0x55u, 1u, 5u, 1u, 0x7Fu },
+    { 0x55u, 1u, 6u, 0u, 0x01u },
+    { 0x55u, 1u, 6u, 1u, 0x7Fu },
+    { 0x55u, 1u, 7u, 0u, 0x01u },
+    { 0x55u, 1u, 7u, 1u, 0xFFu },
+    { 0x55u, 2u, 0u, 0u, 0x55u },
+    { 0x55u, 2u, 0u, 1u, 0x55u },
+    { 0x55u, 2u, 1u, 0u, 0x51u },
+    { 0x55u, 2u, 1u, 1u, 0x55u },
+    { 0x55u, 2u, 2u, 0u, 0x51u },
+    { 0x55u, 2u, 2u, 1u, 0x5Du },
+    { 0x55u, 2u, 3u, 0u, 0x41u },
+    { 0x55u, 2u, 3u, 1u, 0x5Du },
+    { 0x55u, 2u, 4u, 0u, 0x41u },
+    { 0x55u, 2u, 4u, 1u, 0x7Du },
+    { 0x55u, 2u, 5u, 0u, 0x01u },
+    { 0x55u, 2u, 5u, 1u, 0x7Du },
+    { 0x55u, 2u, 6u, 0u, 0x01u },
+    { 0x55u, 2u, 6u, 1u, 0xFDu },
+    { 0x55u, 3u, 0u, 0u, 0x55u },
+    { 0x55u, 3u, 0u, 1u, 0x55u },
+    { 0x55u, 3u, 1u, 0u, 0x55u },
+    { 0x55u, 3u, 1u, 1u, 0x5Du },
+    { 0x55u, 3u, 2u, 0u, 0x45u },
+    { 0x55u, 3u, 2u, 1u, 0x5Du },
+    { 0x55u, 3u, 3u, 0u, 0x45u },
+    { 0x55u, 3u, 3u, 1u, 0x7Du },
+    { 0x55u, 3u, 4u, 0u, 0x05u },
+    { 0x55u, 3u, 4u, 1u, 0x7Du },
+    { 0x55u, 3u, 5u, 0u, 0x05u },
+    { 0x55u, 3u, 5u, 1u, 0xFDu },
+    { 0x55u, 4u, 0u, 0u, 0x55u },
+    { 0x55u, 4u, 0u, 1u, 0x55u },
+    { 0x55u, 4u, 1u, 0u, 0x45u },
+    { 0x55u, 4u, 1u, 1u, 0x55u },
+    { 0x55u, 4u, 2u, 0u, 0x45u },
+    { 0x55u, 4u, 2u, 1u, 0x75u },
+    { 0x55u, 4u, 3u, 0u, 0x05u },
+    { 0x55u, 4u, 3u, 1u, 0x75u },
+    { 0x55u, 4u, 4u, 0u, 0x05u },
+    { 0x55u, 4u, 4u, 1u, 0xF5u },
+    { 0x55u, 5u, 0u, 0u, 0x55u },
+    { 0x55u, 5u, 0u, 1u, 0x55u },
+    { 0x55u, 5u, 1u, 0u, 0x55u },
+    { 0x55u, 5u, 1u, 1u, 0x75u },
+    { 0x55u, 5u, 2u, 0u, 0x15u },
+    { 0x55u, 5u, 2u, 1u, 0x75u },
+    { 0x55u, 5u, 3u, 0u, 0x15u },
+    { 0x55u, 5u, 3u, 1u, 0xF5u },
+    { 0x55u, 6u, 0u, 0u, 0x55u },
+    { 0x55u, 6u, 0u, 1u, 0x55u },
+    { 0x55u, 6u, 1u, 0u, 0x15u },
+    { 0x55u, 6u, 1u, 1u, 0x55u },
+    { 0x55u, 6u, 2u, 0u, 0x15u },
+    { 0x55u, 6u, 2u, 1u, 0xD5u },
+    { 0x55u, 7u, 0u, 0u, 0x55u },
+    { 0x55u, 7u, 0u, 1u, 0x55u },
+    { 0x55u, 7u, 1u, 0u, 0x55u },
+    { 0x55u, 7u, 1u, 1u, 0xD5u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_SetBits_u8u8u8u8 vectors**
+ *
+ * The test runs the 90 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00021, SWS_Bfx_00022, SWS_Bfx_00025
+ */
+void test__Bfx_SetBits_u8u8u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( SetBits_u8u8u8u8 ) / sizeof( SetBits_u8u8u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = SetBits_u8u8u8u8[ i ].Data;
+        Bfx_SetBits_u8u8u8u8( &Data, SetBits_u8u8u8u8[ i ].BitStartPn, SetBits_u8u8u8u8[ i ].BitLn, SetBits_u8u8u8u8[ i ].Status );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( SetBits_u8u8u8u8[ i ].Expected, Data, Vector( "Bfx_SetBits_u8u8u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 BitStartPn;
+    uint8 BitLn;
+    uint8 Expected;
+} GetBits_u8u8u8_u8[] = {
+    { 0x67u, 4u, 3u, 0x06u },
+    { 0xEFu, 0u, 0u, 0x00u },
+    { 0xEFu, 0u, 1u, 0x01u },
+    { 0xEFu, 0u, 2u, 0x03u },
+    { 0xEFu, 0u, 3u, 0x07u },
+    { 0xEFu, 0u, 4u, 0x0Fu },
+    { 0xEFu, 0u, 5u, 0x0Fu },
+    { 0xEFu, 0u, 6u, 0x2Fu },
+    { 0xEFu, 0u, 7u, 0x6Fu },
+    { 0xEFu, 0u, 8u, 0xEFu },
+    { 0xEFu, 1u, 0u, 0x00u },
+    { 0xEFu, 1u, 1u, 0x01u },
+    { 0xEFu, 1u, 2u, 0x03u },
+    { 0xEFu, 1u, 3u, 0x07u },
+    { 0xEFu, 1u, 4u, 0x07u },
+    { 0xEFu, 1u, 5u, 0x17u },
+    { 0xEFu, 1u, 6u, 0x37u },
+    { 0xEFu, 1u, 7u, 0x77u },
+    { 0xEFu, 2u, 0u, 0x00u },
+    { 0xEFu, 2u, 1u, 0x01u },
+    { 0xEFu, 2u, 2u, 0x03u },
+    { 0xEFu, 2u, 3u, 0x03u },
+    { 0xEFu, 2u, 4u, 0x0Bu },
+    { 0xEFu, 2u, 5u, 0x1Bu },
+    { 0xEFu, 2u, 6u, 0x3Bu },
+    { 0xEFu, 3u, 0u, 0x00u },
+    { 0xEFu, 3u, 1u, 0x01u },
+    { 0xEFu, 3u, 2u, 0x01u },
+    { 0xEFu, 3u, 3u, 0x05u },
+    { 0xEFu, 3u, 4u, 0x0Du },
+    { 0xEFu, 3u, 5u, 0x1Du },
+    { 0xEFu, 4u, 0u, 0x00u },
+    { 0xEFu, 4u, 1u, 0x00u },
+    { 0xEFu, 4u, 2u, 0x02u },
+    { 0xEFu, 4u, 3u, 0x06u },
+    { 0xEFu, 4u, 4u, 0x0Eu },
+    { 0xEFu, 5u, 0u, 0x00u },
+    { 0xEFu, 5u, 1u, 0x01u },
+    { 0xEFu, 5u, 2u, 0x03u },
+    { 0xEFu, 5u, 3u, 0x07u },
+    { 0xEFu, 6u, 0u, 0x00u },
+    { 0xEFu, 6u, 1u, 0x01u },
+    { 0xEFu, 6u, 2u, 0x03u },
+    { 0xEFu, 7u, 0u, 0x00u },
+    { 0xEFu, 7u, 1u, 0x01u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_GetBits_u8u8u8_u8 vectors**
+ *
+ * The test runs the 45 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00028, SWS_Bfx_00029, SWS_Bfx_00034
+ */
+void test__Bfx_GetBits_u8u8u8_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( GetBits_u8u8u8_u8 ) / sizeof( GetBits_u8u8u8_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( GetBits_u8u8u8_u8[ i ].Expected, Bfx_GetBits_u8u8u8_u8( GetBits_u8u8u8_u8[ i ].Data, GetBits_u8u8u8_u8[ i ].BitStartPn, GetBits_u8u8u8_u8[ i ].BitLn ), Vector( "Bfx_GetBits_u8u8u8_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 BitStartPn;
+    uint8 BitLn;
+    uint8 Pattern;
+    uint8 Expected;
+} PutBits_u8u8u8u8[] = {
+    { 0x98u, 2u, 4u, 0x05u, 0x94u },
+    { 0xFFu, 0u, 0u, 0xEFu, 0xFFu },
+    { 0xFFu, 0u, 1u, 0xEFu, 0xFFu },
+    { 0xFFu, 0u, 2u, 0xEFu, 0xFFu },
+    { 0xFFu, 0u, 3u, 0xEFu, 0xFFu },
+    { 0xFFu, 0u, 4u, 0xEFu, 0xFFu },
+    { 0xFFu, 0u, 5u, 0xEFu, 0xEFu },
+    { 0xFFu, 0u, 6u, 0xEFu, 0xEFu },
+    { 0xFFu, 0u, 7u, 0xEFu, 0xEFu },
+    { 0xFFu, 0u, 8u, 0xEFu, 0xEFu },
+    { 0xFFu, 1u, 0u, 0xEFu, 0xFFu },
+    { 0xFFu, 1u, 1u, 0xEFu, 0xFFu },
+    { 0xFFu, 1u, 2u, 0xEFu, 0xFFu },
+    { 0xFFu, 1u, 3u, 0xEFu, 0xFFu },
+    { 0xFFu, 1u, 4u, 0xEFu, 0xFFu },
+    { 0xFFu, 1u, 5u, 0xEFu, 0xDFu },
+    { 0xFFu, 1u, 6u, 0xEFu, 0xDFu },
+    { 0xFFu, 1u, 7u, 0xEFu, 0xDFu },
+    { 0xFFu, 2u, 0u, 0xEFu, 0xFFu },
+    { 0xFFu, 2u, 1u, 0xEFu, 0xFFu },
+    { 0xFFu, 2u, 2u, 0xEFu, 0xFFu },
+    { 0xFFu, 2u, 3u, 0xEFu, 0xFFu },
+    { 0xFFu, 2u, 4u, 0xEFu, 0xFFu },
+    { 0xFFu, 2u, 5u, 0xEFu, 0xBFu },
+    { 0xFFu, 2u, 6u, 0xEFu, 0xBFu },
+    { 0xFFu, 3u, 0u, 0xEFu, 0xFFu },
+    { 0xFFu, 3u, 1u, 0xEFu, 0xFFu },
+    { 0xFFu, 3u, 2u, 0xEFu, 0xFFu },
+    { 0xFFu, 3u, 3u, 0xEFu, 0xFFu },
+    { 0xFFu, 3u, 4u, 0xEFu, 0xFFu },
+    { 0xFFu, 3u, 5u, 0xEFu, 0x7Fu },
+    { 0xFFu, 4u, 0u, 0xEFu, 0xFFu },
+    { 0xFFu, 4u, 1u, 0xEFu, 0xFFu },
+    { 0xFFu, 4u, 2u, 0xEFu, 0xFFu },
+    { 0xFFu, 4u, 3u, 0xEFu, 0xFFu },
+    { 0xFFu, 4u, 4u, 0xEFu, 0xFFu },
+    { 0xFFu, 5u, 0u, 0xEFu, 0xFFu },
+    { 0xFFu, 5u, 1u, 0xEFu, 0xFFu },
+    { 0xFFu, 5u, 2u, 0xEFu, 0xFFu },
+    { 0xFFu, 5u, 3u, 0xEFu, 0xFFu },
+    { 0xFFu, 6u, 0u, 0xEFu, 0xFFu },
+    { 0xFFu, 6u, 1u, 0xEFu, 0xFFu },
+    { 0xFFu, 6u, 2u, 0xEFu, 0xFFu },
+    { 0xFFu, 7u, 0u, 0xEFu, 0xFFu },
+    { 0xFFu, 7u, 1u, 0xEFu, 0xFFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_PutBits_u8u8u8u8 vectors**
+ *
+ * The test runs the 45 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00110, SWS_Bfx_00112
+ */
+void test__Bfx_PutBits_u8u8u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( PutBits_u8u8u8u8 ) / sizeof( PutBits_u8u8u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = PutBits_u8u8u8u8[ i ].Data;
+        Bfx_PutBits_u8u8u8u8( &Data, PutBits_u8u8u8u8[ i ].BitStartPn, PutBits_u8u8u8u8[ i ].BitLn, PutBits_u8u8u8u8[ i ].Pattern );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( PutBits_u8u8u8u8[ i ].Expected, Data, Vector( "Bfx_PutBits_u8u8u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 Mask;
+    uint8 Expected;
+} SetBitMask_u8u8[] = {
+    { 0x93u, 0x5Au, 0xDBu },
+    { 0x00u, 0x00u, 0x00u },
+    { 0x00u, 0xFFu, 0xFFu },
+    { 0x00u, 0x55u, 0x55u },
+    { 0x00u, 0xAAu, 0xAAu },
+    { 0x00u, 0x01u, 0x01u },
+    { 0x00u, 0x80u, 0x80u },
+    { 0x00u, 0xEFu, 0xEFu },
+    { 0xFFu, 0x00u, 0xFFu },
+    { 0xFFu, 0xFFu, 0xFFu },
+    { 0xFFu, 0x55u, 0xFFu },
+    { 0xFFu, 0xAAu, 0xFFu },
+    { 0xFFu, 0x01u, 0xFFu },
+    { 0xFFu, 0x80u, 0xFFu },
+    { 0xFFu, 0xEFu, 0xFFu },
+    { 0x55u, 0x00u, 0x55u },
+    { 0x55u, 0xFFu, 0xFFu },
+    { 0x55u, 0x55u, 0x55u },
+    { 0x55u, 0xAAu, 0xFFu },
+    { 0x55u, 0x01u, 0x55u },
+    { 0x55u, 0x80u, 0xD5u },
+    { 0x55u, 0xEFu, 0xFFu },
+    { 0xEFu, 0x00u, 0xEFu },
+    { 0xEFu, 0xFFu, 0xFFu },
+    { 0xEFu, 0x55u, 0xFFu },
+    { 0xEFu, 0xAAu, 0xEFu },
+    { 0xEFu, 0x01u, 0xEFu },
+    { 0xEFu, 0x80u, 0xEFu },
+    { 0xEFu, 0xEFu, 0xEFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_SetBitMask_u8u8 vectors**
+ *
+ * The test runs the 29 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00035, SWS_Bfx_00036, SWS_Bfx_00038
+ */
+void test__Bfx_SetBitMask_u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( SetBitMask_u8u8 ) / sizeof( SetBitMask_u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = SetBitMask_u8u8[ i ].Data;
+        Bfx_SetBitMask_u8u8( &Data, SetBitMask_u8u8[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( SetBitMask_u8u8[ i ].Expected, Data, Vector( "Bfx_SetBitMask_u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 Mask;
+    uint8 Expected;
+} ClrBitMask_u8u8[] = {
+    { 0x93u, 0x5Au, 0x81u },
+    { 0x00u, 0x00u, 0x00u },
+    { 0x00u, 0xFFu, 0x00u },
+    { 0x00u, 0x55u, 0x00u },
+    { 0x00u, 0xAAu, 0x00u },
+    { 0x00u, 0x01u, 0x00u },
+    { 0x00u, 0x80u, 0x00u },
+    { 0x00u, 0xEFu, 0x00u },
+    { 0xFFu, 0x00u, 0xFFu },
+    { 0xFFu, 0xFFu, 0x00u },
+    { 0xFFu, 0x55u, 0xAAu },
+    { 0xFFu, 0xAAu, 0x55u },
+    { 0xFFu, 0x01u, 0xFEu },
+    { 0xFFu, 0x80u, 0x7Fu },
+    { 0xFFu, 0xEFu, 0x10u },
+    { 0x55u, 0x00u, 0x55u },
+    { 0x55u, 0xFFu, 0x00u },
+    { 0x55u, 0x55u, 0x00u },
+    { 0x55u, 0xAAu, 0x55u },
+    { 0x55u, 0x01u, 0x54u },
+    { 0x55u, 0x80u, 0x55u },
+    { 0x55u, 0xEFu, 0x10u },
+    { 0xEFu, 0x00u, 0xEFu },
+    { 0xEFu, 0xFFu, 0x00u },
+    { 0xEFu, 0x55u, 0xAAu },
+    { 0xEFu, 0xAAu, 0x45u },
+    { 0xEFu, 0x01u, 0xEEu },
+    { 0xEFu, 0x80u, 0x6Fu },
+    { 0xEFu, 0xEFu, 0x00u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ClrBitMask_u8u8 vectors**
+ *
+ * The test runs the 29 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00039, SWS_Bfx_00040, SWS_Bfx_00045
+ */
+void test__Bfx_ClrBitMask_u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ClrBitMask_u8u8 ) / sizeof( ClrBitMask_u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = ClrBitMask_u8u8[ i ].Data;
+        Bfx_ClrBitMask_u8u8( &Data, ClrBitMask_u8u8[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( ClrBitMask_u8u8[ i ].Expected, Data, Vector( "Bfx_ClrBitMask_u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 Mask;
+    boolean Expected;
+} TstBitMask_u8u8_u8[] = {
+    { 0x93u, 0x90u,  TRUE },
+    { 0x93u, 0x98u, FALSE },
+    { 0x00u, 0x00u,  TRUE },
+    { 0x00u, 0xFFu, FALSE },
+    { 0x00u, 0x55u, FALSE },
+    { 0x00u, 0xAAu, FALSE },
+    { 0x00u, 0x01u, FALSE },
+    { 0x00u, 0x80u, FALSE },
+    { 0x00u, 0xEFu, FALSE },
+    { 0xFFu, 0x00u,  TRUE },
+    { 0xFFu, 0xFFu,  TRUE },
+    { 0xFFu, 0x55u,  TRUE },
+    { 0xFFu, 0xAAu,  TRUE },
+    { 0xFFu, 0x01u,  TRUE },
+    { 0xFFu, 0x80u,  TRUE },
+    { 0xFFu, 0xEFu,  TRUE },
+    { 0x55u, 0x00u,  TRUE },
+    { 0x55u, 0xFFu, FALSE },
+    { 0x55u, 0x55u,  TRUE },
+    { 0x55u, 0xAAu, FALSE },
+    { 0x55u, 0x01u,  TRUE },
+    { 0x55u, 0x80u, FALSE },
+    { 0x55u, 0xEFu, FALSE },
+    { 0xEFu, 0x00u,  TRUE },
+    { 0xEFu, 0xFFu, FALSE },
+    { 0xEFu, 0x55u, FALSE },
+    { 0xEFu, 0xAAu,  TRUE },
+    { 0xEFu, 0x01u,  TRUE },
+    { 0xEFu, 0x80u,  TRUE },
+    { 0xEFu, 0xEFu,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_TstBitMask_u8u8_u8 vectors**
+ *
+ * The test runs the 30 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00046, SWS_Bfx_00047, SWS_Bfx_00050
+ */
+void test__Bfx_TstBitMask_u8u8_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( TstBitMask_u8u8_u8 ) / sizeof( TstBitMask_u8u8_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( TstBitMask_u8u8_u8[ i ].Expected, Bfx_TstBitMask_u8u8_u8( TstBitMask_u8u8_u8[ i ].Data, TstBitMask_u8u8_u8[ i ].Mask ), Vector( "Bfx_TstBitMask_u8u8_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 Mask;
+    boolean Expected;
+} TstBitLnMask_u8u8_u8[] = {
+    { 0x93u, 0x10u,  TRUE },
+    { 0x93u, 0x0Cu, FALSE },
+    { 0x00u, 0x00u, FALSE },
+    { 0x00u, 0xFFu, FALSE },
+    { 0x00u, 0x55u, FALSE },
+    { 0x00u, 0xAAu, FALSE },
+    { 0x00u, 0x01u, FALSE },
+    { 0x00u, 0x80u, FALSE },
+    { 0x00u, 0xEFu, FALSE },
+    { 0xFFu, 0x00u, FALSE },
+    { 0xFFu, 0xFFu,  TRUE },
+    { 0xFFu, 0x55u,  TRUE },
+    { 0xFFu, 0xAAu,  TRUE },
+    { 0xFFu, 0x01u,  TRUE },
+    { 0xFFu, 0x80u,  TRUE },
+    { 0xFFu, 0xEFu,  TRUE },
+    { 0x55u, 0x00u, FALSE },
+    { 0x55u, 0xFFu,  TRUE },
+    { 0x55u, 0x55u,  TRUE },
+    { 0x55u, 0xAAu, FALSE },
+    { 0x55u, 0x01u,  TRUE },
+    { 0x55u, 0x80u, FALSE },
+    { 0x55u, 0xEFu,  TRUE },
+    { 0xEFu, 0x00u, FALSE },
+    { 0xEFu, 0xFFu,  TRUE },
+    { 0xEFu, 0x55u,  TRUE },
+    { 0xEFu, 0xAAu,  TRUE },
+    { 0xEFu, 0x01u,  TRUE },
+    { 0xEFu, 0x80u,  TRUE },
+    { 0xEFu, 0xEFu,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_TstBitLnMask_u8u8_u8 vectors**
+ *
+ * The test runs the 30 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00051, SWS_Bfx_00055
+ */
+void test__Bfx_TstBitLnMask_u8u8_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( TstBitLnMask_u8u8_u8 ) / sizeof( TstBitLnMask_u8u8_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( TstBitLnMask_u8u8_u8[ i ].Expected, Bfx_TstBitLnMask_u8u8_u8( TstBitLnMask_u8u8_u8[ i ].Data, TstBitLnMask_u8u8_u8[ i ].Mask ), Vector( "Bfx_TstBitLnMask_u8u8_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    boolean Expected;
+} TstParityEven_u8_u8[] = {
+    { 0x00u,  TRUE },
+    { 0xFFu,  TRUE },
+    { 0x55u,  TRUE },
+    { 0xEFu, FALSE },
+    { 0x01u, FALSE },
+    { 0x02u, FALSE },
+    { 0x04u, FALSE },
+    { 0x08u, FALSE },
+    { 0x10u, FALSE },
+    { 0x20u, FALSE },
+    { 0x40u, FALSE },
+    { 0x80u, FALSE },
+    { 0x00u,  TRUE },
+    { 0x01u, FALSE },
+    { 0x03u,  TRUE },
+    { 0x07u, FALSE },
+    { 0x0Fu,  TRUE },
+    { 0x1Fu, FALSE },
+    { 0x3Fu,  TRUE },
+    { 0x7Fu, FALSE },
+    { 0xFFu,  TRUE },
+    { 0x00u,  TRUE },
+    { 0x80u, FALSE },
+    { 0xC0u,  TRUE },
+    { 0xE0u, FALSE },
+    { 0xF0u,  TRUE },
+    { 0xF8u, FALSE },
+    { 0xFCu,  TRUE },
+    { 0xFEu, FALSE },
+    { 0xFFu,  TRUE },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_TstParityEven_u8_u8 vectors**
+ *
+ * The test runs the 30 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00056, SWS_Bfx_00060
+ */
+void test__Bfx_TstParityEven_u8_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( TstParityEven_u8_u8 ) / sizeof( TstParityEven_u8_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( TstParityEven_u8_u8[ i ].Expected, Bfx_TstParityEven_u8_u8( TstParityEven_u8_u8[ i ].Data ), Vector( "Bfx_TstParityEven_u8_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 Expected;
+} ToggleBits_u8[] = {
+    { 0x00u, 0xFFu },
+    { 0xFFu, 0x00u },
+    { 0x55u, 0xAAu },
+    { 0xEFu, 0x10u },
+    { 0x01u, 0xFEu },
+    { 0x02u, 0xFDu },
+    { 0x04u, 0xFBu },
+    { 0x08u, 0xF7u },
+    { 0x10u, 0xEFu },
+    { 0x20u, 0xDFu },
+    { 0x40u, 0xBFu },
+    { 0x80u, 0x7Fu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ToggleBits_u8 vectors**
+ *
+ * The test runs the 12 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00061, SWS_Bfx_00065
+ */
+void test__Bfx_ToggleBits_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ToggleBits_u8 ) / sizeof( ToggleBits_u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = ToggleBits_u8[ i ].Data;
+        Bfx_ToggleBits_u8( &Data );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( ToggleBits_u8[ i ].Expected, Data, Vector( "Bfx_ToggleBits_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 Mask;
+    uint8 Expected;
+} ToggleBitMask_u8u8[] = {
+    { 0x00u, 0x00u, 0x00u },
+    { 0x00u, 0xFFu, 0xFFu },
+    { 0x00u, 0x55u, 0x55u },
+    { 0x00u, 0xAAu, 0xAAu },
+    { 0x00u, 0x01u, 0x01u },
+    { 0x00u, 0x80u, 0x80u },
+    { 0x00u, 0xEFu, 0xEFu },
+    { 0xFFu, 0x00u, 0xFFu },
+    { 0xFFu, 0xFFu, 0x00u },
+    { 0xFFu, 0x55u, 0xAAu },
+    { 0xFFu, 0xAAu, 0x55u },
+    { 0xFFu, 0x01u, 0xFEu },
+    { 0xFFu, 0x80u, 0x7Fu },
+    { 0xFFu, 0xEFu, 0x10u },
+    { 0x55u, 0x00u, 0x55u },
+    { 0x55u, 0xFFu, 0xAAu },
+    { 0x55u, 0x55u, 0x00u },
+    { 0x55u, 0xAAu, 0xFFu },
+    { 0x55u, 0x01u, 0x54u },
+    { 0x55u, 0x80u, 0xD5u },
+    { 0x55u, 0xEFu, 0xBAu },
+    { 0xEFu, 0x00u, 0xEFu },
+    { 0xEFu, 0xFFu, 0x10u },
+    { 0xEFu, 0x55u, 0xBAu },
+    { 0xEFu, 0xAAu, 0x45u },
+    { 0xEFu, 0x01u, 0xEEu },
+    { 0xEFu, 0x80u, 0x6Fu },
+    { 0xEFu, 0xEFu, 0x00u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ToggleBitMask_u8u8 vectors**
+ *
+ * The test runs the 28 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00066, SWS_Bfx_00069
+ */
+void test__Bfx_ToggleBitMask_u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ToggleBitMask_u8u8 ) / sizeof( ToggleBitMask_u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = ToggleBitMask_u8u8[ i ].Data;
+        Bfx_ToggleBitMask_u8u8( &Data, ToggleBitMask_u8u8[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( ToggleBitMask_u8u8[ i ].Expected, Data, Vector( "Bfx_ToggleBitMask_u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 ShiftCnt;
+    uint8 Expected;
+} ShiftBitRt_u8u8[] = {
+    { 0xFFu, 0u, 0xFFu },
+    { 0xFFu, 1u, 0x7Fu },
+    { 0xFFu, 2u, 0x3Fu },
+    { 0xFFu, 3u, 0x1Fu },
+    { 0xFFu, 4u, 0x0Fu },
+    { 0xFFu, 5u, 0x07u },
+    { 0xFFu, 6u, 0x03u },
+    { 0xFFu, 7u, 0x01u },
+    { 0xEFu, 0u, 0xEFu },
+    { 0xEFu, 1u, 0x77u },
+    { 0xEFu, 2u, 0x3Bu },
+    { 0xEFu, 3u, 0x1Du },
+    { 0xEFu, 4u, 0x0Eu },
+    { 0xEFu, 5u, 0x07u },
+    { 0xEFu, 6u, 0x03u },
+    { 0xEFu, 7u, 0x01u },
+    { 0x01u, 0u, 0x01u },
+    { 0x01u, 1u, 0x00u },
+    { 0x01u, 2u, 0x00u },
+    { 0x01u, 3u, 0x00u },
+    { 0x01u, 4u, 0x00u },
+    { 0x01u, 5u, 0x00u },
+    { 0x01u, 6u, 0x00u },
+    { 0x01u, 7u, 0x00u },
+    { 0x80u, 0u, 0x80u },
+    { 0x80u, 1u, 0x40u },
+    { 0x80u, 2u, 0x20u },
+    { 0x80u, 3u, 0x10u },
+    { 0x80u, 4u, 0x08u },
+    { 0x80u, 5u, 0x04u },
+    { 0x80u, 6u, 0x02u },
+    { 0x80u, 7u, 0x01u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitRt_u8u8 vectors**
+ *
+ * The test runs the 32 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00070, SWS_Bfx_00075
+ */
+void test__Bfx_ShiftBitRt_u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitRt_u8u8 ) / sizeof( ShiftBitRt_u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = ShiftBitRt_u8u8[ i ].Data;
+        Bfx_ShiftBitRt_u8u8( &Data, ShiftBitRt_u8u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( ShiftBitRt_u8u8[ i ].Expected, Data, Vector( "Bfx_ShiftBitRt_u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 ShiftCnt;
+    uint8 Expected;
+} ShiftBitLt_u8u8[] = {
+    { 0xFFu, 0u, 0xFFu },
+    { 0xFFu, 1u, 0xFEu },
+    { 0xFFu, 2u, 0xFCu },
+    { 0xFFu, 3u, 0xF8u },
+    { 0xFFu, 4u, 0xF0u },
+    { 0xFFu, 5u, 0xE0u },
+    { 0xFFu, 6u, 0xC0u },
+    { 0xFFu, 7u, 0x80u },
+    { 0xEFu, 0u, 0xEFu },
+    { 0xEFu, 1u, 0xDEu },
+    { 0xEFu, 2u, 0xBCu },
+    { 0xEFu, 3u, 0x78u },
+    { 0xEFu, 4u, 0xF0u },
+    { 0xEFu, 5u, 0xE0u },
+    { 0xEFu, 6u, 0xC0u },
+    { 0xEFu, 7u, 0x80u },
+    { 0x01u, 0u, 0x01u },
+    { 0x01u, 1u, 0x02u },
+    { 0x01u, 2u, 0x04u },
+    { 0x01u, 3u, 0x08u },
+    { 0x01u, 4u, 0x10u },
+    { 0x01u, 5u, 0x20u },
+    { 0x01u, 6u, 0x40u },
+    { 0x01u, 7u, 0x80u },
+    { 0x80u, 0u, 0x80u },
+    { 0x80u, 1u, 0x00u },
+    { 0x80u, 2u, 0x00u },
+    { 0x80u, 3u, 0x00u },
+    { 0x80u, 4u, 0x00u },
+    { 0x80u, 5u, 0x00u },
+    { 0x80u, 6u, 0x00u },
+    { 0x80u, 7u, 0x00u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitLt_u8u8 vectors**
+ *
+ * The test runs the 32 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00076, SWS_Bfx_00080
+ */
+void test__Bfx_ShiftBitLt_u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitLt_u8u8 ) / sizeof( ShiftBitLt_u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = ShiftBitLt_u8u8[ i ].Data;
+        Bfx_ShiftBitLt_u8u8( &Data, ShiftBitLt_u8u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( ShiftBitLt_u8u8[ i ].Expected, Data, Vector( "Bfx_ShiftBitLt_u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 ShiftCnt;
+    uint8 Expected;
+} RotBitRt_u8u8[] = {
+    { 0xFFu, 0u, 0xFFu },
+    { 0xFFu, 1u, 0xFFu },
+    { 0xFFu, 2u, 0xFFu },
+    { 0xFFu, 3u, 0xFFu },
+    { 0xFFu, 4u, 0xFFu },
+    { 0xFFu, 5u, 0xFFu },
+    { 0xFFu, 6u, 0xFFu },
+    { 0xFFu, 7u, 0xFFu },
+    { 0xEFu, 0u, 0xEFu },
+    { 0xEFu, 1u, 0xF7u },
+    { 0xEFu, 2u, 0xFBu },
+    { 0xEFu, 3u, 0xFDu },
+    { 0xEFu, 4u, 0xFEu },
+    { 0xEFu, 5u, 0x7Fu },
+    { 0xEFu, 6u, 0xBFu },
+    { 0xEFu, 7u, 0xDFu },
+    { 0x01u, 0u, 0x01u },
+    { 0x01u, 1u, 0x80u },
+    { 0x01u, 2u, 0x40u },
+    { 0x01u, 3u, 0x20u },
+    { 0x01u, 4u, 0x10u },
+    { 0x01u, 5u, 0x08u },
+    { 0x01u, 6u, 0x04u },
+    { 0x01u, 7u, 0x02u },
+    { 0x80u, 0u, 0x80u },
+    { 0x80u, 1u, 0x40u },
+    { 0x80u, 2u, 0x20u },
+    { 0x80u, 3u, 0x10u },
+    { 0x80u, 4u, 0x08u },
+    { 0x80u, 5u, 0x04u },
+    { 0x80u, 6u, 0x02u },
+    { 0x80u, 7u, 0x01u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_RotBitRt_u8u8 vectors**
+ *
+ * The test runs the 32 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00086, SWS_Bfx_00090
+ */
+void test__Bfx_RotBitRt_u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( RotBitRt_u8u8 ) / sizeof( RotBitRt_u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = RotBitRt_u8u8[ i ].Data;
+        Bfx_RotBitRt_u8u8( &Data, RotBitRt_u8u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( RotBitRt_u8u8[ i ].Expected, Data, Vector( "Bfx_RotBitRt_u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 ShiftCnt;
+    uint8 Expected;
+} RotBitLt_u8u8[] = {
+    { 0xFFu, 0u, 0xFFu },
+    { 0xFFu, 1u, 0xFFu },
+    { 0xFFu, 2u, 0xFFu },
+    { 0xFFu, 3u, 0xFFu },
+    { 0xFFu, 4u, 0xFFu },
+    { 0xFFu, 5u, 0xFFu },
+    { 0xFFu, 6u, 0xFFu },
+    { 0xFFu, 7u, 0xFFu },
+    { 0xEFu, 0u, 0xEFu },
+    { 0xEFu, 1u, 0xDFu },
+    { 0xEFu, 2u, 0xBFu },
+    { 0xEFu, 3u, 0x7Fu },
+    { 0xEFu, 4u, 0xFEu },
+    { 0xEFu, 5u, 0xFDu },
+    { 0xEFu, 6u, 0xFBu },
+    { 0xEFu, 7u, 0xF7u },
+    { 0x01u, 0u, 0x01u },
+    { 0x01u, 1u, 0x02u },
+    { 0x01u, 2u, 0x04u },
+    { 0x01u, 3u, 0x08u },
+    { 0x01u, 4u, 0x10u },
+    { 0x01u, 5u, 0x20u },
+    { 0x01u, 6u, 0x40u },
+    { 0x01u, 7u, 0x80u },
+    { 0x80u, 0u, 0x80u },
+    { 0x80u, 1u, 0x01u },
+    { 0x80u, 2u, 0x02u },
+    { 0x80u, 3u, 0x04u },
+    { 0x80u, 4u, 0x08u },
+    { 0x80u, 5u, 0x10u },
+    { 0x80u, 6u, 0x20u },
+    { 0x80u, 7u, 0x40u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_RotBitLt_u8u8 vectors**
+ *
+ * The test runs the 32 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00095, SWS_Bfx_00098
+ */
+void test__Bfx_RotBitLt_u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( RotBitLt_u8u8 ) / sizeof( RotBitLt_u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = RotBitLt_u8u8[ i ].Data;
+        Bfx_RotBitLt_u8u8( &Data, RotBitLt_u8u8[ i ].ShiftCnt );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( RotBitLt_u8u8[ i ].Expected, Data, Vector( "Bfx_RotBitLt_u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 DestinationData;
+    uint8 DestinationPosition;
+    uint8 SourceData;
+    uint8 SourcePosition;
+    uint8 Expected;
+} CopyBit_u8u8u8u8[] = {
+    { 0xAAu, 0u, 0x55u, 0u, 0xABu },
+    { 0xAAu, 0u, 0x55u, 1u, 0xAAu },
+    { 0xAAu, 0u, 0x55u, 2u, 0xABu },
+    { 0xAAu, 0u, 0x55u, 3u, 0xAAu },
+    { 0xAAu, 0u, 0x55u, 4u, 0xABu },
+    { 0xAAu, 0u, 0x55u, 5u, 0xAAu },
+    { 0xAAu, 0u, 0x55u, 6u, 0xABu },
+    { 0xAAu, 0u, 0x55u, 7u, 0xAAu },
+    { 0xAAu, 1u, 0x55u, 0u, 0xAAu },
+    { 0xAAu, 1u, 0x55u, 1u, 0xA8u },
+    { 0xAAu, 1u, 0x55u, 2u, 0xAAu },
+    { 0xAAu, 1u, 0x55u, 3u, 0xA8u },
+    { 0xAAu, 1u, 0x55u, 4u, 0xAAu },
+    { 0xAAu, 1u, 0x55u, 5u, 0xA8u },
+    { 0xAAu, 1u, 0x55u, 6u, 0xAAu },
+    { 0xAAu, 1u, 0x55u, 7u, 0xA8u },
+    { 0xAAu, 2u, 0x55u, 0u, 0xAEu },
+    { 0xAAu, 2u, 0x55u, 1u, 0xAAu },
+    { 0xAAu, 2u, 0x55u, 2u, 0xAEu },
+    { 0xAAu, 2u, 0x55u, 3u, 0xAAu },
+    { 0xAAu, 2u, 0x55u, 4u, 0xAEu },
+    { 0xAAu, 2u, 0x55u, 5u, 0xAAu },
+    { 0xAAu, 2u, 0x55u, 6u, 0xAEu },
+    { 0xAAu, 2u, 0x55u, 7u, 0xAAu },
+    { 0xAAu, 3u, 0x55u, 0u, 0xAAu },
+    { 0xAAu, 3u, 0x55u, 1u, 0xA2u },
+    { 0xAAu, 3u, 0x55u, 2u, 0xAAu },
+    { 0xAAu, 3u, 0x55u, 3u, 0xA2u },
+    { 0xAAu, 3u, 0x55u, 4u, 0xAAu },
+    { 0xAAu, 3u, 0x55u, 5u, 0xA2u },
+    { 0xAAu, 3u, 0x55u, 6u, 0xAAu },
+    { 0xAAu, 3u, 0x55u, 7u, 0xA2u },
+    { 0xAAu, 4u, 0x55u, 0u, 0xBAu },
+    { 0xAAu, 4u, 0x55u, 1u, 0xAAu },
+    { 0xAAu, 4u, 0x55u, 2u, 0xBAu },
+    { 0xAAu, 4u, 0x55u, 3u, 0xAAu },
+    { 0xAAu, 4u, 0x55u, 4u, 0xBAu },
+    { 0xAAu, 4u, 0x55u, 5u, 0xAAu },
+    { 0xAAu, 4u, 0x55u, 6u, 0xBAu },
+    { 0xAAu, 4u, 0x55u, 7u, 0xAAu },
+    { 0xAAu, 5u, 0x55u, 0u, 0xAAu },
+    { 0xAAu, 5u, 0x55u, 1u, 0x8Au },
+    { 0xAAu, 5u, 0x55u, 2u, 0xAAu },
+    { 0xAAu, 5u, 0x55u, 3u, 0x8Au },
+    { 0xAAu, 5u, 0x55u, 4u, 0xAAu },
+    { 0xAAu, 5u, 0x55u, 5u, 0x8Au },
+    { 0xAAu, 5u, 0x55u, 6u, 0xAAu },
+    { 0xAAu, 5u, 0x55u, 7u, 0x8Au },
+    { 0xAAu, 6u, 0x55u, 0u, 0xEAu },
+    { 0xAAu, 6u, 0x55u, 1u, 0xAAu },
+    { 0xAAu, 6u, 0x55u, 2u, 0xEAu },
+    { 0xAAu, 6u, 0x55u, 3u, 0xAAu },
+    { 0xAAu, 6u, 0x55u, 4u, 0xEAu },
+    { 0xAAu, 6u, 0x55u, 5u, 0xAAu },
+    { 0xAAu, 6u, 0x55u, 6u, 0xEAu },
+    { 0xAAu, 6u, 0x55u, 7u, 0xAAu },
+    { 0xAAu, 7u, 0x55u, 0u, 0xAAu },
+    { 0xAAu, 7u, 0x55u, 1u, 0x2Au },
+    { 0xAAu, 7u, 0x55u, 2u, 0xAAu },
+    { 0xAAu, 7u, 0x55u, 3u, 0x2Au },
+    { 0xAAu, 7u, 0x55u, 4u, 0xAAu },
+    { 0xAAu, 7u, 0x55u, 5u, 0x2Au },
+    { 0xAAu, 7u, 0x55u, 6u, 0xAAu },
+    { 0xAAu, 7u, 0x55u, 7u, 0x2Au },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CopyBit_u8u8u8u8 vectors**
+ *
+ * The test runs the 64 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00101, SWS_Bfx_00108
+ */
+void test__Bfx_CopyBit_u8u8u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CopyBit_u8u8u8u8 ) / sizeof( CopyBit_u8u8u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 DestinationData = CopyBit_u8u8u8u8[ i ].DestinationData;
+        Bfx_CopyBit_u8u8u8u8( &DestinationData, CopyBit_u8u8u8u8[ i ].DestinationPosition, CopyBit_u8u8u8u8[ i ].SourceData, CopyBit_u8u8u8u8[ i ].SourcePosition );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( CopyBit_u8u8u8u8[ i ].Expected, DestinationData, Vector( "Bfx_CopyBit_u8u8u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 Pattern;
+    uint8 Mask;
+    uint8 Expected;
+} PutBitsMask_u8u8u8[] = {
+    { 0x00u, 0x00u, 0x00u, 0x00u },
+    { 0x00u, 0x00u, 0xFFu, 0x00u },
+    { 0x00u, 0x00u, 0xAAu, 0x00u },
+    { 0x00u, 0x00u, 0xEFu, 0x00u },
+    { 0x00u, 0xFFu, 0x00u, 0x00u },
+    { 0x00u, 0xFFu, 0xFFu, 0xFFu },
+    { 0x00u, 0xFFu, 0xAAu, 0xAAu },
+    { 0x00u, 0xFFu, 0xEFu, 0xEFu },
+    { 0x00u, 0x55u, 0x00u, 0x00u },
+    { 0x00u, 0x55u, 0xFFu, 0x55u },
+    { 0x00u, 0x55u, 0xAAu, 0x00u },
+    { 0x00u, 0x55u, 0xEFu, 0x45u },
+    { 0x00u, 0xEFu, 0x00u, 0x00u },
+    { 0x00u, 0xEFu, 0xFFu, 0xEFu },
+    { 0x00u, 0xEFu, 0xAAu, 0xAAu },
+    { 0x00u, 0xEFu, 0xEFu, 0xEFu },
+    { 0xFFu, 0x00u, 0x00u, 0xFFu },
+    { 0xFFu, 0x00u, 0xFFu, 0x00u },
+    { 0xFFu, 0x00u, 0xAAu, 0x55u },
+    { 0xFFu, 0x00u, 0xEFu, 0x10u },
+    { 0xFFu, 0xFFu, 0x00u, 0xFFu },
+    { 0xFFu, 0xFFu, 0xFFu, 0xFFu },
+    { 0xFFu, 0xFFu, 0xAAu, 0xFFu },
+    { 0xFFu, 0xFFu, 0xEFu, 0xFFu },
+    { 0xFFu, 0x55u, 0x00u, 0xFFu },
+    { 0xFFu, 0x55u, 0xFFu, 0x55u },
+    { 0xFFu, 0x55u, 0xAAu, 0x55u },
+    { 0xFFu, 0x55u, 0xEFu, 0x55u },
+    { 0xFFu, 0xEFu, 0x00u, 0xFFu },
+    { 0xFFu, 0xEFu, 0xFFu, 0xEFu },
+    { 0xFFu, 0xEFu, 0xAAu, 0xFFu },
+    { 0xFFu, 0xEFu, 0xEFu, 0xFFu },
+    { 0x55u, 0x00u, 0x00u, 0x55u },
+    { 0x55u, 0x00u, 0xFFu, 0x00u },
+    { 0x55u, 0x00u, 0xAAu, 0x55u },
+    { 0x55u, 0x00u, 0xEFu, 0x10u },
+    { 0x55u, 0xFFu, 0x00u, 0x55u },
+    { 0x55u, 0xFFu, 0xFFu, 0xFFu },
+    { 0x55u, 0xFFu, 0xAAu, 0xFFu },
+    { 0x55u, 0xFFu, 0xEFu, 0xFFu },
+    { 0x55u, 0x55u, 0x00u, 0x55u },
+    { 0x55u, 0x55u, 0xFFu, 0x55u },
+    { 0x55u, 0x55u, 0xAAu, 0x55u },
+    { 0x55u, 0x55u, 0xEFu, 0x55u },
+    { 0x55u, 0xEFu, 0x00u, 0x55u },
+    { 0x55u, 0xEFu, 0xFFu, 0xEFu },
+    { 0x55u, 0xEFu, 0xAAu, 0xFFu },
+    { 0x55u, 0xEFu, 0xEFu, 0xFFu },
+    { 0xEFu, 0x00u, 0x00u, 0xEFu },
+    { 0xEFu, 0x00u, 0xFFu, 0x00u },
+    { 0xEFu, 0x00u, 0xAAu, 0x45u },
+    { 0xEFu, 0x00u, 0xEFu, 0x00u },
+    { 0xEFu, 0xFFu, 0x00u, 0xEFu },
+    { 0xEFu, 0xFFu, 0xFFu, 0xFFu },
+    { 0xEFu, 0xFFu, 0xAAu, 0xEFu },
+    { 0xEFu, 0xFFu, 0xEFu, 0xEFu },
+    { 0xEFu, 0x55u, 0x00u, 0xEFu },
+    { 0xEFu, 0x55u, 0xFFu, 0x55u },
+    { 0xEFu, 0x55u, 0xAAu, 0x45u },
+    { 0xEFu, 0x55u, 0xEFu, 0x45u },
+    { 0xEFu, 0xEFu, 0x00u, 0xEFu },
+    { 0xEFu, 0xEFu, 0xFFu, 0xEFu },
+    { 0xEFu, 0xEFu, 0xAAu, 0xEFu },
+    { 0xEFu, 0xEFu, 0xEFu, 0xEFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_PutBitsMask_u8u8u8 vectors**
+ *
+ * The test runs the 64 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_00120, SWS_Bfx_00124
+ */
+void test__Bfx_PutBitsMask_u8u8u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( PutBitsMask_u8u8u8 ) / sizeof( PutBitsMask_u8u8u8[ 0 ] ) ); i++ )
+    {
+        uint8 Data = PutBitsMask_u8u8u8[ i ].Data;
+        Bfx_PutBitsMask_u8u8u8( &Data, PutBitsMask_u8u8u8[ i ].Pattern, PutBitsMask_u8u8u8[ i ].Mask );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( PutBitsMask_u8u8u8[ i ].Expected, Data, Vector( "Bfx_PutBitsMask_u8u8u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    sint8 ShiftCnt;
+    uint8 Expected;
+} ShiftBitSat_u8s8_u8[] = {
+    { 0x10u,  3, 0x80u },
+    { 0x10u,  4, 0xFFu },
+    { 0x10u, -4, 0x01u },
+    { 0x56u,  2, 0xFFu },
+    { 0x00u, -7, 0x00u },
+    { 0x00u, -6, 0x00u },
+    { 0x00u, -5, 0x00u },
+    { 0x00u, -4, 0x00u },
+    { 0x00u, -3, 0x00u },
+    { 0x00u, -2, 0x00u },
+    { 0x00u, -1, 0x00u },
+    { 0x00u,  0, 0x00u },
+    { 0x00u,  1, 0x00u },
+    { 0x00u,  2, 0x00u },
+    { 0x00u,  3, 0x00u },
+    { 0x00u,  4, 0x00u },
+    { 0x00u,  5, 0x00u },
+    { 0x00u,  6, 0x00u },
+    { 0x00u,  7, 0x00u },
+    { 0xFFu, -7, 0x01u },
+    { 0xFFu, -6, 0x03u },
+    { 0xFFu, -5, 0x07u },
+    { 0xFFu, -4, 0x0Fu },
+    { 0xFFu, -3, 0x1Fu },
+    { 0xFFu, -2, 0x3Fu },
+    { 0xFFu, -1, 0x7Fu },
+    { 0xFFu,  0, 0xFFu },
+    { 0xFFu,  1, 0xFFu },
+    { 0xFFu,  2, 0xFFu },
+    { 0xFFu,  3, 0xFFu },
+    { 0xFFu,  4, 0xFFu },
+    { 0xFFu,  5, 0xFFu },
+    { 0xFFu,  6, 0xFFu },
+    { 0xFFu,  7, 0xFFu },
+    { 0x01u, -7, 0x00u },
+    { 0x01u, -6, 0x00u },
+    { 0x01u, -5, 0x00u },
+    { 0x01u, -4, 0x00u },
+    { 0x01u, -3, 0x00u },
+    { 0x01u, -2, 0x00u },
+    { 0x01u, -1, 0x00u },
+    { 0x01u,  0, 0x01u },
+    { 0x01u,  1, 0x02u },
+    { 0x01u,  2, 0x04u },
+    { 0x01u,  3, 0x08u },
+    { 0x01u,  4, 0x10u },
+    { 0x01u,  5, 0x20u },
+    { 0x01u,  6, 0x40u },
+    { 0x01u,  7, 0x80u },
+    { 0x80u, -7, 0x01u },
+    { 0x80u, -6, 0x02u },
+    { 0x80u, -5, 0x04u },
+    { 0x80u, -4, 0x08u },
+    { 0x80u, -3, 0x10u },
+    { 0x80u, -2, 0x20u },
+    { 0x80u, -1, 0x40u },
+    { 0x80u,  0, 0x80u },
+    { 0x80u,  1, 0xFFu },
+    { 0x80u,  2, 0xFFu },
+    { 0x80u,  3, 0xFFu },
+    { 0x80u,  4, 0xFFu },
+    { 0x80u,  5, 0xFFu },
+    { 0x80u,  6, 0xFFu },
+    { 0x80u,  7, 0xFFu },
+    { 0xEFu, -7, 0x01u },
+    { 0xEFu, -6, 0x03u },
+    { 0xEFu, -5, 0x07u },
+    { 0xEFu, -4, 0x0Eu },
+    { 0xEFu, -3, 0x1Du },
+    { 0xEFu, -2, 0x3Bu },
+    { 0xEFu, -1, 0x77u },
+    { 0xEFu,  0, 0xEFu },
+    { 0xEFu,  1, 0xFFu },
+    { 0xEFu,  2, 0xFFu },
+    { 0xEFu,  3, 0xFFu },
+    { 0xEFu,  4, 0xFFu },
+    { 0xEFu,  5, 0xFFu },
+    { 0xEFu,  6, 0xFFu },
+    { 0xEFu,  7, 0xFFu },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitSat_u8s8_u8 vectors**
+ *
+ * The test runs the 79 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91002, SWS_Bfx_00134, SWS_Bfx_00135
+ */
+void test__Bfx_ShiftBitSat_u8s8_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitSat_u8s8_u8 ) / sizeof( ShiftBitSat_u8s8_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( ShiftBitSat_u8s8_u8[ i ].Expected, Bfx_ShiftBitSat_u8s8_u8( ShiftBitSat_u8s8_u8[ i ].Data, ShiftBitSat_u8s8_u8[ i ].ShiftCnt ), Vector( "Bfx_ShiftBitSat_u8s8_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    sint8 Data;
+    sint8 ShiftCnt;
+    sint8 Expected;
+} ShiftBitSat_s8s8_s8[] = {
+    {      -32,  2, INT8_MIN },
+    {      -33,  2, INT8_MIN },
+    {       32,  2,      127 },
+    { INT8_MIN, -7,       -1 },
+    {        0, -7,        0 },
+    {        0, -6,        0 },
+    {        0, -5,        0 },
+    {        0, -4,        0 },
+    {        0, -3,        0 },
+    {        0, -2,        0 },
+    {        0, -1,        0 },
+    {        0,  0,        0 },
+    {        0,  1,        0 },
+    {        0,  2,        0 },
+    {        0,  3,        0 },
+    {        0,  4,        0 },
+    {        0,  5,        0 },
+    {        0,  6,        0 },
+    {        0,  7,        0 },
+    {       -1, -7,       -1 },
+    {       -1, -6,       -1 },
+    {       -1, -5,       -1 },
+    {       -1, -4,       -1 },
+    {       -1, -3,       -1 },
+    {       -1, -2,       -1 },
+    {       -1, -1,       -1 },
+    {       -1,  0,       -1 },
+    {       -1,  1,       -2 },
+    {       -1,  2,       -4 },
+    {       -1,  3,       -8 },
+    {       -1,  4,      -16 },
+    {       -1,  5,      -32 },
+    {       -1,  6,      -64 },
+    {       -1,  7, INT8_MIN },
+    {        1, -7,        0 },
+    {        1, -6,        0 },
+    {        1, -5,        0 },
+    {        1, -4,        0 },
+    {        1, -3,        0 },
+    {        1, -2,        0 },
+    {        1, -1,        0 },
+    {        1,  0,        1 },
+    {        1,  1,        2 },
+    {        1,  2,        4 },
+    {        1,  3,        8 },
+    {        1,  4,       16 },
+    {        1,  5,       32 },
+    {        1,  6,       64 },
+    {        1,  7,      127 },
+    { INT8_MIN, -7,       -1 },
+    { INT8_MIN, -6,       -2 },
+    { INT8_MIN, -5,       -4 },
+    { INT8_MIN, -4,       -8 },
+    { INT8_MIN, -3,      -16 },
+    { INT8_MIN, -2,      -32 },
+    { INT8_MIN, -1,      -64 },
+    { INT8_MIN,  0, INT8_MIN },
+    { INT8_MIN,  1, INT8_MIN },
+    { INT8_MIN,  2, INT8_MIN },
+    { INT8_MIN,  3, INT8_MIN },
+    { INT8_MIN,  4, INT8_MIN },
+    { INT8_MIN,  5, INT8_MIN },
+    { INT8_MIN,  6, INT8_MIN },
+    { INT8_MIN,  7, INT8_MIN },
+    {      127, -7,        0 },
+    {      127, -6,        1 },
+    {      127, -5,        3 },
+    {      127, -4,        7 },
+    {      127, -3,       15 },
+    {      127, -2,       31 },
+    {      127, -1,       63 },
+    {      127,  0,      127 },
+    {      127,  1,      127 },
+    {      127,  2,      127 },
+    {      127,  3,      127 },
+    {      127,  4,      127 },
+    {      127,  5,      127 },
+    {      127,  6,      127 },
+    {      127,  7,      127 },
+    {      -17, -7,       -1 },
+    {      -17, -6,       -1 },
+    {      -17, -5,       -1 },
+    {      -17, -4,       -2 },
+    {      -17, -3,       -3 },
+    {      -17, -2,       -5 },
+    {      -17, -1,       -9 },
+    {      -17,  0,      -17 },
+    {      -17,  1,      -34 },
+    {      -17,  2,      -68 },
+    {      -17,  3, INT8_MIN },
+    {      -17,  4, INT8_MIN },
+    {      -17,  5, INT8_MIN },
+    {      -17,  6, INT8_MIN },
+    {      -17,  7, INT8_MIN },
+    {      -86, -7,       -1 },
+    {      -86, -6,       -2 },
+    {      -86, -5,       -3 },
+    {      -86, -4,       -6 },
+    {      -86, -3,      -11 },
+    {      -86, -2,      -22 },
+    {      -86, -1,      -43 },
+    {      -86,  0,      -86 },
+    {      -86,  1, INT8_MIN },
+    {      -86,  2, INT8_MIN },
+    {      -86,  3, INT8_MIN },
+    {      -86,  4, INT8_MIN },
+    {      -86,  5, INT8_MIN },
+    {      -86,  6, INT8_MIN },
+    {      -86,  7, INT8_MIN },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ShiftBitSat_s8s8_s8 vectors**
+ *
+ * The test runs the 109 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91002, SWS_Bfx_00134, SWS_Bfx_00135
+ */
+void test__Bfx_ShiftBitSat_s8s8_s8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ShiftBitSat_s8s8_s8 ) / sizeof( ShiftBitSat_s8s8_s8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_INT8_MESSAGE( ShiftBitSat_s8s8_s8[ i ].Expected, Bfx_ShiftBitSat_s8s8_s8( ShiftBitSat_s8s8_s8[ i ].Data, ShiftBitSat_s8s8_s8[ i ].ShiftCnt ), Vector( "Bfx_ShiftBitSat_s8s8_s8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 Expected;
+} CountLeadingOnes_u8[] = {
+    { 0x00u, 0u },
+    { 0xFFu, 8u },
+    { 0xEFu, 3u },
+    { 0x01u, 0u },
+    { 0x02u, 0u },
+    { 0x04u, 0u },
+    { 0x08u, 0u },
+    { 0x10u, 0u },
+    { 0x20u, 0u },
+    { 0x40u, 0u },
+    { 0x80u, 1u },
+    { 0x00u, 0u },
+    { 0x80u, 1u },
+    { 0xC0u, 2u },
+    { 0xE0u, 3u },
+    { 0xF0u, 4u },
+    { 0xF8u, 5u },
+    { 0xFCu, 6u },
+    { 0xFEu, 7u },
+    { 0xFFu, 8u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CountLeadingOnes_u8 vectors**
+ *
+ * The test runs the 20 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91003, SWS_Bfx_00137
+ */
+void test__Bfx_CountLeadingOnes_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CountLeadingOnes_u8 ) / sizeof( CountLeadingOnes_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( CountLeadingOnes_u8[ i ].Expected, Bfx_CountLeadingOnes_u8( CountLeadingOnes_u8[ i ].Data ), Vector( "Bfx_CountLeadingOnes_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    sint8 Data;
+    uint8 Expected;
+} CountLeadingSigns_s8[] = {
+    {       -1, 7u },
+    {        0, 7u },
+    {        1, 6u },
+    { INT8_MIN, 0u },
+    {        0, 7u },
+    {       -1, 7u },
+    {      -17, 2u },
+    {      127, 0u },
+    {        1, 6u },
+    {        2, 5u },
+    {        4, 4u },
+    {        8, 3u },
+    {       16, 2u },
+    {       32, 1u },
+    {       64, 0u },
+    { INT8_MIN, 0u },
+    {        0, 7u },
+    {        1, 6u },
+    {        3, 5u },
+    {        7, 4u },
+    {       15, 3u },
+    {       31, 2u },
+    {       63, 1u },
+    {      127, 0u },
+    {       -1, 7u },
+    {        0, 7u },
+    { INT8_MIN, 0u },
+    {      -64, 1u },
+    {      -32, 2u },
+    {      -16, 3u },
+    {       -8, 4u },
+    {       -4, 5u },
+    {       -2, 6u },
+    {       -1, 7u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CountLeadingSigns_s8 vectors**
+ *
+ * The test runs the 34 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91004, SWS_Bfx_00139
+ */
+void test__Bfx_CountLeadingSigns_s8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CountLeadingSigns_s8 ) / sizeof( CountLeadingSigns_s8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( CountLeadingSigns_s8[ i ].Expected, Bfx_CountLeadingSigns_s8( CountLeadingSigns_s8[ i ].Data ), Vector( "Bfx_CountLeadingSigns_s8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 Expected;
+} CountLeadingZeros_u8[] = {
+    { 0x00u, 8u },
+    { 0x00u, 8u },
+    { 0xFFu, 0u },
+    { 0xEFu, 0u },
+    { 0x01u, 7u },
+    { 0x02u, 6u },
+    { 0x04u, 5u },
+    { 0x08u, 4u },
+    { 0x10u, 3u },
+    { 0x20u, 2u },
+    { 0x40u, 1u },
+    { 0x80u, 0u },
+    { 0x00u, 8u },
+    { 0x01u, 7u },
+    { 0x03u, 6u },
+    { 0x07u, 5u },
+    { 0x0Fu, 4u },
+    { 0x1Fu, 3u },
+    { 0x3Fu, 2u },
+    { 0x7Fu, 1u },
+    { 0xFFu, 0u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_CountLeadingZeros_u8 vectors**
+ *
+ * The test runs the 21 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ *
+ * @test    SWS_Bfx_91005, SWS_Bfx_00141
+ */
+void test__Bfx_CountLeadingZeros_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( CountLeadingZeros_u8 ) / sizeof( CountLeadingZeros_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE( CountLeadingZeros_u8[ i ].Expected, Bfx_CountLeadingZeros_u8( CountLeadingZeros_u8[ i ].Data ), Vector( "Bfx_CountLeadingZeros_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 Mask;
+    uint8 Expected;
+} DepositBits_u8u8_u8[] = {
+    { 0x05u, 0xF0u, 0x50u },
+    { 0xFFu, 0x00u, 0x00u },
+    { 0xFFu, 0xFFu, 0xFFu },
+    { 0xFFu, 0x55u, 0x55u },
+    { 0xFFu, 0xAAu, 0xAAu },
+    { 0xFFu, 0xEFu, 0xEFu },
+    { 0xFFu, 0x01u, 0x01u },
+    { 0xFFu, 0x02u, 0x02u },
+    { 0xFFu, 0x04u, 0x04u },
+    { 0xFFu, 0x08u, 0x08u },
+    { 0xFFu, 0x10u, 0x10u },
+    { 0xFFu, 0x20u, 0x20u },
+    { 0xFFu, 0x40u, 0x40u },
+    { 0xFFu, 0x80u, 0x80u },
+    { 0xEFu, 0x00u, 0x00u },
+    { 0xEFu, 0xFFu, 0xEFu },
+    { 0xEFu, 0x55u, 0x55u },
+    { 0xEFu, 0xAAu, 0xAAu },
+    { 0xEFu, 0xEFu, 0xCFu },
+    { 0xEFu, 0x01u, 0x01u },
+    { 0xEFu, 0x02u, 0x02u },
+    { 0xEFu, 0x04u, 0x04u },
+    { 0xEFu, 0x08u, 0x08u },
+    { 0xEFu, 0x10u, 0x10u },
+    { 0xEFu, 0x20u, 0x20u },
+    { 0xEFu, 0x40u, 0x40u },
+    { 0xEFu, 0x80u, 0x80u },
+    { 0x55u, 0x00u, 0x00u },
+    { 0x55u, 0xFFu, 0x55u },
+    { 0x55u, 0x55u, 0x11u },
+    { 0x55u, 0xAAu, 0x22u },
+    { 0x55u, 0xEFu, 0xA5u },
+    { 0x55u, 0x01u, 0x01u },
+    { 0x55u, 0x02u, 0x02u },
+    { 0x55u, 0x04u, 0x04u },
+    { 0x55u, 0x08u, 0x08u },
+    { 0x55u, 0x10u, 0x10u },
+    { 0x55u, 0x20u, 0x20u },
+    { 0x55u, 0x40u, 0x40u },
+    { 0x55u, 0x80u, 0x80u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_DepositBits_u8u8_u8 vectors**
+ *
+ * The test runs the 40 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ */
+void test__Bfx_DepositBits_u8u8_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( DepositBits_u8u8_u8 ) / sizeof( DepositBits_u8u8_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( DepositBits_u8u8_u8[ i ].Expected, Bfx_DepositBits_u8u8_u8( DepositBits_u8u8_u8[ i ].Data, DepositBits_u8u8_u8[ i ].Mask ), Vector( "Bfx_DepositBits_u8u8_u8", i ) );
+    }
+}
+
+/* clang-format off */
+static const struct
+{
+    uint8 Data;
+    uint8 Mask;
+    uint8 Expected;
+} ExtractBits_u8u8_u8[] = {
+    { 0x50u, 0xF0u, 0x05u },
+    { 0xFFu, 0x00u, 0x00u },
+    { 0xFFu, 0xFFu, 0xFFu },
+    { 0xFFu, 0x55u, 0x0Fu },
+    { 0xFFu, 0xAAu, 0x0Fu },
+    { 0xFFu, 0xEFu, 0x7Fu },
+    { 0xFFu, 0x01u, 0x01u },
+    { 0xFFu, 0x02u, 0x01u },
+    { 0xFFu, 0x04u, 0x01u },
+    { 0xFFu, 0x08u, 0x01u },
+    { 0xFFu, 0x10u, 0x01u },
+    { 0xFFu, 0x20u, 0x01u },
+    { 0xFFu, 0x40u, 0x01u },
+    { 0xFFu, 0x80u, 0x01u },
+    { 0xEFu, 0x00u, 0x00u },
+    { 0xEFu, 0xFFu, 0xEFu },
+    { 0xEFu, 0x55u, 0x0Bu },
+    { 0xEFu, 0xAAu, 0x0Fu },
+    { 0xEFu, 0xEFu, 0x7Fu },
+    { 0xEFu, 0x01u, 0x01u },
+    { 0xEFu, 0x02u, 0x01u },
+    { 0xEFu, 0x04u, 0x01u },
+    { 0xEFu, 0x08u, 0x01u },
+    { 0xEFu, 0x10u, 0x00u },
+    { 0xEFu, 0x20u, 0x01u },
+    { 0xEFu, 0x40u, 0x01u },
+    { 0xEFu, 0x80u, 0x01u },
+    { 0x55u, 0x00u, 0x00u },
+    { 0x55u, 0xFFu, 0x55u },
+    { 0x55u, 0x55u, 0x0Fu },
+    { 0x55u, 0xAAu, 0x00u },
+    { 0x55u, 0xEFu, 0x25u },
+    { 0x55u, 0x01u, 0x01u },
+    { 0x55u, 0x02u, 0x00u },
+    { 0x55u, 0x04u, 0x01u },
+    { 0x55u, 0x08u, 0x00u },
+    { 0x55u, 0x10u, 0x01u },
+    { 0x55u, 0x20u, 0x00u },
+    { 0x55u, 0x40u, 0x01u },
+    { 0x55u, 0x80u, 0x00u },
+};
+/* clang-format on */
+
+/**
+ * @brief   **Test Bfx_ExtractBits_u8u8_u8 vectors**
+ *
+ * The test runs the 40 vectors of the table, every vector holds the arguments and the
+ * expected result.
+ */
+void test__Bfx_ExtractBits_u8u8_u8__vectors( void )
+{
+    for( uint32 i = 0u; i < ( sizeof( ExtractBits_u8u8_u8 ) / sizeof( ExtractBits_u8u8_u8[ 0 ] ) ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( ExtractBits_u8u8_u8[ i ].Expected, Bfx_ExtractBits_u8u8_u8( ExtractBits_u8u8_u8[ i ].Data, ExtractBits_u8u8_u8[ i ].Mask ), Vector( "Bfx_ExtractBits_u8u8_u8", i ) );
+    }
+}
@@ -0,0 +1,33 @@
+/**
+ * @file    Test_Crc.c
+ * @brief   **Unit Test for the CRC Routines**
+ *
+ * The tests run with the default Crc_Cfg.h options, the 256 entries table for each CRC. The check
+ * value and chained cases are in Crc_Check.c, shared with the other configurations.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Crc.h"
+
+static const uint8 Check[ 9 ] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test CRC32 of zero bytes**
+ *
+ * The test validates the CRC32 of an empty block, to pass the result should be 0x00000000 the
+ * initial value xored with the final xor value.
+ */
+void test__Crc_CalculateCRC32__empty( void )
+{
+    uint32 Crc;
+    Crc = Crc_CalculateCRC32( Check, 0u, 0u, TRUE );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000u, Crc, "Value is not 0x00000000 as supposed to be" );
+}
@@ -0,0 +1,143 @@
+/**
+ * @file    Test_Crc_Hw.c
+ * @brief   **Unit Test for the CRC Routines with the CRC hardware unit**
+ *
+ * The test overrides the Crc_Cfg.h options in project.yml to build the hardware implementations. The
+ * CRC unit and the RCC clock enable register are modelled in RAM, the model computes the CRC the
+ * same way the stm32g0xx CRC unit does, with the polynomial size and bit reversal options written
+ * in the control register. The check value and chained cases in Crc_Check.c run over this model.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Crc.h"
+
+#define CRC_BASE    0x40023000u
+#define CRC_DR      ( CRC_BASE + 0x00u )
+#define CRC_CR      ( CRC_BASE + 0x08u )
+#define CRC_INIT    ( CRC_BASE + 0x10u )
+#define CRC_POL     ( CRC_BASE + 0x14u )
+#define RCC_AHBENR  0x40021038u
+#define RCC_CRCEN   0x00001000u
+
+static uint32 CrcDr;
+static uint32 CrcCr;
+static uint32 CrcInit;
+static uint32 CrcPol;
+static uint32 RccAhbenr;
+static uint32 ByteWrites;
+
+static uint32 Reflect( uint32 Value, uint32 Bits )
+{
+    uint32 Result = 0u;
+
+    for( uint32 i = 0u; i < Bits; i++ )
+    {
+        Result = ( Result << 1u ) | ( ( Value >> i ) & 1u );
+    }
+    return Result;
+}
+
+static uint32 PolySize( void )
+{
+    static const uint32 Sizes[ 4 ] = { 32u, 16u, 8u, 7u };
+    return Sizes[ ( CrcCr >> 3u ) & 3u ];
+}
+
+uint32 Reg_HostRead32( uint32 Address )
+{
+    uint32 Value = 0u;
+
+    if( Address == RCC_AHBENR )
+    {
+        Value = RccAhbenr;
+    }
+    else if( Address == CRC_DR )
+    {
+        Value = ( ( CrcCr & 0x80u ) != 0u ) ? Reflect( CrcDr, PolySize( ) ) : CrcDr;
+    }
+    else
+    {
+        TEST_FAIL_MESSAGE( "Register read is not modelled" );
+    }
+    return Value;
+}
+
+void Reg_HostWrite32( uint32 Address, uint32 Value )
+{
+    uint32 Size = PolySize( );
+
+    if( Address == RCC_AHBENR )
+    {
+        RccAhbenr = Value;
+    }
+    else if( Address == CRC_INIT )
+    {
+        CrcInit = Value;
+    }
+    else if( Address == CRC_POL )
+    {
+        CrcPol = Value;
+    }
+    else if( Address == CRC_CR )
+    {
+        TEST_ASSERT_MESSAGE( ( RccAhbenr & RCC_CRCEN ) != 0u, "CRC clock is not enabled" );
+        CrcCr = Value & ~1u;
+        Size  = PolySize( );
+        if( ( Value & 1u ) != 0u )
+        {
+            CrcDr = ( Size == 32u ) ? CrcInit : ( CrcInit & ( ( 1u << Size ) - 1u ) );
+        }
+    }
+    else
+    {
+        TEST_FAIL_MESSAGE( "Register write is not modelled" );
+    }
+}
+
+void Reg_HostWrite8( uint32 Address, uint8 Value )
+{
+    uint32 Size = PolySize( );
+    uint32 Top  = 1u << ( Size - 1u );
+    uint32 Data = ( ( CrcCr & 0x60u ) == 0x20u ) ? Reflect( Value, 8u ) : Value;
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CRC_DR, Address, "Byte write is not to the data register" );
+    ByteWrites++;
+    CrcDr ^= Data << ( Size - 8u );
+    for( uint32 Bit = 0u; Bit < 8u; Bit++ )
+    {
+        CrcDr = ( ( CrcDr & Top ) != 0u ) ? ( ( CrcDr << 1u ) ^ CrcPol ) : ( CrcDr << 1u );
+    }
+    if( Size < 32u )
+    {
+        CrcDr &= ( 1u << Size ) - 1u;
+    }
+}
+
+static const uint8 Check[ 9 ] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+void setUp( void )
+{
+    CrcDr      = 0u;
+    CrcCr      = 0u;
+    CrcInit    = 0u;
+    CrcPol     = 0u;
+    RccAhbenr  = 0u;
+    ByteWrites = 0u;
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test hardware unit clock enable**
+ *
+ * The test validates the CRC clock is enabled before the CRC unit is used and the data is written
+ * one byte at the time, to pass the CRCEN bit should be set and the byte writes should be 9.
+ */
+void test__Crc_CalculateCRC32__clock_enable( void )
+{
+    (void)Crc_CalculateCRC32( Check, sizeof( Check ), 0u, TRUE );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( RCC_CRCEN, RccAhbenr, "Value is not 0x00001000 as supposed to be" );
+    TEST_ASSERT_EQUAL_MESSAGE( 9u, ByteWrites, "Data was not written byte by byte" );
+}
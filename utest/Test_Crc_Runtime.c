@@ -0,0 +1,18 @@
+/**
+ * @file    Test_Crc_Runtime.c
+ * @brief   **Unit Test for the CRC Routines calculated bit by bit**
+ *
+ * The test overrides the Crc_Cfg.h options in project.yml to build the bit by bit implementations.
+ * The implementations have no case of their own, the ones in Crc_Check.c run with this setUp.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Crc.h"
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
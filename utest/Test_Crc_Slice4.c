@@ -0,0 +1,35 @@
+/**
+ * @file    Test_Crc_Slice4.c
+ * @brief   **Unit Test for the CRC Routines with slicing by 4**
+ *
+ * The test overrides the Crc_Cfg.h options in project.yml to build the slicing by 4 implementations,
+ * the lengths used here and in Crc_Check.c exercise the four bytes loop and the byte tail.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Crc.h"
+
+static const uint8 Check[ 9 ] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test CRC32 slicing tail**
+ *
+ * The test validates the CRC32 of the string "123456789" calculated in three calls of 3, 4 and 2
+ * bytes, to pass the result should be 0xCBF43926 no matter where the four bytes blocks start.
+ */
+void test__Crc_CalculateCRC32__unaligned( void )
+{
+    uint32 Crc;
+    Crc = Crc_CalculateCRC32( &Check[ 0 ], 3u, 0u, TRUE );
+    Crc = Crc_CalculateCRC32( &Check[ 3 ], 4u, Crc, FALSE );
+    Crc = Crc_CalculateCRC32( &Check[ 7 ], 2u, Crc, FALSE );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xCBF43926u, Crc, "Value is not 0xCBF43926 as supposed to be" );
+}
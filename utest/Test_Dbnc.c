@@ -0,0 +1,149 @@
+/**
+ * @file    Test_Dbnc.c
+ * @brief   **Unit Test for the Bit Parallel Input Debouncing**
+ *
+ * The tests feed sequences of port snapshots to the debouncing engine and check when each input
+ * changes its debounced state.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Dbnc.h"
+
+static Dbnc_StateType State;
+
+void setUp( void )
+{
+    (void)Dbnc_Init( &State, 0u, 4u );
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test init with invalid depths**
+ *
+ * The test validates a depth of zero or a depth that does not fit in the counter bits is rejected,
+ * to pass both calls should return E_NOT_OK.
+ */
+void test__Dbnc_Init__invalid_depth( void )
+{
+    Std_ReturnType Status;
+    Status = Dbnc_Init( &State, 0u, 0u );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Status, "Depth 0 was not rejected as supposed to be" );
+    Status = Dbnc_Init( &State, 0u, ( 1u << DBNC_COUNTER_BITS ) );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Status, "Depth out of range was not rejected as supposed to be" );
+}
+
+/**
+ * @brief   **Test init with initial state**
+ *
+ * The test validates the debounced state is the initial value after init, to pass the stable state
+ * should be 0x00008001.
+ */
+void test__Dbnc_Init__initial_state( void )
+{
+    Std_ReturnType Status;
+    Status = Dbnc_Init( &State, 0x00008001u, 1u );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Status, "Init did not return E_OK as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00008001u, Dbnc_GetStable( &State ), "Value is not 0x00008001 as supposed to be" );
+}
+
+/**
+ * @brief   **Test input accepted after depth samples**
+ *
+ * The test validates pins 0 and 31 sampled high with a depth of 4 are not accepted on the first
+ * three samples, to pass the state should change on the fourth sample.
+ */
+void test__Dbnc_Update__press( void )
+{
+    Dbnc_LaneType Changed;
+    for( uint8 i = 0u; i < 3u; i++ )
+    {
+        Changed = Dbnc_Update( &State, 0x80000001u );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0u, Changed, "Input changed before the depth was reached" );
+    }
+    Changed = Dbnc_Update( &State, 0x80000001u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x80000001u, Changed, "Value is not 0x80000001 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x80000001u, Dbnc_GetStable( &State ), "Value is not 0x80000001 as supposed to be" );
+}
+
+/**
+ * @brief   **Test bouncing input is rejected**
+ *
+ * The test validates a pin that goes back to its debounced state before the depth is reached
+ * restarts its count, to pass the pin should need four new consecutive samples.
+ */
+void test__Dbnc_Update__bounce( void )
+{
+    Dbnc_LaneType Changed;
+    (void)Dbnc_Update( &State, 0x00000010u );
+    (void)Dbnc_Update( &State, 0x00000010u );
+    (void)Dbnc_Update( &State, 0x00000010u );
+    (void)Dbnc_Update( &State, 0x00000000u );
+    for( uint8 i = 0u; i < 3u; i++ )
+    {
+        Changed = Dbnc_Update( &State, 0x00000010u );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0u, Changed, "Input changed before the depth was reached" );
+    }
+    Changed = Dbnc_Update( &State, 0x00000010u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000010u, Changed, "Value is not 0x00000010 as supposed to be" );
+}
+
+/**
+ * @brief   **Test release after press**
+ *
+ * The test validates an accepted pin returns to low only after four low samples, to pass the
+ * stable state should be 0 after the release.
+ */
+void test__Dbnc_Update__release( void )
+{
+    for( uint8 i = 0u; i < 4u; i++ )
+    {
+        (void)Dbnc_Update( &State, 0x00000100u );
+    }
+    for( uint8 i = 0u; i < 3u; i++ )
+    {
+        (void)Dbnc_Update( &State, 0x00000000u );
+    }
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000100u, Dbnc_GetStable( &State ), "Value is not 0x00000100 as supposed to be" );
+    (void)Dbnc_Update( &State, 0x00000000u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000u, Dbnc_GetStable( &State ), "Value is not 0x00000000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test inputs are debounced independently**
+ *
+ * The test validates two pins that start to change on different ticks are accepted on different
+ * ticks, to pass pin 2 should be accepted one tick before pin 3.
+ */
+void test__Dbnc_Update__independent( void )
+{
+    Dbnc_LaneType Changed;
+    (void)Dbnc_Update( &State, 0x00000004u );
+    (void)Dbnc_Update( &State, 0x0000000Cu );
+    (void)Dbnc_Update( &State, 0x0000000Cu );
+    Changed = Dbnc_Update( &State, 0x0000000Cu );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000004u, Changed, "Value is not 0x00000004 as supposed to be" );
+    Changed = Dbnc_Update( &State, 0x0000000Cu );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000008u, Changed, "Value is not 0x00000008 as supposed to be" );
+}
+
+/**
+ * @brief   **Test maximum depth**
+ *
+ * The test validates the largest depth allowed by the counter bits, to pass the pin should be
+ * accepted after exactly 2^n - 1 samples.
+ */
+void test__Dbnc_Update__max_depth( void )
+{
+    uint8 Depth = ( 1u << DBNC_COUNTER_BITS ) - 1u;
+    (void)Dbnc_Init( &State, 0u, Depth );
+    for( uint8 i = 1u; i < Depth; i++ )
+    {
+        (void)Dbnc_Update( &State, 0x00010000u );
+    }
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0u, Dbnc_GetStable( &State ), "Input changed before the depth was reached" );
+    (void)Dbnc_Update( &State, 0x00010000u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00010000u, Dbnc_GetStable( &State ), "Value is not 0x00010000 as supposed to be" );
+}
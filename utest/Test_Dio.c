@@ -0,0 +1,117 @@
+/**
+ * @file    Test_Dio.c
+ * @brief   **Unit Test for the Dio Driver**
+ *
+ * The GPIO input data registers are modelled in RAM, the register access functions count the reads
+ * so the tests can check how many times the hardware is accessed.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Dio.h"
+
+#define GPIO_BASE   0x50000000u
+#define GPIO_STRIDE 0x400u
+#define IDR_OFFSET  0x10u
+
+static uint32 GpioIdr[ 6 ];
+static uint32 Reads;
+
+uint32 Reg_HostRead32( uint32 Address )
+{
+    uint32 Port = ( Address - GPIO_BASE ) / GPIO_STRIDE;
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( IDR_OFFSET, ( Address - GPIO_BASE ) % GPIO_STRIDE, "Register read is not an IDR" );
+    Reads++;
+    return GpioIdr[ Port ];
+}
+
+void Reg_HostWrite32( uint32 Address, uint32 Value )
+{
+    (void)Address;
+    (void)Value;
+    TEST_FAIL_MESSAGE( "Dio should not write any register" );
+}
+
+void setUp( void )
+{
+    Reads        = 0u;
+    GpioIdr[ 0 ] = 0x00000020u;
+    GpioIdr[ 1 ] = 0x00008001u;
+    GpioIdr[ 2 ] = 0x0000A5A5u;
+    GpioIdr[ 3 ] = 0x00000004u;
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test read channel high**
+ *
+ * The test validates pin 5 of port A is read when its input register has a value of 0x20, to pass
+ * the level should be STD_HIGH.
+ */
+void test__Dio_ReadChannel__high( void )
+{
+    Dio_LevelType Level;
+    Level = Dio_ReadChannel( DIO_CHANNEL( DIO_PORT_A, 5u ) );
+    TEST_ASSERT_EQUAL_MESSAGE( STD_HIGH, Level, "Level is not STD_HIGH as supposed to be" );
+}
+
+/**
+ * @brief   **Test read channel low**
+ *
+ * The test validates pin 14 of port B is read when its input register has a value of 0x8001, to
+ * pass the level should be STD_LOW.
+ */
+void test__Dio_ReadChannel__low( void )
+{
+    Dio_LevelType Level;
+    Level = Dio_ReadChannel( DIO_CHANNEL( DIO_PORT_B, 14u ) );
+    TEST_ASSERT_EQUAL_MESSAGE( STD_LOW, Level, "Level is not STD_LOW as supposed to be" );
+}
+
+/**
+ * @brief   **Test read port**
+ *
+ * The test validates port C is read when its input register has a value of 0xA5A5, to pass the
+ * port level should be 0xA5A5.
+ */
+void test__Dio_ReadPort__portc( void )
+{
+    Dio_PortLevelType Level;
+    Level = Dio_ReadPort( DIO_PORT_C );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0xA5A5u, Level, "Value is not 0xA5A5 as supposed to be" );
+}
+
+/**
+ * @brief   **Test snapshot reads each port once**
+ *
+ * The test validates a snapshot captures all the configured ports reading each input register once,
+ * to pass the register reads should be equal to the number of ports.
+ */
+void test__Dio_ReadPortSnapshot__single_pass( void )
+{
+    Dio_PortSnapshotType Snapshot;
+    Dio_ReadPortSnapshot( &Snapshot );
+    TEST_ASSERT_EQUAL_MESSAGE( DIO_NUMBER_OF_PORTS, Reads, "Registers were not read once per port" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x0020u, Snapshot.Port[ DIO_PORT_A ], "Value is not 0x0020 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x0004u, Snapshot.Port[ DIO_PORT_D ], "Value is not 0x0004 as supposed to be" );
+}
+
+/**
+ * @brief   **Test snapshot accessors**
+ *
+ * The test validates the accessors read the captured values without accessing the registers, to
+ * pass pin 15 of port B should be high and port C should be 0xA5A5 with no extra reads.
+ */
+void test__Dio_SnapshotReadChannel__no_access( void )
+{
+    Dio_PortSnapshotType Snapshot;
+    Dio_ReadPortSnapshot( &Snapshot );
+    GpioIdr[ 1 ] = 0u;
+    TEST_ASSERT_EQUAL_MESSAGE( STD_HIGH, Dio_SnapshotReadChannel( &Snapshot, DIO_CHANNEL( DIO_PORT_B, 15u ) ), "Level is not STD_HIGH as supposed to be" );
+    TEST_ASSERT_EQUAL_MESSAGE( STD_LOW, Dio_SnapshotReadChannel( &Snapshot, DIO_CHANNEL( DIO_PORT_B, 14u ) ), "Level is not STD_LOW as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0xA5A5u, Dio_SnapshotReadPort( &Snapshot, DIO_PORT_C ), "Value is not 0xA5A5 as supposed to be" );
+    TEST_ASSERT_EQUAL_MESSAGE( DIO_NUMBER_OF_PORTS, Reads, "Accessors read the registers" );
+}
@@ -0,0 +1,101 @@
+/**
+ * @file    Test_Edge.c
+ * @brief   **Unit Test for the Bit Parallel Edge Detection**
+ *
+ * The callbacks record the notifications received so the tests can check the pins, levels and the
+ * order in which they were notified.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Edge.h"
+
+static uint8 Calls;
+static uint8 CallPin[ 32 ];
+static uint8 CallLevel[ 32 ];
+
+static void Edge_Record( uint8 Pin, uint8 Level )
+{
+    CallPin[ Calls ]   = Pin;
+    CallLevel[ Calls ] = Level;
+    Calls++;
+}
+
+static const Edge_CallbackType Callbacks[ 32 ] = {
+    Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record,
+    Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record,
+    Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record,
+    Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record, Edge_Record };
+
+void setUp( void )
+{
+    Calls = 0u;
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test edge masks**
+ *
+ * The test validates the masks between the snapshots 0x0000F0F0 and 0x0000FF00, to pass rising
+ * should be 0x00000F00, falling 0x000000F0 and changed 0x00000FF0.
+ */
+void test__Edge_Detect__masks( void )
+{
+    Edge_EventsType Events;
+    Edge_Detect( 0x0000F0F0u, 0x0000FF00u, &Events );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000F00u, Events.Rising, "Value is not 0x00000F00 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x000000F0u, Events.Falling, "Value is not 0x000000F0 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000FF0u, Events.Changed, "Value is not 0x00000FF0 as supposed to be" );
+}
+
+/**
+ * @brief   **Test no notification without edges**
+ *
+ * The test validates two equal snapshots do not call any callback, to pass the notified mask
+ * should be 0.
+ */
+void test__Edge_Notify__idle( void )
+{
+    Edge_ConfigType Config = { 0xFFFFFFFFu, 0xFFFFFFFFu, Callbacks };
+    uint32 Notified;
+    Notified = Edge_Notify( &Config, 0xA5A5A5A5u, 0xA5A5A5A5u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0u, Notified, "Value is not 0 as supposed to be" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Calls, "Callbacks were called without edges" );
+}
+
+/**
+ * @brief   **Test rising and falling notifications**
+ *
+ * The test validates pin 0 rising and pin 31 falling are notified in order with their new level,
+ * to pass pin 0 should be notified high and pin 31 low.
+ */
+void test__Edge_Notify__both_edges( void )
+{
+    Edge_ConfigType Config = { 0xFFFFFFFFu, 0xFFFFFFFFu, Callbacks };
+    uint32 Notified;
+    Notified = Edge_Notify( &Config, 0x80000000u, 0x00000001u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x80000001u, Notified, "Value is not 0x80000001 as supposed to be" );
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, Calls, "Callbacks were not called twice" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, CallPin[ 0 ], "First notification is not pin 0" );
+    TEST_ASSERT_EQUAL_MESSAGE( STD_HIGH, CallLevel[ 0 ], "Pin 0 was not notified high" );
+    TEST_ASSERT_EQUAL_MESSAGE( 31u, CallPin[ 1 ], "Second notification is not pin 31" );
+    TEST_ASSERT_EQUAL_MESSAGE( STD_LOW, CallLevel[ 1 ], "Pin 31 was not notified low" );
+}
+
+/**
+ * @brief   **Test only monitored edges are notified**
+ *
+ * The test validates pins monitored only for rising edges are not notified on falling edges, to
+ * pass only the rising edge on pin 5 should be notified.
+ */
+void test__Edge_Notify__masks( void )
+{
+    Edge_ConfigType Config = { 0x000000FFu, 0x00000000u, Callbacks };
+    uint32 Notified;
+    Notified = Edge_Notify( &Config, 0x00000108u, 0x00000020u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000020u, Notified, "Value is not 0x00000020 as supposed to be" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Calls, "Callback was not called once" );
+    TEST_ASSERT_EQUAL_MESSAGE( 5u, CallPin[ 0 ], "Notification is not pin 5" );
+}
@@ -0,0 +1,248 @@
+/**
+ * @file    Test_Ifx.c
+ * @brief   **Unit Test for the Interpolation Routines**
+ *
+ * The curve tests use the axis { 0, 10, 20, 40 } with values { 100, 200, 400, 0 }, every search
+ * flavour should find the same segment and ratio for the same input.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Mfx.h"
+#include "Ifx.h"
+
+static const sint16 X_axis[ 4 ] = { 0, 10, 20, 40 };
+static const sint16 Values[ 4 ] = { 100, 200, 400, 0 };
+static const sint16 Y_axis[ 2 ] = { 0, 100 };
+static const sint16 MapVal[ 4 ] = { 0, 100, 200, 300 };
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test binary search inside the axis**
+ *
+ * The test validates the input 25 is found in the axis, to pass the index should be 2 and the
+ * ratio 0x4000.
+ */
+void test__Ifx_DPSearch_s16__inside( void )
+{
+    Ifx_DPResultU16Type Result;
+    Ifx_DPSearch_s16( &Result, 25, 4u, X_axis );
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, Result.Index, "Index is not 2 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x4000u, Result.Ratio, "Ratio is not 0x4000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test binary search above the axis**
+ *
+ * The test validates the input 50 is limited to the last axis point, to pass the index should be
+ * 3 and the ratio 0.
+ */
+void test__Ifx_DPSearch_s16__above( void )
+{
+    Ifx_DPResultU16Type Result;
+    Ifx_DPSearch_s16( &Result, 50, 4u, X_axis );
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, Result.Index, "Index is not 3 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x0000u, Result.Ratio, "Ratio is not 0x0000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test binary search below the axis**
+ *
+ * The test validates the input -5 is limited to the first axis point, to pass the index should be
+ * 0 and the ratio 0.
+ */
+void test__Ifx_DPSearch_s16__below( void )
+{
+    Ifx_DPResultU16Type Result;
+    Ifx_DPSearch_s16( &Result, -5, 4u, X_axis );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Result.Index, "Index is not 0 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x0000u, Result.Ratio, "Ratio is not 0x0000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test linear search inside the axis**
+ *
+ * The test validates the input 15 is found in the axis, to pass the index should be 1 and the
+ * ratio 0x8000.
+ */
+void test__Ifx_DPSearchLinear_s16__inside( void )
+{
+    Ifx_DPResultU16Type Result;
+    Ifx_DPSearchLinear_s16( &Result, 15, 4u, X_axis );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Result.Index, "Index is not 1 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x8000u, Result.Ratio, "Ratio is not 0x8000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test cached search moving up**
+ *
+ * The test validates the input 25 is found starting from the segment 0 of a previous call, to
+ * pass the index should be 2 and the ratio 0x4000.
+ */
+void test__Ifx_DPSearchCached_s16__up( void )
+{
+    Ifx_DPResultU16Type Result = { 0u, 0u };
+    Ifx_DPSearchCached_s16( &Result, 25, 4u, X_axis );
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, Result.Index, "Index is not 2 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x4000u, Result.Ratio, "Ratio is not 0x4000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test cached search moving down**
+ *
+ * The test validates the input 5 is found starting from the last axis point of a previous call,
+ * to pass the index should be 0 and the ratio 0x8000.
+ */
+void test__Ifx_DPSearchCached_s16__down( void )
+{
+    Ifx_DPResultU16Type Result = { 3u, 0u };
+    Ifx_DPSearchCached_s16( &Result, 5, 4u, X_axis );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Result.Index, "Index is not 0 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x8000u, Result.Ratio, "Ratio is not 0x8000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test power of two interval search**
+ *
+ * The test validates the input 100 over an axis starting at 50 with interval 16, to pass the
+ * index should be 3 and the ratio 0x2000.
+ */
+void test__Ifx_DPSearchFix_s16__inside( void )
+{
+    Ifx_DPResultU16Type Result;
+    Ifx_DPSearchFix_s16( &Result, 100, 8u, 50, 4u );
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, Result.Index, "Index is not 3 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x2000u, Result.Ratio, "Ratio is not 0x2000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test power of two interval search above the axis**
+ *
+ * The test validates the input 200 over an axis of 8 points starting at 50 with interval 16, to
+ * pass the index should be 7 and the ratio 0.
+ */
+void test__Ifx_DPSearchFix_s16__above( void )
+{
+    Ifx_DPResultU16Type Result;
+    Ifx_DPSearchFix_s16( &Result, 200, 8u, 50, 4u );
+    TEST_ASSERT_EQUAL_MESSAGE( 7u, Result.Index, "Index is not 7 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x0000u, Result.Ratio, "Ratio is not 0x0000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test fixed interval search**
+ *
+ * The test validates the input 250 over an axis starting at 0 with interval 100, to pass the
+ * index should be 2 and the ratio 0x8000.
+ */
+void test__Ifx_DPSearchFixI_s16__inside( void )
+{
+    Ifx_DPResultU16Type Result;
+    Ifx_DPSearchFixI_s16( &Result, 250, 8u, 0, 100u );
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, Result.Index, "Index is not 2 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x8000u, Result.Ratio, "Ratio is not 0x8000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test fixed interval search below the axis**
+ *
+ * The test validates the input -250 over an axis starting at 0 with interval 100, to pass the
+ * index should be 0 and the ratio 0.
+ */
+void test__Ifx_DPSearchFixI_s16__below( void )
+{
+    Ifx_DPResultU16Type Result;
+    Ifx_DPSearchFixI_s16( &Result, -250, 8u, 0, 100u );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Result.Index, "Index is not 0 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x0000u, Result.Ratio, "Ratio is not 0x0000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test curve interpolation**
+ *
+ * The test validates the curve is interpolated a quarter between 400 and 0, to pass the result
+ * should be 300.
+ */
+void test__Ifx_IpoCur_s16__falling( void )
+{
+    Ifx_DPResultU16Type Search = { 2u, 0x4000u };
+    sint16 Result;
+    Result = Ifx_IpoCur_s16( &Search, Values );
+    TEST_ASSERT_EQUAL_INT16_MESSAGE( 300, Result, "Value is not 300 as supposed to be" );
+}
+
+/**
+ * @brief   **Test curve interpolation at the last point**
+ *
+ * The test validates the curve at the last axis point with ratio 0, to pass the result should be
+ * the last value 0.
+ */
+void test__Ifx_IpoCur_s16__last( void )
+{
+    Ifx_DPResultU16Type Search = { 3u, 0u };
+    sint16 Result;
+    Result = Ifx_IpoCur_s16( &Search, Values );
+    TEST_ASSERT_EQUAL_INT16_MESSAGE( 0, Result, "Value is not 0 as supposed to be" );
+}
+
+/**
+ * @brief   **Test integrated curve interpolation**
+ *
+ * The test validates the curve is searched and interpolated at 5, to pass the result should be
+ * 150.
+ */
+void test__Ifx_IntIpoCur_s16_s16__inside( void )
+{
+    sint16 Result;
+    Result = Ifx_IntIpoCur_s16_s16( 5, 4u, X_axis, Values );
+    TEST_ASSERT_EQUAL_INT16_MESSAGE( 150, Result, "Value is not 150 as supposed to be" );
+}
+
+/**
+ * @brief   **Test integrated curve interpolation with full range values**
+ *
+ * The test validates the curve between -32768 and 32767 is interpolated at the middle, to pass
+ * the result should be 0 without overflow.
+ */
+void test__Ifx_IntIpoCur_s16_s16__full_range( void )
+{
+    static const sint16 Axis[ 2 ] = { -32768, 32767 };
+    static const sint16 Vals[ 2 ] = { -32768, 32767 };
+    sint16 Result;
+    Result = Ifx_IntIpoCur_s16_s16( 0, 2u, Axis, Vals );
+    TEST_ASSERT_EQUAL_INT16_MESSAGE( 0, Result, "Value is not 0 as supposed to be" );
+}
+
+/**
+ * @brief   **Test map interpolation**
+ *
+ * The test validates the map is interpolated at the middle of both axes, to pass the result
+ * should be 150.
+ */
+void test__Ifx_IntIpoMap_s16s16_s16__middle( void )
+{
+    sint16 Result;
+    Result = Ifx_IntIpoMap_s16s16_s16( 5, 50, 2u, 2u, X_axis, Y_axis, MapVal );
+    TEST_ASSERT_EQUAL_INT16_MESSAGE( 150, Result, "Value is not 150 as supposed to be" );
+}
+
+/**
+ * @brief   **Test map interpolation at the last row**
+ *
+ * The test validates the map is interpolated above the X axis and a quarter of the Y axis, to
+ * pass the result should be 225 without reading beyond the last row.
+ */
+void test__Ifx_IpoMap_s16__last_row( void )
+{
+    Ifx_DPResultU16Type SearchX = { 1u, 0u };
+    Ifx_DPResultU16Type SearchY = { 0u, 0x4000u };
+    sint16 Result;
+    Result = Ifx_IpoMap_s16( &SearchX, &SearchY, 2u, MapVal );
+    TEST_ASSERT_EQUAL_INT16_MESSAGE( 225, Result, "Value is not 225 as supposed to be" );
+}
@@ -0,0 +1,169 @@
+/**
+ * @file    Test_Mcu.c
+ * @brief   **Unit Test for the Mcu Driver**
+ *
+ * The RCC and flash registers are modelled in RAM starting from their reset values, PLLRDY follows
+ * PLLON and SWS follows SW unless the test makes the PLL fail to lock. Every write is logged with
+ * the state of the other registers, so the tests can check the order of the sequence.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Mcu.h"
+
+#define RCC_CR      0x40021000u
+#define RCC_CFGR    0x40021008u
+#define RCC_PLLCFGR 0x4002100Cu
+#define FLASH_ACR   0x40022000u
+
+#define CR_PLLON    0x01000000u
+#define CR_PLLRDY   0x02000000u
+#define ACR_ICEN    0x00000200u
+#define ACR_ICRST   0x00000800u
+
+typedef struct Write_Tag
+{
+    uint32 Address;
+    uint32 Value;
+    uint32 Cr;
+    uint32 Acr;
+} Write;
+
+static uint32 Cr;
+static uint32 Cfgr;
+static uint32 Pllcfgr;
+static uint32 Acr;
+static boolean Locks;
+static Write Log[ 32 ];
+static uint32 Writes;
+
+static uint32 *Register( uint32 Address )
+{
+    uint32 *Reg = NULL_PTR;
+
+    switch( Address )
+    {
+        case RCC_CR:
+            Reg = &Cr;
+            break;
+        case RCC_CFGR:
+            Reg = &Cfgr;
+            break;
+        case RCC_PLLCFGR:
+            Reg = &Pllcfgr;
+            break;
+        case FLASH_ACR:
+            Reg = &Acr;
+            break;
+        default:
+            TEST_FAIL_MESSAGE( "Register access is not modelled" );
+            break;
+    }
+    return Reg;
+}
+
+uint32 Reg_HostRead32( uint32 Address )
+{
+    uint32 Value = *Register( Address );
+
+    if( Address == RCC_CR )
+    {
+        Value = ( ( ( Value & CR_PLLON ) != 0u ) && ( Locks == TRUE ) ) ? ( Value | CR_PLLRDY ) : Value;
+    }
+    else if( Address == RCC_CFGR )
+    {
+        Value = ( Value & ~0x38u ) | ( ( Value & 0x7u ) << 3u );
+    }
+    return Value;
+}
+
+void Reg_HostWrite32( uint32 Address, uint32 Value )
+{
+    TEST_ASSERT_LESS_THAN_MESSAGE( 32u, Writes, "Too many register writes" );
+    Log[ Writes ].Address = Address;
+    Log[ Writes ].Value   = Value;
+    Log[ Writes ].Cr      = Cr;
+    Log[ Writes ].Acr     = Acr;
+    Writes++;
+    *Register( Address ) = Value & ~CR_PLLRDY;
+}
+
+static uint32 Find( uint32 Address, uint32 Mask, uint32 Value )
+{
+    uint32 Index = 0u;
+
+    while( ( Index < Writes ) && ( ( Log[ Index ].Address != Address ) || ( ( Log[ Index ].Value & Mask ) != Value ) ) )
+    {
+        Index++;
+    }
+    return Index;
+}
+
+void setUp( void )
+{
+    Cr      = 0x00000500u;
+    Cfgr    = 0x00000000u;
+    Pllcfgr = 0x00001000u;
+    Acr     = 0x00000600u;
+    Locks   = TRUE;
+    Writes  = 0u;
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test the final clock setup**
+ *
+ * The test validates the registers after the clock initialisation for the generated 64MHz
+ * configuration, to pass the PLL should run from HSI16 with M 1, N 8 and R 2, the system clock
+ * from the PLL, the flash with 2 wait states, prefetch and cache on and the debug bit untouched.
+ */
+void test__Mcu_InitClock__registers( void )
+{
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Mcu_InitClock(), "Status is not E_OK as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x30000802u, Pllcfgr, "PLLCFGR is not 0x30000802 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000002u, Cfgr, "CFGR is not 0x00000002 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x01000500u, Cr, "CR is not 0x01000500 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000702u, Acr, "ACR is not 0x00000702 as supposed to be" );
+}
+
+/**
+ * @brief   **Test the sequence order**
+ *
+ * The test validates the order of the writes, to pass the flash latency should be raised before
+ * the clock switch, the cache reset with the cache disabled, and the PLL configured while stopped.
+ */
+void test__Mcu_InitClock__order( void )
+{
+    uint32 Latency;
+    uint32 Switch;
+    uint32 Reset;
+    uint32 Config;
+
+    (void)Mcu_InitClock();
+    Latency = Find( FLASH_ACR, 0x7u, 0x2u );
+    Switch  = Find( RCC_CFGR, 0x7u, 0x2u );
+    Reset   = Find( FLASH_ACR, ACR_ICRST, ACR_ICRST );
+    Config  = Find( RCC_PLLCFGR, 0u, 0u );
+    TEST_ASSERT_TRUE_MESSAGE( Switch < Writes, "System clock never switched to the PLL" );
+    TEST_ASSERT_TRUE_MESSAGE( Latency < Switch, "Flash latency is not raised before the clock switch" );
+    TEST_ASSERT_TRUE_MESSAGE( Reset < Writes, "Instruction cache never reset" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0u, Log[ Reset ].Acr & ACR_ICEN, "Instruction cache reset while enabled" );
+    TEST_ASSERT_TRUE_MESSAGE( Config < Switch, "PLL configured after the clock switch" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0u, Log[ Config ].Cr & CR_PLLON, "PLL configured while running" );
+}
+
+/**
+ * @brief   **Test a PLL that does not lock**
+ *
+ * The test validates the PLL lock timeout, to pass the status should be E_NOT_OK and the system
+ * clock should stay on HSI16 with the flash latency raised.
+ */
+void test__Mcu_InitClock__no_lock( void )
+{
+    Locks = FALSE;
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Mcu_InitClock(), "Status is not E_NOT_OK as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000u, Cfgr & 0x7u, "System clock switched without PLL lock" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000002u, Acr & 0x7u, "Flash latency is not 2 as supposed to be" );
+}
@@ -0,0 +1,524 @@
+/**
+ * @file    Test_Mfx.c
+ * @brief   **Unit Test for the Fixed Point Math Routines**
+ *
+ * The tests validate the saturation limits, the rounding of the shifts and divisions, and the Q
+ * format multiplication and division.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Bfx.h"
+#include "Mfx.h"
+
+void setUp( void )
+{
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test 16 bit addition**
+ *
+ * The test validates the routine adds 1000 and -3000, to pass the result should be -2000.
+ */
+void test__Mfx_Add_s16s16_s16__no_overflow( void )
+{
+    sint16 Result;
+    Result = Mfx_Add_s16s16_s16( 1000, -3000 );
+    TEST_ASSERT_EQUAL_INT16_MESSAGE( -2000, Result, "Value is not -2000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 16 bit addition saturation**
+ *
+ * The test validates the routine adds 30000 and 10000, to pass the result should saturate to 32767.
+ */
+void test__Mfx_Add_s16s16_s16__saturate( void )
+{
+    sint16 Result;
+    Result = Mfx_Add_s16s16_s16( 30000, 10000 );
+    TEST_ASSERT_EQUAL_INT16_MESSAGE( 32767, Result, "Value is not 32767 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit addition positive saturation**
+ *
+ * The test validates the routine adds 0x7FFFFFF0 and 0x20, to pass the result should saturate to
+ * 0x7FFFFFFF.
+ */
+void test__Mfx_Add_s32s32_s32__saturate_max( void )
+{
+    sint32 Result;
+    Result = Mfx_Add_s32s32_s32( 0x7FFFFFF0, 0x20 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x7FFFFFFF, Result, "Value is not 0x7FFFFFFF as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit addition negative saturation**
+ *
+ * The test validates the routine adds -2000000000 and -2000000000, to pass the result should
+ * saturate to -2147483648.
+ */
+void test__Mfx_Add_s32s32_s32__saturate_min( void )
+{
+    sint32 Result;
+    Result = Mfx_Add_s32s32_s32( -2000000000, -2000000000 );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( INT32_MIN, Result, "Value is not -2147483648 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit unsigned addition saturation**
+ *
+ * The test validates the routine adds 0xF0000000 and 0x20000000, to pass the result should saturate
+ * to 0xFFFFFFFF.
+ */
+void test__Mfx_Add_u32u32_u32__saturate( void )
+{
+    uint32 Result;
+    Result = Mfx_Add_u32u32_u32( 0xF0000000u, 0x20000000u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xFFFFFFFFu, Result, "Value is not 0xFFFFFFFF as supposed to be" );
+}
+
+/**
+ * @brief   **Test 16 bit subtraction saturation**
+ *
+ * The test validates the routine subtracts 10000 from -30000, to pass the result should saturate to
+ * -32768.
+ */
+void test__Mfx_Sub_s16s16_s16__saturate( void )
+{
+    sint16 Result;
+    Result = Mfx_Sub_s16s16_s16( -30000, 10000 );
+    TEST_ASSERT_EQUAL_INT16_MESSAGE( -32768, Result, "Value is not -32768 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit subtraction**
+ *
+ * The test validates the routine subtracts -5 from 10, to pass the result should be 15.
+ */
+void test__Mfx_Sub_s32s32_s32__no_overflow( void )
+{
+    sint32 Result;
+    Result = Mfx_Sub_s32s32_s32( 10, -5 );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( 15, Result, "Value is not 15 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit subtraction saturation**
+ *
+ * The test validates the routine subtracts -2000000000 from 2000000000, to pass the result should
+ * saturate to 2147483647.
+ */
+void test__Mfx_Sub_s32s32_s32__saturate( void )
+{
+    sint32 Result;
+    Result = Mfx_Sub_s32s32_s32( 2000000000, -2000000000 );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( INT32_MAX, Result, "Value is not 2147483647 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit unsigned subtraction saturation**
+ *
+ * The test validates the routine subtracts 20 from 10, to pass the result should saturate to 0.
+ */
+void test__Mfx_Sub_u32u32_u32__saturate( void )
+{
+    uint32 Result;
+    Result = Mfx_Sub_u32u32_u32( 10u, 20u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000u, Result, "Value is not 0x00000000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 16 bit multiplication saturation**
+ *
+ * The test validates the routine multiplies -300 by 200, to pass the result should saturate to
+ * -32768.
+ */
+void test__Mfx_Mul_s16s16_s16__saturate( void )
+{
+    sint16 Result;
+    Result = Mfx_Mul_s16s16_s16( -300, 200 );
+    TEST_ASSERT_EQUAL_INT16_MESSAGE( -32768, Result, "Value is not -32768 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit multiplication**
+ *
+ * The test validates the routine multiplies -46341 by 46340, to pass the result should be
+ * -2147441940.
+ */
+void test__Mfx_Mul_s32s32_s32__no_overflow( void )
+{
+    sint32 Result;
+    Result = Mfx_Mul_s32s32_s32( -46341, 46340 );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( -2147441940, Result, "Value is not -2147441940 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit multiplication saturation**
+ *
+ * The test validates the routine multiplies 100000 by -100000, to pass the result should saturate
+ * to -2147483648.
+ */
+void test__Mfx_Mul_s32s32_s32__saturate( void )
+{
+    sint32 Result;
+    Result = Mfx_Mul_s32s32_s32( 100000, -100000 );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( INT32_MIN, Result, "Value is not -2147483648 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit multiplication of the minimum**
+ *
+ * The test validates the routine multiplies -2147483648 by -1, to pass the result should saturate
+ * to 2147483647.
+ */
+void test__Mfx_Mul_s32s32_s32__min_by_minus_one( void )
+{
+    sint32 Result;
+    Result = Mfx_Mul_s32s32_s32( INT32_MIN, -1 );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( INT32_MAX, Result, "Value is not 2147483647 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit unsigned multiplication saturation**
+ *
+ * The test validates the routine multiplies 0x10000 by 0x10000, to pass the result should saturate
+ * to 0xFFFFFFFF.
+ */
+void test__Mfx_Mul_u32u32_u32__saturate( void )
+{
+    uint32 Result;
+    Result = Mfx_Mul_u32u32_u32( 0x10000u, 0x10000u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xFFFFFFFFu, Result, "Value is not 0xFFFFFFFF as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit unsigned multiplication**
+ *
+ * The test validates the routine multiplies 0xFFFF by 0x10001, to pass the result should be
+ * 0xFFFFFFFF without saturation.
+ */
+void test__Mfx_Mul_u32u32_u32__no_overflow( void )
+{
+    uint32 Result;
+    Result = Mfx_Mul_u32u32_u32( 0xFFFFu, 0x10001u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xFFFFFFFFu, Result, "Value is not 0xFFFFFFFF as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit division**
+ *
+ * The test validates the routine divides -7 by 2, to pass the result should be rounded toward zero
+ * to -3.
+ */
+void test__Mfx_Div_s32s32_s32__truncate( void )
+{
+    sint32 Result;
+    Result = Mfx_Div_s32s32_s32( -7, 2 );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( -3, Result, "Value is not -3 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit division by zero**
+ *
+ * The test validates the routine divides -7 by 0, to pass the result should saturate to
+ * -2147483648.
+ */
+void test__Mfx_Div_s32s32_s32__by_zero( void )
+{
+    sint32 Result;
+    Result = Mfx_Div_s32s32_s32( -7, 0 );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( INT32_MIN, Result, "Value is not -2147483648 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit division of the minimum**
+ *
+ * The test validates the routine divides -2147483648 by -1, to pass the result should saturate to
+ * 2147483647.
+ */
+void test__Mfx_Div_s32s32_s32__min_by_minus_one( void )
+{
+    sint32 Result;
+    Result = Mfx_Div_s32s32_s32( INT32_MIN, -1 );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( INT32_MAX, Result, "Value is not 2147483647 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit unsigned division**
+ *
+ * The test validates the routine divides 0xFFFFFFFF by 0x10, to pass the result should be
+ * 0x0FFFFFFF.
+ */
+void test__Mfx_Div_u32u32_u32__large( void )
+{
+    uint32 Result;
+    Result = Mfx_Div_u32u32_u32( 0xFFFFFFFFu, 0x10u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x0FFFFFFFu, Result, "Value is not 0x0FFFFFFF as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit unsigned division by zero**
+ *
+ * The test validates the routine divides 100 by 0, to pass the result should saturate to
+ * 0xFFFFFFFF.
+ */
+void test__Mfx_Div_u32u32_u32__by_zero( void )
+{
+    uint32 Result;
+    Result = Mfx_Div_u32u32_u32( 100u, 0u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xFFFFFFFFu, Result, "Value is not 0xFFFFFFFF as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit rounded division**
+ *
+ * The test validates the routine divides -7 by 2, to pass the result should be rounded away from
+ * zero to -4.
+ */
+void test__Mfx_RDiv_s32s32_s32__half( void )
+{
+    sint32 Result;
+    Result = Mfx_RDiv_s32s32_s32( -7, 2 );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( -4, Result, "Value is not -4 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit rounded division below half**
+ *
+ * The test validates the routine divides 13 by 5, to pass the result should be rounded down to 3.
+ */
+void test__Mfx_RDiv_s32s32_s32__below_half( void )
+{
+    sint32 Result;
+    Result = Mfx_RDiv_s32s32_s32( 13, 5 );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( 3, Result, "Value is not 3 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit shift left**
+ *
+ * The test validates the routine shifts -3 by 4, to pass the result should be -48.
+ */
+void test__Mfx_ShLeft_s32u8_s32__no_overflow( void )
+{
+    sint32 Result;
+    Result = Mfx_ShLeft_s32u8_s32( -3, 4u );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( -48, Result, "Value is not -48 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit shift left saturation**
+ *
+ * The test validates the routine shifts 0x20000000 by 3, to pass the result should saturate to
+ * 0x7FFFFFFF.
+ */
+void test__Mfx_ShLeft_s32u8_s32__saturate( void )
+{
+    sint32 Result;
+    Result = Mfx_ShLeft_s32u8_s32( 0x20000000, 3u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x7FFFFFFF, Result, "Value is not 0x7FFFFFFF as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit shift right**
+ *
+ * The test validates the routine shifts -5 by 1, to pass the result should be rounded toward minus
+ * infinity to -3.
+ */
+void test__Mfx_ShRight_s32u8_s32__negative( void )
+{
+    sint32 Result;
+    Result = Mfx_ShRight_s32u8_s32( -5, 1u );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( -3, Result, "Value is not -3 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit rounded shift right of a negative half**
+ *
+ * The test validates the routine shifts -5 by 1, to pass the result should be rounded toward plus
+ * infinity to -2.
+ */
+void test__Mfx_RShRight_s32u8_s32__negative_half( void )
+{
+    sint32 Result;
+    Result = Mfx_RShRight_s32u8_s32( -5, 1u );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( -2, Result, "Value is not -2 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit rounded shift right above half**
+ *
+ * The test validates the routine shifts 0x1C by 3 (3.5), to pass the result should be rounded up to
+ * 4.
+ */
+void test__Mfx_RShRight_s32u8_s32__above_half( void )
+{
+    sint32 Result;
+    Result = Mfx_RShRight_s32u8_s32( 0x1C, 3u );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( 4, Result, "Value is not 4 as supposed to be" );
+}
+
+/**
+ * @brief   **Test Q16 multiplication**
+ *
+ * The test validates the routine multiplies 1.5 by 2.5 in Q16, to pass the result should be 3.75 in
+ * Q16 0x0003C000.
+ */
+void test__Mfx_MulShRight_s32s32u8_s32__q16( void )
+{
+    sint32 Result;
+    Result = Mfx_MulShRight_s32s32u8_s32( 0x00018000, 0x00028000, 16u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x0003C000, Result, "Value is not 0x0003C000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test Q31 multiplication saturation**
+ *
+ * The test validates the routine multiplies -1.0 by -1.0 in Q31, to pass the result should saturate
+ * to 0x7FFFFFFF.
+ */
+void test__Mfx_MulShRight_s32s32u8_s32__q31_saturate( void )
+{
+    sint32 Result;
+    Result = Mfx_MulShRight_s32s32u8_s32( INT32_MIN, INT32_MIN, 31u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x7FFFFFFF, Result, "Value is not 0x7FFFFFFF as supposed to be" );
+}
+
+/**
+ * @brief   **Test rounded multiplication**
+ *
+ * The test validates the routine multiplies 3 by 3 and shifts by 2 (2.25), to pass the result
+ * should be rounded to 2.
+ */
+void test__Mfx_RMulShRight_s32s32u8_s32__round( void )
+{
+    sint32 Result;
+    Result = Mfx_RMulShRight_s32s32u8_s32( 3, 3, 2u );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( 2, Result, "Value is not 2 as supposed to be" );
+}
+
+/**
+ * @brief   **Test rounded Q31 multiplication**
+ *
+ * The test validates the routine multiplies -0.5 by 0.75 in Q31, to pass the result should be
+ * -0.375 in Q31 0xD0000000.
+ */
+void test__Mfx_RMulShRight_s32s32u8_s32__q31( void )
+{
+    sint32 Result;
+    Result = Mfx_RMulShRight_s32s32u8_s32( (sint32)0xC0000000, 0x60000000, 31u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( (sint32)0xD0000000, Result, "Value is not 0xD0000000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test rounded multiplication of the largest product shifted by 63**
+ *
+ * The test validates the routine multiplies INT32_MIN by INT32_MIN, 2^62, and shifts by 63 (0.5),
+ * the rounding shall not overflow the product, to pass the result should be rounded to 1.
+ */
+void test__Mfx_RMulShRight_s32s32u8_s32__min_shift63( void )
+{
+    sint32 Result;
+    Result = Mfx_RMulShRight_s32s32u8_s32( INT32_MIN, INT32_MIN, 63u );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( 1, Result, "Value is not 1 as supposed to be" );
+}
+
+/**
+ * @brief   **Test rounded multiplication of the largest product shifted by 62**
+ *
+ * The test validates the routine multiplies INT32_MIN by INT32_MIN, 2^62, and shifts by 62, to
+ * pass the result should be 1.
+ */
+void test__Mfx_RMulShRight_s32s32u8_s32__min_shift62( void )
+{
+    sint32 Result;
+    Result = Mfx_RMulShRight_s32s32u8_s32( INT32_MIN, INT32_MIN, 62u );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( 1, Result, "Value is not 1 as supposed to be" );
+}
+
+/**
+ * @brief   **Test multiplication of the largest product shifted by 63**
+ *
+ * The test validates the routine multiplies INT32_MIN by INT32_MIN, 2^62, and shifts by 63 (0.5),
+ * to pass the result should be truncated to 0.
+ */
+void test__Mfx_MulShRight_s32s32u8_s32__min_shift63( void )
+{
+    sint32 Result;
+    Result = Mfx_MulShRight_s32s32u8_s32( INT32_MIN, INT32_MIN, 63u );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( 0, Result, "Value is not 0 as supposed to be" );
+}
+
+/**
+ * @brief   **Test multiplication of the largest product shifted by 62**
+ *
+ * The test validates the routine multiplies INT32_MIN by INT32_MIN, 2^62, and shifts by 62, to
+ * pass the result should be 1.
+ */
+void test__Mfx_MulShRight_s32s32u8_s32__min_shift62( void )
+{
+    sint32 Result;
+    Result = Mfx_MulShRight_s32s32u8_s32( INT32_MIN, INT32_MIN, 62u );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( 1, Result, "Value is not 1 as supposed to be" );
+}
+
+/**
+ * @brief   **Test Q16 division**
+ *
+ * The test validates the routine divides 3.75 by 2.5 in Q16, to pass the result should be 1.5 in
+ * Q16 0x00018000.
+ */
+void test__Mfx_DivShLeft_s32s32u8_s32__q16( void )
+{
+    sint32 Result;
+    Result = Mfx_DivShLeft_s32s32u8_s32( 0x0003C000, 0x00028000, 16u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00018000, Result, "Value is not 0x00018000 as supposed to be" );
+}
+
+/**
+ * @brief   **Test Q16 division saturation**
+ *
+ * The test validates the routine divides -30000.0 by 0.25 in Q16, to pass the result should
+ * saturate to -2147483648.
+ */
+void test__Mfx_DivShLeft_s32s32u8_s32__saturate( void )
+{
+    sint32 Result;
+    Result = Mfx_DivShLeft_s32s32u8_s32( -30000 * 65536, 0x4000, 16u );
+    TEST_ASSERT_EQUAL_INT32_MESSAGE( INT32_MIN, Result, "Value is not -2147483648 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 16 bit normalisation**
+ *
+ * The test validates the routine normalises 0x0300, to pass the result should be 0x6000 with a
+ * shift of 5.
+ */
+void test__Mfx_Norm_s16__positive( void )
+{
+    sint16 Result;
+    uint8 Shift;
+    Result = Mfx_Norm_s16( 0x0300, &Shift );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x6000, Result, "Value is not 0x6000 as supposed to be" );
+    TEST_ASSERT_EQUAL_MESSAGE( 5u, Shift, "Shift is not 5 as supposed to be" );
+}
+
+/**
+ * @brief   **Test 32 bit normalisation**
+ *
+ * The test validates the routine normalises 0xFFFF0000, to pass the result should be 0x80000000
+ * with a shift of 15.
+ */
+void test__Mfx_Norm_s32__negative( void )
+{
+    sint32 Result;
+    uint8 Shift;
+    Result = Mfx_Norm_s32( (sint32)0xFFFF0000, &Shift );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x80000000, Result, "Value is not 0x80000000 as supposed to be" );
+    TEST_ASSERT_EQUAL_MESSAGE( 15u, Shift, "Shift is not 15 as supposed to be" );
+}
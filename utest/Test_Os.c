@@ -0,0 +1,143 @@
+/**
+ * @file    Test_Os.c
+ * @brief   **Unit Test for the Priority Bitmap Task Scheduler**
+ *
+ * The test tasks record their priority in a trace when they run, so the tests can check the order
+ * the dispatcher picked them.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Os.h"
+
+static uint8 Trace[ 16 ];
+static uint8 Runs;
+static boolean Again;
+
+static void Task_Record( uint8 Priority )
+{
+    if( Runs < sizeof( Trace ) )
+    {
+        Trace[ Runs ] = Priority;
+    }
+    Runs++;
+}
+
+static void Task_0( void )
+{
+    Task_Record( 0u );
+}
+
+static void Task_1( void )
+{
+    Task_Record( 1u );
+    /*a higher and a lower priority task, only the higher one runs on schedule*/
+    (void)ActivateTask( 0u );
+    (void)ActivateTask( 31u );
+    (void)Schedule();
+}
+
+static void Task_2( void )
+{
+    Task_Record( 2u );
+    /*activate itself, it should run once more after it terminates*/
+    if( Again == FALSE )
+    {
+        Again = TRUE;
+        (void)ActivateTask( 2u );
+    }
+}
+
+static void Task_31( void )
+{
+    Task_Record( 31u );
+}
+
+static const Os_TaskEntryType Tasks[ OS_MAX_TASKS ] = {
+    Task_0, Task_1, Task_2, Task_0, Task_0, Task_0, Task_0, Task_0,
+    Task_0, Task_0, Task_0, Task_0, Task_0, Task_0, Task_0, Task_0,
+    Task_0, Task_0, Task_0, Task_0, Task_0, Task_0, Task_0, Task_0,
+    Task_0, Task_0, Task_0, Task_0, Task_0, Task_0, Task_0, Task_31 };
+
+static const Os_ConfigType Config = { Tasks, OS_MAX_TASKS, NULL_PTR };
+
+void setUp( void )
+{
+    Runs  = 0u;
+    Again = FALSE;
+    Os_Init( &Config );
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test activation of an invalid task**
+ *
+ * The test validates a task identifier out of the task table is rejected, to pass the status
+ * should be E_OS_ID.
+ */
+void test__ActivateTask__invalid_id( void )
+{
+    StatusType Status;
+    Status = ActivateTask( OS_MAX_TASKS );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OS_ID, Status, "Status is not E_OS_ID as supposed to be" );
+}
+
+/**
+ * @brief   **Test activation of a pending task**
+ *
+ * The test validates a task activated twice before it is dispatched, to pass the first status
+ * should be E_OK, the second E_OS_LIMIT and the task should run once.
+ */
+void test__ActivateTask__limit( void )
+{
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, ActivateTask( 0u ), "Status is not E_OK as supposed to be" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OS_LIMIT, ActivateTask( 0u ), "Status is not E_OS_LIMIT as supposed to be" );
+    (void)Schedule();
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Runs, "Task did not run once as supposed to be" );
+}
+
+/**
+ * @brief   **Test dispatch order**
+ *
+ * The test validates three ready tasks are dispatched by priority, to pass the trace should be
+ * 31, 2, 2 and 0, task 2 runs twice since it activates itself.
+ */
+void test__Schedule__priority_order( void )
+{
+    static const uint8 Expected[ 4 ] = { 31u, 2u, 2u, 0u };
+    (void)ActivateTask( 0u );
+    (void)ActivateTask( 2u );
+    (void)ActivateTask( 31u );
+    (void)Schedule();
+    TEST_ASSERT_EQUAL_MESSAGE( 4u, Runs, "Tasks did not run four times as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY_MESSAGE( Expected, Trace, 4, "Tasks did not run by priority" );
+}
+
+/**
+ * @brief   **Test schedule from a task**
+ *
+ * The test validates a task calling Schedule only lets the higher priority tasks run, to pass the
+ * trace should be 1, 31 and 0, task 0 runs after task 1 terminates.
+ */
+void test__Schedule__from_task( void )
+{
+    static const uint8 Expected[ 3 ] = { 1u, 31u, 0u };
+    (void)ActivateTask( 1u );
+    (void)Schedule();
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, Runs, "Tasks did not run three times as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY_MESSAGE( Expected, Trace, 3, "Tasks did not run by priority" );
+}
+
+/**
+ * @brief   **Test schedule with no task ready**
+ *
+ * The test validates nothing runs when no task is activated, to pass the status should be E_OK
+ * and no task should run.
+ */
+void test__Schedule__idle( void )
+{
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Schedule(), "Status is not E_OK as supposed to be" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Runs, "A task run when none was ready" );
+}
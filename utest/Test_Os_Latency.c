@@ -0,0 +1,82 @@
+/**
+ * @file    Test_Os_Latency.c
+ * @brief   **Unit Test for the Scheduler Dispatch Latency Measurement**
+ *
+ * The test overrides OS_DISPATCH_LATENCY in project.yml to build the measurement. The SysTick
+ * current value register is modelled in RAM, it counts down a fixed step on every read.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Os.h"
+
+#define SYST_CVR 0xE000E018u
+
+static uint32 Counter;
+static uint32 Step;
+
+uint32 Reg_HostRead32( uint32 Address )
+{
+    uint32 Value = Counter;
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( SYST_CVR, Address, "Register read is not the SysTick counter" );
+    Counter = ( Counter - Step ) & 0x00FFFFFFu;
+    return Value;
+}
+
+void Reg_HostWrite32( uint32 Address, uint32 Value )
+{
+    (void)Address;
+    (void)Value;
+    TEST_FAIL_MESSAGE( "Os should not write any register" );
+}
+
+static void Task_0( void )
+{
+}
+
+static const Os_TaskEntryType Tasks[ 1 ] = { Task_0 };
+
+static const Os_ConfigType Config = { Tasks, 1u, NULL_PTR };
+
+void setUp( void )
+{
+    Os_Init( &Config );
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test dispatch latency**
+ *
+ * The test validates the time between activation and dispatch with the counter going down 150
+ * counts per read, to pass the latency should be 150.
+ */
+void test__Os_GetDispatchLatency__counts( void )
+{
+    uint32 Latency;
+    Counter = 1000u;
+    Step    = 150u;
+    (void)ActivateTask( 0u );
+    (void)Schedule();
+    Latency = Os_GetDispatchLatency();
+    TEST_ASSERT_EQUAL_MESSAGE( 150u, Latency, "Latency is not 150 as supposed to be" );
+}
+
+/**
+ * @brief   **Test dispatch latency over the counter reload**
+ *
+ * The test validates the time between activation and dispatch when the counter wraps from 0 to
+ * 0xFFFFFF in between, to pass the latency should be 100.
+ */
+void test__Os_GetDispatchLatency__wrap( void )
+{
+    uint32 Latency;
+    Counter = 40u;
+    Step    = 100u;
+    (void)ActivateTask( 0u );
+    (void)Schedule();
+    Latency = Os_GetDispatchLatency();
+    TEST_ASSERT_EQUAL_MESSAGE( 100u, Latency, "Latency is not 100 as supposed to be" );
+}
@@ -0,0 +1,262 @@
+/**
+ * @file    Test_Sim.c
+ * @brief   **Unit Test for the Host Peripheral Simulator**
+ *
+ * The register accesses go through the Reg.h host functions implemented by the simulator, the same
+ * path the drivers take. The last tests run the Mcu and Dio drivers unchanged on top of it and
+ * check the register accesses each API call costs.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Reg_Map.h"
+#include "Sim.h"
+#include "Mcu.h"
+#include "Dio.h"
+
+#define RCC_CR      0x40021000u
+#define RCC_CFGR    0x40021008u
+#define RCC_IOPENR  0x40021034u
+#define RCC_AHBENR  0x40021038u
+#define GPIOA_MODER 0x50000000u
+#define GPIOA_IDR   0x50000010u
+#define GPIOA_ODR   0x50000014u
+#define GPIOA_BSRR  0x50000018u
+#define GPIOA_BRR   0x50000028u
+#define SYST_CSR    0xE000E010u
+#define SYST_RVR    0xE000E014u
+#define SYST_CVR    0xE000E018u
+#define DMA_ISR     0x40020000u
+#define DMA_CCR1    0x40020008u
+#define DMA_CNDTR1  0x4002000Cu
+#define DMA_CPAR1   0x40020010u
+#define DMA_CMAR1   0x40020014u
+#define SRAM        0x20000000u
+
+static uint32 Handled;
+
+static void Handler( void )
+{
+    Handled++;
+}
+
+void setUp( void )
+{
+    Sim_Init();
+    Handled = 0u;
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test gated GPIO clock**
+ *
+ * The test validates writes to GPIOA before its clock is enabled are lost and counted as ignored,
+ * to pass ODR should keep its reset value and the counter should report one ignored write.
+ */
+void test__Sim_Gpio__clock_disabled( void )
+{
+    REG_WRITE32( GPIOA_ODR, 0x20u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0u, Sim_Peek32( GPIOA_ODR ), "ODR changed with the clock disabled" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Sim_GetCounters( SIM_GPIO )->Ignored, "Write is not counted as ignored" );
+}
+
+/**
+ * @brief   **Test set and reset of the outputs**
+ *
+ * The test validates BSRR and BRR act on ODR and IDR reads the output latch of pin 5 set as
+ * output and the external level of pin 0 left as input, to pass IDR should follow both.
+ */
+void test__Sim_Gpio__bsrr_brr_idr( void )
+{
+    REG_WRITE32( RCC_IOPENR, 0x01u );
+    REG_WRITE32( GPIOA_MODER, ( REG_READ32( GPIOA_MODER ) & ~0x0C03u ) | 0x0400u );
+    Sim_SetInput( 0u, 0x0001u );
+
+    REG_WRITE32( GPIOA_BSRR, 0x00000020u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x21u, REG_READ32( GPIOA_IDR ) & 0x21u, "IDR does not follow BSRR and the input" );
+    REG_WRITE8( GPIOA_BSRR + 2u, 0x20u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00u, REG_READ32( GPIOA_ODR ), "Byte write to BSRR did not reset pin 5" );
+    REG_WRITE32( GPIOA_BSRR, 0x00200020u );
+    REG_WRITE32( GPIOA_BRR, 0x0020u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00u, REG_READ32( GPIOA_ODR ), "BRR did not reset pin 5" );
+}
+
+/**
+ * @brief   **Test PLL status bits**
+ *
+ * The test validates PLLRDY follows PLLON unless the PLL is set to fail, and SWS follows SW, to
+ * pass the status bits should read as the model dictates.
+ */
+void test__Sim_Rcc__pll_ready( void )
+{
+    REG_WRITE32( RCC_CR, REG_READ32( RCC_CR ) | 0x01000000u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x02000000u, REG_READ32( RCC_CR ) & 0x02000000u, "PLLRDY is not set" );
+    Sim_SetPllLock( FALSE );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0u, REG_READ32( RCC_CR ) & 0x02000000u, "PLLRDY is set on a failing PLL" );
+    REG_WRITE32( RCC_CFGR, 0x2u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x12u, REG_READ32( RCC_CFGR ), "SWS does not follow SW" );
+}
+
+/**
+ * @brief   **Test SysTick count down**
+ *
+ * The test validates a reload of 99 takes an exception every 100 cycles and COUNTFLAG clears on
+ * read, to pass 1000 cycles should run the handler 10 times.
+ */
+void test__Sim_SysTick__period( void )
+{
+    Sim_SetSysTickHandler( Handler );
+    REG_WRITE32( SYST_RVR, 99u );
+    REG_WRITE32( SYST_CVR, 1234u );
+    REG_WRITE32( SYST_CSR, 0x7u );
+
+    Sim_Advance( 1000u );
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, Handled, "Handler did not run every 100 cycles" );
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, Sim_GetSysTickExceptions(), "Exceptions are not 10" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00010007u, REG_READ32( SYST_CSR ), "COUNTFLAG is not set" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000007u, REG_READ32( SYST_CSR ), "COUNTFLAG did not clear on read" );
+
+    /*the enable is the third access, the periods end on cycles 102, 202 and so on*/
+    Sim_WaitForInterrupt();
+    TEST_ASSERT_EQUAL_MESSAGE( 11u, Handled, "Wait for interrupt did not take the next exception" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1102u, Sim_GetCycles(), "Wait for interrupt did not stop at the end of the period" );
+}
+
+/**
+ * @brief   **Test SysTick exception with the interrupts masked**
+ *
+ * The test validates wait for interrupt wakes on a masked exception without running the handler,
+ * and the handler runs once when unmasked even after several periods, to pass the handler should
+ * run once.
+ */
+void test__Sim_SysTick__masked( void )
+{
+    Sim_SetSysTickHandler( Handler );
+    REG_WRITE32( SYST_RVR, 99u );
+    REG_WRITE32( SYST_CSR, 0x7u );
+    Sim_SetInterruptMask( TRUE );
+
+    Sim_WaitForInterrupt();
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Handled, "Handler ran with the interrupts masked" );
+    Sim_Advance( 1000u );
+    Sim_SetInterruptMask( FALSE );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Handled, "Pending exception did not run once on unmask" );
+}
+
+/**
+ * @brief   **Test DMA memory to memory**
+ *
+ * The test validates an 8 word memory to memory transfer between two windows mapped in SRAM, to
+ * pass the destination should hold the source words and the channel should flag the half and the
+ * full transfer.
+ */
+void test__Sim_Dma__mem2mem( void )
+{
+    uint32 Source[ 8 ]      = { 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u };
+    uint32 Destination[ 8 ] = { 0u };
+
+    Sim_MapMemory( SRAM, Source, sizeof( Source ) );
+    Sim_MapMemory( SRAM + 0x100u, Destination, sizeof( Destination ) );
+    REG_WRITE32( RCC_AHBENR, REG_READ32( RCC_AHBENR ) | 0x1u );
+    REG_WRITE32( DMA_CNDTR1, 8u );
+    REG_WRITE32( DMA_CPAR1, SRAM );
+    REG_WRITE32( DMA_CMAR1, SRAM + 0x100u );
+    /*MEM2MEM, 32 bit sizes, both addresses incremented, peripheral to memory*/
+    REG_WRITE32( DMA_CCR1, 0x4AC1u );
+
+    TEST_ASSERT_EQUAL_HEX32_ARRAY_MESSAGE( Source, Destination, 8, "Destination does not hold the source" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x7u, REG_READ32( DMA_ISR ), "Channel 1 did not flag GIF, TCIF and HTIF" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, REG_READ32( DMA_CNDTR1 ), "Items left is not 0" );
+}
+
+/**
+ * @brief   **Test DMA to a GPIO register**
+ *
+ * The test validates a memory to peripheral channel writes one BSRR pattern per request and a
+ * request on an unmapped memory address stops the channel with a transfer error, to pass ODR
+ * should follow the patterns and the channel should flag TEIF.
+ */
+void test__Sim_Dma__requests_to_bsrr( void )
+{
+    uint32 Patterns[ 2 ] = { 0x00000020u, 0x00200000u };
+
+    Sim_MapMemory( SRAM, Patterns, sizeof( Patterns ) );
+    REG_WRITE32( RCC_IOPENR, 0x01u );
+    REG_WRITE32( RCC_AHBENR, REG_READ32( RCC_AHBENR ) | 0x1u );
+    REG_WRITE32( DMA_CNDTR1, 2u );
+    REG_WRITE32( DMA_CPAR1, GPIOA_BSRR );
+    REG_WRITE32( DMA_CMAR1, SRAM );
+    /*32 bit sizes, memory incremented, memory to peripheral*/
+    REG_WRITE32( DMA_CCR1, 0x0A91u );
+
+    Sim_DmaRequest( 1u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x20u, Sim_Peek32( GPIOA_ODR ), "First request did not set pin 5" );
+    Sim_DmaRequest( 1u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00u, Sim_Peek32( GPIOA_ODR ), "Second request did not reset pin 5" );
+
+    REG_WRITE32( DMA_CCR1, 0u );
+    REG_WRITE32( DMA_CNDTR1, 1u );
+    REG_WRITE32( DMA_CMAR1, SRAM + 0x1000u );
+    REG_WRITE32( DMA_CCR1, 0x0A91u );
+    Sim_DmaRequest( 1u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x8u, REG_READ32( DMA_ISR ) & 0x8u, "Unmapped address did not flag TEIF" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0u, REG_READ32( DMA_CCR1 ) & 0x1u, "Transfer error did not disable the channel" );
+}
+
+/**
+ * @brief   **Test register overlays on the simulator**
+ *
+ * The test validates the Reg_Map.h overlays reach the registers at their reference manual
+ * addresses, to pass the writes through the structures should land on the simulated registers.
+ */
+void test__Sim_RegMap__overlay_addresses( void )
+{
+    REG_WRITE( &REG_RCC->AHBENR, 0x01u );
+    REG_WRITE( &REG_DMA1->CH[ 0 ].CMAR, SRAM );
+    REG_WRITE( &REG_DMA1->CH[ 6 ].CPAR, SRAM + 4u );
+    REG_WRITE( &REG_RCC->IOPENR, 0x04u );
+    REG_WRITE( &REG_GPIO( 2u )->ODR, 0x5Au );
+    REG_WRITE( &REG_SYSTICK->RVR, 0x1234u );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x01u, Sim_Peek32( RCC_AHBENR ), "RCC AHBENR is not at 0x40021038" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( SRAM, Sim_Peek32( DMA_CMAR1 ), "DMA CMAR1 is not at 0x40020014" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( SRAM + 4u, Sim_Peek32( 0x40020088u ), "DMA CPAR7 is not at 0x40020088" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x5Au, Sim_Peek32( GPIOA_ODR + 0x800u ), "GPIOC ODR is not at 0x50000814" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x1234u, REG_READ32( SYST_RVR ), "SysTick RVR is not at 0xE000E014" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Sim_GetCounters( SIM_OTHER )->Writes, "An overlay write missed the models" );
+}
+
+/**
+ * @brief   **Test Mcu clock setup on the simulator**
+ *
+ * The test validates Mcu_InitClock runs on the simulated RCC and flash, to pass the system clock
+ * should run from the PLL and the call should cost 9 register writes, 1 for the latency, 4 for the
+ * cache and 4 for the PLL and the clock switch.
+ */
+void test__Sim_Mcu_InitClock__writes( void )
+{
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Mcu_InitClock(), "Mcu_InitClock failed" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x10u, Sim_Peek32( RCC_CFGR ) & 0x38u, "System clock is not the PLL" );
+    TEST_ASSERT_EQUAL_MESSAGE( 9u, Sim_GetWrites(), "Mcu_InitClock did not write 9 registers" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Sim_GetCounters( SIM_OTHER )->Reads, "Mcu_InitClock read an unmodelled register" );
+}
+
+/**
+ * @brief   **Test Dio port read on the simulator**
+ *
+ * The test validates Dio_ReadPort returns the external level of port B and costs a single register
+ * read and no write, to pass the level should be 0x8001.
+ */
+void test__Sim_Dio_ReadPort__one_read( void )
+{
+    REG_WRITE32( RCC_IOPENR, 0x02u );
+    REG_WRITE32( GPIOA_MODER + 0x400u, 0u );
+    Sim_SetInput( 1u, 0x8001u );
+    Sim_ResetCounters();
+
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x8001u, Dio_ReadPort( DIO_PORT_B ), "Port B level is not 0x8001" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Sim_GetCounters( SIM_GPIO )->Reads, "Dio_ReadPort did not read once" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Sim_GetWrites(), "Dio_ReadPort wrote a register" );
+}
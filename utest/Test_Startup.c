@@ -0,0 +1,136 @@
+/**
+ * @file    Test_Startup.c
+ * @brief   **Unit Test for the Runtime Handler Install**
+ *
+ * The test overrides STARTUP_RAM_VECTORS in project.yml to build the SRAM vector table. The reset
+ * handler is never run, so setUp seeds every exception vector with its own sentinel value and the
+ * linker script symbols the reset handler copies from are stand ins defined here.
+ */
+#include <stdint.h>
+#include "unity.h"
+#include "Std_Types.h"
+#include "Startup.h"
+
+/*linker script symbols referenced by the reset handler and the flash vector table, weak because
+the host C runtime already defines some of them*/
+__attribute__( ( weak ) ) uint8 __stack_init;
+__attribute__( ( weak ) ) uint8 __bss_start;
+__attribute__( ( weak ) ) uint8 __bss_end;
+__attribute__( ( weak ) ) uint8 __data_init;
+__attribute__( ( weak ) ) uint8 __data_start;
+__attribute__( ( weak ) ) uint8 __data_end;
+
+void Reg_HostWrite32( uint32 Address, uint32 Value )
+{
+    (void)Address;
+    (void)Value;
+    TEST_FAIL_MESSAGE( "No register shall be written" );
+}
+
+static void Test_Handler( void )
+{
+}
+
+static void Test_OtherHandler( void )
+{
+}
+
+/*distinct value seeded in each vector, never called*/
+static Startup_HandlerType Test_Sentinel( uint8 Vector )
+{
+    return (Startup_HandlerType)(uintptr_t)( 0xA5000000u + Vector );
+}
+
+/*assert every exception vector but Vector still holds its sentinel*/
+static void Test_AssertSentinels( uint8 Vector )
+{
+    for( uint8 i = 2u; i < STARTUP_VECTORS; i++ )
+    {
+        if( i != Vector )
+        {
+            TEST_ASSERT_TRUE_MESSAGE( Startup_GetHandler( i ) == Test_Sentinel( i ), "A vector other than the target was written" );
+        }
+    }
+}
+
+void setUp( void )
+{
+    for( uint8 i = 2u; i < STARTUP_VECTORS; i++ )
+    {
+        TEST_ASSERT_EQUAL_MESSAGE( E_OK, Startup_SetHandler( i, Test_Sentinel( i ) ), "Sentinel was not installed" );
+    }
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test the device interrupt vector**
+ *
+ * The test validates the device interrupts follow the 16 core exceptions, to pass STARTUP_IRQ( 0 )
+ * should be vector 16 and STARTUP_IRQ( 31 ) the last vector of the table.
+ */
+void test__Startup_Irq__vector( void )
+{
+    TEST_ASSERT_EQUAL_MESSAGE( 16u, STARTUP_IRQ( 0u ), "Interrupt 0 is not vector 16" );
+    TEST_ASSERT_EQUAL_MESSAGE( STARTUP_VECTORS - 1u, STARTUP_IRQ( 31u ), "Interrupt 31 is not the last vector" );
+}
+
+/**
+ * @brief   **Test install a device interrupt handler**
+ *
+ * The test validates a handler installed for the device interrupt 7 lands in the slot of vector 23
+ * of the SRAM table, to pass the install should return E_OK, vector 23 should hold the handler and
+ * every other vector should keep its sentinel.
+ */
+void test__Startup_SetHandler__irq_slot( void )
+{
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Startup_SetHandler( STARTUP_IRQ( 7u ), Test_Handler ), "Handler was not installed" );
+    TEST_ASSERT_TRUE_MESSAGE( Startup_GetHandler( 23u ) == Test_Handler, "Vector 23 does not hold the handler" );
+    Test_AssertSentinels( 23u );
+}
+
+/**
+ * @brief   **Test replace an installed handler**
+ *
+ * The test validates a second install over the same vector replaces the handler, to pass the
+ * SysTick vector 15 should hold the last handler installed and every other vector its sentinel.
+ */
+void test__Startup_SetHandler__replace( void )
+{
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Startup_SetHandler( 15u, Test_Handler ), "Handler was not installed" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Startup_SetHandler( 15u, Test_OtherHandler ), "Handler was not replaced" );
+    TEST_ASSERT_TRUE_MESSAGE( Startup_GetHandler( 15u ) == Test_OtherHandler, "Vector 15 does not hold the last handler" );
+    Test_AssertSentinels( 15u );
+}
+
+/**
+ * @brief   **Test install out of the table**
+ *
+ * The test validates the vectors past the table are rejected, to pass an install over vector
+ * STARTUP_VECTORS, the interrupt 32, should return E_NOT_OK and no vector should change.
+ */
+void test__Startup_SetHandler__out_of_range( void )
+{
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Startup_SetHandler( STARTUP_VECTORS, Test_Handler ), "Vector past the table was accepted" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Startup_SetHandler( STARTUP_IRQ( 32u ), Test_Handler ), "Interrupt 32 was accepted" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Startup_SetHandler( 0xFFu, Test_Handler ), "Vector 255 was accepted" );
+    Test_AssertSentinels( STARTUP_VECTORS );
+    TEST_ASSERT_TRUE_MESSAGE( Startup_GetHandler( STARTUP_VECTORS ) == NULL_PTR, "Vector past the table has a handler" );
+}
+
+/**
+ * @brief   **Test install over the reset and stack entries**
+ *
+ * The test validates the first two entries are not exception handlers, to pass an install over
+ * vector 0 or 1 should return E_NOT_OK, as a null handler over a valid vector, and no vector should
+ * change.
+ */
+void test__Startup_SetHandler__rejected( void )
+{
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Startup_SetHandler( 0u, Test_Handler ), "Stack entry was accepted" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Startup_SetHandler( 1u, Test_Handler ), "Reset entry was accepted" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Startup_SetHandler( STARTUP_IRQ( 0u ), NULL_PTR ), "Null handler was accepted" );
+    Test_AssertSentinels( STARTUP_VECTORS );
+}
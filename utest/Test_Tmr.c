@@ -0,0 +1,367 @@
+/**
+ * @file    Test_Tmr.c
+ * @brief   **Unit Test for the Software Timers**
+ *
+ * SysTick is simulated one core clock cycle at a time, the counter loads the reload value when it
+ * is zero and sets COUNTFLAG and the pending interrupt when it reaches zero, every register access
+ * takes one cycle. Most tests drive the
+ * wheel calling Tmr_Tick directly, the tickless idle tests let the simulated clock run in WFI and
+ * serve the pending SysTick interrupt once Tmr_Idle returns. TMR_SYSTICK_RELOAD is set in
+ * project.yml to 1ms ticks at 16MHz, so the expected wake ups do not depend on the Mcu clock.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Mfx.h"
+#include "Tmr.h"
+
+#define SYST_CSR 0xE000E010u
+#define SYST_RVR 0xE000E014u
+#define SYST_CVR 0xE000E018u
+
+#define COUNTFLAG 0x00010000u
+#define CYCLES    ( TMR_SYSTICK_RELOAD + 1u )
+#define SLACK     64u /*cycles lost while SysTick is stopped to be reprogrammed*/
+
+static uint32 Syst[ 3 ];
+static boolean Pending;
+static uint32 Clock;
+static uint32 WakeAt;
+static uint32 Wakeups;
+static uint32 Expired[ 4 ];
+static uint32 Count[ 4 ];
+static Tmr_TimerType Timer[ 4 ];
+
+static void Systick_Run( uint32 Cycles )
+{
+    for( uint32 i = 0u; i < Cycles; i++ )
+    {
+        Clock++;
+        if( ( Syst[ 0 ] & 1u ) != 0u )
+        {
+            if( Syst[ 2 ] == 0u )
+            {
+                Syst[ 2 ] = Syst[ 1 ];
+            }
+            else if( --Syst[ 2 ] == 0u )
+            {
+                Syst[ 0 ] |= COUNTFLAG;
+                Pending = ( ( Syst[ 0 ] & 2u ) != 0u ) ? TRUE : Pending;
+            }
+        }
+    }
+}
+
+uint32 Reg_HostRead32( uint32 Address )
+{
+    uint32 Value;
+
+    TEST_ASSERT_TRUE_MESSAGE( ( Address >= SYST_CSR ) && ( Address <= SYST_CVR ), "Read is not from a SysTick register" );
+    Value = Syst[ ( Address - SYST_CSR ) >> 2u ];
+    if( Address == SYST_CSR )
+    {
+        Syst[ 0 ] &= ~COUNTFLAG;
+    }
+    Systick_Run( 1u );
+    return Value;
+}
+
+void Reg_HostWrite32( uint32 Address, uint32 Value )
+{
+    TEST_ASSERT_TRUE_MESSAGE( ( Address >= SYST_CSR ) && ( Address <= SYST_CVR ), "Write is not to a SysTick register" );
+    if( Address == SYST_CSR )
+    {
+        Syst[ 0 ] = ( Syst[ 0 ] & COUNTFLAG ) | Value;
+    }
+    else if( Address == SYST_RVR )
+    {
+        Syst[ 1 ] = Value;
+    }
+    else
+    {
+        Syst[ 2 ] = 0u;
+        Syst[ 0 ] &= ~COUNTFLAG;
+    }
+    Systick_Run( 1u );
+}
+
+void Tmr_HostWaitForInterrupt( void )
+{
+    Wakeups++;
+    while( ( Pending == FALSE ) && ( Clock != WakeAt ) )
+    {
+        TEST_ASSERT_TRUE_MESSAGE( ( Syst[ 0 ] & 1u ) != 0u, "WFI with SysTick stopped" );
+        Systick_Run( 1u );
+    }
+}
+
+static void Systick_Serve( void )
+{
+    if( Pending == TRUE )
+    {
+        Pending = FALSE;
+        Tmr_Tick();
+    }
+}
+
+static void Idle_Until( const uint32 *Counter, uint32 Value )
+{
+    while( *Counter < Value )
+    {
+        Tmr_Idle();
+        Systick_Serve();
+    }
+}
+
+static void Callback_0( void )
+{
+    Expired[ 0 ] = Tmr_GetTicks();
+    Count[ 0 ]++;
+    Expired[ 3 ] = Clock;
+}
+
+static void Callback_1( void )
+{
+    Expired[ 1 ] = Tmr_GetTicks();
+    Count[ 1 ]++;
+    /*stop the other timer expiring on the same tick*/
+    Tmr_Stop( &Timer[ 2 ] );
+}
+
+static void Callback_2( void )
+{
+    Expired[ 2 ] = Tmr_GetTicks();
+    Count[ 2 ]++;
+    Tmr_Stop( &Timer[ 1 ] );
+}
+
+static void Tick( uint32 Ticks )
+{
+    for( uint32 i = 0u; i < Ticks; i++ )
+    {
+        Tmr_Tick();
+    }
+}
+
+void setUp( void )
+{
+    for( uint8 i = 0u; i < 4u; i++ )
+    {
+        Expired[ i ] = 0u;
+        Count[ i ]   = 0u;
+    }
+    Syst[ 0 ] = 0u;
+    Pending   = FALSE;
+    Clock     = 0u;
+    WakeAt    = 0xFFFFFFFFu;
+    Wakeups   = 0u;
+    Tmr_Init();
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test SysTick setup**
+ *
+ * The test validates Tmr_Init programs SysTick, to pass the reload register should be
+ * TMR_SYSTICK_RELOAD and the control register 0x7.
+ */
+void test__Tmr_Init__systick( void )
+{
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000007u, Syst[ 0 ] & ~COUNTFLAG, "CSR is not 0x00000007 as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( TMR_SYSTICK_RELOAD, Syst[ 1 ], "RVR is not TMR_SYSTICK_RELOAD as supposed to be" );
+}
+
+/**
+ * @brief   **Test invalid start parameters**
+ *
+ * The test validates a zero timeout, a timeout or period over TMR_MAX_TIMEOUT and a missing
+ * callback are rejected, to pass the status should be E_NOT_OK and the timer stopped.
+ */
+void test__Tmr_Start__invalid( void )
+{
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Tmr_Start( &Timer[ 0 ], 0u, 0u, Callback_0 ), "Zero timeout accepted" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Tmr_Start( &Timer[ 0 ], TMR_MAX_TIMEOUT + 1u, 0u, Callback_0 ), "Long timeout accepted" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Tmr_Start( &Timer[ 0 ], 1u, TMR_MAX_TIMEOUT + 1u, Callback_0 ), "Long period accepted" );
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Tmr_Start( &Timer[ 0 ], 1u, 0u, NULL_PTR ), "Missing callback accepted" );
+    TEST_ASSERT_FALSE_MESSAGE( Tmr_IsRunning( &Timer[ 0 ] ), "Timer is running" );
+}
+
+/**
+ * @brief   **Test one shot expiry**
+ *
+ * The test validates one shot timers expire on the exact tick from every level of the wheel, to
+ * pass the callback should be called once on tick Timeout and the timer should be stopped after.
+ */
+void test__Tmr_Tick__one_shot( void )
+{
+    static const uint32 Timeouts[] = { 1u, 31u, 32u, 33u, 1000u, 1024u, 40000u, TMR_MAX_TIMEOUT };
+    uint32 Start;
+
+    for( uint32 i = 0u; i < ( sizeof( Timeouts ) / sizeof( Timeouts[ 0 ] ) ); i++ )
+    {
+        Count[ 0 ] = 0u;
+        Start      = Tmr_GetTicks();
+        TEST_ASSERT_EQUAL_MESSAGE( E_OK, Tmr_Start( &Timer[ 0 ], Timeouts[ i ], 0u, Callback_0 ), "Status is not E_OK as supposed to be" );
+        Tick( Timeouts[ i ] - 1u );
+        TEST_ASSERT_EQUAL_MESSAGE( 0u, Count[ 0 ], "Timer expired too early" );
+        Tick( 1u );
+        TEST_ASSERT_EQUAL_MESSAGE( 1u, Count[ 0 ], "Timer did not expire once as supposed to be" );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( Start + Timeouts[ i ], Expired[ 0 ], "Timer did not expire on its tick" );
+        TEST_ASSERT_FALSE_MESSAGE( Tmr_IsRunning( &Timer[ 0 ] ), "One shot timer is still running" );
+    }
+}
+
+/**
+ * @brief   **Test periodic expiry**
+ *
+ * The test validates a timer with timeout 5 and period 40 ticked 205 times, to pass the callback
+ * should be called 6 times, the last one on tick 205.
+ */
+void test__Tmr_Tick__periodic( void )
+{
+    (void)Tmr_Start( &Timer[ 0 ], 5u, 40u, Callback_0 );
+    Tick( 205u );
+    TEST_ASSERT_EQUAL_MESSAGE( 6u, Count[ 0 ], "Timer did not expire 6 times as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 205u, Expired[ 0 ], "Timer did not expire on tick 205" );
+    TEST_ASSERT_TRUE_MESSAGE( Tmr_IsRunning( &Timer[ 0 ] ), "Periodic timer is not running" );
+}
+
+/**
+ * @brief   **Test stop and restart**
+ *
+ * The test validates a stopped timer does not expire and a restarted one expires counting from the
+ * restart, to pass timer 0 should never expire and timer 1 should expire on tick 110.
+ */
+void test__Tmr_Stop__restart( void )
+{
+    (void)Tmr_Start( &Timer[ 0 ], 50u, 0u, Callback_0 );
+    (void)Tmr_Start( &Timer[ 1 ], 50u, 0u, Callback_0 );
+    Tick( 10u );
+    Tmr_Stop( &Timer[ 0 ] );
+    (void)Tmr_Start( &Timer[ 1 ], 100u, 0u, Callback_0 );
+    Tick( 200u );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Count[ 0 ], "Timers did not expire once as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 110u, Expired[ 0 ], "Timer did not expire on tick 110" );
+}
+
+/**
+ * @brief   **Test stop from a callback**
+ *
+ * The test validates two timers expiring on the same tick that stop each other, to pass only one
+ * of the callbacks should be called.
+ */
+void test__Tmr_Tick__stop_from_callback( void )
+{
+    (void)Tmr_Start( &Timer[ 1 ], 70u, 0u, Callback_1 );
+    (void)Tmr_Start( &Timer[ 2 ], 70u, 0u, Callback_2 );
+    Tick( 70u );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Count[ 1 ] + Count[ 2 ], "Both callbacks were called" );
+}
+
+/**
+ * @brief   **Test idle ticks**
+ *
+ * The test validates the ticks to the next one with work, to pass it should be TMR_NO_EXPIRY with
+ * no timer, 96 with a timer due in 100 ticks that cascades on tick 96, then 4 to its expiry, and 2
+ * once a timer due in 2 ticks is started.
+ */
+void test__Tmr_GetIdleTicks__next( void )
+{
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( TMR_NO_EXPIRY, Tmr_GetIdleTicks(), "Idle ticks is not TMR_NO_EXPIRY as supposed to be" );
+    (void)Tmr_Start( &Timer[ 0 ], 100u, 0u, Callback_0 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 96u, Tmr_GetIdleTicks(), "Idle ticks is not 96 as supposed to be" );
+    Tick( 96u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 4u, Tmr_GetIdleTicks(), "Idle ticks is not 4 as supposed to be" );
+    (void)Tmr_Start( &Timer[ 1 ], 2u, 0u, Callback_0 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 2u, Tmr_GetIdleTicks(), "Idle ticks is not 2 as supposed to be" );
+}
+
+/**
+ * @brief   **Test tickless sleep**
+ *
+ * The test validates a timer due in 500 ticks started 4000 cycles into the first tick, to pass the
+ * core should wake up twice, to cascade the timer on tick 480 and to expire it on tick 500, cycle
+ * 500 * CYCLES, and the next tick should follow one tick period later.
+ */
+void test__Tmr_Idle__sleep( void )
+{
+    Systick_Run( 4000u );
+    (void)Tmr_Start( &Timer[ 0 ], 500u, 0u, Callback_0 );
+    Idle_Until( &Count[ 0 ], 1u );
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, Wakeups, "Core did not wake up twice as supposed to be" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 500u, Expired[ 0 ], "Timer did not expire on tick 500" );
+    TEST_ASSERT_UINT32_WITHIN_MESSAGE( SLACK, 500u * CYCLES, Expired[ 3 ], "Timer did not expire on its cycle" );
+    Systick_Run( CYCLES );
+    TEST_ASSERT_TRUE_MESSAGE( Pending, "Next tick is not one tick period later" );
+}
+
+/**
+ * @brief   **Test early wake up**
+ *
+ * The test validates a sleep interrupted by another interrupt in the middle of tick 200, to pass
+ * the tick count should be 200 on wake up and the timer should still expire on its cycle after
+ * the cascade on tick 480.
+ */
+void test__Tmr_Idle__early_wakeup( void )
+{
+    (void)Tmr_Start( &Timer[ 0 ], 500u, 0u, Callback_0 );
+    WakeAt = ( 200u * CYCLES ) + 7000u;
+    Tmr_Idle();
+    TEST_ASSERT_UINT32_WITHIN_MESSAGE( SLACK, WakeAt, Clock, "Core did not wake up on the interrupt" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 200u, Tmr_GetTicks(), "Tick count is not 200 as supposed to be" );
+    Idle_Until( &Count[ 0 ], 1u );
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, Wakeups, "Core did not wake up three times as supposed to be" );
+    TEST_ASSERT_UINT32_WITHIN_MESSAGE( SLACK, 500u * CYCLES, Expired[ 3 ], "Timer did not expire on its cycle" );
+}
+
+/**
+ * @brief   **Test sleep longer than SysTick**
+ *
+ * The test validates a timer due in 3000 ticks, longer than the 24 bit counter can hold and with
+ * two cascades in between, to pass it should expire on its cycle with only a few wake ups.
+ */
+void test__Tmr_Idle__long_sleep( void )
+{
+    (void)Tmr_Start( &Timer[ 0 ], 3000u, 0u, Callback_0 );
+    Idle_Until( &Count[ 0 ], 1u );
+    TEST_ASSERT_UINT32_WITHIN_MESSAGE( SLACK, 3000u * CYCLES, Expired[ 3 ], "Timer did not expire on its cycle" );
+    TEST_ASSERT_LESS_THAN_MESSAGE( 8u, Wakeups, "Core woke up too often" );
+}
+
+/**
+ * @brief   **Test idle with work on the next tick**
+ *
+ * The test validates a periodic timer every tick, to pass the core should wake up on every regular
+ * tick and the timer should expire 10 times in 10 ticks.
+ */
+void test__Tmr_Idle__every_tick( void )
+{
+    (void)Tmr_Start( &Timer[ 0 ], 1u, 1u, Callback_0 );
+    Idle_Until( &Count[ 0 ], 10u );
+    TEST_ASSERT_EQUAL_MESSAGE( 10u, Wakeups, "Core did not wake up every tick" );
+    TEST_ASSERT_UINT32_WITHIN_MESSAGE( SLACK, 10u * CYCLES, Expired[ 3 ], "Timer did not expire on its cycle" );
+}
+
+/**
+ * @brief   **Test idle entered on a tick boundary**
+ *
+ * The test validates Tmr_Idle entered with the counter at zero, the boundary of tick 1 reached and
+ * its interrupt pending, to pass the tick count should be 1 once the pending tick is served and the
+ * timer due in 10 ticks should expire on tick 10 and on its cycle.
+ */
+void test__Tmr_Idle__boundary_pending( void )
+{
+    while( Pending == FALSE )
+    {
+        Systick_Run( 1u );
+    }
+    (void)Tmr_Start( &Timer[ 0 ], 10u, 0u, Callback_0 );
+    Tmr_Idle();
+    Systick_Serve();
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 1u, Tmr_GetTicks(), "Boundary tick was counted twice" );
+    Idle_Until( &Count[ 0 ], 1u );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 10u, Expired[ 0 ], "Timer did not expire on tick 10" );
+    TEST_ASSERT_UINT32_WITHIN_MESSAGE( SLACK, 10u * CYCLES, Expired[ 3 ], "Timer did not expire on its cycle" );
+}
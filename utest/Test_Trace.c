@@ -0,0 +1,110 @@
+/**
+ * @file    Test_Trace.c
+ * @brief   **Unit Test for the Binary Trace Buffer**
+ *
+ * The test overrides TRACE_ENABLE and TRACE_RECORDS in project.yml to build the rings with 8
+ * records. The tick count is taken from the test and the SysTick current value register is
+ * modelled in RAM.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Trace.h"
+#include "Tmr_Cfg.h"
+
+#define SYST_CVR 0xE000E018u
+
+static uint32 Ticks;
+static uint32 Counter;
+
+uint32 Tmr_GetTicks( void )
+{
+    return Ticks;
+}
+
+uint32 Reg_HostRead32( uint32 Address )
+{
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( SYST_CVR, Address, "Register read is not the SysTick counter" );
+    return Counter;
+}
+
+void setUp( void )
+{
+    Ticks   = 0u;
+    Counter = TMR_SYSTICK_RELOAD;
+    Trace_Init();
+}
+
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test the buffer header**
+ *
+ * The test validates Trace_Init writes the header the decoder looks for, to pass the magic word
+ * should be TRACE_MAGIC, the geometry the configured one and every ring should be empty.
+ */
+void test__Trace_Init__header( void )
+{
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( TRACE_MAGIC, Trace_Buffer.Magic, "Magic word is not TRACE_MAGIC" );
+    TEST_ASSERT_EQUAL_MESSAGE( TRACE_CONTEXTS, Trace_Buffer.Contexts, "Wrong number of contexts" );
+    TEST_ASSERT_EQUAL_MESSAGE( 8u, Trace_Buffer.Records, "Wrong number of records per context" );
+    TEST_ASSERT_EQUAL_MESSAGE( MCU_CORE_CLOCK, Trace_Buffer.Clock, "Timestamp clock is not the core clock" );
+    for( uint8 Context = 0u; Context < TRACE_CONTEXTS; Context++ )
+    {
+        TEST_ASSERT_EQUAL_MESSAGE( 0u, Trace_Buffer.Ring[ Context ].Head, "Ring is not empty" );
+    }
+}
+
+/**
+ * @brief   **Test a record**
+ *
+ * The test validates the record layout, to pass an event 0x81 with argument 0x12345678 written 100
+ * cycles into tick 3 should be stored as word 0x81345678 with stamp 3 * (reload + 1) + 100 and
+ * advance the head of its context only.
+ */
+void test__Trace_Write__record( void )
+{
+    Ticks   = 3u;
+    Counter = TMR_SYSTICK_RELOAD - 100u;
+    TRACE( TRACE_CONTEXT_ISR, 0x81u, 0x12345678u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, Trace_Buffer.Ring[ TRACE_CONTEXT_ISR ].Head, "Head was not advanced" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, Trace_Buffer.Ring[ TRACE_CONTEXT_TASK ].Head, "Another context was written" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x81345678u, Trace_Buffer.Ring[ TRACE_CONTEXT_ISR ].Records[ 0 ].Word, "Wrong event and argument" );
+    TEST_ASSERT_EQUAL_MESSAGE( ( 3u * ( TMR_SYSTICK_RELOAD + 1u ) ) + 100u, Trace_Buffer.Ring[ TRACE_CONTEXT_ISR ].Records[ 0 ].Stamp,
+                               "Wrong timestamp" );
+}
+
+/**
+ * @brief   **Test the ring wrap around**
+ *
+ * The test validates the oldest records are overwritten, to pass after 11 records on a ring of 8
+ * the head should be 11 and slots 0 to 2 should hold the records 8 to 10.
+ */
+void test__Trace_Write__wrap_around( void )
+{
+    for( uint32 Record = 0u; Record < 11u; Record++ )
+    {
+        TRACE( TRACE_CONTEXT_TASK, TRACE_EVENT_USER, Record );
+    }
+
+    TEST_ASSERT_EQUAL_MESSAGE( 11u, Trace_Buffer.Ring[ TRACE_CONTEXT_TASK ].Head, "Head is not the records written" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x80000008u, Trace_Buffer.Ring[ TRACE_CONTEXT_TASK ].Records[ 0 ].Word, "Slot 0 was not overwritten" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x8000000Au, Trace_Buffer.Ring[ TRACE_CONTEXT_TASK ].Records[ 2 ].Word, "Slot 2 was not overwritten" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x80000003u, Trace_Buffer.Ring[ TRACE_CONTEXT_TASK ].Records[ 3 ].Word, "Slot 3 was overwritten" );
+}
+
+/**
+ * @brief   **Test the timestamp while idle**
+ *
+ * The test validates the counter above the reload value, the SysTick period stretched by Tmr_Idle,
+ * counts as the start of the tick, to pass the timestamp on tick 10 should be 10 * (reload + 1).
+ */
+void test__Trace_GetCycles__stretched_period( void )
+{
+    Ticks   = 10u;
+    Counter = ( TMR_SYSTICK_RELOAD * 5u ) + 7u;
+
+    TEST_ASSERT_EQUAL_MESSAGE( 10u * ( TMR_SYSTICK_RELOAD + 1u ), Trace_GetCycles(), "Wrong timestamp with a stretched period" );
+}